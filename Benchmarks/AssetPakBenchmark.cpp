@@ -0,0 +1,147 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "Benchmark.h"
+
+#include "Core/Utility/FileUtility.h"
+#include "Object/AssetPak.h"
+
+#include <cstring>
+#include <format>
+#include <random>
+
+namespace
+{
+struct FLooseFile
+{
+    FUuid   Uuid;
+    FString Path;
+};
+
+/**
+ * 生成中间文件：开头 8 字节是 Hash，其余是带重复结构的数据，接近网格、纹理中间文件的可压缩程度
+ */
+bool WriteIntermediateFile(const FString& Path, const UInt64 Size, std::mt19937_64& Random)
+{
+    TArray<UInt8> Data;
+    Data.Resize(Size);
+    const UInt64 Hash = Random() | 1;
+    std::memcpy(Data.Data(), &Hash, sizeof(Hash));
+    for (UInt64 Offset = sizeof(Hash); Offset < Size; ++Offset)
+    {
+        Data[Offset] = static_cast<UInt8>((Offset % 48) < 40 ? Offset * 7 : Random());
+    }
+
+    auto Stream = FFileUtility::CreateFileStream(Path, true, true);
+    if (!Stream)
+    {
+        return false;
+    }
+    Stream->write(reinterpret_cast<const char*>(Data.Data()), static_cast<std::streamsize>(Data.Size()));
+    return Stream->good();
+}
+
+/**
+ * 每页读取一个字节，保证映射的页确实被访问到，与松散文件的读取量一致
+ */
+UInt64 TouchPages(const TSpan<const UInt8> Data)
+{
+    UInt64 Sum = 0;
+    for (size_t Offset = 0; Offset < Data.Size(); Offset += 4096)
+    {
+        Sum += Data[Offset];
+    }
+    return Sum + Data.Size();
+}
+} // namespace
+
+/**
+ * 按加载顺序读取全部中间文件：松散文件逐个打开读取，Pak 逐条读取以及 ReadBatch 批量读取
+ * 文件都在页缓存中，主要比较每个文件的打开与系统调用开销，冷缓存下 Pak 的顺序读取优势会更明显
+ */
+HK_BENCHMARK(AssetPakVsLooseFiles)
+{
+    const UInt64              NumFiles = Context.Scale(4000);
+    FScopedBenchmarkDirectory Directory("AssetPakVsLooseFiles");
+
+    // 生成 4KB ~ 256KB 的中间文件，不计时
+    std::mt19937_64    Random(42);
+    TArray<FLooseFile> Files;
+    Files.Reserve(NumFiles);
+    UInt64 TotalBytes = 0;
+    for (UInt64 Index = 0; Index < NumFiles; ++Index)
+    {
+        const UInt64 Size = 4096 + Random() % (252 * 1024);
+        FLooseFile   File{FUuid::New(), FString(std::format("Intermediate/Mesh/{}.hkmesh", Index))};
+        Context.Check(WriteIntermediateFile(File.Path, Size, Random), "Failed to write intermediate file");
+        TotalBytes += Size;
+        Files.Add(std::move(File));
+    }
+
+    FAssetPakWriter Writer;
+    FAssetPakWriter LZ4Writer;
+    FAssetPakWriter ZstdWriter;
+    for (UInt32 Index = 0; Index < Files.Size(); ++Index)
+    {
+        Writer.AddEntry(Files[Index].Uuid, EAssetType::Mesh, Files[Index].Path, Index);
+        LZ4Writer.AddEntry(Files[Index].Uuid, EAssetType::Mesh, Files[Index].Path, Index, EAssetPakCompression::LZ4);
+        ZstdWriter.AddEntry(Files[Index].Uuid, EAssetType::Mesh, Files[Index].Path, Index, EAssetPakCompression::Zstd);
+    }
+    Context.Check(Writer.Write("Assets.pak"), "Failed to write pak");
+    Context.Check(LZ4Writer.Write("AssetsLZ4.pak"), "Failed to write LZ4 pak");
+    Context.Check(ZstdWriter.Write("AssetsZstd.pak"), "Failed to write Zstd pak");
+
+    const std::string Prefix = std::format("{} files, {} MB: ", NumFiles, TotalBytes / (1024 * 1024));
+    UInt64            Expected = 0;
+    Context.Measure(Prefix + "loose files", NumFiles, [&] {
+        UInt64        Sum = 0;
+        TArray<UInt8> Data;
+        for (const FLooseFile& File : Files)
+        {
+            FFileUtility::ReadFileBytes(File.Path, Data);
+            Sum += TouchPages(TSpan<const UInt8>(Data.Data(), Data.Size()));
+        }
+        Expected = Sum;
+    });
+
+    for (const char* PakPath : {"Assets.pak", "AssetsLZ4.pak", "AssetsZstd.pak"})
+    {
+        FAssetPak Pak;
+        Context.Check(Pak.Open(PakPath), "Failed to open pak");
+        Context.Check(Pak.GetEntryCount() == NumFiles, "Pak entry count mismatch");
+
+        UInt64 Sum = 0;
+        Context.Measure(Prefix + std::format("{} Read", PakPath), NumFiles, [&] {
+            Sum = 0;
+            FAssetPakBuffer Buffer;
+            for (const FLooseFile& File : Files)
+            {
+                if (const FAssetPakEntry* Entry = Pak.FindEntry(File.Uuid); Entry && Pak.Read(*Entry, Buffer))
+                {
+                    Sum += TouchPages(Buffer.Data);
+                }
+            }
+        });
+        Context.Check(Sum == Expected, "Pak Read returned different data");
+
+        TArray<FAssetPakReadRequest> Requests;
+        Context.Measure(Prefix + std::format("{} ReadBatch", PakPath), NumFiles, [&] {
+            Requests.Clear();
+            Requests.Resize(Files.Size());
+            for (UInt64 Index = 0; Index < Files.Size(); ++Index)
+            {
+                Requests[Index].Uuid = Files[Index].Uuid;
+            }
+            Pak.ReadBatch(TSpan<FAssetPakReadRequest>(Requests.Data(), Requests.Size()));
+
+            Sum = 0;
+            for (const FAssetPakReadRequest& Request : Requests)
+            {
+                Sum += Request.bSuccess ? TouchPages(Request.Buffer.Data) : 0;
+            }
+        });
+        Context.Check(Sum == Expected, "Pak ReadBatch returned different data");
+        Pak.Close();
+    }
+}
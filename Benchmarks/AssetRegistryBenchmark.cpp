@@ -0,0 +1,77 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "Benchmark.h"
+#include "BenchmarkAssets.h"
+
+#include "Config/ConfigManager.h"
+#include "Core/Memory/MemoryBudget.h"
+#include "Object/AssetRegistry.h"
+
+#include <format>
+
+namespace
+{
+constexpr const char* DatabasePath = "Intermediate/AssetRegistry.db";
+
+void ShutDownRegistry()
+{
+    FAssetRegistry::Destroy();
+    FConfigManager::Destroy();
+    FMemoryBudget::Destroy();
+}
+} // namespace
+
+/**
+ * 冷启动时注册表的开销：没有数据库时逐个解析 .meta，有数据库时只比较 .meta 的时间戳
+ */
+HK_BENCHMARK(AssetRegistryColdStart)
+{
+    const UInt64              NumAssets = Context.Scale(50000);
+    FScopedBenchmarkDirectory Directory("AssetRegistryColdStart");
+
+    // 生成 .meta，不计时
+    TArray<FString> Paths;
+    Paths.Reserve(NumAssets);
+    bool bWritten = true;
+    for (UInt64 Index = 0; Index < NumAssets; ++Index)
+    {
+        Paths.Add(BenchmarkAssets::MakeTexturePath(Index));
+        bWritten = BenchmarkAssets::WriteMetaFile(*BenchmarkAssets::MakeTextureMetadata(Paths[Index])) && bWritten;
+    }
+    Context.Check(bWritten, "Failed to write .meta files");
+
+    const std::string Prefix = std::format("{} assets: ", NumAssets);
+
+    // 1. 没有数据库，启动时解析全部 .meta 并写入数据库
+    Context.Measure(Prefix + "start up and parse every .meta", NumAssets, [&] {
+        std::filesystem::remove(DatabasePath);
+        FAssetRegistry::GetRef();
+        ShutDownRegistry();
+    });
+    Context.Check(std::filesystem::exists(DatabasePath), "Registry database was not written");
+
+    // 2. 数据库与 .meta 一致，启动时只比较时间戳
+    Context.Measure(Prefix + "start up from the database", NumAssets, [&] {
+        FAssetRegistry::GetRef();
+        ShutDownRegistry();
+    });
+
+    // 3. 启动后按路径查询全部元数据
+    FAssetRegistry& Registry = FAssetRegistry::GetRef();
+    Context.Check(Registry.GetAllAssetUuids().Size() == NumAssets, "Registry lost assets");
+    UInt64 NumFound = 0;
+    Context.Measure(
+        Prefix + "load metadata by path", NumAssets,
+        [&] {
+            NumFound = 0;
+            for (const FString& Path : Paths)
+            {
+                NumFound += Registry.LoadAssetMetadata(Path) != nullptr ? 1 : 0;
+            }
+        },
+        1);
+    Context.Check(NumFound == NumAssets, "Metadata lookup by path failed");
+    ShutDownRegistry();
+}
@@ -0,0 +1,131 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "Benchmark.h"
+
+#include "Core/Logging/Logger.h"
+
+#include <cstdio>
+#include <cstring>
+
+void FBenchmarkContext::Report(const FStringView Label, const UInt64 Operations, const double Seconds)
+{
+    const double NanosecondsPerOperation = Operations > 0 ? Seconds * 1e9 / static_cast<double>(Operations) : 0.0;
+    std::printf("  %-64.*s %12.3f ms %12.2f ns/op\n", static_cast<int>(Label.Size()), Label.Data(), Seconds * 1e3,
+                NanosecondsPerOperation);
+    std::fflush(stdout);
+}
+
+void FBenchmarkContext::ReportValue(const FStringView Label, const double Value, const FStringView Unit)
+{
+    std::printf("  %-64.*s %12.2f %.*s\n", static_cast<int>(Label.Size()), Label.Data(), Value,
+                static_cast<int>(Unit.Size()), Unit.Data());
+    std::fflush(stdout);
+}
+
+void FBenchmarkContext::Check(const bool bCondition, const FStringView Message)
+{
+    if (!bCondition)
+    {
+        std::printf("  FAILED: %.*s\n", static_cast<int>(Message.Size()), Message.Data());
+        std::fflush(stdout);
+        bFailed = true;
+    }
+}
+
+TArray<FBenchmarkRegistry::FEntry>& FBenchmarkRegistry::GetEntries()
+{
+    static TArray<FEntry> Entries;
+    return Entries;
+}
+
+void FBenchmarkRegistry::Register(const char* Name, const FBenchmarkFunction Function)
+{
+    GetEntries().Add(FEntry{Name, Function});
+}
+
+int FBenchmarkRegistry::Run(int argc, char* argv[])
+{
+    bool                bQuick   = false;
+    bool                bList    = false;
+    bool                bVerbose = false;
+    TArray<const char*> Filters;
+    for (int Index = 1; Index < argc; ++Index)
+    {
+        if (std::strcmp(argv[Index], "-quick") == 0)
+        {
+            bQuick = true;
+        }
+        else if (std::strcmp(argv[Index], "-list") == 0)
+        {
+            bList = true;
+        }
+        else if (std::strcmp(argv[Index], "-verbose") == 0)
+        {
+            bVerbose = true;
+        }
+        else
+        {
+            Filters.Add(argv[Index]);
+        }
+    }
+
+    // 被测代码的 Info 日志会淹没结果
+    if (!bVerbose)
+    {
+        GLogger.MyLogger->set_level(spdlog::level::warn);
+    }
+
+    TArray<FEntry>& Entries = GetEntries();
+    Entries.Sort([](const FEntry& A, const FEntry& B) { return std::strcmp(A.Name, B.Name) < 0; });
+
+    FBenchmarkContext Context(bQuick);
+    Int32             NumRun = 0;
+    for (const FEntry& Entry : Entries)
+    {
+        const bool bMatched = Filters.IsEmpty() || std::any_of(Filters.begin(), Filters.end(), [&Entry](const char* F) {
+                                  return std::strstr(Entry.Name, F) != nullptr;
+                              });
+        if (!bMatched)
+        {
+            continue;
+        }
+        if (bList)
+        {
+            std::printf("%s\n", Entry.Name);
+            continue;
+        }
+
+        std::printf("[%s]\n", Entry.Name);
+        std::fflush(stdout);
+        FBenchmarkTimer Timer;
+        Entry.Function(Context);
+        std::printf("  (%.2f s)\n", Timer.GetSeconds());
+        ++NumRun;
+    }
+
+    if (!bList && NumRun == 0)
+    {
+        std::printf("No benchmark matched\n");
+        return 1;
+    }
+    return Context.HasFailed() ? 1 : 0;
+}
+
+FScopedBenchmarkDirectory::FScopedBenchmarkDirectory(const FStringView Name)
+{
+    std::error_code ErrorCode;
+    PreviousPath = std::filesystem::current_path();
+    Path         = std::filesystem::temp_directory_path() / "HKBenchmarks" / Name.GetStdString();
+    std::filesystem::remove_all(Path, ErrorCode);
+    std::filesystem::create_directories(Path);
+    std::filesystem::current_path(Path);
+}
+
+FScopedBenchmarkDirectory::~FScopedBenchmarkDirectory()
+{
+    std::error_code ErrorCode;
+    std::filesystem::current_path(PreviousPath, ErrorCode);
+    std::filesystem::remove_all(Path, ErrorCode);
+}
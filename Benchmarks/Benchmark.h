@@ -0,0 +1,178 @@
+#pragma once
+#include "Core/Container/Array.h"
+#include "Core/String/String.h"
+#include "Core/String/StringView.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <limits>
+
+class FBenchmarkContext;
+
+using FBenchmarkFunction = void (*)(FBenchmarkContext&);
+
+/**
+ * 计时器，使用单调时钟（FTimePoint 基于 system_clock，不适合计时）
+ */
+class FBenchmarkTimer
+{
+public:
+    using FClock = std::chrono::steady_clock;
+
+    FBenchmarkTimer() : Start(FClock::now()) {}
+
+    void Reset()
+    {
+        Start = FClock::now();
+    }
+
+    double GetSeconds() const
+    {
+        return std::chrono::duration<double>(FClock::now() - Start).count();
+    }
+
+private:
+    FClock::time_point Start;
+};
+
+/**
+ * 基准测试的运行参数与结果输出
+ */
+class FBenchmarkContext
+{
+public:
+    explicit FBenchmarkContext(const bool bInQuick) : bQuick(bInQuick) {}
+
+    bool IsQuick() const
+    {
+        return bQuick;
+    }
+
+    /**
+     * 按运行规模缩放数量，-quick 时缩小 100 倍，用于在 CI 中冒烟运行
+     */
+    UInt64 Scale(const UInt64 Count) const
+    {
+        return bQuick ? std::max<UInt64>(Count / 100, 1) : Count;
+    }
+
+    /**
+     * 重复执行 Repeats 次并输出最快的一次
+     * @param Label 结果名称
+     * @param Operations 单次执行包含的操作数，用于计算每次操作的耗时
+     * @param Body 被测代码
+     * @param Repeats 重复次数
+     */
+    template <typename Func>
+    void Measure(FStringView Label, UInt64 Operations, Func&& Body, Int32 Repeats = 3)
+    {
+        double Best = std::numeric_limits<double>::max();
+        for (Int32 Index = 0; Index < Repeats; ++Index)
+        {
+            FBenchmarkTimer Timer;
+            Body();
+            Best = std::min(Best, Timer.GetSeconds());
+        }
+        Report(Label, Operations, Best);
+    }
+
+    /**
+     * 输出一行耗时结果
+     */
+    void Report(FStringView Label, UInt64 Operations, double Seconds);
+
+    /**
+     * 输出一行非耗时的数值结果，如分配次数
+     */
+    void ReportValue(FStringView Label, double Value, FStringView Unit);
+
+    /**
+     * 校验被测代码的结果，失败时输出错误，进程最终以非零值退出
+     */
+    void Check(bool bCondition, FStringView Message);
+
+    bool HasFailed() const
+    {
+        return bFailed;
+    }
+
+    /**
+     * 阻止编译器把没有副作用的计算优化掉
+     */
+    template <typename T>
+    static void DoNotOptimize(const T& Value)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        static volatile const void* Sink;
+        Sink = &Value;
+#else
+        asm volatile("" : : "r,m"(Value) : "memory");
+#endif
+    }
+
+private:
+    bool bQuick  = false;
+    bool bFailed = false;
+};
+
+/**
+ * 已注册的基准测试，由 HK_BENCHMARK 在静态初始化时注册
+ */
+class FBenchmarkRegistry
+{
+public:
+    static void Register(const char* Name, FBenchmarkFunction Function);
+
+    /**
+     * 命令行：HKBenchmarks [-quick] [-list] [-verbose] [Filter...]
+     * Filter 为名称子串，不指定时运行全部
+     * @return 全部校验通过返回 0
+     */
+    static int Run(int argc, char* argv[]);
+
+private:
+    struct FEntry
+    {
+        const char*        Name;
+        FBenchmarkFunction Function;
+    };
+
+    static TArray<FEntry>& GetEntries();
+};
+
+struct FBenchmarkRegistrar
+{
+    FBenchmarkRegistrar(const char* Name, const FBenchmarkFunction Function)
+    {
+        FBenchmarkRegistry::Register(Name, Function);
+    }
+};
+
+/**
+ * 在新建的临时目录中运行，析构时恢复工作目录并删除临时目录
+ * 引擎的资产、中间文件路径都相对于工作目录，基准测试生成的文件不会污染仓库
+ */
+class FScopedBenchmarkDirectory
+{
+public:
+    explicit FScopedBenchmarkDirectory(FStringView Name);
+    ~FScopedBenchmarkDirectory();
+
+    FScopedBenchmarkDirectory(const FScopedBenchmarkDirectory&)            = delete;
+    FScopedBenchmarkDirectory& operator=(const FScopedBenchmarkDirectory&) = delete;
+
+    const std::filesystem::path& GetPath() const
+    {
+        return Path;
+    }
+
+private:
+    std::filesystem::path Path;
+    std::filesystem::path PreviousPath;
+};
+
+#define HK_BENCHMARK(Name)                                                                                             \
+    static void                HKBenchmark_##Name(FBenchmarkContext& Context);                                         \
+    static FBenchmarkRegistrar HKBenchmarkRegistrar_##Name(#Name, &HKBenchmark_##Name);                                \
+    static void                HKBenchmark_##Name(FBenchmarkContext& Context)
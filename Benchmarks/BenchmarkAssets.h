@@ -0,0 +1,54 @@
+#pragma once
+#include "Core/Serialization/JsonArchive.h"
+#include "Core/Utility/FileUtility.h"
+#include "Core/Utility/HashUtility.h"
+#include "Object/AssetRegistry.h"
+#include "Render/Texture/TextureImporter.h"
+
+#include <format>
+
+/**
+ * 资产相关基准测试共用的 .meta 数据
+ */
+namespace BenchmarkAssets
+{
+inline FString MakeTexturePath(const UInt64 Index)
+{
+    // 每个目录 256 个资产，接近实际项目的目录规模
+    return FString(std::format("Assets/Benchmark/{:03}/Texture_{}.png", Index / 256, Index));
+}
+
+/**
+ * 与导入纹理时生成的元数据相同
+ * 引擎中没有注册任何 FAssetMetadataFactory，FAssetRegistry::CreateAssetMetadata 无法创建元数据，这里直接构造
+ */
+inline TSharedPtr<FAssetMetadata> MakeTextureMetadata(const FString& Path)
+{
+    TSharedPtr<FAssetMetadata> Metadata = MakeShared<FAssetMetadata>();
+    Metadata->Uuid                      = FUuid::New();
+    Metadata->Path                      = Path;
+    Metadata->AssetType                 = EAssetType::Texture;
+    Metadata->FileType                  = EAssetFileType::PNG;
+    Metadata->ImportSetting             = MakeShared<FTextureImportSetting>();
+    Metadata->IntermediateHash          = FHashUtility::ComputeHash(Path.CStr());
+    return Metadata;
+}
+
+/**
+ * 按 FAssetRegistry::SaveAssetMetadata 的格式写入 Path.meta
+ */
+inline bool WriteMetaFile(FAssetMetadata& Metadata)
+{
+    auto File = FFileUtility::CreateFileStream(Metadata.Path + ".meta", true, true);
+    if (!File)
+    {
+        return false;
+    }
+    {
+        // JSON 在 Archive 析构时才写完
+        FJsonOutputArchive Archive(*File);
+        Metadata.Serialize(Archive);
+    }
+    return File->good();
+}
+} // namespace BenchmarkAssets
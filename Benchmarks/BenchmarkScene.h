@@ -0,0 +1,42 @@
+#pragma once
+#include "Math/Matrix.h"
+#include "Math/Vector.h"
+
+#include <random>
+
+/**
+ * 剔除相关基准测试共用的场景数据
+ */
+namespace BenchmarkScene
+{
+/**
+ * 位于原点、看向 -Z 的相机，Vulkan 裁剪空间（深度 [0, 1]，NDC 的 y 轴向下）
+ * MatrixUtils::MakePerspective 使用 glm 默认的 [-1, 1] 深度，与剔除代码的约定不一致
+ * 远平面默认放在场景之外：从矩阵提取的远平面在 float 下有约 0.01% 的误差，场景不会落在这个范围内
+ */
+inline FMatrix4x4f MakeViewProjection(const float FovY = 1.0471976f, const float Aspect = 16.0f / 9.0f,
+                                      const float Near = 0.1f, const float Far = 4000.0f)
+{
+    const float F = 1.0f / std::tan(FovY * 0.5f);
+    FMatrix4x4f Result;
+    Result(0, 0) = F / Aspect;
+    Result(1, 1) = -F;
+    Result(2, 2) = Far / (Near - Far);
+    Result(2, 3) = Near * Far / (Near - Far);
+    Result(3, 2) = -1.0f;
+    Result(3, 3) = 0.0f;
+    return Result;
+}
+
+/**
+ * 在以原点为中心、半边长为 HalfExtent 的立方体内均匀取点，大约 1/8 的点落在相机视锥内
+ */
+inline FVector3f RandomPoint(std::mt19937& Random, const float HalfExtent)
+{
+    std::uniform_real_distribution<float> Distribution(-HalfExtent, HalfExtent);
+    const float                           X = Distribution(Random);
+    const float                           Y = Distribution(Random);
+    const float                           Z = Distribution(Random);
+    return FVector3f(X, Y, Z);
+}
+} // namespace BenchmarkScene
@@ -0,0 +1,233 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "Benchmark.h"
+
+#include "Core/Event/Delegate.h"
+#include "Core/Event/Event.h"
+
+#include <format>
+#include <functional>
+
+namespace
+{
+using FDelegate = TDelegate<UInt64, UInt64>;
+using FFunction = std::function<UInt64(UInt64)>;
+
+constexpr UInt32 NumEventBindings = 16;
+
+UInt64 AddOne(const UInt64 Value)
+{
+    return Value + 1;
+}
+
+class FCounter
+{
+public:
+    explicit FCounter(const UInt64 InOffset) : Offset(InOffset) {}
+    virtual ~FCounter() = default;
+
+    UInt64 Add(const UInt64 Value)
+    {
+        return Value + Offset;
+    }
+
+    virtual UInt64 AddVirtual(const UInt64 Value)
+    {
+        return Value + Offset;
+    }
+
+private:
+    UInt64 Offset;
+};
+
+/**
+ * 40 字节的捕获放得进 TDelegate 的内联存储，超过了 libstdc++ 与 libc++ 中 std::function 的小对象缓冲
+ */
+struct FMediumCapture
+{
+    UInt64 Values[5];
+};
+
+// 两种实现都需要堆分配
+struct FLargeCapture
+{
+    UInt64 Values[8];
+};
+
+template <typename CallableType>
+UInt64 InvokeRepeatedly(const CallableType& Callable, const UInt64 NumCalls)
+{
+    // 让编译器无法看穿保存的调用目标，调用不会被内联
+    FBenchmarkContext::DoNotOptimize(Callable);
+    UInt64 Sum = 0;
+    for (UInt64 Index = 0; Index < NumCalls; ++Index)
+    {
+        Sum += Callable(Index);
+    }
+    return Sum;
+}
+
+void MeasureInvoke(FBenchmarkContext& Context, const char* Name, const UInt64 NumCalls, const FDelegate& Delegate,
+                   const FFunction& Function)
+{
+    UInt64 DelegateSum = 0;
+    UInt64 FunctionSum = 0;
+    Context.Measure(std::format("invoke {}: TDelegate", Name), NumCalls,
+                    [&] { DelegateSum = InvokeRepeatedly(Delegate, NumCalls); });
+    Context.Measure(std::format("invoke {}: std::function", Name), NumCalls,
+                    [&] { FunctionSum = InvokeRepeatedly(Function, NumCalls); });
+    Context.Check(DelegateSum == FunctionSum, "TDelegate and std::function returned different results");
+}
+
+/**
+ * 构造、绑定并销毁 NumBinds 次，MakeCallable(Index) 返回被绑定的可调用对象
+ */
+template <typename Func>
+void MeasureBind(FBenchmarkContext& Context, const char* Name, const UInt64 NumBinds, Func&& MakeCallable)
+{
+    UInt64 DelegateSum = 0;
+    UInt64 FunctionSum = 0;
+    Context.Measure(std::format("bind {}: TDelegate", Name), NumBinds, [&] {
+        DelegateSum = 0;
+        for (UInt64 Index = 0; Index < NumBinds; ++Index)
+        {
+            FDelegate Delegate;
+            Delegate.Bind(MakeCallable(Index));
+            FBenchmarkContext::DoNotOptimize(Delegate);
+            DelegateSum += Delegate(0);
+        }
+    });
+    Context.Measure(std::format("bind {}: std::function", Name), NumBinds, [&] {
+        FunctionSum = 0;
+        for (UInt64 Index = 0; Index < NumBinds; ++Index)
+        {
+            FFunction Function = MakeCallable(Index);
+            FBenchmarkContext::DoNotOptimize(Function);
+            FunctionSum += Function(0);
+        }
+    });
+    Context.Check(DelegateSum == FunctionSum, "TDelegate and std::function returned different results");
+}
+} // namespace
+
+/**
+ * TDelegate 与 std::function 的调用、绑定开销，以及 TEvent 的广播
+ */
+HK_BENCHMARK(Delegate)
+{
+    const UInt64 NumCalls = Context.Scale(20000000);
+    const UInt64 NumBinds = Context.Scale(2000000);
+    FCounter     Counter(3);
+
+    // 1. 调用
+    {
+        FDelegate Delegate;
+        Delegate.Bind(&AddOne);
+        MeasureInvoke(Context, "function pointer", NumCalls, Delegate, FFunction(&AddOne));
+    }
+    {
+        const UInt64 Offset = 5;
+        const auto   Lambda = [Offset](const UInt64 Value) { return Value + Offset; };
+        FDelegate    Delegate;
+        Delegate.Bind(Lambda);
+        MeasureInvoke(Context, "lambda, 8 byte capture", NumCalls, Delegate, FFunction(Lambda));
+    }
+    {
+        const auto Lambda = [Capture = FMediumCapture{{1, 2, 3, 4, 5}}](const UInt64 Value) {
+            return Value + Capture.Values[0] + Capture.Values[4];
+        };
+        FDelegate Delegate;
+        Delegate.Bind(Lambda);
+        MeasureInvoke(Context, "lambda, 40 byte capture", NumCalls, Delegate, FFunction(Lambda));
+    }
+    {
+        FDelegate Delegate;
+        Delegate.Bind(&Counter, &FCounter::Add);
+        MeasureInvoke(Context, "member function bound at run time", NumCalls, Delegate,
+                      FFunction(std::bind_front(&FCounter::Add, &Counter)));
+    }
+    {
+        FDelegate Delegate;
+        Delegate.Bind<&FCounter::Add>(&Counter);
+        MeasureInvoke(Context, "member function bound at compile time", NumCalls, Delegate,
+                      FFunction([&Counter](const UInt64 Value) { return Counter.Add(Value); }));
+    }
+    {
+        FDelegate Delegate;
+        Delegate.Bind(&Counter, &FCounter::AddVirtual);
+        MeasureInvoke(Context, "virtual member function", NumCalls, Delegate,
+                      FFunction(std::bind_front(&FCounter::AddVirtual, &Counter)));
+    }
+
+    // 2. 绑定
+    MeasureBind(Context, "lambda, 8 byte capture", NumBinds, [](const UInt64 Index) {
+        return [Index](const UInt64 Value) { return Value + Index; };
+    });
+    MeasureBind(Context, "lambda, 40 byte capture", NumBinds, [](const UInt64 Index) {
+        const FMediumCapture Capture{{Index, 1, 2, 3, 4}};
+        return [Capture](const UInt64 Value) { return Value + Capture.Values[0] + Capture.Values[4]; };
+    });
+    MeasureBind(Context, "lambda, 64 byte capture", NumBinds, [](const UInt64 Index) {
+        const FLargeCapture Capture{{Index, 1, 2, 3, 4, 5, 6, 7}};
+        return [Capture](const UInt64 Value) { return Value + Capture.Values[0] + Capture.Values[7]; };
+    });
+    {
+        UInt64 DelegateSum = 0;
+        UInt64 FunctionSum = 0;
+        Context.Measure("bind member function: TDelegate", NumBinds, [&] {
+            DelegateSum = 0;
+            for (UInt64 Index = 0; Index < NumBinds; ++Index)
+            {
+                FDelegate Delegate;
+                Delegate.Bind(&Counter, &FCounter::Add);
+                FBenchmarkContext::DoNotOptimize(Delegate);
+                DelegateSum += Delegate(Index);
+            }
+        });
+        Context.Measure("bind member function: std::function", NumBinds, [&] {
+            FunctionSum = 0;
+            for (UInt64 Index = 0; Index < NumBinds; ++Index)
+            {
+                FFunction Function = std::bind_front(&FCounter::Add, &Counter);
+                FBenchmarkContext::DoNotOptimize(Function);
+                FunctionSum += Function(Index);
+            }
+        });
+        Context.Check(DelegateSum == FunctionSum, "TDelegate and std::function returned different results");
+    }
+
+    // 3. 广播：TEvent 与 std::function 数组
+    {
+        const UInt64                        NumBroadcasts = NumCalls / NumEventBindings;
+        UInt64                              EventSum      = 0;
+        UInt64                              FunctionSum   = 0;
+        TEvent<UInt64>                      Event;
+        TArray<std::function<void(UInt64)>> Functions;
+        for (UInt32 Binding = 0; Binding < NumEventBindings; ++Binding)
+        {
+            Event.AddBind([&EventSum, Binding](const UInt64 Value) { EventSum += Value + Binding; });
+            Functions.Add([&FunctionSum, Binding](const UInt64 Value) { FunctionSum += Value + Binding; });
+        }
+        const std::string Prefix = std::format("broadcast to {} bindings: ", NumEventBindings);
+        Context.Measure(Prefix + "TEvent", NumBroadcasts * NumEventBindings, [&] {
+            EventSum = 0;
+            for (UInt64 Index = 0; Index < NumBroadcasts; ++Index)
+            {
+                Event.Invoke(Index);
+            }
+        });
+        Context.Measure(Prefix + "std::function array", NumBroadcasts * NumEventBindings, [&] {
+            FunctionSum = 0;
+            for (UInt64 Index = 0; Index < NumBroadcasts; ++Index)
+            {
+                for (const auto& Function : Functions)
+                {
+                    Function(Index);
+                }
+            }
+        });
+        Context.Check(EventSum == FunctionSum, "TEvent and std::function array returned different results");
+    }
+}
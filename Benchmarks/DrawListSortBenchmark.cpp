@@ -0,0 +1,104 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "Benchmark.h"
+
+#include "Render/Renderer/DrawList.h"
+#include "TaskGraph/TaskGraph.h"
+
+#include <algorithm>
+#include <format>
+#include <limits>
+#include <random>
+#include <thread>
+
+namespace
+{
+/**
+ * 与 FDrawList::Build 生成的键分布相近：少量管线、几百个网格、上千个材质，深度随机
+ */
+TArray<UInt64> MakeDrawKeys(const size_t NumKeys)
+{
+    std::mt19937                          Random(11);
+    std::uniform_int_distribution<UInt32> PipelineDistribution(0, 31);
+    std::uniform_int_distribution<UInt32> MeshDistribution(0, 511);
+    std::uniform_int_distribution<UInt32> MaterialDistribution(0, 1023);
+    std::uniform_real_distribution<float> DistanceDistribution(1.0f, 1000.0f);
+
+    TArray<UInt64> Keys;
+    Keys.Resize(NumKeys);
+    for (UInt64& Key : Keys)
+    {
+        const float Distance = DistanceDistribution(Random);
+        Key = FDrawSortKey::Make(EDrawPass::Opaque, PipelineDistribution(Random), MeshDistribution(Random),
+                                 MaterialDistribution(Random), FDrawSortKey::QuantizeDepth(Distance * Distance));
+    }
+    return Keys;
+}
+
+/**
+ * 用 std::stable_sort 校验结果，同时检查稳定性
+ */
+bool IsSortedStably(const TArray<UInt64>& Keys, const TArray<UInt64>& SortedKeys, const TArray<UInt32>& SortedValues)
+{
+    TArray<UInt32> Expected;
+    Expected.Resize(Keys.Size());
+    for (UInt32 Index = 0; Index < Expected.Size(); ++Index)
+    {
+        Expected[Index] = Index;
+    }
+    std::stable_sort(Expected.begin(), Expected.end(),
+                     [&Keys](const UInt32 Lhs, const UInt32 Rhs) { return Keys[Lhs] < Keys[Rhs]; });
+    for (size_t Index = 0; Index < Keys.Size(); ++Index)
+    {
+        if (SortedValues[Index] != Expected[Index] || SortedKeys[Index] != Keys[Expected[Index]])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+/**
+ * FDrawList::RadixSort 单线程与并行的耗时，用于确定 FDrawList::RadixSortParallelThreshold
+ * 并行排序的收益取决于 Worker 线程数，调整阈值时需要在目标硬件上运行
+ */
+HK_BENCHMARK(DrawListSort)
+{
+    FTaskGraph::GetRef();
+    Context.ReportValue("hardware concurrency", static_cast<double>(std::thread::hardware_concurrency()), "threads");
+
+    for (size_t NumKeys = 4096; NumKeys <= 262144; NumKeys *= 2)
+    {
+        const TArray<UInt64> Source   = MakeDrawKeys(NumKeys);
+        const UInt64         NumSorts = std::max<UInt64>(Context.Scale(4194304) / NumKeys, 1);
+        const std::string    Prefix   = std::format("{} keys: ", NumKeys);
+
+        TArray<UInt64> Keys;
+        TArray<UInt32> Values;
+        TArray<UInt64> ScratchKeys;
+        TArray<UInt32> ScratchValues;
+        const auto     Measure = [&](const char* Name, const size_t ParallelThreshold) {
+            // 每次排序前恢复未排序的输入，两种方式的计时都包含这部分拷贝
+            Context.Measure(Prefix + Name, NumSorts * NumKeys, [&] {
+                for (UInt64 Sort = 0; Sort < NumSorts; ++Sort)
+                {
+                    Keys = Source;
+                    Values.Resize(NumKeys);
+                    for (UInt32 Index = 0; Index < NumKeys; ++Index)
+                    {
+                        Values[Index] = Index;
+                    }
+                    FDrawList::RadixSort(Keys, Values, ScratchKeys, ScratchValues, ParallelThreshold);
+                }
+            });
+            Context.Check(IsSortedStably(Source, Keys, Values), Prefix + Name + " sorted incorrectly");
+        };
+        Measure("serial", std::numeric_limits<size_t>::max());
+        Measure("parallel", 0);
+    }
+
+    FTaskGraph::Destroy();
+}
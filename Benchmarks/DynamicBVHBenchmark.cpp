@@ -0,0 +1,173 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "Benchmark.h"
+#include "BenchmarkScene.h"
+
+#include "Render/Culling/DynamicBVH.h"
+#include "Render/Culling/Frustum.h"
+#include "TaskGraph/TaskGraph.h"
+
+#include <algorithm>
+#include <format>
+
+namespace
+{
+void* MakeUserData(const UInt32 Index)
+{
+    return reinterpret_cast<void*>(static_cast<uintptr_t>(Index) + 1);
+}
+
+UInt32 GetUserDataIndex(const void* UserData)
+{
+    return static_cast<UInt32>(reinterpret_cast<uintptr_t>(UserData) - 1);
+}
+
+FBox3f MakeBox(const FVector3f& Center, const float HalfExtent)
+{
+    return FBox3f(Center - FVector3f(HalfExtent), Center + FVector3f(HalfExtent));
+}
+
+/**
+ * 逐个平面的标量测试，作为 SIMD 测试与层级遍历的对照
+ */
+bool IntersectsBoxScalar(const FFrustum& Frustum, const FBox3f& Box)
+{
+    const FVector3f Center = Box.GetCenter();
+    const FVector3f Extent = Box.GetExtent();
+    for (UInt32 Index = 0; Index < FFrustum::PlaneCount; ++Index)
+    {
+        const FVector4f& Plane    = Frustum.GetPlane(Index);
+        const float      Distance = Plane.X * Center.X + Plane.Y * Center.Y + Plane.Z * Center.Z + Plane.W;
+        const float Radius = std::abs(Plane.X) * Extent.X + std::abs(Plane.Y) * Extent.Y + std::abs(Plane.Z) * Extent.Z;
+        if (Distance + Radius < 0.0f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * 树的结果必须包含所有与精确包围盒相交的实例，多出的实例只能来自扩大后的包围盒
+ */
+bool IsCullResultValid(const FDynamicBVH& Tree, const TArray<Int32>& ProxyIds, const TArray<FBox3f>& Boxes,
+                       const FFrustum& Frustum, const TArray<void*>& Result)
+{
+    TArray<UInt8> bVisible;
+    bVisible.Resize(Boxes.Size(), 0);
+    for (const void* UserData : Result)
+    {
+        const UInt32 Index = GetUserDataIndex(UserData);
+        if (Index >= Boxes.Size() || bVisible[Index] != 0 || !Frustum.IntersectsBox(Tree.GetFatBox(ProxyIds[Index])))
+        {
+            return false;
+        }
+        bVisible[Index] = 1;
+    }
+    for (size_t Index = 0; Index < Boxes.Size(); ++Index)
+    {
+        if (bVisible[Index] == 0 && Frustum.IntersectsBox(Boxes[Index]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+/**
+ * 1M 实例时每帧的视锥剔除：动态 BVH（上层拆分到 Worker 并行）、逐实例 SIMD 测试、逐实例标量测试
+ */
+HK_BENCHMARK(DynamicBVHCulling)
+{
+    const UInt32      NumInstances = static_cast<UInt32>(Context.Scale(1000000));
+    const UInt32      NumMoving    = NumInstances / 10;
+    const FFrustum    Frustum      = FFrustum::FromViewProjection(BenchmarkScene::MakeViewProjection());
+    const std::string Prefix       = std::format("{} instances: ", NumInstances);
+    FTaskGraph::GetRef();
+
+    std::mt19937                          Random(13);
+    std::uniform_real_distribution<float> ExtentDistribution(0.5f, 4.0f);
+    std::uniform_real_distribution<float> StepDistribution(-0.5f, 0.5f);
+    TArray<FBox3f>                        Boxes;
+    Boxes.Resize(NumInstances);
+    for (FBox3f& Box : Boxes)
+    {
+        Box = MakeBox(BenchmarkScene::RandomPoint(Random, 1000.0f), ExtentDistribution(Random));
+    }
+
+    // 1. 建树
+    FDynamicBVH   Tree;
+    TArray<Int32> ProxyIds;
+    ProxyIds.Resize(NumInstances);
+    Context.Measure(
+        Prefix + "build the tree", NumInstances,
+        [&] {
+            Tree.Clear();
+            for (UInt32 Index = 0; Index < NumInstances; ++Index)
+            {
+                ProxyIds[Index] = Tree.CreateProxy(Boxes[Index], MakeUserData(Index));
+            }
+        },
+        1);
+    Context.Check(Tree.GetProxyCount() == NumInstances, "Tree lost proxies");
+    Context.ReportValue(Prefix + "tree height", Tree.GetHeight(), "levels");
+
+    // 2. 静止场景每帧剔除
+    TArray<void*> Visible;
+    Visible.Reserve(NumInstances);
+    Context.Measure(Prefix + "cull per frame, dynamic BVH", 1, [&] {
+        Visible.Clear();
+        Tree.CullFrustum(Frustum, Visible);
+    });
+    Context.Check(!Visible.IsEmpty(), "No instance is visible");
+    Context.Check(IsCullResultValid(Tree, ProxyIds, Boxes, Frustum, Visible), "BVH culling result is wrong");
+    Context.ReportValue(Prefix + "visible", static_cast<double>(Visible.Size()), "instances");
+
+    // 逐实例测试同样输出可见实例的用户数据，与树的剔除做相同的工作
+    TArray<void*> SimdVisible;
+    SimdVisible.Reserve(NumInstances);
+    Context.Measure(Prefix + "cull per frame, linear SIMD test", 1, [&] {
+        SimdVisible.Clear();
+        for (UInt32 Index = 0; Index < NumInstances; ++Index)
+        {
+            if (Frustum.IntersectsBox(Boxes[Index]))
+            {
+                SimdVisible.Add(MakeUserData(Index));
+            }
+        }
+    });
+
+    TArray<void*> ScalarVisible;
+    ScalarVisible.Reserve(NumInstances);
+    Context.Measure(Prefix + "cull per frame, linear scalar test", 1, [&] {
+        ScalarVisible.Clear();
+        for (UInt32 Index = 0; Index < NumInstances; ++Index)
+        {
+            if (IntersectsBoxScalar(Frustum, Boxes[Index]))
+            {
+                ScalarVisible.Add(MakeUserData(Index));
+            }
+        }
+    });
+    Context.Check(std::ranges::equal(SimdVisible, ScalarVisible), "SIMD and scalar frustum tests disagree");
+    Context.Check(SimdVisible.Size() <= Visible.Size(), "BVH culled a visible instance");
+
+    // 3. 每帧 10% 的实例移动后再剔除
+    Context.Measure(Prefix + std::format("move {} proxies and cull per frame", NumMoving), 1, [&] {
+        for (UInt32 Moved = 0; Moved < NumMoving; ++Moved)
+        {
+            const UInt32    Index = Random() % NumInstances;
+            const FVector3f Step(StepDistribution(Random), StepDistribution(Random), StepDistribution(Random));
+            Boxes[Index] = FBox3f(Boxes[Index].Min + Step, Boxes[Index].Max + Step);
+            Tree.MoveProxy(ProxyIds[Index], Boxes[Index]);
+        }
+        Visible.Clear();
+        Tree.CullFrustum(Frustum, Visible);
+    });
+    Context.Check(IsCullResultValid(Tree, ProxyIds, Boxes, Frustum, Visible), "BVH culling is wrong after moves");
+
+    FTaskGraph::Destroy();
+}
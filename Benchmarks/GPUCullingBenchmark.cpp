@@ -0,0 +1,192 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "Benchmark.h"
+#include "BenchmarkScene.h"
+
+#include "Core/Container/Bitmap.h"
+#include "Render/Culling/GPUCullingReference.h"
+
+#include <format>
+
+namespace
+{
+constexpr UInt32 NumDrawBatches = 256;
+
+struct FCullingScene
+{
+    TArray<FGPUCullingInstance> Instances;
+    TArray<FGPUDrawBatch>       Batches;
+    TArray<FMatrix4x4f>         ModelMatrices;
+};
+
+/**
+ * 随机分布在相机周围的实例，按实例索引轮流分配到各个批次
+ */
+FCullingScene MakeScene(const UInt32 NumInstances)
+{
+    FCullingScene                         Scene;
+    std::mt19937                          Random(7);
+    std::uniform_real_distribution<float> ScaleDistribution(0.5f, 2.0f);
+    std::uniform_real_distribution<float> RadiusDistribution(0.5f, 4.0f);
+
+    Scene.Batches.Resize(NumDrawBatches);
+    Scene.Instances.Resize(NumInstances);
+    Scene.ModelMatrices.Resize(NumInstances);
+    for (UInt32 Index = 0; Index < NumInstances; ++Index)
+    {
+        const float Scale          = ScaleDistribution(Random);
+        Scene.ModelMatrices[Index] = MatrixUtils::MakeTranslation(BenchmarkScene::RandomPoint(Random, 1000.0f)) *
+                                     MatrixUtils::MakeScale(FVector3f(Scale, Scale, Scale));
+        FGPUCullingInstance& Instance = Scene.Instances[Index];
+        Instance.BoundsRadius         = RadiusDistribution(Random);
+        Instance.ModelMatrixIndex     = Index;
+        Instance.DrawBatchIndex       = Index % NumDrawBatches;
+        Scene.Batches[Instance.DrawBatchIndex].Capacity += 1;
+    }
+
+    UInt32 ArgsOffset = 0;
+    for (UInt32 BatchIndex = 0; BatchIndex < NumDrawBatches; ++BatchIndex)
+    {
+        FGPUDrawBatch& Batch = Scene.Batches[BatchIndex];
+        Batch.IndexCount     = 36;
+        Batch.FirstIndex     = BatchIndex * 36;
+        Batch.ArgsOffset     = ArgsOffset;
+        ArgsOffset += Batch.Capacity;
+    }
+    return Scene;
+}
+
+UInt64 SumCounts(const TArray<UInt32>& Counts)
+{
+    UInt64 Sum = 0;
+    for (const UInt32 Count : Counts)
+    {
+        Sum += Count;
+    }
+    return Sum;
+}
+
+/**
+ * 半径为 0 时剔除结果应与裁剪空间的点测试一致，用与剔除代码无关的方式校验平面提取与测试
+ */
+UInt32 CountPointTestMismatches(const FCullingScene& Scene, const FMatrix4x4f& ViewProjection,
+                                const TArray<FGPUDrawIndexedIndirectArgs>& Args, const TArray<UInt32>& Counts)
+{
+    FDynamicBitmap Visible(Scene.Instances.Size());
+    for (UInt32 BatchIndex = 0; BatchIndex < Scene.Batches.Size(); ++BatchIndex)
+    {
+        const FGPUDrawBatch& Batch = Scene.Batches[BatchIndex];
+        for (UInt32 Slot = 0; Slot < std::min(Counts[BatchIndex], Batch.Capacity); ++Slot)
+        {
+            Visible.Set(Args[Batch.ArgsOffset + Slot].FirstInstance);
+        }
+    }
+
+    UInt32 Mismatches = 0;
+    for (UInt32 Index = 0; Index < Scene.Instances.Size(); ++Index)
+    {
+        const FMatrix4x4f& Model = Scene.ModelMatrices[Index];
+        const FVector4f    Clip  = ViewProjection * (Model * FVector4f(0.0f, 0.0f, 0.0f, 1.0f));
+        const bool         bInside = Clip.W > 0.0f && std::abs(Clip.X) <= Clip.W && std::abs(Clip.Y) <= Clip.W &&
+                                     Clip.Z >= 0.0f && Clip.Z <= Clip.W;
+        Mismatches += bInside != Visible.Test(Index) ? 1 : 0;
+    }
+    return Mismatches;
+}
+} // namespace
+
+/**
+ * GPU 剔除 CPU 参考实现的正确性测试与 1M 实例的耗时
+ */
+HK_BENCHMARK(GPUCullingReference)
+{
+    const UInt32      NumInstances   = static_cast<UInt32>(Context.Scale(1000000));
+    const FMatrix4x4f ViewProjection = BenchmarkScene::MakeViewProjection();
+    FCullingScene     Scene          = MakeScene(NumInstances);
+
+    TArray<FGPUDrawIndexedIndirectArgs> Args;
+    TArray<UInt32>                      Counts;
+    const FGPUCullingViewParams View = FGPUCullingReference::MakeViewParams(ViewProjection, nullptr, NumInstances);
+
+    // 1. 半径为 0 的实例与裁剪空间点测试比较，只允许落在视锥边界上的浮点误差
+    {
+        FCullingScene PointScene = Scene;
+        for (FGPUCullingInstance& Instance : PointScene.Instances)
+        {
+            Instance.BoundsRadius = 0.0f;
+        }
+        FGPUCullingReference::Cull(PointScene.Instances, PointScene.Batches, PointScene.ModelMatrices, View, nullptr,
+                                   Args, Counts);
+        const UInt32 Mismatches = CountPointTestMismatches(PointScene, ViewProjection, Args, Counts);
+        Context.Check(SumCounts(Counts) > 0, "No instance is visible");
+        Context.Check(Mismatches <= NumInstances / 100000, "Frustum test disagrees with the clip space point test");
+    }
+
+    // 2. CompareResults 忽略批次内的写入顺序，但能发现缺少的实例
+    FGPUCullingReference::Cull(Scene.Instances, Scene.Batches, Scene.ModelMatrices, View, nullptr, Args, Counts);
+    const UInt64 NumVisible = SumCounts(Counts);
+    {
+        TArray<FGPUDrawIndexedIndirectArgs> Shuffled       = Args;
+        TArray<UInt32>                      ShuffledCounts = Counts;
+        std::mt19937                        Random(11);
+        for (const FGPUDrawBatch& Batch : Scene.Batches)
+        {
+            const UInt32 Written = std::min(ShuffledCounts[&Batch - Scene.Batches.Data()], Batch.Capacity);
+            std::shuffle(Shuffled.begin() + Batch.ArgsOffset, Shuffled.begin() + Batch.ArgsOffset + Written, Random);
+        }
+        Context.Check(FGPUCullingReference::CompareResults(Scene.Batches, Args, Counts, Shuffled, ShuffledCounts),
+                      "CompareResults rejected a reordered result");
+
+        UInt32 Batch = 0;
+        while (Batch < NumDrawBatches && ShuffledCounts[Batch] == 0)
+        {
+            ++Batch;
+        }
+        if (Batch < NumDrawBatches)
+        {
+            ShuffledCounts[Batch] -= 1;
+            UInt32 Mismatch = 0;
+            Context.Check(!FGPUCullingReference::CompareResults(Scene.Batches, Args, Counts, Shuffled, ShuffledCounts,
+                                                                &Mismatch) &&
+                              Mismatch == Batch,
+                          "CompareResults accepted a result with a missing instance");
+        }
+    }
+
+    // 3. 最远深度的 HiZ 不剔除任何实例，最近深度的 HiZ 只留下与近平面相交的实例
+    constexpr UInt32 HiZWidth  = 256;
+    constexpr UInt32 HiZHeight = 144;
+    TArray<float>    Depth;
+    Depth.Resize(HiZWidth * HiZHeight, 1.0f);
+    FHiZPyramid FarHiZ;
+    FarHiZ.Build(TSpan<const float>(Depth.Data(), Depth.Size()), HiZWidth, HiZHeight);
+    const FGPUCullingViewParams FarView = FGPUCullingReference::MakeViewParams(ViewProjection, &FarHiZ, NumInstances);
+    {
+        TArray<FGPUDrawIndexedIndirectArgs> OccludedArgs;
+        TArray<UInt32>                      OccludedCounts;
+        FGPUCullingReference::Cull(Scene.Instances, Scene.Batches, Scene.ModelMatrices, FarView, &FarHiZ,
+                                   OccludedArgs, OccludedCounts);
+        Context.Check(FGPUCullingReference::CompareResults(Scene.Batches, Args, Counts, OccludedArgs, OccludedCounts),
+                      "Far HiZ occluded visible instances");
+
+        std::fill(Depth.begin(), Depth.end(), 0.0f);
+        FHiZPyramid NearHiZ;
+        NearHiZ.Build(TSpan<const float>(Depth.Data(), Depth.Size()), HiZWidth, HiZHeight);
+        FGPUCullingReference::Cull(Scene.Instances, Scene.Batches, Scene.ModelMatrices,
+                                   FGPUCullingReference::MakeViewParams(ViewProjection, &NearHiZ, NumInstances),
+                                   &NearHiZ, OccludedArgs, OccludedCounts);
+        Context.Check(SumCounts(OccludedCounts) * 100 < NumVisible, "Near HiZ did not occlude instances");
+    }
+
+    // 4. 耗时
+    const std::string Prefix = std::format("{} instances, {} batches: ", NumInstances, NumDrawBatches);
+    Context.Measure(Prefix + "frustum", NumInstances, [&] {
+        FGPUCullingReference::Cull(Scene.Instances, Scene.Batches, Scene.ModelMatrices, View, nullptr, Args, Counts);
+    });
+    Context.Measure(Prefix + "frustum + HiZ", NumInstances, [&] {
+        FGPUCullingReference::Cull(Scene.Instances, Scene.Batches, Scene.ModelMatrices, FarView, &FarHiZ, Args, Counts);
+    });
+    Context.ReportValue(Prefix + "visible", static_cast<double>(NumVisible), "instances");
+}
@@ -0,0 +1,146 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "Benchmark.h"
+
+#include "Core/Container/InlineArray.h"
+#include "Core/Container/Span.h"
+#include "RHI/RHICommandBuffer.h"
+
+#include <format>
+
+namespace
+{
+/**
+ * 统计分配次数的分配策略，内存仍来自 FHeapAllocatorPolicy
+ */
+struct FCountingAllocatorPolicy
+{
+    static inline UInt64 NumAllocations = 0;
+
+    static void* Allocate(const size_t Size, const size_t Alignment)
+    {
+        ++NumAllocations;
+        return FHeapAllocatorPolicy::Allocate(Size, Alignment);
+    }
+
+    static void Free(void* Ptr, const size_t Size, const size_t Alignment) noexcept
+    {
+        FHeapAllocatorPolicy::Free(Ptr, Size, Alignment);
+    }
+};
+
+struct FBuildAndPassResult
+{
+    // 接口返回值之和，用于比较不同容器的结果
+    UInt64 Sum         = 0;
+    UInt64 Allocations = 0;
+};
+
+/**
+ * 模拟 FRHICommandBuffer::CopyBuffer 等以 TSpan 接收列表的接口
+ */
+template <typename T>
+UInt64 ConsumeSpan(TSpan<const T> Items)
+{
+    FBenchmarkContext::DoNotOptimize(Items);
+    UInt64 Sum = 0;
+    for (const T& Item : Items)
+    {
+        if constexpr (std::is_pointer_v<T>)
+        {
+            Sum += reinterpret_cast<uintptr_t>(Item);
+        }
+        else
+        {
+            Sum += Item.Size;
+        }
+    }
+    return Sum;
+}
+
+template <typename T>
+T MakeItem(const UInt64 Index)
+{
+    if constexpr (std::is_pointer_v<T>)
+    {
+        return reinterpret_cast<T>(static_cast<uintptr_t>(Index + 1) * 16);
+    }
+    else
+    {
+        return T{Index * 256, Index * 512, Index + 1};
+    }
+}
+
+/**
+ * 每次迭代在栈上构建 NumItems 个元素的列表，以 TSpan 传给接口后销毁
+ */
+template <typename ArrayType, typename T>
+FBuildAndPassResult MeasureBuildAndPass(FBenchmarkContext& Context, const std::string& Label,
+                                        const UInt64 NumIterations, const UInt32 NumItems)
+{
+    FBuildAndPassResult Result;
+    Context.Measure(Label, NumIterations, [&] {
+        Result.Sum = 0;
+        for (UInt64 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            ArrayType Items;
+            for (UInt32 Index = 0; Index < NumItems; ++Index)
+            {
+                Items.Add(MakeItem<T>(Iteration + Index));
+            }
+            Result.Sum += ConsumeSpan<T>(Items);
+        }
+    });
+
+    // 计时之外单独执行一遍统计分配
+    const UInt64 FirstAllocation = FCountingAllocatorPolicy::NumAllocations;
+    for (UInt64 Iteration = 0; Iteration < NumIterations; ++Iteration)
+    {
+        ArrayType Items;
+        for (UInt32 Index = 0; Index < NumItems; ++Index)
+        {
+            Items.Add(MakeItem<T>(Iteration + Index));
+        }
+        FBenchmarkContext::DoNotOptimize(Items);
+    }
+    Result.Allocations       = FCountingAllocatorPolicy::NumAllocations - FirstAllocation;
+    const double Allocations = static_cast<double>(Result.Allocations);
+    Context.ReportValue(Label + " allocations", Allocations / static_cast<double>(NumIterations), "per iteration");
+    return Result;
+}
+
+template <typename T, size_t N>
+void RunInlineArrayComparison(FBenchmarkContext& Context, const char* Name, const UInt64 NumIterations)
+{
+    using FHeapArray   = TArray<T, FCountingAllocatorPolicy>;
+    using FInlineArray = TInlineArray<T, N, FCountingAllocatorPolicy>;
+
+    for (const UInt32 NumItems : {UInt32(1), UInt32(N), UInt32(N * 2)})
+    {
+        const std::string HeapLabel   = std::format("{} {}: TArray", NumItems, Name);
+        const std::string InlineLabel = std::format("{} {}: TInlineArray<{}>", NumItems, Name, N);
+
+        const auto Heap   = MeasureBuildAndPass<FHeapArray, T>(Context, HeapLabel, NumIterations, NumItems);
+        const auto Inline = MeasureBuildAndPass<FInlineArray, T>(Context, InlineLabel, NumIterations, NumItems);
+
+        Context.Check(Heap.Sum == Inline.Sum, "TArray and TInlineArray passed different elements");
+        Context.Check(Heap.Allocations >= NumIterations, "TArray did not allocate");
+        // 不超过内联容量时不分配，超过后只分配一次
+        Context.Check(Inline.Allocations == (NumItems <= N ? 0 : NumIterations),
+                      "TInlineArray allocated more than expected");
+    }
+}
+} // namespace
+
+/**
+ * 短列表的分配次数与耗时：TArray 与 TInlineArray，元素个数不超过、等于与超过内联容量
+ * 元素与内联容量对应 RHI 命令中的复制区域（2 个）与描述符集、任务依赖（4 个）
+ */
+HK_BENCHMARK(InlineArray)
+{
+    const UInt64 NumIterations = Context.Scale(1000000);
+    RunInlineArrayComparison<FRHIBufferCopyRegion, 2>(Context, "buffer copy regions", NumIterations);
+    RunInlineArrayComparison<const void*, 4>(Context, "pointers", NumIterations);
+}
@@ -0,0 +1,269 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "Benchmark.h"
+
+#include "Core/Container/Map.h"
+
+#include <format>
+#include <random>
+#include <unordered_map>
+
+namespace
+{
+// 每项测试的目标操作数，小表重复多轮以获得稳定的计时
+constexpr UInt64 TargetOperations = 1000000;
+
+template <typename KeyType>
+using TStdMap = std::unordered_map<KeyType, UInt64>;
+
+template <typename KeyType>
+void MapAdd(TMap<KeyType, UInt64>& Map, const KeyType& Key, const UInt64 Value)
+{
+    Map.Add(Key, Value);
+}
+
+template <typename KeyType>
+void MapAdd(TStdMap<KeyType>& Map, const KeyType& Key, const UInt64 Value)
+{
+    Map.emplace(Key, Value);
+}
+
+template <typename KeyType>
+void MapReserve(TMap<KeyType, UInt64>& Map, const size_t Count)
+{
+    Map.Reserve(Count);
+}
+
+template <typename KeyType>
+void MapReserve(TStdMap<KeyType>& Map, const size_t Count)
+{
+    Map.reserve(Count);
+}
+
+template <typename KeyType, typename QueryType>
+const UInt64* MapFind(const TMap<KeyType, UInt64>& Map, const QueryType& Key)
+{
+    return Map.Find(Key);
+}
+
+template <typename KeyType>
+const UInt64* MapFind(const TStdMap<KeyType>& Map, const KeyType& Key)
+{
+    const auto It = Map.find(Key);
+    return It != Map.end() ? &It->second : nullptr;
+}
+
+template <typename KeyType>
+bool MapRemove(TMap<KeyType, UInt64>& Map, const KeyType& Key)
+{
+    return Map.Remove(Key);
+}
+
+template <typename KeyType>
+bool MapRemove(TStdMap<KeyType>& Map, const KeyType& Key)
+{
+    return Map.erase(Key) != 0;
+}
+
+template <typename KeyType>
+size_t MapSize(const TMap<KeyType, UInt64>& Map)
+{
+    return Map.Size();
+}
+
+template <typename KeyType>
+size_t MapSize(const TStdMap<KeyType>& Map)
+{
+    return Map.size();
+}
+
+/**
+ * 与 FBenchmarkContext::Measure 相同，但每次执行前调用不计时的 Setup
+ */
+template <typename SetupFunc, typename Func>
+void MeasureWithSetup(FBenchmarkContext& Context, FStringView Label, const UInt64 Operations, SetupFunc&& Setup,
+                      Func&& Body, const Int32 Repeats = 3)
+{
+    double Best = std::numeric_limits<double>::max();
+    for (Int32 Index = 0; Index < Repeats; ++Index)
+    {
+        Setup();
+        FBenchmarkTimer Timer;
+        Body();
+        Best = std::min(Best, Timer.GetSeconds());
+    }
+    Context.Report(Label, Operations, Best);
+}
+
+/**
+ * 对一种映射执行插入、命中查找、未命中查找与删除，返回命中查找的值之和用于与其他实现比较
+ */
+template <typename MapType, typename KeyType>
+UInt64 RunMapSuite(FBenchmarkContext& Context, const std::string& Prefix, const TArray<KeyType>& Keys,
+                   const TArray<KeyType>& MissingKeys)
+{
+    const UInt64 NumKeys    = Keys.Size();
+    const UInt64 Rounds     = std::max<UInt64>(Context.Scale(TargetOperations) / NumKeys, 1);
+    const UInt64 Operations = NumKeys * Rounds;
+
+    Context.Measure(Prefix + "insert", Operations, [&] {
+        for (UInt64 Round = 0; Round < Rounds; ++Round)
+        {
+            MapType Map;
+            for (UInt64 Index = 0; Index < NumKeys; ++Index)
+            {
+                MapAdd(Map, Keys[Index], Index);
+            }
+            FBenchmarkContext::DoNotOptimize(Map);
+        }
+    });
+    Context.Measure(Prefix + "insert after reserve", Operations, [&] {
+        for (UInt64 Round = 0; Round < Rounds; ++Round)
+        {
+            MapType Map;
+            MapReserve(Map, NumKeys);
+            for (UInt64 Index = 0; Index < NumKeys; ++Index)
+            {
+                MapAdd(Map, Keys[Index], Index);
+            }
+            FBenchmarkContext::DoNotOptimize(Map);
+        }
+    });
+
+    MapType Map;
+    for (UInt64 Index = 0; Index < NumKeys; ++Index)
+    {
+        MapAdd(Map, Keys[Index], Index);
+    }
+    Context.Check(MapSize(Map) == NumKeys, "Map lost keys on insert");
+
+    UInt64 HitSum = 0;
+    Context.Measure(Prefix + "lookup hit", Operations, [&] {
+        HitSum = 0;
+        for (UInt64 Round = 0; Round < Rounds; ++Round)
+        {
+            for (const KeyType& Key : Keys)
+            {
+                const UInt64* Value = MapFind(Map, Key);
+                HitSum += Value != nullptr ? *Value + 1 : 0;
+            }
+        }
+    });
+    Context.Check(HitSum == Rounds * NumKeys * (NumKeys + 1) / 2, "Lookup returned a wrong value");
+
+    UInt64 NumMissFound = 0;
+    Context.Measure(Prefix + "lookup miss", Operations, [&] {
+        NumMissFound = 0;
+        for (UInt64 Round = 0; Round < Rounds; ++Round)
+        {
+            for (const KeyType& Key : MissingKeys)
+            {
+                NumMissFound += MapFind(Map, Key) != nullptr ? 1 : 0;
+            }
+        }
+    });
+    Context.Check(NumMissFound == 0, "Lookup found a key that was never inserted");
+
+    // 删除会破坏表，每次执行前准备好 Rounds 份副本
+    TArray<MapType> Copies;
+    UInt64          NumRemoved = 0;
+    MeasureWithSetup(
+        Context, Prefix + "erase", Operations,
+        [&] {
+            Copies.Clear();
+            Copies.Resize(Rounds, Map);
+        },
+        [&] {
+            NumRemoved = 0;
+            for (MapType& Copy : Copies)
+            {
+                for (const KeyType& Key : Keys)
+                {
+                    NumRemoved += MapRemove(Copy, Key) ? 1 : 0;
+                }
+            }
+        });
+    Context.Check(NumRemoved == Operations && MapSize(Copies[0]) == 0, "Erase did not remove every key");
+    return HitSum;
+}
+
+template <typename KeyType>
+void RunMapComparison(FBenchmarkContext& Context, const char* KeyName, const TArray<KeyType>& Keys,
+                      const TArray<KeyType>& MissingKeys)
+{
+    const std::string Prefix    = std::format("{} {} keys, ", Keys.Size(), KeyName);
+    const UInt64      MapSum    = RunMapSuite<TMap<KeyType, UInt64>>(Context, Prefix + "TMap: ", Keys, MissingKeys);
+    const UInt64      StdMapSum = RunMapSuite<TStdMap<KeyType>>(Context, Prefix + "unordered_map: ", Keys, MissingKeys);
+    Context.Check(MapSum == StdMapSum, "TMap and std::unordered_map disagree");
+}
+
+TArray<UInt64> MakeIntegerKeys(std::mt19937_64& Random, const UInt64 Count)
+{
+    // 奇数为已插入的键，偶数用于未命中查找，两组不会重叠
+    TArray<UInt64> Keys;
+    Keys.Reserve(Count);
+    for (UInt64 Index = 0; Index < Count; ++Index)
+    {
+        Keys.Add(Random() | 1);
+    }
+    return Keys;
+}
+
+TArray<FString> MakePathKeys(const char* Directory, const UInt64 Count)
+{
+    TArray<FString> Keys;
+    Keys.Reserve(Count);
+    for (UInt64 Index = 0; Index < Count; ++Index)
+    {
+        Keys.Add(FString(std::format("Assets/{}/{:03}/Texture_{}.png", Directory, Index % 512, Index)));
+    }
+    return Keys;
+}
+} // namespace
+
+/**
+ * TMap 与原先作为其实现的 std::unordered_map 对比：整数键与资产路径键，小表与大表
+ */
+HK_BENCHMARK(Map)
+{
+    std::mt19937_64 Random(17);
+    for (const UInt64 Count : {UInt64(1024), Context.Scale(1000000)})
+    {
+        TArray<UInt64> Keys        = MakeIntegerKeys(Random, Count);
+        TArray<UInt64> MissingKeys = MakeIntegerKeys(Random, Count);
+        for (UInt64& Key : MissingKeys)
+        {
+            Key &= ~UInt64(1);
+        }
+        RunMapComparison(Context, "integer", Keys, MissingKeys);
+
+        TArray<FString> Paths        = MakePathKeys("Textures", Count);
+        TArray<FString> MissingPaths = MakePathKeys("Missing", Count);
+        RunMapComparison(Context, "path", Paths, MissingPaths);
+
+        // FString 键可以直接用 FStringView 查找，不构造临时 FString
+        TMap<FString, UInt64> PathMap;
+        TArray<FStringView>   PathViews;
+        PathViews.Reserve(Count);
+        for (UInt64 Index = 0; Index < Count; ++Index)
+        {
+            PathMap.Add(Paths[Index], Index);
+            PathViews.Add(FStringView(Paths[Index]));
+        }
+        const UInt64 Rounds   = std::max<UInt64>(Context.Scale(TargetOperations) / Count, 1);
+        UInt64       NumFound = 0;
+        Context.Measure(std::format("{} path keys, TMap: lookup hit by FStringView", Count), Count * Rounds, [&] {
+            NumFound = 0;
+            for (UInt64 Round = 0; Round < Rounds; ++Round)
+            {
+                for (const FStringView& View : PathViews)
+                {
+                    NumFound += MapFind(PathMap, View) != nullptr ? 1 : 0;
+                }
+            }
+        });
+        Context.Check(NumFound == Count * Rounds, "FStringView lookup missed a key");
+    }
+}
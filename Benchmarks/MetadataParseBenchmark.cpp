@@ -0,0 +1,122 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "Benchmark.h"
+#include "BenchmarkAssets.h"
+
+#include "Core/Serialization/JsonStreamArchive.h"
+#include "Core/Serialization/MemoryStream.h"
+
+#include <algorithm>
+#include <format>
+
+namespace
+{
+bool IsSameMetadata(const TSharedPtr<FAssetMetadata>& Expected, const FAssetMetadata& Parsed)
+{
+    return Parsed.Uuid == Expected->Uuid && Parsed.Path == Expected->Path && Parsed.AssetType == Expected->AssetType &&
+           Parsed.FileType == Expected->FileType && Parsed.IntermediateHash == Expected->IntermediateHash &&
+           Parsed.ImportSetting && Parsed.ImportSetting->GetType() == Expected->ImportSetting->GetType();
+}
+
+/**
+ * 逐个解析全部元数据，Parse(Index, Metadata) 解析第 Index 个 .meta 到 Metadata 中
+ */
+template <typename Func>
+void MeasureParse(FBenchmarkContext& Context, const std::string& Label,
+                  const TArray<TSharedPtr<FAssetMetadata>>& Expected, Func&& Parse)
+{
+    TArray<FAssetMetadata> Parsed;
+    Parsed.Resize(Expected.Size());
+    UInt64 NumFailed = 0;
+    Context.Measure(Label, Expected.Size(), [&] {
+        NumFailed = 0;
+        for (size_t Index = 0; Index < Expected.Size(); ++Index)
+        {
+            Parsed[Index] = FAssetMetadata();
+            try
+            {
+                NumFailed += Parse(Index, Parsed[Index]) ? 0 : 1;
+            }
+            catch (const std::exception&)
+            {
+                ++NumFailed;
+            }
+        }
+    });
+    Context.Check(NumFailed == 0, Label + " failed to parse a .meta file");
+    Context.Check(std::ranges::equal(Expected, Parsed, IsSameMetadata), Label + " parsed different metadata");
+}
+} // namespace
+
+/**
+ * 解析 50k 个 .meta：cereal JSON（rapidjson DOM）与按需解析的 FJsonStreamInputArchive
+ * 分别测量只解析内存中的文本，以及与 FAssetRegistry::LoadAssetMetadataFromFile 一样读取文件后解析
+ */
+HK_BENCHMARK(MetadataParse)
+{
+    const UInt64              NumFiles = Context.Scale(50000);
+    FScopedBenchmarkDirectory Directory("MetadataParse");
+
+    // 生成 .meta 并读入内存，不计时
+    TArray<TSharedPtr<FAssetMetadata>> Expected;
+    TArray<FString>                    MetaPaths;
+    TArray<TArray<UInt8>>              Texts;
+    Expected.Reserve(NumFiles);
+    MetaPaths.Reserve(NumFiles);
+    Texts.Resize(NumFiles);
+    UInt64 TotalBytes = 0;
+    bool   bWritten   = true;
+    for (UInt64 Index = 0; Index < NumFiles; ++Index)
+    {
+        Expected.Add(BenchmarkAssets::MakeTextureMetadata(BenchmarkAssets::MakeTexturePath(Index)));
+        MetaPaths.Add(Expected[Index]->Path + ".meta");
+        bWritten = BenchmarkAssets::WriteMetaFile(*Expected[Index]) &&
+                   FFileUtility::ReadFileBytes(MetaPaths[Index], Texts[Index]) && bWritten;
+        TotalBytes += Texts[Index].Size();
+    }
+    Context.Check(bWritten, "Failed to write .meta files");
+
+    const std::string Prefix = std::format("{} .meta files, ", NumFiles);
+    Context.ReportValue(Prefix + "total size", static_cast<double>(TotalBytes) / 1048576.0, "MB");
+
+    // 1. 只解析
+    MeasureParse(Context, Prefix + "parse in memory: cereal JSON DOM", Expected,
+                 [&](const size_t Index, FAssetMetadata& Metadata) {
+                     FMemoryInputStream Stream(Texts[Index].Data(), Texts[Index].Size());
+                     FJsonInputArchive  Archive(Stream);
+                     Metadata.Serialize(Archive);
+                     return true;
+                 });
+    MeasureParse(Context, Prefix + "parse in memory: FJsonStreamInputArchive", Expected,
+                 [&](const size_t Index, FAssetMetadata& Metadata) {
+                     FJsonStreamInputArchive Archive(Texts[Index].Data(), Texts[Index].Size());
+                     Metadata.Serialize(Archive);
+                     return true;
+                 });
+
+    // 2. 读取文件并解析，前者是改为按需解析之前 LoadAssetMetadataFromFile 的做法
+    MeasureParse(Context, Prefix + "read and parse: ifstream + cereal JSON DOM", Expected,
+                 [&](const size_t Index, FAssetMetadata& Metadata) {
+                     const auto File = FFileUtility::OpenFileStream(MetaPaths[Index]);
+                     if (!File)
+                     {
+                         return false;
+                     }
+                     FJsonInputArchive Archive(*File);
+                     Metadata.Serialize(Archive);
+                     return true;
+                 });
+    MeasureParse(Context, Prefix + "read and parse: ReadFileBytes + FJsonStreamInputArchive", Expected,
+                 [&](const size_t Index, FAssetMetadata& Metadata) {
+                     TArray<UInt8> Data;
+                     if (!FFileUtility::ReadFileBytes(MetaPaths[Index], Data))
+                     {
+                         return false;
+                     }
+                     FJsonStreamInputArchive Archive(Data.Data(), Data.Size());
+                     Metadata.Serialize(Archive);
+                     return true;
+                 });
+}
@@ -0,0 +1,224 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "Benchmark.h"
+#include "BenchmarkScene.h"
+
+#include "Config/ConfigManager.h"
+#include "Core/Memory/MemoryBudget.h"
+#include "RHI/GfxDevice.h"
+#include "RHI/RHIConfig.h"
+#include "RHI/RHIWindow.h"
+#include "Render/GlobalRenderResources.h"
+
+#include <cstring>
+#include <format>
+#include <numeric>
+
+namespace
+{
+constexpr UInt32 FramesPerMeasure = 16;
+
+FRenderer* MakeFakeRenderer(const UInt64 Index)
+{
+    // 模型矩阵池只把 FRenderer* 当作键，不会解引用
+    return reinterpret_cast<FRenderer*>(static_cast<uintptr_t>(Index + 1) * alignof(std::max_align_t));
+}
+
+FMatrix4x4f MakeModelMatrix(const FVector3f& Position)
+{
+    return MatrixUtils::MakeTranslation(Position);
+}
+
+/**
+ * 每帧移动一组实例，模拟 Game 线程生成快照、Render 线程应用快照并上传当前在途帧的缓冲
+ */
+class FModelMatrixFrameDriver
+{
+public:
+    FModelMatrixFrameDriver(const TArray<Int32>& InMovingIndices, const TArray<FVector3f>& InPositions)
+        : MovingIndices(InMovingIndices), Positions(InPositions)
+    {
+    }
+
+    void RunFrame()
+    {
+        auto& Pool = FGlobalDynamicRenderResourcePool::GetRef();
+        ++FrameNumber;
+        const FVector3f Offset(0.0f, 0.01f * static_cast<float>(FrameNumber), 0.0f);
+        for (const Int32 Index : MovingIndices)
+        {
+            Pool.UpdateModelMatrix(MakeModelMatrix(Positions[Index] + Offset), Index);
+        }
+        Pool.CaptureModelMatrixUpdate(Update);
+        Pool.ApplyModelMatrixUpdate(Update);
+        Pool.SyncToGPU(GetFrameIndex());
+        UploadedMatrices += Update.Matrices.Size();
+    }
+
+    UInt32 GetFrameIndex() const
+    {
+        return static_cast<UInt32>(FrameNumber % HK_RENDER_MAX_FRAME_IN_FLIGHT);
+    }
+
+    const FModelMatrixUpdate& GetLastUpdate() const
+    {
+        return Update;
+    }
+
+    UInt64 GetFrameNumber() const
+    {
+        return FrameNumber;
+    }
+
+    UInt64 GetUploadedMatrices() const
+    {
+        return UploadedMatrices;
+    }
+
+private:
+    const TArray<Int32>&     MovingIndices;
+    const TArray<FVector3f>& Positions;
+    FModelMatrixUpdate       Update;
+    UInt64                   FrameNumber      = 0;
+    UInt64                   UploadedMatrices = 0;
+};
+
+/**
+ * 刚同步过的在途帧缓冲与 Render 线程副本、Game 线程数组完全一致
+ */
+bool IsFrameBufferInSync(const UInt32 FrameIndex, const UInt64 NumInstances)
+{
+    const auto&                Pool        = FGlobalDynamicRenderResourcePool::GetRef();
+    const FRHIBuffer&          Buffer      = Pool.GetModelMatrixBuffer(FrameIndex);
+    const TArray<FMatrix4x4f>& GameArray   = Pool.GetModelMatrices();
+    const TArray<FMatrix4x4f>& RenderArray = Pool.GetRenderModelMatrices();
+    if (!Buffer.IsMapped() || RenderArray.Size() != GameArray.Size())
+    {
+        return false;
+    }
+    const size_t Bytes = NumInstances * sizeof(FMatrix4x4f);
+    return std::memcmp(Buffer.GetMappedPtr(), GameArray.Data(), Bytes) == 0 &&
+           std::memcmp(RenderArray.Data(), GameArray.Data(), Bytes) == 0;
+}
+} // namespace
+
+/**
+ * 1M 静态实例 + 100k 运动实例时每帧的模型矩阵上传
+ * 基线为改为脏页上传之前的做法：快照复制整个数组，再把整个快照写入所有在途帧共用的缓冲
+ */
+HK_BENCHMARK(ModelMatrixUpload)
+{
+    const UInt64              NumStatic    = Context.Scale(1000000);
+    const UInt64              NumMoving    = Context.Scale(100000);
+    const UInt64              NumInstances = NumStatic + NumMoving;
+    FScopedBenchmarkDirectory Directory("ModelMatrixUpload");
+
+    FConfigManager::GetRef().GetConfig<FRHIConfig>()->SetGfxBackend(EGfxBackend::Null);
+    CreateGfxDevice();
+    auto& Pool = FGlobalDynamicRenderResourcePool::GetRef();
+
+    // 注册全部实例，不计时
+    std::mt19937      Random(5);
+    TArray<FVector3f> Positions;
+    Positions.Resize(NumInstances);
+    for (UInt64 Index = 0; Index < NumInstances; ++Index)
+    {
+        const Int32 MatrixIndex = Pool.AddRendererIndexMap(MakeFakeRenderer(Index));
+        Context.Check(MatrixIndex == static_cast<Int32>(Index), "Model matrix indices are not dense");
+        Positions[Index] = BenchmarkScene::RandomPoint(Random, 1000.0f);
+        Pool.UpdateModelMatrix(MakeModelMatrix(Positions[Index]), MatrixIndex);
+    }
+
+    // 运动实例连续分配（同一批生成）与随机分散两种布局，后者几乎每个脏页都只有少数矩阵变化
+    TArray<Int32> GroupedIndices;
+    GroupedIndices.Resize(NumMoving);
+    std::iota(GroupedIndices.begin(), GroupedIndices.end(), static_cast<Int32>(NumStatic));
+    TArray<Int32> ScatteredIndices;
+    ScatteredIndices.Resize(NumInstances);
+    std::iota(ScatteredIndices.begin(), ScatteredIndices.end(), 0);
+    std::shuffle(ScatteredIndices.begin(), ScatteredIndices.end(), Random);
+    ScatteredIndices.Resize(NumMoving);
+    std::sort(ScatteredIndices.begin(), ScatteredIndices.end());
+
+    const std::string Prefix = std::format("{} static + {} moving: ", NumStatic, NumMoving);
+
+    // 1. 首次上传与静止帧：每个在途帧缓冲各完整写入一次，之后没有变化的帧不复制任何矩阵
+    {
+        TArray<Int32>           NoMoving;
+        FModelMatrixFrameDriver Driver(NoMoving, Positions);
+        for (UInt32 Frame = 0; Frame < HK_RENDER_MAX_FRAME_IN_FLIGHT; ++Frame)
+        {
+            Driver.RunFrame();
+            Context.Check(IsFrameBufferInSync(Driver.GetFrameIndex(), NumInstances), "Initial upload is incomplete");
+        }
+        Context.Measure(Prefix + "frame without changes", FramesPerMeasure, [&] {
+            for (UInt32 Frame = 0; Frame < FramesPerMeasure; ++Frame)
+            {
+                Driver.RunFrame();
+            }
+        });
+        Context.Check(Driver.GetLastUpdate().Ranges.IsEmpty(), "A static frame produced a model matrix update");
+    }
+
+    // 2. 脏页上传，两种运动实例布局
+    const auto RunScenario = [&](const char* Name, const TArray<Int32>& MovingIndices) {
+        FModelMatrixFrameDriver Driver(MovingIndices, Positions);
+        for (UInt32 Frame = 0; Frame < HK_RENDER_MAX_FRAME_IN_FLIGHT; ++Frame)
+        {
+            Driver.RunFrame();
+        }
+        const UInt64 FirstFrame    = Driver.GetFrameNumber();
+        const UInt64 FirstUploaded = Driver.GetUploadedMatrices();
+        Context.Measure(Prefix + std::format("dirty page upload, {} moving", Name), FramesPerMeasure, [&] {
+            for (UInt32 Frame = 0; Frame < FramesPerMeasure; ++Frame)
+            {
+                Driver.RunFrame();
+            }
+        });
+        const double Frames = static_cast<double>(Driver.GetFrameNumber() - FirstFrame);
+        const double Bytes  = static_cast<double>(Driver.GetUploadedMatrices() - FirstUploaded) * sizeof(FMatrix4x4f);
+        Context.ReportValue(Prefix + std::format("snapshot size, {} moving", Name), Bytes / Frames / 1048576.0,
+                            "MB/frame");
+        Context.Check(IsFrameBufferInSync(Driver.GetFrameIndex(), NumInstances),
+                      "Frame buffer differs from the game thread model matrices");
+    };
+    RunScenario("grouped", GroupedIndices);
+    RunScenario("scattered", ScatteredIndices);
+
+    // 3. 基线：每帧两次完整复制
+    {
+        TArray<FMatrix4x4f> GameArray = Pool.GetModelMatrices();
+        TArray<FMatrix4x4f> Snapshot;
+        FRHIBufferDesc      BufferDesc{};
+        BufferDesc.Usage          = ERHIBufferUsage::StorageBuffer;
+        BufferDesc.Size           = GameArray.Size() * sizeof(FMatrix4x4f);
+        BufferDesc.MemoryProperty = ERHIBufferMemoryProperty::HostVisible | ERHIBufferMemoryProperty::HostCoherent;
+        BufferDesc.DebugName      = FString("BaselineModelMatrixBuffer");
+        FRHIBuffer Buffer         = GetGfxDeviceRef().CreateBuffer(BufferDesc);
+        void*      MappedPtr      = Buffer.Map();
+
+        UInt64 FrameNumber = 0;
+        Context.Measure(Prefix + "full copy baseline, grouped moving", FramesPerMeasure, [&] {
+            for (UInt32 Frame = 0; Frame < FramesPerMeasure; ++Frame)
+            {
+                const FVector3f Offset(0.0f, 0.01f * static_cast<float>(++FrameNumber), 0.0f);
+                for (const Int32 Index : GroupedIndices)
+                {
+                    GameArray[Index] = MakeModelMatrix(Positions[Index] + Offset);
+                }
+                Snapshot = GameArray;
+                std::memcpy(MappedPtr, Snapshot.Data(), Snapshot.Size() * sizeof(FMatrix4x4f));
+            }
+        });
+        Context.Check(std::memcmp(MappedPtr, GameArray.Data(), BufferDesc.Size) == 0, "Baseline upload is incomplete");
+        GetGfxDeviceRef().DestroyBuffer(Buffer);
+    }
+
+    FGlobalDynamicRenderResourcePool::Destroy();
+    DestroyGfxDevice();
+    FRHIWindowManager::Destroy();
+    FConfigManager::Destroy();
+    FMemoryBudget::Destroy();
+}
@@ -0,0 +1,129 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "Benchmark.h"
+
+#include "RHI/RHIHandle.h"
+
+#include <algorithm>
+#include <format>
+#include <thread>
+
+namespace
+{
+UInt32 GetBenchmarkThreadCount()
+{
+    return std::clamp<UInt32>(std::thread::hardware_concurrency(), 2, 16);
+}
+
+/**
+ * 在 NumThreads 个线程上同时执行 Func(ThreadIndex)
+ */
+template <typename Func>
+void RunOnThreads(const UInt32 NumThreads, Func&& Body)
+{
+    TArray<std::thread> Threads;
+    Threads.Reserve(NumThreads);
+    for (UInt32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+    {
+        Threads.Add(std::thread([&Body, ThreadIndex] { Body(ThreadIndex); }));
+    }
+    for (std::thread& Thread : Threads)
+    {
+        Thread.join();
+    }
+}
+
+FRHIHandle::FHandleType MakeFakeHandle(const UInt64 Index)
+{
+    return reinterpret_cast<FRHIHandle::FHandleType>(static_cast<uintptr_t>(Index + 1));
+}
+} // namespace
+
+/**
+ * 多线程同时创建、销毁 1M 个句柄，并在同一个池上做小工作集的反复分配释放
+ */
+HK_BENCHMARK(RHIHandlePoolStress)
+{
+    const UInt64 NumHandles = Context.Scale(1000000);
+    const UInt32 NumThreads = GetBenchmarkThreadCount();
+    const UInt64 PerThread  = NumHandles / NumThreads;
+    const UInt64 Total      = PerThread * NumThreads;
+
+    FRHIHandlePool Pool;
+    Pool.SetResourceType(ERHIResourceType::Buffer);
+
+    // 1. 校验：所有线程创建的句柄 Id 互不相同，销毁后旧句柄失效且不能重复释放
+    TArray<FRHIHandle> Handles;
+    Handles.Resize(Total);
+    RunOnThreads(NumThreads, [&](const UInt32 ThreadIndex) {
+        for (UInt64 Index = ThreadIndex * PerThread; Index < (ThreadIndex + 1) * PerThread; ++Index)
+        {
+            Handles[Index] = Pool.Allocate("", MakeFakeHandle(Index));
+        }
+    });
+    Context.Check(Pool.GetLiveCount() == Total, "Live count mismatch after allocation");
+
+    TArray<FRHIHandle::FID> Ids;
+    Ids.Reserve(Total);
+    for (const FRHIHandle& Handle : Handles)
+    {
+        Ids.Add(Handle.Id);
+    }
+    Ids.Sort();
+    Context.Check(std::adjacent_find(Ids.begin(), Ids.end()) == Ids.end(), "Duplicate handle ids");
+
+    RunOnThreads(NumThreads, [&](const UInt32 ThreadIndex) {
+        for (UInt64 Index = ThreadIndex * PerThread; Index < (ThreadIndex + 1) * PerThread; ++Index)
+        {
+            Pool.Free(Handles[Index]);
+        }
+    });
+    Context.Check(Pool.GetLiveCount() == 0, "Live count mismatch after free");
+    Context.Check(!Pool.IsAlive(Handles[0]), "Destroyed handle is still alive");
+    Context.Check(!Pool.Free(Handles[0]), "Double free was not rejected");
+
+    // 2. 每个线程创建 1M / N 个句柄后全部销毁，池已经扩容过，主要测试空闲栈的竞争
+    const std::string Prefix = std::format("{} handles, {} threads: ", Total, NumThreads);
+    Context.Measure(Prefix + "create then destroy", Total * 2, [&] {
+        RunOnThreads(NumThreads, [&](const UInt32 ThreadIndex) {
+            const UInt64 Begin = ThreadIndex * PerThread;
+            const UInt64 End   = Begin + PerThread;
+            for (UInt64 Index = Begin; Index < End; ++Index)
+            {
+                Handles[Index] = Pool.Allocate("", MakeFakeHandle(Index));
+            }
+            for (UInt64 Index = Begin; Index < End; ++Index)
+            {
+                Pool.Free(Handles[Index]);
+            }
+        });
+    });
+
+    // 3. 每个线程保持 64 个存活句柄，反复释放最旧的一个再创建新的
+    constexpr UInt64 WorkingSet = 64;
+    Context.Measure(Prefix + std::format("churn with {} live handles per thread", WorkingSet), Total * 2, [&] {
+        RunOnThreads(NumThreads, [&](const UInt32 ThreadIndex) {
+            FRHIHandle   Live[WorkingSet];
+            const UInt64 Begin = ThreadIndex * PerThread;
+            for (UInt64 Index = 0; Index < PerThread; ++Index)
+            {
+                FRHIHandle& Slot = Live[Index % WorkingSet];
+                if (Slot.IsValid())
+                {
+                    Pool.Free(Slot);
+                }
+                Slot = Pool.Allocate("", MakeFakeHandle(Begin + Index));
+            }
+            for (FRHIHandle& Slot : Live)
+            {
+                if (Slot.IsValid())
+                {
+                    Pool.Free(Slot);
+                }
+            }
+        });
+    });
+    Context.Check(Pool.GetLiveCount() == 0, "Handles leaked during churn");
+}
@@ -0,0 +1,389 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "Benchmark.h"
+
+#include "Core/Reflection/TypeManager.h"
+#include "Core/Serialization/BinaryArchive.h"
+#include "Core/Serialization/MemoryStream.h"
+#include "Core/Serialization/SchemaArchive.h"
+#include "Core/String/String.h"
+#include "Math/Vector.h"
+
+#include <algorithm>
+#include <format>
+#include <random>
+
+namespace
+{
+constexpr UInt32 VerticesPerRecord = 64;
+constexpr UInt32 IndicesPerRecord  = 96;
+constexpr UInt32 TagsPerRecord     = 4;
+
+/**
+ * 所有字段都平凡可序列化的 HSTRUCT, TArray 中整块写入
+ */
+struct FSchemaBenchmarkVertex
+{
+    static FType GetType()
+    {
+        return TypeOf<FSchemaBenchmarkVertex>();
+    }
+
+    template <typename Archive>
+    void Serialize(Archive& Ar)
+    {
+        Ar(MakeNamedPair("Position", Position), MakeNamedPair("Normal", Normal), MakeNamedPair("UV", UV));
+    }
+
+    bool operator==(const FSchemaBenchmarkVertex&) const = default;
+
+    FVector3f Position;
+    FVector3f Normal;
+    FVector2f UV;
+};
+
+/**
+ * 之后版本的顶点：删除 Normal，新增 Color，布局与保存时不同
+ */
+struct FSchemaBenchmarkVertexV2
+{
+    static FType GetType()
+    {
+        return TypeOf<FSchemaBenchmarkVertexV2>();
+    }
+
+    template <typename Archive>
+    void Serialize(Archive& Ar)
+    {
+        Ar(MakeNamedPair("Position", Position), MakeNamedPair("UV", UV), MakeNamedPair("Color", Color));
+    }
+
+    FVector3f Position;
+    FVector2f UV;
+    UInt32    Color = 0xFFFFFFFF;
+};
+
+struct FSchemaBenchmarkRecord
+{
+    static FType GetType()
+    {
+        return TypeOf<FSchemaBenchmarkRecord>();
+    }
+
+    template <typename Archive>
+    void Serialize(Archive& Ar)
+    {
+        Ar(MakeNamedPair("Name", Name), MakeNamedPair("Id", Id), MakeNamedPair("Scale", Scale),
+           MakeNamedPair("Flags", Flags), MakeNamedPair("Tags", Tags), MakeNamedPair("Vertices", Vertices),
+           MakeNamedPair("Indices", Indices));
+    }
+
+    FString                        Name;
+    UInt64                         Id    = 0;
+    float                          Scale = 1.0f;
+    UInt32                         Flags = 0;
+    TArray<FString>                Tags;
+    TArray<FSchemaBenchmarkVertex> Vertices;
+    TArray<UInt32>                 Indices;
+};
+
+/**
+ * 之后版本的记录：Scale 改为 double，删除 Flags，新增 Priority，顶点换为 FSchemaBenchmarkVertexV2
+ */
+struct FSchemaBenchmarkRecordV2
+{
+    static FType GetType()
+    {
+        return TypeOf<FSchemaBenchmarkRecordV2>();
+    }
+
+    template <typename Archive>
+    void Serialize(Archive& Ar)
+    {
+        Ar(MakeNamedPair("Name", Name), MakeNamedPair("Id", Id), MakeNamedPair("Scale", Scale),
+           MakeNamedPair("Priority", Priority), MakeNamedPair("Tags", Tags), MakeNamedPair("Vertices", Vertices),
+           MakeNamedPair("Indices", Indices));
+    }
+
+    FString                          Name;
+    UInt64                           Id       = 0;
+    double                           Scale    = 1.0;
+    Int32                            Priority = 7;
+    TArray<FString>                  Tags;
+    TArray<FSchemaBenchmarkVertexV2> Vertices;
+    TArray<UInt32>                   Indices;
+};
+
+void Register_FSchemaBenchmarkVertex_Impl()
+{
+    FTypeMutable Type = FTypeManager::Register<FSchemaBenchmarkVertex>("SchemaBenchmarkVertex");
+    Type->RegisterProperty(&FSchemaBenchmarkVertex::Position, "Position");
+    Type->RegisterProperty(&FSchemaBenchmarkVertex::Normal, "Normal");
+    Type->RegisterProperty(&FSchemaBenchmarkVertex::UV, "UV");
+}
+
+void Register_FSchemaBenchmarkVertexV2_Impl()
+{
+    FTypeMutable Type = FTypeManager::Register<FSchemaBenchmarkVertexV2>("SchemaBenchmarkVertexV2");
+    Type->RegisterProperty(&FSchemaBenchmarkVertexV2::Position, "Position");
+    Type->RegisterProperty(&FSchemaBenchmarkVertexV2::UV, "UV");
+    Type->RegisterProperty(&FSchemaBenchmarkVertexV2::Color, "Color");
+}
+
+void Register_FSchemaBenchmarkRecord_Impl()
+{
+    FTypeMutable Type = FTypeManager::Register<FSchemaBenchmarkRecord>("SchemaBenchmarkRecord");
+    Type->RegisterProperty(&FSchemaBenchmarkRecord::Name, "Name");
+    Type->RegisterProperty(&FSchemaBenchmarkRecord::Id, "Id");
+    Type->RegisterProperty(&FSchemaBenchmarkRecord::Scale, "Scale");
+    Type->RegisterProperty(&FSchemaBenchmarkRecord::Flags, "Flags");
+    Type->RegisterProperty(&FSchemaBenchmarkRecord::Tags, "Tags");
+    Type->RegisterProperty(&FSchemaBenchmarkRecord::Vertices, "Vertices");
+    Type->RegisterProperty(&FSchemaBenchmarkRecord::Indices, "Indices");
+}
+
+void Register_FSchemaBenchmarkRecordV2_Impl()
+{
+    FTypeMutable Type = FTypeManager::Register<FSchemaBenchmarkRecordV2>("SchemaBenchmarkRecordV2");
+    Type->RegisterProperty(&FSchemaBenchmarkRecordV2::Name, "Name");
+    Type->RegisterProperty(&FSchemaBenchmarkRecordV2::Id, "Id");
+    Type->RegisterProperty(&FSchemaBenchmarkRecordV2::Scale, "Scale");
+    Type->RegisterProperty(&FSchemaBenchmarkRecordV2::Priority, "Priority");
+    Type->RegisterProperty(&FSchemaBenchmarkRecordV2::Tags, "Tags");
+    Type->RegisterProperty(&FSchemaBenchmarkRecordV2::Vertices, "Vertices");
+    Type->RegisterProperty(&FSchemaBenchmarkRecordV2::Indices, "Indices");
+}
+
+void RegisterSchemaBenchmarkTypes()
+{
+    FTypeManager::RegisterTypeRegisterer<FSchemaBenchmarkVertex>(Register_FSchemaBenchmarkVertex_Impl);
+    FTypeManager::RegisterTypeRegisterer<FSchemaBenchmarkVertexV2>(Register_FSchemaBenchmarkVertexV2_Impl);
+    FTypeManager::RegisterTypeRegisterer<FSchemaBenchmarkRecord>(Register_FSchemaBenchmarkRecord_Impl);
+    FTypeManager::RegisterTypeRegisterer<FSchemaBenchmarkRecordV2>(Register_FSchemaBenchmarkRecordV2_Impl);
+}
+
+FSchemaBenchmarkVertex MakeVertex(std::mt19937& Random)
+{
+    std::uniform_real_distribution<float> Distribution(-100.0f, 100.0f);
+    FSchemaBenchmarkVertex                Vertex;
+    Vertex.Position = FVector3f(Distribution(Random), Distribution(Random), Distribution(Random));
+    Vertex.Normal   = FVector3f(0.0f, 1.0f, 0.0f);
+    Vertex.UV       = FVector2f(Distribution(Random), Distribution(Random));
+    return Vertex;
+}
+
+TArray<FSchemaBenchmarkRecord> MakeRecords(std::mt19937& Random, const UInt64 NumRecords)
+{
+    TArray<FSchemaBenchmarkRecord> Records;
+    Records.Resize(NumRecords);
+    for (UInt64 Index = 0; Index < NumRecords; ++Index)
+    {
+        FSchemaBenchmarkRecord& Record = Records[Index];
+        Record.Name  = FString(std::format("Assets/Meshes/{:03}/Mesh_{}", Index % 512, Index));
+        Record.Id    = Index * 2654435761u;
+        Record.Scale = 0.5f + static_cast<float>(Index % 8);
+        Record.Flags = static_cast<UInt32>(Index) & 0xFF;
+        for (UInt32 Tag = 0; Tag < TagsPerRecord; ++Tag)
+        {
+            Record.Tags.Add(FString(std::format("Tag{}", (Index + Tag) % 32)));
+        }
+        for (UInt32 Vertex = 0; Vertex < VerticesPerRecord; ++Vertex)
+        {
+            Record.Vertices.Add(MakeVertex(Random));
+        }
+        for (UInt32 Element = 0; Element < IndicesPerRecord; ++Element)
+        {
+            Record.Indices.Add(static_cast<UInt32>(Random() % VerticesPerRecord));
+        }
+    }
+    return Records;
+}
+
+bool IsSameRecord(const FSchemaBenchmarkRecord& A, const FSchemaBenchmarkRecord& B)
+{
+    return A.Name == B.Name && A.Id == B.Id && A.Scale == B.Scale && A.Flags == B.Flags &&
+           std::ranges::equal(A.Tags, B.Tags) && std::ranges::equal(A.Vertices, B.Vertices) &&
+           std::ranges::equal(A.Indices, B.Indices);
+}
+
+bool IsSameRecords(const TArray<FSchemaBenchmarkRecord>& A, const TArray<FSchemaBenchmarkRecord>& B)
+{
+    return std::ranges::equal(A, B, IsSameRecord);
+}
+
+bool IsUpgradedVertex(const FSchemaBenchmarkVertex& Saved, const FSchemaBenchmarkVertexV2& Loaded)
+{
+    return Loaded.Position == Saved.Position && Loaded.UV == Saved.UV && Loaded.Color == 0xFFFFFFFF;
+}
+
+/**
+ * 旧版本的数据读入新版本：同名同类型的字段保留，类型变化的字段与新增字段保持默认值
+ */
+bool IsUpgradedRecord(const FSchemaBenchmarkRecord& Saved, const FSchemaBenchmarkRecordV2& Loaded)
+{
+    return Loaded.Name == Saved.Name && Loaded.Id == Saved.Id && Loaded.Scale == 1.0 && Loaded.Priority == 7 &&
+           std::ranges::equal(Loaded.Tags, Saved.Tags) && std::ranges::equal(Loaded.Indices, Saved.Indices) &&
+           std::ranges::equal(Saved.Vertices, Loaded.Vertices, IsUpgradedVertex);
+}
+
+template <typename T>
+void SaveSchema(TArray<UInt8>& Buffer, const T& Value)
+{
+    Buffer.Clear();
+    // Archive 析构时才写入 Schema 表
+    FSchemaOutputArchive Archive(Buffer);
+    Archive(Value);
+}
+
+template <typename T>
+void LoadSchema(const TArray<UInt8>& Buffer, T& Value)
+{
+    FSchemaInputArchive Archive(Buffer.Data(), Buffer.Size());
+    Archive(Value);
+}
+
+template <typename T>
+void SaveBinary(TArray<UInt8>& Buffer, const T& Value)
+{
+    Buffer.Clear();
+    FMemoryOutputStream  Stream(Buffer);
+    FBinaryOutputArchive Archive(Stream);
+    Archive(Value);
+}
+
+template <typename T>
+void LoadBinary(const TArray<UInt8>& Buffer, T& Value)
+{
+    FMemoryInputStream  Stream(Buffer.Data(), Buffer.Size());
+    FBinaryInputArchive Archive(Stream);
+    Archive(Value);
+}
+
+void ReportSize(FBenchmarkContext& Context, const std::string& Label, const TArray<UInt8>& Buffer)
+{
+    Context.ReportValue(Label, static_cast<double>(Buffer.Size()) / 1048576.0, "MB");
+}
+
+/**
+ * 字段增删、类型变化与数组布局变化后读取旧数据，以及不拷贝地访问数组
+ */
+void CheckSchemaEvolution(FBenchmarkContext& Context, const TArray<FSchemaBenchmarkRecord>& Records)
+{
+    TArray<UInt8> Buffer;
+    SaveSchema(Buffer, Records);
+
+    TArray<FSchemaBenchmarkRecordV2> Upgraded;
+    LoadSchema(Buffer, Upgraded);
+    Context.Check(std::ranges::equal(Records, Upgraded, IsUpgradedRecord),
+                  "Schema archive did not upgrade old records");
+
+    const FSchemaBenchmarkRecord& Record = Records[0];
+    {
+        TSpan<const UInt32>                 Indices;
+        TSpan<const FSchemaBenchmarkVertex> Vertices;
+        SaveSchema(Buffer, Record.Indices);
+        FSchemaInputArchive IndexArchive(Buffer.Data(), Buffer.Size());
+        Context.Check(IndexArchive.TryLoadArrayView(Indices) && std::ranges::equal(Indices, Record.Indices),
+                      "TryLoadArrayView did not return the saved integers");
+
+        SaveSchema(Buffer, Record.Vertices);
+        FSchemaInputArchive VertexArchive(Buffer.Data(), Buffer.Size());
+        Context.Check(VertexArchive.TryLoadArrayView(Vertices) && std::ranges::equal(Vertices, Record.Vertices),
+                      "TryLoadArrayView did not return the saved vertices");
+    }
+    {
+        // 布局不同时不返回视图，也不消耗数据，之后仍可以按字段名读入 TArray
+        TSpan<const FSchemaBenchmarkVertexV2> View;
+        TArray<FSchemaBenchmarkVertexV2>      Vertices;
+        FSchemaInputArchive                   Archive(Buffer.Data(), Buffer.Size());
+        Context.Check(!Archive.TryLoadArrayView(View), "TryLoadArrayView ignored a layout change");
+        Archive(Vertices);
+        Context.Check(std::ranges::equal(Record.Vertices, Vertices, IsUpgradedVertex),
+                      "Schema archive did not remap a changed array layout");
+    }
+    {
+        // 元素类型变化的数组被跳过并保持为空
+        TArray<float> Floats;
+        SaveSchema(Buffer, Record.Indices);
+        LoadSchema(Buffer, Floats);
+        Context.Check(Floats.IsEmpty(), "Schema archive reinterpreted an array of another element type");
+    }
+}
+
+/**
+ * 以 FBinaryArchive 为基准，比较 Save 与 Load 的耗时以及数据大小
+ */
+template <typename T, typename Func>
+void CompareThroughput(FBenchmarkContext& Context, const std::string& Prefix, const T& Value, const UInt64 Operations,
+                       Func&& IsSame)
+{
+    TArray<UInt8> SchemaBuffer;
+    TArray<UInt8> BinaryBuffer;
+    Context.Measure(Prefix + "save: schema archive", Operations, [&] { SaveSchema(SchemaBuffer, Value); });
+    Context.Measure(Prefix + "save: binary archive", Operations, [&] { SaveBinary(BinaryBuffer, Value); });
+    ReportSize(Context, Prefix + "size: schema archive", SchemaBuffer);
+    ReportSize(Context, Prefix + "size: binary archive", BinaryBuffer);
+
+    T SchemaLoaded;
+    T BinaryLoaded;
+    Context.Measure(Prefix + "load: schema archive", Operations, [&] { LoadSchema(SchemaBuffer, SchemaLoaded); });
+    Context.Measure(Prefix + "load: binary archive", Operations, [&] { LoadBinary(BinaryBuffer, BinaryLoaded); });
+    Context.Check(IsSame(Value, SchemaLoaded), "Schema archive round trip changed the data");
+    Context.Check(IsSame(Value, BinaryLoaded), "Binary archive round trip changed the data");
+}
+
+template <typename T>
+bool IsSameArray(const TArray<T>& A, const TArray<T>& B)
+{
+    return std::ranges::equal(A, B);
+}
+} // namespace
+
+/**
+ * FSchemaOutputArchive / FSchemaInputArchive 与 cereal 二进制 Archive（FBinaryArchive）的吞吐量对比
+ * 反射对象（字符串、平凡字段与 HSTRUCT 数组混合）与大数组，并检查字段增删、类型变化后旧数据的读取
+ */
+HK_BENCHMARK(SchemaArchive)
+{
+    RegisterSchemaBenchmarkTypes();
+    std::mt19937 Random(29);
+
+    const UInt64                         NumRecords = Context.Scale(20000);
+    const TArray<FSchemaBenchmarkRecord> Records    = MakeRecords(Random, NumRecords);
+    CheckSchemaEvolution(Context, Records);
+    CompareThroughput(Context, std::format("{} reflected records, ", NumRecords), Records, NumRecords,
+                      IsSameRecords);
+
+    // 大数组：Schema Archive 整块拷贝，cereal 对 HSTRUCT 逐个元素序列化
+    const UInt64                   NumVertices = Context.Scale(1000000);
+    TArray<FSchemaBenchmarkVertex> Vertices;
+    TArray<UInt32>                 Indices;
+    Vertices.Reserve(NumVertices);
+    Indices.Reserve(NumVertices * 3);
+    for (UInt64 Index = 0; Index < NumVertices; ++Index)
+    {
+        Vertices.Add(MakeVertex(Random));
+        for (UInt32 Corner = 0; Corner < 3; ++Corner)
+        {
+            Indices.Add(static_cast<UInt32>(Random() % NumVertices));
+        }
+    }
+    const std::string VertexPrefix = std::format("{} HSTRUCT vertices, ", NumVertices);
+    const std::string IndexPrefix  = std::format("{} integers, ", Indices.Size());
+    CompareThroughput(Context, VertexPrefix, Vertices, NumVertices, IsSameArray<FSchemaBenchmarkVertex>);
+    CompareThroughput(Context, IndexPrefix, Indices, Indices.Size(), IsSameArray<UInt32>);
+
+    // 直接从内存访问，不拷贝
+    TArray<UInt8> Buffer;
+    SaveSchema(Buffer, Vertices);
+    bool bViewed = false;
+    Context.Measure(VertexPrefix + "view: schema archive TryLoadArrayView", NumVertices, [&] {
+        TSpan<const FSchemaBenchmarkVertex> View;
+        FSchemaInputArchive                 Archive(Buffer.Data(), Buffer.Size());
+        bViewed = Archive.TryLoadArrayView(View) && View.Size() == NumVertices;
+        FBenchmarkContext::DoNotOptimize(View);
+    });
+    Context.Check(bViewed, "TryLoadArrayView did not return the saved vertices");
+}
@@ -13,4 +13,8 @@ class HK_API FEngineConfig : public IConfig
 
     HPROPERTY(DefaultProperty)
     Int32 DefaultObjectIncreaseCount = 1024;
+
+    // 资产根目录, 启动时资产注册表会与其中的 .meta 文件同步
+    HPROPERTY(DefaultProperty)
+    FString AssetDirectory = "Assets";
 };
@@ -1,17 +1,25 @@
 #pragma once
 
 #include "Core/Container/Span.h"
+#include "Core/Memory/Allocator.h"
 #include "Core/Serialization/Serialization.h"
 #include "Core/Utility/Macros.h"
 #include "cereal/types/vector.hpp"
 
 #include <algorithm>
 #include <initializer_list>
+#include <type_traits>
 #include <vector>
 
-template <typename T>
+/**
+ * 动态数组
+ * @tparam AllocatorPolicy 内存分配策略, 见 CAllocatorPolicy; 默认策略下与 std::vector<T> 完全一致
+ */
+template <typename T, CAllocatorPolicy AllocatorPolicy = FHeapAllocatorPolicy>
 class TArray
 {
+    using StorageType = std::vector<T, TStdAllocatorFor<T, AllocatorPolicy>>;
+
 public:
     using ElementType = T;
     using ValueType = T;
@@ -22,8 +30,8 @@ public:
     using ConstPointer = const T*;
     using Reference = T&;
     using ConstReference = const T&;
-    using Iterator = typename std::vector<T>::iterator;
-    using ConstIterator = typename std::vector<T>::const_iterator;
+    using Iterator = typename StorageType::iterator;
+    using ConstIterator = typename StorageType::const_iterator;
     using ReverseIterator = std::reverse_iterator<Iterator>;
     using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
 
@@ -133,6 +141,19 @@ public:
     {
         return MyData.data();
     }
+    // 供 std::data / std::size 使用, 使 TSpan 可以直接从 TArray 构造
+    Pointer data() noexcept
+    {
+        return MyData.data();
+    }
+    ConstPointer data() const noexcept
+    {
+        return MyData.data();
+    }
+    SizeType size() const noexcept
+    {
+        return MyData.size();
+    }
 
     SizeType Size() const noexcept
     {
@@ -191,7 +212,7 @@ public:
     {
         MyData.emplace_back(std::forward<Args>(Args_)...);
     }
-    void Append(const TArray<T>& Other)
+    void Append(const TArray& Other)
     {
         MyData.insert(MyData.end(), Other.begin(), Other.end());
     }
@@ -317,9 +338,28 @@ public:
     template <typename Archive>
     void Serialize(Archive& Ar)
     {
-        Ar(MyData);
+        // std::vector<bool> 没有连续存储
+        if constexpr (CBlockArrayArchive<Archive> && !std::is_same_v<T, bool>)
+        {
+            if constexpr (Archive::is_loading::value)
+            {
+                Ar.template LoadArray<T>([this](const SizeType Count) {
+                    MyData.clear();
+                    MyData.resize(Count);
+                    return MyData.data();
+                });
+            }
+            else
+            {
+                Ar.SaveArray(MyData.data(), MyData.size());
+            }
+        }
+        else
+        {
+            Ar(MyData);
+        }
     }
 
 private:
-    std::vector<T> MyData;
+    StorageType MyData;
 };
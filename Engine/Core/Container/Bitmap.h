@@ -5,82 +5,264 @@
 #include "cereal/types/vector.hpp"
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstdint>
 #include <vector>
 
-// 固定大小的位图
-template <size_t Size>
-class TBitmap
+#if HK_SIMD_AVX2
+#include <immintrin.h>
+#endif
+
+namespace HKBitmapImpl
 {
-public:
-    using SizeType       = size_t;
-    using DifferenceType = ptrdiff_t;
+using FWord = UInt64;
 
-    // 位引用代理类，用于支持 operator[] 返回可修改的引用
-    class BitReference
-    {
-    public:
-        BitReference(UInt8* BytePtr, const UInt8 BitMask) : MyBytePtr(BytePtr), MyBitMask(BitMask) {}
+inline constexpr size_t WordBits = 64;
+inline constexpr FWord  AllOnes  = ~FWord(0);
+inline constexpr size_t NotFound = static_cast<size_t>(-1);
+
+constexpr size_t WordCount(const size_t BitCount) noexcept
+{
+    return (BitCount + WordBits - 1) / WordBits;
+}
 
-        BitReference& operator=(const bool Value)
+// 最后一个字中有效位的掩码
+constexpr FWord LastWordMask(const size_t BitCount) noexcept
+{
+    const size_t Remain = BitCount % WordBits;
+    return Remain == 0 ? AllOnes : (FWord(1) << Remain) - 1;
+}
+
+enum class EBitOp
+{
+    And,
+    Or,
+    Xor,
+    AndNot, // Dst & ~Src
+};
+
+/**
+ * 逐字执行 Dst = Dst Op Src, 开启 AVX2 时每次处理 4 个字
+ */
+template <EBitOp Op>
+void ApplyWords(FWord* Dst, const FWord* Src, const size_t Count) noexcept
+{
+    size_t Index = 0;
+#if HK_SIMD_AVX2
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        const __m256i A = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Dst + Index));
+        const __m256i B = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Src + Index));
+        __m256i       R;
+        if constexpr (Op == EBitOp::And)
         {
-            if (Value)
-            {
-                *MyBytePtr |= MyBitMask;
-            }
-            else
-            {
-                *MyBytePtr &= ~MyBitMask;
-            }
-            return *this;
+            R = _mm256_and_si256(A, B);
         }
-
-        BitReference& operator=(const BitReference& Other)
+        else if constexpr (Op == EBitOp::Or)
         {
-            return *this = static_cast<bool>(Other);
+            R = _mm256_or_si256(A, B);
         }
-
-        operator bool() const
+        else if constexpr (Op == EBitOp::Xor)
         {
-            return (*MyBytePtr & MyBitMask) != 0;
+            R = _mm256_xor_si256(A, B);
         }
-
-        bool operator~() const
+        else
         {
-            return (*MyBytePtr & MyBitMask) == 0;
+            R = _mm256_andnot_si256(B, A);
         }
-
-        BitReference& Flip()
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(Dst + Index), R);
+    }
+#endif
+    for (; Index < Count; ++Index)
+    {
+        if constexpr (Op == EBitOp::And)
         {
-            *MyBytePtr ^= MyBitMask;
-            return *this;
+            Dst[Index] &= Src[Index];
         }
+        else if constexpr (Op == EBitOp::Or)
+        {
+            Dst[Index] |= Src[Index];
+        }
+        else if constexpr (Op == EBitOp::Xor)
+        {
+            Dst[Index] ^= Src[Index];
+        }
+        else
+        {
+            Dst[Index] &= ~Src[Index];
+        }
+    }
+}
 
-    private:
-        UInt8* MyBytePtr;
-        UInt8  MyBitMask;
-    };
+// 硬件 popcnt 每个字一条指令, 位图规模下已经足够快
+inline size_t CountWords(const FWord* Words, const size_t Count) noexcept
+{
+    size_t Result = 0;
+    for (size_t Index = 0; Index < Count; ++Index)
+    {
+        Result += static_cast<size_t>(std::popcount(Words[Index]));
+    }
+    return Result;
+}
+
+/**
+ * 从 From 位开始查找第一个置位（Invert 为全 1 时查找第一个清零位）
+ * 开启 AVX2 时先以 4 个字为一组跳过全 0（或全 1）的区间
+ * @return 可能大于等于实际位数（最后一个字的无效位）, 调用方需要检查
+ */
+inline size_t FindNextInWords(const FWord* Words, const size_t Count, const size_t From, const FWord Invert) noexcept
+{
+    size_t WordIndex = From / WordBits;
+    if (WordIndex >= Count)
+    {
+        return NotFound;
+    }
 
-    // 常量位引用
-    class ConstBitReference
+    // 起始字需要屏蔽 From 之前的位
+    const FWord First = (Words[WordIndex] ^ Invert) & (AllOnes << (From % WordBits));
+    if (First != 0)
     {
-    public:
-        ConstBitReference(const UInt8* BytePtr, const UInt8 BitMask) : MyBytePtr(BytePtr), MyBitMask(BitMask) {}
+        return WordIndex * WordBits + std::countr_zero(First);
+    }
+    ++WordIndex;
 
-        operator bool() const
+#if HK_SIMD_AVX2
+    const __m256i InvertVec = _mm256_set1_epi64x(static_cast<long long>(Invert));
+    for (; WordIndex + 4 <= Count; WordIndex += 4)
+    {
+        const __m256i Block =
+            _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(Words + WordIndex)), InvertVec);
+        if (!_mm256_testz_si256(Block, Block))
+        {
+            break;
+        }
+    }
+#endif
+    for (; WordIndex < Count; ++WordIndex)
+    {
+        const FWord Word = Words[WordIndex] ^ Invert;
+        if (Word != 0)
+        {
+            return WordIndex * WordBits + std::countr_zero(Word);
+        }
+    }
+    return NotFound;
+}
+
+/**
+ * 对每个置位调用 Func(BitIndex), 按位序从小到大
+ */
+template <typename FuncType>
+void ForEachSetBitInWords(const FWord* Words, const size_t Count, FuncType&& Func)
+{
+    for (size_t WordIndex = 0; WordIndex < Count; ++WordIndex)
+    {
+        for (FWord Word = Words[WordIndex]; Word != 0; Word &= Word - 1)
         {
-            return (*MyBytePtr & MyBitMask) != 0;
+            Func(WordIndex * WordBits + std::countr_zero(Word));
         }
+    }
+}
+
+// 序列化时按字节存储（小端位序）, 与按字节存储的旧格式一致
+inline void WordsToBytes(const FWord* Words, const size_t ByteCount, UInt8* OutBytes) noexcept
+{
+    for (size_t Index = 0; Index < ByteCount; ++Index)
+    {
+        OutBytes[Index] = static_cast<UInt8>(Words[Index / 8] >> (Index % 8 * 8));
+    }
+}
+
+inline void BytesToWords(const UInt8* Bytes, const size_t ByteCount, FWord* OutWords) noexcept
+{
+    for (size_t Index = 0; Index < ByteCount; ++Index)
+    {
+        OutWords[Index / 8] |= static_cast<FWord>(Bytes[Index]) << (Index % 8 * 8);
+    }
+}
 
-        bool operator~() const
+// 位引用代理类，用于支持 operator[] 返回可修改的引用
+class FBitReference
+{
+public:
+    FBitReference(FWord* WordPtr, const FWord BitMask) : MyWordPtr(WordPtr), MyBitMask(BitMask) {}
+
+    FBitReference& operator=(const bool Value)
+    {
+        if (Value)
         {
-            return (*MyBytePtr & MyBitMask) == 0;
+            *MyWordPtr |= MyBitMask;
         }
+        else
+        {
+            *MyWordPtr &= ~MyBitMask;
+        }
+        return *this;
+    }
+
+    FBitReference& operator=(const FBitReference& Other)
+    {
+        return *this = static_cast<bool>(Other);
+    }
+
+    operator bool() const
+    {
+        return (*MyWordPtr & MyBitMask) != 0;
+    }
+
+    bool operator~() const
+    {
+        return (*MyWordPtr & MyBitMask) == 0;
+    }
+
+    FBitReference& Flip()
+    {
+        *MyWordPtr ^= MyBitMask;
+        return *this;
+    }
+
+private:
+    FWord* MyWordPtr;
+    FWord  MyBitMask;
+};
+
+// 常量位引用
+class FConstBitReference
+{
+public:
+    FConstBitReference(const FWord* WordPtr, const FWord BitMask) : MyWordPtr(WordPtr), MyBitMask(BitMask) {}
+
+    operator bool() const
+    {
+        return (*MyWordPtr & MyBitMask) != 0;
+    }
+
+    bool operator~() const
+    {
+        return (*MyWordPtr & MyBitMask) == 0;
+    }
+
+private:
+    const FWord* MyWordPtr;
+    FWord        MyBitMask;
+};
+} // namespace HKBitmapImpl
+
+// 固定大小的位图, 以 64 位字存储
+template <size_t BitCount>
+class TBitmap
+{
+    using FWord = HKBitmapImpl::FWord;
+
+    static constexpr size_t WordBits = HKBitmapImpl::WordBits;
+
+public:
+    using SizeType          = size_t;
+    using DifferenceType    = ptrdiff_t;
+    using BitReference      = HKBitmapImpl::FBitReference;
+    using ConstBitReference = HKBitmapImpl::FConstBitReference;
 
-    private:
-        const UInt8* MyBytePtr;
-        UInt8        MyBitMask;
-    };
+    static constexpr SizeType NotFound = HKBitmapImpl::NotFound;
 
     TBitmap() : MyData()
     {
@@ -89,7 +271,7 @@ public:
 
     explicit TBitmap(const bool InitialValue) : MyData()
     {
-        std::fill(MyData.begin(), MyData.end(), InitialValue ? 0xFF : 0x00);
+        Fill(InitialValue);
     }
 
     TBitmap(const std::initializer_list<bool> InitList) : MyData()
@@ -109,17 +291,13 @@ public:
     BitReference operator[](const SizeType Index)
     {
         HK_ASSERT_RAW(Index < SizeValue);
-        const SizeType ByteIndex = Index / 8;
-        const UInt8    BitIndex  = static_cast<UInt8>(Index % 8);
-        return BitReference(&MyData[ByteIndex], static_cast<UInt8>(1U << BitIndex));
+        return BitReference(&MyData[Index / WordBits], BitMask(Index));
     }
 
     ConstBitReference operator[](const SizeType Index) const
     {
         HK_ASSERT_RAW(Index < SizeValue);
-        const SizeType ByteIndex = Index / 8;
-        const UInt8    BitIndex  = static_cast<UInt8>(Index % 8);
-        return ConstBitReference(&MyData[ByteIndex], static_cast<UInt8>(1U << BitIndex));
+        return ConstBitReference(&MyData[Index / WordBits], BitMask(Index));
     }
 
     BitReference At(SizeType Index)
@@ -138,48 +316,38 @@ public:
     void Set(const SizeType Index)
     {
         HK_ASSERT_RAW(Index < SizeValue);
-        const SizeType ByteIndex = Index / 8;
-        const UInt8    BitIndex  = static_cast<UInt8>(Index % 8);
-        MyData[ByteIndex] |= static_cast<UInt8>(1U << BitIndex);
+        MyData[Index / WordBits] |= BitMask(Index);
     }
 
     void Set(const SizeType Index, const bool Value)
     {
         HK_ASSERT_RAW(Index < SizeValue);
-        const SizeType ByteIndex = Index / 8;
-        const UInt8    BitIndex  = static_cast<UInt8>(Index % 8);
         if (Value)
         {
-            MyData[ByteIndex] |= static_cast<UInt8>(1U << BitIndex);
+            MyData[Index / WordBits] |= BitMask(Index);
         }
         else
         {
-            MyData[ByteIndex] &= static_cast<UInt8>(~(1U << BitIndex));
+            MyData[Index / WordBits] &= ~BitMask(Index);
         }
     }
 
     void Clear(const SizeType Index)
     {
         HK_ASSERT_RAW(Index < SizeValue);
-        const SizeType ByteIndex = Index / 8;
-        const UInt8    BitIndex  = static_cast<UInt8>(Index % 8);
-        MyData[ByteIndex] &= static_cast<UInt8>(~(1U << BitIndex));
+        MyData[Index / WordBits] &= ~BitMask(Index);
     }
 
     void Flip(const SizeType Index)
     {
         HK_ASSERT_RAW(Index < SizeValue);
-        const SizeType ByteIndex = Index / 8;
-        const UInt8    BitIndex  = static_cast<UInt8>(Index % 8);
-        MyData[ByteIndex] ^= static_cast<UInt8>(1U << BitIndex);
+        MyData[Index / WordBits] ^= BitMask(Index);
     }
 
     bool Test(const SizeType Index) const
     {
         HK_ASSERT_RAW(Index < SizeValue);
-        const SizeType ByteIndex = Index / 8;
-        const UInt8    BitIndex  = static_cast<UInt8>(Index % 8);
-        return (MyData[ByteIndex] & static_cast<UInt8>(1U << BitIndex)) != 0;
+        return (MyData[Index / WordBits] & BitMask(Index)) != 0;
     }
 
     bool Get(const SizeType Index) const
@@ -190,14 +358,7 @@ public:
     // 批量操作
     void SetAll()
     {
-        std::fill(MyData.begin(), MyData.end(), 0xFF);
-        // 清除超出 SizeValue 的位
-        const SizeType LastByteBits = SizeValue % 8;
-        if (LastByteBits > 0)
-        {
-            const UInt8 Mask = static_cast<UInt8>((1U << LastByteBits) - 1);
-            MyData[ByteCount() - 1] &= Mask;
-        }
+        Fill(true);
     }
 
     void ClearAll()
@@ -207,29 +368,63 @@ public:
 
     void FlipAll()
     {
-        for (auto& Byte : MyData)
+        for (auto& Word : MyData)
         {
-            Byte = ~Byte;
-        }
-        // 清除超出 SizeValue 的位
-        const SizeType LastByteBits = SizeValue % 8;
-        if (LastByteBits > 0)
-        {
-            const UInt8 Mask = static_cast<UInt8>((1U << LastByteBits) - 1);
-            MyData[ByteCount() - 1] &= Mask;
+            Word = ~Word;
         }
+        ClearExtraBits();
     }
 
     void Fill(const bool Value)
     {
-        std::fill(MyData.begin(), MyData.end(), Value ? 0xFF : 0x00);
-        // 清除超出 SizeValue 的位
-        const SizeType LastByteBits = SizeValue % 8;
-        if (LastByteBits > 0 && Value)
-        {
-            const UInt8 Mask = static_cast<UInt8>((1U << LastByteBits) - 1);
-            MyData[ByteCount() - 1] &= Mask;
-        }
+        std::fill(MyData.begin(), MyData.end(), Value ? HKBitmapImpl::AllOnes : 0);
+        ClearExtraBits();
+    }
+
+    // 按位运算
+    TBitmap& operator&=(const TBitmap& Other) noexcept
+    {
+        HKBitmapImpl::ApplyWords<HKBitmapImpl::EBitOp::And>(MyData.data(), Other.MyData.data(), WordCount);
+        return *this;
+    }
+
+    TBitmap& operator|=(const TBitmap& Other) noexcept
+    {
+        HKBitmapImpl::ApplyWords<HKBitmapImpl::EBitOp::Or>(MyData.data(), Other.MyData.data(), WordCount);
+        return *this;
+    }
+
+    TBitmap& operator^=(const TBitmap& Other) noexcept
+    {
+        HKBitmapImpl::ApplyWords<HKBitmapImpl::EBitOp::Xor>(MyData.data(), Other.MyData.data(), WordCount);
+        return *this;
+    }
+
+    // 清除 Other 中置位的位
+    TBitmap& AndNot(const TBitmap& Other) noexcept
+    {
+        HKBitmapImpl::ApplyWords<HKBitmapImpl::EBitOp::AndNot>(MyData.data(), Other.MyData.data(), WordCount);
+        return *this;
+    }
+
+    friend TBitmap operator&(TBitmap Lhs, const TBitmap& Rhs) noexcept
+    {
+        return Lhs &= Rhs;
+    }
+
+    friend TBitmap operator|(TBitmap Lhs, const TBitmap& Rhs) noexcept
+    {
+        return Lhs |= Rhs;
+    }
+
+    friend TBitmap operator^(TBitmap Lhs, const TBitmap& Rhs) noexcept
+    {
+        return Lhs ^= Rhs;
+    }
+
+    bool operator==(const TBitmap& Other) const noexcept
+    {
+        return MyData == Other.MyData;
     }
 
     // 查询操作
@@ -255,15 +450,7 @@ public:
 
     SizeType Count() const noexcept
     {
-        SizeType Count = 0;
-        for (SizeType I = 0; I < SizeValue; ++I)
-        {
-            if (Test(I))
-            {
-                ++Count;
-            }
-        }
-        return Count;
+        return HKBitmapImpl::CountWords(MyData.data(), WordCount);
     }
 
     SizeType Count(const bool Value) const noexcept
@@ -273,26 +460,12 @@ public:
 
     bool Any() const noexcept
     {
-        for (const auto& Byte : MyData)
-        {
-            if (Byte != 0)
-            {
-                return true;
-            }
-        }
-        return false;
+        return HKBitmapImpl::FindNextInWords(MyData.data(), WordCount, 0, 0) != NotFound;
     }
 
     bool All() const noexcept
     {
-        for (SizeType I = 0; I < SizeValue; ++I)
-        {
-            if (!Test(I))
-            {
-                return false;
-            }
-        }
-        return true;
+        return FindFirstClear() == NotFound;
     }
 
     bool None() const noexcept
@@ -302,131 +475,112 @@ public:
 
     SizeType FindFirstSet() const noexcept
     {
-        for (SizeType I = 0; I < SizeValue; ++I)
-        {
-            if (Test(I))
-            {
-                return I;
-            }
-        }
-        return static_cast<SizeType>(-1);
+        return FindNextSet(0);
     }
 
     SizeType FindFirstClear() const noexcept
     {
-        for (SizeType I = 0; I < SizeValue; ++I)
-        {
-            if (!Test(I))
-            {
-                return I;
-            }
-        }
-        return static_cast<SizeType>(-1);
+        return FindNextClear(0);
     }
 
-    // 序列化
-    template <typename Archive>
-    void Serialize(Archive& Ar)
+    // 查找 From（含）之后的第一个置位
+    SizeType FindNextSet(const SizeType From) const noexcept
     {
-        Ar(MyData);
+        return HKBitmapImpl::FindNextInWords(MyData.data(), WordCount, From, 0);
     }
 
-private:
-    static constexpr SizeType SizeValue = Size;
-    constexpr SizeType        ByteCount() const noexcept
+    SizeType FindNextClear(const SizeType From) const noexcept
     {
-        return (SizeValue + 7) / 8;
+        const SizeType Index = HKBitmapImpl::FindNextInWords(MyData.data(), WordCount, From, HKBitmapImpl::AllOnes);
+        return Index < SizeValue ? Index : NotFound;
     }
 
-    std::array<UInt8, (SizeValue + 7) / 8> MyData;
-};
+    /**
+     * 按位序遍历所有置位
+     * @param Func 签名为 void(SizeType Index)
+     */
+    template <typename FuncType>
+    void ForEachSetBit(FuncType&& Func) const
+    {
+        HKBitmapImpl::ForEachSetBitInWords(MyData.data(), WordCount, std::forward<FuncType>(Func));
+    }
 
-// 动态大小的位图
-class FDynamicBitmap
-{
-public:
-    using SizeType       = size_t;
-    using DifferenceType = ptrdiff_t;
+    const FWord* GetWords() const noexcept
+    {
+        return MyData.data();
+    }
 
-    // 位引用代理类
-    class BitReference
+    static constexpr SizeType GetWordCount() noexcept
     {
-    public:
-        BitReference(UInt8* BytePtr, const UInt8 BitMask) : MyBytePtr(BytePtr), MyBitMask(BitMask) {}
+        return WordCount;
+    }
 
-        BitReference& operator=(const bool Value)
+    // 序列化, 按字节存储
+    template <typename Archive>
+    void Serialize(Archive& Ar)
+    {
+        std::array<UInt8, ByteCount> Bytes{};
+        if constexpr (Archive::is_loading::value)
         {
-            if (Value)
-            {
-                *MyBytePtr |= MyBitMask;
-            }
-            else
-            {
-                *MyBytePtr &= ~MyBitMask;
-            }
-            return *this;
+            Ar(Bytes);
+            ClearAll();
+            HKBitmapImpl::BytesToWords(Bytes.data(), ByteCount, MyData.data());
+            ClearExtraBits();
         }
-
-        BitReference& operator=(const BitReference& Other)
+        else
         {
-            return *this = static_cast<bool>(Other);
+            HKBitmapImpl::WordsToBytes(MyData.data(), ByteCount, Bytes.data());
+            Ar(Bytes);
         }
+    }
 
-        operator bool() const
-        {
-            return (*MyBytePtr & MyBitMask) != 0;
-        }
+private:
+    static constexpr SizeType SizeValue = BitCount;
+    static constexpr SizeType WordCount = HKBitmapImpl::WordCount(SizeValue);
+    static constexpr SizeType ByteCount = (SizeValue + 7) / 8;
 
-        bool operator~() const
-        {
-            return (*MyBytePtr & MyBitMask) == 0;
-        }
+    static constexpr FWord BitMask(const SizeType Index) noexcept
+    {
+        return FWord(1) << (Index % WordBits);
+    }
 
-        BitReference& Flip()
+    void ClearExtraBits() noexcept
+    {
+        if constexpr (WordCount > 0)
         {
-            *MyBytePtr ^= MyBitMask;
-            return *this;
+            MyData[WordCount - 1] &= HKBitmapImpl::LastWordMask(SizeValue);
         }
+    }
 
-    private:
-        UInt8* MyBytePtr;
-        UInt8  MyBitMask;
-    };
+    std::array<FWord, WordCount> MyData;
+};
 
-    // 常量位引用
-    class ConstBitReference
-    {
-    public:
-        ConstBitReference(const UInt8* BytePtr, const UInt8 BitMask) : MyBytePtr(BytePtr), MyBitMask(BitMask) {}
+// 动态大小的位图, 以 64 位字存储; 按位运算要求两个位图大小相同
+class FDynamicBitmap
+{
+    using FWord = HKBitmapImpl::FWord;
 
-        operator bool() const
-        {
-            return (*MyBytePtr & MyBitMask) != 0;
-        }
+    static constexpr size_t WordBits = HKBitmapImpl::WordBits;
 
-        bool operator~() const
-        {
-            return (*MyBytePtr & MyBitMask) == 0;
-        }
+public:
+    using SizeType          = size_t;
+    using DifferenceType    = ptrdiff_t;
+    using BitReference      = HKBitmapImpl::FBitReference;
+    using ConstBitReference = HKBitmapImpl::FConstBitReference;
 
-    private:
-        const UInt8* MyBytePtr;
-        UInt8        MyBitMask;
-    };
+    static constexpr SizeType NotFound = HKBitmapImpl::NotFound;
 
     FDynamicBitmap() : MySize(0), MyData() {}
 
     explicit FDynamicBitmap(const SizeType InSize, const bool InitialValue = false)
-        : MySize(InSize), MyData(ByteCount(InSize))
+        : MySize(InSize), MyData(HKBitmapImpl::WordCount(InSize), InitialValue ? HKBitmapImpl::AllOnes : 0)
     {
-        std::fill(MyData.begin(), MyData.end(), InitialValue ? 0xFF : 0x00);
         ClearExtraBits();
     }
 
     FDynamicBitmap(const std::initializer_list<bool> InitList)
-        : MySize(InitList.size()), MyData(ByteCount(InitList.size()))
+        : MySize(InitList.size()), MyData(HKBitmapImpl::WordCount(InitList.size()), 0)
     {
-        std::fill(MyData.begin(), MyData.end(), 0);
         SizeType Index = 0;
         for (bool Value : InitList)
         {
@@ -439,17 +593,13 @@ public:
     BitReference operator[](const SizeType Index)
     {
         HK_ASSERT_RAW(Index < MySize);
-        const SizeType ByteIndex = Index / 8;
-        const auto     BitIndex  = static_cast<UInt8>(Index % 8);
-        return {&MyData[ByteIndex], static_cast<UInt8>(1U << BitIndex)};
+        return {&MyData[Index / WordBits], BitMask(Index)};
     }
 
     ConstBitReference operator[](const SizeType Index) const
     {
         HK_ASSERT_RAW(Index < MySize);
-        const SizeType ByteIndex = Index / 8;
-        const auto     BitIndex  = static_cast<UInt8>(Index % 8);
-        return {&MyData[ByteIndex], static_cast<UInt8>(1U << BitIndex)};
+        return {&MyData[Index / WordBits], BitMask(Index)};
     }
 
     BitReference At(const SizeType Index)
@@ -468,48 +618,38 @@ public:
     void Set(const SizeType Index)
     {
         HK_ASSERT_RAW(Index < MySize);
-        const SizeType ByteIndex = Index / 8;
-        const UInt8    BitIndex  = static_cast<UInt8>(Index % 8);
-        MyData[ByteIndex] |= static_cast<UInt8>(1U << BitIndex);
+        MyData[Index / WordBits] |= BitMask(Index);
     }
 
     void Set(const SizeType Index, const bool Value)
     {
         HK_ASSERT_RAW(Index < MySize);
-        const SizeType ByteIndex = Index / 8;
-        const UInt8    BitIndex  = static_cast<UInt8>(Index % 8);
         if (Value)
         {
-            MyData[ByteIndex] |= static_cast<UInt8>(1U << BitIndex);
+            MyData[Index / WordBits] |= BitMask(Index);
         }
         else
         {
-            MyData[ByteIndex] &= static_cast<UInt8>(~(1U << BitIndex));
+            MyData[Index / WordBits] &= ~BitMask(Index);
         }
     }
 
     void Clear(const SizeType Index)
     {
         HK_ASSERT_RAW(Index < MySize);
-        const SizeType ByteIndex = Index / 8;
-        const UInt8    BitIndex  = static_cast<UInt8>(Index % 8);
-        MyData[ByteIndex] &= static_cast<UInt8>(~(1U << BitIndex));
+        MyData[Index / WordBits] &= ~BitMask(Index);
     }
 
     void Flip(const SizeType Index)
     {
         HK_ASSERT_RAW(Index < MySize);
-        const SizeType ByteIndex = Index / 8;
-        const UInt8    BitIndex  = static_cast<UInt8>(Index % 8);
-        MyData[ByteIndex] ^= static_cast<UInt8>(1U << BitIndex);
+        MyData[Index / WordBits] ^= BitMask(Index);
     }
 
     bool Test(const SizeType Index) const
     {
         HK_ASSERT_RAW(Index < MySize);
-        const SizeType ByteIndex = Index / 8;
-        const UInt8    BitIndex  = static_cast<UInt8>(Index % 8);
-        return (MyData[ByteIndex] & static_cast<UInt8>(1U << BitIndex)) != 0;
+        return (MyData[Index / WordBits] & BitMask(Index)) != 0;
     }
 
     bool Get(const SizeType Index) const
@@ -520,35 +660,21 @@ public:
     // 大小管理
     void Resize(const SizeType NewSize, const bool Value = false)
     {
-        const SizeType OldByteCount = ByteCount(MySize);
-        const SizeType NewByteCount = ByteCount(NewSize);
-        MySize                      = NewSize;
+        const SizeType OldSize = MySize;
+        MyData.resize(HKBitmapImpl::WordCount(NewSize), Value ? HKBitmapImpl::AllOnes : 0);
+        MySize = NewSize;
 
-        if (NewByteCount > OldByteCount)
-        {
-            MyData.resize(NewByteCount, Value ? 0xFF : 0x00);
-        }
-        else if (NewByteCount < OldByteCount)
+        // 原来最后一个字中超出旧大小的位一直保持为 0, 增大时需要按 Value 补齐
+        if (Value && NewSize > OldSize && OldSize % WordBits != 0)
         {
-            MyData.resize(NewByteCount);
+            MyData[OldSize / WordBits] |= ~HKBitmapImpl::LastWordMask(OldSize);
         }
-
         ClearExtraBits();
-        if (Value && NewSize > 0)
-        {
-            // 确保新添加的位被设置为 Value
-            const SizeType LastByteBits = NewSize % 8;
-            if (LastByteBits > 0)
-            {
-                const UInt8 Mask = static_cast<UInt8>((1U << LastByteBits) - 1);
-                MyData[NewByteCount - 1] |= Mask;
-            }
-        }
     }
 
     void Reserve(const SizeType Capacity)
     {
-        MyData.reserve(ByteCount(Capacity));
+        MyData.reserve(HKBitmapImpl::WordCount(Capacity));
     }
 
     void ShrinkToFit()
@@ -558,14 +684,13 @@ public:
 
     SizeType Capacity() const noexcept
     {
-        return MyData.capacity() * 8;
+        return MyData.capacity() * WordBits;
     }
 
     // 批量操作
     void SetAll()
     {
-        std::fill(MyData.begin(), MyData.end(), 0xFF);
-        ClearExtraBits();
+        Fill(true);
     }
 
     void ClearAll()
@@ -575,19 +700,69 @@ public:
 
     void FlipAll()
     {
-        for (auto& Byte : MyData)
+        for (auto& Word : MyData)
         {
-            Byte = ~Byte;
+            Word = ~Word;
         }
         ClearExtraBits();
     }
 
     void Fill(const bool Value)
     {
-        std::fill(MyData.begin(), MyData.end(), Value ? 0xFF : 0x00);
+        std::fill(MyData.begin(), MyData.end(), Value ? HKBitmapImpl::AllOnes : 0);
         ClearExtraBits();
     }
 
+    // 按位运算
+    FDynamicBitmap& operator&=(const FDynamicBitmap& Other) noexcept
+    {
+        HK_ASSERT_RAW(MySize == Other.MySize);
+        HKBitmapImpl::ApplyWords<HKBitmapImpl::EBitOp::And>(MyData.data(), Other.MyData.data(), MyData.size());
+        return *this;
+    }
+
+    FDynamicBitmap& operator|=(const FDynamicBitmap& Other) noexcept
+    {
+        HK_ASSERT_RAW(MySize == Other.MySize);
+        HKBitmapImpl::ApplyWords<HKBitmapImpl::EBitOp::Or>(MyData.data(), Other.MyData.data(), MyData.size());
+        return *this;
+    }
+
+    FDynamicBitmap& operator^=(const FDynamicBitmap& Other) noexcept
+    {
+        HK_ASSERT_RAW(MySize == Other.MySize);
+        HKBitmapImpl::ApplyWords<HKBitmapImpl::EBitOp::Xor>(MyData.data(), Other.MyData.data(), MyData.size());
+        return *this;
+    }
+
+    // 清除 Other 中置位的位
+    FDynamicBitmap& AndNot(const FDynamicBitmap& Other) noexcept
+    {
+        HK_ASSERT_RAW(MySize == Other.MySize);
+        HKBitmapImpl::ApplyWords<HKBitmapImpl::EBitOp::AndNot>(MyData.data(), Other.MyData.data(), MyData.size());
+        return *this;
+    }
+
+    friend FDynamicBitmap operator&(FDynamicBitmap Lhs, const FDynamicBitmap& Rhs) noexcept
+    {
+        return Lhs &= Rhs;
+    }
+
+    friend FDynamicBitmap operator|(FDynamicBitmap Lhs, const FDynamicBitmap& Rhs) noexcept
+    {
+        return Lhs |= Rhs;
+    }
+
+    friend FDynamicBitmap operator^(FDynamicBitmap Lhs, const FDynamicBitmap& Rhs) noexcept
+    {
+        return Lhs ^= Rhs;
+    }
+
+    bool operator==(const FDynamicBitmap& Other) const noexcept
+    {
+        return MySize == Other.MySize && MyData == Other.MyData;
+    }
+
     // 查询操作
     SizeType Size() const noexcept
     {
@@ -606,15 +781,7 @@ public:
 
     SizeType Count() const noexcept
     {
-        SizeType Count = 0;
-        for (SizeType I = 0; I < MySize; ++I)
-        {
-            if (Test(I))
-            {
-                ++Count;
-            }
-        }
-        return Count;
+        return HKBitmapImpl::CountWords(MyData.data(), MyData.size());
     }
 
     SizeType Count(const bool Value) const noexcept
@@ -624,84 +791,310 @@ public:
 
     bool Any() const noexcept
     {
-        for (const auto& Byte : MyData)
+        return FindFirstSet() != NotFound;
+    }
+
+    bool All() const noexcept
+    {
+        return FindFirstClear() == NotFound;
+    }
+
+    bool None() const noexcept
+    {
+        return !Any();
+    }
+
+    SizeType FindFirstSet() const noexcept
+    {
+        return FindNextSet(0);
+    }
+
+    SizeType FindFirstClear() const noexcept
+    {
+        return FindNextClear(0);
+    }
+
+    // 查找 From（含）之后的第一个置位
+    SizeType FindNextSet(const SizeType From) const noexcept
+    {
+        return HKBitmapImpl::FindNextInWords(MyData.data(), MyData.size(), From, 0);
+    }
+
+    SizeType FindNextClear(const SizeType From) const noexcept
+    {
+        const SizeType Index =
+            HKBitmapImpl::FindNextInWords(MyData.data(), MyData.size(), From, HKBitmapImpl::AllOnes);
+        return Index < MySize ? Index : NotFound;
+    }
+
+    /**
+     * 按位序遍历所有置位
+     * @param Func 签名为 void(SizeType Index)
+     */
+    template <typename FuncType>
+    void ForEachSetBit(FuncType&& Func) const
+    {
+        HKBitmapImpl::ForEachSetBitInWords(MyData.data(), MyData.size(), std::forward<FuncType>(Func));
+    }
+
+    const FWord* GetWords() const noexcept
+    {
+        return MyData.data();
+    }
+
+    SizeType GetWordCount() const noexcept
+    {
+        return MyData.size();
+    }
+
+    // 序列化, 按字节存储
+    template <typename Archive>
+    void Serialize(Archive& Ar)
+    {
+        std::vector<UInt8> Bytes;
+        if constexpr (Archive::is_loading::value)
         {
-            if (Byte != 0)
+            Ar(MySize);
+            Ar(Bytes);
+            MyData.assign(HKBitmapImpl::WordCount(MySize), 0);
+            HKBitmapImpl::BytesToWords(Bytes.data(), std::min(Bytes.size(), (MySize + 7) / 8), MyData.data());
+            ClearExtraBits();
+        }
+        else
+        {
+            Bytes.resize((MySize + 7) / 8);
+            HKBitmapImpl::WordsToBytes(MyData.data(), Bytes.size(), Bytes.data());
+            Ar(MySize);
+            Ar(Bytes);
+        }
+    }
+
+private:
+    static constexpr FWord BitMask(const SizeType Index) noexcept
+    {
+        return FWord(1) << (Index % WordBits);
+    }
+
+    void ClearExtraBits() noexcept
+    {
+        if (!MyData.empty())
+        {
+            MyData.back() &= HKBitmapImpl::LastWordMask(MySize);
+        }
+    }
+
+    SizeType           MySize;
+    std::vector<FWord> MyData;
+};
+
+/**
+ * 带层级摘要的动态位图
+ * 第 0 层是位本身, 第 k+1 层的每一位表示第 k 层对应的字是否有置位, 最高层只有一个字
+ * 查找下一个置位只需沿层级上行再下行, 复杂度为 O(log64 n); 修改一位最多更新每层一个字
+ * 用作槽位分配器时以置位表示空闲槽位, FindFirstSet 即为第一个空闲槽位
+ */
+class FHierarchicalBitmap
+{
+    using FWord = HKBitmapImpl::FWord;
+
+    static constexpr size_t WordBits = HKBitmapImpl::WordBits;
+
+public:
+    using SizeType = size_t;
+
+    static constexpr SizeType NotFound = HKBitmapImpl::NotFound;
+
+    FHierarchicalBitmap() = default;
+
+    explicit FHierarchicalBitmap(const SizeType InSize, const bool InitialValue = false)
+    {
+        Resize(InSize, InitialValue);
+    }
+
+    void Set(const SizeType Index)
+    {
+        HK_ASSERT_RAW(Index < MySize);
+        SizeType Position = Index;
+        for (auto& Words : MyLevels)
+        {
+            FWord&     Word    = Words[Position / WordBits];
+            const bool bWasSet = Word != 0;
+            Word |= FWord(1) << (Position % WordBits);
+            if (bWasSet)
             {
-                return true;
+                break;
             }
+            // 该字从全 0 变为非 0, 需要在上一层登记
+            Position /= WordBits;
         }
-        return false;
     }
 
-    bool All() const noexcept
+    void Clear(const SizeType Index)
     {
-        for (SizeType I = 0; I < MySize; ++I)
+        HK_ASSERT_RAW(Index < MySize);
+        SizeType Position = Index;
+        for (auto& Words : MyLevels)
         {
-            if (!Test(I))
+            FWord& Word = Words[Position / WordBits];
+            Word &= ~(FWord(1) << (Position % WordBits));
+            if (Word != 0)
             {
-                return false;
+                break;
             }
+            // 该字变为全 0, 需要在上一层清除
+            Position /= WordBits;
         }
-        return true;
     }
 
-    bool None() const noexcept
+    void Set(const SizeType Index, const bool Value)
     {
-        return !Any();
+        if (Value)
+        {
+            Set(Index);
+        }
+        else
+        {
+            Clear(Index);
+        }
     }
 
-    SizeType FindFirstSet() const noexcept
+    bool Test(const SizeType Index) const
     {
-        for (SizeType I = 0; I < MySize; ++I)
+        HK_ASSERT_RAW(Index < MySize);
+        return ((MyLevels[0][Index / WordBits] >> (Index % WordBits)) & 1) != 0;
+    }
+
+    /**
+     * 改变大小, 新增的位设置为 Value, 摘要层会整体重建
+     */
+    void Resize(const SizeType NewSize, const bool Value = false)
+    {
+        std::vector<FWord> Leaf    = MyLevels.empty() ? std::vector<FWord>() : std::move(MyLevels[0]);
+        const SizeType     OldSize = MySize;
+        Leaf.resize(HKBitmapImpl::WordCount(NewSize), Value ? HKBitmapImpl::AllOnes : 0);
+        if (Value && NewSize > OldSize && OldSize % WordBits != 0)
         {
-            if (Test(I))
-            {
-                return I;
-            }
+            Leaf[OldSize / WordBits] |= ~HKBitmapImpl::LastWordMask(OldSize);
         }
-        return static_cast<SizeType>(-1);
+
+        MySize = NewSize;
+        MyLevels.clear();
+        if (NewSize == 0)
+        {
+            return;
+        }
+        Leaf.back() &= HKBitmapImpl::LastWordMask(NewSize);
+        MyLevels.push_back(std::move(Leaf));
+        RebuildSummary();
     }
 
-    SizeType FindFirstClear() const noexcept
+    void Fill(const bool Value)
+    {
+        if (MyLevels.empty())
+        {
+            return;
+        }
+        auto& Leaf = MyLevels[0];
+        std::fill(Leaf.begin(), Leaf.end(), Value ? HKBitmapImpl::AllOnes : 0);
+        Leaf.back() &= HKBitmapImpl::LastWordMask(MySize);
+        RebuildSummary();
+    }
+
+    SizeType FindFirstSet() const noexcept
+    {
+        return FindNextSet(0);
+    }
+
+    // 查找 From（含）之后的第一个置位
+    SizeType FindNextSet(const SizeType From) const noexcept
     {
-        for (SizeType I = 0; I < MySize; ++I)
+        if (From >= MySize)
         {
-            if (!Test(I))
+            return NotFound;
+        }
+
+        // 上行: 在当前层找不到时, 到上一层从下一个字对应的位继续查找
+        SizeType Position = From;
+        SizeType Level    = 0;
+        while (true)
+        {
+            const auto&    Words     = MyLevels[Level];
+            const SizeType WordIndex = Position / WordBits;
+            if (WordIndex >= Words.size())
             {
-                return I;
+                return NotFound;
+            }
+            const FWord Word = Words[WordIndex] & (HKBitmapImpl::AllOnes << (Position % WordBits));
+            if (Word != 0)
+            {
+                Position = WordIndex * WordBits + std::countr_zero(Word);
+                break;
             }
+            if (Level + 1 == MyLevels.size())
+            {
+                return NotFound;
+            }
+            Position = WordIndex + 1;
+            ++Level;
+        }
+
+        // 下行: 每层取对应字的最低置位
+        while (Level > 0)
+        {
+            --Level;
+            Position = Position * WordBits + std::countr_zero(MyLevels[Level][Position]);
         }
-        return static_cast<SizeType>(-1);
+        return Position;
     }
 
-    // 序列化
-    template <typename Archive>
-    void Serialize(Archive& Ar)
+    SizeType Count() const noexcept
     {
-        Ar(MySize);
-        Ar(MyData);
+        return MyLevels.empty() ? 0 : HKBitmapImpl::CountWords(MyLevels[0].data(), MyLevels[0].size());
     }
 
-private:
-    static constexpr SizeType ByteCount(const SizeType BitCount) noexcept
+    bool Any() const noexcept
+    {
+        return !MyLevels.empty() && MyLevels.back()[0] != 0;
+    }
+
+    SizeType Size() const noexcept
+    {
+        return MySize;
+    }
+
+    bool IsEmpty() const noexcept
     {
-        return (BitCount + 7) / 8;
+        return MySize == 0;
     }
 
-    void ClearExtraBits()
+    template <typename FuncType>
+    void ForEachSetBit(FuncType&& Func) const
     {
-        if (MySize > 0)
+        if (!MyLevels.empty())
         {
-            const SizeType LastByteBits = MySize % 8;
-            if (LastByteBits > 0)
+            HKBitmapImpl::ForEachSetBitInWords(MyLevels[0].data(), MyLevels[0].size(), std::forward<FuncType>(Func));
+        }
+    }
+
+private:
+    void RebuildSummary()
+    {
+        MyLevels.resize(1);
+        while (MyLevels.back().size() > 1)
+        {
+            const auto&        Lower = MyLevels.back();
+            std::vector<FWord> Upper(HKBitmapImpl::WordCount(Lower.size()), 0);
+            for (SizeType WordIndex = 0; WordIndex < Lower.size(); ++WordIndex)
             {
-                const UInt8 Mask = static_cast<UInt8>((1U << LastByteBits) - 1);
-                MyData[ByteCount(MySize) - 1] &= Mask;
+                if (Lower[WordIndex] != 0)
+                {
+                    Upper[WordIndex / WordBits] |= FWord(1) << (WordIndex % WordBits);
+                }
             }
+            MyLevels.push_back(std::move(Upper));
         }
     }
 
-    SizeType           MySize;
-    std::vector<UInt8> MyData;
+    SizeType                        MySize = 0;
+    std::vector<std::vector<FWord>> MyLevels; // MyLevels[0] 为位本身, 最后一层只有一个字
 };
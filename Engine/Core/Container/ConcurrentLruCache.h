@@ -0,0 +1,160 @@
+#pragma once
+
+#include "Core/Container/LruCache.h"
+#include "Core/Utility/Macros.h"
+#include <bit>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+
+enum class ELruCacheEviction : UInt8
+{
+    Lru,   // 精确 LRU, 每次命中都要调整链表, 查找需要独占分片
+    Clock, // CLOCK 近似 LRU, 命中只置位访问标记, 查找只需共享锁
+};
+
+/**
+ * 线程安全的固定容量缓存, 按键的哈希分成 ShardCount 个分片, 每个分片一把读写锁
+ * 不同分片上的操作互不阻塞; 淘汰在分片内进行, 所以整体只是近似的 LRU
+ * 查找返回值的拷贝而不是指针, 值离开锁之后仍然有效; 值较大时应当存放 TSharedPtr
+ * @tparam Eviction 读多写少时使用 Clock, 命中只需要共享锁
+ */
+template <typename KeyType, typename ValueType, ELruCacheEviction Eviction = ELruCacheEviction::Lru,
+          size_t ShardCount = 16>
+class TConcurrentLruCache
+{
+    static_assert(std::has_single_bit(ShardCount) && ShardCount <= 65536, "ShardCount must be a power of two");
+
+    using CacheType = std::conditional_t<Eviction == ELruCacheEviction::Lru, TLruCache<KeyType, ValueType>,
+                                         TClockCache<KeyType, ValueType>>;
+
+    // 每个分片独占缓存行, 避免相邻分片的锁互相干扰
+    struct alignas(64) FShard
+    {
+        mutable FSharedMutex Mutex;
+        CacheType            Cache;
+    };
+
+public:
+    using Key      = KeyType;
+    using Value    = ValueType;
+    using SizeType = size_t;
+
+    /**
+     * @param InCapacity 总容量, 平均分配到各个分片, 每个分片至少为 1
+     */
+    explicit TConcurrentLruCache(const SizeType InCapacity = DEFAULT_LRU_CACHE_CAPACITY * ShardCount)
+    {
+        const SizeType ShardCapacity = std::max<SizeType>((InCapacity + ShardCount - 1) / ShardCount, 1);
+        for (FShard& Shard : Shards)
+        {
+            Shard.Cache = CacheType(ShardCapacity);
+        }
+    }
+
+    void Add(const KeyType& Key, const ValueType& Value)
+    {
+        FShard&                        Shard = GetShard(Key);
+        std::unique_lock<FSharedMutex> Lock(Shard.Mutex);
+        Shard.Cache.Add(Key, Value);
+    }
+
+    void Add(const KeyType& Key, ValueType&& Value)
+    {
+        FShard&                        Shard = GetShard(Key);
+        std::unique_lock<FSharedMutex> Lock(Shard.Mutex);
+        Shard.Cache.Add(Key, std::move(Value));
+    }
+
+    /**
+     * 查找并拷贝值, 命中时更新访问顺序
+     * @return 未找到时返回 false, OutValue 保持不变
+     */
+    bool TryGet(const KeyType& Key, ValueType& OutValue)
+    {
+        FShard& Shard = GetShard(Key);
+        if constexpr (Eviction == ELruCacheEviction::Clock)
+        {
+            std::shared_lock<FSharedMutex> Lock(Shard.Mutex);
+            const CacheType&               Cache = Shard.Cache;
+            return CopyOut(Cache.Find(Key), OutValue);
+        }
+        else
+        {
+            std::unique_lock<FSharedMutex> Lock(Shard.Mutex);
+            return CopyOut(Shard.Cache.Find(Key), OutValue);
+        }
+    }
+
+    // 不更新访问顺序
+    bool Contains(const KeyType& Key) const
+    {
+        const FShard&                  Shard = GetShard(Key);
+        std::shared_lock<FSharedMutex> Lock(Shard.Mutex);
+        return Shard.Cache.Contains(Key);
+    }
+
+    bool Remove(const KeyType& Key)
+    {
+        FShard&                        Shard = GetShard(Key);
+        std::unique_lock<FSharedMutex> Lock(Shard.Mutex);
+        return Shard.Cache.Remove(Key);
+    }
+
+    void Clear()
+    {
+        for (FShard& Shard : Shards)
+        {
+            std::unique_lock<FSharedMutex> Lock(Shard.Mutex);
+            Shard.Cache.Clear();
+        }
+    }
+
+    // 逐个分片统计, 并发修改时只是近似值
+    SizeType Size() const
+    {
+        SizeType Total = 0;
+        for (const FShard& Shard : Shards)
+        {
+            std::shared_lock<FSharedMutex> Lock(Shard.Mutex);
+            Total += Shard.Cache.Size();
+        }
+        return Total;
+    }
+
+    SizeType Capacity() const noexcept
+    {
+        return Shards[0].Cache.Capacity() * ShardCount;
+    }
+
+private:
+    static bool CopyOut(const ValueType* Found, ValueType& OutValue)
+    {
+        if (Found == nullptr)
+        {
+            return false;
+        }
+        OutValue = *Found;
+        return true;
+    }
+
+    // 分片使用哈希的高位, 分片内的索引使用低位, 避免分片内的键集中在少数桶上
+    static SizeType GetShardIndex(const KeyType& Key)
+    {
+        const size_t Hash = HKHashTableImpl::MixHash(std::hash<KeyType>{}(Key));
+        return (Hash >> (std::numeric_limits<size_t>::digits - 16)) & (ShardCount - 1);
+    }
+
+    FShard& GetShard(const KeyType& Key)
+    {
+        return Shards[GetShardIndex(Key)];
+    }
+
+    const FShard& GetShard(const KeyType& Key) const
+    {
+        return Shards[GetShardIndex(Key)];
+    }
+
+    FShard Shards[ShardCount];
+};
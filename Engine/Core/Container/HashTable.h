@@ -0,0 +1,617 @@
+#pragma once
+
+#include "Core/Memory/Allocator.h"
+#include "Core/Utility/Macros.h"
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if HK_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+template <typename T>
+concept CMapKey = requires(const T& A, const T& B) {
+    { A.GetHashCode() } -> std::same_as<size_t>;
+    { A == B } -> std::same_as<bool>;
+};
+
+namespace std
+{
+template <CMapKey T>
+struct hash<T>
+{
+    size_t operator()(const T& Key) const noexcept
+    {
+        return Key.GetHashCode();
+    }
+};
+} // namespace std
+
+/**
+ * 是否可以用 QueryType 直接查找 KeyType 的键而不构造 KeyType
+ * 特化为 true 时必须保证: 相等的值 std::hash<KeyType> 与 std::hash<QueryType> 的结果相同, 且 KeyType == QueryType 可比较
+ */
+template <typename KeyType, typename QueryType>
+inline constexpr bool TIsHashLookupCompatible = std::is_same_v<KeyType, QueryType>;
+
+namespace HKHashTableImpl
+{
+// 控制字节: 最高位为 0 表示槽位已占用, 低 7 位为哈希值的 H2; 否则为空或墓碑
+using FCtrl = Int8;
+
+inline constexpr FCtrl  CtrlEmpty   = -128;
+inline constexpr FCtrl  CtrlDeleted = -2;
+inline constexpr size_t GroupWidth  = 16;
+
+/**
+ * std::hash 对整数与指针通常是恒等映射, 先打散再拆分为探测位置 H1 与控制字节 H2
+ */
+inline size_t MixHash(const size_t Hash) noexcept
+{
+    const UInt64 Mixed = static_cast<UInt64>(Hash) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(Mixed ^ (Mixed >> 32));
+}
+
+/**
+ * 一次比较 GroupWidth 个控制字节, 返回的位掩码中第 i 位对应第 i 个控制字节
+ */
+struct FGroup
+{
+#if HK_SIMD_SSE2
+    explicit FGroup(const FCtrl* Pos) : Ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Pos))) {}
+
+    UInt32 Match(const FCtrl H2) const
+    {
+        return static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(H2), Ctrl)));
+    }
+
+    UInt32 MatchEmptyOrDeleted() const
+    {
+        // 空与墓碑都小于 -1, 占用的控制字节非负
+        return static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), Ctrl)));
+    }
+
+    __m128i Ctrl;
+#else
+    explicit FGroup(const FCtrl* Pos)
+    {
+        std::memcpy(Ctrl, Pos, GroupWidth);
+    }
+
+    UInt32 Match(const FCtrl H2) const
+    {
+        UInt32 Mask = 0;
+        for (size_t Index = 0; Index < GroupWidth; ++Index)
+        {
+            Mask |= static_cast<UInt32>(Ctrl[Index] == H2) << Index;
+        }
+        return Mask;
+    }
+
+    UInt32 MatchEmptyOrDeleted() const
+    {
+        UInt32 Mask = 0;
+        for (size_t Index = 0; Index < GroupWidth; ++Index)
+        {
+            Mask |= static_cast<UInt32>(Ctrl[Index] < -1) << Index;
+        }
+        return Mask;
+    }
+
+    FCtrl Ctrl[GroupWidth];
+#endif
+
+    UInt32 MatchEmpty() const
+    {
+        return Match(CtrlEmpty);
+    }
+};
+} // namespace HKHashTableImpl
+
+/**
+ * 开放寻址的扁平哈希表（Swiss Table）, TMap 与 TSet 的底层实现
+ * 每个槽位对应一个控制字节, 查找时按 16 个一组用 SIMD 比较哈希值的低 7 位, 只有匹配的槽位才比较键
+ * 组间按三角数序列探测, 容量为 2 的幂时可以覆盖所有组; 最大负载因子为 7/8
+ * 元素直接存放在连续数组中, 指针、引用与迭代器的失效规则:
+ * - 插入新键 (TMap 的 Add/Emplace, 以及 operator[] 遇到不存在的键) 与 Reserve 可能重建表并移动所有元素,
+ *   之前取得的指针、引用与迭代器全部失效; 墓碑过多时即使元素数量没有增加也会按原容量重建
+ * - 查找、对已存在的键调用 operator[]、修改值都不会移动元素
+ * - 删除只会使被删除的元素失效, 不移动其他元素
+ * 需要跨插入持有的数据应当先复制出来, 或者让值本身是指针、TUniquePtr 等地址稳定的对象
+ * @tparam Policy 提供键类型 Key, 槽位类型 Slot, GetKey(const Slot&) 与 Relocate(Slot* Dst, Slot* Src)
+ * @tparam AllocatorPolicy 控制字节与槽位共用一块内存, 通过此策略分配
+ */
+template <typename Policy, CAllocatorPolicy AllocatorPolicy = FHeapAllocatorPolicy>
+class THashTable
+{
+    using FCtrl  = HKHashTableImpl::FCtrl;
+    using FGroup = HKHashTableImpl::FGroup;
+
+    static constexpr size_t GroupWidth  = HKHashTableImpl::GroupWidth;
+    static constexpr size_t MinCapacity = GroupWidth;
+
+public:
+    using KeyType  = typename Policy::Key;
+    using SlotType = typename Policy::Slot;
+    using SizeType = size_t;
+
+    static constexpr SizeType NotFound = static_cast<SizeType>(-1);
+
+    template <bool bConst>
+    class TIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = SlotType;
+        using difference_type   = ptrdiff_t;
+        using pointer           = std::conditional_t<bConst, const SlotType*, SlotType*>;
+        using reference         = std::conditional_t<bConst, const SlotType&, SlotType&>;
+
+        TIterator() = default;
+
+        // 非 const 迭代器可以转换为 const 迭代器
+        template <bool bOtherConst>
+            requires(bConst && !bOtherConst)
+        TIterator(const TIterator<bOtherConst>& Other) : Ctrl(Other.Ctrl), Slot(Other.Slot), End(Other.End)
+        {
+        }
+
+        reference operator*() const
+        {
+            return *Slot;
+        }
+
+        pointer operator->() const
+        {
+            return Slot;
+        }
+
+        TIterator& operator++()
+        {
+            ++Ctrl;
+            ++Slot;
+            SkipEmptySlots();
+            return *this;
+        }
+
+        TIterator operator++(int)
+        {
+            TIterator Temp = *this;
+            ++*this;
+            return Temp;
+        }
+
+        template <bool bOtherConst>
+        bool operator==(const TIterator<bOtherConst>& Other) const
+        {
+            return Slot == Other.Slot;
+        }
+
+    private:
+        friend class THashTable;
+        template <bool>
+        friend class TIterator;
+
+        TIterator(const FCtrl* InCtrl, pointer InSlot, const FCtrl* InEnd) : Ctrl(InCtrl), Slot(InSlot), End(InEnd)
+        {
+            SkipEmptySlots();
+        }
+
+        void SkipEmptySlots()
+        {
+            while (Ctrl != End && *Ctrl < 0)
+            {
+                ++Ctrl;
+                ++Slot;
+            }
+        }
+
+        const FCtrl* Ctrl = nullptr;
+        pointer      Slot = nullptr;
+        const FCtrl* End  = nullptr;
+    };
+
+    using Iterator      = TIterator<false>;
+    using ConstIterator = TIterator<true>;
+
+    THashTable() = default;
+
+    ~THashTable()
+    {
+        DestroyAndFree();
+    }
+
+    THashTable(const THashTable& Other)
+    {
+        CopyFrom(Other);
+    }
+
+    THashTable(THashTable&& Other) noexcept
+    {
+        StealFrom(Other);
+    }
+
+    THashTable& operator=(const THashTable& Other)
+    {
+        if (this != &Other)
+        {
+            DestroyAndFree();
+            CopyFrom(Other);
+        }
+        return *this;
+    }
+
+    THashTable& operator=(THashTable&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            DestroyAndFree();
+            StealFrom(Other);
+        }
+        return *this;
+    }
+
+    Iterator begin() noexcept
+    {
+        return Iterator(Ctrl, Slots, Ctrl + Capacity);
+    }
+
+    Iterator end() noexcept
+    {
+        return Iterator(Ctrl + Capacity, Slots + Capacity, Ctrl + Capacity);
+    }
+
+    ConstIterator begin() const noexcept
+    {
+        return ConstIterator(Ctrl, Slots, Ctrl + Capacity);
+    }
+
+    ConstIterator end() const noexcept
+    {
+        return ConstIterator(Ctrl + Capacity, Slots + Capacity, Ctrl + Capacity);
+    }
+
+    Iterator MakeIterator(const SizeType Index) noexcept
+    {
+        return Index == NotFound ? end() : Iterator(Ctrl + Index, Slots + Index, Ctrl + Capacity);
+    }
+
+    ConstIterator MakeIterator(const SizeType Index) const noexcept
+    {
+        return Index == NotFound ? end() : ConstIterator(Ctrl + Index, Slots + Index, Ctrl + Capacity);
+    }
+
+    SlotType& GetSlot(const SizeType Index) noexcept
+    {
+        return Slots[Index];
+    }
+
+    const SlotType& GetSlot(const SizeType Index) const noexcept
+    {
+        return Slots[Index];
+    }
+
+    /**
+     * 查找键所在的槽位
+     * @return 不存在时返回 NotFound
+     */
+    template <typename QueryType>
+    SizeType FindIndex(const QueryType& Key) const
+    {
+        if (Size == 0)
+        {
+            return NotFound;
+        }
+        const size_t Hash  = HKHashTableImpl::MixHash(std::hash<QueryType>{}(Key));
+        const FCtrl  H2    = static_cast<FCtrl>(Hash & 0x7F);
+        const size_t Mask  = Capacity - 1;
+        size_t       Pos   = (Hash >> 7) & Mask;
+        size_t       Probe = 0;
+        while (true)
+        {
+            const FGroup Group(Ctrl + Pos);
+            for (UInt32 Match = Group.Match(H2); Match != 0; Match &= Match - 1)
+            {
+                const size_t Index = (Pos + std::countr_zero(Match)) & Mask;
+                if (Policy::GetKey(Slots[Index]) == Key)
+                {
+                    return Index;
+                }
+            }
+            if (Group.MatchEmpty() != 0)
+            {
+                return NotFound;
+            }
+            Probe += GroupWidth;
+            Pos = (Pos + Probe) & Mask;
+        }
+    }
+
+    /**
+     * 查找键, 不存在时用 Args 构造一个新槽位
+     * @return 槽位下标与是否新插入
+     */
+    template <typename QueryType, typename... ArgTypes>
+    std::pair<SizeType, bool> FindOrEmplace(const QueryType& Key, ArgTypes&&... Args)
+    {
+        if (const SizeType Found = FindIndex(Key); Found != NotFound)
+        {
+            return {Found, false};
+        }
+        const size_t Hash = HKHashTableImpl::MixHash(std::hash<QueryType>{}(Key));
+        if (GrowthLeft == 0)
+        {
+            GrowForInsert();
+        }
+        const SizeType Index = FindFirstNonFull(Hash);
+        ::new (static_cast<void*>(Slots + Index)) SlotType(std::forward<ArgTypes>(Args)...);
+        GrowthLeft -= Ctrl[Index] == HKHashTableImpl::CtrlEmpty ? 1 : 0;
+        SetCtrl(Index, static_cast<FCtrl>(Hash & 0x7F));
+        ++Size;
+        return {Index, true};
+    }
+
+    /**
+     * 删除槽位中的元素, 不移动其他元素
+     */
+    void EraseAt(const SizeType Index)
+    {
+        Slots[Index].~SlotType();
+        --Size;
+
+        // 如果这个槽位前后的空槽之间不足一组, 说明从未有探测序列因为整组已满而越过它, 可以直接置为空
+        const size_t Mask        = Capacity - 1;
+        const size_t IndexBefore = (Index - GroupWidth) & Mask;
+        const UInt32 EmptyAfter  = FGroup(Ctrl + Index).MatchEmpty();
+        const UInt32 EmptyBefore = FGroup(Ctrl + IndexBefore).MatchEmpty();
+        const bool   bNeverFull  = EmptyBefore != 0 && EmptyAfter != 0 &&
+                                static_cast<size_t>(std::countr_zero(EmptyAfter) +
+                                                    std::countl_zero(static_cast<UInt16>(EmptyBefore))) < GroupWidth;
+        if (bNeverFull)
+        {
+            SetCtrl(Index, HKHashTableImpl::CtrlEmpty);
+            ++GrowthLeft;
+        }
+        else
+        {
+            SetCtrl(Index, HKHashTableImpl::CtrlDeleted);
+        }
+    }
+
+    template <typename QueryType>
+    bool Erase(const QueryType& Key)
+    {
+        const SizeType Index = FindIndex(Key);
+        if (Index == NotFound)
+        {
+            return false;
+        }
+        EraseAt(Index);
+        return true;
+    }
+
+    /**
+     * 销毁所有元素, 保留已分配的容量
+     */
+    void Clear() noexcept
+    {
+        if (Capacity == 0)
+        {
+            return;
+        }
+        DestroySlots();
+        ResetCtrl();
+        Size       = 0;
+        GrowthLeft = GetMaxLoad(Capacity);
+    }
+
+    /**
+     * 预留至少容纳 Count 个元素的容量, 之后插入 Count 个元素前不会扩容
+     */
+    void Reserve(const SizeType Count)
+    {
+        if (Count <= Size + GrowthLeft)
+        {
+            return;
+        }
+        Resize(GetCapacityFor(Count));
+    }
+
+    SizeType GetSize() const noexcept
+    {
+        return Size;
+    }
+
+    SizeType GetCapacity() const noexcept
+    {
+        return Capacity;
+    }
+
+private:
+    static constexpr size_t SlotAlign = alignof(SlotType) > GroupWidth ? alignof(SlotType) : GroupWidth;
+
+    static size_t GetMaxLoad(const size_t InCapacity) noexcept
+    {
+        return InCapacity - InCapacity / 8;
+    }
+
+    static size_t GetCapacityFor(const size_t Count) noexcept
+    {
+        size_t NewCapacity = MinCapacity;
+        while (GetMaxLoad(NewCapacity) < Count)
+        {
+            NewCapacity *= 2;
+        }
+        return NewCapacity;
+    }
+
+    static size_t GetSlotOffset(const size_t InCapacity) noexcept
+    {
+        return (InCapacity + GroupWidth + alignof(SlotType) - 1) & ~(alignof(SlotType) - 1);
+    }
+
+    static size_t GetAllocationSize(const size_t InCapacity) noexcept
+    {
+        return GetSlotOffset(InCapacity) + sizeof(SlotType) * InCapacity;
+    }
+
+    /**
+     * 写入控制字节, 前 GroupWidth 个控制字节在数组末尾有一份副本, 使从任意位置读取一组都不需要回绕
+     */
+    void SetCtrl(const size_t Index, const FCtrl Value) noexcept
+    {
+        Ctrl[Index] = Value;
+        if (Index < GroupWidth)
+        {
+            Ctrl[Capacity + Index] = Value;
+        }
+    }
+
+    void ResetCtrl() noexcept
+    {
+        std::memset(Ctrl, static_cast<UInt8>(HKHashTableImpl::CtrlEmpty), Capacity + GroupWidth);
+    }
+
+    size_t FindFirstNonFull(const size_t Hash) const noexcept
+    {
+        const size_t Mask  = Capacity - 1;
+        size_t       Pos   = (Hash >> 7) & Mask;
+        size_t       Probe = 0;
+        while (true)
+        {
+            if (const UInt32 Match = FGroup(Ctrl + Pos).MatchEmptyOrDeleted(); Match != 0)
+            {
+                return (Pos + std::countr_zero(Match)) & Mask;
+            }
+            Probe += GroupWidth;
+            Pos = (Pos + Probe) & Mask;
+        }
+    }
+
+    void GrowForInsert()
+    {
+        // 墓碑较多时按原容量重建即可回收空间, 否则容量翻倍
+        if (Capacity != 0 && Size <= GetMaxLoad(Capacity) / 2)
+        {
+            Resize(Capacity);
+        }
+        else
+        {
+            Resize(Capacity == 0 ? MinCapacity : Capacity * 2);
+        }
+    }
+
+    void Allocate(const size_t NewCapacity)
+    {
+        void* Memory = AllocatorPolicy::Allocate(GetAllocationSize(NewCapacity), SlotAlign);
+        Ctrl       = static_cast<FCtrl*>(Memory);
+        Slots      = reinterpret_cast<SlotType*>(static_cast<char*>(Memory) + GetSlotOffset(NewCapacity));
+        Capacity   = NewCapacity;
+        GrowthLeft = GetMaxLoad(NewCapacity) - Size;
+        ResetCtrl();
+    }
+
+    void Resize(const size_t NewCapacity)
+    {
+        FCtrl*       OldCtrl     = Ctrl;
+        SlotType*    OldSlots    = Slots;
+        const size_t OldCapacity = Capacity;
+
+        Allocate(NewCapacity);
+        for (size_t Index = 0; Index < OldCapacity; ++Index)
+        {
+            if (OldCtrl[Index] < 0)
+            {
+                continue;
+            }
+            const size_t Hash =
+                HKHashTableImpl::MixHash(std::hash<KeyType>{}(Policy::GetKey(OldSlots[Index])));
+            const size_t Target = FindFirstNonFull(Hash);
+            Policy::Relocate(Slots + Target, OldSlots + Index);
+            SetCtrl(Target, static_cast<FCtrl>(Hash & 0x7F));
+        }
+        if (OldCtrl != nullptr)
+        {
+            AllocatorPolicy::Free(OldCtrl, GetAllocationSize(OldCapacity), SlotAlign);
+        }
+    }
+
+    void DestroySlots() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<SlotType>)
+        {
+            for (size_t Index = 0; Index < Capacity; ++Index)
+            {
+                if (Ctrl[Index] >= 0)
+                {
+                    Slots[Index].~SlotType();
+                }
+            }
+        }
+    }
+
+    void DestroyAndFree() noexcept
+    {
+        if (Ctrl == nullptr)
+        {
+            return;
+        }
+        DestroySlots();
+        AllocatorPolicy::Free(Ctrl, GetAllocationSize(Capacity), SlotAlign);
+        Ctrl       = nullptr;
+        Slots      = nullptr;
+        Capacity   = 0;
+        Size       = 0;
+        GrowthLeft = 0;
+    }
+
+    void CopyFrom(const THashTable& Other)
+    {
+        if (Other.Size == 0)
+        {
+            return;
+        }
+        Allocate(GetCapacityFor(Other.Size));
+        for (size_t Index = 0; Index < Other.Capacity; ++Index)
+        {
+            if (Other.Ctrl[Index] < 0)
+            {
+                continue;
+            }
+            const size_t Target = FindFirstNonFull(
+                HKHashTableImpl::MixHash(std::hash<KeyType>{}(Policy::GetKey(Other.Slots[Index]))));
+            ::new (static_cast<void*>(Slots + Target)) SlotType(Other.Slots[Index]);
+            SetCtrl(Target, Other.Ctrl[Index]);
+            ++Size;
+            --GrowthLeft;
+        }
+    }
+
+    void StealFrom(THashTable& Other) noexcept
+    {
+        Ctrl             = Other.Ctrl;
+        Slots            = Other.Slots;
+        Capacity         = Other.Capacity;
+        Size             = Other.Size;
+        GrowthLeft       = Other.GrowthLeft;
+        Other.Ctrl       = nullptr;
+        Other.Slots      = nullptr;
+        Other.Capacity   = 0;
+        Other.Size       = 0;
+        Other.GrowthLeft = 0;
+    }
+
+    FCtrl*    Ctrl       = nullptr;
+    SlotType* Slots      = nullptr;
+    size_t    Capacity   = 0;
+    size_t    Size       = 0;
+    size_t    GrowthLeft = 0;
+};
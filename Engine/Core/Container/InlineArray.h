@@ -0,0 +1,597 @@
+#pragma once
+
+#include "Core/Container/Span.h"
+#include "Core/Memory/Allocator.h"
+#include "Core/Serialization/Serialization.h"
+#include "Core/Utility/Macros.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * 带内联存储的动态数组, 接口与 TArray 一致
+ * 元素个数不超过 N 时存放在对象内部, 不进行任何堆分配; 超出后整体搬到 AllocatorPolicy 分配的内存上
+ * 适合元素个数通常很少的临时列表, 例如一次绑定的描述符集、一条命令的复制区域、一个任务的依赖
+ * 序列化格式与 TArray 相同, 两者的数据可以互相读取
+ * @tparam N 内联存储的元素个数
+ * @tparam AllocatorPolicy 超出内联容量后使用的内存分配策略, 见 CAllocatorPolicy
+ */
+template <typename T, size_t N, CAllocatorPolicy AllocatorPolicy = FHeapAllocatorPolicy>
+class TInlineArray
+{
+    static_assert(N > 0, "TInlineArray requires at least one inline element, use TArray instead");
+
+public:
+    using ElementType = T;
+    using ValueType = T;
+    using value_type = T; // For C++20 ranges compatibility
+    using SizeType = size_t;
+    using DifferenceType = ptrdiff_t;
+    using Pointer = T*;
+    using ConstPointer = const T*;
+    using Reference = T&;
+    using ConstReference = const T&;
+    using Iterator = T*;
+    using ConstIterator = const T*;
+    using ReverseIterator = std::reverse_iterator<Iterator>;
+    using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+    static constexpr SizeType InlineCapacity = N;
+
+    TInlineArray() noexcept : MyData(GetInlineData()) {}
+    explicit TInlineArray(SizeType InSize) : TInlineArray()
+    {
+        Resize(InSize);
+    }
+    TInlineArray(SizeType InSize, const T& InValue) : TInlineArray()
+    {
+        Resize(InSize, InValue);
+    }
+    TInlineArray(std::initializer_list<T> InitList) : TInlineArray()
+    {
+        Append(InitList.begin(), InitList.end());
+    }
+    template <typename InputIt>
+        requires std::input_iterator<InputIt>
+    TInlineArray(InputIt First, InputIt Last) : TInlineArray()
+    {
+        Append(First, Last);
+    }
+
+    TInlineArray(const TInlineArray& Other) : TInlineArray()
+    {
+        Append(Other.begin(), Other.end());
+    }
+
+    TInlineArray(TInlineArray&& Other) noexcept(std::is_nothrow_move_constructible_v<T>) : TInlineArray()
+    {
+        MoveFrom(Other);
+    }
+
+    ~TInlineArray()
+    {
+        Clear();
+        FreeHeapData();
+    }
+
+    TInlineArray& operator=(const TInlineArray& Other)
+    {
+        if (this != &Other)
+        {
+            Clear();
+            Append(Other.begin(), Other.end());
+        }
+        return *this;
+    }
+
+    TInlineArray& operator=(TInlineArray&& Other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &Other)
+        {
+            Clear();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
+
+    TInlineArray& operator=(std::initializer_list<T> InitList)
+    {
+        Clear();
+        Append(InitList.begin(), InitList.end());
+        return *this;
+    }
+
+    Iterator begin() noexcept
+    {
+        return MyData;
+    }
+    Iterator end() noexcept
+    {
+        return MyData + MySize;
+    }
+    ConstIterator begin() const noexcept
+    {
+        return MyData;
+    }
+    ConstIterator end() const noexcept
+    {
+        return MyData + MySize;
+    }
+    ConstIterator cbegin() const noexcept
+    {
+        return MyData;
+    }
+    ConstIterator cend() const noexcept
+    {
+        return MyData + MySize;
+    }
+    ReverseIterator rbegin() noexcept
+    {
+        return ReverseIterator(end());
+    }
+    ReverseIterator rend() noexcept
+    {
+        return ReverseIterator(begin());
+    }
+    ConstReverseIterator rbegin() const noexcept
+    {
+        return ConstReverseIterator(end());
+    }
+    ConstReverseIterator rend() const noexcept
+    {
+        return ConstReverseIterator(begin());
+    }
+    ConstReverseIterator crbegin() const noexcept
+    {
+        return ConstReverseIterator(end());
+    }
+    ConstReverseIterator crend() const noexcept
+    {
+        return ConstReverseIterator(begin());
+    }
+
+    Reference operator[](SizeType Index)
+    {
+        HK_ASSERT_RAW(Index < MySize);
+        return MyData[Index];
+    }
+    ConstReference operator[](SizeType Index) const
+    {
+        HK_ASSERT_RAW(Index < MySize);
+        return MyData[Index];
+    }
+    Reference At(SizeType Index)
+    {
+        HK_ASSERT_RAW(Index < MySize);
+        return MyData[Index];
+    }
+    ConstReference At(SizeType Index) const
+    {
+        HK_ASSERT_RAW(Index < MySize);
+        return MyData[Index];
+    }
+    Reference Front()
+    {
+        HK_ASSERT_RAW(MySize > 0);
+        return MyData[0];
+    }
+    ConstReference Front() const
+    {
+        HK_ASSERT_RAW(MySize > 0);
+        return MyData[0];
+    }
+    Reference Back()
+    {
+        HK_ASSERT_RAW(MySize > 0);
+        return MyData[MySize - 1];
+    }
+    ConstReference Back() const
+    {
+        HK_ASSERT_RAW(MySize > 0);
+        return MyData[MySize - 1];
+    }
+    Pointer Data() noexcept
+    {
+        return MyData;
+    }
+    ConstPointer Data() const noexcept
+    {
+        return MyData;
+    }
+    // 供 std::data / std::size 使用, 使 TSpan 可以直接从 TInlineArray 构造
+    Pointer data() noexcept
+    {
+        return MyData;
+    }
+    ConstPointer data() const noexcept
+    {
+        return MyData;
+    }
+    SizeType size() const noexcept
+    {
+        return MySize;
+    }
+
+    SizeType Size() const noexcept
+    {
+        return MySize;
+    }
+    SizeType Length() const noexcept
+    {
+        return MySize;
+    }
+    bool IsEmpty() const noexcept
+    {
+        return MySize == 0;
+    }
+    SizeType Capacity() const noexcept
+    {
+        return MyCapacity;
+    }
+    SizeType MaxSize() const noexcept
+    {
+        return static_cast<SizeType>(std::numeric_limits<DifferenceType>::max()) / sizeof(T);
+    }
+    // 元素是否仍存放在内联存储中
+    bool IsInline() const noexcept
+    {
+        return MyData == GetInlineData();
+    }
+
+    void Reserve(SizeType NewCapacity)
+    {
+        if (NewCapacity > MyCapacity)
+        {
+            Relocate(AllocateHeapData(NewCapacity), NewCapacity);
+        }
+    }
+    // 元素能放进内联存储时搬回内联存储, 否则把堆内存收缩到元素个数
+    void ShrinkToFit()
+    {
+        if (IsInline() || MySize == MyCapacity)
+        {
+            return;
+        }
+        if (MySize <= N)
+        {
+            Relocate(GetInlineData(), N);
+        }
+        else
+        {
+            Relocate(AllocateHeapData(MySize), MySize);
+        }
+    }
+    void Resize(SizeType NewSize)
+    {
+        if (NewSize <= MySize)
+        {
+            DestroyTail(NewSize);
+            return;
+        }
+        Reserve(NewSize);
+        std::uninitialized_value_construct(MyData + MySize, MyData + NewSize);
+        MySize = NewSize;
+    }
+
+    void Resize(SizeType NewSize, const T& Value)
+    {
+        if (NewSize <= MySize)
+        {
+            DestroyTail(NewSize);
+            return;
+        }
+        if (NewSize > MyCapacity)
+        {
+            // Value 可能引用数组中的元素, 扩容前先复制一份
+            const T ValueCopy = Value;
+            Reserve(NewSize);
+            std::uninitialized_fill(MyData + MySize, MyData + NewSize, ValueCopy);
+        }
+        else
+        {
+            std::uninitialized_fill(MyData + MySize, MyData + NewSize, Value);
+        }
+        MySize = NewSize;
+    }
+
+    // 与 TArray 一致, 只销毁元素, 保留已分配的容量
+    void Clear() noexcept
+    {
+        DestroyTail(0);
+    }
+
+    void Add(const T& Value)
+    {
+        Emplace(Value);
+    }
+    void Add(T&& Value)
+    {
+        Emplace(std::move(Value));
+    }
+    template <typename... Args>
+    void Emplace(Args&&... Args_)
+    {
+        if (MySize < MyCapacity)
+        {
+            ::new (static_cast<void*>(MyData + MySize)) T(std::forward<Args>(Args_)...);
+            ++MySize;
+            return;
+        }
+
+        // 参数可能引用数组中的元素, 先在新内存上构造新元素, 再搬移旧元素
+        const SizeType NewCapacity = GetGrowCapacity(MySize + 1);
+        T*             NewData     = AllocateHeapData(NewCapacity);
+        ::new (static_cast<void*>(NewData + MySize)) T(std::forward<Args>(Args_)...);
+        Relocate(NewData, NewCapacity);
+        ++MySize;
+    }
+    void Append(const TInlineArray& Other)
+    {
+        HK_ASSERT_MSG_RAW(&Other != this, "TInlineArray cannot append itself");
+        Append(Other.begin(), Other.end());
+    }
+    template <typename InputIt>
+    void Append(InputIt First, InputIt Last)
+    {
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            const SizeType Count = static_cast<SizeType>(std::distance(First, Last));
+            if (MySize + Count > MyCapacity)
+            {
+                Reserve(GetGrowCapacity(MySize + Count));
+            }
+        }
+        for (; First != Last; ++First)
+        {
+            Emplace(*First);
+        }
+    }
+
+    void RemoveAt(SizeType Index)
+    {
+        HK_ASSERT_RAW(Index < MySize);
+        std::move(MyData + Index + 1, MyData + MySize, MyData + Index);
+        DestroyTail(MySize - 1);
+    }
+
+    bool Remove(const T& Value)
+    {
+        const SizeType Index = Find(Value);
+        if (Index != static_cast<SizeType>(-1))
+        {
+            RemoveAt(Index);
+            return true;
+        }
+        return false;
+    }
+
+    template <typename Predicate>
+    bool RemoveByPredicate(Predicate&& Pred)
+    {
+        const SizeType Index = FindByPredicate(Pred);
+        if (Index != static_cast<SizeType>(-1))
+        {
+            RemoveAt(Index);
+            return true;
+        }
+        return false;
+    }
+
+    void RemoveAll(const T& Value)
+    {
+        DestroyTail(static_cast<SizeType>(std::remove(begin(), end(), Value) - begin()));
+    }
+
+    template <typename Predicate>
+    void RemoveAllByPredicate(Predicate&& Pred)
+    {
+        DestroyTail(static_cast<SizeType>(std::remove_if(begin(), end(), Pred) - begin()));
+    }
+
+    SizeType Find(const T& Value) const noexcept
+    {
+        auto It = std::find(begin(), end(), Value);
+        if (It != end())
+        {
+            return static_cast<SizeType>(It - begin());
+        }
+        return static_cast<SizeType>(-1);
+    }
+
+    template <typename Predicate>
+    SizeType FindByPredicate(Predicate&& Pred) const noexcept
+    {
+        auto It = std::find_if(begin(), end(), Pred);
+        if (It != end())
+        {
+            return static_cast<SizeType>(It - begin());
+        }
+        return static_cast<SizeType>(-1);
+    }
+
+    bool Contains(const T& Value) const noexcept
+    {
+        return Find(Value) != static_cast<SizeType>(-1);
+    }
+
+    template <typename Predicate>
+    bool ContainsByPredicate(Predicate&& Pred) const noexcept
+    {
+        return FindByPredicate(Pred) != static_cast<SizeType>(-1);
+    }
+
+    TSpan<T> Slice(SizeType Offset, SizeType Count) noexcept
+    {
+        return TSpan<T>(MyData + Offset, Count);
+    }
+
+    TSpan<const T> Slice(SizeType Offset, SizeType Count) const noexcept
+    {
+        return TSpan<const T>(MyData + Offset, Count);
+    }
+
+    TSpan<T> Slice(SizeType Offset) noexcept
+    {
+        return TSpan<T>(MyData + Offset, MySize - Offset);
+    }
+
+    TSpan<const T> Slice(SizeType Offset) const noexcept
+    {
+        return TSpan<const T>(MyData + Offset, MySize - Offset);
+    }
+
+    void Sort()
+    {
+        std::sort(begin(), end());
+    }
+
+    template <typename Compare>
+    void Sort(Compare&& Comp)
+    {
+        std::sort(begin(), end(), Comp);
+    }
+
+    void Pop()
+    {
+        HK_ASSERT_RAW(MySize > 0);
+        DestroyTail(MySize - 1);
+    }
+    void PopBack()
+    {
+        DestroyTail(MySize - 1);
+    }
+
+    // 与 cereal 对 std::vector 的格式一致
+    template <typename Archive>
+    void Serialize(Archive& Ar)
+    {
+        if constexpr (CBlockArrayArchive<Archive>)
+        {
+            if constexpr (Archive::is_loading::value)
+            {
+                Ar.template LoadArray<T>([this](const SizeType Count) {
+                    Clear();
+                    Resize(Count);
+                    return MyData;
+                });
+            }
+            else
+            {
+                Ar.SaveArray(MyData, MySize);
+            }
+            return;
+        }
+
+        using BinaryDataType = cereal::BinaryData<T*>;
+        constexpr bool bBinaryData =
+            std::is_arithmetic_v<T> && (Archive::is_loading::value
+                                            ? cereal::traits::is_input_serializable<BinaryDataType, Archive>::value
+                                            : cereal::traits::is_output_serializable<BinaryDataType, Archive>::value);
+        if constexpr (Archive::is_loading::value)
+        {
+            cereal::size_type Count = 0;
+            Ar(cereal::make_size_tag(Count));
+            Clear();
+            Resize(static_cast<SizeType>(Count));
+        }
+        else
+        {
+            Ar(cereal::make_size_tag(static_cast<cereal::size_type>(MySize)));
+        }
+
+        if constexpr (bBinaryData)
+        {
+            Ar(cereal::binary_data(MyData, MySize * sizeof(T)));
+        }
+        else
+        {
+            for (T& Element : *this)
+            {
+                Ar(Element);
+            }
+        }
+    }
+
+private:
+    T* GetInlineData() noexcept
+    {
+        return std::launder(reinterpret_cast<T*>(InlineStorage));
+    }
+    const T* GetInlineData() const noexcept
+    {
+        return std::launder(reinterpret_cast<const T*>(InlineStorage));
+    }
+
+    SizeType GetGrowCapacity(SizeType MinCapacity) const noexcept
+    {
+        return std::max(MinCapacity, MyCapacity * 2);
+    }
+
+    static T* AllocateHeapData(SizeType Count)
+    {
+        return static_cast<T*>(AllocatorPolicy::Allocate(Count * sizeof(T), alignof(T)));
+    }
+
+    void FreeHeapData() noexcept
+    {
+        if (!IsInline())
+        {
+            AllocatorPolicy::Free(MyData, MyCapacity * sizeof(T), alignof(T));
+        }
+    }
+
+    // 把现有元素搬到 NewData 上并释放旧的堆内存, NewData 可以是内联存储
+    void Relocate(T* NewData, SizeType NewCapacity)
+    {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+        {
+            std::uninitialized_move(MyData, MyData + MySize, NewData);
+        }
+        else
+        {
+            std::uninitialized_copy(MyData, MyData + MySize, NewData);
+        }
+        std::destroy(MyData, MyData + MySize);
+        FreeHeapData();
+        MyData     = NewData;
+        MyCapacity = NewCapacity;
+    }
+
+    // 销毁 [NewSize, MySize) 范围内的元素
+    void DestroyTail(SizeType NewSize) noexcept
+    {
+        std::destroy(MyData + NewSize, MyData + MySize);
+        MySize = NewSize;
+    }
+
+    // 调用前本对象必须为空; 对方在堆上时直接接管其内存, 否则逐个移动元素
+    void MoveFrom(TInlineArray& Other)
+    {
+        if (!Other.IsInline())
+        {
+            FreeHeapData();
+            MyData           = Other.MyData;
+            MyCapacity       = Other.MyCapacity;
+            MySize           = Other.MySize;
+            Other.MyData     = Other.GetInlineData();
+            Other.MyCapacity = N;
+            Other.MySize     = 0;
+            return;
+        }
+        std::uninitialized_move(Other.MyData, Other.MyData + Other.MySize, MyData);
+        MySize = Other.MySize;
+        Other.Clear();
+    }
+
+    alignas(T) std::byte InlineStorage[N * sizeof(T)];
+    T*       MyData;
+    SizeType MySize     = 0;
+    SizeType MyCapacity = N;
+};
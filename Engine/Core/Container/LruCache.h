@@ -1,359 +1,873 @@
 #pragma once
 
+#include "Core/Container/Array.h"
+#include "Core/Container/HashTable.h"
 #include "Core/Utility/Macros.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cstddef>
-#include <list>
-#include <unordered_map>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <tuple>
 #include <utility>
 
 // 默认容量
 constexpr size_t DEFAULT_LRU_CACHE_CAPACITY = 16;
 
-template <typename KeyType, typename ValueType, typename KeyComp = std::equal_to<KeyType>>
-class TLruCache
+namespace HKLruCacheImpl
+{
+inline constexpr UInt32 InvalidIndex = UINT32_MAX;
+
+template <typename KeyType>
+UInt32 HashKey(const KeyType& Key)
+{
+    return static_cast<UInt32>(HKHashTableImpl::MixHash(std::hash<KeyType>{}(Key)));
+}
+
+/**
+ * 槽位索引: 键的哈希 -> 槽位下标, 线性探测的开放寻址表
+ * 桶数量固定为槽位容量的两倍以上, 删除时向前搬移后续元素而不是留下墓碑, 因此不会随使用退化
+ */
+class FSlotIndex
 {
 public:
-    using Key = KeyType;
-    using Value = ValueType;
-    using KeyCompare = KeyComp;
-    using SizeType = size_t;
-    
-    // 存储键值对的类型
-    using KeyValuePair = std::pair<const KeyType, ValueType>;
-    
-    // 链表节点类型（需要存储键值对）
-    using NodeType = std::pair<KeyType, ValueType>;
-    using ListType = std::list<NodeType>;
-    using ListIterator = typename ListType::iterator;
-    using ConstListIterator = typename ListType::const_iterator;
-    
-    // 哈希表类型：键 -> 链表迭代器
-    using MapType = std::unordered_map<KeyType, ListIterator>;
-    
-    // 键值对引用包装类（用于迭代器和结构化绑定）
-    class KeyValueRef
-    {
-    public:
-        KeyValueRef(ListIterator It) : MyIt(It) {}
-        
-        const KeyType& first() const { return MyIt->first; }
-        ValueType& second() { return MyIt->second; }
-        const ValueType& second() const { return MyIt->second; }
-        
-        // 支持结构化绑定的 get 函数
-        template <std::size_t I>
-        auto& get() const
-        {
-            if constexpr (I == 0)
-                return MyIt->first;
-            else if constexpr (I == 1)
-                return MyIt->second;
-        }
-        
-    private:
-        ListIterator MyIt;
-        friend class TLruCache;
-    };
-    
-    class ConstKeyValueRef
+    void Init(const UInt32 SlotCapacity)
     {
-    public:
-        ConstKeyValueRef(ConstListIterator It) : MyIt(It) {}
-        
-        const KeyType& first() const { return MyIt->first; }
-        const ValueType& second() const { return MyIt->second; }
-        
-        template <std::size_t I>
-        const auto& get() const
-        {
-            if constexpr (I == 0)
-                return MyIt->first;
-            else if constexpr (I == 1)
-                return MyIt->second;
-        }
-        
-    private:
-        ConstListIterator MyIt;
-        friend class TLruCache;
-    };
-    
-    // 迭代器：遍历链表，返回键值对的引用
-    class Iterator
+        const UInt32 BucketCount = std::bit_ceil(std::max<UInt32>(SlotCapacity * 2, 16));
+        Buckets.Clear();
+        Buckets.Resize(BucketCount);
+        Mask = BucketCount - 1;
+    }
+
+    /**
+     * @param Match 对哈希相同的槽位做键比较
+     * @return 未找到时返回 InvalidIndex
+     */
+    template <typename MatchFunc>
+    UInt32 Find(const UInt32 Hash, MatchFunc&& Match) const
     {
-    public:
-        using iterator_category = std::forward_iterator_tag;
-        using value_type = KeyValuePair;
-        using difference_type = ptrdiff_t;
-        using pointer = KeyValuePair*;
-        using reference = KeyValueRef;
-        
-        explicit Iterator(ListIterator It) : MyIt(It) {}
-        
-        Iterator& operator++()
-        {
-            ++MyIt;
-            return *this;
-        }
-        
-        Iterator operator++(int)
+        for (UInt32 Pos = Hash & Mask;; Pos = (Pos + 1) & Mask)
         {
-            Iterator Temp = *this;
-            ++MyIt;
-            return Temp;
+            const FBucket& Bucket = Buckets[Pos];
+            if (Bucket.Slot == InvalidIndex)
+            {
+                return InvalidIndex;
+            }
+            if (Bucket.Hash == Hash && Match(Bucket.Slot))
+            {
+                return Bucket.Slot;
+            }
         }
-        
-        // 返回键值对的引用包装
-        KeyValueRef operator*() const
+    }
+
+    // 调用方保证键不存在
+    void Insert(const UInt32 Hash, const UInt32 Slot)
+    {
+        UInt32 Pos = Hash & Mask;
+        while (Buckets[Pos].Slot != InvalidIndex)
         {
-            return KeyValueRef(MyIt);
+            Pos = (Pos + 1) & Mask;
         }
-        
-        bool operator==(const Iterator& Other) const
+        Buckets[Pos] = FBucket{Slot, Hash};
+    }
+
+    // 调用方保证槽位存在于索引中
+    void Remove(const UInt32 Hash, const UInt32 Slot)
+    {
+        UInt32 Pos = Hash & Mask;
+        while (Buckets[Pos].Slot != Slot)
         {
-            return MyIt == Other.MyIt;
+            Pos = (Pos + 1) & Mask;
         }
-        
-        bool operator!=(const Iterator& Other) const
+
+        // 把探测链上的后续元素前移填补空位, 只移动理想位置不在 (Pos, Next] 区间内的元素
+        for (UInt32 Next = (Pos + 1) & Mask; Buckets[Next].Slot != InvalidIndex; Next = (Next + 1) & Mask)
         {
-            return MyIt != Other.MyIt;
+            const UInt32 Home = Buckets[Next].Hash & Mask;
+            if (((Next - Home) & Mask) >= ((Next - Pos) & Mask))
+            {
+                Buckets[Pos] = Buckets[Next];
+                Pos          = Next;
+            }
         }
-        
-    private:
-        ListIterator MyIt;
-        friend class TLruCache;
+        Buckets[Pos] = FBucket{};
+    }
+
+    void Clear()
+    {
+        std::fill(Buckets.begin(), Buckets.end(), FBucket{});
+    }
+
+private:
+    struct FBucket
+    {
+        UInt32 Slot = InvalidIndex;
+        UInt32 Hash = 0;
+    };
+
+    TArray<FBucket> Buckets;
+    UInt32          Mask = 0;
+};
+} // namespace HKLruCacheImpl
+
+/**
+ * 固定容量的 LRU 缓存
+ * 所有元素存放在构造时分配好的连续槽位数组中, 以槽位下标组成侵入式双向链表（最近访问的在前）,
+ * 键到槽位的映射使用开放寻址索引; 构造之后的插入、命中与淘汰都不会再分配内存
+ * 元素在槽位中的地址在其被淘汰或删除前保持不变
+ */
+template <typename KeyType, typename ValueType, typename KeyComp = std::equal_to<KeyType>>
+class TLruCache
+{
+public:
+    using Key          = KeyType;
+    using Value        = ValueType;
+    using KeyCompare   = KeyComp;
+    using SizeType     = size_t;
+    using KeyValuePair = std::pair<const KeyType, ValueType>;
+
+private:
+    static constexpr UInt32 InvalidIndex = HKLruCacheImpl::InvalidIndex;
+
+    struct FNode
+    {
+        alignas(KeyValuePair) unsigned char Storage[sizeof(KeyValuePair)];
+        UInt32 Prev;
+        UInt32 Next;
+        UInt32 Hash;
     };
-    
-    class ConstIterator
+
+public:
+    // 迭代顺序为从最近访问到最久未访问
+    template <bool bConst>
+    class TIterator
     {
     public:
         using iterator_category = std::forward_iterator_tag;
-        using value_type = KeyValuePair;
-        using difference_type = ptrdiff_t;
-        using pointer = const KeyValuePair*;
-        using reference = ConstKeyValueRef;
-        
-        explicit ConstIterator(ConstListIterator It) : MyIt(It) {}
-        
-        ConstIterator& operator++()
-        {
-            ++MyIt;
-            return *this;
+        using value_type        = KeyValuePair;
+        using difference_type   = ptrdiff_t;
+        using pointer           = std::conditional_t<bConst, const KeyValuePair*, KeyValuePair*>;
+        using reference         = std::conditional_t<bConst, const KeyValuePair&, KeyValuePair&>;
+        using NodePointer       = std::conditional_t<bConst, const FNode*, FNode*>;
+
+        TIterator() = default;
+        TIterator(NodePointer InNodes, const UInt32 InCurrent) : Nodes(InNodes), Current(InCurrent) {}
+
+        reference operator*() const
+        {
+            return *operator->();
         }
-        
-        ConstIterator operator++(int)
+
+        pointer operator->() const
         {
-            ConstIterator Temp = *this;
-            ++MyIt;
-            return Temp;
+            return std::launder(reinterpret_cast<pointer>(Nodes[Current].Storage));
         }
-        
-        ConstKeyValueRef operator*() const
+
+        TIterator& operator++()
         {
-            return ConstKeyValueRef(MyIt);
+            Current = Nodes[Current].Next;
+            return *this;
         }
-        
-        bool operator==(const ConstIterator& Other) const
+
+        TIterator operator++(int)
         {
-            return MyIt == Other.MyIt;
+            TIterator Temp = *this;
+            ++*this;
+            return Temp;
         }
-        
-        bool operator!=(const ConstIterator& Other) const
+
+        bool operator==(const TIterator& Other) const
         {
-            return MyIt != Other.MyIt;
+            return Current == Other.Current;
         }
-        
+
     private:
-        ConstListIterator MyIt;
-        friend class TLruCache;
+        NodePointer Nodes   = nullptr;
+        UInt32      Current = InvalidIndex;
     };
 
+    using Iterator      = TIterator<false>;
+    using ConstIterator = TIterator<true>;
+
     // 默认构造函数，使用默认容量
-    TLruCache() : MyCapacity(DEFAULT_LRU_CACHE_CAPACITY) {}
-    
-    // 指定容量的构造函数
-    explicit TLruCache(SizeType InCapacity) : MyCapacity(InCapacity) {}
-    
-    // 添加键值对
-    void Add(const KeyType& Key, const ValueType& Value)
+    TLruCache() : TLruCache(DEFAULT_LRU_CACHE_CAPACITY) {}
+
+    // 指定容量的构造函数, 槽位与索引在这里一次性分配
+    explicit TLruCache(const SizeType InCapacity) : MyCapacity(static_cast<UInt32>(InCapacity))
     {
-        // 查找是否已存在
-        auto MapIt = MyMap.find(Key);
-        if (MapIt != MyMap.end())
-        {
-            // 已存在，更新值并移到链表头部
-            MapIt->second->second = Value;
-            MyList.splice(MyList.begin(), MyList, MapIt->second);
-            return;
-        }
-        
-        // 不存在，需要添加
-        // 如果容量已满，删除最久未使用的（链表末尾）
-        if (MyList.size() >= MyCapacity)
+        HK_ASSERT_MSG_RAW(InCapacity > 0 && InCapacity < InvalidIndex / 2, "Invalid LRU cache capacity");
+        MyNodes.Resize(MyCapacity);
+        MyIndex.Init(MyCapacity);
+        ResetFreeList();
+    }
+
+    ~TLruCache()
+    {
+        DestroyAll();
+    }
+
+    TLruCache(const TLruCache&)            = delete;
+    TLruCache& operator=(const TLruCache&) = delete;
+
+    TLruCache(TLruCache&& Other) noexcept
+    {
+        StealFrom(Other);
+    }
+
+    TLruCache& operator=(TLruCache&& Other) noexcept
+    {
+        if (this != &Other)
         {
-            // 删除链表末尾的元素
-            auto LastIt = --MyList.end();
-            MyMap.erase(LastIt->first);
-            MyList.pop_back();
+            DestroyAll();
+            StealFrom(Other);
         }
-        
-        // 在链表头部添加新元素
-        MyList.emplace_front(Key, Value);
-        MyMap[Key] = MyList.begin();
+        return *this;
     }
-    
+
+    // 添加键值对, 已存在时更新值; 容量已满时淘汰最久未使用的元素
+    void Add(const KeyType& Key, const ValueType& Value)
+    {
+        AddImpl(Key, Value);
+    }
+
     void Add(const KeyType& Key, ValueType&& Value)
     {
-        auto MapIt = MyMap.find(Key);
-        if (MapIt != MyMap.end())
-        {
-            MapIt->second->second = std::move(Value);
-            MyList.splice(MyList.begin(), MyList, MapIt->second);
-            return;
-        }
-        
-        if (MyList.size() >= MyCapacity)
-        {
-            auto LastIt = --MyList.end();
-            MyMap.erase(LastIt->first);
-            MyList.pop_back();
-        }
-        
-        MyList.emplace_front(Key, std::move(Value));
-        MyMap[Key] = MyList.begin();
+        AddImpl(Key, std::move(Value));
     }
-    
-    // 添加未初始化的值，返回引用
+
+    // 添加值初始化的值，返回引用; 已存在时返回已有的值
     ValueType& AddUninitialized(const KeyType& Key)
     {
-        auto MapIt = MyMap.find(Key);
-        if (MapIt != MyMap.end())
+        const UInt32 Hash = HKLruCacheImpl::HashKey(Key);
+        UInt32       Slot = FindSlot(Key, Hash);
+        if (Slot != InvalidIndex)
         {
-            // 已存在，移到链表头部并返回引用
-            MyList.splice(MyList.begin(), MyList, MapIt->second);
-            return MapIt->second->second;
+            MoveToFront(Slot);
         }
-        
-        // 不存在，需要添加
-        if (MyList.size() >= MyCapacity)
+        else
         {
-            auto LastIt = --MyList.end();
-            MyMap.erase(LastIt->first);
-            MyList.pop_back();
+            Slot = EmplaceFront(Key, Hash);
         }
-        
-        // 在链表头部添加新元素（值未初始化）
-        MyList.emplace_front(Key, ValueType{});
-        MyMap[Key] = MyList.begin();
-        return MyList.begin()->second;
+        return GetPair(Slot).second;
     }
-    
-    // 查找，返回指针（如果不存在返回 nullptr）
+
+    // 查找，返回指针（如果不存在返回 nullptr）, 命中时更新访问顺序
     ValueType* Find(const KeyType& Key) noexcept
     {
-        auto MapIt = MyMap.find(Key);
-        if (MapIt != MyMap.end())
+        const UInt32 Slot = FindSlot(Key, HKLruCacheImpl::HashKey(Key));
+        if (Slot == InvalidIndex)
         {
-            // 找到，移到链表头部（更新访问顺序）
-            MyList.splice(MyList.begin(), MyList, MapIt->second);
-            return &MapIt->second->second;
+            return nullptr;
         }
-        return nullptr;
+        MoveToFront(Slot);
+        return &GetPair(Slot).second;
     }
-    
+
+    // const 版本不能修改访问顺序
     const ValueType* Find(const KeyType& Key) const noexcept
     {
-        auto MapIt = MyMap.find(Key);
-        if (MapIt != MyMap.end())
+        const UInt32 Slot = FindSlot(Key, HKLruCacheImpl::HashKey(Key));
+        return Slot == InvalidIndex ? nullptr : &GetPair(Slot).second;
+    }
+
+    bool Remove(const KeyType& Key)
+    {
+        const UInt32 Slot = FindSlot(Key, HKLruCacheImpl::HashKey(Key));
+        if (Slot == InvalidIndex)
         {
-            // const 版本不能修改访问顺序，但可以返回指针
-            return &MapIt->second->second;
+            return false;
         }
-        return nullptr;
+        MyIndex.Remove(MyNodes[Slot].Hash, Slot);
+        Unlink(Slot);
+        GetPair(Slot).~KeyValuePair();
+        MyNodes[Slot].Next = MyFreeHead;
+        MyFreeHead         = Slot;
+        --MySize;
+        return true;
     }
-    
+
     // 迭代器支持
     Iterator begin() noexcept
     {
-        return Iterator(MyList.begin());
+        return Iterator(MyNodes.Data(), MyHead);
     }
-    
+
     Iterator end() noexcept
     {
-        return Iterator(MyList.end());
+        return Iterator(MyNodes.Data(), InvalidIndex);
     }
-    
+
     ConstIterator begin() const noexcept
     {
-        return ConstIterator(MyList.begin());
+        return ConstIterator(MyNodes.Data(), MyHead);
     }
-    
+
     ConstIterator end() const noexcept
     {
-        return ConstIterator(MyList.end());
+        return ConstIterator(MyNodes.Data(), InvalidIndex);
     }
-    
+
     ConstIterator cbegin() const noexcept
     {
-        return ConstIterator(MyList.cbegin());
+        return begin();
     }
-    
+
     ConstIterator cend() const noexcept
     {
-        return ConstIterator(MyList.cend());
+        return end();
     }
-    
+
     // 容量和大小
     SizeType Size() const noexcept
     {
-        return MyList.size();
+        return MySize;
     }
-    
+
     SizeType Capacity() const noexcept
     {
         return MyCapacity;
     }
-    
+
     bool IsEmpty() const noexcept
     {
-        return MyList.empty();
+        return MySize == 0;
     }
-    
-    // 清空
+
+    // 清空, 保留已分配的槽位
     void Clear() noexcept
     {
-        MyList.clear();
-        MyMap.clear();
+        DestroyAll();
+        MyIndex.Clear();
+        ResetFreeList();
     }
-    
-    // 检查是否包含键
+
+    // 检查是否包含键, 不更新访问顺序
     bool Contains(const KeyType& Key) const noexcept
     {
-        return MyMap.find(Key) != MyMap.end();
+        return FindSlot(Key, HKLruCacheImpl::HashKey(Key)) != InvalidIndex;
     }
 
 private:
-    SizeType MyCapacity;           // 容量
-    ListType MyList;                // 双向链表，存储键值对（最近访问的在前面）
-    MapType MyMap;                  // 哈希表，键 -> 链表迭代器
-};
+    KeyValuePair& GetPair(const UInt32 Slot) noexcept
+    {
+        return *std::launder(reinterpret_cast<KeyValuePair*>(MyNodes[Slot].Storage));
+    }
 
-// 结构化绑定支持（C++17）
-// 注意：由于 C++ 标准限制，无法为嵌套类型提供部分特化
-// 结构化绑定会通过 ADL 查找 get 函数，所以只需要提供 get 函数重载即可
+    const KeyValuePair& GetPair(const UInt32 Slot) const noexcept
+    {
+        return *std::launder(reinterpret_cast<const KeyValuePair*>(MyNodes[Slot].Storage));
+    }
 
-// get 函数重载（用于结构化绑定）
-namespace std
-{
-template <std::size_t I, typename KeyType, typename ValueType>
-auto get(const typename TLruCache<KeyType, ValueType>::KeyValueRef& Ref)
-{
-    return Ref.template get<I>();
-}
+    UInt32 FindSlot(const KeyType& Key, const UInt32 Hash) const
+    {
+        return MyIndex.Find(Hash, [&](const UInt32 Slot) { return KeyCompare{}(GetPair(Slot).first, Key); });
+    }
+
+    template <typename ArgType>
+    void AddImpl(const KeyType& Key, ArgType&& Value)
+    {
+        const UInt32 Hash = HKLruCacheImpl::HashKey(Key);
+        const UInt32 Slot = FindSlot(Key, Hash);
+        if (Slot != InvalidIndex)
+        {
+            GetPair(Slot).second = std::forward<ArgType>(Value);
+            MoveToFront(Slot);
+            return;
+        }
+        EmplaceFront(Key, Hash, std::forward<ArgType>(Value));
+    }
+
+    /**
+     * 取得一个空槽位并在其中构造新元素, 放到链表头部
+     * 没有空槽位时复用链表尾部（最久未使用）元素的槽位
+     */
+    template <typename... Args>
+    UInt32 EmplaceFront(const KeyType& Key, const UInt32 Hash, Args&&... InArgs)
+    {
+        UInt32 Slot = MyFreeHead;
+        if (Slot != InvalidIndex)
+        {
+            MyFreeHead = MyNodes[Slot].Next;
+            ++MySize;
+        }
+        else
+        {
+            Slot = MyTail;
+            MyIndex.Remove(MyNodes[Slot].Hash, Slot);
+            Unlink(Slot);
+            GetPair(Slot).~KeyValuePair();
+        }
+
+        ::new (static_cast<void*>(MyNodes[Slot].Storage))
+            KeyValuePair(std::piecewise_construct, std::forward_as_tuple(Key),
+                         std::forward_as_tuple(std::forward<Args>(InArgs)...));
+        MyNodes[Slot].Hash = Hash;
+        MyIndex.Insert(Hash, Slot);
+        LinkFront(Slot);
+        return Slot;
+    }
+
+    void Unlink(const UInt32 Slot)
+    {
+        FNode& Node = MyNodes[Slot];
+        if (Node.Prev != InvalidIndex)
+        {
+            MyNodes[Node.Prev].Next = Node.Next;
+        }
+        else
+        {
+            MyHead = Node.Next;
+        }
+        if (Node.Next != InvalidIndex)
+        {
+            MyNodes[Node.Next].Prev = Node.Prev;
+        }
+        else
+        {
+            MyTail = Node.Prev;
+        }
+    }
+
+    void LinkFront(const UInt32 Slot)
+    {
+        FNode& Node = MyNodes[Slot];
+        Node.Prev   = InvalidIndex;
+        Node.Next   = MyHead;
+        if (MyHead != InvalidIndex)
+        {
+            MyNodes[MyHead].Prev = Slot;
+        }
+        else
+        {
+            MyTail = Slot;
+        }
+        MyHead = Slot;
+    }
+
+    void MoveToFront(const UInt32 Slot)
+    {
+        if (Slot != MyHead)
+        {
+            Unlink(Slot);
+            LinkFront(Slot);
+        }
+    }
 
-template <std::size_t I, typename KeyType, typename ValueType>
-auto get(const typename TLruCache<KeyType, ValueType>::ConstKeyValueRef& Ref)
+    void DestroyAll() noexcept
+    {
+        for (UInt32 Slot = MyHead; Slot != InvalidIndex; Slot = MyNodes[Slot].Next)
+        {
+            GetPair(Slot).~KeyValuePair();
+        }
+        MyHead = InvalidIndex;
+        MyTail = InvalidIndex;
+        MySize = 0;
+    }
+
+    void ResetFreeList() noexcept
+    {
+        for (UInt32 Slot = 0; Slot < MyCapacity; ++Slot)
+        {
+            MyNodes[Slot].Next = Slot + 1 < MyCapacity ? Slot + 1 : InvalidIndex;
+        }
+        MyFreeHead = MyCapacity > 0 ? 0 : InvalidIndex;
+    }
+
+    void StealFrom(TLruCache& Other) noexcept
+    {
+        MyNodes    = std::move(Other.MyNodes);
+        MyIndex    = std::move(Other.MyIndex);
+        MyCapacity = std::exchange(Other.MyCapacity, 0);
+        MySize     = std::exchange(Other.MySize, 0);
+        MyHead     = std::exchange(Other.MyHead, InvalidIndex);
+        MyTail     = std::exchange(Other.MyTail, InvalidIndex);
+        MyFreeHead = std::exchange(Other.MyFreeHead, InvalidIndex);
+    }
+
+    TArray<FNode>              MyNodes;                   // 槽位数组, 元素在原地构造
+    HKLruCacheImpl::FSlotIndex MyIndex;                   // 键 -> 槽位
+    UInt32                     MyCapacity = 0;            // 容量
+    UInt32                     MySize     = 0;
+    UInt32                     MyHead     = InvalidIndex; // 最近访问的元素
+    UInt32                     MyTail     = InvalidIndex; // 最久未访问的元素, 满时优先淘汰
+    UInt32                     MyFreeHead = InvalidIndex; // 空槽位链表, 复用 FNode::Next
+};
+
+/**
+ * 固定容量的 CLOCK 缓存（近似 LRU）
+ * 命中时只置位槽位的访问标记而不调整任何链表, 淘汰时时钟指针扫过槽位, 清除访问标记, 淘汰第一个未被标记的元素
+ * 访问标记以原子方式读写, 因此多个线程可以在共享锁下同时调用 Find, 适合读多写少的场景
+ * 与 TLruCache 一样构造之后不再分配内存
+ */
+template <typename KeyType, typename ValueType, typename KeyComp = std::equal_to<KeyType>>
+class TClockCache
 {
-    return Ref.template get<I>();
-}
-} // namespace std
+public:
+    using Key          = KeyType;
+    using Value        = ValueType;
+    using KeyCompare   = KeyComp;
+    using SizeType     = size_t;
+    using KeyValuePair = std::pair<const KeyType, ValueType>;
 
+private:
+    static constexpr UInt32 InvalidIndex = HKLruCacheImpl::InvalidIndex;
+
+    struct FNode
+    {
+        alignas(KeyValuePair) unsigned char Storage[sizeof(KeyValuePair)];
+        UInt32 Hash;
+        UInt32 NextFree;
+        bool   bOccupied;
+    };
+
+public:
+    // 按槽位顺序遍历, 不反映访问顺序
+    template <bool bConst>
+    class TIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = KeyValuePair;
+        using difference_type   = ptrdiff_t;
+        using pointer           = std::conditional_t<bConst, const KeyValuePair*, KeyValuePair*>;
+        using reference         = std::conditional_t<bConst, const KeyValuePair&, KeyValuePair&>;
+        using NodePointer       = std::conditional_t<bConst, const FNode*, FNode*>;
+
+        TIterator() = default;
+        TIterator(NodePointer InNode, NodePointer InEnd) : Node(InNode), End(InEnd)
+        {
+            SkipEmptySlots();
+        }
+
+        reference operator*() const
+        {
+            return *operator->();
+        }
+
+        pointer operator->() const
+        {
+            return std::launder(reinterpret_cast<pointer>(Node->Storage));
+        }
+
+        TIterator& operator++()
+        {
+            ++Node;
+            SkipEmptySlots();
+            return *this;
+        }
+
+        TIterator operator++(int)
+        {
+            TIterator Temp = *this;
+            ++*this;
+            return Temp;
+        }
+
+        bool operator==(const TIterator& Other) const
+        {
+            return Node == Other.Node;
+        }
+
+    private:
+        void SkipEmptySlots()
+        {
+            while (Node != End && !Node->bOccupied)
+            {
+                ++Node;
+            }
+        }
+
+        NodePointer Node = nullptr;
+        NodePointer End  = nullptr;
+    };
+
+    using Iterator      = TIterator<false>;
+    using ConstIterator = TIterator<true>;
+
+    TClockCache() : TClockCache(DEFAULT_LRU_CACHE_CAPACITY) {}
+
+    explicit TClockCache(const SizeType InCapacity) : MyCapacity(static_cast<UInt32>(InCapacity))
+    {
+        HK_ASSERT_MSG_RAW(InCapacity > 0 && InCapacity < InvalidIndex / 2, "Invalid CLOCK cache capacity");
+        MyNodes.Resize(MyCapacity);
+        MyReferenced.Resize(MyCapacity);
+        MyIndex.Init(MyCapacity);
+        ResetFreeList();
+    }
+
+    ~TClockCache()
+    {
+        DestroyAll();
+    }
+
+    TClockCache(const TClockCache&)            = delete;
+    TClockCache& operator=(const TClockCache&) = delete;
+
+    TClockCache(TClockCache&& Other) noexcept
+    {
+        StealFrom(Other);
+    }
+
+    TClockCache& operator=(TClockCache&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            DestroyAll();
+            StealFrom(Other);
+        }
+        return *this;
+    }
+
+    void Add(const KeyType& Key, const ValueType& Value)
+    {
+        AddImpl(Key, Value);
+    }
+
+    void Add(const KeyType& Key, ValueType&& Value)
+    {
+        AddImpl(Key, std::move(Value));
+    }
+
+    ValueType& AddUninitialized(const KeyType& Key)
+    {
+        const UInt32 Hash = HKLruCacheImpl::HashKey(Key);
+        UInt32       Slot = FindSlot(Key, Hash);
+        if (Slot != InvalidIndex)
+        {
+            MarkReferenced(Slot);
+        }
+        else
+        {
+            Slot = EmplaceSlot(Key, Hash);
+        }
+        return GetPair(Slot).second;
+    }
+
+    /**
+     * 查找并标记为最近访问
+     * const 版本同样会设置访问标记, 它只修改原子标记, 可以与其它 Find 并发调用
+     */
+    ValueType* Find(const KeyType& Key) noexcept
+    {
+        const UInt32 Slot = FindSlot(Key, HKLruCacheImpl::HashKey(Key));
+        if (Slot == InvalidIndex)
+        {
+            return nullptr;
+        }
+        MarkReferenced(Slot);
+        return &GetPair(Slot).second;
+    }
+
+    const ValueType* Find(const KeyType& Key) const noexcept
+    {
+        const UInt32 Slot = FindSlot(Key, HKLruCacheImpl::HashKey(Key));
+        if (Slot == InvalidIndex)
+        {
+            return nullptr;
+        }
+        MarkReferenced(Slot);
+        return &GetPair(Slot).second;
+    }
+
+    bool Remove(const KeyType& Key)
+    {
+        const UInt32 Slot = FindSlot(Key, HKLruCacheImpl::HashKey(Key));
+        if (Slot == InvalidIndex)
+        {
+            return false;
+        }
+        MyIndex.Remove(MyNodes[Slot].Hash, Slot);
+        DestroySlot(Slot);
+        MyNodes[Slot].NextFree = MyFreeHead;
+        MyFreeHead             = Slot;
+        return true;
+    }
+
+    Iterator begin() noexcept
+    {
+        return Iterator(MyNodes.Data(), MyNodes.Data() + MyCapacity);
+    }
+
+    Iterator end() noexcept
+    {
+        return Iterator(MyNodes.Data() + MyCapacity, MyNodes.Data() + MyCapacity);
+    }
+
+    ConstIterator begin() const noexcept
+    {
+        return ConstIterator(MyNodes.Data(), MyNodes.Data() + MyCapacity);
+    }
+
+    ConstIterator end() const noexcept
+    {
+        return ConstIterator(MyNodes.Data() + MyCapacity, MyNodes.Data() + MyCapacity);
+    }
+
+    SizeType Size() const noexcept
+    {
+        return MySize;
+    }
+
+    SizeType Capacity() const noexcept
+    {
+        return MyCapacity;
+    }
+
+    bool IsEmpty() const noexcept
+    {
+        return MySize == 0;
+    }
+
+    void Clear() noexcept
+    {
+        DestroyAll();
+        MyIndex.Clear();
+        ResetFreeList();
+    }
+
+    bool Contains(const KeyType& Key) const noexcept
+    {
+        return FindSlot(Key, HKLruCacheImpl::HashKey(Key)) != InvalidIndex;
+    }
+
+private:
+    KeyValuePair& GetPair(const UInt32 Slot) noexcept
+    {
+        return *std::launder(reinterpret_cast<KeyValuePair*>(MyNodes[Slot].Storage));
+    }
+
+    const KeyValuePair& GetPair(const UInt32 Slot) const noexcept
+    {
+        return *std::launder(reinterpret_cast<const KeyValuePair*>(MyNodes[Slot].Storage));
+    }
+
+    std::atomic_ref<UInt8> GetReferenced(const UInt32 Slot) const noexcept
+    {
+        return std::atomic_ref<UInt8>(MyReferenced[Slot]);
+    }
+
+    void MarkReferenced(const UInt32 Slot) const noexcept
+    {
+        // 已经置位时不再写入, 避免读多的场景下反复弄脏缓存行
+        const std::atomic_ref<UInt8> Referenced = GetReferenced(Slot);
+        if (Referenced.load(std::memory_order_relaxed) == 0)
+        {
+            Referenced.store(1, std::memory_order_relaxed);
+        }
+    }
+
+    UInt32 FindSlot(const KeyType& Key, const UInt32 Hash) const
+    {
+        return MyIndex.Find(Hash, [&](const UInt32 Slot) { return KeyCompare{}(GetPair(Slot).first, Key); });
+    }
+
+    template <typename ArgType>
+    void AddImpl(const KeyType& Key, ArgType&& Value)
+    {
+        const UInt32 Hash = HKLruCacheImpl::HashKey(Key);
+        const UInt32 Slot = FindSlot(Key, Hash);
+        if (Slot != InvalidIndex)
+        {
+            GetPair(Slot).second = std::forward<ArgType>(Value);
+            MarkReferenced(Slot);
+            return;
+        }
+        EmplaceSlot(Key, Hash, std::forward<ArgType>(Value));
+    }
+
+    template <typename... Args>
+    UInt32 EmplaceSlot(const KeyType& Key, const UInt32 Hash, Args&&... InArgs)
+    {
+        UInt32 Slot = MyFreeHead;
+        if (Slot != InvalidIndex)
+        {
+            MyFreeHead = MyNodes[Slot].NextFree;
+        }
+        else
+        {
+            Slot = AdvanceHand();
+            MyIndex.Remove(MyNodes[Slot].Hash, Slot);
+            DestroySlot(Slot);
+        }
+
+        ::new (static_cast<void*>(MyNodes[Slot].Storage))
+            KeyValuePair(std::piecewise_construct, std::forward_as_tuple(Key),
+                         std::forward_as_tuple(std::forward<Args>(InArgs)...));
+        MyNodes[Slot].Hash      = Hash;
+        MyNodes[Slot].bOccupied = true;
+        MyReferenced[Slot]      = 1;
+        MyIndex.Insert(Hash, Slot);
+        ++MySize;
+        return Slot;
+    }
+
+    /**
+     * 转动时钟指针直到找到未被标记的槽位, 途经的标记被清除; 最多转两圈
+     * 只在没有空槽位时调用, 此时所有槽位都已占用
+     */
+    UInt32 AdvanceHand() noexcept
+    {
+        while (true)
+        {
+            const UInt32 Slot = MyHand;
+            MyHand            = MyHand + 1 < MyCapacity ? MyHand + 1 : 0;
+
+            const std::atomic_ref<UInt8> Referenced = GetReferenced(Slot);
+            if (Referenced.load(std::memory_order_relaxed) == 0)
+            {
+                return Slot;
+            }
+            Referenced.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void DestroySlot(const UInt32 Slot) noexcept
+    {
+        GetPair(Slot).~KeyValuePair();
+        MyNodes[Slot].bOccupied = false;
+        --MySize;
+    }
+
+    void DestroyAll() noexcept
+    {
+        for (UInt32 Slot = 0; Slot < MyCapacity; ++Slot)
+        {
+            if (MyNodes[Slot].bOccupied)
+            {
+                DestroySlot(Slot);
+            }
+        }
+    }
+
+    void ResetFreeList() noexcept
+    {
+        for (UInt32 Slot = 0; Slot < MyCapacity; ++Slot)
+        {
+            MyNodes[Slot].NextFree = Slot + 1 < MyCapacity ? Slot + 1 : InvalidIndex;
+            MyReferenced[Slot]     = 0;
+        }
+        MyFreeHead = MyCapacity > 0 ? 0 : InvalidIndex;
+        MyHand     = 0;
+    }
+
+    void StealFrom(TClockCache& Other) noexcept
+    {
+        MyNodes      = std::move(Other.MyNodes);
+        MyReferenced = std::move(Other.MyReferenced);
+        MyIndex      = std::move(Other.MyIndex);
+        MyCapacity   = std::exchange(Other.MyCapacity, 0);
+        MySize       = std::exchange(Other.MySize, 0);
+        MyHand       = std::exchange(Other.MyHand, 0);
+        MyFreeHead   = std::exchange(Other.MyFreeHead, InvalidIndex);
+    }
+
+    TArray<FNode>              MyNodes;
+    mutable TArray<UInt8>      MyReferenced;              // 访问标记, 通过 std::atomic_ref 读写
+    HKLruCacheImpl::FSlotIndex MyIndex;
+    UInt32                     MyCapacity = 0;
+    UInt32                     MySize     = 0;
+    UInt32                     MyHand     = 0;            // 时钟指针
+    UInt32                     MyFreeHead = InvalidIndex; // 空槽位链表, 复用 FNode::NextFree
+};
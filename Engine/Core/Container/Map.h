@@ -1,28 +1,68 @@
 #pragma once
 
+#include "Core/Container/HashTable.h"
 #include "Core/Serialization/Serialization.h"
+#include "Core/String/String.h"
 #include "Core/Utility/Macros.h"
-#include "cereal/types/unordered_map.hpp"
-#include <algorithm>
-#include <unordered_map>
+#include <initializer_list>
+#include <limits>
+#include <tuple>
 
+// FString 键可以直接用 FStringView 查找, 两者的哈希都等于 std::hash<std::string_view>
+template <>
+inline constexpr bool TIsHashLookupCompatible<FString, FStringView> = true;
 
-template <typename KeyType, typename ValueType>
+/**
+ * 基于开放寻址扁平哈希表的映射, 见 THashTable
+ * 注意: 插入新键可能重建表并移动所有元素, 之前 Find 返回的指针与 operator[] 返回的引用随之失效, 规则见 THashTable;
+ * 需要长期持有元素地址时应当存放指针而不是值
+ * @tparam AllocatorPolicy 内存分配策略, 见 CAllocatorPolicy
+ */
+template <typename KeyType, typename ValueType, CAllocatorPolicy AllocatorPolicy = FHeapAllocatorPolicy>
 class TMap
 {
+    struct FPolicy
+    {
+        using Key  = KeyType;
+        using Slot = std::pair<const KeyType, ValueType>;
+
+        static const KeyType& GetKey(const Slot& InSlot) noexcept
+        {
+            return InSlot.first;
+        }
+
+        static void Relocate(Slot* Dst, Slot* Src)
+        {
+            // 键在表内声明为 const 只是为了防止外部修改, 搬移时可以安全地移动它
+            ::new (static_cast<void*>(Dst)) Slot(std::move(const_cast<KeyType&>(Src->first)), std::move(Src->second));
+            Src->~Slot();
+        }
+    };
+    using TableType = THashTable<FPolicy, AllocatorPolicy>;
+
 public:
-    using Key = KeyType;
-    using Value = ValueType;
-    using MapType = std::unordered_map<KeyType, ValueType>;
-    using Iterator = typename MapType::iterator;
-    using ConstIterator = typename MapType::const_iterator;
-    using SizeType = size_t;
+    using Key           = KeyType;
+    using Value         = ValueType;
+    using Iterator      = typename TableType::Iterator;
+    using ConstIterator = typename TableType::ConstIterator;
+    using SizeType      = size_t;
 
     TMap() = default;
-    TMap(std::initializer_list<std::pair<const KeyType, ValueType>> InitList) : Data(InitList) {}
+    TMap(std::initializer_list<std::pair<const KeyType, ValueType>> InitList)
+    {
+        Data.Reserve(InitList.size());
+        for (const auto& Pair : InitList)
+        {
+            Add(Pair.first, Pair.second);
+        }
+    }
     template <typename InputIt>
-    TMap(InputIt First, InputIt Last) : Data(First, Last)
+    TMap(InputIt First, InputIt Last)
     {
+        for (; First != Last; ++First)
+        {
+            Add(First->first, First->second);
+        }
     }
 
     Iterator begin() noexcept
@@ -43,136 +83,202 @@ public:
     }
     ConstIterator cbegin() const noexcept
     {
-        return Data.cbegin();
+        return Data.begin();
     }
     ConstIterator cend() const noexcept
     {
-        return Data.cend();
+        return Data.end();
     }
 
     ValueType* Find(const KeyType& Key) noexcept
     {
-        auto It = Data.find(Key);
-        if (It != Data.end())
-        {
-            return &It->second;
-        }
-        return nullptr;
+        return FindImpl(Key);
     }
 
     const ValueType* Find(const KeyType& Key) const noexcept
     {
-        auto It = Data.find(Key);
-        if (It != Data.end())
-        {
-            return &It->second;
-        }
-        return nullptr;
+        return FindImpl(Key);
+    }
+
+    /**
+     * 异构查找, 例如用 FStringView 查找 FString 键, 不需要构造临时的键
+     */
+    template <typename QueryType>
+        requires(!std::is_same_v<QueryType, KeyType> && TIsHashLookupCompatible<KeyType, QueryType>)
+    ValueType* Find(const QueryType& Key) noexcept
+    {
+        return FindImpl(Key);
+    }
+
+    template <typename QueryType>
+        requires(!std::is_same_v<QueryType, KeyType> && TIsHashLookupCompatible<KeyType, QueryType>)
+    const ValueType* Find(const QueryType& Key) const noexcept
+    {
+        return FindImpl(Key);
     }
 
     Iterator FindIterator(const KeyType& Key) noexcept
     {
-        return Data.find(Key);
+        return Data.MakeIterator(Data.FindIndex(Key));
     }
 
     ConstIterator FindIterator(const KeyType& Key) const noexcept
     {
-        return Data.find(Key);
+        return Data.MakeIterator(Data.FindIndex(Key));
     }
 
     bool Contains(const KeyType& Key) const noexcept
     {
-        return Data.find(Key) != Data.end();
+        return Data.FindIndex(Key) != TableType::NotFound;
+    }
+
+    template <typename QueryType>
+        requires(!std::is_same_v<QueryType, KeyType> && TIsHashLookupCompatible<KeyType, QueryType>)
+    bool Contains(const QueryType& Key) const noexcept
+    {
+        return Data.FindIndex(Key) != TableType::NotFound;
     }
 
     ValueType& operator[](const KeyType& Key)
     {
-        return Data[Key];
+        const auto [Index, bInserted] =
+            Data.FindOrEmplace(Key, std::piecewise_construct, std::forward_as_tuple(Key), std::forward_as_tuple());
+        return Data.GetSlot(Index).second;
     }
 
     ValueType& operator[](KeyType&& Key)
     {
-        return Data[std::move(Key)];
+        const auto [Index, bInserted] =
+            Data.FindOrEmplace(Key, std::piecewise_construct, std::forward_as_tuple(std::move(Key)),
+                               std::forward_as_tuple());
+        return Data.GetSlot(Index).second;
     }
 
     ValueType& At(const KeyType& Key)
     {
-        HK_ASSERT_MSG_RAW(Data.find(Key) != Data.end(), "Key not found in map");
-        return Data.at(Key);
+        ValueType* Found = Find(Key);
+        HK_ASSERT_MSG_RAW(Found != nullptr, "Key not found in map");
+        return *Found;
     }
 
     const ValueType& At(const KeyType& Key) const
     {
-        HK_ASSERT_MSG_RAW(Data.find(Key) != Data.end(), "Key not found in map");
-        return Data.at(Key);
+        const ValueType* Found = Find(Key);
+        HK_ASSERT_MSG_RAW(Found != nullptr, "Key not found in map");
+        return *Found;
     }
 
     void Add(const KeyType& Key, const ValueType& Value)
     {
-        Data[Key] = Value;
+        const auto [Index, bInserted] = Data.FindOrEmplace(Key, Key, Value);
+        if (!bInserted)
+        {
+            Data.GetSlot(Index).second = Value;
+        }
     }
 
     void Add(const KeyType& Key, ValueType&& Value)
     {
-        Data[Key] = std::move(Value);
+        const auto [Index, bInserted] = Data.FindOrEmplace(Key, Key, std::move(Value));
+        if (!bInserted)
+        {
+            Data.GetSlot(Index).second = std::move(Value);
+        }
     }
 
+    /**
+     * 键不存在时用 Args 原地构造值, 已存在时不做任何操作
+     */
     template <typename... Args>
     void Emplace(const KeyType& Key, Args&&... Args_)
     {
-        Data.emplace(Key, std::forward<Args>(Args_)...);
+        Data.FindOrEmplace(Key, std::piecewise_construct, std::forward_as_tuple(Key),
+                           std::forward_as_tuple(std::forward<Args>(Args_)...));
     }
 
     bool Remove(const KeyType& Key)
     {
-        return Data.erase(Key) > 0;
+        return Data.Erase(Key);
+    }
+
+    template <typename QueryType>
+        requires(!std::is_same_v<QueryType, KeyType> && TIsHashLookupCompatible<KeyType, QueryType>)
+    bool Remove(const QueryType& Key)
+    {
+        return Data.Erase(Key);
     }
 
     void Clear() noexcept
     {
-        Data.clear();
+        Data.Clear();
+    }
+
+    /**
+     * 预留容量, 之后插入 Count 个元素前不会扩容
+     */
+    void Reserve(SizeType Count)
+    {
+        Data.Reserve(Count);
     }
 
     SizeType Size() const noexcept
     {
-        return Data.size();
+        return Data.GetSize();
     }
 
     bool IsEmpty() const noexcept
     {
-        return Data.empty();
+        return Data.GetSize() == 0;
     }
 
     SizeType MaxSize() const noexcept
     {
-        return Data.max_size();
+        return std::numeric_limits<SizeType>::max() / sizeof(typename FPolicy::Slot);
     }
 
+    // 与 cereal 对 std::unordered_map 的格式一致, 旧数据可以直接读取
     template <typename Archive>
         requires(CHasSerialize<KeyType, Archive> && CHasSerialize<ValueType, Archive>)
     void Serialize(Archive& Ar)
     {
-        Ar(Data);
+        if constexpr (Archive::is_loading::value)
+        {
+            cereal::size_type Count = 0;
+            Ar(cereal::make_size_tag(Count));
+            Data.Clear();
+            Data.Reserve(static_cast<SizeType>(Count));
+            for (cereal::size_type Index = 0; Index < Count; ++Index)
+            {
+                KeyType   LoadedKey{};
+                ValueType LoadedValue{};
+                Ar(cereal::make_map_item(LoadedKey, LoadedValue));
+                Add(std::move(LoadedKey), std::move(LoadedValue));
+            }
+        }
+        else
+        {
+            Ar(cereal::make_size_tag(static_cast<cereal::size_type>(Data.GetSize())));
+            for (auto& [ItemKey, ItemValue] : Data)
+            {
+                Ar(cereal::make_map_item(ItemKey, ItemValue));
+            }
+        }
     }
 
 private:
-    MapType Data;
-};
-
-template <typename T>
-concept CMapKey = requires(const T& A, const T& B) {
-    { A.GetHashCode() } -> std::same_as<size_t>;
-    { A == B } -> std::same_as<bool>;
-};
+    template <typename QueryType>
+    ValueType* FindImpl(const QueryType& Key) noexcept
+    {
+        const SizeType Index = Data.FindIndex(Key);
+        return Index == TableType::NotFound ? nullptr : &Data.GetSlot(Index).second;
+    }
 
-namespace std
-{
-template <CMapKey T>
-struct hash<T>
-{
-    size_t operator()(const T& Key) const noexcept
+    template <typename QueryType>
+    const ValueType* FindImpl(const QueryType& Key) const noexcept
     {
-        return Key.GetHashCode();
+        const SizeType Index = Data.FindIndex(Key);
+        return Index == TableType::NotFound ? nullptr : &Data.GetSlot(Index).second;
     }
+
+    TableType Data;
 };
-} // namespace std
@@ -1,52 +1,163 @@
 #pragma once
 
+#include "Core/Utility/Macros.h"
+#include "Core/Utility/Profiler.h"
 #include "Core/Utility/Ref.h"
 #include "Core/Utility/TypeTraits.h"
-#include <functional>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
 
-template <typename ReturnType, typename... Args>
-class TDelegate
+// 默认内联存储大小, 可以放下一个 FString 加一个指针的捕获, 加上调用目标与两个函数指针整个委托正好占一条缓存行
+constexpr size_t DEFAULT_DELEGATE_INLINE_SIZE = 40;
+
+/**
+ * 带内联存储的单播委托, 只能移动不能拷贝
+ * 不超过 InlineSize 且移动不抛异常的可调用对象直接存放在委托内部, 更大的才在堆上分配;
+ * 绑定成员函数时只保存对象指针与成员函数指针, 不需要额外的 lambda; 编译期确定的成员函数用 Bind<&FClass::Function>,
+ * 每个函数生成自己的调用函数, 调用只有一次间接跳转
+ * @tparam InlineSize 内联存储的字节数, 一般直接使用 TDelegate
+ */
+template <size_t InlineSize, typename ReturnType, typename... Args>
+class TSizedDelegate
 {
     static_assert(!HasNonConstReference<Args...>::value,
                   "TDelegate does not accept non-const references. Use const references or TRef<T> for references.");
+    static_assert(InlineSize >= sizeof(void*), "InlineSize must be able to hold a pointer");
+
+    enum class EOperation : UInt8
+    {
+        Move,
+        Destroy,
+    };
+
+    // Target 为可调用对象, 或 Bind<&FClass::Function> 绑定的对象
+    using InvokerType = ReturnType (*)(void* Target, Args... args);
+    // 为 nullptr 表示存储内容可以按字节搬移, 且不需要析构
+    using ManagerType = void (*)(EOperation Operation, void* Dst, void* Src);
+
+    template <typename Functor>
+    static constexpr bool bStoredInline = sizeof(Functor) <= InlineSize &&
+                                          alignof(Functor) <= alignof(std::max_align_t) &&
+                                          std::is_nothrow_move_constructible_v<Functor>;
+
+    template <typename ClassType, typename MemberFuncType>
+    struct FMemberBinding
+    {
+        ClassType*     Object;
+        MemberFuncType MemberFunc;
+    };
 
 public:
-    using FunctionType = std::function<ReturnType(Args...)>;
+    TSizedDelegate() = default;
+
+    ~TSizedDelegate()
+    {
+        Reset();
+    }
+
+    TSizedDelegate(const TSizedDelegate&)            = delete;
+    TSizedDelegate& operator=(const TSizedDelegate&) = delete;
+
+    TSizedDelegate(TSizedDelegate&& Other) noexcept
+    {
+        MoveFrom(Other);
+    }
 
-    TDelegate() = default;
-    ~TDelegate() = default;
+    TSizedDelegate& operator=(TSizedDelegate&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Reset();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
 
     // 绑定lambda或函数对象
     template <typename Functor>
+        requires(!std::is_same_v<std::decay_t<Functor>, TSizedDelegate> &&
+                 std::is_invocable_r_v<ReturnType, std::decay_t<Functor>&, Args...>)
     void Bind(Functor&& Func)
     {
-        MyFunction = std::forward<Functor>(Func);
+        using FunctorType = std::decay_t<Functor>;
+        Reset();
+        if constexpr (bStoredInline<FunctorType>)
+        {
+            ::new (static_cast<void*>(Storage)) FunctorType(std::forward<Functor>(Func));
+            Target  = Storage;
+            Invoker = [](void* InTarget, Args... args) -> ReturnType {
+                return (*std::launder(static_cast<FunctorType*>(InTarget)))(std::forward<Args>(args)...);
+            };
+            if constexpr (!std::is_trivially_copyable_v<FunctorType>)
+            {
+                Manager = &ManageInline<FunctorType>;
+            }
+        }
+        else
+        {
+            FunctorType* HeapFunctor = New<FunctorType>(std::forward<Functor>(Func));
+            std::memcpy(Storage, &HeapFunctor, sizeof(HeapFunctor));
+            Target  = HeapFunctor;
+            Invoker = [](void* InTarget, Args... args) -> ReturnType {
+                return (*static_cast<FunctorType*>(InTarget))(std::forward<Args>(args)...);
+            };
+            Manager = &ManageHeap<FunctorType>;
+        }
     }
 
     // 绑定函数指针或静态成员函数
     void Bind(ReturnType (*Func)(Args...))
     {
-        MyFunction = Func;
+        Reset();
+        if (Func == nullptr)
+        {
+            return;
+        }
+        std::memcpy(Storage, &Func, sizeof(Func));
+        Target  = Storage;
+        Invoker = [](void* InTarget, Args... args) -> ReturnType {
+            ReturnType (*StoredFunc)(Args...) = nullptr;
+            std::memcpy(&StoredFunc, InTarget, sizeof(StoredFunc));
+            return StoredFunc(std::forward<Args>(args)...);
+        };
     }
 
     // 绑定成员函数
     template <typename ClassType>
     void Bind(ClassType* Object, ReturnType (ClassType::*MemberFunc)(Args...))
     {
-        MyFunction = [Object, MemberFunc](Args... args) -> ReturnType { return (Object->*MemberFunc)(args...); };
+        BindMember(Object, MemberFunc);
     }
 
     // 绑定const成员函数
     template <typename ClassType>
     void Bind(ClassType* Object, ReturnType (ClassType::*MemberFunc)(Args...) const)
     {
-        MyFunction = [Object, MemberFunc](Args... args) -> ReturnType { return (Object->*MemberFunc)(args...); };
+        BindMember(Object, MemberFunc);
+    }
+
+    /**
+     * 绑定编译期确定的成员函数, 只保存对象指针, 调用可以被内联
+     * 用法: Delegate.Bind<&FClass::Function>(Object)
+     */
+    template <auto MemberFunc, typename ClassType>
+        requires std::is_member_function_pointer_v<decltype(MemberFunc)>
+    void Bind(ClassType* Object)
+    {
+        Reset();
+        Target  = const_cast<void*>(static_cast<const void*>(Object));
+        Invoker = [](void* InTarget, Args... args) -> ReturnType {
+            return (static_cast<ClassType*>(InTarget)->*MemberFunc)(std::forward<Args>(args)...);
+        };
     }
 
     // 调用委托
     ReturnType Invoke(Args... args) const
     {
-        if (!MyFunction)
+        if (Invoker == nullptr)
         {
             if constexpr (std::is_same_v<ReturnType, void>)
             {
@@ -57,27 +168,113 @@ public:
                 return ReturnType{};
             }
         }
-        return MyFunction(args...);
+        return Invoker(Target, std::forward<Args>(args)...);
     }
 
     // 调用委托（操作符重载）
     ReturnType operator()(Args... args) const
     {
-        return Invoke(args...);
+        return Invoke(std::forward<Args>(args)...);
     }
 
     // 清除绑定
     void Clear()
     {
-        MyFunction = nullptr;
+        Reset();
     }
 
     // 检查是否已绑定
     bool IsBound() const
     {
-        return MyFunction != nullptr;
+        return Invoker != nullptr;
     }
 
 private:
-    FunctionType MyFunction;
-};
\ No newline at end of file
+    template <typename ClassType, typename MemberFuncType>
+    void BindMember(ClassType* Object, MemberFuncType MemberFunc)
+    {
+        using BindingType = FMemberBinding<ClassType, MemberFuncType>;
+        static_assert(bStoredInline<BindingType>, "InlineSize is too small for a member function binding");
+        Reset();
+        ::new (static_cast<void*>(Storage)) BindingType{Object, MemberFunc};
+        Target  = Storage;
+        Invoker = [](void* InTarget, Args... args) -> ReturnType {
+            const BindingType& Binding = *std::launder(static_cast<BindingType*>(InTarget));
+            return (Binding.Object->*Binding.MemberFunc)(std::forward<Args>(args)...);
+        };
+    }
+
+    template <typename FunctorType>
+    static FunctorType* GetHeapFunctor(void* InStorage)
+    {
+        FunctorType* HeapFunctor = nullptr;
+        std::memcpy(&HeapFunctor, InStorage, sizeof(HeapFunctor));
+        return HeapFunctor;
+    }
+
+    template <typename FunctorType>
+    static void ManageInline(const EOperation Operation, void* Dst, void* Src)
+    {
+        FunctorType* SrcFunctor = std::launder(static_cast<FunctorType*>(Src));
+        if (Operation == EOperation::Move)
+        {
+            ::new (Dst) FunctorType(std::move(*SrcFunctor));
+        }
+        SrcFunctor->~FunctorType();
+    }
+
+    template <typename FunctorType>
+    static void ManageHeap(const EOperation Operation, void* Dst, void* Src)
+    {
+        if (Operation == EOperation::Move)
+        {
+            std::memcpy(Dst, Src, sizeof(FunctorType*));
+            return;
+        }
+        Delete(GetHeapFunctor<FunctorType>(Src));
+    }
+
+    void Reset()
+    {
+        if (Manager != nullptr)
+        {
+            Manager(EOperation::Destroy, nullptr, Storage);
+        }
+        Target  = nullptr;
+        Invoker = nullptr;
+        Manager = nullptr;
+    }
+
+    void MoveFrom(TSizedDelegate& Other) noexcept
+    {
+        if (Other.Invoker == nullptr)
+        {
+            return;
+        }
+        if (Other.Manager != nullptr)
+        {
+            // Move 操作在搬移之后同时析构源对象
+            Other.Manager(EOperation::Move, Storage, Other.Storage);
+        }
+        else
+        {
+            std::memcpy(Storage, Other.Storage, InlineSize);
+        }
+        // 指向内联存储的调用目标需要改指向自己的存储, 对象指针与堆上的函数对象保持不变
+        Target        = Other.Target == static_cast<void*>(Other.Storage) ? static_cast<void*>(Storage) : Other.Target;
+        Invoker       = Other.Invoker;
+        Manager       = Other.Manager;
+        Other.Target  = nullptr;
+        Other.Invoker = nullptr;
+        Other.Manager = nullptr;
+    }
+
+    // 调用不改变委托本身的绑定, 但被调用的函数对象可能修改自己的状态, 与 std::function 的行为一致
+    alignas(std::max_align_t) mutable std::byte Storage[InlineSize];
+    void*       Target  = nullptr;
+    InvokerType Invoker = nullptr;
+    ManagerType Manager = nullptr;
+};
+
+template <typename ReturnType, typename... Args>
+using TDelegate = TSizedDelegate<DEFAULT_DELEGATE_INLINE_SIZE, ReturnType, Args...>;
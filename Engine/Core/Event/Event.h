@@ -1,10 +1,17 @@
 #pragma once
 
 #include "Core/Container/Array.h"
+#include "Core/Event/Delegate.h"
 #include "Core/Utility/Ref.h"
 #include "Core/Utility/TypeTraits.h"
-#include <functional>
+#include <atomic>
 
+/**
+ * 多播事件
+ * 句柄由槽位索引与代数组成, 移除绑定为 O(1), 槽位复用后旧句柄自动失效;
+ * 广播期间可以添加或移除绑定: 移除立即生效, 新增的绑定从下一次广播开始被调用
+ * 多个线程可以同时广播, 但修改绑定需要与广播在同一线程或由外部加锁
+ */
 template <typename... Args>
 class TEvent
 {
@@ -12,55 +19,91 @@ class TEvent
                   "TEvent does not accept non-const references. Use const references or TRef<T> for references.");
 
 public:
-    using Handle = size_t;
-    using FunctionType = std::function<void(Args...)>;
+    using Handle       = UInt64;
+    using DelegateType = TDelegate<void, Args...>;
 
     TEvent() = default;
     ~TEvent() = default;
 
+    TEvent(const TEvent&)            = delete;
+    TEvent& operator=(const TEvent&) = delete;
+
     // 绑定lambda或函数对象
     template <typename Functor>
     Handle AddBind(Functor&& Func)
     {
-        Handle NewHandle = NextHandle++;
-        MyFunctions.Add({NewHandle, std::forward<Functor>(Func)});
-        return NewHandle;
+        DelegateType Delegate;
+        Delegate.Bind(std::forward<Functor>(Func));
+        return AddDelegate(std::move(Delegate));
     }
 
     // 绑定函数指针或静态成员函数
     Handle AddBind(void (*Func)(Args...))
     {
-        Handle NewHandle = NextHandle++;
-        MyFunctions.Add({NewHandle, Func});
-        return NewHandle;
+        DelegateType Delegate;
+        Delegate.Bind(Func);
+        return AddDelegate(std::move(Delegate));
     }
 
     // 绑定成员函数
     template <typename ClassType>
     Handle AddBind(ClassType* Object, void (ClassType::*MemberFunc)(Args...))
     {
-        Handle NewHandle = NextHandle++;
-        MyFunctions.Add({NewHandle, [Object, MemberFunc](Args... args) { (Object->*MemberFunc)(args...); }});
-        return NewHandle;
+        DelegateType Delegate;
+        Delegate.Bind(Object, MemberFunc);
+        return AddDelegate(std::move(Delegate));
     }
 
     // 绑定const成员函数
     template <typename ClassType>
     Handle AddBind(ClassType* Object, void (ClassType::*MemberFunc)(Args...) const)
     {
-        Handle NewHandle = NextHandle++;
-        MyFunctions.Add({NewHandle, [Object, MemberFunc](Args... args) { (Object->*MemberFunc)(args...); }});
-        return NewHandle;
+        DelegateType Delegate;
+        Delegate.Bind(Object, MemberFunc);
+        return AddDelegate(std::move(Delegate));
+    }
+
+    // 绑定编译期确定的成员函数, 用法: Event.AddBind<&FClass::Function>(Object)
+    template <auto MemberFunc, typename ClassType>
+        requires std::is_member_function_pointer_v<decltype(MemberFunc)>
+    Handle AddBind(ClassType* Object)
+    {
+        DelegateType Delegate;
+        Delegate.template Bind<MemberFunc>(Object);
+        return AddDelegate(std::move(Delegate));
     }
 
     // 移除绑定
-    bool RemoveBind(Handle InHandle)
+    bool RemoveBind(const Handle InHandle)
     {
-        for (size_t i = 0; i < MyFunctions.Size(); ++i)
+        const UInt32 Index      = GetHandleIndex(InHandle);
+        const UInt32 Generation = GetHandleGeneration(InHandle);
+        if (Index < Slots.Size() && Slots[Index].Generation == Generation &&
+            Slots[Index].State == ESlotState::Bound)
+        {
+            FSlot& Slot = Slots[Index];
+            ++Slot.Generation;
+            --NumBound;
+            if (IsBroadcasting())
+            {
+                // 正在广播, 被移除的函数可能正在执行, 延迟到广播结束再销毁
+                Slot.State         = ESlotState::PendingRemove;
+                bHasPendingRemoves = true;
+            }
+            else
+            {
+                ReleaseSlot(Index);
+            }
+            return true;
+        }
+
+        // 广播期间新增、尚未写入槽位的绑定
+        for (FPendingAdd& Pending : PendingAdds)
         {
-            if (MyFunctions[i].Handle == InHandle)
+            if (Pending.Index == Index && Pending.Generation == Generation && Pending.Function.IsBound())
             {
-                MyFunctions.RemoveAt(i);
+                Pending.Function.Clear();
+                --NumBound;
                 return true;
             }
         }
@@ -70,23 +113,56 @@ public:
     // 清除所有绑定
     void Clear()
     {
-        MyFunctions.Clear();
+        // 保留槽位与代数, 清除之前取得的句柄不会误删之后的绑定
+        const bool bBroadcasting = IsBroadcasting();
+        for (size_t Index = 0; Index < Slots.Size(); ++Index)
+        {
+            FSlot& Slot = Slots[Index];
+            if (Slot.State != ESlotState::Bound)
+            {
+                continue;
+            }
+            ++Slot.Generation;
+            if (bBroadcasting)
+            {
+                Slot.State         = ESlotState::PendingRemove;
+                bHasPendingRemoves = true;
+            }
+            else
+            {
+                ReleaseSlot(static_cast<UInt32>(Index));
+            }
+        }
+        for (FPendingAdd& Pending : PendingAdds)
+        {
+            Pending.Function.Clear();
+        }
+        NumBound = 0;
     }
 
     // 调用所有绑定的函数
-    void Invoke(Args... args) const
+    void Invoke(Args... args)
     {
-        for (const auto& Pair : MyFunctions)
+        BroadcastDepth.fetch_add(1, std::memory_order_relaxed);
+        // 广播期间槽位数组不会扩容, 新增的绑定暂存在 PendingAdds 中
+        const size_t Count = Slots.Size();
+        for (size_t Index = 0; Index < Count; ++Index)
         {
-            if (Pair.Function)
+            const FSlot& Slot = Slots[Index];
+            if (Slot.State == ESlotState::Bound)
             {
-                Pair.Function(args...);
+                Slot.Function.Invoke(args...);
             }
         }
+        if (BroadcastDepth.fetch_sub(1, std::memory_order_acq_rel) == 1 &&
+            (bHasPendingRemoves || !PendingAdds.IsEmpty()))
+        {
+            ApplyPendingChanges();
+        }
     }
 
     // 调用所有绑定的函数（操作符重载）
-    void operator()(Args... args) const
+    void operator()(Args... args)
     {
         Invoke(args...);
     }
@@ -94,22 +170,144 @@ public:
     // 检查是否有绑定
     bool IsBound() const
     {
-        return MyFunctions.Size() > 0;
+        return NumBound > 0;
     }
 
     // 获取绑定数量
     size_t GetBindCount() const
     {
-        return MyFunctions.Size();
+        return NumBound;
     }
 
 private:
-    struct FunctionPair
+    enum class ESlotState : UInt8
+    {
+        Free,
+        Bound,
+        PendingRemove,
+    };
+
+    struct FSlot
     {
-        Handle Handle;
-        FunctionType Function;
+        DelegateType Function;
+        UInt32       Generation = 1; // 从1开始，句柄0作为无效句柄
+        ESlotState   State      = ESlotState::Free;
     };
 
-    TArray<FunctionPair> MyFunctions;
-    Handle NextHandle = 1; // 从1开始，0作为无效句柄
-};
\ No newline at end of file
+    struct FPendingAdd
+    {
+        UInt32       Index;
+        UInt32       Generation;
+        DelegateType Function;
+    };
+
+    static Handle MakeHandle(const UInt32 Index, const UInt32 Generation)
+    {
+        return static_cast<Handle>(Generation) << 32 | Index;
+    }
+
+    static UInt32 GetHandleIndex(const Handle InHandle)
+    {
+        return static_cast<UInt32>(InHandle);
+    }
+
+    static UInt32 GetHandleGeneration(const Handle InHandle)
+    {
+        return static_cast<UInt32>(InHandle >> 32);
+    }
+
+    bool IsBroadcasting() const
+    {
+        return BroadcastDepth.load(std::memory_order_relaxed) != 0;
+    }
+
+    Handle AddDelegate(DelegateType&& Delegate)
+    {
+        if (!Delegate.IsBound())
+        {
+            return 0;
+        }
+        ++NumBound;
+
+        UInt32 Index = 0;
+        if (!FreeSlots.IsEmpty())
+        {
+            Index = FreeSlots.Back();
+            FreeSlots.PopBack();
+        }
+        else
+        {
+            // 广播期间预留在数组末尾之后的索引, 广播结束时再扩容
+            Index = static_cast<UInt32>(Slots.Size() + NumReservedSlots);
+            if (IsBroadcasting())
+            {
+                ++NumReservedSlots;
+            }
+            else
+            {
+                Slots.Emplace();
+            }
+        }
+
+        const UInt32 Generation = Index < Slots.Size() ? Slots[Index].Generation : 1;
+        if (IsBroadcasting())
+        {
+            PendingAdds.Add(FPendingAdd{Index, Generation, std::move(Delegate)});
+        }
+        else
+        {
+            Slots[Index].Function = std::move(Delegate);
+            Slots[Index].State    = ESlotState::Bound;
+        }
+        return MakeHandle(Index, Generation);
+    }
+
+    void ReleaseSlot(const UInt32 Index)
+    {
+        Slots[Index].Function.Clear();
+        Slots[Index].State = ESlotState::Free;
+        FreeSlots.Add(Index);
+    }
+
+    void ApplyPendingChanges()
+    {
+        if (bHasPendingRemoves)
+        {
+            for (size_t Index = 0; Index < Slots.Size(); ++Index)
+            {
+                if (Slots[Index].State == ESlotState::PendingRemove)
+                {
+                    ReleaseSlot(static_cast<UInt32>(Index));
+                }
+            }
+            bHasPendingRemoves = false;
+        }
+
+        Slots.Resize(Slots.Size() + NumReservedSlots);
+        NumReservedSlots = 0;
+        for (FPendingAdd& Pending : PendingAdds)
+        {
+            FSlot& Slot = Slots[Pending.Index];
+            if (Pending.Function.IsBound())
+            {
+                Slot.Function = std::move(Pending.Function);
+                Slot.State    = ESlotState::Bound;
+            }
+            else
+            {
+                // 广播期间添加后又被移除
+                ++Slot.Generation;
+                FreeSlots.Add(Pending.Index);
+            }
+        }
+        PendingAdds.Clear();
+    }
+
+    TArray<FSlot>       Slots;
+    TArray<UInt32>      FreeSlots;
+    TArray<FPendingAdd> PendingAdds;
+    size_t              NumReservedSlots   = 0;
+    size_t              NumBound           = 0;
+    bool                bHasPendingRemoves = false;
+    std::atomic<UInt32> BroadcastDepth{0};
+};
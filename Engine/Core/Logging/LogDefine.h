@@ -16,7 +16,8 @@
     HK_LOGCAT_ITEM(Serialize)                                                                                          \
     HK_LOGCAT_ITEM(Asset)                                                                                              \
     HK_LOGCAT_ITEM(Render)                                                                                             \
-    HK_LOGCAT_ITEM(Utility)
+    HK_LOGCAT_ITEM(Utility)                                                                                            \
+    HK_LOGCAT_ITEM(Memory)
 
 enum class ELogcat
 {
@@ -2,6 +2,7 @@
 
 #include "Core/Event/Event.h"
 #include "Core/Logging/LogDefine.h"
+#include "Core/String/StringBuilder.h"
 #include "Core/String/StringFormatter.h"
 #include "Core/Time/Time.h"
 #include <cstdio>
@@ -55,14 +56,11 @@ private:
     template <typename... Args>
     void Log(ELogLevel InLevel, ELogcat InLogcat, std::format_string<Args...> Fmt, Args&&... args)
     {
-        // 格式化消息
-        std::string Message = std::format(Fmt, std::forward<Args>(args)...);
-
-        // 创建日志内容
+        // 创建日志内容, 格式化的结果直接移动到 Message 中
         FLogContent LogContent;
         LogContent.Level = InLevel;
         LogContent.Logcat = InLogcat;
-        LogContent.Message = FString(Message);
+        LogContent.Message = FString(std::format(Fmt, std::forward<Args>(args)...));
         // 获取线程ID（转换为整数）
         auto ThreadID = std::this_thread::get_id();
         LogContent.ThreadID = static_cast<Int32>(std::hash<std::thread::id>{}(ThreadID));
@@ -71,9 +69,14 @@ private:
         // 先调用OnLog事件
         OnLog.Invoke(LogContent);
 
-        // 然后使用spdlog输出
-        const char* LogcatStr = GetLogcatString(InLogcat);
-        std::string FullMessage = std::format("[{}] {}", LogcatStr ? LogcatStr : "Unknown", Message);
+        // 然后使用spdlog输出, 带分类前缀的完整消息在线程临时内存中拼接
+        const char*    LogcatStr = GetLogcatString(InLogcat);
+        FStringBuilder Builder(LogContent.Message.Size() + 32);
+        Builder.Append('[');
+        Builder.Append(LogcatStr ? LogcatStr : "Unknown");
+        Builder.Append("] ");
+        Builder.Append(LogContent.Message);
+        const std::string_view FullMessage = Builder.GetStdStringView();
 
         switch (InLevel)
         {
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Core/Utility/Macros.h"
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+/**
+ * 容器使用的分配策略: 无状态, 提供静态的 Allocate(Size, Alignment) 与 Free(Ptr, Size, Alignment)
+ * 释放时传回分配时的大小与对齐, 分配器据此直接定位大小档位, 不需要在块前存放头部
+ */
+template <typename T>
+concept CAllocatorPolicy = requires(void* Ptr, size_t Size, size_t Alignment) {
+    { T::Allocate(Size, Alignment) } -> std::same_as<void*>;
+    { T::Free(Ptr, Size, Alignment) };
+};
+
+/**
+ * 默认分配策略, 直接使用全局 operator new / delete
+ */
+struct FHeapAllocatorPolicy
+{
+    static void* Allocate(const size_t Size, const size_t Alignment)
+    {
+        if (Alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        {
+            return ::operator new(Size, std::align_val_t(Alignment));
+        }
+        return ::operator new(Size);
+    }
+
+    static void Free(void* Ptr, const size_t Size, const size_t Alignment) noexcept
+    {
+        if (Alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        {
+            ::operator delete(Ptr, Size, std::align_val_t(Alignment));
+            return;
+        }
+        ::operator delete(Ptr, Size);
+    }
+};
+
+/**
+ * 把分配策略适配为标准库分配器, 供 std::vector 等标准容器使用
+ */
+template <typename T, CAllocatorPolicy AllocatorPolicy>
+class TStdAllocator
+{
+public:
+    using value_type                             = T;
+    using is_always_equal                        = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+
+    TStdAllocator() noexcept = default;
+
+    template <typename U>
+    TStdAllocator(const TStdAllocator<U, AllocatorPolicy>&) noexcept
+    {
+    }
+
+    T* allocate(const size_t Count)
+    {
+        return static_cast<T*>(AllocatorPolicy::Allocate(Count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* Ptr, const size_t Count) noexcept
+    {
+        AllocatorPolicy::Free(Ptr, Count * sizeof(T), alignof(T));
+    }
+
+    template <typename U>
+    bool operator==(const TStdAllocator<U, AllocatorPolicy>&) const noexcept
+    {
+        return true;
+    }
+};
+
+/**
+ * 默认策略直接使用 std::allocator, 保持与未指定分配器时完全相同的类型
+ */
+template <typename T, CAllocatorPolicy AllocatorPolicy>
+using TStdAllocatorFor = std::conditional_t<std::is_same_v<AllocatorPolicy, FHeapAllocatorPolicy>, std::allocator<T>,
+                                            TStdAllocator<T, AllocatorPolicy>>;
@@ -0,0 +1,99 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "LinearAllocator.h"
+
+#include "Core/Utility/Profiler.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+FLinearAllocator::FLinearAllocator(const size_t InChunkSize, const EMemoryTag InTag)
+    : ChunkSize(std::max(InChunkSize, sizeof(FChunk) * 2)), Tag(InTag)
+{
+}
+
+FLinearAllocator::~FLinearAllocator()
+{
+    FMemoryStats::RecordFree(Tag, static_cast<Int64>(UsedBytes));
+    FreeChunks(Chunks);
+}
+
+void* FLinearAllocator::Allocate(const size_t Size, const size_t Alignment)
+{
+    HK_ASSERT_MSG_RAW((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+    uintptr_t Aligned = (reinterpret_cast<uintptr_t>(Cursor) + Alignment - 1) & ~(Alignment - 1);
+    if (Cursor == nullptr || Aligned + Size > reinterpret_cast<uintptr_t>(End))
+    {
+        // 新块的起点只保证 max_align_t 对齐, 额外预留 Alignment 字节用于对齐
+        AllocateChunk(Size + Alignment);
+        Aligned = (reinterpret_cast<uintptr_t>(Cursor) + Alignment - 1) & ~(Alignment - 1);
+    }
+    Cursor = reinterpret_cast<char*>(Aligned + Size);
+    UsedBytes += Size;
+    FMemoryStats::RecordAlloc(Tag, static_cast<Int64>(Size));
+    return reinterpret_cast<void*>(Aligned);
+}
+
+void FLinearAllocator::Reset()
+{
+    FMemoryStats::RecordFree(Tag, static_cast<Int64>(UsedBytes));
+    UsedBytes = 0;
+    if (Chunks == nullptr)
+    {
+        return;
+    }
+    if (Chunks->Next != nullptr)
+    {
+        // 上一轮用到了多个块, 合并成一个块, 下一轮同样的用量不需要再追加
+        const size_t TotalSize = ReservedBytes;
+        FreeChunks(Chunks);
+        Chunks = nullptr;
+        AllocateChunk(TotalSize - sizeof(FChunk));
+        return;
+    }
+    Cursor = reinterpret_cast<char*>(Chunks + 1);
+}
+
+void FLinearAllocator::AllocateChunk(const size_t MinPayloadSize)
+{
+    const size_t Size   = std::max(ChunkSize, MinPayloadSize + sizeof(FChunk));
+    void*        Memory = std::malloc(Size);
+    if (Memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    HK_PROFILE_ALLOC_N(Memory, Size, GetMemoryTagName(Tag));
+    FMemoryStats::RecordReserve(Tag, static_cast<Int64>(Size));
+
+    FChunk* Chunk = static_cast<FChunk*>(Memory);
+    Chunk->Next   = Chunks;
+    Chunk->Size   = Size;
+    Chunks        = Chunk;
+    Cursor        = reinterpret_cast<char*>(Chunk + 1);
+    End           = static_cast<char*>(Memory) + Size;
+    ReservedBytes += Size;
+}
+
+void FLinearAllocator::FreeChunks(FChunk* Chunk)
+{
+    while (Chunk != nullptr)
+    {
+        FChunk* Next = Chunk->Next;
+        HK_PROFILE_FREE_N(Chunk, GetMemoryTagName(Tag));
+        FMemoryStats::RecordRelease(Tag, static_cast<Int64>(Chunk->Size));
+        ReservedBytes -= Chunk->Size;
+        std::free(Chunk);
+        Chunk = Next;
+    }
+    Cursor = nullptr;
+    End    = nullptr;
+}
+
+void FFrameAllocator::Reset()
+{
+    AutoLock Lock(Mutex);
+    Allocator.Reset();
+}
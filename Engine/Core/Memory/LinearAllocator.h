@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Core/Memory/MemoryStats.h"
+#include "Core/Singleton/Singleton.h"
+#include "Core/Utility/Macros.h"
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+constexpr size_t DEFAULT_LINEAR_ALLOCATOR_CHUNK_SIZE = 256 * 1024;
+
+/**
+ * 线性分配器, 非线程安全
+ * 分配只移动游标, 单独的释放是空操作, 调用 Reset 时一次性回收全部内存
+ * 当前块用完时追加新块; Reset 时若使用了多个块则合并为一个足够大的块, 之后的分配不再需要追加
+ */
+class HK_API FLinearAllocator
+{
+public:
+    /**
+     * @param InChunkSize 每次向系统申请的最小字节数
+     * @param InTag 统计用的分类
+     */
+    explicit FLinearAllocator(size_t InChunkSize = DEFAULT_LINEAR_ALLOCATOR_CHUNK_SIZE,
+                              EMemoryTag InTag   = EMemoryTag::Frame);
+    ~FLinearAllocator();
+
+    FLinearAllocator(const FLinearAllocator&)            = delete;
+    FLinearAllocator& operator=(const FLinearAllocator&) = delete;
+
+    /**
+     * @param Alignment 必须是 2 的幂
+     */
+    void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t));
+
+    /**
+     * 在分配的内存上构造对象, Reset 时不会调用析构函数, 因此只允许平凡析构的类型
+     */
+    template <typename T, typename... Args>
+        requires std::is_trivially_destructible_v<T>
+    T* New(Args&&... InArgs)
+    {
+        return ::new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(InArgs)...);
+    }
+
+    /**
+     * 回收全部分配, 之前返回的指针全部失效
+     */
+    void Reset();
+
+    size_t GetUsedBytes() const
+    {
+        return UsedBytes;
+    }
+
+    size_t GetReservedBytes() const
+    {
+        return ReservedBytes;
+    }
+
+private:
+    struct alignas(std::max_align_t) FChunk
+    {
+        FChunk* Next;
+        size_t  Size; // 包含块头
+    };
+
+    void AllocateChunk(size_t MinPayloadSize);
+    void FreeChunks(FChunk* Chunk);
+
+    FChunk*    Chunks        = nullptr; // 当前块在链表头部
+    char*      Cursor        = nullptr;
+    char*      End           = nullptr;
+    size_t     ChunkSize;
+    size_t     UsedBytes     = 0;
+    size_t     ReservedBytes = 0;
+    EMemoryTag Tag;
+};
+
+/**
+ * 每帧的临时内存, 在 FEngineLoop::PostTick 结束时重置
+ * 分配加锁, Game 线程与同一帧内的工作线程任务都可以使用;
+ * 内存只在当前帧有效, 不能交给 Render 线程或跨帧保存
+ */
+class HK_API FFrameAllocator : public TSingleton<FFrameAllocator>
+{
+public:
+    void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t))
+    {
+        AutoLock Lock(Mutex);
+        return Allocator.Allocate(Size, Alignment);
+    }
+
+    template <typename T, typename... Args>
+        requires std::is_trivially_destructible_v<T>
+    T* New(Args&&... InArgs)
+    {
+        return ::new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(InArgs)...);
+    }
+
+    void Reset();
+
+private:
+    FMutex           Mutex;
+    FLinearAllocator Allocator;
+};
+
+/**
+ * 使用 FFrameAllocator 的容器分配策略, 释放为空操作, 容器本身也必须在帧结束前销毁
+ */
+struct FFrameAllocatorPolicy
+{
+    static void* Allocate(const size_t Size, const size_t Alignment)
+    {
+        return FFrameAllocator::GetRef().Allocate(Size, Alignment);
+    }
+
+    static void Free(void*, size_t, size_t) noexcept {}
+};
@@ -0,0 +1,189 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "MemoryBudget.h"
+
+#include "Core/Logging/Logger.h"
+#include "Core/Utility/FileUtility.h"
+#include "Core/Utility/Profiler.h"
+
+namespace
+{
+constexpr double BytesPerMegabyte = 1024.0 * 1024.0;
+
+double ToMegabytes(const Int64 InBytes)
+{
+    return static_cast<double>(InBytes) / BytesPerMegabyte;
+}
+} // namespace
+
+void FMemoryBudget::ShutDown()
+{
+    StopCsvExport();
+}
+
+void FMemoryBudget::SetBudget(const EMemoryTag InTag, const EMemoryDomain InDomain, const Int64 InBytes)
+{
+    AutoLock Lock(Mutex);
+    const auto Index = Budgets.FindByPredicate(
+        [InTag, InDomain](const FBudget& Budget) { return Budget.Tag == InTag && Budget.Domain == InDomain; });
+    if (Index == static_cast<size_t>(-1))
+    {
+        if (InBytes > 0)
+        {
+            Budgets.Add(FBudget{InTag, InDomain, InBytes});
+        }
+        return;
+    }
+    if (InBytes > 0)
+    {
+        Budgets[Index].Bytes = InBytes;
+    }
+    else
+    {
+        Budgets.RemoveAt(Index);
+    }
+}
+
+Int64 FMemoryBudget::GetBudget(const EMemoryTag InTag, const EMemoryDomain InDomain) const
+{
+    AutoLock Lock(Mutex);
+    for (const FBudget& Budget : Budgets)
+    {
+        if (Budget.Tag == InTag && Budget.Domain == InDomain)
+        {
+            return Budget.Bytes;
+        }
+    }
+    return 0;
+}
+
+FMemoryBudget::Handle FMemoryBudget::AddEvictionHandler(const EMemoryTag InTag, const EMemoryDomain InDomain,
+                                                        FMemoryEvictionDelegate&& InHandler, const Int32 InPriority)
+{
+    AutoLock     Lock(Mutex);
+    const Handle ID = NextHandle++;
+    Handlers.Add(FEvictionHandler{ID, InTag, InDomain, InPriority, std::move(InHandler)});
+    // 同优先级按注册顺序调用
+    Handlers.Sort([](const FEvictionHandler& A, const FEvictionHandler& B) {
+        return A.Priority != B.Priority ? A.Priority < B.Priority : A.ID < B.ID;
+    });
+    return ID;
+}
+
+bool FMemoryBudget::RemoveEvictionHandler(const Handle InHandle)
+{
+    AutoLock Lock(Mutex);
+    return Handlers.RemoveByPredicate([InHandle](const FEvictionHandler& Handler) { return Handler.ID == InHandle; });
+}
+
+bool FMemoryBudget::StartCsvExport(const FStringView InPath, const double InIntervalSeconds)
+{
+    AutoLock Lock(Mutex);
+    if (CsvStream.is_open())
+    {
+        CsvStream.close();
+    }
+    FFileUtility::EnsureFileDirectoryExists(InPath);
+    CsvStream.open(InPath.GetStdString(), std::ios::out | std::ios::trunc);
+    if (!CsvStream.is_open())
+    {
+        HK_LOG_ERROR(ELogcat::Memory, "Failed to open memory CSV file: {}", InPath);
+        return false;
+    }
+    CsvInterval  = InIntervalSeconds;
+    CsvStartTime = FTimePoint::Now();
+    LastCsvTime  = CsvStartTime;
+    WriteCsvHeader();
+    return true;
+}
+
+void FMemoryBudget::StopCsvExport()
+{
+    AutoLock Lock(Mutex);
+    if (CsvStream.is_open())
+    {
+        CsvStream.close();
+    }
+}
+
+void FMemoryBudget::Tick()
+{
+    HK_PROFILE_SCOPE_N("FMemoryBudget::Tick");
+
+    AutoLock Lock(Mutex);
+    ++FrameIndex;
+    for (FBudget& Budget : Budgets)
+    {
+        EnforceBudget(Budget);
+    }
+
+    if (CsvStream.is_open())
+    {
+        const FTimePoint Now = FTimePoint::Now();
+        if ((Now - LastCsvTime).AsDouble<FSeconds>() >= CsvInterval)
+        {
+            LastCsvTime = Now;
+            WriteCsvRow();
+        }
+    }
+}
+
+void FMemoryBudget::EnforceBudget(FBudget& Budget)
+{
+    Int64 Used = FMemoryStats::GetTagStats(Budget.Tag, Budget.Domain).UsedBytes;
+    if (Used > Budget.Bytes)
+    {
+        for (FEvictionHandler& Handler : Handlers)
+        {
+            if (Handler.Domain != Budget.Domain || !IsMemoryTagUnder(Handler.Tag, Budget.Tag))
+            {
+                continue;
+            }
+            const Int64 Freed = Handler.Delegate.Invoke(Used - Budget.Bytes);
+            Used              = FMemoryStats::GetTagStats(Budget.Tag, Budget.Domain).UsedBytes;
+            HK_LOG_DEBUG(ELogcat::Memory, "Evicted {:.2f} MB from {} ({})", ToMegabytes(Freed),
+                         GetMemoryTagName(Handler.Tag), GetMemoryDomainName(Budget.Domain));
+            if (Used <= Budget.Bytes)
+            {
+                break;
+            }
+        }
+    }
+
+    const bool bOverBudget = Used > Budget.Bytes;
+    if (bOverBudget && !Budget.bOverBudget)
+    {
+        HK_LOG_WARN(ELogcat::Memory, "{} ({}) is over budget: {:.2f} MB / {:.2f} MB", GetMemoryTagName(Budget.Tag),
+                    GetMemoryDomainName(Budget.Domain), ToMegabytes(Used), ToMegabytes(Budget.Bytes));
+    }
+    Budget.bOverBudget = bOverBudget;
+}
+
+void FMemoryBudget::WriteCsvHeader()
+{
+    CsvStream << "Time,Frame";
+    for (size_t Index = 0; Index < static_cast<size_t>(EMemoryTag::Count); ++Index)
+    {
+        const char* Name = GetMemoryTagName(static_cast<EMemoryTag>(Index));
+        CsvStream << ',' << Name << " Cpu," << Name << " Cpu FramePeak," << Name << " Gpu," << Name << " Gpu FramePeak";
+    }
+    CsvStream << '\n';
+}
+
+void FMemoryBudget::WriteCsvRow()
+{
+    CsvStream << (LastCsvTime - CsvStartTime).AsDouble<FSeconds>() << ',' << FrameIndex;
+    for (size_t Index = 0; Index < static_cast<size_t>(EMemoryTag::Count); ++Index)
+    {
+        const auto            Tag = static_cast<EMemoryTag>(Index);
+        const FMemoryTagStats Cpu = FMemoryStats::GetTagStats(Tag, EMemoryDomain::Cpu);
+        const FMemoryTagStats Gpu = FMemoryStats::GetTagStats(Tag, EMemoryDomain::Gpu);
+        CsvStream << ',' << Cpu.UsedBytes << ',' << Cpu.FramePeakBytes << ',' << Gpu.UsedBytes << ','
+                  << Gpu.FramePeakBytes;
+    }
+    CsvStream << '\n';
+    // 程序异常退出时也能保留已经写入的采样
+    CsvStream.flush();
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Core/Container/Array.h"
+#include "Core/Event/Delegate.h"
+#include "Core/Memory/MemoryStats.h"
+#include "Core/Singleton/Singleton.h"
+#include "Core/String/String.h"
+#include "Core/Time/Time.h"
+#include "Core/Utility/Macros.h"
+#include <fstream>
+
+/**
+ * 回收函数, 参数为需要回收的字节数, 返回实际回收的字节数（只用于日志, 是否回到预算内以统计为准）
+ */
+using FMemoryEvictionDelegate = TDelegate<Int64, Int64>;
+
+/**
+ * 按分类设置内存预算, 超出时调用注册的回收函数, 并定期把各分类的用量导出为 CSV
+ * 每帧在 FEngineLoop::PostTick 中由 Game 线程调用 Tick 检查, 回收函数也在 Game 线程执行
+ */
+class HK_API FMemoryBudget : public TSingleton<FMemoryBudget>
+{
+public:
+    using Handle = UInt64;
+
+    void ShutDown() override;
+
+    /**
+     * @param InBytes 预算字节数, 0 表示不限制; 预算按包含子分类的用量计算
+     */
+    void  SetBudget(EMemoryTag InTag, EMemoryDomain InDomain, Int64 InBytes);
+    Int64 GetBudget(EMemoryTag InTag, EMemoryDomain InDomain) const;
+
+    /**
+     * 注册回收函数, 分类 InTag 或其任意父分类超出预算时被调用
+     * 同一预算下按 Priority 从小到大依次调用, 回到预算内后停止
+     * 回收函数在持有 FMemoryBudget 内部锁时调用, 其中不能再调用 FMemoryBudget 的接口
+     * @return 用于 RemoveEvictionHandler 的句柄
+     */
+    Handle AddEvictionHandler(EMemoryTag InTag, EMemoryDomain InDomain, FMemoryEvictionDelegate&& InHandler,
+                              Int32 InPriority = 0);
+    bool   RemoveEvictionHandler(Handle InHandle);
+
+    /**
+     * 开始把各分类的用量定期追加到 CSV 文件, 每行为一次采样, 列为每个分类在 CPU / GPU 上的当前用量与帧内峰值
+     * @param InIntervalSeconds 采样间隔, 0 表示每帧采样
+     */
+    bool StartCsvExport(FStringView InPath, double InIntervalSeconds = 1.0);
+    void StopCsvExport();
+
+    /**
+     * 检查预算并按间隔导出 CSV, 在帧内存重置与 FMemoryStats::EndFrame 之前调用, 导出的峰值覆盖整帧
+     */
+    void Tick();
+
+private:
+    struct FBudget
+    {
+        EMemoryTag    Tag;
+        EMemoryDomain Domain;
+        Int64         Bytes;
+        bool          bOverBudget = false; // 上一次检查时仍超出预算, 只在进入超出状态时输出警告
+    };
+
+    struct FEvictionHandler
+    {
+        Handle                  ID;
+        EMemoryTag              Tag;
+        EMemoryDomain           Domain;
+        Int32                   Priority;
+        FMemoryEvictionDelegate Delegate;
+    };
+
+    void EnforceBudget(FBudget& Budget);
+    void WriteCsvHeader();
+    void WriteCsvRow();
+
+    mutable FMutex           Mutex;
+    TArray<FBudget>          Budgets;
+    TArray<FEvictionHandler> Handlers; // 按 Priority 排序
+    Handle                   NextHandle = 1;
+
+    std::ofstream CsvStream;
+    double        CsvInterval = 1.0;
+    FTimePoint    CsvStartTime;
+    FTimePoint    LastCsvTime;
+    UInt64        FrameIndex = 0;
+};
@@ -0,0 +1,157 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "MemoryStats.h"
+
+#include "Core/Utility/Profiler.h"
+#include <atomic>
+
+namespace
+{
+// 每个分类独占缓存行, 不同分类的计数互不干扰
+struct alignas(64) FAtomicTagStats
+{
+    std::atomic<Int64> UsedBytes{0};
+    std::atomic<Int64> PeakUsedBytes{0};
+    std::atomic<Int64> FramePeakBytes{0};
+    std::atomic<Int64> ReservedBytes{0};
+    std::atomic<Int64> AllocCount{0};
+};
+
+constexpr size_t DomainCount = static_cast<size_t>(EMemoryDomain::Count);
+constexpr size_t TagCount    = static_cast<size_t>(EMemoryTag::Count);
+
+FAtomicTagStats GTagStats[DomainCount][TagCount];
+
+thread_local EMemoryTag GScopeTag = EMemoryTag::Untagged;
+
+FAtomicTagStats& GetAtomicStats(const EMemoryTag InTag, const EMemoryDomain InDomain = EMemoryDomain::Cpu)
+{
+    return GTagStats[static_cast<size_t>(InDomain)][static_cast<size_t>(InTag)];
+}
+
+void UpdatePeak(std::atomic<Int64>& Peak, const Int64 Used)
+{
+    Int64 Current = Peak.load(std::memory_order_relaxed);
+    while (Used > Current && !Peak.compare_exchange_weak(Current, Used, std::memory_order_relaxed))
+    {
+    }
+}
+
+// 对分类及其所有父分类执行 Func, 层级很浅, 最多两三次原子操作
+template <typename FuncType>
+void ForEachAncestor(EMemoryTag InTag, const EMemoryDomain InDomain, FuncType&& Func)
+{
+    while (true)
+    {
+        Func(GetAtomicStats(InTag, InDomain));
+        const EMemoryTag Parent = GetMemoryTagParent(InTag);
+        if (Parent == InTag)
+        {
+            return;
+        }
+        InTag = Parent;
+    }
+}
+
+void RecordAllocImpl(const EMemoryTag InTag, const EMemoryDomain InDomain, const Int64 InBytes, const Int64 InCount)
+{
+    ForEachAncestor(InTag, InDomain, [InBytes, InCount](FAtomicTagStats& Stats) {
+        const Int64 Used = Stats.UsedBytes.fetch_add(InBytes, std::memory_order_relaxed) + InBytes;
+        Stats.AllocCount.fetch_add(InCount, std::memory_order_relaxed);
+        UpdatePeak(Stats.PeakUsedBytes, Used);
+        UpdatePeak(Stats.FramePeakBytes, Used);
+    });
+}
+
+void RecordFreeImpl(const EMemoryTag InTag, const EMemoryDomain InDomain, const Int64 InBytes)
+{
+    ForEachAncestor(InTag, InDomain, [InBytes](FAtomicTagStats& Stats) {
+        Stats.UsedBytes.fetch_sub(InBytes, std::memory_order_relaxed);
+    });
+}
+} // namespace
+
+void FMemoryStats::RecordAlloc(const EMemoryTag InTag, const Int64 InBytes, const Int64 InCount)
+{
+    RecordAllocImpl(InTag, EMemoryDomain::Cpu, InBytes, InCount);
+}
+
+void FMemoryStats::RecordFree(const EMemoryTag InTag, const Int64 InBytes)
+{
+    RecordFreeImpl(InTag, EMemoryDomain::Cpu, InBytes);
+}
+
+void FMemoryStats::RecordReserve(const EMemoryTag InTag, const Int64 InBytes)
+{
+    ForEachAncestor(InTag, EMemoryDomain::Cpu, [InBytes](FAtomicTagStats& Stats) {
+        Stats.ReservedBytes.fetch_add(InBytes, std::memory_order_relaxed);
+    });
+}
+
+void FMemoryStats::RecordRelease(const EMemoryTag InTag, const Int64 InBytes)
+{
+    ForEachAncestor(InTag, EMemoryDomain::Cpu, [InBytes](FAtomicTagStats& Stats) {
+        Stats.ReservedBytes.fetch_sub(InBytes, std::memory_order_relaxed);
+    });
+}
+
+void FMemoryStats::RecordGpuAlloc(const EMemoryTag InTag, const Int64 InBytes)
+{
+    RecordAllocImpl(InTag, EMemoryDomain::Gpu, InBytes, 1);
+}
+
+void FMemoryStats::RecordGpuFree(const EMemoryTag InTag, const Int64 InBytes)
+{
+    RecordFreeImpl(InTag, EMemoryDomain::Gpu, InBytes);
+}
+
+FMemoryTagStats FMemoryStats::GetTagStats(const EMemoryTag InTag, const EMemoryDomain InDomain)
+{
+    const FAtomicTagStats& Stats = GetAtomicStats(InTag, InDomain);
+    FMemoryTagStats        Result;
+    Result.UsedBytes      = Stats.UsedBytes.load(std::memory_order_relaxed);
+    Result.PeakUsedBytes  = Stats.PeakUsedBytes.load(std::memory_order_relaxed);
+    Result.FramePeakBytes = Stats.FramePeakBytes.load(std::memory_order_relaxed);
+    Result.ReservedBytes  = Stats.ReservedBytes.load(std::memory_order_relaxed);
+    Result.AllocCount     = Stats.AllocCount.load(std::memory_order_relaxed);
+    return Result;
+}
+
+EMemoryTag FMemoryStats::GetScopeTag(const EMemoryTag InDefault)
+{
+    return GScopeTag == EMemoryTag::Untagged ? InDefault : GScopeTag;
+}
+
+void FMemoryStats::ReportToProfiler()
+{
+    // Tracy 的曲线名必须是常量字符串, 因此按分类列表展开
+#define HK_MEMORY_TAG_ITEM(name, parent)                                                                               \
+    HK_PROFILE_PLOT("Memory/" #name " Used", GetAtomicStats(EMemoryTag::name).UsedBytes.load());                       \
+    HK_PROFILE_PLOT("Memory/" #name " Reserved", GetAtomicStats(EMemoryTag::name).ReservedBytes.load());               \
+    HK_PROFILE_PLOT("Memory/" #name " Gpu", GetAtomicStats(EMemoryTag::name, EMemoryDomain::Gpu).UsedBytes.load());
+    HK_MEMORY_TAG_LIST
+#undef HK_MEMORY_TAG_ITEM
+}
+
+void FMemoryStats::EndFrame()
+{
+    for (auto& DomainStats : GTagStats)
+    {
+        for (FAtomicTagStats& Stats : DomainStats)
+        {
+            Stats.FramePeakBytes.store(Stats.UsedBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+}
+
+FMemoryScope::FMemoryScope(const EMemoryTag InTag) : PreviousTag(GScopeTag)
+{
+    GScopeTag = InTag;
+}
+
+FMemoryScope::~FMemoryScope()
+{
+    GScopeTag = PreviousTag;
+}
@@ -0,0 +1,234 @@
+#pragma once
+
+#include "Core/Utility/Macros.h"
+
+/**
+ * 分类列表, HK_MEMORY_TAG_ITEM(Name, Parent), Parent 与 Name 相同时为顶层分类
+ * 父分类的统计包含所有子分类, 子分类必须写在父分类之后
+ */
+#define HK_MEMORY_TAG_LIST                                                                                             \
+    HK_MEMORY_TAG_ITEM(Untagged, Untagged)                                                                             \
+    HK_MEMORY_TAG_ITEM(Container, Container)                                                                           \
+    HK_MEMORY_TAG_ITEM(Object, Object)                                                                                 \
+    HK_MEMORY_TAG_ITEM(ObjectArray, Object)                                                                            \
+    HK_MEMORY_TAG_ITEM(Frame, Frame)                                                                                   \
+    HK_MEMORY_TAG_ITEM(String, String)                                                                                 \
+    HK_MEMORY_TAG_ITEM(NameTable, String)                                                                              \
+    HK_MEMORY_TAG_ITEM(Asset, Asset)                                                                                   \
+    HK_MEMORY_TAG_ITEM(AssetMetadata, Asset)                                                                           \
+    HK_MEMORY_TAG_ITEM(MeshAsset, Asset)                                                                               \
+    HK_MEMORY_TAG_ITEM(TextureAsset, Asset)                                                                            \
+    HK_MEMORY_TAG_ITEM(ShaderAsset, Asset)                                                                             \
+    HK_MEMORY_TAG_ITEM(Render, Render)                                                                                 \
+    HK_MEMORY_TAG_ITEM(StagingBuffer, Render)                                                                          \
+    HK_MEMORY_TAG_ITEM(RenderTarget, Render)
+
+/**
+ * 内存分类, 自定义分配器按分类统计用量, 并在 Tracy 中以同名内存池和曲线展示
+ */
+enum class EMemoryTag : UInt8
+{
+#define HK_MEMORY_TAG_ITEM(name, parent) name,
+    HK_MEMORY_TAG_LIST
+#undef HK_MEMORY_TAG_ITEM
+    Count,
+};
+
+/**
+ * 内存所在的位置, 同一个分类在 CPU 与 GPU 上分别统计与设置预算
+ */
+enum class EMemoryDomain : UInt8
+{
+    Cpu,
+    Gpu,
+    Count,
+};
+
+inline const char* GetMemoryTagName(const EMemoryTag InTag)
+{
+#define HK_MEMORY_TAG_ITEM(name, parent)                                                                               \
+    case EMemoryTag::name:                                                                                             \
+        return #name;
+    switch (InTag)
+    {
+        HK_MEMORY_TAG_LIST
+    default:
+        break;
+    }
+#undef HK_MEMORY_TAG_ITEM
+    return "Unknown";
+}
+
+inline const char* GetMemoryDomainName(const EMemoryDomain InDomain)
+{
+    return InDomain == EMemoryDomain::Gpu ? "Gpu" : "Cpu";
+}
+
+/**
+ * @return 父分类, 顶层分类返回自身
+ */
+constexpr EMemoryTag GetMemoryTagParent(const EMemoryTag InTag)
+{
+    constexpr EMemoryTag Parents[] = {
+#define HK_MEMORY_TAG_ITEM(name, parent) EMemoryTag::parent,
+        HK_MEMORY_TAG_LIST
+#undef HK_MEMORY_TAG_ITEM
+    };
+    return Parents[static_cast<size_t>(InTag)];
+}
+
+/**
+ * @return InTag 是否为 InAncestor 本身或其子分类
+ */
+constexpr bool IsMemoryTagUnder(EMemoryTag InTag, const EMemoryTag InAncestor)
+{
+    while (InTag != InAncestor)
+    {
+        const EMemoryTag Parent = GetMemoryTagParent(InTag);
+        if (Parent == InTag)
+        {
+            return false;
+        }
+        InTag = Parent;
+    }
+    return true;
+}
+
+struct FMemoryTagStats
+{
+    Int64 UsedBytes      = 0; // 已分配给使用者的字节数
+    Int64 PeakUsedBytes  = 0; // UsedBytes 的历史峰值
+    Int64 FramePeakBytes = 0; // 当前帧内 UsedBytes 的峰值, 每帧在 EndFrame 时重置为当前用量
+    Int64 ReservedBytes  = 0; // 分配器向系统申请的字节数, 包含空闲块与尚未切分的页
+    Int64 AllocCount     = 0; // 累计分配次数
+};
+
+/**
+ * 按 EMemoryTag 与 EMemoryDomain 统计的全局内存用量, 所有接口线程安全
+ * 计数使用 relaxed 原子操作, 并发修改时读取到的只是近似值
+ * 记录时同时累加到所有父分类, 读取到的统计值包含子分类
+ */
+class HK_API FMemoryStats
+{
+public:
+    /**
+     * @param InBytes 可以为负, 线程缓存用它一次提交一批分配与释放的净变化
+     * @param InCount 计入的分配次数
+     */
+    static void RecordAlloc(EMemoryTag InTag, Int64 InBytes, Int64 InCount = 1);
+    static void RecordFree(EMemoryTag InTag, Int64 InBytes);
+    static void RecordReserve(EMemoryTag InTag, Int64 InBytes);
+    static void RecordRelease(EMemoryTag InTag, Int64 InBytes);
+
+    // 显存, 由 FGfxDevice 在创建与销毁 Buffer / Image 时记录
+    static void RecordGpuAlloc(EMemoryTag InTag, Int64 InBytes);
+    static void RecordGpuFree(EMemoryTag InTag, Int64 InBytes);
+
+    static FMemoryTagStats GetTagStats(EMemoryTag InTag, EMemoryDomain InDomain = EMemoryDomain::Cpu);
+
+    /**
+     * 当前线程所在的 FMemoryScope 的分类, 不在任何作用域中时返回 InDefault
+     */
+    static EMemoryTag GetScopeTag(EMemoryTag InDefault = EMemoryTag::Untagged);
+
+    /**
+     * 将各分类的用量绘制到性能分析器, 每帧在 FEngineLoop::PostTick 调用
+     */
+    static void ReportToProfiler();
+
+    /**
+     * 结束当前帧的峰值统计, 在 FEngineLoop::PostTick 的最后调用
+     */
+    static void EndFrame();
+};
+
+/**
+ * 分类作用域, 作用域内没有显式指定分类的分配记入 InTag, 可以嵌套, 只影响当前线程
+ * 目前 FGfxDevice::CreateBuffer / CreateImage 按作用域记录显存
+ */
+class HK_API FMemoryScope
+{
+public:
+    explicit FMemoryScope(EMemoryTag InTag);
+    ~FMemoryScope();
+
+    FMemoryScope(const FMemoryScope&)            = delete;
+    FMemoryScope& operator=(const FMemoryScope&) = delete;
+
+private:
+    EMemoryTag PreviousTag;
+};
+
+#define HK_MEMORY_SCOPE_IMPL(Tag, Line) FMemoryScope HKMemoryScope_##Line(Tag)
+#define HK_MEMORY_SCOPE_EXPAND(Tag, Line) HK_MEMORY_SCOPE_IMPL(Tag, Line)
+#define HK_MEMORY_SCOPE(Tag) HK_MEMORY_SCOPE_EXPAND(Tag, __LINE__)
+
+/**
+ * 把不经过自定义分配器的内存记入某个分类, 析构时释放, 只能移动
+ * 例如资产加载期间的中间数据, 其大小在读取文件后才知道
+ */
+class FMemoryCharge
+{
+public:
+    FMemoryCharge() = default;
+    FMemoryCharge(const EMemoryTag InTag, const Int64 InBytes, const EMemoryDomain InDomain = EMemoryDomain::Cpu)
+        : Tag(InTag), Domain(InDomain)
+    {
+        Resize(InBytes);
+    }
+    ~FMemoryCharge()
+    {
+        Resize(0);
+    }
+
+    FMemoryCharge(const FMemoryCharge&)            = delete;
+    FMemoryCharge& operator=(const FMemoryCharge&) = delete;
+
+    FMemoryCharge(FMemoryCharge&& Other) noexcept : Tag(Other.Tag), Domain(Other.Domain), Bytes(Other.Bytes)
+    {
+        Other.Bytes = 0;
+    }
+    FMemoryCharge& operator=(FMemoryCharge&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Resize(0);
+            Tag         = Other.Tag;
+            Domain      = Other.Domain;
+            Bytes       = Other.Bytes;
+            Other.Bytes = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * 修改记入的字节数, 只记录与之前的差值
+     */
+    void Resize(const Int64 InBytes)
+    {
+        const Int64 Delta = InBytes - Bytes;
+        if (Delta == 0)
+        {
+            return;
+        }
+        Bytes = InBytes;
+        if (Domain == EMemoryDomain::Gpu)
+        {
+            Delta > 0 ? FMemoryStats::RecordGpuAlloc(Tag, Delta) : FMemoryStats::RecordGpuFree(Tag, -Delta);
+        }
+        else
+        {
+            Delta > 0 ? FMemoryStats::RecordAlloc(Tag, Delta) : FMemoryStats::RecordFree(Tag, -Delta);
+        }
+    }
+
+    Int64 GetBytes() const
+    {
+        return Bytes;
+    }
+
+private:
+    EMemoryTag    Tag    = EMemoryTag::Untagged;
+    EMemoryDomain Domain = EMemoryDomain::Cpu;
+    Int64         Bytes  = 0;
+};
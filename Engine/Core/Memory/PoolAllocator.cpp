@@ -0,0 +1,167 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "PoolAllocator.h"
+
+#include "Core/Utility/Profiler.h"
+#include <algorithm>
+#include <cstdlib>
+
+FFixedSizePool::FFixedSizePool(const size_t InBlockSize, const EMemoryTag InTag, const size_t InPageSize)
+    : BlockSize((std::max<size_t>(InBlockSize, 1) + HKMemoryImpl::BlockAlignment - 1) &
+                ~(HKMemoryImpl::BlockAlignment - 1)),
+      PageSize(std::max(InPageSize, sizeof(FPage) + BlockSize)), Tag(InTag)
+{
+}
+
+FFixedSizePool::~FFixedSizePool()
+{
+    while (Pages != nullptr)
+    {
+        FPage* Next = Pages->Next;
+        std::free(Pages);
+        FMemoryStats::RecordRelease(Tag, static_cast<Int64>(PageSize));
+        Pages = Next;
+    }
+}
+
+void* FFixedSizePool::Allocate()
+{
+    AutoLock Lock(Mutex);
+    return AllocateUnlocked();
+}
+
+void FFixedSizePool::Free(void* Block)
+{
+    if (Block == nullptr)
+    {
+        return;
+    }
+    FFreeBlock* FreeBlock = static_cast<FFreeBlock*>(Block);
+    FreeBatch(FreeBlock, FreeBlock, 1);
+}
+
+FFixedSizePool::FFreeBlock* FFixedSizePool::AllocateBatch(const UInt32 Count)
+{
+    FFreeBlock* Head = nullptr;
+    AutoLock    Lock(Mutex);
+    for (UInt32 Index = 0; Index < Count; ++Index)
+    {
+        FFreeBlock* Block = AllocateUnlocked();
+        Block->Next       = Head;
+        Head              = Block;
+    }
+    return Head;
+}
+
+void FFixedSizePool::FreeBatch(FFreeBlock* Head, FFreeBlock* Tail, const UInt32 Count)
+{
+    AutoLock Lock(Mutex);
+    Tail->Next = FreeList;
+    FreeList   = Head;
+    NumUsed -= Count;
+}
+
+size_t FFixedSizePool::GetUsedBlockCount() const
+{
+    AutoLock Lock(Mutex);
+    return NumUsed;
+}
+
+FFixedSizePool::FFreeBlock* FFixedSizePool::AllocateUnlocked()
+{
+    ++NumUsed;
+    if (FreeList != nullptr)
+    {
+        FFreeBlock* Block = FreeList;
+        FreeList          = Block->Next;
+        return Block;
+    }
+    if (static_cast<size_t>(End - Cursor) < BlockSize)
+    {
+        AllocatePage();
+    }
+    FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Cursor);
+    Cursor += BlockSize;
+    return Block;
+}
+
+void FFixedSizePool::AllocatePage()
+{
+    // malloc 返回的地址满足 max_align_t, 块从页头之后开始, 保持 BlockAlignment 对齐
+    void* Memory = std::malloc(PageSize);
+    if (Memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    FMemoryStats::RecordReserve(Tag, static_cast<Int64>(PageSize));
+
+    FPage* Page = static_cast<FPage*>(Memory);
+    Page->Next  = Pages;
+    Pages       = Page;
+    Cursor      = static_cast<char*>(Memory) + sizeof(FPage);
+    End         = Cursor + (PageSize - sizeof(FPage)) / BlockSize * BlockSize;
+}
+
+FObjectPoolAllocator::FObjectPoolAllocator(const EMemoryTag InTag) : Tag(InTag)
+{
+    for (UInt32 Index = 0; Index < HKMemoryImpl::SizeClassCount; ++Index)
+    {
+        Pools[Index] = std::make_unique<FFixedSizePool>(HKMemoryImpl::GetSizeClassSize(Index), InTag);
+    }
+}
+
+FObjectPoolAllocator::~FObjectPoolAllocator() = default;
+
+void* FObjectPoolAllocator::Allocate(const size_t Size, const size_t Alignment)
+{
+    const size_t BlockSize = Size + sizeof(FBlockHeader);
+    if (Alignment <= HKMemoryImpl::BlockAlignment && BlockSize <= HKMemoryImpl::MaxSmallBlockSize)
+    {
+        const UInt32  SizeClass = HKMemoryImpl::GetSizeClassIndex(BlockSize);
+        FBlockHeader* Header    = static_cast<FBlockHeader*>(Pools[SizeClass]->Allocate());
+        Header->SizeClass       = SizeClass;
+        Header->Offset          = static_cast<UInt32>(sizeof(FBlockHeader));
+        Header->Size            = Size;
+        FMemoryStats::RecordAlloc(Tag, static_cast<Int64>(HKMemoryImpl::GetSizeClassSize(SizeClass)));
+        HK_PROFILE_ALLOC_N(Header + 1, Size, GetMemoryTagName(Tag));
+        return Header + 1;
+    }
+
+    // 偏移同时也是分配的对齐, 对象放在偏移处, 头部紧挨在对象之前
+    const size_t  Offset = std::max(Alignment, sizeof(FBlockHeader));
+    char*         Memory = static_cast<char*>(::operator new(Size + Offset, std::align_val_t(Offset)));
+    FBlockHeader* Header = reinterpret_cast<FBlockHeader*>(Memory + Offset) - 1;
+    Header->SizeClass    = LargeSizeClass;
+    Header->Offset       = static_cast<UInt32>(Offset);
+    Header->Size         = Size;
+    FMemoryStats::RecordReserve(Tag, static_cast<Int64>(Size + Offset));
+    FMemoryStats::RecordAlloc(Tag, static_cast<Int64>(Size + Offset));
+    HK_PROFILE_ALLOC_N(Memory + Offset, Size, GetMemoryTagName(Tag));
+    return Memory + Offset;
+}
+
+void FObjectPoolAllocator::Free(void* Ptr)
+{
+    if (Ptr == nullptr)
+    {
+        return;
+    }
+    HK_PROFILE_FREE_N(Ptr, GetMemoryTagName(Tag));
+
+    FBlockHeader* Header = static_cast<FBlockHeader*>(Ptr) - 1;
+    if (Header->SizeClass != LargeSizeClass)
+    {
+        FMemoryStats::RecordFree(Tag, static_cast<Int64>(HKMemoryImpl::GetSizeClassSize(Header->SizeClass)));
+        Pools[Header->SizeClass]->Free(Header);
+        return;
+    }
+
+    const size_t Offset = Header->Offset;
+    const size_t Size   = Header->Size;
+    FMemoryStats::RecordFree(Tag, static_cast<Int64>(Size + Offset));
+    FMemoryStats::RecordRelease(Tag, static_cast<Int64>(Size + Offset));
+    char* Memory = static_cast<char*>(Ptr) - Offset;
+    ::operator delete(Memory, std::align_val_t(Offset));
+}
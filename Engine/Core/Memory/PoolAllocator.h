@@ -0,0 +1,178 @@
+#pragma once
+
+#include "Core/Memory/MemoryStats.h"
+#include "Core/Utility/Macros.h"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace HKMemoryImpl
+{
+// 池中块的对齐, 同时也是最小的块大小
+constexpr size_t BlockAlignment = 16;
+// 超过此大小的分配不走池
+constexpr size_t MaxSmallBlockSize = 4096;
+// 16..256 步长 16, 320..1024 步长 64, 1280..4096 步长 256
+constexpr UInt32 SizeClassCount = 40;
+
+/**
+ * 大小到档位的映射, 每档的内部浪费不超过 25%
+ * @param Size 必须在 [1, MaxSmallBlockSize] 之间
+ */
+constexpr UInt32 GetSizeClassIndex(const size_t Size) noexcept
+{
+    if (Size <= 256)
+    {
+        return static_cast<UInt32>((Size + 15) / 16) - 1;
+    }
+    if (Size <= 1024)
+    {
+        return 16 + static_cast<UInt32>((Size - 256 + 63) / 64) - 1;
+    }
+    return 28 + static_cast<UInt32>((Size - 1024 + 255) / 256) - 1;
+}
+
+constexpr size_t GetSizeClassSize(const UInt32 Index) noexcept
+{
+    if (Index < 16)
+    {
+        return (Index + 1) * 16;
+    }
+    if (Index < 28)
+    {
+        return 256 + (Index - 15) * 64;
+    }
+    return 1024 + (Index - 27) * 256;
+}
+
+static_assert(GetSizeClassIndex(MaxSmallBlockSize) == SizeClassCount - 1);
+static_assert(GetSizeClassSize(SizeClassCount - 1) == MaxSmallBlockSize);
+} // namespace HKMemoryImpl
+
+constexpr size_t DEFAULT_POOL_PAGE_SIZE = 64 * 1024;
+
+/**
+ * 固定大小内存块池, 线程安全
+ * 从系统按页申请内存并切分为等大的块, 释放的块进入侵入式空闲链表, 页在池析构前不会归还
+ * 除单块分配外还支持批量取出与归还, 线程缓存用它减少加锁次数
+ */
+class HK_API FFixedSizePool
+{
+public:
+    struct FFreeBlock
+    {
+        FFreeBlock* Next;
+    };
+
+    /**
+     * @param InBlockSize 块大小, 向上取整到 HKMemoryImpl::BlockAlignment
+     * @param InTag 页内存计入的分类
+     * @param InPageSize 每页的大小, 至少能容纳一个块
+     */
+    FFixedSizePool(size_t InBlockSize, EMemoryTag InTag, size_t InPageSize = DEFAULT_POOL_PAGE_SIZE);
+    ~FFixedSizePool();
+
+    FFixedSizePool(const FFixedSizePool&)            = delete;
+    FFixedSizePool& operator=(const FFixedSizePool&) = delete;
+
+    void* Allocate();
+    void  Free(void* Block);
+
+    /**
+     * 一次取出 Count 个块, 以 Next 串成链表, 末尾为 nullptr
+     */
+    FFreeBlock* AllocateBatch(UInt32 Count);
+
+    /**
+     * 归还以 Head 开始, Tail 结束的 Count 个块
+     */
+    void FreeBatch(FFreeBlock* Head, FFreeBlock* Tail, UInt32 Count);
+
+    size_t GetBlockSize() const
+    {
+        return BlockSize;
+    }
+
+    size_t GetUsedBlockCount() const;
+
+private:
+    FFreeBlock* AllocateUnlocked();
+    void        AllocatePage();
+
+    // 页头, 占用每页开头的一个块对齐单位
+    struct alignas(HKMemoryImpl::BlockAlignment) FPage
+    {
+        FPage* Next;
+    };
+
+    mutable FMutex Mutex;
+    FFreeBlock*    FreeList = nullptr;
+    FPage*         Pages    = nullptr;
+    char*          Cursor   = nullptr; // 当前页中尚未切分部分的起点, 新页不需要逐块串进空闲链表
+    char*          End      = nullptr;
+    size_t         BlockSize;
+    size_t         PageSize;
+    size_t         NumUsed = 0;
+    EMemoryTag     Tag;
+};
+
+/**
+ * 按大小档位组织的对象池, 线程安全, FObjectArray 用它分配所有 HObject
+ * 每块前有 16 字节头部记录档位, 释放时不需要知道对象的实际类型与大小
+ * 超过 HKMemoryImpl::MaxSmallBlockSize 或对齐大于 16 的分配回退到全局 operator new
+ */
+class HK_API FObjectPoolAllocator
+{
+public:
+    explicit FObjectPoolAllocator(EMemoryTag InTag = EMemoryTag::Object);
+    ~FObjectPoolAllocator();
+
+    FObjectPoolAllocator(const FObjectPoolAllocator&)            = delete;
+    FObjectPoolAllocator& operator=(const FObjectPoolAllocator&) = delete;
+
+    void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t));
+    void  Free(void* Ptr);
+
+    template <typename T, typename... Args>
+    T* New(Args&&... InArgs)
+    {
+        void* Memory = Allocate(sizeof(T), alignof(T));
+        return ::new (Memory) T(std::forward<Args>(InArgs)...);
+    }
+
+    /**
+     * 调用析构函数并释放, 多态类型可以通过基类指针删除
+     */
+    template <typename T>
+    void Delete(T* Object)
+    {
+        if (Object == nullptr)
+        {
+            return;
+        }
+        void* Memory = Object;
+        if constexpr (std::is_polymorphic_v<T>)
+        {
+            // 多继承时基类子对象的地址不等于分配的地址
+            Memory = dynamic_cast<void*>(Object);
+        }
+        Object->~T();
+        Free(Memory);
+    }
+
+private:
+    struct alignas(HKMemoryImpl::BlockAlignment) FBlockHeader
+    {
+        UInt32 SizeClass; // 池外分配时为 LargeSizeClass
+        UInt32 Offset;    // 块起点到对象的偏移, 池外分配时也是分配的对齐
+        size_t Size;
+    };
+    static_assert(sizeof(FBlockHeader) == HKMemoryImpl::BlockAlignment);
+
+    static constexpr UInt32 LargeSizeClass = static_cast<UInt32>(-1);
+
+    std::unique_ptr<FFixedSizePool> Pools[HKMemoryImpl::SizeClassCount];
+    EMemoryTag                      Tag;
+};
@@ -0,0 +1,244 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "ThreadCacheAllocator.h"
+
+#include "Core/Memory/PoolAllocator.h"
+#include "Core/Utility/Profiler.h"
+#include <algorithm>
+#include <new>
+
+namespace
+{
+using FFreeBlock = FFixedSizePool::FFreeBlock;
+
+constexpr size_t TagCount = static_cast<size_t>(EMemoryTag::Count);
+// 线程内累计的统计变化超过此值才写入全局计数, 避免每次分配都修改共享缓存行
+constexpr Int64 StatsFlushThreshold = 64 * 1024;
+// 每次与共享池交换的字节数, 块数限制在 [4, 64] 之间
+constexpr size_t BatchBytes = 16 * 1024;
+
+UInt32 GetBatchCount(const UInt32 SizeClass)
+{
+    return static_cast<UInt32>(std::clamp<size_t>(BatchBytes / HKMemoryImpl::GetSizeClassSize(SizeClass), 4, 64));
+}
+
+FFixedSizePool* const* CreateCentralPools()
+{
+    FFixedSizePool** Pools = new FFixedSizePool*[HKMemoryImpl::SizeClassCount];
+    for (UInt32 Index = 0; Index < HKMemoryImpl::SizeClassCount; ++Index)
+    {
+        // 共享池的页由所有分类共用, 预留量统一计入 Container
+        Pools[Index] = new FFixedSizePool(HKMemoryImpl::GetSizeClassSize(Index), EMemoryTag::Container);
+    }
+    return Pools;
+}
+
+// 共享池故意不释放: 线程缓存可能在静态对象析构之后才归还
+FFixedSizePool& GetCentralPool(const UInt32 SizeClass)
+{
+    static FFixedSizePool* const* Pools = CreateCentralPools();
+    return *Pools[SizeClass];
+}
+
+struct FThreadCache
+{
+    struct FBin
+    {
+        FFreeBlock* Head  = nullptr;
+        UInt32      Count = 0;
+    };
+
+    FThreadCache();
+    ~FThreadCache();
+
+    void* Pop(const UInt32 SizeClass)
+    {
+        FBin& Bin = Bins[SizeClass];
+        if (Bin.Head == nullptr)
+        {
+            const UInt32 Batch = GetBatchCount(SizeClass);
+            Bin.Head           = GetCentralPool(SizeClass).AllocateBatch(Batch);
+            Bin.Count          = Batch;
+        }
+        FFreeBlock* Block = Bin.Head;
+        Bin.Head          = Block->Next;
+        --Bin.Count;
+        return Block;
+    }
+
+    void Push(const UInt32 SizeClass, void* Ptr)
+    {
+        FBin&       Bin   = Bins[SizeClass];
+        FFreeBlock* Block = static_cast<FFreeBlock*>(Ptr);
+        Block->Next       = Bin.Head;
+        Bin.Head          = Block;
+        ++Bin.Count;
+
+        // 缓存超过两批时归还一批, 保留一批应对接下来的分配
+        const UInt32 Batch = GetBatchCount(SizeClass);
+        if (Bin.Count > Batch * 2)
+        {
+            FFreeBlock* Tail = Bin.Head;
+            for (UInt32 Index = 1; Index < Batch; ++Index)
+            {
+                Tail = Tail->Next;
+            }
+            FFreeBlock* Head = Bin.Head;
+            Bin.Head         = Tail->Next;
+            Bin.Count -= Batch;
+            GetCentralPool(SizeClass).FreeBatch(Head, Tail, Batch);
+        }
+    }
+
+    void RecordStats(const EMemoryTag Tag, const Int64 Bytes, const Int64 Count)
+    {
+        const size_t TagIndex = static_cast<size_t>(Tag);
+        PendingBytes[TagIndex] += Bytes;
+        PendingCount[TagIndex] += Count;
+        if (PendingBytes[TagIndex] >= StatsFlushThreshold || PendingBytes[TagIndex] <= -StatsFlushThreshold)
+        {
+            FlushStats(TagIndex);
+        }
+    }
+
+    void FlushStats(const size_t TagIndex)
+    {
+        FMemoryStats::RecordAlloc(static_cast<EMemoryTag>(TagIndex), PendingBytes[TagIndex], PendingCount[TagIndex]);
+        PendingBytes[TagIndex] = 0;
+        PendingCount[TagIndex] = 0;
+    }
+
+    void Flush()
+    {
+        for (UInt32 SizeClass = 0; SizeClass < HKMemoryImpl::SizeClassCount; ++SizeClass)
+        {
+            FBin& Bin = Bins[SizeClass];
+            if (Bin.Head == nullptr)
+            {
+                continue;
+            }
+            FFreeBlock* Tail = Bin.Head;
+            while (Tail->Next != nullptr)
+            {
+                Tail = Tail->Next;
+            }
+            GetCentralPool(SizeClass).FreeBatch(Bin.Head, Tail, Bin.Count);
+            Bin.Head  = nullptr;
+            Bin.Count = 0;
+        }
+        for (size_t TagIndex = 0; TagIndex < TagCount; ++TagIndex)
+        {
+            FlushStats(TagIndex);
+        }
+    }
+
+    FBin  Bins[HKMemoryImpl::SizeClassCount];
+    Int64 PendingBytes[TagCount] = {};
+    Int64 PendingCount[TagCount] = {};
+};
+
+enum class EThreadCacheState : UInt8
+{
+    Uninitialized,
+    Alive,
+    Destroyed,
+};
+
+// 平凡类型的 thread_local 在线程缓存析构之后依然可以访问, 用来判断缓存是否还能使用
+thread_local EThreadCacheState GThreadCacheState = EThreadCacheState::Uninitialized;
+thread_local FThreadCache      GThreadCache;
+
+FThreadCache::FThreadCache()
+{
+    GThreadCacheState = EThreadCacheState::Alive;
+}
+
+FThreadCache::~FThreadCache()
+{
+    Flush();
+    GThreadCacheState = EThreadCacheState::Destroyed;
+}
+
+// 线程退出过程中缓存已经析构时返回 nullptr, 此时直接操作共享池
+FThreadCache* GetThreadCache()
+{
+    if (GThreadCacheState == EThreadCacheState::Destroyed)
+    {
+        return nullptr;
+    }
+    return &GThreadCache;
+}
+
+bool IsSmallAllocation(const size_t Size, const size_t Alignment)
+{
+    return Size <= HKMemoryImpl::MaxSmallBlockSize && Alignment <= HKMemoryImpl::BlockAlignment;
+}
+} // namespace
+
+void* FThreadCacheAllocator::Allocate(const size_t Size, const size_t Alignment, const EMemoryTag Tag)
+{
+    void* Ptr = nullptr;
+    if (IsSmallAllocation(Size, Alignment))
+    {
+        const UInt32 SizeClass = HKMemoryImpl::GetSizeClassIndex(std::max<size_t>(Size, 1));
+        const Int64  BlockSize = static_cast<Int64>(HKMemoryImpl::GetSizeClassSize(SizeClass));
+        if (FThreadCache* Cache = GetThreadCache(); Cache != nullptr)
+        {
+            Ptr = Cache->Pop(SizeClass);
+            Cache->RecordStats(Tag, BlockSize, 1);
+        }
+        else
+        {
+            Ptr = GetCentralPool(SizeClass).Allocate();
+            FMemoryStats::RecordAlloc(Tag, BlockSize);
+        }
+    }
+    else
+    {
+        Ptr = ::operator new(Size, std::align_val_t(std::max(Alignment, HKMemoryImpl::BlockAlignment)));
+        FMemoryStats::RecordReserve(Tag, static_cast<Int64>(Size));
+        FMemoryStats::RecordAlloc(Tag, static_cast<Int64>(Size));
+    }
+    HK_PROFILE_ALLOC_N(Ptr, Size, GetMemoryTagName(Tag));
+    return Ptr;
+}
+
+void FThreadCacheAllocator::Free(void* Ptr, const size_t Size, const size_t Alignment, const EMemoryTag Tag)
+{
+    if (Ptr == nullptr)
+    {
+        return;
+    }
+    HK_PROFILE_FREE_N(Ptr, GetMemoryTagName(Tag));
+
+    if (IsSmallAllocation(Size, Alignment))
+    {
+        const UInt32 SizeClass = HKMemoryImpl::GetSizeClassIndex(std::max<size_t>(Size, 1));
+        const Int64  BlockSize = static_cast<Int64>(HKMemoryImpl::GetSizeClassSize(SizeClass));
+        if (FThreadCache* Cache = GetThreadCache(); Cache != nullptr)
+        {
+            Cache->Push(SizeClass, Ptr);
+            Cache->RecordStats(Tag, -BlockSize, 0);
+        }
+        else
+        {
+            GetCentralPool(SizeClass).Free(Ptr);
+            FMemoryStats::RecordFree(Tag, BlockSize);
+        }
+        return;
+    }
+
+    FMemoryStats::RecordFree(Tag, static_cast<Int64>(Size));
+    FMemoryStats::RecordRelease(Tag, static_cast<Int64>(Size));
+    ::operator delete(Ptr, std::align_val_t(std::max(Alignment, HKMemoryImpl::BlockAlignment)));
+}
+
+void FThreadCacheAllocator::FlushThreadCache()
+{
+    if (FThreadCache* Cache = GetThreadCache(); Cache != nullptr)
+    {
+        Cache->Flush();
+    }
+}
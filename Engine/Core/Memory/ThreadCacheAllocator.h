@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Core/Memory/Allocator.h"
+#include "Core/Memory/MemoryStats.h"
+#include "Core/Utility/Macros.h"
+#include <cstddef>
+
+/**
+ * 带线程缓存的通用分配器, 所有接口均为静态函数, 线程安全
+ * 不超过 HKMemoryImpl::MaxSmallBlockSize 的分配按大小档位从当前线程的缓存中取块, 不需要加锁;
+ * 缓存为空时从全局共享的 FFixedSizePool 批量取出, 缓存过多时批量归还; 线程退出时归还全部缓存
+ * 更大或对齐大于 16 的分配直接使用全局 operator new
+ * 允许在一个线程分配, 在另一个线程释放, 块会进入释放线程的缓存
+ */
+class HK_API FThreadCacheAllocator
+{
+public:
+    /**
+     * @param Size 字节数, 释放时必须传回相同的值
+     * @param Alignment 对齐, 释放时必须传回相同的值
+     * @param Tag 统计用的分类, 释放时必须传回相同的值
+     */
+    static void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t),
+                          EMemoryTag Tag = EMemoryTag::Container);
+
+    static void Free(void* Ptr, size_t Size, size_t Alignment = alignof(std::max_align_t),
+                     EMemoryTag Tag = EMemoryTag::Container);
+
+    /**
+     * 把当前线程缓存的块全部归还到共享池, 例如在工作线程长时间空闲之前调用
+     */
+    static void FlushThreadCache();
+};
+
+/**
+ * 使用 FThreadCacheAllocator 的容器分配策略, 例如 TArray<FVertex, TThreadCacheAllocatorPolicy<>>
+ */
+template <EMemoryTag Tag = EMemoryTag::Container>
+struct TThreadCacheAllocatorPolicy
+{
+    static void* Allocate(const size_t Size, const size_t Alignment)
+    {
+        return FThreadCacheAllocator::Allocate(Size, Alignment, Tag);
+    }
+
+    static void Free(void* Ptr, const size_t Size, const size_t Alignment) noexcept
+    {
+        FThreadCacheAllocator::Free(Ptr, Size, Alignment, Tag);
+    }
+};
@@ -27,6 +27,18 @@ struct FPropertyImpl
      * 属性在对象中的偏移量（字节），对于枚举成员，这是EnumValue
      */
     Int32 Offset;
+    /**
+     * 属性的大小（字节），对于枚举成员为 0
+     */
+    Int32 Size;
+    /**
+     * 属性的对齐（字节），对于枚举成员为 0
+     */
+    Int32 Alignment;
+    /**
+     * 平凡可序列化属性的类型名 Hash, 见 TSerializedTypeHash; 其它属性为 0
+     */
+    UInt64 SerializedTypeHash;
     /**
      * 声明此属性的类型
      */
@@ -41,7 +53,8 @@ struct FPropertyImpl
     FAttributeMap Attributes;
 
     FPropertyImpl()
-        : Name(), Type(nullptr), Flags(EPropertyFlags::None), Offset(0), OwnerType(nullptr), KeyType(nullptr)
+        : Name(), Type(nullptr), Flags(EPropertyFlags::None), Offset(0), Size(0), Alignment(0), SerializedTypeHash(0),
+          OwnerType(nullptr), KeyType(nullptr)
     {
     }
 
@@ -53,6 +66,14 @@ struct FPropertyImpl
         return (Flags & EPropertyFlags::Enum) != EPropertyFlags::None;
     }
 
+    /**
+     * 检查属性的内存表示是否可以直接作为序列化数据
+     */
+    bool IsTriviallySerializable() const
+    {
+        return (Flags & EPropertyFlags::TriviallySerializable) != EPropertyFlags::None;
+    }
+
     /**
      * 检查是否是Array
      */
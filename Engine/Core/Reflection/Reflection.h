@@ -3,6 +3,8 @@
 #include "AnyRef.h"
 #include "Core/Serialization/BinaryArchive.h"
 #include "Core/Serialization/JsonArchive.h"
+#include "Core/Serialization/JsonStreamArchive.h"
+#include "Core/Serialization/SchemaArchive.h"
 #include "Core/Serialization/Serialization.h"
 #include "Core/Serialization/XMLArchive.h"
 #include "Property.h"
@@ -19,16 +21,19 @@
 public:                                                                                                                \
 GENERATED_HEADER_##ClassName private:
 
-// 用于在.generated.h中声明六个Serialize函数
+// 用于在.generated.h中声明九个Serialize函数
 #define HK_DECL_CLASS_SERIALIZATION(ClassName)                                                                         \
     virtual void Serialize(cereal::JSONOutputArchive& Ar);                                                             \
     virtual void Serialize(cereal::JSONInputArchive& Ar);                                                              \
+    virtual void Serialize(FJsonStreamInputArchive& Ar);                                                               \
     virtual void Serialize(FXMLInputArchive& Ar);                                                                      \
     virtual void Serialize(FXMLOutputArchive& Ar);                                                                     \
     virtual void Serialize(FBinaryInputArchive& Ar);                                                                   \
-    virtual void Serialize(FBinaryOutputArchive& Ar);
+    virtual void Serialize(FBinaryOutputArchive& Ar);                                                                  \
+    virtual void Serialize(FSchemaInputArchive& Ar);                                                                   \
+    virtual void Serialize(FSchemaOutputArchive& Ar);
 
-// 用于在.generated.cpp中定义六个Serialize函数
+// 用于在.generated.cpp中定义九个Serialize函数
 // 需要先定义 {ClassName}_SERIALIZATION_CODE 宏，包含实际的序列化代码
 #define HK_DEFINE_CLASS_SERIALIZATION(ClassName)                                                                       \
     void ClassName::Serialize(cereal::JSONOutputArchive& Ar)                                                           \
@@ -39,6 +44,10 @@ GENERATED_HEADER_##ClassName private:
     {                                                                                                                  \
         ClassName##_SERIALIZATION_CODE                                                                                 \
     }                                                                                                                  \
+    void ClassName::Serialize(FJsonStreamInputArchive& Ar)                                                             \
+    {                                                                                                                  \
+        ClassName##_SERIALIZATION_CODE                                                                                 \
+    }                                                                                                                  \
     void ClassName::Serialize(FXMLInputArchive& Ar)                                                                    \
     {                                                                                                                  \
         ClassName##_SERIALIZATION_CODE                                                                                 \
@@ -52,6 +61,14 @@ GENERATED_HEADER_##ClassName private:
         ClassName##_SERIALIZATION_CODE                                                                                 \
     }                                                                                                                  \
     void ClassName::Serialize(FBinaryOutputArchive& Ar)                                                                \
+    {                                                                                                                  \
+        ClassName##_SERIALIZATION_CODE                                                                                 \
+    }                                                                                                                  \
+    void ClassName::Serialize(FSchemaInputArchive& Ar)                                                                 \
+    {                                                                                                                  \
+        ClassName##_SERIALIZATION_CODE                                                                                 \
+    }                                                                                                                  \
+    void ClassName::Serialize(FSchemaOutputArchive& Ar)                                                                \
     {                                                                                                                  \
         ClassName##_SERIALIZATION_CODE                                                                                 \
     }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "Core/Container/Map.h"
 #include "Core/String/Name.h"
 #include "Core/Utility/Macros.h"
+#include <concepts>
 
 struct FTypeImpl;
 struct FPropertyImpl;
@@ -33,5 +34,19 @@ enum class EPropertyFlags
     FixedArray = 1 << 1,
     Map = 1 << 2,
     Enum = 1 << 3,
+    // 属性的内存表示可以直接作为序列化数据, 见 TIsTriviallySerializable
+    TriviallySerializable = 1 << 4,
 };
-HK_ENABLE_BITMASK_OPERATORS(EPropertyFlags)
\ No newline at end of file
+HK_ENABLE_BITMASK_OPERATORS(EPropertyFlags)
+
+// 带有反射信息的类型, 包括 HCLASS 与 HSTRUCT
+template <typename T>
+concept CReflectedType = requires(const T& Value) {
+    { Value.GetType() } -> std::convertible_to<FType>;
+};
+
+// 带有反射信息的结构体, HSTRUCT 的 GetType 是静态函数
+template <typename T>
+concept CReflectedStruct = requires {
+    { T::GetType() } -> std::convertible_to<FType>;
+};
\ No newline at end of file
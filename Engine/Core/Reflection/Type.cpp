@@ -68,6 +68,21 @@ void* FTypeImpl::CreateInstance() const
     return nullptr;
 }
 
+void* FTypeImpl::ConstructInstanceAt(void* InMemory) const
+{
+    if (InMemory == nullptr || !CanCreateInstance())
+    {
+        return nullptr;
+    }
+    FTypeManager& Manager = FTypeManager::Get();
+    FTypeManager::TypeConstructFunc ConstructFunc = Manager.GetConstructFunc(Name);
+    if (ConstructFunc != nullptr)
+    {
+        return ConstructFunc(InMemory);
+    }
+    return nullptr;
+}
+
 void FTypeImpl::DestroyInstance(void* InInstance) const
 {
     if (InInstance == nullptr)
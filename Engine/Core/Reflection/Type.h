@@ -38,12 +38,16 @@ struct FTypeImpl
      * 类型大小（字节）
      */
     Int32 Size;
+    /**
+     * 类型对齐（字节）
+     */
+    Int32 Alignment;
     /**
      * 如果是Enum，底层类型
      */
     FType UnderlyingType;
 
-    FTypeImpl() : Flags(ETypeFlags::None), Size(0), UnderlyingType(nullptr) {}
+    FTypeImpl() : Flags(ETypeFlags::None), Size(0), Alignment(0), UnderlyingType(nullptr) {}
 
     TArray<FProperty> GetAllProperties() const;
     TArray<FMethod> GetAllMethods() const;
@@ -138,6 +142,12 @@ struct FTypeImpl
      */
     void* CreateInstance() const;
 
+    /**
+     * 在外部提供的内存上构造实例（内存至少 Size 字节并按 Alignment 对齐，由调用者负责释放）
+     * @return 构造出的实例，类型不可实例化时返回 nullptr
+     */
+    void* ConstructInstanceAt(void* InMemory) const;
+
     /**
      * 销毁实例
      */
@@ -3,6 +3,7 @@
 #include "Property.h"
 #include "Type.h"
 #include "Core/Utility/Profiler.h"
+#include "Core/Utility/TypeTraits.h"
 
 // 前向声明，避免循环依赖
 class FTypeManager;
@@ -20,6 +21,8 @@ inline FTypeMutable FTypeImpl::RegisterProperty(PropertyType ClassType::* InMemb
     // 需要在包含TypeManager.h的地方调用SetPropertyType来设置
     PropertyImpl->Type = nullptr;
     PropertyImpl->Offset = Offset;
+    PropertyImpl->Size = static_cast<Int32>(sizeof(PropertyType));
+    PropertyImpl->Alignment = static_cast<Int32>(alignof(PropertyType));
     PropertyImpl->OwnerType = this;
     PropertyImpl->Flags = EPropertyFlags::None;
 
@@ -29,6 +32,12 @@ inline FTypeMutable FTypeImpl::RegisterProperty(PropertyType ClassType::* InMemb
         PropertyImpl->Flags |= EPropertyFlags::Enum;
     }
 
+    if constexpr (TIsTriviallySerializableV<PropertyType>)
+    {
+        PropertyImpl->Flags |= EPropertyFlags::TriviallySerializable;
+        PropertyImpl->SerializedTypeHash = TSerializedTypeHash<PropertyType>::Value;
+    }
+
     // 检测容器类型 - 简化处理，实际需要更复杂的模板元编程
     // 这里先不实现容器检测，后续可以扩展
 
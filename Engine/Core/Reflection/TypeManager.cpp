@@ -28,6 +28,13 @@ FTypeManager::TypeCreateFunc FTypeManager::GetCreateFunc(const FName InTypeName)
     return Found != nullptr ? *Found : nullptr;
 }
 
+FTypeManager::TypeConstructFunc FTypeManager::GetConstructFunc(const FName InTypeName) const
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+    const TypeConstructFunc* Found = TypeConstructMap.Find(InTypeName);
+    return Found != nullptr ? *Found : nullptr;
+}
+
 FTypeManager::TypeDestroyFunc FTypeManager::GetDestroyFunc(const FName InTypeName) const
 {
     std::lock_guard<std::mutex> Lock(Mutex);
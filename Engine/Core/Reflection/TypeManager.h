@@ -90,11 +90,15 @@ public:
 
     // 类型创建和销毁函数类型
     using TypeCreateFunc = void* (*)();
+    using TypeConstructFunc = void* (*)(void*);
     using TypeDestroyFunc = void (*)(void*);
 
     // 获取创建函数（内部使用）
     TypeCreateFunc GetCreateFunc(FName InTypeName) const;
 
+    // 获取原地构造函数（内部使用）
+    TypeConstructFunc GetConstructFunc(FName InTypeName) const;
+
     // 获取销毁函数（内部使用）
     TypeDestroyFunc GetDestroyFunc(FName InTypeName) const;
 
@@ -184,6 +188,7 @@ private:
     TMap<FName, FTypeImpl*> TypeMap;
     TArray<FTypeImpl*> TypeStorage;
     TMap<FName, TypeCreateFunc> TypeCreateMap;
+    TMap<FName, TypeConstructFunc> TypeConstructMap;
     TMap<FName, TypeDestroyFunc> TypeDestroyMap;
     // 类型唯一标识符到注册函数的映射（使用void*作为唯一标识，通过static局部变量生成）
     TMap<void*, TypeRegistererFunc> TypeRegistererMap;
@@ -4,6 +4,7 @@
 #include "Core/Reflection/AnyRef.h"
 #include "Core/Utility/Profiler.h"
 #include "TypeManager.h"
+#include <new>
 
 template <typename T>
 FType FTypeManager::GetType() const
@@ -72,6 +73,7 @@ FTypeMutable FTypeManager::RegisterType(const char* InName)
     FTypeImpl* TypeImpl = new FTypeImpl();
     TypeImpl->Name = TypeName;
     TypeImpl->Size = static_cast<Int32>(sizeof(T));
+    TypeImpl->Alignment = static_cast<Int32>(alignof(T));
     TypeImpl->Flags = ETypeFlags::None;
 
     // 检测是否是Enum
@@ -101,6 +103,9 @@ FTypeMutable FTypeManager::RegisterType(const char* InName)
         // 注册创建函数
         TypeCreateMap[TypeName] = []() -> void* { return New<T>(); };
 
+        // 注册原地构造函数，供对象池等自行管理内存的分配器使用
+        TypeConstructMap[TypeName] = [](void* InMemory) -> void* { return ::new (InMemory) T(); };
+
         // 注册销毁函数
         TypeDestroyMap[TypeName] = [](void* InInstance)
         {
@@ -0,0 +1,545 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "JsonStreamArchive.h"
+
+#include <bit>
+#include <cstring>
+
+#if HK_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+bool IsWhitespace(const char C)
+{
+    return C == ' ' || C == '\n' || C == '\r' || C == '\t';
+}
+
+// 数字与 true / false / null 在这些字符处结束
+bool IsDelimiter(const char C)
+{
+    return C == ',' || C == '}' || C == ']' || IsWhitespace(C);
+}
+
+/**
+ * 查找 [Pos, Size) 中第一个引号或反斜杠, 没有时返回 Size
+ */
+size_t FindStringSpecial(const char* Data, size_t Pos, const size_t Size)
+{
+#if HK_SIMD_SSE2
+    const __m128i Quote     = _mm_set1_epi8('"');
+    const __m128i Backslash = _mm_set1_epi8('\\');
+    for (; Pos + 16 <= Size; Pos += 16)
+    {
+        const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + Pos));
+        const UInt32  Mask  = static_cast<UInt32>(
+            _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(Chunk, Quote), _mm_cmpeq_epi8(Chunk, Backslash))));
+        if (Mask != 0)
+        {
+            return Pos + std::countr_zero(Mask);
+        }
+    }
+#endif
+    for (; Pos < Size; ++Pos)
+    {
+        if (Data[Pos] == '"' || Data[Pos] == '\\')
+        {
+            return Pos;
+        }
+    }
+    return Size;
+}
+
+/**
+ * 查找 [Pos, Size) 中第一个引号或括号, 没有时返回 Size
+ */
+size_t FindStructural(const char* Data, size_t Pos, const size_t Size)
+{
+#if HK_SIMD_SSE2
+    // '{' '[' 与 '}' ']' 只差 0x20 这一位, 置位后各用一次比较
+    const __m128i Quote      = _mm_set1_epi8('"');
+    const __m128i CaseBit    = _mm_set1_epi8(0x20);
+    const __m128i OpenBrace  = _mm_set1_epi8('{');
+    const __m128i CloseBrace = _mm_set1_epi8('}');
+    for (; Pos + 16 <= Size; Pos += 16)
+    {
+        const __m128i Chunk  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + Pos));
+        const __m128i Folded = _mm_or_si128(Chunk, CaseBit);
+        const __m128i Match  = _mm_or_si128(_mm_cmpeq_epi8(Chunk, Quote),
+                                            _mm_or_si128(_mm_cmpeq_epi8(Folded, OpenBrace),
+                                                         _mm_cmpeq_epi8(Folded, CloseBrace)));
+        if (const UInt32 Mask = static_cast<UInt32>(_mm_movemask_epi8(Match)); Mask != 0)
+        {
+            return Pos + std::countr_zero(Mask);
+        }
+    }
+#endif
+    for (; Pos < Size; ++Pos)
+    {
+        const char C = Data[Pos];
+        if (C == '"' || C == '{' || C == '}' || C == '[' || C == ']')
+        {
+            return Pos;
+        }
+    }
+    return Size;
+}
+
+bool ParseHex4(const char* Data, const size_t Pos, const size_t Size, UInt32& OutCode)
+{
+    if (Pos + 4 > Size)
+    {
+        return false;
+    }
+    OutCode = 0;
+    for (size_t Index = Pos; Index < Pos + 4; ++Index)
+    {
+        const char C     = Data[Index];
+        UInt32     Digit = 0;
+        if (C >= '0' && C <= '9')
+        {
+            Digit = C - '0';
+        }
+        else if (C >= 'a' && C <= 'f')
+        {
+            Digit = C - 'a' + 10;
+        }
+        else if (C >= 'A' && C <= 'F')
+        {
+            Digit = C - 'A' + 10;
+        }
+        else
+        {
+            return false;
+        }
+        OutCode = OutCode << 4 | Digit;
+    }
+    return true;
+}
+
+void AppendUtf8(std::string& Out, const UInt32 Code)
+{
+    if (Code < 0x80)
+    {
+        Out += static_cast<char>(Code);
+    }
+    else if (Code < 0x800)
+    {
+        Out += static_cast<char>(0xC0 | Code >> 6);
+        Out += static_cast<char>(0x80 | (Code & 0x3F));
+    }
+    else if (Code < 0x10000)
+    {
+        Out += static_cast<char>(0xE0 | Code >> 12);
+        Out += static_cast<char>(0x80 | (Code >> 6 & 0x3F));
+        Out += static_cast<char>(0x80 | (Code & 0x3F));
+    }
+    else
+    {
+        Out += static_cast<char>(0xF0 | Code >> 18);
+        Out += static_cast<char>(0x80 | (Code >> 12 & 0x3F));
+        Out += static_cast<char>(0x80 | (Code >> 6 & 0x3F));
+        Out += static_cast<char>(0x80 | (Code & 0x3F));
+    }
+}
+
+char GetCloseBracket(const bool bArray)
+{
+    return bArray ? ']' : '}';
+}
+} // namespace
+
+FJsonStreamInputArchive::FJsonStreamInputArchive(const char* InData, const size_t InSize)
+    : InputArchive(this), MyData(InData), MySize(InSize)
+{
+    size_t Pos = 0;
+    // 跳过 UTF-8 BOM
+    if (MySize >= 3 && std::memcmp(MyData, "\xEF\xBB\xBF", 3) == 0)
+    {
+        Pos = 3;
+    }
+    Pos = SkipWhitespace(Pos);
+    if (Pos >= MySize || (MyData[Pos] != '{' && MyData[Pos] != '['))
+    {
+        ThrowError("Root must be an object or an array", MyData + Pos);
+    }
+    const size_t Begin = SkipWhitespace(Pos + 1);
+    Frames.Add({Begin, Begin, MyData[Pos] == '['});
+}
+
+void FJsonStreamInputArchive::ThrowError(const char* Message, const char* Where) const
+{
+    const size_t Offset = Where != nullptr ? static_cast<size_t>(Where - MyData) : 0;
+    throw cereal::Exception("JSON parsing failed at offset " + std::to_string(Offset) + ": " + Message);
+}
+
+bool FJsonStreamInputArchive::SelectMember(const char* Name)
+{
+    const FFrame& Frame = Frames.Back();
+    const char    Close = GetCloseBracket(Frame.bArray);
+    if (Frame.bArray)
+    {
+        // 与 cereal 一致, 数组中的名字被忽略, 按顺序读取
+        return Frame.Cursor < MySize && MyData[Frame.Cursor] != Close;
+    }
+
+    // 字段一般按写入的顺序读取, 从游标开始查找通常第一个成员就命中
+    std::string_view Key;
+    for (size_t Pos = Frame.Cursor; Pos < MySize && MyData[Pos] != Close;)
+    {
+        const size_t ValuePos = SkipKey(Pos, Key);
+        if (IsKeyEqual(Key, Name))
+        {
+            PendingValue = ValuePos;
+            return true;
+        }
+        Pos = NextMember(SkipValue(ValuePos), Close);
+    }
+    for (size_t Pos = Frame.Begin; Pos < Frame.Cursor;)
+    {
+        const size_t ValuePos = SkipKey(Pos, Key);
+        if (IsKeyEqual(Key, Name))
+        {
+            PendingValue = ValuePos;
+            return true;
+        }
+        Pos = NextMember(SkipValue(ValuePos), Close);
+    }
+    return false;
+}
+
+void FJsonStreamInputArchive::StartNode()
+{
+    const size_t Pos = TakeValue();
+    if (MyData[Pos] != '{' && MyData[Pos] != '[')
+    {
+        ThrowError("Expected an object or an array", MyData + Pos);
+    }
+    const size_t Begin = SkipWhitespace(Pos + 1);
+    Frames.Add({Begin, Begin, MyData[Pos] == '['});
+}
+
+void FJsonStreamInputArchive::FinishNode()
+{
+    HK_ASSERT_MSG_RAW(Frames.Size() > 1, "FinishNode without a matching StartNode");
+    const FFrame Frame = Frames.Back();
+    const char   Close = GetCloseBracket(Frame.bArray);
+    size_t       Pos   = Frame.Cursor;
+
+    std::string_view Key;
+    while (Pos < MySize && MyData[Pos] != Close)
+    {
+        const size_t ValuePos = Frame.bArray ? Pos : SkipKey(Pos, Key);
+        Pos                   = NextMember(SkipValue(ValuePos), Close);
+    }
+    if (Pos >= MySize)
+    {
+        ThrowError("Unterminated object or array", MyData + MySize);
+    }
+    Frames.PopBack();
+    FinishValue(Pos + 1);
+}
+
+void FJsonStreamInputArchive::LoadSize(cereal::size_type& OutSize)
+{
+    const FFrame& Frame = Frames.Back();
+    const char    Close = GetCloseBracket(Frame.bArray);
+
+    std::string_view Key;
+    OutSize = 0;
+    for (size_t Pos = Frame.Begin; Pos < MySize && MyData[Pos] != Close; ++OutSize)
+    {
+        const size_t ValuePos = Frame.bArray ? Pos : SkipKey(Pos, Key);
+        Pos                   = NextMember(SkipValue(ValuePos), Close);
+    }
+}
+
+void FJsonStreamInputArchive::LoadValue(bool& OutValue)
+{
+    const size_t           Pos   = TakeValue();
+    const size_t           End   = SkipValue(Pos);
+    const std::string_view Token(MyData + Pos, End - Pos);
+    if (Token == "true")
+    {
+        OutValue = true;
+    }
+    else if (Token == "false")
+    {
+        OutValue = false;
+    }
+    else
+    {
+        ThrowError("Expected a boolean", MyData + Pos);
+    }
+    FinishValue(End);
+}
+
+void FJsonStreamInputArchive::LoadValue(std::string& OutValue)
+{
+    const size_t Pos = TakeValue();
+    if (MyData[Pos] != '"')
+    {
+        ThrowError("Expected a string", MyData + Pos);
+    }
+    FinishValue(DecodeString(Pos, OutValue));
+}
+
+void FJsonStreamInputArchive::LoadValue(std::nullptr_t& OutValue)
+{
+    const size_t Pos = TakeValue();
+    const size_t End = SkipValue(Pos);
+    if (std::string_view(MyData + Pos, End - Pos) != "null")
+    {
+        ThrowError("Expected null", MyData + Pos);
+    }
+    OutValue = nullptr;
+    FinishValue(End);
+}
+
+size_t FJsonStreamInputArchive::SkipWhitespace(size_t Pos) const
+{
+    while (Pos < MySize && IsWhitespace(MyData[Pos]))
+    {
+        ++Pos;
+    }
+    return Pos;
+}
+
+size_t FJsonStreamInputArchive::SkipString(const size_t Pos) const
+{
+    size_t Cur = Pos + 1;
+    while (true)
+    {
+        Cur = FindStringSpecial(MyData, Cur, MySize);
+        if (Cur >= MySize)
+        {
+            ThrowError("Unterminated string", MyData + Pos);
+        }
+        if (MyData[Cur] == '"')
+        {
+            return Cur + 1;
+        }
+        // 反斜杠与被转义的字符一起跳过
+        Cur += 2;
+    }
+}
+
+size_t FJsonStreamInputArchive::SkipValue(const size_t Pos) const
+{
+    if (Pos >= MySize)
+    {
+        ThrowError("Expected a value", MyData + MySize);
+    }
+
+    const char C = MyData[Pos];
+    if (C == '"')
+    {
+        return SkipString(Pos);
+    }
+    if (C == '{' || C == '[')
+    {
+        // 只跟踪括号的深度, 不检查其中的内容
+        size_t Depth = 0;
+        size_t Cur   = Pos;
+        while (true)
+        {
+            Cur = FindStructural(MyData, Cur, MySize);
+            if (Cur >= MySize)
+            {
+                ThrowError("Unterminated object or array", MyData + Pos);
+            }
+            const char Structural = MyData[Cur];
+            if (Structural == '"')
+            {
+                Cur = SkipString(Cur);
+                continue;
+            }
+            if (Structural == '{' || Structural == '[')
+            {
+                ++Depth;
+            }
+            else if (--Depth == 0)
+            {
+                return Cur + 1;
+            }
+            ++Cur;
+        }
+    }
+
+    size_t Cur = Pos;
+    while (Cur < MySize && !IsDelimiter(MyData[Cur]))
+    {
+        ++Cur;
+    }
+    if (Cur == Pos)
+    {
+        ThrowError("Expected a value", MyData + Pos);
+    }
+    return Cur;
+}
+
+size_t FJsonStreamInputArchive::SkipKey(const size_t Pos, std::string_view& OutKey) const
+{
+    if (Pos >= MySize || MyData[Pos] != '"')
+    {
+        ThrowError("Expected a member name", MyData + Pos);
+    }
+    const size_t End = SkipString(Pos);
+    OutKey           = std::string_view(MyData + Pos + 1, End - Pos - 2);
+
+    const size_t Colon = SkipWhitespace(End);
+    if (Colon >= MySize || MyData[Colon] != ':')
+    {
+        ThrowError("Expected ':' after a member name", MyData + Colon);
+    }
+    return SkipWhitespace(Colon + 1);
+}
+
+size_t FJsonStreamInputArchive::NextMember(const size_t Pos, const char Close) const
+{
+    const size_t Cur = SkipWhitespace(Pos);
+    if (Cur < MySize && MyData[Cur] == ',')
+    {
+        return SkipWhitespace(Cur + 1);
+    }
+    if (Cur < MySize && MyData[Cur] == Close)
+    {
+        return Cur;
+    }
+    ThrowError("Expected ',' or a closing bracket", MyData + Cur);
+}
+
+size_t FJsonStreamInputArchive::TakeValue()
+{
+    if (PendingValue != NotFound)
+    {
+        const size_t Pos = PendingValue;
+        PendingValue     = NotFound;
+        if (Pos >= MySize)
+        {
+            ThrowError("Expected a value", MyData + MySize);
+        }
+        return Pos;
+    }
+
+    // 没有名字的值按顺序读取
+    const FFrame& Frame = Frames.Back();
+    if (Frame.Cursor >= MySize || MyData[Frame.Cursor] == GetCloseBracket(Frame.bArray))
+    {
+        ThrowError("No more values in the current node", MyData + Frame.Cursor);
+    }
+    if (Frame.bArray)
+    {
+        return Frame.Cursor;
+    }
+    std::string_view Key;
+    return SkipKey(Frame.Cursor, Key);
+}
+
+void FJsonStreamInputArchive::FinishValue(const size_t End)
+{
+    FFrame& Frame = Frames.Back();
+    Frame.Cursor  = NextMember(End, GetCloseBracket(Frame.bArray));
+}
+
+std::string_view FJsonStreamInputArchive::TakeNumber()
+{
+    const size_t Pos = TakeValue();
+    if (MyData[Pos] == '"')
+    {
+        const size_t End = SkipString(Pos);
+        FinishValue(End);
+        return {MyData + Pos + 1, End - Pos - 2};
+    }
+    if (MyData[Pos] == '{' || MyData[Pos] == '[')
+    {
+        ThrowError("Expected a number", MyData + Pos);
+    }
+    const size_t End = SkipValue(Pos);
+    FinishValue(End);
+    return {MyData + Pos, End - Pos};
+}
+
+bool FJsonStreamInputArchive::IsKeyEqual(const std::string_view RawKey, const char* Name) const
+{
+    if (std::memchr(RawKey.data(), '\\', RawKey.size()) == nullptr)
+    {
+        return RawKey == Name;
+    }
+    std::string Decoded;
+    DecodeString(static_cast<size_t>(RawKey.data() - MyData) - 1, Decoded);
+    return Decoded == Name;
+}
+
+size_t FJsonStreamInputArchive::DecodeString(const size_t Pos, std::string& OutValue) const
+{
+    OutValue.clear();
+    size_t Cur = Pos + 1;
+    while (true)
+    {
+        const size_t Special = FindStringSpecial(MyData, Cur, MySize);
+        if (Special >= MySize)
+        {
+            ThrowError("Unterminated string", MyData + Pos);
+        }
+        OutValue.append(MyData + Cur, Special - Cur);
+        if (MyData[Special] == '"')
+        {
+            return Special + 1;
+        }
+
+        const char Escape = Special + 1 < MySize ? MyData[Special + 1] : '\0';
+        Cur               = Special + 2;
+        switch (Escape)
+        {
+        case '"':
+        case '\\':
+        case '/':
+            OutValue += Escape;
+            break;
+        case 'b':
+            OutValue += '\b';
+            break;
+        case 'f':
+            OutValue += '\f';
+            break;
+        case 'n':
+            OutValue += '\n';
+            break;
+        case 'r':
+            OutValue += '\r';
+            break;
+        case 't':
+            OutValue += '\t';
+            break;
+        case 'u':
+        {
+            UInt32 Code = 0;
+            if (!ParseHex4(MyData, Cur, MySize, Code))
+            {
+                ThrowError("Invalid unicode escape", MyData + Special);
+            }
+            Cur += 4;
+            if (Code >= 0xD800 && Code < 0xDC00)
+            {
+                // UTF-16 代理对
+                UInt32 Low = 0;
+                if (Cur + 2 > MySize || MyData[Cur] != '\\' || MyData[Cur + 1] != 'u' ||
+                    !ParseHex4(MyData, Cur + 2, MySize, Low) || Low < 0xDC00 || Low >= 0xE000)
+                {
+                    ThrowError("Invalid unicode surrogate pair", MyData + Special);
+                }
+                Code = 0x10000 + ((Code - 0xD800) << 10) + (Low - 0xDC00);
+                Cur += 6;
+            }
+            AppendUtf8(OutValue, Code);
+            break;
+        }
+        default:
+            ThrowError("Invalid escape character", MyData + Special);
+        }
+    }
+}
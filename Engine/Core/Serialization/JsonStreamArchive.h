@@ -0,0 +1,209 @@
+#pragma once
+
+#include "Core/Container/InlineArray.h"
+#include "Core/Serialization/JsonArchive.h"
+#include "Core/Serialization/Serialization.h"
+#include "Core/Utility/Macros.h"
+
+#include <charconv>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * 按需解析的 JSON 输入 Archive, 读取 FJsonOutputArchive（cereal JSON）写出的数据
+ * 不构建 DOM: 每层对象只记录下一个未读成员的位置, 按名字查找时从该位置向后扫描并跳过不需要的值,
+ * 字段按写入顺序读取时整个文本只扫描一遍; 跳过字符串与嵌套的值时使用 SSE2 一次检查 16 个字节
+ * 与 cereal::JSONInputArchive 不同, 缺少的具名字段保持默认值而不是抛出异常
+ * 数据格式不正确时抛出 cereal::Exception
+ */
+class HK_API FJsonStreamInputArchive : public cereal::InputArchive<FJsonStreamInputArchive>
+{
+public:
+    /**
+     * @param InData JSON 文本, 读取期间必须保持有效, 不要求以 0 结尾
+     * @param InSize 文本的字节数
+     */
+    FJsonStreamInputArchive(const char* InData, size_t InSize);
+    FJsonStreamInputArchive(const UInt8* InData, const size_t InSize)
+        : FJsonStreamInputArchive(reinterpret_cast<const char*>(InData), InSize)
+    {
+    }
+    ~FJsonStreamInputArchive() noexcept = default;
+
+    // 以下由 cereal 调用
+
+    /**
+     * 选中当前对象中名为 Name 的成员作为下一个读取的值
+     * @return 成员不存在时返回 false, 此时不应读取这个值
+     */
+    bool SelectMember(const char* Name);
+
+    // 进入一个对象或数组
+    void StartNode();
+    // 离开当前对象或数组, 跳过其中没有读取的成员
+    void FinishNode();
+
+    // 当前数组或对象的成员个数
+    void LoadSize(cereal::size_type& OutSize);
+
+    void LoadValue(bool& OutValue);
+    void LoadValue(std::string& OutValue);
+    void LoadValue(std::nullptr_t& OutValue);
+
+    template <typename T>
+        requires std::is_arithmetic_v<T>
+    void LoadValue(T& OutValue)
+    {
+        // cereal 把 long double 等类型写成字符串, 这里同时接受带引号的数字
+        const std::string_view Token = TakeNumber();
+        const char*            Last  = Token.data() + Token.size();
+        if constexpr (std::is_integral_v<T>)
+        {
+            if (std::from_chars(Token.data(), Last, OutValue).ptr == Last)
+            {
+                return;
+            }
+            // 整数字段写成了浮点数, 与 rapidjson 的 GetInt 不同, 这里截断而不报错
+            double Value = 0.0;
+            if (std::from_chars(Token.data(), Last, Value).ptr == Last)
+            {
+                OutValue = static_cast<T>(Value);
+                return;
+            }
+        }
+        else
+        {
+            if (std::from_chars(Token.data(), Last, OutValue).ptr == Last)
+            {
+                return;
+            }
+        }
+        ThrowError("Invalid number", Token.data());
+    }
+
+private:
+    struct FFrame
+    {
+        size_t Begin;  // 第一个成员的位置
+        size_t Cursor; // 下一个未读成员的位置, 指向结尾的括号时表示已经读完
+        bool   bArray;
+    };
+
+    static constexpr size_t NotFound = ~static_cast<size_t>(0);
+
+    [[noreturn]] void ThrowError(const char* Message, const char* Where) const;
+
+    size_t           SkipWhitespace(size_t Pos) const;
+    size_t           SkipString(size_t Pos) const;
+    size_t           SkipValue(size_t Pos) const;
+    size_t           SkipKey(size_t Pos, std::string_view& OutKey) const;
+    size_t           NextMember(size_t Pos, char Close) const;
+    size_t           TakeValue();
+    void             FinishValue(size_t End);
+    std::string_view TakeNumber();
+    bool             IsKeyEqual(std::string_view RawKey, const char* Name) const;
+    size_t           DecodeString(size_t Pos, std::string& OutValue) const;
+
+    const char*             MyData;
+    size_t                  MySize;
+    TInlineArray<FFrame, 8> Frames;                  // 元数据与配置的嵌套一般很浅, 不需要分配内存
+    size_t                  PendingValue = NotFound; // SelectMember 选中的值
+};
+
+namespace cereal
+{
+// prologue / epilogue 与 cereal::JSONInputArchive 的规则一致: 对象与数组进入新节点, 其余的值直接读取
+template <class T>
+    requires(!std::is_arithmetic_v<T> &&
+             !traits::has_minimal_base_class_serialization<T, traits::has_minimal_input_serialization,
+                                                           FJsonStreamInputArchive>::value &&
+             !traits::has_minimal_input_serialization<T, FJsonStreamInputArchive>::value)
+void prologue(FJsonStreamInputArchive& Ar, const T&)
+{
+    Ar.StartNode();
+}
+
+template <class T>
+    requires(!std::is_arithmetic_v<T> &&
+             !traits::has_minimal_base_class_serialization<T, traits::has_minimal_input_serialization,
+                                                           FJsonStreamInputArchive>::value &&
+             !traits::has_minimal_input_serialization<T, FJsonStreamInputArchive>::value)
+void epilogue(FJsonStreamInputArchive& Ar, const T&)
+{
+    Ar.FinishNode();
+}
+
+template <class T>
+void prologue(FJsonStreamInputArchive&, const NameValuePair<T>&)
+{
+}
+
+template <class T>
+void epilogue(FJsonStreamInputArchive&, const NameValuePair<T>&)
+{
+}
+
+template <class T>
+void prologue(FJsonStreamInputArchive&, const SizeTag<T>&)
+{
+}
+
+template <class T>
+void epilogue(FJsonStreamInputArchive&, const SizeTag<T>&)
+{
+}
+
+template <class CharT, class Traits, class Alloc>
+void prologue(FJsonStreamInputArchive&, const std::basic_string<CharT, Traits, Alloc>&)
+{
+}
+
+template <class CharT, class Traits, class Alloc>
+void epilogue(FJsonStreamInputArchive&, const std::basic_string<CharT, Traits, Alloc>&)
+{
+}
+
+inline void prologue(FJsonStreamInputArchive&, const std::nullptr_t&) {}
+
+inline void epilogue(FJsonStreamInputArchive&, const std::nullptr_t&) {}
+
+template <class T>
+void CEREAL_LOAD_FUNCTION_NAME(FJsonStreamInputArchive& Ar, NameValuePair<T>& Pair)
+{
+    if (Ar.SelectMember(Pair.name))
+    {
+        Ar(Pair.value);
+    }
+}
+
+template <class T>
+void CEREAL_LOAD_FUNCTION_NAME(FJsonStreamInputArchive& Ar, SizeTag<T>& Tag)
+{
+    size_type Size = 0;
+    Ar.LoadSize(Size);
+    Tag.size = static_cast<std::remove_reference_t<T>>(Size);
+}
+
+template <class T>
+    requires std::is_arithmetic_v<T>
+void CEREAL_LOAD_FUNCTION_NAME(FJsonStreamInputArchive& Ar, T& Value)
+{
+    Ar.LoadValue(Value);
+}
+
+inline void CEREAL_LOAD_FUNCTION_NAME(FJsonStreamInputArchive& Ar, std::string& Value)
+{
+    Ar.LoadValue(Value);
+}
+
+inline void CEREAL_LOAD_FUNCTION_NAME(FJsonStreamInputArchive& Ar, std::nullptr_t& Value)
+{
+    Ar.LoadValue(Value);
+}
+} // namespace cereal
+
+CEREAL_REGISTER_ARCHIVE(FJsonStreamInputArchive)
+// 与 FJsonOutputArchive 配对, cereal 通过它推导 load_minimal 的参数类型
+CEREAL_SETUP_ARCHIVE_TRAITS(FJsonStreamInputArchive, FJsonOutputArchive)
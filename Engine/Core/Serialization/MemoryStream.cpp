@@ -1,7 +1,7 @@
 #include "MemoryStream.h"
 #include <xxhash.h>
 
-FHashStreamBuf::FHashStreamBuf()
+FHashStreamBuf::FHashStreamBuf(std::streambuf* InForward) : MyForward(InForward)
 {
     MyState = XXH64_createState();
     if (MyState)
@@ -33,14 +33,27 @@ std::streamsize FHashStreamBuf::xsputn(const char* S, std::streamsize N)
     {
         XXH64_update(static_cast<XXH64_state_t*>(MyState), S, static_cast<size_t>(N));
     }
+    if (MyForward)
+    {
+        return MyForward->sputn(S, N);
+    }
     return N;
 }
 
 int FHashStreamBuf::overflow(int C)
 {
-    if (C != EOF && MyState)
+    if (C == EOF)
+    {
+        return C;
+    }
+    const char Byte = static_cast<char>(C);
+    if (MyState)
+    {
+        XXH64_update(static_cast<XXH64_state_t*>(MyState), &Byte, 1);
+    }
+    if (MyForward)
     {
-        XXH64_update(static_cast<XXH64_state_t*>(MyState), &C, 1);
+        return MyForward->sputc(Byte);
     }
     return C;
 }
@@ -52,7 +52,10 @@ private:
 class FHashStreamBuf : public std::streambuf
 {
 public:
-    FHashStreamBuf();
+    /**
+     * @param InForward 不为空时，写入的数据在计算 Hash 的同时转发到该缓冲区
+     */
+    explicit FHashStreamBuf(std::streambuf* InForward = nullptr);
     ~FHashStreamBuf() override;
 
     UInt64 GetHash() const;
@@ -62,7 +65,8 @@ protected:
     int overflow(int C) override;
 
 private:
-    void* MyState; // XXH64_state_t* 的不透明指针
+    void*           MyState;   // XXH64_state_t* 的不透明指针
+    std::streambuf* MyForward; // 转发目标，为空时不存储数据
 };
 
 /**
@@ -81,3 +85,45 @@ public:
 private:
     FHashStreamBuf MyBuf;
 };
+
+/**
+ * 写入目标流的同时计算 Hash，只需要序列化一次
+ */
+class FHashTeeOutputStream : public std::ostream
+{
+public:
+    explicit FHashTeeOutputStream(std::ostream& Target) : std::ostream(&MyBuf), MyBuf(Target.rdbuf()) {}
+
+    UInt64 GetHash() const
+    {
+        return MyBuf.GetHash();
+    }
+
+private:
+    FHashStreamBuf MyBuf;
+};
+
+/**
+ * 只读内存流缓冲区，直接从一段外部内存读取，不拷贝数据
+ */
+class FMemoryInputStreamBuf : public std::streambuf
+{
+public:
+    FMemoryInputStreamBuf(const UInt8* Data, size_t Size)
+    {
+        char* Begin = const_cast<char*>(reinterpret_cast<const char*>(Data));
+        setg(Begin, Begin, Begin + Size);
+    }
+};
+
+/**
+ * 只读内存输入流，用于从 mmap 或内存块中反序列化
+ */
+class FMemoryInputStream : public std::istream
+{
+public:
+    FMemoryInputStream(const UInt8* Data, size_t Size) : std::istream(&MyBuf), MyBuf(Data, Size) {}
+
+private:
+    FMemoryInputStreamBuf MyBuf;
+};
@@ -0,0 +1,443 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "SchemaArchive.h"
+#include "Core/Reflection/Property.h"
+#include "Core/Reflection/Type.h"
+
+#include <algorithm>
+
+using namespace HKSchemaArchiveImpl;
+
+static_assert(sizeof(FSchemaField) == 24, "FSchemaField is written to the schema table as is");
+
+namespace
+{
+size_t AlignUp(const size_t Value, const size_t Alignment)
+{
+    return (Value + Alignment - 1) / Alignment * Alignment;
+}
+} // namespace
+
+bool HKSchemaArchiveImpl::BuildLayout(FType Type, TArray<FSchemaField>& OutFields)
+{
+    OutFields.Clear();
+    if (Type == nullptr || Type->Size <= 0)
+    {
+        return false;
+    }
+
+    TArray<FProperty> Properties = Type->GetAllProperties();
+    Properties.Sort([](FProperty A, FProperty B) { return A->Offset < B->Offset; });
+
+    bool   bContiguous = true;
+    size_t End         = 0;
+    for (FProperty Property : Properties)
+    {
+        if (!Property->IsTriviallySerializable())
+        {
+            bContiguous = false;
+            continue;
+        }
+        const size_t Offset = static_cast<size_t>(Property->Offset);
+        if (Offset != AlignUp(End, std::max<size_t>(Property->Alignment, 1)))
+        {
+            bContiguous = false;
+        }
+        End = std::max(End, Offset + Property->Size);
+        OutFields.Add({HashFieldName(Property->Name.GetString().CStr()), Property->SerializedTypeHash,
+                       static_cast<UInt32>(Offset), static_cast<UInt32>(Property->Size)});
+    }
+    return bContiguous && AlignUp(End, std::max<size_t>(Type->Alignment, 1)) == static_cast<size_t>(Type->Size);
+}
+
+// ================================ FSchemaOutputArchive ================================
+
+FSchemaOutputArchive::FSchemaOutputArchive(TArray<UInt8>& InBuffer)
+    : OutputArchive(this), Buffer(InBuffer), BaseOffset(InBuffer.Size())
+{
+    const UInt32 HeaderMagic   = Magic;
+    const UInt32 HeaderVersion = Version;
+    const UInt64 TableOffset   = 0; // 析构时回填
+    SaveBinary(&HeaderMagic, sizeof(HeaderMagic));
+    SaveBinary(&HeaderVersion, sizeof(HeaderVersion));
+    SaveBinary(&TableOffset, sizeof(TableOffset));
+}
+
+FSchemaOutputArchive::~FSchemaOutputArchive() noexcept
+{
+    WriteSchemaTable();
+}
+
+void FSchemaOutputArchive::BeginObject()
+{
+    Frames.Add({GetPosition(), Depth, static_cast<UInt32>(PendingFields.Size())});
+    // Schema 索引与对象数据的长度, 对象结束时回填
+    const UInt64 Placeholder = 0;
+    SaveBinary(&Placeholder, sizeof(Placeholder));
+}
+
+void FSchemaOutputArchive::EndObject()
+{
+    const FFrame Frame = Frames.Back();
+    Frames.PopBack();
+
+    const TSpan<const FSchemaField> Fields(PendingFields.Data() + Frame.FirstField,
+                                           PendingFields.Size() - Frame.FirstField);
+    const UInt32 SchemaIndex = FindOrAddSchema(Fields, 0);
+    PendingFields.Resize(Frame.FirstField);
+
+    const size_t BodyStart = Frame.HeaderPosition + 2 * sizeof(UInt32);
+    PatchUInt32(Frame.HeaderPosition, SchemaIndex);
+    PatchUInt32(Frame.HeaderPosition + sizeof(UInt32), static_cast<UInt32>(GetPosition() - BodyStart));
+}
+
+void FSchemaOutputArchive::WriteArrayHeader(const UInt64 Count, const UInt32 LayoutId, const UInt32 ElementSize,
+                                            const UInt64 ElementTypeHash)
+{
+    SaveBinary(&Count, sizeof(Count));
+    SaveBinary(&LayoutId, sizeof(LayoutId));
+    SaveBinary(&ElementSize, sizeof(ElementSize));
+    SaveBinary(&ElementTypeHash, sizeof(ElementTypeHash));
+    if (LayoutId != ArrayElements)
+    {
+        const size_t Position = GetPosition();
+        Buffer.Resize(Buffer.Size() + AlignUp(Position, BlockAlignment) - Position, 0);
+    }
+}
+
+UInt32 FSchemaOutputArchive::FindOrAddLayout(FType Type)
+{
+    if (const UInt32* Found = LayoutIdByType.Find(Type))
+    {
+        return *Found;
+    }
+
+    TArray<FSchemaField> Fields;
+    UInt32               LayoutId = ArrayElements;
+    if (BuildLayout(Type, Fields))
+    {
+        LayoutId = FindOrAddSchema(Fields, static_cast<UInt32>(Type->Size)) + FirstLayoutId;
+    }
+    LayoutIdByType.Add(Type, LayoutId);
+    return LayoutId;
+}
+
+UInt32 FSchemaOutputArchive::FindOrAddSchema(TSpan<const FSchemaField> Fields, const UInt32 TypeSize)
+{
+    const UInt64 Key = FHashUtility::ComputeHash(Fields.Data(), Fields.Size() * sizeof(FSchemaField)) ^ TypeSize;
+    if (const UInt32* Found = SchemaIndexByKey.Find(Key))
+    {
+        const FSchema& Schema = Schemas[*Found];
+        if (Schema.TypeSize == TypeSize && Schema.FieldCount == Fields.Size() &&
+            std::equal(Fields.begin(), Fields.end(), SchemaFields.Data() + Schema.FirstField))
+        {
+            return *Found;
+        }
+    }
+
+    const UInt32 SchemaIndex = static_cast<UInt32>(Schemas.Size());
+    Schemas.Add({static_cast<UInt32>(SchemaFields.Size()), static_cast<UInt32>(Fields.Size()), TypeSize});
+    SchemaFields.Append(Fields.begin(), Fields.end());
+    // Hash 冲突时保留先登记的 Schema, 新的 Schema 只是不参与复用
+    if (!SchemaIndexByKey.Contains(Key))
+    {
+        SchemaIndexByKey.Add(Key, SchemaIndex);
+    }
+    return SchemaIndex;
+}
+
+void FSchemaOutputArchive::WriteSchemaTable()
+{
+    const UInt64 TableOffset = GetPosition();
+    std::memcpy(Buffer.Data() + BaseOffset + 2 * sizeof(UInt32), &TableOffset, sizeof(TableOffset));
+
+    const UInt32 SchemaCount = static_cast<UInt32>(Schemas.Size());
+    SaveBinary(&SchemaCount, sizeof(SchemaCount));
+    for (const FSchema& Schema : Schemas)
+    {
+        SaveBinary(&Schema.TypeSize, sizeof(Schema.TypeSize));
+        SaveBinary(&Schema.FieldCount, sizeof(Schema.FieldCount));
+        SaveBinary(SchemaFields.Data() + Schema.FirstField, Schema.FieldCount * sizeof(FSchemaField));
+    }
+}
+
+// ================================ FSchemaInputArchive ================================
+
+FSchemaInputArchive::FSchemaInputArchive(const UInt8* InData, const size_t InSize)
+    : InputArchive(this), MyData(InData), MySize(InSize)
+{
+    if (MySize < HeaderSize)
+    {
+        ThrowError("Data is too small for a schema archive");
+    }
+
+    UInt32 HeaderMagic   = 0;
+    UInt32 HeaderVersion = 0;
+    UInt64 TableOffset   = 0;
+    std::memcpy(&HeaderMagic, MyData, sizeof(HeaderMagic));
+    std::memcpy(&HeaderVersion, MyData + sizeof(UInt32), sizeof(HeaderVersion));
+    std::memcpy(&TableOffset, MyData + 2 * sizeof(UInt32), sizeof(TableOffset));
+    if (HeaderMagic != Magic)
+    {
+        ThrowError("Data is not a schema archive");
+    }
+    if (HeaderVersion != Version)
+    {
+        ThrowError("Unsupported schema archive version");
+    }
+    if (TableOffset < HeaderSize || TableOffset > MySize)
+    {
+        ThrowError("Invalid schema table offset");
+    }
+    ReadSchemaTable(static_cast<size_t>(TableOffset));
+    BodyEnd = static_cast<size_t>(TableOffset);
+}
+
+void FSchemaInputArchive::ThrowError(const char* Message)
+{
+    throw cereal::Exception(Message);
+}
+
+void FSchemaInputArchive::ReadSchemaTable(size_t TableOffset)
+{
+    // 借用 LoadBinary 的越界检查读取 Schema 表
+    Position = TableOffset;
+    BodyEnd  = MySize;
+
+    UInt32 SchemaCount = 0;
+    LoadBinary(&SchemaCount, sizeof(SchemaCount));
+    if (SchemaCount > (MySize - Position) / (2 * sizeof(UInt32)))
+    {
+        ThrowError("Invalid schema count");
+    }
+    Schemas.Reserve(SchemaCount);
+    for (UInt32 Index = 0; Index < SchemaCount; ++Index)
+    {
+        FSchema Schema{static_cast<UInt32>(SchemaFields.Size()), 0, 0};
+        LoadBinary(&Schema.TypeSize, sizeof(Schema.TypeSize));
+        LoadBinary(&Schema.FieldCount, sizeof(Schema.FieldCount));
+        if (Schema.FieldCount > (MySize - Position) / sizeof(FSchemaField))
+        {
+            ThrowError("Invalid schema field count");
+        }
+        SchemaFields.Resize(SchemaFields.Size() + Schema.FieldCount);
+        LoadBinary(SchemaFields.Data() + Schema.FirstField, Schema.FieldCount * sizeof(FSchemaField));
+        if (Schema.TypeSize != 0)
+        {
+            // 布局 Schema 中的字段之后会按偏移直接拷贝, 不能超出元素的范围
+            for (UInt32 FieldIndex = 0; FieldIndex < Schema.FieldCount; ++FieldIndex)
+            {
+                const FSchemaField& Field = SchemaFields[Schema.FirstField + FieldIndex];
+                if (static_cast<UInt64>(Field.Offset) + Field.Size > Schema.TypeSize)
+                {
+                    ThrowError("Layout field exceeds the element size");
+                }
+            }
+        }
+        Schemas.Add(Schema);
+    }
+    Position = HeaderSize;
+}
+
+void FSchemaInputArchive::BeginObject()
+{
+    UInt32 SchemaIndex = 0;
+    UInt32 BodySize    = 0;
+    LoadBinary(&SchemaIndex, sizeof(SchemaIndex));
+    LoadBinary(&BodySize, sizeof(BodySize));
+    if (SchemaIndex >= Schemas.Size() || Schemas[SchemaIndex].TypeSize != 0)
+    {
+        ThrowError("Invalid object schema");
+    }
+    const size_t Limit = Frames.IsEmpty() ? BodyEnd : Frames.Back().BodyEnd;
+    if (Position > Limit || BodySize > Limit - Position)
+    {
+        ThrowError("Object size exceeds the data");
+    }
+    Frames.Add({Depth, SchemaIndex, Position, Position + BodySize, 0, NotFound});
+}
+
+void FSchemaInputArchive::EndObject()
+{
+    // 直接跳到对象结尾, 当前类型已经删除的字段不会被读取
+    const FFrame& Frame = Frames.Back();
+    Position            = Frame.BodyEnd;
+    if (Frame.FirstOffset != NotFound)
+    {
+        FieldOffsets.Resize(Frame.FirstOffset);
+    }
+    Frames.PopBack();
+}
+
+UInt32 FSchemaInputArchive::FindField(const FFrame& Frame, const UInt64 NameHash) const
+{
+    // 字段一般按写入的顺序读取, 从游标开始查找通常第一个就命中
+    const FSchema&      Schema = Schemas[Frame.SchemaIndex];
+    const FSchemaField* Fields = SchemaFields.Data() + Schema.FirstField;
+    for (UInt32 Index = Frame.Cursor; Index < Schema.FieldCount; ++Index)
+    {
+        if (Fields[Index].NameHash == NameHash)
+        {
+            return Index;
+        }
+    }
+    for (UInt32 Index = 0; Index < std::min(Frame.Cursor, Schema.FieldCount); ++Index)
+    {
+        if (Fields[Index].NameHash == NameHash)
+        {
+            return Index;
+        }
+    }
+    return NotFound;
+}
+
+size_t FSchemaInputArchive::GetFieldOffset(const size_t FrameIndex, const UInt32 FieldIndex)
+{
+    FFrame& Frame = Frames[FrameIndex];
+    if (Frame.FirstOffset == NotFound)
+    {
+        // 乱序读取时才计算所有字段的偏移
+        const FSchema& Schema = Schemas[Frame.SchemaIndex];
+        Frame.FirstOffset     = static_cast<UInt32>(FieldOffsets.Size());
+        size_t Offset         = Frame.BodyStart;
+        for (UInt32 Index = 0; Index < Schema.FieldCount; ++Index)
+        {
+            FieldOffsets.Add(Offset);
+            const FSchemaField& Field = SchemaFields[Schema.FirstField + Index];
+            size_t              Size  = Field.Size;
+            if (Size == 0)
+            {
+                if (sizeof(UInt32) > Frame.BodyEnd - Offset)
+                {
+                    ThrowError("Field size exceeds the object");
+                }
+                UInt32 VariableSize = 0;
+                std::memcpy(&VariableSize, MyData + Offset, sizeof(VariableSize));
+                Size = sizeof(UInt32) + VariableSize;
+            }
+            if (Size > Frame.BodyEnd - Offset)
+            {
+                ThrowError("Field size exceeds the object");
+            }
+            Offset += Size;
+        }
+    }
+    return FieldOffsets[Frame.FirstOffset + FieldIndex];
+}
+
+FSchemaInputArchive::FArrayHeader FSchemaInputArchive::ReadArrayHeader()
+{
+    FArrayHeader Header{};
+    LoadBinary(&Header.Count, sizeof(Header.Count));
+    LoadBinary(&Header.LayoutId, sizeof(Header.LayoutId));
+    LoadBinary(&Header.ElementSize, sizeof(Header.ElementSize));
+    LoadBinary(&Header.ElementTypeHash, sizeof(Header.ElementTypeHash));
+    return Header;
+}
+
+const UInt8* FSchemaInputArchive::ReadArrayBlock(const FArrayHeader& Header)
+{
+    const size_t BlockStart = AlignUp(Position, BlockAlignment);
+    if (BlockStart > BodyEnd)
+    {
+        ThrowError("Unexpected end of data");
+    }
+    Position = BlockStart;
+    if (Header.ElementSize == 0 || Header.Count > (BodyEnd - Position) / Header.ElementSize)
+    {
+        ThrowError("Array size exceeds the data");
+    }
+    const UInt8* Block = MyData + Position;
+    Position += static_cast<size_t>(Header.Count) * Header.ElementSize;
+    return Block;
+}
+
+const FSchema& FSchemaInputArchive::GetLayoutSchema(const UInt32 LayoutId) const
+{
+    const UInt32 SchemaIndex = LayoutId - FirstLayoutId;
+    if (LayoutId < FirstLayoutId || SchemaIndex >= Schemas.Size() || Schemas[SchemaIndex].TypeSize == 0)
+    {
+        ThrowError("Invalid array layout");
+    }
+    return Schemas[SchemaIndex];
+}
+
+bool FSchemaInputArchive::IsLayoutIdentical(const UInt32 LayoutId, FType Type, const size_t TypeSize) const
+{
+    if (LayoutId < FirstLayoutId)
+    {
+        return false;
+    }
+    const FSchema& Schema = GetLayoutSchema(LayoutId);
+    if (Schema.TypeSize != TypeSize)
+    {
+        return false;
+    }
+    TArray<FSchemaField> Fields;
+    if (!BuildLayout(Type, Fields) || Fields.Size() != Schema.FieldCount)
+    {
+        return false;
+    }
+    return std::equal(Fields.begin(), Fields.end(), SchemaFields.Data() + Schema.FirstField);
+}
+
+void FSchemaInputArchive::CopyLayoutElements(const FArrayHeader& Header, FType Type, const UInt8* Source,
+                                             void* Destination, const size_t DestinationStride,
+                                             const bool bTriviallyCopyable) const
+{
+    const FSchema& Schema = GetLayoutSchema(Header.LayoutId);
+    if (Header.ElementSize != Schema.TypeSize)
+    {
+        ThrowError("Array element size does not match its layout");
+    }
+
+    const size_t Count = static_cast<size_t>(Header.Count);
+    UInt8*       Target = static_cast<UInt8*>(Destination);
+    if (bTriviallyCopyable && IsLayoutIdentical(Header.LayoutId, Type, DestinationStride))
+    {
+        std::memcpy(Target, Source, Count * DestinationStride);
+        return;
+    }
+
+    // 布局变化, 按字段名、大小与类型匹配, 相邻的字段合并为一次拷贝; 其余字段保持默认值
+    struct FCopyRun
+    {
+        UInt32 SourceOffset;
+        UInt32 TargetOffset;
+        UInt32 Size;
+    };
+    TArray<FSchemaField> Fields;
+    BuildLayout(Type, Fields);
+    TArray<FCopyRun>    Runs;
+    const FSchemaField* SavedFields = SchemaFields.Data() + Schema.FirstField;
+    for (const FSchemaField& Field : Fields)
+    {
+        const FSchemaField* Saved = std::find_if(SavedFields, SavedFields + Schema.FieldCount,
+                                                 [&](const FSchemaField& Other) { return Other.Matches(Field); });
+        if (Saved == SavedFields + Schema.FieldCount)
+        {
+            continue;
+        }
+        if (!Runs.IsEmpty() && Runs.Back().SourceOffset + Runs.Back().Size == Saved->Offset &&
+            Runs.Back().TargetOffset + Runs.Back().Size == Field.Offset)
+        {
+            Runs.Back().Size += Field.Size;
+        }
+        else
+        {
+            Runs.Add({Saved->Offset, Field.Offset, Field.Size});
+        }
+    }
+
+    for (size_t Index = 0; Index < Count; ++Index)
+    {
+        const UInt8* SourceElement = Source + Index * Header.ElementSize;
+        UInt8*       TargetElement = Target + Index * DestinationStride;
+        for (const FCopyRun& Run : Runs)
+        {
+            std::memcpy(TargetElement + Run.TargetOffset, SourceElement + Run.SourceOffset, Run.Size);
+        }
+    }
+}
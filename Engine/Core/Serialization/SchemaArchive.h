@@ -0,0 +1,542 @@
+#pragma once
+
+#include "Core/Container/Array.h"
+#include "Core/Container/Map.h"
+#include "Core/Container/Span.h"
+#include "Core/Reflection/ReflectionFwd.h"
+#include "Core/Serialization/Serialization.h"
+#include "Core/Utility/HashUtility.h"
+#include "Core/Utility/Macros.h"
+#include "Core/Utility/TypeTraits.h"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace HKSchemaArchiveImpl
+{
+constexpr UInt32 Magic      = 0x41534B48; // "HKSA"
+constexpr UInt32 Version    = 2;
+constexpr size_t HeaderSize = 16; // Magic, Version, Schema 表的偏移
+// 整块写入的数组数据相对数据起点按此对齐, 从映射的内存中可以直接访问
+constexpr size_t BlockAlignment = 16;
+
+// 数组的存储方式, 大于等于 FirstLayoutId 时为布局 Schema 的索引加 FirstLayoutId
+constexpr UInt32 ArrayElements = 0; // 逐个元素序列化
+constexpr UInt32 ArrayPlain    = 1; // 平凡可序列化的元素, 整块拷贝
+constexpr UInt32 FirstLayoutId = 2; // HSTRUCT 元素, 按布局 Schema 整块拷贝
+
+constexpr UInt32 NotFound = ~0u;
+
+struct FSchemaField
+{
+    UInt64 NameHash;
+    UInt64 TypeHash; // 平凡可序列化字段的类型名 Hash, 见 TSerializedTypeHash; 变长字段为 0
+    UInt32 Offset;   // 字段在结构体中的偏移, 只用于布局 Schema
+    UInt32 Size;     // 对象 Schema 中为 0 表示变长字段, 数据前带 UInt32 长度
+
+    bool operator==(const FSchemaField&) const = default;
+
+    // 名字、大小与类型都相同时才把保存的字段读入当前字段
+    bool Matches(const FSchemaField& Other) const
+    {
+        return NameHash == Other.NameHash && TypeHash == Other.TypeHash && Size == Other.Size;
+    }
+};
+
+/**
+ * 对象 Schema 记录一个反射对象依次写入的字段; 布局 Schema 记录 HSTRUCT 的内存布局, 用于整块拷贝的数组
+ */
+struct FSchema
+{
+    UInt32 FirstField;
+    UInt32 FieldCount;
+    UInt32 TypeSize; // 0 表示对象 Schema, 否则为布局 Schema 对应类型的大小
+};
+
+/**
+ * 根据反射信息生成结构体的内存布局
+ * @return 结构体的每个字节都属于平凡可序列化的属性（对齐填充除外）时返回 true, 此时可以整块拷贝
+ */
+HK_API bool BuildLayout(FType Type, TArray<FSchemaField>& OutFields);
+
+inline UInt64 HashFieldName(const char* Name)
+{
+    return FHashUtility::ComputeHash(Name);
+}
+} // namespace HKSchemaArchiveImpl
+
+/**
+ * 带 Schema 的二进制输出 Archive
+ * 反射对象（HCLASS / HSTRUCT）的字段按名字 Hash 记录在数据末尾的 Schema 表中, 每个对象只写入 Schema 索引与字段数据,
+ * 读取时按名字匹配字段, 增删 HPROPERTY 之后旧数据依然可以读取; 平凡可序列化的字段同时记录类型名 Hash, 改变类型的字段不会被误读
+ * 平凡可序列化的字段直接拷贝内存, 不带长度; TArray 中平凡可序列化的元素, 以及所有属性都平凡可序列化的 HSTRUCT
+ * 整块拷贝, 布局变化时读取端按字段名重新映射
+ * 数据追加到 Buffer 中, 析构时写入 Schema 表, 析构之后 Buffer 中才是完整的数据
+ */
+class HK_API FSchemaOutputArchive
+    : public cereal::OutputArchive<FSchemaOutputArchive, cereal::AllowEmptyClassElision>
+{
+public:
+    static constexpr bool bSupportsBlockArrays = true;
+
+    explicit FSchemaOutputArchive(TArray<UInt8>& InBuffer);
+    ~FSchemaOutputArchive() noexcept;
+
+    void SaveBinary(const void* Data, size_t Size)
+    {
+        const UInt8* Bytes = static_cast<const UInt8*>(Data);
+        Buffer.Append(Bytes, Bytes + Size);
+    }
+
+    /**
+     * 写入连续数组, TArray 序列化时调用; 写入的数据可以用 FSchemaInputArchive::TryLoadArrayView 直接访问
+     */
+    template <typename T>
+    void SaveArray(const T* Data, size_t Count)
+    {
+        UInt32 LayoutId = HKSchemaArchiveImpl::ArrayElements;
+        if constexpr (TIsTriviallySerializableV<T>)
+        {
+            LayoutId = HKSchemaArchiveImpl::ArrayPlain;
+        }
+        else if constexpr (CReflectedStruct<T> && std::is_trivially_copyable_v<T>)
+        {
+            LayoutId = FindOrAddLayout(T::GetType());
+        }
+
+        const UInt64 ElementTypeHash =
+            LayoutId == HKSchemaArchiveImpl::ArrayPlain ? TSerializedTypeHash<T>::Value : UInt64{0};
+        WriteArrayHeader(Count, LayoutId, sizeof(T), ElementTypeHash);
+        if (LayoutId != HKSchemaArchiveImpl::ArrayElements)
+        {
+            SaveBinary(Data, Count * sizeof(T));
+            return;
+        }
+        for (size_t Index = 0; Index < Count; ++Index)
+        {
+            (*this)(Data[Index]);
+        }
+    }
+
+    // 以下由 cereal 调用
+    template <typename T>
+    void BeginValue(const T&)
+    {
+        ++Depth;
+        if constexpr (CReflectedType<T>)
+        {
+            BeginObject();
+        }
+    }
+
+    template <typename T>
+    void EndValue(const T&)
+    {
+        if constexpr (CReflectedType<T>)
+        {
+            EndObject();
+        }
+        --Depth;
+    }
+
+    template <typename T>
+    void SaveField(const char* Name, const T& Value)
+    {
+        if (!IsDirectField())
+        {
+            // 不属于反射对象的具名值（例如 FVector3f 的分量）直接写入, 由外层字段的长度界定
+            (*this)(Value);
+            return;
+        }
+
+        const UInt64 NameHash = HKSchemaArchiveImpl::HashFieldName(Name);
+        if constexpr (TIsTriviallySerializableV<T>)
+        {
+            SaveBinary(std::addressof(Value), sizeof(T));
+            PendingFields.Add({NameHash, TSerializedTypeHash<T>::Value, 0, static_cast<UInt32>(sizeof(T))});
+        }
+        else
+        {
+            const size_t SizePosition = GetPosition();
+            const UInt32 Placeholder  = 0;
+            SaveBinary(&Placeholder, sizeof(Placeholder));
+            (*this)(Value);
+            PatchUInt32(SizePosition, static_cast<UInt32>(GetPosition() - SizePosition - sizeof(UInt32)));
+            // 在字段数据之后登记, 嵌套对象的字段此时已经从 PendingFields 中移除
+            PendingFields.Add({NameHash, 0, 0, 0});
+        }
+    }
+
+private:
+    struct FFrame
+    {
+        size_t HeaderPosition;
+        UInt32 Depth;
+        UInt32 FirstField;
+    };
+
+    // 具名值直接属于最内层的反射对象, 而不是对象中某个字段的内部
+    bool IsDirectField() const
+    {
+        return !Frames.IsEmpty() && Depth == Frames.Back().Depth + 1;
+    }
+
+    size_t GetPosition() const
+    {
+        return Buffer.Size() - BaseOffset;
+    }
+
+    void PatchUInt32(size_t Position, UInt32 Value)
+    {
+        std::memcpy(Buffer.Data() + BaseOffset + Position, &Value, sizeof(Value));
+    }
+
+    void   BeginObject();
+    void   EndObject();
+    void   WriteArrayHeader(UInt64 Count, UInt32 LayoutId, UInt32 ElementSize, UInt64 ElementTypeHash);
+    UInt32 FindOrAddLayout(FType Type);
+    UInt32 FindOrAddSchema(TSpan<const HKSchemaArchiveImpl::FSchemaField> Fields, UInt32 TypeSize);
+    void   WriteSchemaTable();
+
+    TArray<UInt8>&                            Buffer;
+    size_t                                    BaseOffset;
+    UInt32                                    Depth = 0;
+    TArray<FFrame>                            Frames;
+    TArray<HKSchemaArchiveImpl::FSchemaField> PendingFields; // 所有未结束对象已写入的字段
+    TArray<HKSchemaArchiveImpl::FSchema>      Schemas;
+    TArray<HKSchemaArchiveImpl::FSchemaField> SchemaFields;
+    TMap<UInt64, UInt32>                      SchemaIndexByKey;
+    TMap<FType, UInt32>                       LayoutIdByType;
+};
+
+/**
+ * 带 Schema 的二进制输入 Archive, 直接从一段内存读取, 不拷贝数据
+ * 对象中缺少的字段保持默认值, 多余的字段被跳过; 字段的类型变化后无法解释的数据同样跳过, 字段保持默认值
+ * 数据格式不正确时抛出 cereal::Exception
+ */
+class HK_API FSchemaInputArchive : public cereal::InputArchive<FSchemaInputArchive, cereal::AllowEmptyClassElision>
+{
+public:
+    static constexpr bool bSupportsBlockArrays = true;
+
+    /**
+     * @param InData 完整的数据, 读取期间必须保持有效; 使用 TryLoadArrayView 时起始地址至少按 16 字节对齐
+     * @param InSize 数据的字节数
+     */
+    FSchemaInputArchive(const UInt8* InData, size_t InSize);
+    ~FSchemaInputArchive() noexcept = default;
+
+    void LoadBinary(void* Data, size_t Size)
+    {
+        if (Size > BodyEnd - Position)
+        {
+            ThrowError("Unexpected end of data");
+        }
+        std::memcpy(Data, MyData + Position, Size);
+        Position += Size;
+    }
+
+    /**
+     * 读取连续数组, TArray 序列化时调用
+     * @param Resize 接受元素个数, 返回调整大小后的元素指针, 元素需要已经默认构造
+     */
+    template <typename T, typename ResizeFunc>
+    void LoadArray(ResizeFunc&& Resize)
+    {
+        const FArrayHeader Header = ReadArrayHeader();
+        if (Header.LayoutId == HKSchemaArchiveImpl::ArrayElements)
+        {
+            if constexpr (!std::is_empty_v<T>)
+            {
+                // 每个元素至少占一个字节, 避免损坏的数据申请过多内存
+                if (Header.Count > BodyEnd - Position)
+                {
+                    ThrowError("Array size exceeds the data");
+                }
+            }
+            T* Elements = Resize(static_cast<size_t>(Header.Count));
+            for (UInt64 Index = 0; Index < Header.Count; ++Index)
+            {
+                (*this)(Elements[Index]);
+            }
+            return;
+        }
+
+        const UInt8* Block = ReadArrayBlock(Header);
+        if (Header.LayoutId == HKSchemaArchiveImpl::ArrayPlain)
+        {
+            if constexpr (TIsTriviallySerializableV<T>)
+            {
+                if (Header.ElementSize == sizeof(T) && Header.ElementTypeHash == TSerializedTypeHash<T>::Value)
+                {
+                    T* Elements = Resize(static_cast<size_t>(Header.Count));
+                    std::memcpy(static_cast<void*>(Elements), Block, static_cast<size_t>(Header.Count) * sizeof(T));
+                    return;
+                }
+            }
+        }
+        else if constexpr (CReflectedStruct<T>)
+        {
+            T* Elements = Resize(static_cast<size_t>(Header.Count));
+            CopyLayoutElements(Header, T::GetType(), Block, Elements, sizeof(T), std::is_trivially_copyable_v<T>);
+            return;
+        }
+        // 元素类型与保存时不同, 数据已经跳过, 数组保持为空
+        Resize(0);
+    }
+
+    /**
+     * 不拷贝地读取 SaveArray 写入的数组, 返回的 Span 指向构造时传入的内存
+     * 元素的布局与写入时不同或地址没有对齐时返回 false 且不消耗数据, 此时应改为读取到 TArray 中
+     */
+    template <typename T>
+        requires(TIsTriviallySerializableV<T> || (CReflectedStruct<T> && std::is_trivially_copyable_v<T>))
+    bool TryLoadArrayView(TSpan<const T>& OutView)
+    {
+        const size_t       SavedPosition = Position;
+        const FArrayHeader Header        = ReadArrayHeader();
+        bool bMatches = Header.LayoutId != HKSchemaArchiveImpl::ArrayElements && Header.ElementSize == sizeof(T);
+        if constexpr (TIsTriviallySerializableV<T>)
+        {
+            bMatches = bMatches && Header.LayoutId == HKSchemaArchiveImpl::ArrayPlain &&
+                       Header.ElementTypeHash == TSerializedTypeHash<T>::Value;
+        }
+        else
+        {
+            bMatches = bMatches && IsLayoutIdentical(Header.LayoutId, T::GetType(), sizeof(T));
+        }
+
+        if (bMatches)
+        {
+            const UInt8* Block = ReadArrayBlock(Header);
+            if (reinterpret_cast<uintptr_t>(Block) % alignof(T) == 0)
+            {
+                OutView = TSpan<const T>(reinterpret_cast<const T*>(Block), static_cast<size_t>(Header.Count));
+                return true;
+            }
+        }
+        Position = SavedPosition;
+        return false;
+    }
+
+    // 以下由 cereal 调用
+    template <typename T>
+    void BeginValue(const T&)
+    {
+        ++Depth;
+        if constexpr (CReflectedType<T>)
+        {
+            BeginObject();
+        }
+    }
+
+    template <typename T>
+    void EndValue(const T&)
+    {
+        if constexpr (CReflectedType<T>)
+        {
+            EndObject();
+        }
+        --Depth;
+    }
+
+    template <typename T>
+    void LoadField(const char* Name, T& Value)
+    {
+        if (!IsDirectField())
+        {
+            (*this)(Value);
+            return;
+        }
+
+        const size_t FrameIndex = Frames.Size() - 1;
+        const UInt32 FieldIndex = FindField(Frames[FrameIndex], HKSchemaArchiveImpl::HashFieldName(Name));
+        if (FieldIndex == HKSchemaArchiveImpl::NotFound)
+        {
+            // 写入之后新增的字段, 保持默认值
+            return;
+        }
+        if (FieldIndex != Frames[FrameIndex].Cursor)
+        {
+            Position = GetFieldOffset(FrameIndex, FieldIndex);
+        }
+
+        const HKSchemaArchiveImpl::FSchemaField& Field = GetField(Frames[FrameIndex], FieldIndex);
+        if (Field.Size != 0)
+        {
+            bool bLoaded = false;
+            if constexpr (TIsTriviallySerializableV<T>)
+            {
+                if (Field.Size == sizeof(T) && Field.TypeHash == TSerializedTypeHash<T>::Value)
+                {
+                    LoadBinary(std::addressof(Value), sizeof(T));
+                    bLoaded = true;
+                }
+            }
+            if (!bLoaded)
+            {
+                SkipBytes(Field.Size);
+            }
+        }
+        else
+        {
+            UInt32 Size = 0;
+            LoadBinary(&Size, sizeof(Size));
+            if (Size > Frames[FrameIndex].BodyEnd - Position)
+            {
+                ThrowError("Field size exceeds the object");
+            }
+            const size_t FieldEnd = Position + Size;
+            if constexpr (!TIsTriviallySerializableV<T>)
+            {
+                (*this)(Value);
+            }
+            Position = FieldEnd;
+        }
+        Frames[FrameIndex].Cursor = FieldIndex + 1;
+    }
+
+private:
+    struct FFrame
+    {
+        UInt32 Depth;
+        UInt32 SchemaIndex;
+        size_t BodyStart;
+        size_t BodyEnd;
+        UInt32 Cursor;      // 下一个预期读取的字段
+        UInt32 FirstOffset; // 字段偏移在 FieldOffsets 中的起点, 乱序读取时才计算
+    };
+
+    struct FArrayHeader
+    {
+        UInt64 Count;
+        UInt32 LayoutId;
+        UInt32 ElementSize;
+        UInt64 ElementTypeHash; // 只用于 ArrayPlain
+    };
+
+    bool IsDirectField() const
+    {
+        return !Frames.IsEmpty() && Depth == Frames.Back().Depth + 1;
+    }
+
+    const HKSchemaArchiveImpl::FSchemaField& GetField(const FFrame& Frame, UInt32 FieldIndex) const
+    {
+        return SchemaFields[Schemas[Frame.SchemaIndex].FirstField + FieldIndex];
+    }
+
+    void SkipBytes(size_t Size)
+    {
+        if (Size > BodyEnd - Position)
+        {
+            ThrowError("Unexpected end of data");
+        }
+        Position += Size;
+    }
+
+    [[noreturn]] static void ThrowError(const char* Message);
+
+    void         ReadSchemaTable(size_t TableOffset);
+    void         BeginObject();
+    void         EndObject();
+    UInt32       FindField(const FFrame& Frame, UInt64 NameHash) const;
+    size_t       GetFieldOffset(size_t FrameIndex, UInt32 FieldIndex);
+    FArrayHeader ReadArrayHeader();
+    const UInt8* ReadArrayBlock(const FArrayHeader& Header);
+    const HKSchemaArchiveImpl::FSchema& GetLayoutSchema(UInt32 LayoutId) const;
+    bool IsLayoutIdentical(UInt32 LayoutId, FType Type, size_t TypeSize) const;
+    void CopyLayoutElements(const FArrayHeader& Header, FType Type, const UInt8* Source, void* Destination,
+                            size_t DestinationStride, bool bTriviallyCopyable) const;
+
+    const UInt8*                              MyData;
+    size_t                                    MySize;
+    size_t                                    Position = HKSchemaArchiveImpl::HeaderSize;
+    size_t                                    BodyEnd  = 0; // 对象数据的结尾, 即 Schema 表的起点
+    UInt32                                    Depth    = 0;
+    TArray<FFrame>                            Frames;
+    TArray<size_t>                            FieldOffsets;
+    TArray<HKSchemaArchiveImpl::FSchema>      Schemas;
+    TArray<HKSchemaArchiveImpl::FSchemaField> SchemaFields;
+};
+
+namespace cereal
+{
+template <class T>
+void prologue(FSchemaOutputArchive& Ar, const T& Value)
+{
+    Ar.BeginValue(Value);
+}
+
+template <class T>
+void epilogue(FSchemaOutputArchive& Ar, const T& Value)
+{
+    Ar.EndValue(Value);
+}
+
+template <class T>
+void prologue(FSchemaInputArchive& Ar, const T& Value)
+{
+    Ar.BeginValue(Value);
+}
+
+template <class T>
+void epilogue(FSchemaInputArchive& Ar, const T& Value)
+{
+    Ar.EndValue(Value);
+}
+
+template <class T>
+    requires std::is_arithmetic_v<T>
+void CEREAL_SAVE_FUNCTION_NAME(FSchemaOutputArchive& Ar, const T& Value)
+{
+    Ar.SaveBinary(std::addressof(Value), sizeof(T));
+}
+
+template <class T>
+    requires std::is_arithmetic_v<T>
+void CEREAL_LOAD_FUNCTION_NAME(FSchemaInputArchive& Ar, T& Value)
+{
+    Ar.LoadBinary(std::addressof(Value), sizeof(T));
+}
+
+template <class T>
+void CEREAL_SAVE_FUNCTION_NAME(FSchemaOutputArchive& Ar, const NameValuePair<T>& Pair)
+{
+    Ar.SaveField(Pair.name, Pair.value);
+}
+
+template <class T>
+void CEREAL_LOAD_FUNCTION_NAME(FSchemaInputArchive& Ar, NameValuePair<T>& Pair)
+{
+    Ar.LoadField(Pair.name, Pair.value);
+}
+
+template <class T>
+void CEREAL_SAVE_FUNCTION_NAME(FSchemaOutputArchive& Ar, const SizeTag<T>& Tag)
+{
+    Ar(Tag.size);
+}
+
+template <class T>
+void CEREAL_LOAD_FUNCTION_NAME(FSchemaInputArchive& Ar, SizeTag<T>& Tag)
+{
+    Ar(Tag.size);
+}
+
+template <class T>
+void CEREAL_SAVE_FUNCTION_NAME(FSchemaOutputArchive& Ar, const BinaryData<T>& Data)
+{
+    Ar.SaveBinary(Data.data, static_cast<size_t>(Data.size));
+}
+
+template <class T>
+void CEREAL_LOAD_FUNCTION_NAME(FSchemaInputArchive& Ar, BinaryData<T>& Data)
+{
+    Ar.LoadBinary(Data.data, static_cast<size_t>(Data.size));
+}
+} // namespace cereal
+
+CEREAL_REGISTER_ARCHIVE(FSchemaOutputArchive)
+CEREAL_REGISTER_ARCHIVE(FSchemaInputArchive)
+CEREAL_SETUP_ARCHIVE_TRAITS(FSchemaInputArchive, FSchemaOutputArchive)
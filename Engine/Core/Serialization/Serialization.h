@@ -114,4 +114,11 @@ void load(Archive& ar, T& t)
 {
     t.Serialize(ar);
 }
-} // namespace cereal
\ No newline at end of file
+} // namespace cereal
+// =========================================================
+// 4. 连续数组整块读写
+// =========================================================
+
+// Archive 提供 SaveArray / LoadArray 时, TArray 等连续容器交给 Archive 整块读写, 见 FSchemaOutputArchive
+template <typename Archive>
+concept CBlockArrayArchive = Archive::bSupportsBlockArrays;
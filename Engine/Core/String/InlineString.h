@@ -0,0 +1,149 @@
+#pragma once
+
+#include "Core/String/String.h"
+#include "Core/String/StringView.h"
+#include "Core/Utility/Macros.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <format>
+#include <string_view>
+
+/**
+ * 容量固定的字符串, 字符直接存放在对象内部, 不分配内存, 总是以 0 结尾
+ * 用于长度有上限的临时字符串, 如 UUID 与中间文件路径
+ * 超出容量时断言并截断
+ * @tparam N 最多容纳的字符数, 不含结尾的 0
+ */
+template <size_t N>
+class TInlineString
+{
+public:
+    static constexpr size_t Capacity = N;
+
+    TInlineString() = default;
+    explicit TInlineString(const FStringView InStr)
+    {
+        Append(InStr);
+    }
+
+    void Append(const FStringView Str)
+    {
+        const size_t Count = std::min(Str.Size(), N - MyLength);
+        HK_ASSERT_MSG_RAW(Count == Str.Size(), "TInlineString<%zu> overflow", N);
+        std::memcpy(MyData + MyLength, Str.Data(), Count);
+        MyLength += Count;
+        MyData[MyLength] = '\0';
+    }
+    void Append(const char* Str)
+    {
+        Append(FStringView(Str));
+    }
+    void Append(const char Ch)
+    {
+        HK_ASSERT_MSG_RAW(MyLength < N, "TInlineString<%zu> overflow", N);
+        if (MyLength < N)
+        {
+            MyData[MyLength++] = Ch;
+            MyData[MyLength]   = '\0';
+        }
+    }
+
+    template <typename... Args>
+    void AppendFormat(std::format_string<Args...> Fmt, Args&&... InArgs)
+    {
+        const auto Result = std::format_to_n(MyData + MyLength, N - MyLength, Fmt, std::forward<Args>(InArgs)...);
+        HK_ASSERT_MSG_RAW(static_cast<size_t>(Result.size) <= N - MyLength, "TInlineString<%zu> overflow", N);
+        MyLength         = static_cast<size_t>(Result.out - MyData);
+        MyData[MyLength] = '\0';
+    }
+
+    TInlineString& operator+=(const FStringView Str)
+    {
+        Append(Str);
+        return *this;
+    }
+    TInlineString& operator+=(const char* Str)
+    {
+        Append(Str);
+        return *this;
+    }
+    TInlineString& operator+=(const char Ch)
+    {
+        Append(Ch);
+        return *this;
+    }
+
+    /**
+     * 直接写入内部缓冲区, Writer 接收写入位置并返回写入结束的位置, 最多写入 Count 个字符
+     * 用于 FUuid::ToChars 这类向调用方缓冲区输出的函数, 省去中间的一次拷贝
+     */
+    template <typename WriterType>
+    void AppendWith(const size_t Count, WriterType&& Writer)
+    {
+        HK_ASSERT_MSG_RAW(Count <= N - MyLength, "TInlineString<%zu> overflow", N);
+        if (Count > N - MyLength)
+        {
+            return;
+        }
+        const char* End  = Writer(MyData + MyLength);
+        MyLength         = static_cast<size_t>(End - MyData);
+        MyData[MyLength] = '\0';
+    }
+
+    void Clear() noexcept
+    {
+        MyLength  = 0;
+        MyData[0] = '\0';
+    }
+
+    const char* Data() const noexcept
+    {
+        return MyData;
+    }
+    const char* CStr() const noexcept
+    {
+        return MyData;
+    }
+    size_t Size() const noexcept
+    {
+        return MyLength;
+    }
+    size_t Length() const noexcept
+    {
+        return MyLength;
+    }
+    bool IsEmpty() const noexcept
+    {
+        return MyLength == 0;
+    }
+
+    FStringView ToView() const noexcept
+    {
+        return FStringView(MyData, MyLength);
+    }
+    operator FStringView() const noexcept
+    {
+        return ToView();
+    }
+    std::string_view GetStdStringView() const noexcept
+    {
+        return std::string_view(MyData, MyLength);
+    }
+
+    // 需要长期保存时复制为 FString
+    FString ToString() const
+    {
+        return FString(MyData, MyLength);
+    }
+
+    bool operator==(const FStringView Other) const noexcept
+    {
+        return GetStdStringView() == Other.GetStdStringView();
+    }
+
+private:
+    char   MyData[N + 1] = {};
+    size_t MyLength      = 0;
+};
@@ -6,7 +6,7 @@ FName::FName(const char* InStr)
 {
     if (InStr != nullptr)
     {
-        ID = GetOrCreateID(FString(InStr));
+        ID = GetOrCreateID(FStringView(InStr));
     }
     else
     {
@@ -16,7 +16,7 @@ FName::FName(const char* InStr)
 
 FName::FName(const std::string& InStr)
 {
-    ID = GetOrCreateID(FString(InStr));
+    ID = GetOrCreateID(FStringView(InStr));
 }
 
 FName::FName(const FString& InStr)
@@ -26,7 +26,7 @@ FName::FName(const FString& InStr)
 
 FName::FName(const FStringView& InView)
 {
-    ID = GetOrCreateID(FString(InView.Data(), InView.Size()));
+    ID = GetOrCreateID(InView);
 }
 
 const FString& FName::GetString() const
@@ -50,20 +50,23 @@ FName::FNameTable& FName::GetNameTableInstance()
     return Table;
 }
 
-FName::FIDType FName::GetOrCreateID(const FString& InStr)
+FName::FIDType FName::GetOrCreateID(const FStringView InStr)
 {
     auto& Table = GetNameTableInstance();
     std::lock_guard<std::mutex> Lock(Table.Mutex);
 
-    const auto It = Table.StringToID.find(InStr);
-    if (It != Table.StringToID.end())
+    if (const FIDType* Found = Table.StringToID.Find(InStr))
     {
-        return It->second;
+        return *Found;
     }
 
+    // 只有第一次出现的名字才分配字符串
     const FIDType NewID = Table.NextID++;
-    Table.StringToID[InStr] = NewID;
-    Table.IDToString[NewID] = InStr;
+    FString       Str(InStr);
+    Table.StringToID.Add(Str, NewID);
+    Table.IDToString[NewID] = std::move(Str);
+    Table.Charge.Resize(Table.Charge.GetBytes() +
+                        static_cast<Int64>(2 * (sizeof(FString) + InStr.Size() + 1) + 2 * sizeof(FIDType)));
     return NewID;
 }
 
@@ -71,16 +74,17 @@ void FName::ClearNameTable()
 {
     auto& Table = GetNameTableInstance();
     std::lock_guard<std::mutex> Lock(Table.Mutex);
-    Table.StringToID.clear();
+    Table.StringToID.Clear();
     Table.IDToString.clear();
     Table.NextID = 1;
+    Table.Charge.Resize(0);
 }
 
 size_t FName::GetNameTableSize()
 {
     auto& Table = GetNameTableInstance();
     std::lock_guard<std::mutex> Lock(Table.Mutex);
-    return Table.StringToID.size();
+    return Table.StringToID.Size();
 }
 
 const std::unordered_map<FName::FIDType, FString>& FName::GetNameTable()
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Core/Container/Map.h"
+#include "Core/Memory/MemoryStats.h"
 #include "Core/Serialization/Serialization.h"
 #include "Core/String/String.h"
 #include "Core/Utility/Macros.h"
@@ -88,7 +90,7 @@ public:
 
     void ReadPrimitive(const std::string& InStr)
     {
-        ID = GetOrCreateID(FString(InStr));
+        ID = GetOrCreateID(FStringView(InStr));
     }
 
 private:
@@ -96,14 +98,16 @@ private:
 
     struct FNameTable
     {
-        std::unordered_map<FString, FIDType> StringToID;
+        // 可以直接用 FStringView 查找, 已存在的名字不需要构造 FString
+        TMap<FString, FIDType>               StringToID;
         std::unordered_map<FIDType, FString> IDToString;
         FIDType                              NextID = 1;
         std::mutex                           Mutex;
+        FMemoryCharge                        Charge{EMemoryTag::NameTable, 0}; // 两份字符串与 ID 的估算用量
     };
 
     static FNameTable& GetNameTableInstance();
-    static FIDType     GetOrCreateID(const FString& InStr);
+    static FIDType     GetOrCreateID(FStringView InStr);
 };
 
 namespace Names
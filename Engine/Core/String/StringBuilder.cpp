@@ -0,0 +1,130 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "StringBuilder.h"
+
+#include "Core/Memory/LinearAllocator.h"
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace
+{
+// 日志与路径拼接通常在 1 KB 以内, 用量超过时由 FLinearAllocator 追加块并在重置时合并
+constexpr size_t ScratchChunkSize = 16 * 1024;
+
+struct FScratchArena
+{
+    FScratchArena();
+    ~FScratchArena();
+
+    FLinearAllocator Allocator{ScratchChunkSize, EMemoryTag::String};
+    UInt32           ActiveBuilders = 0;
+};
+
+enum class EScratchArenaState : UInt8
+{
+    Uninitialized,
+    Alive,
+    Destroyed,
+};
+
+// 与 FThreadCacheAllocator 相同: 平凡类型的 thread_local 在内存池析构之后依然可以访问
+thread_local EScratchArenaState GScratchArenaState = EScratchArenaState::Uninitialized;
+thread_local FScratchArena      GScratchArena;
+
+FScratchArena::FScratchArena()
+{
+    GScratchArenaState = EScratchArenaState::Alive;
+}
+
+FScratchArena::~FScratchArena()
+{
+    GScratchArenaState = EScratchArenaState::Destroyed;
+}
+
+FScratchArena* GetScratchArena()
+{
+    if (GScratchArenaState == EScratchArenaState::Destroyed)
+    {
+        return nullptr;
+    }
+    return &GScratchArena;
+}
+
+char* AllocateBuffer(const size_t Capacity, const bool bScratch)
+{
+    if (bScratch)
+    {
+        return static_cast<char*>(GScratchArena.Allocator.Allocate(Capacity + 1, 1));
+    }
+    return static_cast<char*>(::operator new(Capacity + 1));
+}
+} // namespace
+
+FStringBuilder::FStringBuilder(const size_t InCapacity) : MyCapacity(std::max<size_t>(InCapacity, 1))
+{
+    FScratchArena* Arena = GetScratchArena();
+    bScratch             = Arena != nullptr;
+    if (bScratch)
+    {
+        ++Arena->ActiveBuilders;
+    }
+    MyData    = AllocateBuffer(MyCapacity, bScratch);
+    MyData[0] = '\0';
+}
+
+FStringBuilder::~FStringBuilder()
+{
+    if (!bScratch)
+    {
+        ::operator delete(MyData);
+        return;
+    }
+    // 最外层的构建器销毁时一次性回收, 嵌套使用的构建器不会互相覆盖
+    FScratchArena* Arena = GetScratchArena();
+    if (Arena != nullptr && --Arena->ActiveBuilders == 0)
+    {
+        Arena->Allocator.Reset();
+    }
+}
+
+void FStringBuilder::Append(const FStringView Str)
+{
+    if (MyLength + Str.Size() > MyCapacity)
+    {
+        Reserve(MyLength + Str.Size());
+    }
+    std::memcpy(MyData + MyLength, Str.Data(), Str.Size());
+    MyLength += Str.Size();
+    MyData[MyLength] = '\0';
+}
+
+void FStringBuilder::Append(const char Ch)
+{
+    if (MyLength == MyCapacity)
+    {
+        Reserve(MyLength + 1);
+    }
+    MyData[MyLength++] = Ch;
+    MyData[MyLength]   = '\0';
+}
+
+void FStringBuilder::Reserve(const size_t InCapacity)
+{
+    if (InCapacity <= MyCapacity)
+    {
+        return;
+    }
+    // 线性分配无法原地扩展, 按倍数增长, 旧缓冲区在内存池重置时一并回收
+    const size_t NewCapacity = std::max(InCapacity, MyCapacity * 2);
+    char*        NewData     = AllocateBuffer(NewCapacity, bScratch);
+    std::memcpy(NewData, MyData, MyLength + 1);
+    if (!bScratch)
+    {
+        ::operator delete(MyData);
+    }
+    MyData     = NewData;
+    MyCapacity = NewCapacity;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Core/String/String.h"
+#include "Core/String/StringView.h"
+#include "Core/Utility/Macros.h"
+
+#include <cstddef>
+#include <format>
+#include <string_view>
+
+/**
+ * 拼接临时字符串用的构建器, 内存来自当前线程的临时内存池（线性分配）
+ * 同一线程上所有构建器都销毁后内存池整体重置, 之后同样用量的拼接不再向系统申请内存
+ * 只能作为局部变量使用, 不能跨线程传递; 结果需要长期保存时用 ToString 复制为 FString
+ */
+class HK_API FStringBuilder
+{
+public:
+    static constexpr size_t DefaultCapacity = 256;
+
+    explicit FStringBuilder(size_t InCapacity = DefaultCapacity);
+    ~FStringBuilder();
+
+    FStringBuilder(const FStringBuilder&)            = delete;
+    FStringBuilder& operator=(const FStringBuilder&) = delete;
+
+    void Append(FStringView Str);
+    void Append(const char* Str)
+    {
+        Append(FStringView(Str));
+    }
+    void Append(char Ch);
+
+    template <typename... Args>
+    void AppendFormat(std::format_string<Args...> Fmt, Args&&... InArgs)
+    {
+        // 先按剩余容量格式化, 放不下时扩容后重新格式化一次
+        const size_t Remaining = MyCapacity - MyLength;
+        const auto   Result    = std::format_to_n(MyData + MyLength, Remaining, Fmt, InArgs...);
+        const size_t Count     = static_cast<size_t>(Result.size);
+        if (Count > Remaining)
+        {
+            Reserve(MyLength + Count);
+            std::format_to_n(MyData + MyLength, Count, Fmt, InArgs...);
+        }
+        MyLength += Count;
+        MyData[MyLength] = '\0';
+    }
+
+    FStringBuilder& operator+=(const FStringView Str)
+    {
+        Append(Str);
+        return *this;
+    }
+    FStringBuilder& operator+=(const char* Str)
+    {
+        Append(Str);
+        return *this;
+    }
+    FStringBuilder& operator+=(const char Ch)
+    {
+        Append(Ch);
+        return *this;
+    }
+
+    /**
+     * 保证至少能容纳 InCapacity 个字符（不含结尾的 0）
+     */
+    void Reserve(size_t InCapacity);
+
+    void Clear() noexcept
+    {
+        MyLength  = 0;
+        MyData[0] = '\0';
+    }
+
+    // 以 0 结尾, 在构建器销毁或下一次扩容前有效
+    const char* CStr() const noexcept
+    {
+        return MyData;
+    }
+    size_t Length() const noexcept
+    {
+        return MyLength;
+    }
+    bool IsEmpty() const noexcept
+    {
+        return MyLength == 0;
+    }
+
+    FStringView ToView() const noexcept
+    {
+        return FStringView(MyData, MyLength);
+    }
+    operator FStringView() const noexcept
+    {
+        return ToView();
+    }
+    std::string_view GetStdStringView() const noexcept
+    {
+        return std::string_view(MyData, MyLength);
+    }
+
+    FString ToString() const
+    {
+        return FString(MyData, MyLength);
+    }
+
+private:
+    char*  MyData;
+    size_t MyLength = 0;
+    size_t MyCapacity; // 不含结尾的 0
+    bool   bScratch;   // 线程退出阶段临时内存池已经析构时改用堆内存
+};
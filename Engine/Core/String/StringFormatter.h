@@ -1,7 +1,9 @@
 #pragma once
 
+#include "Core/String/InlineString.h"
 #include "Core/String/Name.h"
 #include "Core/String/String.h"
+#include "Core/String/StringBuilder.h"
 #include "Core/String/StringView.h"
 #include <fmt/compile.h>
 #include <fmt/format.h>
@@ -39,3 +41,25 @@ struct std::formatter<FName> : std::formatter<std::string>
         return std::formatter<std::string>::format(Name.GetStdString(), Ctx);
     }
 };
+
+// TInlineString的fmt格式化支持
+template <size_t N>
+struct std::formatter<TInlineString<N>> : std::formatter<std::string_view>
+{
+    template <typename FormatContext>
+    auto format(const TInlineString<N>& Str, FormatContext& Ctx) const -> decltype(Ctx.out())
+    {
+        return std::formatter<std::string_view>::format(Str.GetStdStringView(), Ctx);
+    }
+};
+
+// FStringBuilder的fmt格式化支持
+template <>
+struct std::formatter<FStringBuilder> : std::formatter<std::string_view>
+{
+    template <typename FormatContext>
+    auto format(const FStringBuilder& Builder, FormatContext& Ctx) const -> decltype(Ctx.out())
+    {
+        return std::formatter<std::string_view>::format(Builder.GetStdStringView(), Ctx);
+    }
+};
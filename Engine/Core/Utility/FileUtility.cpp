@@ -152,3 +152,22 @@ bool FFileUtility::FileExists(const std::filesystem::path& FilePath)
     return std::filesystem::exists(FilePath) && std::filesystem::is_regular_file(FilePath);
 }
 
+bool FFileUtility::ReadFileBytes(const FStringView& FilePath, TArray<UInt8>& OutData)
+{
+    std::ifstream FileStream(FilePath.GetStdString(), std::ios::in | std::ios::binary | std::ios::ate);
+    if (!FileStream.is_open())
+    {
+        HK_LOG_ERROR(ELogcat::Engine, "Failed to open file for reading: {}", FilePath);
+        return false;
+    }
+
+    const std::streamsize FileSize = FileStream.tellg();
+    if (FileSize < 0)
+    {
+        return false;
+    }
+    OutData.Resize(static_cast<size_t>(FileSize));
+    FileStream.seekg(0, std::ios::beg);
+    FileStream.read(reinterpret_cast<char*>(OutData.Data()), FileSize);
+    return FileStream.gcount() == FileSize;
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Core/Container/Array.h"
 #include "Core/String/String.h"
 #include "Core/String/StringView.h"
 #include "Core/Utility/UniquePtr.h"
@@ -141,5 +142,13 @@ public:
      * @return 是否存在
      */
     static bool FileExists(const std::filesystem::path& FilePath);
+
+    /**
+     * 一次性读取整个文件
+     * @param FilePath 文件路径
+     * @param OutData 文件内容
+     * @return 成功返回 true，文件不存在或读取失败返回 false
+     */
+    static bool ReadFileBytes(const FStringView& FilePath, TArray<UInt8>& OutData);
 };
 
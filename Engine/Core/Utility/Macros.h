@@ -116,6 +116,14 @@ using AutoLock = std::scoped_lock<Args...>;
 #endif
 #endif
 
+// SIMD 指令集检测, x64 上 SSE2 总是可用; AVX2 需要编译器开启（/arch:AVX2 或 -mavx2）
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#define HK_SIMD_SSE2 1
+#endif
+#if defined(__AVX2__)
+#define HK_SIMD_AVX2 1
+#endif
+
 // 原始Assert宏（直接使用标准库，不依赖Logger）
 // 用于Container、Utility、String等基础类型
 #ifdef HK_DEBUG
@@ -0,0 +1,172 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "MappedFile.h"
+#include "Core/Logging/Logger.h"
+
+#ifdef HK_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+FMappedFile::~FMappedFile()
+{
+    Close();
+}
+
+FMappedFile::FMappedFile(FMappedFile&& Other) noexcept : MyData(Other.MyData), MySize(Other.MySize)
+{
+#ifdef HK_WINDOWS
+    MyFileHandle          = Other.MyFileHandle;
+    MyMappingHandle       = Other.MyMappingHandle;
+    Other.MyFileHandle    = nullptr;
+    Other.MyMappingHandle = nullptr;
+#endif
+    Other.MyData = nullptr;
+    Other.MySize = 0;
+}
+
+FMappedFile& FMappedFile::operator=(FMappedFile&& Other) noexcept
+{
+    if (this != &Other)
+    {
+        Close();
+        MyData = Other.MyData;
+        MySize = Other.MySize;
+#ifdef HK_WINDOWS
+        MyFileHandle          = Other.MyFileHandle;
+        MyMappingHandle       = Other.MyMappingHandle;
+        Other.MyFileHandle    = nullptr;
+        Other.MyMappingHandle = nullptr;
+#endif
+        Other.MyData = nullptr;
+        Other.MySize = 0;
+    }
+    return *this;
+}
+
+bool FMappedFile::Open(FStringView FilePath)
+{
+    Close();
+    const std::string PathStr = FilePath.GetStdString();
+
+#ifdef HK_WINDOWS
+    HANDLE File = CreateFileA(PathStr.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (File == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER FileSize;
+    if (!GetFileSizeEx(File, &FileSize) || FileSize.QuadPart == 0)
+    {
+        CloseHandle(File);
+        return false;
+    }
+
+    HANDLE Mapping = CreateFileMappingA(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (Mapping == nullptr)
+    {
+        HK_LOG_ERROR(ELogcat::Engine, "Failed to create file mapping: {}", PathStr);
+        CloseHandle(File);
+        return false;
+    }
+
+    const void* View = MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+    if (View == nullptr)
+    {
+        HK_LOG_ERROR(ELogcat::Engine, "Failed to map view of file: {}", PathStr);
+        CloseHandle(Mapping);
+        CloseHandle(File);
+        return false;
+    }
+
+    MyFileHandle    = File;
+    MyMappingHandle = Mapping;
+    MyData          = static_cast<const UInt8*>(View);
+    MySize          = static_cast<size_t>(FileSize.QuadPart);
+#else
+    const int File = open(PathStr.c_str(), O_RDONLY);
+    if (File < 0)
+    {
+        return false;
+    }
+
+    struct stat FileStat;
+    if (fstat(File, &FileStat) != 0 || FileStat.st_size == 0)
+    {
+        close(File);
+        return false;
+    }
+
+    void* View = mmap(nullptr, static_cast<size_t>(FileStat.st_size), PROT_READ, MAP_PRIVATE, File, 0);
+    // 映射建立后即可关闭文件描述符
+    close(File);
+    if (View == MAP_FAILED)
+    {
+        HK_LOG_ERROR(ELogcat::Engine, "Failed to mmap file: {}", PathStr);
+        return false;
+    }
+
+    MyData = static_cast<const UInt8*>(View);
+    MySize = static_cast<size_t>(FileStat.st_size);
+#endif
+    return true;
+}
+
+void FMappedFile::Close()
+{
+#ifdef HK_WINDOWS
+    if (MyData != nullptr)
+    {
+        UnmapViewOfFile(MyData);
+    }
+    if (MyMappingHandle != nullptr)
+    {
+        CloseHandle(MyMappingHandle);
+        MyMappingHandle = nullptr;
+    }
+    if (MyFileHandle != nullptr)
+    {
+        CloseHandle(MyFileHandle);
+        MyFileHandle = nullptr;
+    }
+#else
+    if (MyData != nullptr)
+    {
+        munmap(const_cast<UInt8*>(MyData), MySize);
+    }
+#endif
+    MyData = nullptr;
+    MySize = 0;
+}
+
+void FMappedFile::Prefetch(size_t Offset, size_t Length) const
+{
+    if (MyData == nullptr || Offset >= MySize || Length == 0)
+    {
+        return;
+    }
+    if (Length > MySize - Offset)
+    {
+        Length = MySize - Offset;
+    }
+
+#ifdef HK_WINDOWS
+    WIN32_MEMORY_RANGE_ENTRY Range;
+    Range.VirtualAddress = const_cast<UInt8*>(MyData + Offset);
+    Range.NumberOfBytes  = Length;
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &Range, 0);
+#else
+    // madvise 要求起始地址按页对齐
+    const size_t PageSize    = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t AlignedFrom = Offset & ~(PageSize - 1);
+    madvise(const_cast<UInt8*>(MyData + AlignedFrom), Length + (Offset - AlignedFrom), MADV_WILLNEED);
+#endif
+}
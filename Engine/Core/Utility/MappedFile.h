@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Core/String/StringView.h"
+#include "Core/Utility/Macros.h"
+
+/**
+ * 只读内存映射文件
+ * Windows 下使用 CreateFileMapping，其他平台使用 mmap
+ * RAII：析构时自动解除映射
+ */
+class HK_API FMappedFile
+{
+public:
+    FMappedFile() = default;
+    ~FMappedFile();
+
+    FMappedFile(const FMappedFile&)            = delete;
+    FMappedFile& operator=(const FMappedFile&) = delete;
+
+    FMappedFile(FMappedFile&& Other) noexcept;
+    FMappedFile& operator=(FMappedFile&& Other) noexcept;
+
+    /**
+     * 以只读方式映射文件
+     * @param FilePath 文件路径
+     * @return 成功返回 true，文件不存在或映射失败返回 false
+     */
+    bool Open(FStringView FilePath);
+
+    /**
+     * 解除映射并关闭文件
+     */
+    void Close();
+
+    bool IsOpen() const
+    {
+        return MyData != nullptr;
+    }
+
+    const UInt8* Data() const
+    {
+        return MyData;
+    }
+
+    size_t Size() const
+    {
+        return MySize;
+    }
+
+    /**
+     * 提示操作系统预读一段映射区域，不会阻塞等待读取完成
+     * 批量读取时按偏移排序后依次调用，可以让磁盘读取尽量顺序进行
+     * @param Offset 相对文件起始位置的偏移
+     * @param Length 长度，超出文件大小的部分会被截断
+     */
+    void Prefetch(size_t Offset, size_t Length) const;
+
+private:
+    const UInt8* MyData = nullptr;
+    size_t       MySize = 0;
+#ifdef HK_WINDOWS
+    void* MyFileHandle    = nullptr;
+    void* MyMappingHandle = nullptr;
+#endif
+};
@@ -50,6 +50,12 @@
 // 内存释放跟踪
 #define HK_PROFILE_FREE(Ptr) TracyFree(Ptr)
 
+// 命名内存池分配跟踪, Tracy 中按 Name 分别统计, Name 必须是常量字符串
+#define HK_PROFILE_ALLOC_N(Ptr, Size, Name) TracyAllocN(Ptr, Size, Name)
+
+// 命名内存池释放跟踪, Name 必须与分配时相同
+#define HK_PROFILE_FREE_N(Ptr, Name) TracyFreeN(Ptr, Name)
+
 // Malloc 内存分配跟踪
 inline void* Malloc(size_t Size)
 {
@@ -155,6 +161,8 @@ void DeleteArray(T* Ptr)
 #define HK_PROFILE_PLOT_F(Name, Value) ((void)0)
 #define HK_PROFILE_ALLOC(Ptr, Size) ((void)0)
 #define HK_PROFILE_FREE(Ptr) ((void)0)
+#define HK_PROFILE_ALLOC_N(Ptr, Size, Name) ((void)0)
+#define HK_PROFILE_FREE_N(Ptr, Name) ((void)0)
 #define HK_PROFILE_SET_THREAD_NAME(Name) ((void)0)
 #define HK_PROFILE_LOCKABLE(Type, VarName) Type VarName
 #define HK_PROFILE_LOCKABLE_N(Type, VarName, Name) Type VarName
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <type_traits>
 
 // 辅助类型特征：检查是否为非 const 引用
@@ -38,3 +39,67 @@ struct HasNonConstReference<First, Rest...>
 {
 };
 
+
+/**
+ * 类型的内存表示是否可以直接作为序列化数据, 读写时整块拷贝, 不经过逐字段的序列化函数
+ * 默认只包含算术类型与枚举; 其它平凡可拷贝且不含指针、句柄的类型可以特化为 true
+ */
+template <typename T>
+struct TIsTriviallySerializable : std::bool_constant<std::is_arithmetic_v<T> || std::is_enum_v<T>>
+{
+};
+
+template <typename T>
+constexpr bool TIsTriviallySerializableV = TIsTriviallySerializable<T>::value;
+
+/**
+ * 编译期计算的 64 位 FNV-1a 字符串 Hash, 结果与平台和编译器无关
+ * @param Seed 初始值, 传入另一个 Hash 可以把多个名字串联起来
+ */
+constexpr uint64_t ComputeConstHash(const char* Str, uint64_t Seed = 14695981039346656037ull)
+{
+    for (; *Str != '\0'; ++Str)
+    {
+        Seed = (Seed ^ static_cast<uint8_t>(*Str)) * 1099511628211ull;
+    }
+    return Seed;
+}
+
+/**
+ * 平凡可序列化类型的类型名 Hash, 与平台和编译器无关, 带 Schema 的 Archive 用它区分大小相同但类型不同的字段
+ * 算术类型按位宽命名, 与反射注册的基础类型名一致 (Int32、Float 等); 枚举统一命名为 Enum
+ * 为其它类型特化 TIsTriviallySerializable 时应同时特化本模板, 否则 Value 为 0, 同样大小的此类字段之间不区分类型
+ */
+template <typename T>
+struct TSerializedTypeHash
+{
+    static constexpr uint64_t Value = [] {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            return ComputeConstHash("Bool");
+        }
+        else if constexpr (std::is_same_v<T, char>)
+        {
+            return ComputeConstHash("Char");
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            return ComputeConstHash(sizeof(T) == 4 ? "Float" : sizeof(T) == 8 ? "Double" : "LongDouble");
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            constexpr const char* SignedNames[]   = {"Int8", "Int16", "Int32", "Int64"};
+            constexpr const char* UnsignedNames[] = {"UInt8", "UInt16", "UInt32", "UInt64"};
+            constexpr size_t      Index           = sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 3;
+            return ComputeConstHash(std::is_signed_v<T> ? SignedNames[Index] : UnsignedNames[Index]);
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            return ComputeConstHash("Enum");
+        }
+        else
+        {
+            return uint64_t{0};
+        }
+    }();
+};
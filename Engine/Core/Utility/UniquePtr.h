@@ -218,7 +218,7 @@ public:
         Ar(MakeNamedPair("TypeName", TypeName));
         if (TypeName != Names::None)
         {
-            if (const FType Type = FTypeManager::FindTypeByName(TypeName); !Type)
+            if (const FType Type = FTypeManager::Get().FindTypeByName(TypeName); !Type)
             {
                 HK_LOG_ERROR(ELogcat::Serialize, "Can't find type {}", TypeName);
             }
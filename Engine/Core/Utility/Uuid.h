@@ -1,6 +1,7 @@
 #pragma once
 #define UUID_SYSTEM_GENERATOR
 #include "Core/Logging/Logger.h"
+#include "Core/String/InlineString.h"
 #include "Core/String/String.h"
 #include "Macros.h"
 #include "stduuid/uuid.h"
@@ -42,9 +43,43 @@ struct FUuid
         return std::hash<uuids::uuid>{}(Uuid);
     }
 
+    // 字符串形式的长度, 形如 xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx
+    static constexpr size_t StringLength = 36;
+
+    /**
+     * 以小写十六进制写入调用方的缓冲区, 格式与 uuids::to_string 相同, 不写结尾的 0
+     * @param OutBuffer 至少 StringLength 个字节
+     * @return 写入结束的位置
+     */
+    char* ToChars(char* OutBuffer) const
+    {
+        constexpr char Digits[] = "0123456789abcdef";
+        const auto     Bytes    = Uuid.as_bytes();
+        for (size_t Index = 0; Index < Bytes.size(); ++Index)
+        {
+            // 第 4, 6, 8, 10 个字节之前插入分隔符
+            if (Index == 4 || Index == 6 || Index == 8 || Index == 10)
+            {
+                *OutBuffer++ = '-';
+            }
+            const auto Byte = static_cast<UInt8>(Bytes[Index]);
+            *OutBuffer++    = Digits[Byte >> 4];
+            *OutBuffer++    = Digits[Byte & 0x0F];
+        }
+        return OutBuffer;
+    }
+
+    TInlineString<StringLength> ToInlineString() const
+    {
+        TInlineString<StringLength> Result;
+        Result.AppendWith(StringLength, [this](char* Out) { return ToChars(Out); });
+        return Result;
+    }
+
     FString ToString() const
     {
-        return uuids::to_string(Uuid);
+        char Buffer[StringLength];
+        return FString(Buffer, static_cast<size_t>(ToChars(Buffer) - Buffer));
     }
 
     // ------------------------------------------------------------
@@ -54,7 +89,8 @@ struct FUuid
     // 1. 返回基础类型 (std::string)
     std::string WritePrimitive() const
     {
-        return uuids::to_string(Uuid);
+        char Buffer[StringLength];
+        return std::string(Buffer, ToChars(Buffer));
     }
 
     // 2. 接收基础类型 (std::string)
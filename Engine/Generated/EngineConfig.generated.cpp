@@ -32,7 +32,8 @@ HK_API void FEngineConfig::Z_EngineConfig_Register::Register_FEngineConfig()
         Super::Serialize(Ar); \
         Ar( \
         MakeNamedPair("DefaultObjectCount", DefaultObjectCount), \
-        MakeNamedPair("DefaultObjectIncreaseCount", DefaultObjectIncreaseCount) \
+        MakeNamedPair("DefaultObjectIncreaseCount", DefaultObjectIncreaseCount), \
+        MakeNamedPair("AssetDirectory", AssetDirectory) \
         ); \
 
 
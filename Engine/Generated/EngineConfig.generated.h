@@ -22,9 +22,12 @@
     {                                                                                        \
         Type->RegisterProperty(&FEngineConfig::DefaultObjectCount, "DefaultObjectCount");                                                                                        \
         Type->RegisterProperty(&FEngineConfig::DefaultObjectIncreaseCount, "DefaultObjectIncreaseCount");                                                                                        \
+        Type->RegisterProperty(&FEngineConfig::AssetDirectory, "AssetDirectory");                                                                                        \
     }                                                                                        \
     Int32 GetDefaultObjectCount() const { return DefaultObjectCount; }                                                                                        \
     void SetDefaultObjectCount(Int32 InValue) { DefaultObjectCount = InValue; }                                                                                        \
     Int32 GetDefaultObjectIncreaseCount() const { return DefaultObjectIncreaseCount; }                                                                                        \
     void SetDefaultObjectIncreaseCount(Int32 InValue) { DefaultObjectIncreaseCount = InValue; }                                                                                        \
+    const FString& GetAssetDirectory() const { return AssetDirectory; }                                                                                        \
+    void SetAssetDirectory(const FString& InValue) { AssetDirectory = InValue; }                                                                                        \
     static inline Z_EngineConfig_Register Z_REGISTERER_ENGINECONFIG;
@@ -23,6 +23,9 @@ static void Z_Register_EGfxBackend_Impl()
     // 注册枚举成员: GLES
     Type->RegisterEnumMember(EGfxBackend::GLES, "GLES");
 
+    // 注册枚举成员: Null
+    Type->RegisterEnumMember(EGfxBackend::Null, "Null");
+
     // 注册枚举成员: Count
     Type->RegisterEnumMember(EGfxBackend::Count, "Count");
 
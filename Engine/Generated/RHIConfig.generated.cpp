@@ -32,7 +32,9 @@ void FRHIConfig::Z_RHIConfig_Register::Register_FRHIConfig()
         Super::Serialize(Ar); \
         Ar( \
         MakeNamedPair("DefaultWindowSize", DefaultWindowSize), \
-        MakeNamedPair("GfxBackend", GfxBackend) \
+        MakeNamedPair("GfxBackend", GfxBackend), \
+        MakeNamedPair("bNullDeviceOffscreen", bNullDeviceOffscreen), \
+        MakeNamedPair("NullDeviceLatencyMicroseconds", NullDeviceLatencyMicroseconds) \
         ); \
 
 
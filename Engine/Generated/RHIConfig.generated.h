@@ -22,6 +22,8 @@
     {                                                                                        \
         Type->RegisterProperty(&FRHIConfig::DefaultWindowSize, "DefaultWindowSize");                                                                                        \
         Type->RegisterProperty(&FRHIConfig::GfxBackend, "GfxBackend");                                                                                        \
+        Type->RegisterProperty(&FRHIConfig::bNullDeviceOffscreen, "bNullDeviceOffscreen");                                                                                        \
+        Type->RegisterProperty(&FRHIConfig::NullDeviceLatencyMicroseconds, "NullDeviceLatencyMicroseconds");                                                                                        \
     }                                                                                        \
     const FVector2i& GetDefaultWindowSize() const { return DefaultWindowSize; }                                                                                        \
     void SetDefaultWindowSize(const FVector2i& InValue) { DefaultWindowSize = InValue; }                                                                                        \
@@ -32,7 +32,10 @@ void FRenderConfig::Z_RenderConfig_Register::Register_FRenderConfig()
         Super::Serialize(Ar); \
         Ar( \
         MakeNamedPair("ShaderPaths", ShaderPaths), \
-        MakeNamedPair("CommitStyle", CommitStyle) \
+        MakeNamedPair("CommitStyle", CommitStyle), \
+        MakeNamedPair("FramesInFlight", FramesInFlight), \
+        MakeNamedPair("bEnableGPUCulling", bEnableGPUCulling), \
+        MakeNamedPair("bValidateGPUCulling", bValidateGPUCulling) \
         ); \
 
 
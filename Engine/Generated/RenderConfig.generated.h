@@ -22,9 +22,14 @@
     {                                                                                        \
         Type->RegisterProperty(&FRenderConfig::ShaderPaths, "ShaderPaths");                                                                                        \
         Type->RegisterProperty(&FRenderConfig::CommitStyle, "CommitStyle");                                                                                        \
+        Type->RegisterProperty(&FRenderConfig::FramesInFlight, "FramesInFlight");                                                                                        \
+        Type->RegisterProperty(&FRenderConfig::bEnableGPUCulling, "bEnableGPUCulling");                                                                                        \
+        Type->RegisterProperty(&FRenderConfig::bValidateGPUCulling, "bValidateGPUCulling");                                                                                        \
     }                                                                                        \
     const ERenderCommandCommitStyle& GetCommitStyle() const { return CommitStyle; }                                                                                        \
     void SetCommitStyle(const ERenderCommandCommitStyle& InValue) { CommitStyle = InValue; }                                                                                        \
+    UInt32 GetFramesInFlight() const { return FramesInFlight; }                                                                                        \
+    void SetFramesInFlight(UInt32 InValue) { FramesInFlight = InValue; }                                                                                        \
     static inline Z_RenderConfig_Register Z_REGISTERER_RENDERCONFIG;
 
 HK_API void Z_Register_ERenderCommandCommitStyle();
@@ -52,7 +52,8 @@
             MakeNamedPair("bNeedCamera", bNeedCamera),                                                                                     \
             MakeNamedPair("bNeedModel", bNeedModel),                                                                                     \
             MakeNamedPair("bNeedResourcePool", bNeedResourcePool),                                                                                     \
-            MakeNamedPair("PushConstants", PushConstants)                                                                                      \
+            MakeNamedPair("PushConstants", PushConstants),                                                                                     \
+            MakeNamedPair("MaterialParameters", MaterialParameters)                                                                                      \
         );                                                                                                             \
     }                                                                                                                  \
     static void Register_FShaderParameterSheet_Properties(FTypeMutable Type)                                                                                        \
@@ -61,6 +62,7 @@
         Type->RegisterProperty(&FShaderParameterSheet::bNeedModel, "bNeedModel");                                                                                        \
         Type->RegisterProperty(&FShaderParameterSheet::bNeedResourcePool, "bNeedResourcePool");                                                                                        \
         Type->RegisterProperty(&FShaderParameterSheet::PushConstants, "PushConstants");                                                                                        \
+        Type->RegisterProperty(&FShaderParameterSheet::MaterialParameters, "MaterialParameters");                                                                                        \
     }                                                                                        \
     static inline Z_ShaderParameterSheet_Register Z_REGISTERER_SHADERPARAMETERSHEET;
 
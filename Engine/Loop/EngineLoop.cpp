@@ -5,13 +5,21 @@
 #include "EngineLoop.h"
 #include "Config/ConfigManager.h"
 #include "Core/Logging/Logger.h"
+#include "Core/Memory/LinearAllocator.h"
+#include "Core/Memory/MemoryBudget.h"
+#include "Core/Memory/MemoryStats.h"
 #include "Core/Utility/Profiler.h"
 #include "EngineLoopEvents.h"
 #include "LoopData.h"
+#include "Object/AssetManager.h"
+#include "Object/AssetPak.h"
+#include "Object/AssetRegistry.h"
+#include "Object/IntermediateCache.h"
 #include "RHI/GfxDevice.h"
 #include "RHI/RHIWindow.h"
 #include "Render/RenderContext.h"
 #include "Render/Shader/SlangTranslator.h"
+#include "TaskGraph/TaskGraph.h"
 
 void FEngineLoop::Init()
 {
@@ -56,8 +64,18 @@ void FEngineLoop::UnInit()
 {
     HK_PROFILE_SCOPE_N("FEngineLoop::UnInit");
 
+    // 等待Render线程上的最后一帧结束，再停止所有 Executor，最后销毁异步加载依赖的 AssetManager
+    FRenderContext::GetRef().FlushRendering();
+    FTaskGraph::Destroy();
+    FAssetManager::Destroy();
+    FAssetPakManager::Destroy();
+    FIntermediateCache::Destroy();
+    // 将本次运行中改动的资产元数据写回注册表数据库
+    FAssetRegistry::Destroy();
     DestroyGfxDevice();
     FConfigManager::Destroy();
+    FMemoryBudget::Destroy();
+    FFrameAllocator::Destroy();
 
     bIsRunning = false;
     HK_LOG_INFO(ELogcat::Engine, "引擎循环清理完成");
@@ -111,6 +129,9 @@ void FEngineLoop::Tick()
     // 触发Tick事件
     GEngineLoopEvents.OnTick.Invoke();
 
+    // 执行派发到Game线程的任务（如异步加载完成回调）
+    FTaskGraph::GetRef().Tick();
+
     // 调用输入Tick函数
     if (InputTickFunc != nullptr)
     {
@@ -118,7 +139,7 @@ void FEngineLoop::Tick()
         InputTickFunc();
     }
 
-    // 调用渲染Tick函数
+    // 调用渲染Tick函数，多线程渲染时只生成快照并派发到Render线程
     if (RenderTickFunc != nullptr)
     {
         HK_PROFILE_SCOPE_N("RenderTick");
@@ -132,4 +153,10 @@ void FEngineLoop::PostTick()
 
     // 触发PostTick事件
     GEngineLoopEvents.OnPostTick.Invoke();
+
+    // 帧内存在重置前上报与检查预算, 曲线和 CSV 上能看到整帧的用量
+    FMemoryStats::ReportToProfiler();
+    FMemoryBudget::GetRef().Tick();
+    FFrameAllocator::GetRef().Reset();
+    FMemoryStats::EndFrame();
 }
\ No newline at end of file
@@ -0,0 +1,114 @@
+#pragma once
+#include "Matrix.h"
+#include "Vector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/////////////////////////////////////////////////////////////////////////////////
+// TBox3 - 轴对齐包围盒
+/////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+struct TBox3
+{
+    TVector3<T> Min;
+    TVector3<T> Max;
+
+    // 默认构造为空包围盒（Min > Max），任何点扩展后都会变为有效
+    TBox3() : Min(std::numeric_limits<T>::max()), Max(std::numeric_limits<T>::lowest()) {}
+    TBox3(const TVector3<T>& InMin, const TVector3<T>& InMax) : Min(InMin), Max(InMax) {}
+
+    static TBox3 FromCenterExtent(const TVector3<T>& Center, const TVector3<T>& Extent)
+    {
+        return TBox3(Center - Extent, Center + Extent);
+    }
+
+    bool IsValid() const
+    {
+        return Min.X <= Max.X && Min.Y <= Max.Y && Min.Z <= Max.Z;
+    }
+
+    TVector3<T> GetCenter() const
+    {
+        return (Min + Max) * static_cast<T>(0.5);
+    }
+
+    // 半边长
+    TVector3<T> GetExtent() const
+    {
+        return (Max - Min) * static_cast<T>(0.5);
+    }
+
+    // 表面积, 用于 BVH 的 SAH 代价
+    T GetSurfaceArea() const
+    {
+        const TVector3<T> Size = Max - Min;
+        return static_cast<T>(2) * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+    }
+
+    void Expand(const TVector3<T>& Point)
+    {
+        Min = TVector3<T>(std::min(Min.X, Point.X), std::min(Min.Y, Point.Y), std::min(Min.Z, Point.Z));
+        Max = TVector3<T>(std::max(Max.X, Point.X), std::max(Max.Y, Point.Y), std::max(Max.Z, Point.Z));
+    }
+
+    void Expand(const TBox3& Other)
+    {
+        Min = TVector3<T>(std::min(Min.X, Other.Min.X), std::min(Min.Y, Other.Min.Y), std::min(Min.Z, Other.Min.Z));
+        Max = TVector3<T>(std::max(Max.X, Other.Max.X), std::max(Max.Y, Other.Max.Y), std::max(Max.Z, Other.Max.Z));
+    }
+
+    static TBox3 Union(const TBox3& A, const TBox3& B)
+    {
+        TBox3 Result = A;
+        Result.Expand(B);
+        return Result;
+    }
+
+    // 向各个方向扩大 Margin
+    TBox3 Inflate(T Margin) const
+    {
+        return TBox3(Min - TVector3<T>(Margin), Max + TVector3<T>(Margin));
+    }
+
+    bool Contains(const TBox3& Other) const
+    {
+        return Min.X <= Other.Min.X && Min.Y <= Other.Min.Y && Min.Z <= Other.Min.Z && Other.Max.X <= Max.X &&
+               Other.Max.Y <= Max.Y && Other.Max.Z <= Max.Z;
+    }
+
+    bool Intersects(const TBox3& Other) const
+    {
+        return Min.X <= Other.Max.X && Other.Min.X <= Max.X && Min.Y <= Other.Max.Y && Other.Min.Y <= Max.Y &&
+               Min.Z <= Other.Max.Z && Other.Min.Z <= Max.Z;
+    }
+
+    /**
+     * 用仿射矩阵变换包围盒, 结果仍为轴对齐包围盒（Arvo 方法, 不需要变换 8 个角点）
+     * @param Matrix 列主序矩阵, 作用于列向量
+     */
+    TBox3 TransformBy(const TMatrix4x4<T>& Matrix) const
+    {
+        if (!IsValid())
+        {
+            return *this;
+        }
+        const TVector3<T> Center = GetCenter();
+        const TVector3<T> Extent = GetExtent();
+        T                 NewCenter[3];
+        T                 NewExtent[3];
+        for (int Row = 0; Row < 3; ++Row)
+        {
+            NewCenter[Row] = Matrix(Row, 0) * Center.X + Matrix(Row, 1) * Center.Y + Matrix(Row, 2) * Center.Z +
+                             Matrix(Row, 3);
+            NewExtent[Row] = std::abs(Matrix(Row, 0)) * Extent.X + std::abs(Matrix(Row, 1)) * Extent.Y +
+                             std::abs(Matrix(Row, 2)) * Extent.Z;
+        }
+        return FromCenterExtent(TVector3<T>(NewCenter[0], NewCenter[1], NewCenter[2]),
+                                TVector3<T>(NewExtent[0], NewExtent[1], NewExtent[2]));
+    }
+};
+
+typedef TBox3<float>  FBox3f;
+typedef TBox3<double> FBox3d;
@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Utility/Macros.h"
+#include "Core/Utility/TypeTraits.h"
 #include <cmath>
 #include <glm/glm.hpp>
 #include <glm/gtc/epsilon.hpp>
@@ -190,6 +191,17 @@ typedef TVector2<double> FVector2d;
 typedef TVector2<Int32> FVector2i;
 typedef TVector2<UInt32> FVector2u;
 
+template <typename T>
+struct TIsTriviallySerializable<TVector2<T>> : TIsTriviallySerializable<T>
+{
+};
+
+template <typename T>
+struct TSerializedTypeHash<TVector2<T>>
+{
+    static constexpr uint64_t Value = ComputeConstHash("Vector2", TSerializedTypeHash<T>::Value);
+};
+
 struct FVECTOR2_REGISTER
 {
     HK_API static void Regsiter();
@@ -396,6 +408,17 @@ typedef TVector3<double> FVector3d;
 typedef TVector3<Int32> FVector3i;
 typedef TVector3<UInt32> FVector3u;
 
+template <typename T>
+struct TIsTriviallySerializable<TVector3<T>> : TIsTriviallySerializable<T>
+{
+};
+
+template <typename T>
+struct TSerializedTypeHash<TVector3<T>>
+{
+    static constexpr uint64_t Value = ComputeConstHash("Vector3", TSerializedTypeHash<T>::Value);
+};
+
 struct FVECTOR3_REGISTER
 {
     HK_API static void Regsiter();
@@ -610,6 +633,17 @@ typedef TVector4<double> FVector4d;
 typedef TVector4<Int32> FVector4i;
 typedef TVector4<UInt32> FVector4u;
 
+template <typename T>
+struct TIsTriviallySerializable<TVector4<T>> : TIsTriviallySerializable<T>
+{
+};
+
+template <typename T>
+struct TSerializedTypeHash<TVector4<T>>
+{
+    static constexpr uint64_t Value = ComputeConstHash("Vector4", TSerializedTypeHash<T>::Value);
+};
+
 struct FVECTOR4_REGISTER
 {
     HK_API static void Regsiter();
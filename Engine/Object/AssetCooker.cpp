@@ -0,0 +1,221 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "AssetCooker.h"
+
+#include "AssetRegistry.h"
+#include "AssetUtility.h"
+#include "Config/ConfigManager.h"
+#include "Core/Container/Map.h"
+#include "Core/Logging/Logger.h"
+#include "Core/Memory/MemoryBudget.h"
+#include "Core/Utility/FileUtility.h"
+#include "Core/Utility/Profiler.h"
+#include "IntermediateCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace
+{
+struct FCookEntry
+{
+    FUuid             Uuid;
+    EAssetType        AssetType;
+    FString           AssetPath;
+    FIntermediatePath IntermediatePath;
+    UInt64            IntermediateHash;
+    UInt32            RecordedOrder; // 在加载顺序文件中的位置，没有记录时为 UINT32_MAX
+};
+
+/**
+ * 读取中间文件开头记录的 Hash
+ */
+bool ReadIntermediateHash(FStringView IntermediatePath, UInt64& OutHash)
+{
+    auto Stream = FFileUtility::OpenFileStream(IntermediatePath);
+    if (!Stream)
+    {
+        return false;
+    }
+    Stream->read(reinterpret_cast<char*>(&OutHash), sizeof(OutHash));
+    return Stream->gcount() == sizeof(OutHash);
+}
+} // namespace
+
+bool FAssetCooker::Run(FStringView PakPath)
+{
+    HK_PROFILE_SCOPE_N("FAssetCooker::Run");
+
+    // 注册表启动时会与资产目录下的 .meta 同步
+    FConfigManager::GetRef();
+    FAssetRegistry::GetRef();
+    const bool bSuccess = CookAssetPak(PakPath, FStringView(DefaultLoadOrderPath));
+
+    FIntermediateCache::Destroy();
+    FAssetRegistry::Destroy();
+    FConfigManager::Destroy();
+    FMemoryBudget::Destroy();
+    return bSuccess;
+}
+
+bool FAssetCooker::CookAssetPak(FStringView PakPath, FStringView LoadOrderPath, EAssetPakCompression Compression)
+{
+    HK_PROFILE_SCOPE_N("FAssetCooker::CookAssetPak");
+
+    TMap<FUuid, UInt32> RecordedOrders;
+    TArray<FUuid>       LoadOrder;
+    if (LoadLoadOrder(LoadOrderPath, LoadOrder))
+    {
+        for (UInt32 Index = 0; Index < LoadOrder.Size(); ++Index)
+        {
+            if (!RecordedOrders.Contains(LoadOrder[Index]))
+            {
+                RecordedOrders[LoadOrder[Index]] = Index;
+            }
+        }
+    }
+    else
+    {
+        HK_LOG_WARN(ELogcat::Asset, "Asset load order file not found: {}, assets are cooked in path order",
+                    LoadOrderPath);
+    }
+
+    // 1. 收集已经生成中间文件且 Hash 与元数据一致的资产
+    FAssetRegistry&    Registry = FAssetRegistry::GetRef();
+    TArray<FCookEntry> Entries;
+    Int32              NumSkipped = 0;
+    for (const FUuid& Uuid : Registry.GetAllAssetUuids())
+    {
+        const TSharedPtr<FAssetMetadata> Metadata = Registry.LoadAssetMetadata(Uuid);
+        if (!Metadata)
+        {
+            continue;
+        }
+        const FIntermediatePath IntermediatePath = FAssetUtility::GetIntermediatePath(Metadata->AssetType, Uuid);
+        if (IntermediatePath.IsEmpty())
+        {
+            continue;
+        }
+
+        // 不能走 FAssetUtility::ValidateIntermediateHash，它会优先查询已挂载的 Pak
+        UInt64 IntermediateHash = 0;
+        if (!ReadIntermediateHash(IntermediatePath, IntermediateHash) || Metadata->IntermediateHash == 0 ||
+            IntermediateHash != Metadata->IntermediateHash ||
+            FIntermediateCache::GetRef().IsSourceModified(Metadata->Path))
+        {
+            HK_LOG_WARN(ELogcat::Asset, "Skip asset without an up-to-date intermediate file: {}", Metadata->Path);
+            ++NumSkipped;
+            continue;
+        }
+
+        const UInt32* Recorded = RecordedOrders.Find(Uuid);
+        Entries.Add({Uuid, Metadata->AssetType, Metadata->Path, IntermediatePath, IntermediateHash,
+                     Recorded != nullptr ? *Recorded : UINT32_MAX});
+    }
+
+    // 2. 记录过的资产按加载顺序，其余按路径，保证多次 Cook 的结果一致
+    Entries.Sort([](const FCookEntry& Lhs, const FCookEntry& Rhs) {
+        if (Lhs.RecordedOrder != Rhs.RecordedOrder)
+        {
+            return Lhs.RecordedOrder < Rhs.RecordedOrder;
+        }
+        return Lhs.AssetPath < Rhs.AssetPath;
+    });
+
+    FAssetPakWriter Writer;
+    for (UInt32 Index = 0; Index < Entries.Size(); ++Index)
+    {
+        const FCookEntry& Entry = Entries[Index];
+        Writer.AddEntry(Entry.Uuid, Entry.AssetType, Entry.IntermediatePath, Index, Compression);
+    }
+    if (!Writer.Write(PakPath))
+    {
+        return false;
+    }
+
+    // 3. 按加载顺序批量回读，校验每个条目都能读出且 Hash 与元数据一致
+    FAssetPak Pak;
+    if (!Pak.Open(PakPath))
+    {
+        return false;
+    }
+    TArray<FAssetPakReadRequest> Requests;
+    Requests.Resize(Entries.Size());
+    for (UInt32 Index = 0; Index < Entries.Size(); ++Index)
+    {
+        Requests[Index].Uuid = Entries[Index].Uuid;
+    }
+    Pak.ReadBatch(TSpan<FAssetPakReadRequest>(Requests.Data(), Requests.Size()));
+
+    bool bValid = true;
+    for (UInt32 Index = 0; Index < Entries.Size(); ++Index)
+    {
+        const FAssetPakReadRequest& Request = Requests[Index];
+        UInt64                      Hash    = 0;
+        if (Request.bSuccess && Request.Buffer.Data.Size() >= sizeof(Hash))
+        {
+            std::memcpy(&Hash, Request.Buffer.Data.Data(), sizeof(Hash));
+        }
+        if (Hash != Entries[Index].IntermediateHash)
+        {
+            HK_LOG_ERROR(ELogcat::Asset, "Cooked asset pak entry is invalid: {}", Entries[Index].AssetPath);
+            bValid = false;
+        }
+    }
+    Pak.Close();
+
+    HK_LOG_INFO(ELogcat::Asset, "Cooked {} assets into {} ({} in recorded load order, {} skipped)", Entries.Size(),
+                PakPath,
+                std::count_if(Entries.begin(), Entries.end(),
+                              [](const FCookEntry& Entry) { return Entry.RecordedOrder != UINT32_MAX; }),
+                NumSkipped);
+    return bValid;
+}
+
+bool FAssetCooker::SaveLoadOrder(FStringView Path, TSpan<const FUuid> Uuids)
+{
+    auto Stream = FFileUtility::CreateFileStream(Path, true, false);
+    if (!Stream)
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Failed to write asset load order: {}", Path);
+        return false;
+    }
+
+    char Line[FUuid::StringLength + 1];
+    Line[FUuid::StringLength] = '\n';
+    for (const FUuid& Uuid : Uuids)
+    {
+        Uuid.ToChars(Line);
+        Stream->write(Line, sizeof(Line));
+    }
+    return Stream->good();
+}
+
+bool FAssetCooker::LoadLoadOrder(FStringView Path, TArray<FUuid>& OutUuids)
+{
+    OutUuids.Clear();
+    auto Stream = FFileUtility::OpenFileStream(Path, false);
+    if (!Stream)
+    {
+        return false;
+    }
+
+    std::string Line;
+    while (std::getline(*Stream, Line))
+    {
+        if (Line.size() != FUuid::StringLength)
+        {
+            continue;
+        }
+        const FUuid Uuid{FStringView(Line.c_str())};
+        if (Uuid.IsValid())
+        {
+            OutUuids.Add(Uuid);
+        }
+    }
+    return true;
+}
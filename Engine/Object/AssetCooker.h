@@ -0,0 +1,46 @@
+#pragma once
+#include "AssetPak.h"
+#include "Core/Container/Array.h"
+#include "Core/Container/Span.h"
+#include "Core/String/StringView.h"
+#include "Core/Utility/Uuid.h"
+
+/**
+ * 资产打包（Cook）
+ * 运行时 FAssetManager 记录资产第一次开始加载的顺序，关闭时写入加载顺序文件；
+ * Cook 时把注册表中所有资产的中间文件写入 Pak，数据区按记录的加载顺序排列，没有记录的资产按路径排在最后，
+ * 因此启动与关卡加载时对 Pak 的读取基本是顺序的
+ */
+class HK_API FAssetCooker
+{
+public:
+    static constexpr const char* DefaultLoadOrderPath = "Intermediate/AssetLoadOrder.txt";
+
+    /**
+     * 命令行入口：只初始化配置与资产注册表（不创建图形设备），Cook 完成后关闭
+     * @param PakPath 输出的 Pak 路径
+     * @return 成功返回 true
+     */
+    static bool Run(FStringView PakPath);
+
+    /**
+     * 把注册表中所有已经生成中间文件的资产写入 Pak，写入后通过 FAssetPak::ReadBatch 回读校验
+     * @param PakPath 输出的 Pak 路径
+     * @param LoadOrderPath 加载顺序文件，不存在时所有资产按路径排序
+     * @param Compression 压缩方式
+     * @return 成功返回 true
+     */
+    static bool CookAssetPak(FStringView PakPath, FStringView LoadOrderPath,
+                             EAssetPakCompression Compression = EAssetPakCompression::None);
+
+    /**
+     * 写入加载顺序文件，每行一个 UUID
+     */
+    static bool SaveLoadOrder(FStringView Path, TSpan<const FUuid> Uuids);
+
+    /**
+     * 读取加载顺序文件，无效的行会被跳过
+     * @return 文件不存在时返回 false
+     */
+    static bool LoadLoadOrder(FStringView Path, TArray<FUuid>& OutUuids);
+};
@@ -0,0 +1,131 @@
+#pragma once
+#include "AssetRegistry.h"
+#include "Core/Container/Array.h"
+#include "Core/Event/Delegate.h"
+#include "Core/Utility/SharedPtr.h"
+#include "Core/Utility/Uuid.h"
+
+#include <atomic>
+
+class FAssetLoader;
+struct FAssetLoadPayload;
+
+/**
+ * 异步加载优先级，同一优先级按提交顺序调度
+ * Critical 不受同时加载数量的限制
+ */
+enum class EAssetLoadPriority
+{
+    Low,
+    Normal,
+    High,
+    Critical,
+};
+
+enum class EAssetLoadState
+{
+    Queued,    // 等待调度
+    Loading,   // IO 线程读取并解码中间文件
+    Uploading, // Render 线程创建对象并提交上传，等待 GPU 执行完成
+    Completed, // 加载完成
+    Failed,    // 加载失败
+    Cancelled, // 已取消
+};
+
+/**
+ * 一次异步加载请求，同一个 UUID 的多次请求共享同一个 FAssetLoadRequest
+ * 由 FAssetManager 创建与驱动，外部通过 FAssetLoadHandle 访问
+ */
+class HK_API FAssetLoadRequest
+{
+public:
+    bool IsFinished() const
+    {
+        const EAssetLoadState CurrentState = State.load(std::memory_order_acquire);
+        return CurrentState == EAssetLoadState::Completed || CurrentState == EAssetLoadState::Failed ||
+               CurrentState == EAssetLoadState::Cancelled;
+    }
+
+    FUuid              Uuid;
+    FAssetMetadata     Metadata; // 元数据副本，IO 线程只读访问
+    FType              AssetType = nullptr;
+    FAssetLoader*      Loader    = nullptr;
+    EAssetLoadPriority Priority  = EAssetLoadPriority::Normal;
+    UInt64             Sequence  = 0;
+
+    std::atomic<EAssetLoadState> State{EAssetLoadState::Queued};
+    std::atomic<bool>            bCancelRequested{false};
+    Int32                        InterestCount = 0; // 未取消的 Handle 数量，受 FAssetManager 的锁保护
+
+    TSharedPtr<FAssetLoadPayload> Payload;
+    HObject*                      Result = nullptr;
+
+    // 只在 Game 线程访问
+    TArray<TDelegate<void, HObject*>> Callbacks;
+};
+
+/**
+ * 异步加载句柄
+ * 析构不会取消加载，需要取消时显式调用 Cancel
+ * 每个句柄代表请求上的一份需求（InterestCount），只能移动，保证每份需求最多被取消一次
+ */
+class HK_API FAssetLoadHandle
+{
+public:
+    FAssetLoadHandle() = default;
+    explicit FAssetLoadHandle(TSharedPtr<FAssetLoadRequest> InRequest) : Request(std::move(InRequest)) {}
+
+    FAssetLoadHandle(const FAssetLoadHandle&)            = delete;
+    FAssetLoadHandle& operator=(const FAssetLoadHandle&) = delete;
+
+    // 移动后原句柄不再持有请求，对其调用 Cancel 不会产生效果
+    FAssetLoadHandle(FAssetLoadHandle&&) noexcept            = default;
+    FAssetLoadHandle& operator=(FAssetLoadHandle&&) noexcept = default;
+
+    bool IsValid() const
+    {
+        return static_cast<bool>(Request);
+    }
+
+    bool IsDone() const
+    {
+        return Request && Request->IsFinished();
+    }
+
+    EAssetLoadState GetState() const
+    {
+        return Request ? Request->State.load(std::memory_order_acquire) : EAssetLoadState::Failed;
+    }
+
+    /**
+     * 获取加载结果，只有在 Game 线程收到完成通知后才有效
+     * @return 未完成、失败或取消时返回 nullptr
+     */
+    HObject* GetAsset() const
+    {
+        return GetState() == EAssetLoadState::Completed ? Request->Result : nullptr;
+    }
+
+    template <typename T>
+    T* GetAsset() const
+    {
+        return static_cast<T*>(GetAsset());
+    }
+
+    /**
+     * 放弃本句柄对加载结果的需求，所有共享该请求的句柄都取消后请求才会真正停止
+     * 只能在 Game 线程调用
+     */
+    void Cancel();
+
+    /**
+     * 注册完成回调，在 Game 线程的 FTaskGraph::Tick 中调用；如果已经完成则立即调用
+     * 失败或取消时参数为 nullptr
+     * 只能在 Game 线程调用
+     */
+    void OnCompleted(TDelegate<void, HObject*> Callback);
+
+private:
+    TSharedPtr<FAssetLoadRequest> Request;
+    bool                          bCancelled = false;
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Reflection/Reflection.h"
+#include "Core/Utility/SharedPtr.h"
 #include "Core/Utility/Uuid.h"
 
 #include "AssetLoader.generated.h"
@@ -8,6 +9,23 @@
 struct FAssetMetadata;
 class HObject;
 
+/**
+ * 异步加载时 IO 阶段产出的中间数据，由各个 Loader 派生
+ */
+struct HK_API FAssetLoadPayload
+{
+    virtual ~FAssetLoadPayload() = default;
+
+    /**
+     * FinishLoad 提交的 GPU 上传是否已经完成，每帧轮询一次，不能阻塞
+     * 完成之后 Payload 才会被释放，派生类在析构时释放上传用的临时资源
+     */
+    virtual bool IsUploadComplete() const
+    {
+        return true;
+    }
+};
+
 HCLASS(Abstract)
 class HK_API FAssetLoader
 {
@@ -17,6 +35,29 @@ public:
 
     virtual HObject* Load(const FAssetMetadata& Metadata, FType AssetType, bool ImportIfNotExist) = 0;
 
+    /**
+     * 异步加载的 IO 阶段，在 IO 线程执行：校验并反序列化中间文件，不能访问 GPU 和 AssetRegistry
+     * @param Metadata 资产元数据（副本）
+     * @return 解码后的数据，返回 nullptr 表示无法直接加载（例如需要 Import），此时会回退到同步 Load
+     */
+    virtual TSharedPtr<FAssetLoadPayload> LoadPayload([[maybe_unused]] const FAssetMetadata& Metadata)
+    {
+        return nullptr;
+    }
+
+    /**
+     * 异步加载的上传阶段，在 Render 线程执行：创建对象并提交 GPU 上传，不等待上传完成
+     * 提交的上传记录在 Payload 中，由 IsUploadComplete 报告完成
+     * @param Metadata 资产元数据（副本）
+     * @param Payload LoadPayload 的返回值
+     * @return 创建的对象，失败返回 nullptr
+     */
+    virtual HObject* FinishLoad([[maybe_unused]] const FAssetMetadata& Metadata,
+                                [[maybe_unused]] FAssetLoadPayload&    Payload)
+    {
+        return nullptr;
+    }
+
     template <typename T>
     T* Load(const FAssetMetadata& Metadata, bool ImportIfNotExist)
     {
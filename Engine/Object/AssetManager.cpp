@@ -4,21 +4,474 @@
 
 #include "AssetManager.h"
 
+#include "AssetCooker.h"
+#include "AssetPak.h"
+#include "AssetRegistry.h"
+#include "Core/Logging/Logger.h"
+#include "IntermediateCache.h"
 #include "Object.h"
+#include "TaskGraph/TaskGraph.h"
 
-void FAssetManager::RegisterAsset(FUuid Uuid, const FString& AssetPath, const HObject* Asset)
+namespace
 {
-    if (AssetMap.Contains(Uuid) || AssetPathMap.Contains(AssetPath))
+// 创建一个已经结束的请求，用于立即完成或立即失败的句柄
+FAssetLoadHandle MakeFinishedHandle(EAssetLoadState State, HObject* Result)
+{
+    TSharedPtr<FAssetLoadRequest> Request = MakeShared<FAssetLoadRequest>();
+    Request->Result                       = Result;
+    Request->State.store(State, std::memory_order_release);
+    return FAssetLoadHandle(Request);
+}
+} // namespace
+
+void FAssetLoadHandle::Cancel()
+{
+    if (!Request || bCancelled || Request->IsFinished())
     {
-        HK_LOG_ERROR(ELogcat::Asset, "Asset {} already exists", Uuid.ToString());
         return;
     }
+    bCancelled = true;
+    FAssetManager::GetRef().CancelLoadRequest(Request);
+}
+
+void FAssetLoadHandle::OnCompleted(TDelegate<void, HObject*> Callback)
+{
+    if (!Request)
+    {
+        Callback.Invoke(nullptr);
+        return;
+    }
+    if (Request->IsFinished())
+    {
+        Callback.Invoke(GetAsset());
+        return;
+    }
+    Request->Callbacks.Add(std::move(Callback));
+}
+
+void FAssetManager::StartUp()
+{
+    // TSingleton 的延迟创建不是线程安全的，异步加载会在 IO / Render 线程访问这些单例，这里提前在主线程创建
+    FAssetRegistry::Get();
+    FAssetPakManager::Get();
+    FIntermediateCache::Get();
+}
+
+void FAssetManager::ShutDown()
+{
+    // 此时 FTaskGraph 已经关闭，尚未完成的请求不会再被推进
+    {
+        AutoLock Lock(RequestMutex);
+        for (auto& [Uuid, Request] : InflightRequests)
+        {
+            Request->bCancelRequested.store(true, std::memory_order_release);
+            Request->State.store(EAssetLoadState::Cancelled, std::memory_order_release);
+        }
+        InflightRequests.Clear();
+        QueuedRequests.Clear();
+        NumActiveLoadRequests = 0;
+    }
+
+    // Payload 析构时等待尚未完成的上传，必须在 FRenderContext 与 GfxDevice 销毁之前
+    {
+        AutoLock Lock(UploadMutex);
+        PendingUploads.Clear();
+    }
+
+    for (FLoaderEntry& Entry : AssetLoaders)
+    {
+        Entry.Loader.Reset();
+        Entry.ObjectType = nullptr;
+    }
+
+    AutoLock Lock(LoadOrderMutex);
+    if (!LoadOrder.IsEmpty())
+    {
+        FAssetCooker::SaveLoadOrder(FStringView(FAssetCooker::DefaultLoadOrderPath),
+                                    TSpan<const FUuid>(LoadOrder.Data(), LoadOrder.Size()));
+    }
+}
+
+void FAssetManager::SetAssetLoader(EAssetType AssetType, FType ObjectType, TUniquePtr<FAssetLoader>&& Loader)
+{
+    if (AssetType < EAssetType::Count)
+    {
+        FLoaderEntry& Entry = AssetLoaders[(int)AssetType];
+        if (Entry.Loader)
+        {
+            HK_LOG_WARN(ELogcat::Asset, "Asset loader for asset type {} already exists, overwrite.",
+                        static_cast<int>(AssetType));
+        }
+        Entry.Loader     = std::move(Loader);
+        Entry.ObjectType = ObjectType;
+    }
+}
+
+HObject* FAssetManager::LoadAsset(FStringView AssetPath)
+{
+    HK_PROFILE_SCOPE_N("FAssetManager::LoadAsset");
+
+    TSharedPtr<FAssetMetadata> Metadata = FAssetRegistry::GetRef().LoadAssetMetadata(AssetPath);
+    if (!Metadata)
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Failed to load asset metadata: {}", AssetPath);
+        return nullptr;
+    }
+
+    if (HObject* Loaded = FindLoadedAsset(Metadata->Uuid))
+    {
+        return Loaded;
+    }
+
+    if (Metadata->AssetType >= EAssetType::Count || !AssetLoaders[(int)Metadata->AssetType].Loader)
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "No asset loader for asset type {}: {}", static_cast<int>(Metadata->AssetType),
+                     AssetPath);
+        return nullptr;
+    }
+
+    RecordLoadOrder(Metadata->Uuid);
+
+    const FLoaderEntry& Entry = AssetLoaders[(int)Metadata->AssetType];
+    HObject*            Asset = nullptr;
+    {
+        AutoLock Lock(LoaderMutex);
+        Asset = Entry.Loader->Load(*Metadata, Entry.ObjectType, true);
+    }
+
+    if (Asset != nullptr)
+    {
+        RegisterAsset(Metadata->Uuid, Metadata->Path, Asset);
+    }
+    return Asset;
+}
+
+FAssetLoadHandle FAssetManager::LoadAssetAsync(FStringView AssetPath, EAssetLoadPriority Priority)
+{
+    TSharedPtr<FAssetMetadata> Metadata = FAssetRegistry::GetRef().LoadAssetMetadata(AssetPath);
+    if (!Metadata)
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Failed to load asset metadata: {}", AssetPath);
+        return MakeFinishedHandle(EAssetLoadState::Failed, nullptr);
+    }
+    return LoadAssetAsync(Metadata, Priority);
+}
+
+FAssetLoadHandle FAssetManager::LoadAssetAsync(const FUuid& Uuid, EAssetLoadPriority Priority)
+{
+    TSharedPtr<FAssetMetadata> Metadata = FAssetRegistry::GetRef().LoadAssetMetadata(Uuid);
+    if (!Metadata)
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Failed to load asset metadata: {}", Uuid.ToString());
+        return MakeFinishedHandle(EAssetLoadState::Failed, nullptr);
+    }
+    return LoadAssetAsync(Metadata, Priority);
+}
+
+FAssetLoadHandle FAssetManager::LoadAssetAsync(const TSharedPtr<FAssetMetadata>& Metadata,
+                                               EAssetLoadPriority                Priority)
+{
+    if (HObject* Loaded = FindLoadedAsset(Metadata->Uuid))
+    {
+        return MakeFinishedHandle(EAssetLoadState::Completed, Loaded);
+    }
+
+    if (Metadata->AssetType >= EAssetType::Count || !AssetLoaders[(int)Metadata->AssetType].Loader)
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "No asset loader for asset type {}: {}", static_cast<int>(Metadata->AssetType),
+                     Metadata->Path);
+        return MakeFinishedHandle(EAssetLoadState::Failed, nullptr);
+    }
+
+    AutoLock Lock(RequestMutex);
+
+    // 合并同一资产的重复请求，已经被取消的请求不再复用
+    if (TSharedPtr<FAssetLoadRequest>* Existing = InflightRequests.Find(Metadata->Uuid))
+    {
+        TSharedPtr<FAssetLoadRequest> Request = *Existing;
+        if (!Request->bCancelRequested.load(std::memory_order_acquire))
+        {
+            Request->InterestCount += 1;
+            if (Priority > Request->Priority)
+            {
+                // 仍在队列中时提升优先级才有意义
+                Request->Priority = Priority;
+                DispatchQueuedRequests();
+            }
+            return FAssetLoadHandle(Request);
+        }
+    }
+
+    const FLoaderEntry&           Entry   = AssetLoaders[(int)Metadata->AssetType];
+    TSharedPtr<FAssetLoadRequest> Request = MakeShared<FAssetLoadRequest>();
+    Request->Uuid                         = Metadata->Uuid;
+    Request->Metadata                     = *Metadata;
+    Request->AssetType                    = Entry.ObjectType;
+    Request->Loader                       = Entry.Loader.Get();
+    Request->Priority                     = Priority;
+    Request->Sequence                     = NextRequestSequence++;
+    Request->InterestCount                = 1;
+
+    InflightRequests[Metadata->Uuid] = Request;
+    QueuedRequests.Add(Request);
+    DispatchQueuedRequests();
+
+    return FAssetLoadHandle(Request);
+}
+
+void FAssetManager::DispatchQueuedRequests()
+{
+    TArray<TSharedPtr<FAssetLoadRequest>> StartedRequests;
+    while (!QueuedRequests.IsEmpty())
+    {
+        // 优先级高的先执行，同一优先级先提交的先执行
+        Int32 BestIndex = 0;
+        for (Int32 i = 1; i < static_cast<Int32>(QueuedRequests.Size()); ++i)
+        {
+            const TSharedPtr<FAssetLoadRequest>& Candidate = QueuedRequests[i];
+            const TSharedPtr<FAssetLoadRequest>& Best      = QueuedRequests[BestIndex];
+            if (Candidate->Priority > Best->Priority ||
+                (Candidate->Priority == Best->Priority && Candidate->Sequence < Best->Sequence))
+            {
+                BestIndex = i;
+            }
+        }
+
+        TSharedPtr<FAssetLoadRequest> Request = QueuedRequests[BestIndex];
+        if (NumActiveLoadRequests >= MaxActiveLoadRequests && Request->Priority != EAssetLoadPriority::Critical)
+        {
+            break;
+        }
+
+        QueuedRequests.RemoveAt(BestIndex);
+        NumActiveLoadRequests += 1;
+        StartedRequests.Add(Request);
+    }
+
+    if (StartedRequests.IsEmpty())
+    {
+        return;
+    }
+
+    // 先按 Pak 中的偏移顺序预读本批请求，IO 线程读取时数据大多已经在页缓存中
+    TArray<FUuid> StartedUuids;
+    StartedUuids.Reserve(StartedRequests.Size());
+    for (const TSharedPtr<FAssetLoadRequest>& Request : StartedRequests)
+    {
+        StartedUuids.Add(Request->Uuid);
+        RecordLoadOrder(Request->Uuid);
+    }
+    FAssetPakManager::GetRef().Prefetch(StartedUuids);
+
+    for (const TSharedPtr<FAssetLoadRequest>& Request : StartedRequests)
+    {
+        StartLoadRequest(Request);
+    }
+}
+
+void FAssetManager::StartLoadRequest(const TSharedPtr<FAssetLoadRequest>& Request)
+{
+    Request->State.store(EAssetLoadState::Loading, std::memory_order_release);
+
+    FTaskGraph::GetRef().Launch(FString("AssetLoad.IO"), EExecutorLabel::IO, [this, Request]() {
+        HK_PROFILE_SCOPE_N("AssetLoad.IO");
+
+        if (!Request->bCancelRequested.load(std::memory_order_acquire))
+        {
+            Request->Payload = Request->Loader->LoadPayload(Request->Metadata);
+            if (!Request->Payload)
+            {
+                // 中间文件缺失或校验失败，回退到同步加载（会执行 Import），在 IO 线程执行以免占用 Render 线程
+                AutoLock Lock(LoaderMutex);
+                Request->Result = Request->Loader->Load(Request->Metadata, Request->AssetType, true);
+            }
+        }
+
+        {
+            AutoLock Lock(RequestMutex);
+            NumActiveLoadRequests -= 1;
+            DispatchQueuedRequests();
+        }
+
+        // 同步加载已经得到结果时不需要 Render 阶段
+        if (Request->bCancelRequested.load(std::memory_order_acquire) || !Request->Payload)
+        {
+            Request->Payload = nullptr;
+            FTaskGraph::GetRef().Launch(FString("AssetLoad.Complete"), EExecutorLabel::Game,
+                                        [this, Request]() { CompleteLoadRequest(Request); });
+            return;
+        }
+
+        Request->State.store(EAssetLoadState::Uploading, std::memory_order_release);
+        FTaskGraph::GetRef().Launch(FString("AssetLoad.Upload"), EExecutorLabel::Render,
+                                    [this, Request]() { FinishLoadRequest(Request); });
+    });
+}
+
+void FAssetManager::FinishLoadRequest(const TSharedPtr<FAssetLoadRequest>& Request)
+{
+    HK_PROFILE_SCOPE_N("AssetLoad.Upload");
+
+    // FinishLoad 只提交上传，不等待栅栏
+    if (!Request->bCancelRequested.load(std::memory_order_acquire))
+    {
+        Request->Result = Request->Loader->FinishLoad(Request->Metadata, *Request->Payload);
+    }
+    if (Request->Result != nullptr && !Request->Payload->IsUploadComplete())
+    {
+        AutoLock Lock(UploadMutex);
+        PendingUploads.Add(Request);
+        return;
+    }
+    Request->Payload = nullptr;
+
+    FTaskGraph::GetRef().Launch(FString("AssetLoad.Complete"), EExecutorLabel::Game,
+                                [this, Request]() { CompleteLoadRequest(Request); });
+}
+
+void FAssetManager::PollPendingUploads()
+{
+    HK_PROFILE_SCOPE_N("FAssetManager::PollPendingUploads");
+
+    TArray<TSharedPtr<FAssetLoadRequest>> CompletedRequests;
+    {
+        AutoLock                              Lock(UploadMutex);
+        TArray<TSharedPtr<FAssetLoadRequest>> StillPending;
+        for (TSharedPtr<FAssetLoadRequest>& Request : PendingUploads)
+        {
+            if (Request->Payload->IsUploadComplete())
+            {
+                CompletedRequests.Add(std::move(Request));
+            }
+            else
+            {
+                StillPending.Add(std::move(Request));
+            }
+        }
+        PendingUploads = std::move(StillPending);
+    }
+
+    for (const TSharedPtr<FAssetLoadRequest>& Request : CompletedRequests)
+    {
+        // 释放 Payload 时一并销毁上传用的暂存缓冲与命令缓冲
+        Request->Payload = nullptr;
+        FTaskGraph::GetRef().Launch(FString("AssetLoad.Complete"), EExecutorLabel::Game,
+                                    [this, Request]() { CompleteLoadRequest(Request); });
+    }
+}
+
+void FAssetManager::CompleteLoadRequest(const TSharedPtr<FAssetLoadRequest>& Request)
+{
+    // 即使请求已被取消，已经创建好的对象仍然登记，避免下次重复加载
+    if (Request->Result != nullptr)
+    {
+        if (HObject* Existing = FindLoadedAsset(Request->Uuid))
+        {
+            Request->Result = Existing;
+        }
+        else
+        {
+            RegisterAsset(Request->Uuid, Request->Metadata.Path, Request->Result);
+        }
+    }
+
+    {
+        AutoLock Lock(RequestMutex);
+        TSharedPtr<FAssetLoadRequest>* Found = InflightRequests.Find(Request->Uuid);
+        if (Found != nullptr && *Found == Request)
+        {
+            InflightRequests.Remove(Request->Uuid);
+        }
+    }
+
+    EAssetLoadState FinalState = EAssetLoadState::Failed;
+    if (Request->bCancelRequested.load(std::memory_order_acquire))
+    {
+        FinalState = EAssetLoadState::Cancelled;
+    }
+    else if (Request->Result != nullptr)
+    {
+        FinalState = EAssetLoadState::Completed;
+    }
+    else
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Failed to load asset asynchronously: {}", Request->Metadata.Path);
+    }
+    Request->State.store(FinalState, std::memory_order_release);
+
+    HObject* Result = FinalState == EAssetLoadState::Completed ? Request->Result : nullptr;
+    TArray<TDelegate<void, HObject*>> Callbacks = std::move(Request->Callbacks);
+    for (const TDelegate<void, HObject*>& Callback : Callbacks)
+    {
+        Callback.Invoke(Result);
+    }
+}
+
+void FAssetManager::CancelLoadRequest(const TSharedPtr<FAssetLoadRequest>& Request)
+{
+    bool bRemovedFromQueue = false;
+    {
+        AutoLock Lock(RequestMutex);
+        Request->InterestCount -= 1;
+        if (Request->InterestCount > 0)
+        {
+            return;
+        }
+        Request->bCancelRequested.store(true, std::memory_order_release);
+        bRemovedFromQueue = QueuedRequests.Remove(Request);
+    }
+
+    // 尚未开始的请求直接结束，已经开始的请求在下一个阶段开始前结束
+    if (bRemovedFromQueue)
+    {
+        CompleteLoadRequest(Request);
+    }
+}
+
+void FAssetManager::RegisterAsset(FUuid Uuid, const FString& AssetPath, const HObject* Asset)
+{
     if (Asset == nullptr)
     {
         HK_LOG_ERROR(ELogcat::Asset, "Asset is null, with UUID={}, AssetPath={}", Uuid.ToString(), AssetPath);
         return;
     }
     AutoLock Lock(AssetMapMutex);
+    if (AssetMap.Contains(Uuid) || AssetPathMap.Contains(AssetPath))
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Asset {} already exists", Uuid.ToString());
+        return;
+    }
     AssetMap[Uuid]                   = Asset->GetID();
     AssetPathMap[FString(AssetPath)] = Uuid;
-}
\ No newline at end of file
+}
+
+HObject* FAssetManager::FindLoadedAsset(const FUuid& Uuid) const
+{
+    FObjectID ID = INVALID_OBJECT_ID;
+    {
+        AutoLock Lock(AssetMapMutex);
+        const FObjectID* Found = AssetMap.Find(Uuid);
+        if (Found == nullptr)
+        {
+            return nullptr;
+        }
+        ID = *Found;
+    }
+    return FObjectArray::GetRef().FindObjectByID(ID);
+}
+
+TArray<FUuid> FAssetManager::GetLoadOrder() const
+{
+    AutoLock Lock(LoadOrderMutex);
+    return LoadOrder;
+}
+
+void FAssetManager::RecordLoadOrder(const FUuid& Uuid)
+{
+    AutoLock Lock(LoadOrderMutex);
+    if (!LoadOrderIndices.Contains(Uuid))
+    {
+        LoadOrderIndices[Uuid] = static_cast<UInt32>(LoadOrder.Size());
+        LoadOrder.Add(Uuid);
+    }
+}
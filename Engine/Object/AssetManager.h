@@ -1,25 +1,144 @@
 #pragma once
+#include "Asset.h"
+#include "AssetLoadHandle.h"
+#include "AssetLoader.h"
+#include "Core/Container/Array.h"
+#include "Core/Container/FixedArray.h"
 #include "Core/Container/Map.h"
+#include "Core/Logging/Logger.h"
 #include "Core/Singleton/Singleton.h"
 #include "Core/String/String.h"
 #include "Core/Utility/Profiler.h"
+#include "Core/Utility/UniquePtr.h"
 #include "Core/Utility/Uuid.h"
 #include "Object.h"
 
 class FAssetManager : public TSingleton<FAssetManager>
 {
 public:
+    void StartUp() override;
+    void ShutDown() override;
+
+    /**
+     * 注册某种资产类型的 Loader
+     * @param AssetType 资产类型
+     * @param ObjectType Loader 创建的对象类型，如 TypeOf<HMesh>()
+     * @param Loader Loader 实例
+     */
+    void SetAssetLoader(EAssetType AssetType, FType ObjectType, TUniquePtr<FAssetLoader>&& Loader);
+
+    /**
+     * 同步加载资产，已加载过的资产直接返回，必要时会执行 Import
+     * @param AssetPath 资产路径
+     * @return 加载的对象，失败返回 nullptr
+     */
     HObject* LoadAsset(FStringView AssetPath);
 
     template <typename T>
     T* LoadAsset(FStringView AssetPath)
     {
+        HObject* Asset = LoadAsset(AssetPath);
+        if (Asset != nullptr && !Asset->GetType()->IsDerivedFrom(TypeOf<T>()))
+        {
+            HK_LOG_ERROR(ELogcat::Asset, "Asset {} is not a {}", AssetPath, TypeOf<T>()->Name);
+            return nullptr;
+        }
+        return static_cast<T*>(Asset);
     }
 
+    /**
+     * 异步加载资产
+     * IO 线程读取并解码中间文件，Render 线程创建对象并上传 GPU，完成通知在 Game 线程的 FTaskGraph::Tick 中派发
+     * 同一资产的重复请求会合并为同一个请求，已加载过的资产立即完成
+     * @param AssetPath 资产路径
+     * @param Priority 优先级
+     * @return 加载句柄，元数据不存在或没有对应的 Loader 时返回已失败的句柄
+     */
+    FAssetLoadHandle LoadAssetAsync(FStringView AssetPath, EAssetLoadPriority Priority = EAssetLoadPriority::Normal);
+
+    /**
+     * 异步加载资产
+     * @param Uuid 资产 UUID
+     * @param Priority 优先级
+     */
+    FAssetLoadHandle LoadAssetAsync(const FUuid& Uuid, EAssetLoadPriority Priority = EAssetLoadPriority::Normal);
+
     void RegisterAsset(FUuid Uuid, const FString& AssetPath, const HObject* Asset);
 
+    /**
+     * 查找已加载的资产
+     * @return 未加载或已销毁时返回 nullptr
+     */
+    HObject* FindLoadedAsset(const FUuid& Uuid) const;
+
+    /**
+     * 本次运行中资产第一次开始加载的顺序，关闭时写入 FAssetCooker::DefaultLoadOrderPath 供 Cook 使用
+     */
+    TArray<FUuid> GetLoadOrder() const;
+
+    /**
+     * 检查异步加载提交的 GPU 上传，已完成的请求释放上传资源并派发完成通知
+     * 由 FRenderContext::RenderFrame 每帧调用一次，不会阻塞
+     */
+    void PollPendingUploads();
+
 private:
-    HK_PROFILE_LOCKABLE(std::mutex, AssetMapMutex);
+    friend class FAssetLoadHandle;
+
+    struct FLoaderEntry
+    {
+        TUniquePtr<FAssetLoader> Loader;
+        FType                    ObjectType = nullptr;
+    };
+
+    FAssetLoadHandle LoadAssetAsync(const TSharedPtr<FAssetMetadata>& Metadata, EAssetLoadPriority Priority);
+
+    /**
+     * 按优先级从队列中取出请求并启动 IO 阶段，直到达到同时加载数量上限
+     * 调用方需要持有 RequestMutex
+     */
+    void DispatchQueuedRequests();
+
+    void StartLoadRequest(const TSharedPtr<FAssetLoadRequest>& Request);
+
+    /**
+     * Render 线程阶段：创建对象并提交 GPU 上传，上传尚未完成时加入 PendingUploads，由 PollPendingUploads 结束
+     * 没有 Payload 的请求已经在 IO 线程回退到同步 Load（可能执行 Import），不会进入这个阶段
+     */
+    void FinishLoadRequest(const TSharedPtr<FAssetLoadRequest>& Request);
+
+    /**
+     * Game 线程阶段：登记资产并调用完成回调
+     */
+    void CompleteLoadRequest(const TSharedPtr<FAssetLoadRequest>& Request);
+
+    void CancelLoadRequest(const TSharedPtr<FAssetLoadRequest>& Request);
+
+    void RecordLoadOrder(const FUuid& Uuid);
+
+    static constexpr Int32 MaxActiveLoadRequests = 4;
+
+    mutable HK_PROFILE_LOCKABLE(std::mutex, AssetMapMutex);
     TMap<FUuid, FObjectID> AssetMap;
     TMap<FString, FUuid>   AssetPathMap;
-};
\ No newline at end of file
+
+    TFixedArray<FLoaderEntry, (int)EAssetType::Count> AssetLoaders;
+
+    // 同步 Load 可能执行 Import 并写入中间文件，同一时间只允许一个线程执行
+    // AssetRegistry 与全局上传命令池各自有锁，FinishLoad 不需要持有这个锁
+    HK_PROFILE_LOCKABLE(std::mutex, LoaderMutex);
+
+    // FinishLoad 已经提交、GPU 尚未执行完的请求
+    HK_PROFILE_LOCKABLE(std::mutex, UploadMutex);
+    TArray<TSharedPtr<FAssetLoadRequest>> PendingUploads;
+
+    HK_PROFILE_LOCKABLE(std::mutex, RequestMutex);
+    TMap<FUuid, TSharedPtr<FAssetLoadRequest>> InflightRequests;
+    TArray<TSharedPtr<FAssetLoadRequest>>      QueuedRequests;
+    Int32                                      NumActiveLoadRequests = 0;
+    UInt64                                     NextRequestSequence   = 0;
+
+    mutable HK_PROFILE_LOCKABLE(std::mutex, LoadOrderMutex);
+    TArray<FUuid>       LoadOrder;
+    TMap<FUuid, UInt32> LoadOrderIndices;
+};
@@ -0,0 +1,426 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "AssetPak.h"
+#include "Core/Logging/Logger.h"
+#include "Core/Utility/FileUtility.h"
+
+#include <algorithm>
+#include <cstring>
+#include <lz4.h>
+#include <zstd.h>
+
+static_assert(sizeof(FAssetPakHeader) % 8 == 0, "Header must keep 8 byte alignment");
+static_assert(sizeof(FAssetPakEntry) % 8 == 0, "Entry must keep 8 byte alignment");
+
+// Cook 离线执行，使用较高的压缩等级；Zstd 的解压速度与压缩等级基本无关
+static constexpr int ZstdCompressionLevel = 19;
+
+static UInt64 AlignUp(const UInt64 Value, const UInt64 Alignment)
+{
+    return (Value + Alignment - 1) & ~(Alignment - 1);
+}
+
+/**
+ * 按 Compression 压缩 Source 到 OutCompressed
+ * @return 压缩后的大小，失败时返回 0
+ */
+static UInt64 CompressEntry(const EAssetPakCompression Compression, const TArray<UInt8>& Source,
+                            TArray<UInt8>& OutCompressed)
+{
+    switch (Compression)
+    {
+        case EAssetPakCompression::LZ4: {
+            const int Bound = LZ4_compressBound(static_cast<int>(Source.Size()));
+            OutCompressed.Resize(static_cast<size_t>(Bound));
+            const int CompressedSize = LZ4_compress_default(reinterpret_cast<const char*>(Source.Data()),
+                                                            reinterpret_cast<char*>(OutCompressed.Data()),
+                                                            static_cast<int>(Source.Size()), Bound);
+            return CompressedSize > 0 ? static_cast<UInt64>(CompressedSize) : 0;
+        }
+        case EAssetPakCompression::Zstd: {
+            const size_t Bound = ZSTD_compressBound(Source.Size());
+            OutCompressed.Resize(Bound);
+            const size_t CompressedSize =
+                ZSTD_compress(OutCompressed.Data(), Bound, Source.Data(), Source.Size(), ZstdCompressionLevel);
+            return ZSTD_isError(CompressedSize) ? 0 : static_cast<UInt64>(CompressedSize);
+        }
+        default:
+            return 0;
+    }
+}
+
+/**
+ * 解压一个条目到 OutData，OutData 的大小已经等于 Entry.UncompressedSize
+ */
+static bool DecompressEntry(const FAssetPakEntry& Entry, const UInt8* Stored, TArray<UInt8>& OutData)
+{
+    if (Entry.Compression == EAssetPakCompression::LZ4)
+    {
+        const int Decompressed = LZ4_decompress_safe(
+            reinterpret_cast<const char*>(Stored), reinterpret_cast<char*>(OutData.Data()),
+            static_cast<int>(Entry.StoredSize), static_cast<int>(Entry.UncompressedSize));
+        return Decompressed >= 0 && static_cast<UInt64>(Decompressed) == Entry.UncompressedSize;
+    }
+    const size_t Decompressed = ZSTD_decompress(OutData.Data(), OutData.Size(), Stored, Entry.StoredSize);
+    return !ZSTD_isError(Decompressed) && Decompressed == Entry.UncompressedSize;
+}
+
+static Int32 CompareUuidBytes(const UInt8* Lhs, const FUuid& Rhs)
+{
+    const auto Bytes = Rhs.Uuid.as_bytes();
+    return std::memcmp(Lhs, Bytes.data(), Bytes.size());
+}
+
+bool FAssetPak::Open(FStringView PakPath)
+{
+    HK_PROFILE_SCOPE_N("FAssetPak::Open");
+    Close();
+
+    if (!File.Open(PakPath))
+    {
+        return false;
+    }
+
+    const UInt8* Base = File.Data();
+    const size_t Size = File.Size();
+    if (Size < sizeof(FAssetPakHeader))
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Asset pak is too small: {}", PakPath);
+        File.Close();
+        return false;
+    }
+
+    const auto* NewHeader = reinterpret_cast<const FAssetPakHeader*>(Base);
+    if (NewHeader->Magic != FAssetPakHeader::MagicNumber || NewHeader->Version != FAssetPakHeader::CurrentVersion)
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Asset pak version mismatch: {}", PakPath);
+        File.Close();
+        return false;
+    }
+
+    const UInt64 TocSize = static_cast<UInt64>(NewHeader->EntryCount) * sizeof(FAssetPakEntry);
+    if (NewHeader->TocOffset % 8 != 0 || NewHeader->TocOffset + TocSize > Size)
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Asset pak is corrupted: {}", PakPath);
+        File.Close();
+        return false;
+    }
+
+    const auto* NewEntries = reinterpret_cast<const FAssetPakEntry*>(Base + NewHeader->TocOffset);
+    for (UInt32 I = 0; I < NewHeader->EntryCount; ++I)
+    {
+        if (NewEntries[I].Offset + NewEntries[I].StoredSize > NewHeader->TocOffset)
+        {
+            HK_LOG_ERROR(ELogcat::Asset, "Asset pak entry {} is out of range: {}", I, PakPath);
+            File.Close();
+            return false;
+        }
+    }
+
+    Header  = NewHeader;
+    Entries = NewEntries;
+    HK_LOG_INFO(ELogcat::Asset, "Mounted asset pak: {} ({} entries)", PakPath, Header->EntryCount);
+    return true;
+}
+
+void FAssetPak::Close()
+{
+    File.Close();
+    Header  = nullptr;
+    Entries = nullptr;
+}
+
+const FAssetPakEntry* FAssetPak::FindEntry(const FUuid& Uuid) const
+{
+    if (Header == nullptr)
+    {
+        return nullptr;
+    }
+
+    // 目录按 UUID 字节序排列
+    const FAssetPakEntry* First = Entries;
+    const FAssetPakEntry* Last  = Entries + Header->EntryCount;
+    const FAssetPakEntry* Found =
+        std::lower_bound(First, Last, Uuid, [](const FAssetPakEntry& Entry, const FUuid& Key) {
+            return CompareUuidBytes(Entry.Uuid, Key) < 0;
+        });
+    if (Found != Last && CompareUuidBytes(Found->Uuid, Uuid) == 0)
+    {
+        return Found;
+    }
+    return nullptr;
+}
+
+bool FAssetPak::Read(const FAssetPakEntry& Entry, FAssetPakBuffer& OutBuffer) const
+{
+    HK_PROFILE_SCOPE_N("FAssetPak::Read");
+
+    const UInt8* Stored = File.Data() + Entry.Offset;
+    switch (Entry.Compression)
+    {
+        case EAssetPakCompression::None:
+            OutBuffer.Storage.Clear();
+            OutBuffer.Data = TSpan<const UInt8>(Stored, Entry.StoredSize);
+            return true;
+        case EAssetPakCompression::LZ4:
+        case EAssetPakCompression::Zstd: {
+            OutBuffer.Storage.Resize(Entry.UncompressedSize);
+            if (!DecompressEntry(Entry, Stored, OutBuffer.Storage))
+            {
+                HK_LOG_ERROR(ELogcat::Asset, "Failed to decompress asset pak entry at offset {}", Entry.Offset);
+                OutBuffer.Storage.Clear();
+                OutBuffer.Data = TSpan<const UInt8>();
+                return false;
+            }
+            OutBuffer.Data = TSpan<const UInt8>(OutBuffer.Storage.Data(), OutBuffer.Storage.Size());
+            return true;
+        }
+        default:
+            HK_LOG_ERROR(ELogcat::Asset, "Unknown asset pak compression: {}", static_cast<int>(Entry.Compression));
+            return false;
+    }
+}
+
+void FAssetPak::ReadBatch(TSpan<FAssetPakReadRequest> Requests) const
+{
+    HK_PROFILE_SCOPE_N("FAssetPak::ReadBatch");
+
+    struct FSortedRead
+    {
+        const FAssetPakEntry* Entry;
+        FAssetPakReadRequest* Request;
+    };
+
+    TArray<FSortedRead> SortedReads;
+    SortedReads.Reserve(Requests.Size());
+    for (FAssetPakReadRequest& Request : Requests)
+    {
+        Request.bSuccess = false;
+        if (const FAssetPakEntry* Entry = FindEntry(Request.Uuid))
+        {
+            SortedReads.Add({Entry, &Request});
+        }
+    }
+
+    std::sort(SortedReads.begin(), SortedReads.end(),
+              [](const FSortedRead& Lhs, const FSortedRead& Rhs) { return Lhs.Entry->Offset < Rhs.Entry->Offset; });
+
+    // 先一次性发出所有预读，再按文件顺序读取，后面的条目在处理前面的条目时已经在读入
+    for (const FSortedRead& Read : SortedReads)
+    {
+        File.Prefetch(Read.Entry->Offset, Read.Entry->StoredSize);
+    }
+    for (const FSortedRead& Read : SortedReads)
+    {
+        Read.Request->bSuccess = this->Read(*Read.Entry, Read.Request->Buffer);
+    }
+}
+
+void FAssetPak::Prefetch(TSpan<const FUuid> Uuids) const
+{
+    TArray<const FAssetPakEntry*> SortedEntries;
+    SortedEntries.Reserve(Uuids.Size());
+    for (const FUuid& Uuid : Uuids)
+    {
+        if (const FAssetPakEntry* Entry = FindEntry(Uuid))
+        {
+            SortedEntries.Add(Entry);
+        }
+    }
+
+    std::sort(SortedEntries.begin(), SortedEntries.end(),
+              [](const FAssetPakEntry* Lhs, const FAssetPakEntry* Rhs) { return Lhs->Offset < Rhs->Offset; });
+    for (const FAssetPakEntry* Entry : SortedEntries)
+    {
+        File.Prefetch(Entry->Offset, Entry->StoredSize);
+    }
+}
+
+void FAssetPakWriter::AddEntry(const FUuid& Uuid, EAssetType AssetType, FStringView SourcePath, UInt32 LoadOrder,
+                               EAssetPakCompression Compression)
+{
+    FPendingEntry Entry;
+    Entry.Uuid        = Uuid;
+    Entry.AssetType   = AssetType;
+    Entry.SourcePath  = FString(SourcePath);
+    Entry.LoadOrder   = LoadOrder;
+    Entry.Compression = Compression;
+    PendingEntries.Add(std::move(Entry));
+}
+
+bool FAssetPakWriter::Write(FStringView PakPath, UInt32 Alignment) const
+{
+    HK_PROFILE_SCOPE_N("FAssetPakWriter::Write");
+
+    if (Alignment == 0 || (Alignment & (Alignment - 1)) != 0)
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Asset pak alignment must be a power of two: {}", Alignment);
+        return false;
+    }
+
+    // 数据区按加载顺序排列，相同加载顺序保持添加顺序
+    TArray<const FPendingEntry*> DataOrder;
+    DataOrder.Reserve(PendingEntries.Size());
+    for (const FPendingEntry& Entry : PendingEntries)
+    {
+        DataOrder.Add(&Entry);
+    }
+    std::stable_sort(DataOrder.begin(), DataOrder.end(), [](const FPendingEntry* Lhs, const FPendingEntry* Rhs) {
+        return Lhs->LoadOrder < Rhs->LoadOrder;
+    });
+
+    auto Stream = FFileUtility::CreateFileStream(PakPath, true, true);
+    if (!Stream)
+    {
+        return false;
+    }
+
+    // 文件头最后写入，先占位
+    FAssetPakHeader NewHeader;
+    NewHeader.Alignment = Alignment;
+    Stream->write(reinterpret_cast<const char*>(&NewHeader), sizeof(NewHeader));
+
+    TArray<FAssetPakEntry> NewEntries;
+    NewEntries.Reserve(DataOrder.Size());
+    TArray<UInt8> Source;
+    TArray<UInt8> Compressed;
+    const UInt8   Zeros[64] = {};
+    UInt64        Cursor    = sizeof(NewHeader);
+
+    auto WritePadding = [&](const UInt64 Target) {
+        while (Cursor < Target)
+        {
+            const UInt64 Count = std::min<UInt64>(Target - Cursor, sizeof(Zeros));
+            Stream->write(reinterpret_cast<const char*>(Zeros), static_cast<std::streamsize>(Count));
+            Cursor += Count;
+        }
+    };
+
+    for (const FPendingEntry* Pending : DataOrder)
+    {
+        if (!FFileUtility::ReadFileBytes(Pending->SourcePath, Source) || Source.Size() < sizeof(UInt64))
+        {
+            HK_LOG_ERROR(ELogcat::Asset, "Failed to read intermediate file for asset pak: {}", Pending->SourcePath);
+            return false;
+        }
+
+        FAssetPakEntry Entry{};
+        const auto     Bytes = Pending->Uuid.Uuid.as_bytes();
+        std::memcpy(Entry.Uuid, Bytes.data(), sizeof(Entry.Uuid));
+        std::memcpy(&Entry.IntermediateHash, Source.Data(), sizeof(UInt64)); // 中间文件的第一个字段是 Hash
+        Entry.UncompressedSize = Source.Size();
+        Entry.LoadOrder        = Pending->LoadOrder;
+        Entry.AssetType        = Pending->AssetType;
+        Entry.Compression      = EAssetPakCompression::None;
+
+        const UInt8* Payload     = Source.Data();
+        UInt64       PayloadSize = Source.Size();
+        if (Pending->Compression != EAssetPakCompression::None)
+        {
+            const UInt64 CompressedSize = CompressEntry(Pending->Compression, Source, Compressed);
+            // 压缩后没有变小时按原样存储，读取时可以零拷贝
+            if (CompressedSize > 0 && CompressedSize < Source.Size())
+            {
+                Entry.Compression = Pending->Compression;
+                Payload           = Compressed.Data();
+                PayloadSize       = CompressedSize;
+            }
+        }
+
+        WritePadding(AlignUp(Cursor, Alignment));
+        Entry.Offset     = Cursor;
+        Entry.StoredSize = PayloadSize;
+        Stream->write(reinterpret_cast<const char*>(Payload), static_cast<std::streamsize>(PayloadSize));
+        Cursor += PayloadSize;
+        NewEntries.Add(Entry);
+    }
+
+    // 目录按 UUID 排序，读取时二分查找
+    std::sort(NewEntries.begin(), NewEntries.end(), [](const FAssetPakEntry& Lhs, const FAssetPakEntry& Rhs) {
+        return std::memcmp(Lhs.Uuid, Rhs.Uuid, sizeof(Lhs.Uuid)) < 0;
+    });
+
+    WritePadding(AlignUp(Cursor, 8));
+    NewHeader.EntryCount = static_cast<UInt32>(NewEntries.Size());
+    NewHeader.TocOffset  = Cursor;
+    Stream->write(reinterpret_cast<const char*>(NewEntries.Data()),
+                  static_cast<std::streamsize>(NewEntries.Size() * sizeof(FAssetPakEntry)));
+    Stream->seekp(0, std::ios::beg);
+    Stream->write(reinterpret_cast<const char*>(&NewHeader), sizeof(NewHeader));
+
+    if (!Stream->good())
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Failed to write asset pak: {}", PakPath);
+        return false;
+    }
+
+    HK_LOG_INFO(ELogcat::Asset, "Wrote asset pak: {} ({} entries)", PakPath, NewHeader.EntryCount);
+    return true;
+}
+
+void FAssetPakManager::StartUp()
+{
+    if (FFileUtility::FileExists(FStringView(DefaultPakPath)))
+    {
+        Mount(FStringView(DefaultPakPath));
+    }
+}
+
+void FAssetPakManager::ShutDown()
+{
+    AutoLock Lock(MountMutex);
+    MountedPaks.Clear();
+}
+
+bool FAssetPakManager::Mount(FStringView PakPath)
+{
+    TUniquePtr<FAssetPak> Pak = MakeUnique<FAssetPak>();
+    if (!Pak->Open(PakPath))
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Failed to mount asset pak: {}", PakPath);
+        return false;
+    }
+
+    AutoLock Lock(MountMutex);
+    MountedPaks.Add(std::move(Pak));
+    return true;
+}
+
+const FAssetPakEntry* FAssetPakManager::FindEntry(const FUuid& Uuid, const FAssetPak*& OutPak) const
+{
+    AutoLock Lock(MountMutex);
+    for (Int32 I = static_cast<Int32>(MountedPaks.Size()) - 1; I >= 0; --I)
+    {
+        if (const FAssetPakEntry* Entry = MountedPaks[I]->FindEntry(Uuid))
+        {
+            OutPak = MountedPaks[I].Get();
+            return Entry;
+        }
+    }
+    OutPak = nullptr;
+    return nullptr;
+}
+
+bool FAssetPakManager::Read(const FUuid& Uuid, FAssetPakBuffer& OutBuffer) const
+{
+    const FAssetPak*      Pak   = nullptr;
+    const FAssetPakEntry* Entry = FindEntry(Uuid, Pak);
+    if (Entry == nullptr)
+    {
+        return false;
+    }
+    return Pak->Read(*Entry, OutBuffer);
+}
+
+void FAssetPakManager::Prefetch(TSpan<const FUuid> Uuids) const
+{
+    HK_PROFILE_SCOPE_N("FAssetPakManager::Prefetch");
+
+    AutoLock Lock(MountMutex);
+    for (const TUniquePtr<FAssetPak>& Pak : MountedPaks)
+    {
+        Pak->Prefetch(Uuids);
+    }
+}
@@ -0,0 +1,211 @@
+#pragma once
+#include "Asset.h"
+#include "Core/Container/Array.h"
+#include "Core/Container/Span.h"
+#include "Core/Singleton/Singleton.h"
+#include "Core/String/String.h"
+#include "Core/String/StringView.h"
+#include "Core/Utility/MappedFile.h"
+#include "Core/Utility/Profiler.h"
+#include "Core/Utility/UniquePtr.h"
+#include "Core/Utility/Uuid.h"
+
+enum class EAssetPakCompression : UInt8
+{
+    None,
+    LZ4,  // 解压最快，适合加载时间敏感的条目
+    Zstd, // 压缩率更高，解压比 LZ4 慢，适合体积较大的条目
+};
+
+/**
+ * Pak 文件头
+ * 布局：Header | 按加载顺序排列并对齐的条目数据 | 按 UUID 排序的目录（TOC）
+ */
+struct FAssetPakHeader
+{
+    static constexpr UInt32 MagicNumber    = 0x4B504B48; // "HKPK"
+    static constexpr UInt32 CurrentVersion = 1;
+
+    UInt32 Magic      = MagicNumber;
+    UInt32 Version    = CurrentVersion;
+    UInt32 EntryCount = 0;
+    UInt32 Alignment  = 0;
+    UInt64 TocOffset  = 0;
+    UInt64 Reserved   = 0;
+};
+
+/**
+ * 目录中的一条记录，定长，直接从映射内存中读取
+ */
+struct FAssetPakEntry
+{
+    UInt8                Uuid[16];
+    UInt64               Offset;           // 数据相对文件起始位置的偏移，按 Header.Alignment 对齐
+    UInt64               StoredSize;       // Pak 中实际占用的大小（压缩后）
+    UInt64               UncompressedSize; // 原始中间文件大小
+    UInt64               IntermediateHash; // 中间文件开头记录的 Hash，用于和元数据比对
+    UInt32               LoadOrder;        // 打包时指定的加载顺序，数据区按此排列
+    EAssetType           AssetType;
+    EAssetPakCompression Compression;
+    UInt8                Padding[3];
+};
+
+/**
+ * 从 Pak 中读取的数据
+ * 未压缩的条目直接引用映射内存（零拷贝），压缩条目解压到 Storage 中
+ */
+struct FAssetPakBuffer
+{
+    TArray<UInt8>      Storage;
+    TSpan<const UInt8> Data;
+};
+
+/**
+ * 批量读取请求
+ */
+struct FAssetPakReadRequest
+{
+    FUuid           Uuid;
+    FAssetPakBuffer Buffer;
+    bool            bSuccess = false;
+};
+
+/**
+ * 只读 Pak 文件，整个文件通过 mmap 映射，打开后可以在多个线程同时读取
+ * TODO(io_uring): 批量读取依赖 PrefetchVirtualMemory / madvise(WILLNEED) 触发内核预读，
+ * 预读没有完成时缺页仍然在读取线程同步等待；压缩条目本来就要复制到 Storage 解压，
+ * Linux 上可以改为用 io_uring 一次提交整批 pread 到缓冲区，未压缩条目继续零拷贝引用映射内存，
+ * 需要先用 AssetPakVsLooseFiles 基准测试在 Linux 上确认收益
+ */
+class HK_API FAssetPak
+{
+public:
+    /**
+     * 映射 Pak 文件并校验文件头与目录
+     * @param PakPath Pak 文件路径
+     * @return 成功返回 true
+     */
+    bool Open(FStringView PakPath);
+
+    void Close();
+
+    bool IsOpen() const
+    {
+        return Header != nullptr;
+    }
+
+    UInt32 GetEntryCount() const
+    {
+        return Header ? Header->EntryCount : 0;
+    }
+
+    /**
+     * 通过 UUID 在目录中二分查找
+     * @return 未找到返回 nullptr
+     */
+    const FAssetPakEntry* FindEntry(const FUuid& Uuid) const;
+
+    /**
+     * 读取一个条目，必要时解压
+     * @param Entry FindEntry 的返回值
+     * @param OutBuffer 输出数据
+     * @return 成功返回 true
+     */
+    bool Read(const FAssetPakEntry& Entry, FAssetPakBuffer& OutBuffer) const;
+
+    /**
+     * 批量读取，先按数据偏移排序并预读，再按文件顺序依次读取，尽量让磁盘访问保持顺序
+     * @param Requests 读取请求，结果写回每个请求的 Buffer 与 bSuccess
+     */
+    void ReadBatch(TSpan<FAssetPakReadRequest> Requests) const;
+
+    /**
+     * 按数据偏移顺序预读一批条目，不等待读取完成
+     */
+    void Prefetch(TSpan<const FUuid> Uuids) const;
+
+private:
+    FMappedFile            File;
+    const FAssetPakHeader* Header  = nullptr;
+    const FAssetPakEntry*  Entries = nullptr;
+};
+
+/**
+ * Pak 文件写入器，用于将松散的中间文件打包（Cook）
+ */
+class HK_API FAssetPakWriter
+{
+public:
+    static constexpr UInt32 DefaultAlignment = 4096;
+
+    /**
+     * 添加一个中间文件
+     * @param Uuid 资产 UUID
+     * @param AssetType 资产类型
+     * @param SourcePath 中间文件路径
+     * @param LoadOrder 加载顺序，越小越靠前，相同时保持添加顺序
+     * @param Compression 压缩方式，压缩后没有变小时按不压缩存储
+     */
+    void AddEntry(const FUuid& Uuid, EAssetType AssetType, FStringView SourcePath, UInt32 LoadOrder,
+                  EAssetPakCompression Compression = EAssetPakCompression::None);
+
+    /**
+     * 写入 Pak 文件
+     * @param PakPath 输出路径
+     * @param Alignment 条目数据的对齐大小，必须是 2 的幂
+     * @return 成功返回 true
+     */
+    bool Write(FStringView PakPath, UInt32 Alignment = DefaultAlignment) const;
+
+private:
+    struct FPendingEntry
+    {
+        FUuid                Uuid;
+        EAssetType           AssetType;
+        FString              SourcePath;
+        UInt32               LoadOrder;
+        EAssetPakCompression Compression;
+    };
+
+    TArray<FPendingEntry> PendingEntries;
+};
+
+/**
+ * 管理所有已挂载的 Pak，后挂载的 Pak 优先
+ * 启动时自动挂载 Intermediate/Assets.pak（如果存在）
+ */
+class HK_API FAssetPakManager : public TSingleton<FAssetPakManager>
+{
+public:
+    // 启动时存在则自动挂载，FAssetCooker 默认也输出到这里
+    static constexpr const char* DefaultPakPath = "Intermediate/Assets.pak";
+
+    void StartUp() override;
+    void ShutDown() override;
+
+    bool Mount(FStringView PakPath);
+
+    /**
+     * 在已挂载的 Pak 中查找条目
+     * @param Uuid 资产 UUID
+     * @param OutPak 条目所在的 Pak
+     * @return 未找到返回 nullptr
+     */
+    const FAssetPakEntry* FindEntry(const FUuid& Uuid, const FAssetPak*& OutPak) const;
+
+    /**
+     * 从已挂载的 Pak 中读取中间文件
+     * @return 不存在或读取失败返回 false
+     */
+    bool Read(const FUuid& Uuid, FAssetPakBuffer& OutBuffer) const;
+
+    /**
+     * 预读一批即将加载的资产，不在 Pak 中的 UUID 会被忽略
+     */
+    void Prefetch(TSpan<const FUuid> Uuids) const;
+
+private:
+    // 挂载只在启动阶段进行，读取时只需要短暂持有锁查找 Pak
+    mutable HK_PROFILE_LOCKABLE(std::mutex, MountMutex);
+    TArray<TUniquePtr<FAssetPak>> MountedPaks;
+};
@@ -4,9 +4,14 @@
 
 #include "AssetRegistry.h"
 #include "AssetImporter.h"
+#include "Config/ConfigManager.h"
+#include "Config/EngineConfig.h"
 #include "Core/Logging/Logger.h"
 #include "Core/Serialization/JsonArchive.h"
+#include "Core/Serialization/JsonStreamArchive.h"
+#include "Core/Container/Bitmap.h"
 #include "Core/Utility/FileUtility.h"
+#include "Core/Utility/Profiler.h"
 #include <algorithm>
 #include <filesystem>
 
@@ -36,43 +41,163 @@ static FString NormalizeAssetPath(FStringView InPath)
 // FAssetRegistry 实现
 // ============================================================================
 
+static constexpr const char* AssetRegistryDatabasePath = "Intermediate/AssetRegistry.db";
+
+void FAssetRegistry::StartUp()
+{
+    HK_PROFILE_SCOPE_N("FAssetRegistry::StartUp");
+    if (!Database.Open(AssetRegistryDatabasePath))
+    {
+        HK_LOG_INFO(ELogcat::Asset, "Asset registry database not found, metadata will be loaded from .meta files");
+    }
+
+    // 数据库可能落后于磁盘上被编辑、新增或删除的 .meta, 先同步再对外提供元数据
+    // 同步只比较时间戳与大小, 未变化的 .meta 不会重新解析; 变化写回数据库, 下次启动无需再解析
+    const auto* Cfg = FConfigManager::GetRef().GetConfig<FEngineConfig>();
+    if (Cfg && !Cfg->GetAssetDirectory().IsEmpty())
+    {
+        SyncWithMetaFiles(Cfg->GetAssetDirectory());
+        FlushDatabase();
+    }
+
+    FMemoryEvictionDelegate Evict;
+    Evict.Bind<&FAssetRegistry::EvictCachedMetadata>(this);
+    EvictionHandle =
+        FMemoryBudget::GetRef().AddEvictionHandler(EMemoryTag::AssetMetadata, EMemoryDomain::Cpu, std::move(Evict));
+}
+
+void FAssetRegistry::ShutDown()
+{
+    FMemoryBudget::GetRef().RemoveEvictionHandler(EvictionHandle);
+    FlushDatabase();
+    Database.Close();
+}
+
+bool FAssetRegistry::FindUuidByPath(const FString& Path, FUuid& OutUuid) const
+{
+    // 1. 本次运行中的改动
+    if (const auto* UuidPtr = PathToUuid.Find(Path); UuidPtr != nullptr)
+    {
+        if (RemovedAssets.Contains(*UuidPtr))
+        {
+            return false;
+        }
+        OutUuid = *UuidPtr;
+        return true;
+    }
+
+    // 2. 数据库索引
+    const Int32 Index = Database.FindByPath(Path);
+    if (Index == FAssetRegistryDatabase::InvalidIndex)
+    {
+        return false;
+    }
+
+    const FUuid Uuid = Database.GetEntryUuid(Index);
+    if (RemovedAssets.Contains(Uuid))
+    {
+        return false;
+    }
+
+    // 资产在本次运行中被移动到了其他路径
+    if (const auto* MovedPath = UuidToPath.Find(Uuid); MovedPath != nullptr && *MovedPath != Path)
+    {
+        return false;
+    }
+
+    OutUuid = Uuid;
+    return true;
+}
+
+bool FAssetRegistry::FindUuidByStem(FStringView Stem, FUuid& OutUuid) const
+{
+    if (const auto* UuidPtr = StemToUuid.Find(FString(Stem)); UuidPtr != nullptr && !RemovedAssets.Contains(*UuidPtr))
+    {
+        OutUuid = *UuidPtr;
+        return true;
+    }
+
+    const Int32 Index = Database.FindByStem(Stem);
+    if (Index == FAssetRegistryDatabase::InvalidIndex)
+    {
+        return false;
+    }
+
+    const FUuid Uuid = Database.GetEntryUuid(Index);
+    if (RemovedAssets.Contains(Uuid) || UuidToPath.Contains(Uuid))
+    {
+        return false;
+    }
+
+    OutUuid = Uuid;
+    return true;
+}
+
+void FAssetRegistry::MarkDirty(const TSharedPtr<FAssetMetadata>& Metadata)
+{
+    // 路径变化时移除旧的路径索引
+    if (const auto* OldPath = UuidToPath.Find(Metadata->Uuid); OldPath != nullptr && *OldPath != Metadata->Path)
+    {
+        PathToUuid.Remove(*OldPath);
+        StemToUuid.Remove(FString(FAssetRegistryDatabase::GetPathStem(*OldPath)));
+    }
+
+    const FString Stem(FAssetRegistryDatabase::GetPathStem(Metadata->Path));
+    CachedMetadata.Add(Metadata->Uuid, Metadata);
+    UpdateCachedMetadataCharge();
+    RemovedAssets.Remove(Metadata->Uuid);
+    DirtyMetadata[Metadata->Uuid] = Metadata;
+    UuidToPath[Metadata->Uuid]    = Metadata->Path;
+    PathToUuid[Metadata->Path]    = Metadata->Uuid;
+    StemToUuid[Stem]              = Metadata->Uuid;
+}
+
 TSharedPtr<FAssetMetadata> FAssetRegistry::LoadAssetMetadata(FStringView InPath)
 {
+    AutoLock Lock(Mutex);
     // 1. 路径标准化
     FString Path = NormalizeAssetPath(InPath);
 
-    // 2. 检查内存缓存
-    if (const auto* UuidPtr = PathToUuid.Find(Path); UuidPtr != nullptr)
+    // 2. 检查内存缓存与数据库
+    if (FUuid Uuid; FindUuidByPath(Path, Uuid))
     {
-        if (auto* Cached = CachedMetadata.Find(*UuidPtr); Cached != nullptr)
+        if (auto Metadata = LoadAssetMetadata(Uuid))
         {
-            return *Cached;
+            return Metadata;
         }
     }
 
+    // 3. 数据库中没有记录，回退到解析 .meta 文件
+    return LoadAssetMetadataFromFile(Path);
+}
+
+TSharedPtr<FAssetMetadata> FAssetRegistry::LoadAssetMetadataFromFile(const FString& Path)
+{
+    HK_PROFILE_SCOPE_N("FAssetRegistry::LoadAssetMetadataFromFile");
+
     // 构建 .meta 文件路径
     FString MetaPath = Path + ".meta";
 
-    // 3. 检查文件是否存在
+    // 1. 检查文件是否存在
     if (!FFileUtility::FileExists(MetaPath))
     {
         HK_LOG_WARN(ELogcat::Asset, "Metadata file not found: {}", MetaPath);
         return nullptr;
     }
 
-    // 4. 打开文件
-    const auto File = FFileUtility::OpenFileStream(MetaPath);
-    if (!File)
+    // 2. 读取文件
+    TArray<UInt8> FileData;
+    if (!FFileUtility::ReadFileBytes(MetaPath, FileData))
     {
         HK_LOG_ERROR(ELogcat::Asset, "Failed to open metadata file: {}", MetaPath);
         return nullptr;
     }
 
-    // 5. 反序列化
+    // 3. 反序列化, 直接从文件内容按需解析, 不构建 DOM
     TSharedPtr<FAssetMetadata> Metadata = MakeShared<FAssetMetadata>();
     try
     {
-        FJsonInputArchive Archive(*File);
+        FJsonStreamInputArchive Archive(FileData.Data(), FileData.Size());
         Metadata->Serialize(Archive);
 
         // 强行修正路径为当前标准化路径（防止 Meta 文件被移动后内部路径未更新）
@@ -90,10 +215,8 @@ TSharedPtr<FAssetMetadata> FAssetRegistry::LoadAssetMetadata(FStringView InPath)
             Metadata->Uuid = FUuid::New();
         }
 
-        // 更新缓存
-        CachedMetadata.Add(Metadata->Uuid, Metadata);
-        UuidToPath[Metadata->Uuid] = Path;
-        PathToUuid[Path]           = Metadata->Uuid;
+        // 更新缓存，并在下次 Flush 时写入数据库
+        MarkDirty(Metadata);
 
         HK_LOG_INFO(ELogcat::Asset, "Loaded metadata from: {}", MetaPath);
         return Metadata;
@@ -107,17 +230,45 @@ TSharedPtr<FAssetMetadata> FAssetRegistry::LoadAssetMetadata(FStringView InPath)
 
 TSharedPtr<FAssetMetadata> FAssetRegistry::LoadAssetMetadata(const FUuid& Uuid)
 {
+    AutoLock Lock(Mutex);
+    if (RemovedAssets.Contains(Uuid))
+    {
+        HK_LOG_WARN(ELogcat::Asset, "Asset has been removed: {}", Uuid.ToString());
+        return nullptr;
+    }
+
     // 检查缓存
     if (auto* Cached = CachedMetadata.Find(Uuid); Cached != nullptr)
     {
         return *Cached;
     }
+    if (auto* Dirty = DirtyMetadata.Find(Uuid); Dirty != nullptr)
+    {
+        CachedMetadata.Add(Uuid, *Dirty);
+        UpdateCachedMetadataCharge();
+        return *Dirty;
+    }
+
+    // 从数据库的映射内存中解码
+    if (const Int32 Index = Database.FindByUuid(Uuid); Index != FAssetRegistryDatabase::InvalidIndex)
+    {
+        if (auto Metadata = Database.LoadMetadata(Index))
+        {
+            if (Metadata->FileType == EAssetFileType::Unknown)
+            {
+                Metadata->FileType = InferFileTypeFromPath(Metadata->Path);
+            }
+            CachedMetadata.Add(Uuid, Metadata);
+            UpdateCachedMetadataCharge();
+            return Metadata;
+        }
+    }
 
     // 从 UUID 查找路径
     if (const auto* PathPtr = UuidToPath.Find(Uuid); PathPtr != nullptr)
     {
         // PathPtr 指向的应该已经是标准化路径（因为只有 Load/Save 成功才会写入 Map）
-        return LoadAssetMetadata(*PathPtr);
+        return LoadAssetMetadataFromFile(*PathPtr);
     }
 
     HK_LOG_WARN(ELogcat::Asset, "UUID not found in registry: {}", Uuid.ToString());
@@ -126,17 +277,18 @@ TSharedPtr<FAssetMetadata> FAssetRegistry::LoadAssetMetadata(const FUuid& Uuid)
 
 TSharedPtr<FAssetMetadata> FAssetRegistry::CreateAssetMetadata(FStringView InPath)
 {
+    AutoLock Lock(Mutex);
     // 1. 路径标准化
     FString Path = NormalizeAssetPath(InPath);
 
     // 2. 检查是否已存在
-    if (const auto* UuidPtr = PathToUuid.Find(Path); UuidPtr != nullptr)
+    if (FUuid ExistingUuid; FindUuidByPath(Path, ExistingUuid))
     {
-        if (auto* Cached = CachedMetadata.Find(*UuidPtr); Cached != nullptr)
+        if (auto Existing = LoadAssetMetadata(ExistingUuid))
         {
             HK_LOG_WARN(ELogcat::Asset, "Asset metadata already exists for path: {}, returning existing metadata",
                         Path);
-            return *Cached;
+            return Existing;
         }
     }
 
@@ -157,9 +309,7 @@ TSharedPtr<FAssetMetadata> FAssetRegistry::CreateAssetMetadata(FStringView InPat
     }
 
     // 5. 更新缓存
-    CachedMetadata.Add(Metadata->Uuid, Metadata);
-    UuidToPath[Metadata->Uuid] = Path;
-    PathToUuid[Path]           = Metadata->Uuid;
+    MarkDirty(Metadata);
 
     HK_LOG_INFO(ELogcat::Asset, "Created asset metadata for path: {}", Path);
     return Metadata;
@@ -167,6 +317,7 @@ TSharedPtr<FAssetMetadata> FAssetRegistry::CreateAssetMetadata(FStringView InPat
 
 bool FAssetRegistry::SaveAssetMetadata(TSharedPtr<FAssetMetadata>& Metadata)
 {
+    AutoLock Lock(Mutex);
     if (!Metadata)
     {
         HK_LOG_ERROR(ELogcat::Asset, "Cannot save null metadata");
@@ -220,10 +371,8 @@ bool FAssetRegistry::SaveAssetMetadata(TSharedPtr<FAssetMetadata>& Metadata)
         FJsonOutputArchive Archive(*File);
         Metadata->Serialize(Archive);
 
-        // 更新缓存（使用SharedPtr）
-        CachedMetadata.Add(Metadata->Uuid, Metadata);
-        UuidToPath[Metadata->Uuid] = Metadata->Path;
-        PathToUuid[Metadata->Path] = Metadata->Uuid;
+        // 更新缓存（使用SharedPtr），并在下次 Flush 时写入数据库
+        MarkDirty(Metadata);
 
         HK_LOG_INFO(ELogcat::Asset, "Saved metadata to: {}", MetaPath);
         return true;
@@ -237,91 +386,53 @@ bool FAssetRegistry::SaveAssetMetadata(TSharedPtr<FAssetMetadata>& Metadata)
 
 bool FAssetRegistry::SaveAssetMetadata(FStringView InPath)
 {
+    AutoLock Lock(Mutex);
     // 1. 路径标准化
     FString LookupPath = NormalizeAssetPath(InPath);
 
-    // 检查是否存在
-    if (!IsAssetMetadataExist(LookupPath))
-    {
-        HK_LOG_ERROR(ELogcat::Asset, "Metadata not found for path: {}", InPath);
-        return false;
-    }
-
-    // 辅助 Lambda
-    auto TrySaveByKey = [&](const FString& Key) -> bool
-    {
-        if (const auto* UuidPtr = PathToUuid.Find(Key))
-        {
-            if (auto* Cached = CachedMetadata.Find(*UuidPtr))
-            {
-                return SaveAssetMetadata(*Cached);
-            }
-        }
-        return false;
-    };
-
     // --- 策略 A: 精确匹配 ---
-    if (TrySaveByKey(LookupPath))
+    FUuid Uuid;
+    bool  bFound = FindUuidByPath(LookupPath, Uuid);
+
+    // --- 策略 B: 处理传入的是 .meta 路径的情况 ---
+    if (!bFound && LookupPath.EndsWith(".meta"))
     {
-        return true;
+        bFound = FindUuidByPath(FString(LookupPath.SubStr(0, LookupPath.Length() - 5)), Uuid);
     }
 
-    // --- 策略 B: 处理传入的是 .meta 路径的情况 ---
-    if (LookupPath.EndsWith(".meta"))
+    // --- 策略 C: 缺少扩展名时通过无扩展名路径索引查找 ---
+    if (!bFound && FAssetRegistryDatabase::GetPathStem(LookupPath) == FStringView(LookupPath))
     {
-        const FStringView AssetPathView = LookupPath.SubStr(0, LookupPath.Length() - 5);
-        // 需要构造 FString 来查找 Map
-        if (TrySaveByKey(FString(AssetPathView)))
+        bFound = FindUuidByStem(LookupPath, Uuid);
+        if (bFound)
         {
-            return true;
+            HK_LOG_INFO(ELogcat::Asset, "Fuzzy match found for saving: '{}' -> '{}'", LookupPath, Uuid.ToString());
         }
     }
 
-    // --- 策略 C: 模糊匹配 (处理缺少扩展名的情况) ---
-    bool   bHasExtension = false;
-    size_t LastDot       = LookupPath.FindLastOf('.');
-    size_t LastSlash     = LookupPath.FindLastOf('/');
-
-    if (LastDot != std::string::npos)
+    if (bFound)
     {
-        if (LastSlash == std::string::npos || LastDot > LastSlash)
+        if (auto Metadata = LoadAssetMetadata(Uuid))
         {
-            bHasExtension = true;
+            return SaveAssetMetadata(Metadata);
         }
     }
-
-    if (!bHasExtension)
+    else if (IsAssetMetadataExist(LookupPath))
     {
-        for (const auto& [RegisteredPath, Uuid] : PathToUuid)
+        // 只有 .meta 文件，尚未加载过
+        if (auto Metadata = LoadAssetMetadataFromFile(LookupPath))
         {
-            // 1. 必须以 LookupPath 开头
-            if (!RegisteredPath.StartsWith(LookupPath))
-                continue;
-
-            // 2. 检查 RegisteredPath 的点的位置
-            size_t RegDotPos = RegisteredPath.FindLastOf('.');
-            if (RegDotPos == std::string::npos)
-                continue;
-
-            // 3. 长度匹配
-            if (LookupPath.Length() == RegDotPos)
-            {
-                if (auto* Cached = CachedMetadata.Find(Uuid))
-                {
-                    HK_LOG_INFO(ELogcat::Asset, "Fuzzy match found for saving: '{}' -> '{}'", LookupPath,
-                                RegisteredPath);
-                    return SaveAssetMetadata(*Cached);
-                }
-            }
+            return SaveAssetMetadata(Metadata);
         }
     }
 
-    HK_LOG_ERROR(ELogcat::Asset, "Metadata not found in cache for path (or variants): {}", InPath);
+    HK_LOG_ERROR(ELogcat::Asset, "Metadata not found for path (or variants): {}", InPath);
     return false;
 }
 
 bool FAssetRegistry::SaveAssetMetadata(const FUuid& Uuid)
 {
+    AutoLock Lock(Mutex);
     // 检查是否存在
     if (!IsAssetMetadataExist(Uuid))
     {
@@ -329,9 +440,9 @@ bool FAssetRegistry::SaveAssetMetadata(const FUuid& Uuid)
         return false;
     }
 
-    if (auto* Cached = CachedMetadata.Find(Uuid); Cached != nullptr)
+    if (auto Metadata = LoadAssetMetadata(Uuid))
     {
-        return SaveAssetMetadata(*Cached);
+        return SaveAssetMetadata(Metadata);
     }
 
     HK_LOG_ERROR(ELogcat::Asset, "Metadata not found in cache for UUID: {}", Uuid.ToString());
@@ -340,16 +451,14 @@ bool FAssetRegistry::SaveAssetMetadata(const FUuid& Uuid)
 
 bool FAssetRegistry::IsAssetMetadataExist(FStringView InPath) const
 {
+    AutoLock Lock(Mutex);
     // 1. 路径标准化
     FString Path = NormalizeAssetPath(InPath);
 
-    // 2. 检查内存缓存
-    if (const auto* UuidPtr = PathToUuid.Find(Path); UuidPtr != nullptr)
+    // 2. 检查内存缓存与数据库
+    if (FUuid Uuid; FindUuidByPath(Path, Uuid))
     {
-        if (CachedMetadata.Find(*UuidPtr) != nullptr)
-        {
-            return true;
-        }
+        return true;
     }
 
     // 3. 检查文件系统
@@ -364,8 +473,15 @@ bool FAssetRegistry::IsAssetMetadataExist(FStringView InPath) const
 
 bool FAssetRegistry::IsAssetMetadataExist(const FUuid& Uuid) const
 {
-    // 1. 检查内存缓存
-    if (CachedMetadata.Find(Uuid) != nullptr)
+    AutoLock Lock(Mutex);
+    if (RemovedAssets.Contains(Uuid))
+    {
+        return false;
+    }
+
+    // 1. 检查内存缓存与数据库
+    if (CachedMetadata.Find(Uuid) != nullptr || DirtyMetadata.Contains(Uuid) ||
+        Database.FindByUuid(Uuid) != FAssetRegistryDatabase::InvalidIndex)
     {
         return true;
     }
@@ -384,6 +500,189 @@ bool FAssetRegistry::IsAssetMetadataExist(const FUuid& Uuid) const
     return false;
 }
 
+TArray<FUuid> FAssetRegistry::GetAllAssetUuids() const
+{
+    AutoLock Lock(Mutex);
+
+    TArray<FUuid> Uuids;
+    Uuids.Reserve(Database.GetEntryCount() + DirtyMetadata.Size());
+    for (UInt32 I = 0; I < Database.GetEntryCount(); ++I)
+    {
+        const FUuid Uuid = Database.GetEntryUuid(static_cast<Int32>(I));
+        if (!RemovedAssets.Contains(Uuid) && !DirtyMetadata.Contains(Uuid))
+        {
+            Uuids.Add(Uuid);
+        }
+    }
+    for (const auto& [Uuid, Metadata] : DirtyMetadata)
+    {
+        if (!RemovedAssets.Contains(Uuid))
+        {
+            Uuids.Add(Uuid);
+        }
+    }
+    return Uuids;
+}
+
+void FAssetRegistry::SyncWithMetaFiles(FStringView RootDirectory)
+{
+    AutoLock Lock(Mutex);
+    HK_PROFILE_SCOPE_N("FAssetRegistry::SyncWithMetaFiles");
+
+    const FString               RootPath = NormalizeAssetPath(RootDirectory);
+    const std::filesystem::path Root(RootPath.GetStdString());
+    std::error_code             ErrorCode;
+    if (!std::filesystem::is_directory(Root, ErrorCode))
+    {
+        HK_LOG_WARN(ELogcat::Asset, "Asset directory not found: {}", RootPath);
+        return;
+    }
+
+    Int32          NumChanged = 0;
+    Int32          NumRemoved = 0;
+    FDynamicBitmap Seen(Database.GetEntryCount());
+
+    // 1. 只比较时间戳，变化或新增的 .meta 才重新解析
+    for (std::filesystem::recursive_directory_iterator
+             It(Root, std::filesystem::directory_options::skip_permission_denied, ErrorCode),
+         End;
+         It != End; It.increment(ErrorCode))
+    {
+        if (ErrorCode)
+        {
+            break;
+        }
+        if (!It->is_regular_file(ErrorCode) || It->path().extension() != ".meta")
+        {
+            continue;
+        }
+
+        const FString MetaPath  = NormalizeAssetPath(It->path().generic_string());
+        const FString AssetPath = FString(MetaPath.SubStr(0, MetaPath.Length() - 5));
+
+        if (const Int32 Index = Database.FindByPath(AssetPath); Index != FAssetRegistryDatabase::InvalidIndex)
+        {
+            Seen.Set(Index);
+            const FUuid Uuid = Database.GetEntryUuid(Index);
+            if (Database.GetEntry(Index).MetaStamp == FAssetMetaFileStamp::FromFile(MetaPath) &&
+                !DirtyMetadata.Contains(Uuid))
+            {
+                continue;
+            }
+        }
+
+        if (LoadAssetMetadataFromFile(AssetPath))
+        {
+            ++NumChanged;
+        }
+    }
+
+    // 2. 数据库中存在但 .meta 已被删除的资产
+    for (UInt32 I = 0; I < Database.GetEntryCount(); ++I)
+    {
+        const Int32 Index = static_cast<Int32>(I);
+        if (Seen.Test(I) || !Database.GetEntryPath(Index).StartsWith(RootPath))
+        {
+            continue;
+        }
+
+        const FUuid Uuid = Database.GetEntryUuid(Index);
+        if (!DirtyMetadata.Contains(Uuid))
+        {
+            RemovedAssets[Uuid] = FString(Database.GetEntryPath(Index));
+            ++NumRemoved;
+        }
+    }
+
+    HK_LOG_INFO(ELogcat::Asset, "Synced asset registry with {}: {} changed, {} removed", RootPath, NumChanged,
+                NumRemoved);
+}
+
+bool FAssetRegistry::FlushDatabase()
+{
+    AutoLock Lock(Mutex);
+    if (DirtyMetadata.IsEmpty() && RemovedAssets.IsEmpty())
+    {
+        return true;
+    }
+
+    HK_PROFILE_SCOPE_N("FAssetRegistry::FlushDatabase");
+
+    TArray<FAssetRegistryDatabaseRecord> Records;
+    Records.Reserve(Database.GetEntryCount() + DirtyMetadata.Size());
+
+    // 1. 未改动的记录直接复用已序列化的数据
+    for (UInt32 I = 0; I < Database.GetEntryCount(); ++I)
+    {
+        const Int32       Index = static_cast<Int32>(I);
+        const FUuid       Uuid  = Database.GetEntryUuid(Index);
+        const FStringView Path  = Database.GetEntryPath(Index);
+        if (DirtyMetadata.Contains(Uuid) || RemovedAssets.Contains(Uuid))
+        {
+            continue;
+        }
+        // 该路径已经被另一个资产占用
+        if (const auto* Owner = PathToUuid.Find(FString(Path)); Owner != nullptr && *Owner != Uuid)
+        {
+            continue;
+        }
+
+        const TSpan<const UInt8>     Bytes = Database.GetEntryMetadata(Index);
+        FAssetRegistryDatabaseRecord Record;
+        Record.Uuid            = Uuid;
+        Record.Path            = FString(Path);
+        Record.MetaStamp       = Database.GetEntry(Index).MetaStamp;
+        Record.RawMetadata     = Bytes.Data();
+        Record.RawMetadataSize = static_cast<UInt32>(Bytes.Size());
+        Records.Add(std::move(Record));
+    }
+
+    // 2. 本次运行中改动的记录，还没有保存过 .meta 的资产不写入数据库
+    TMap<FUuid, TSharedPtr<FAssetMetadata>> UnsavedMetadata;
+    for (const auto& [Uuid, Metadata] : DirtyMetadata)
+    {
+        if (RemovedAssets.Contains(Uuid))
+        {
+            continue;
+        }
+
+        const FAssetMetaFileStamp Stamp = FAssetMetaFileStamp::FromFile(Metadata->Path + ".meta");
+        if (!Stamp.IsValid())
+        {
+            UnsavedMetadata[Uuid] = Metadata;
+            continue;
+        }
+
+        FAssetRegistryDatabaseRecord Record;
+        Record.Uuid      = Uuid;
+        Record.Path      = Metadata->Path;
+        Record.MetaStamp = Stamp;
+        Record.Metadata  = Metadata;
+        Records.Add(std::move(Record));
+    }
+
+    // 3. 先写临时文件，解除旧文件映射后再替换
+    const FString TempPath = FString(AssetRegistryDatabasePath) + ".tmp";
+    if (!FAssetRegistryDatabase::Write(TempPath, Records))
+    {
+        return false;
+    }
+
+    Database.Close();
+    std::error_code ErrorCode;
+    std::filesystem::rename(TempPath.GetStdString(), AssetRegistryDatabasePath, ErrorCode);
+    if (ErrorCode)
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Failed to replace asset registry database {}: {}", AssetRegistryDatabasePath,
+                     ErrorCode.message());
+    }
+    Database.Open(AssetRegistryDatabasePath);
+
+    DirtyMetadata = std::move(UnsavedMetadata);
+    RemovedAssets.Clear();
+    return !ErrorCode;
+}
+
 EAssetFileType FAssetRegistry::InferFileTypeFromPath(const FStringView& Path)
 {
     if (Path.IsEmpty())
@@ -508,4 +807,23 @@ EAssetFileType FAssetRegistry::InferFileTypeFromExtension(const FStringView& Ext
         return EAssetFileType::TXT;
 
     return EAssetFileType::Unknown;
-}
\ No newline at end of file
+}
+
+void FAssetRegistry::UpdateCachedMetadataCharge()
+{
+    // 只计入元数据对象本身, 路径等字符串的堆内存不计
+    constexpr Int64 EntryBytes = sizeof(FAssetMetadata) + sizeof(FUuid) + sizeof(TSharedPtr<FAssetMetadata>);
+    CachedMetadataCharge.Resize(static_cast<Int64>(CachedMetadata.Size()) * EntryBytes);
+}
+
+Int64 FAssetRegistry::EvictCachedMetadata(const Int64 InBytes)
+{
+    // 缓存不能部分淘汰, 直接全部清空
+    (void)InBytes;
+
+    AutoLock    Lock(Mutex);
+    const Int64 Before = CachedMetadataCharge.GetBytes();
+    CachedMetadata.Clear();
+    UpdateCachedMetadataCharge();
+    return Before - CachedMetadataCharge.GetBytes();
+}
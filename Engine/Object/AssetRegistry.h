@@ -1,8 +1,11 @@
 #pragma once
 #include "Asset.h"
+#include "AssetRegistryDatabase.h"
 #include "Core/Container/LruCache.h"
+#include "Core/Memory/MemoryBudget.h"
 #include "Core/Reflection/Reflection.h"
 #include "Core/String/StringView.h"
+#include "Core/Utility/Profiler.h"
 #include "Core/Utility/SharedPtr.h"
 #include "Core/Utility/Uuid.h"
 
@@ -132,6 +135,9 @@ class FAssetRegistry : public TSingleton<FAssetRegistry>
 public:
     FAssetRegistry() : CachedMetadata(512) {}
 
+    void StartUp() override;
+    void ShutDown() override;
+
     /**
      * 加载资产元数据
      * @param Path 资产路径
@@ -188,6 +194,12 @@ public:
      */
     bool IsAssetMetadataExist(const FUuid& Uuid) const;
 
+    /**
+     * 获取注册表中所有资产的 UUID，包括本次运行中新增但尚未写回数据库的资产
+     * @return UUID 列表，顺序不保证
+     */
+    TArray<FUuid> GetAllAssetUuids() const;
+
     /**
      * 根据文件扩展名推断文件类型
      * @param Path 文件路径
@@ -202,8 +214,65 @@ public:
      */
     static EAssetFileType InferFileTypeFromExtension(const FStringView& Extension);
 
+    /**
+     * 扫描目录下的所有 .meta 文件并与注册表数据库同步
+     * 只比较时间戳和文件大小，只有发生变化或新增的 .meta 才会重新解析，目录下已被删除的资产会从数据库中移除
+     * 编辑器或外部工具修改 .meta 之后调用
+     * @param RootDirectory 资产根目录
+     */
+    void SyncWithMetaFiles(FStringView RootDirectory);
+
+    /**
+     * 将本次运行中新增、修改、删除的元数据写回注册表数据库
+     * @return 成功或无需写入时返回 true
+     */
+    bool FlushDatabase();
+
 private:
+    /**
+     * 从 .meta JSON 文件解析元数据，并记录为需要写回数据库
+     */
+    TSharedPtr<FAssetMetadata> LoadAssetMetadataFromFile(const FString& Path);
+
+    /**
+     * 通过标准化路径查找 UUID，依次查询本次运行的改动和数据库索引
+     */
+    bool FindUuidByPath(const FString& Path, FUuid& OutUuid) const;
+
+    /**
+     * 通过不带扩展名的标准化路径查找 UUID
+     */
+    bool FindUuidByStem(FStringView Stem, FUuid& OutUuid) const;
+
+    /**
+     * 记录一条新增或修改过的元数据
+     */
+    void MarkDirty(const TSharedPtr<FAssetMetadata>& Metadata);
+
+    /**
+     * 按缓存条数更新 AssetMetadata 分类的用量, 修改 CachedMetadata 后调用
+     */
+    void UpdateCachedMetadataCharge();
+
+    /**
+     * AssetMetadata 超出预算时清空缓存, 修改过的元数据保存在 DirtyMetadata 中, 不会丢失
+     * @return 释放的字节数
+     */
+    Int64 EvictCachedMetadata(Int64 InBytes);
+
+    // 本次运行中的改动，优先级高于数据库
     TMap<FUuid, FString>                         UuidToPath;
     TMap<FString, FUuid>                         PathToUuid;
+    TMap<FString, FUuid>                         StemToUuid;
+    TMap<FUuid, TSharedPtr<FAssetMetadata>>      DirtyMetadata;
+    TMap<FUuid, FString>                         RemovedAssets;
     TLruCache<FUuid, TSharedPtr<FAssetMetadata>> CachedMetadata;
+
+    FAssetRegistryDatabase Database;
+
+    FMemoryCharge         CachedMetadataCharge{EMemoryTag::AssetMetadata, 0};
+    FMemoryBudget::Handle EvictionHandle = 0;
+
+    // 异步加载时 Import 可能在 Render 线程执行，公开接口之间会相互调用，因此使用递归锁
+    mutable HK_PROFILE_LOCKABLE(std::recursive_mutex, Mutex);
 };
@@ -0,0 +1,356 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "AssetRegistryDatabase.h"
+#include "AssetRegistry.h"
+#include "Core/Logging/Logger.h"
+#include "Core/Serialization/SchemaArchive.h"
+#include "Core/Utility/FileUtility.h"
+#include "Core/Utility/HashUtility.h"
+#include "Core/Utility/Profiler.h"
+#include <bit>
+#include <cstring>
+#include <filesystem>
+
+static_assert(sizeof(FAssetRegistryDatabaseHeader) % 8 == 0, "Header must keep 8 byte alignment");
+static_assert(sizeof(FAssetRegistryDatabaseEntry) % 8 == 0, "Entry must keep 8 byte alignment");
+
+static UInt64 AlignUp(const UInt64 Value, const UInt64 Alignment)
+{
+    return (Value + Alignment - 1) & ~(Alignment - 1);
+}
+
+FAssetMetaFileStamp FAssetMetaFileStamp::FromFile(FStringView FilePath)
+{
+    FAssetMetaFileStamp   Stamp;
+    std::error_code       ErrorCode;
+    std::filesystem::path Path(FilePath.GetStdStringView());
+
+    const auto WriteTime = std::filesystem::last_write_time(Path, ErrorCode);
+    if (ErrorCode)
+    {
+        return Stamp;
+    }
+    const auto FileSize = std::filesystem::file_size(Path, ErrorCode);
+    if (ErrorCode)
+    {
+        return Stamp;
+    }
+
+    Stamp.WriteTime = static_cast<Int64>(WriteTime.time_since_epoch().count());
+    Stamp.FileSize  = static_cast<UInt64>(FileSize);
+    return Stamp;
+}
+
+bool FAssetRegistryDatabase::Open(FStringView DatabasePath)
+{
+    HK_PROFILE_SCOPE_N("FAssetRegistryDatabase::Open");
+    Close();
+
+    if (!File.Open(DatabasePath))
+    {
+        return false;
+    }
+
+    const UInt8* Base = File.Data();
+    const size_t Size = File.Size();
+    if (Size < sizeof(FAssetRegistryDatabaseHeader))
+    {
+        HK_LOG_WARN(ELogcat::Asset, "Asset registry database is truncated: {}", DatabasePath);
+        File.Close();
+        return false;
+    }
+
+    const auto* MappedHeader = reinterpret_cast<const FAssetRegistryDatabaseHeader*>(Base);
+    if (MappedHeader->Magic != FAssetRegistryDatabaseHeader::MagicNumber ||
+        MappedHeader->Version != FAssetRegistryDatabaseHeader::CurrentVersion)
+    {
+        HK_LOG_WARN(ELogcat::Asset, "Asset registry database version mismatch, it will be rebuilt: {}", DatabasePath);
+        File.Close();
+        return false;
+    }
+
+    const UInt64 IndexBytes = static_cast<UInt64>(MappedHeader->BucketCount) * sizeof(UInt32);
+    const bool   bValid =
+        std::has_single_bit(MappedHeader->BucketCount) && MappedHeader->BucketCount > MappedHeader->EntryCount &&
+        MappedHeader->EntryTableOffset + MappedHeader->EntryCount * sizeof(FAssetRegistryDatabaseEntry) <= Size &&
+        MappedHeader->UuidIndexOffset + IndexBytes <= Size && MappedHeader->PathIndexOffset + IndexBytes <= Size &&
+        MappedHeader->StemIndexOffset + IndexBytes <= Size &&
+        MappedHeader->BlobOffset + MappedHeader->BlobSize <= Size;
+    if (!bValid)
+    {
+        HK_LOG_WARN(ELogcat::Asset, "Asset registry database is corrupted, it will be rebuilt: {}", DatabasePath);
+        File.Close();
+        return false;
+    }
+
+    Header    = MappedHeader;
+    Entries   = reinterpret_cast<const FAssetRegistryDatabaseEntry*>(Base + Header->EntryTableOffset);
+    UuidIndex = reinterpret_cast<const UInt32*>(Base + Header->UuidIndexOffset);
+    PathIndex = reinterpret_cast<const UInt32*>(Base + Header->PathIndexOffset);
+    StemIndex = reinterpret_cast<const UInt32*>(Base + Header->StemIndexOffset);
+    Blob      = Base + Header->BlobOffset;
+
+    HK_LOG_INFO(ELogcat::Asset, "Mapped asset registry database: {} ({} assets)", DatabasePath, Header->EntryCount);
+    return true;
+}
+
+void FAssetRegistryDatabase::Close()
+{
+    File.Close();
+    Header    = nullptr;
+    Entries   = nullptr;
+    UuidIndex = nullptr;
+    PathIndex = nullptr;
+    StemIndex = nullptr;
+    Blob      = nullptr;
+}
+
+template <typename Predicate>
+Int32 FAssetRegistryDatabase::FindInIndex(const UInt32* Index, const UInt64 Hash, Predicate&& Pred) const
+{
+    if (Header == nullptr || Header->EntryCount == 0)
+    {
+        return InvalidIndex;
+    }
+
+    // 线性探测，装载因子不超过 0.5，探测链很短
+    const UInt32 Mask = Header->BucketCount - 1;
+    for (UInt32 Slot = static_cast<UInt32>(Hash) & Mask;; Slot = (Slot + 1) & Mask)
+    {
+        const UInt32 EntryIndex = Index[Slot];
+        if (EntryIndex == EmptySlot)
+        {
+            return InvalidIndex;
+        }
+        if (EntryIndex < Header->EntryCount && Pred(Entries[EntryIndex]))
+        {
+            return static_cast<Int32>(EntryIndex);
+        }
+    }
+}
+
+Int32 FAssetRegistryDatabase::FindByUuid(const FUuid& Uuid) const
+{
+    const auto Bytes = Uuid.Uuid.as_bytes();
+    return FindInIndex(UuidIndex, ComputeUuidHash(Uuid),
+                       [&](const FAssetRegistryDatabaseEntry& Entry)
+                       { return std::memcmp(Entry.Uuid, Bytes.data(), sizeof(Entry.Uuid)) == 0; });
+}
+
+Int32 FAssetRegistryDatabase::FindByPath(FStringView Path) const
+{
+    const UInt64 Hash = ComputePathHash(Path);
+    return FindInIndex(PathIndex, Hash,
+                       [&](const FAssetRegistryDatabaseEntry& Entry)
+                       {
+                           return Entry.PathHash == Hash && Entry.PathLength == Path.Size() &&
+                                  std::memcmp(Blob + Entry.PathOffset, Path.Data(), Path.Size()) == 0;
+                       });
+}
+
+Int32 FAssetRegistryDatabase::FindByStem(FStringView Stem) const
+{
+    const UInt64 Hash = ComputePathHash(Stem);
+    return FindInIndex(StemIndex, Hash,
+                       [&](const FAssetRegistryDatabaseEntry& Entry)
+                       {
+                           if (Entry.StemHash != Hash)
+                           {
+                               return false;
+                           }
+                           const FStringView EntryPath(reinterpret_cast<const char*>(Blob + Entry.PathOffset),
+                                                       Entry.PathLength);
+                           return GetPathStem(EntryPath) == Stem;
+                       });
+}
+
+const FAssetRegistryDatabaseEntry& FAssetRegistryDatabase::GetEntry(const Int32 Index) const
+{
+    HK_ASSERT_RAW(Header != nullptr && Index >= 0 && static_cast<UInt32>(Index) < Header->EntryCount);
+    return Entries[Index];
+}
+
+FUuid FAssetRegistryDatabase::GetEntryUuid(const Int32 Index) const
+{
+    const auto& Entry = GetEntry(Index);
+    FUuid       Result;
+    Result.Uuid = uuids::uuid(std::begin(Entry.Uuid), std::end(Entry.Uuid));
+    return Result;
+}
+
+FStringView FAssetRegistryDatabase::GetEntryPath(const Int32 Index) const
+{
+    const auto& Entry = GetEntry(Index);
+    return {reinterpret_cast<const char*>(Blob + Entry.PathOffset), Entry.PathLength};
+}
+
+TSpan<const UInt8> FAssetRegistryDatabase::GetEntryMetadata(const Int32 Index) const
+{
+    const auto& Entry = GetEntry(Index);
+    if (Entry.MetadataOffset + static_cast<UInt64>(Entry.MetadataSize) > Header->BlobSize)
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Asset registry record out of range: {}", GetEntryPath(Index));
+        return {};
+    }
+    return {Blob + Entry.MetadataOffset, Entry.MetadataSize};
+}
+
+TSharedPtr<FAssetMetadata> FAssetRegistryDatabase::LoadMetadata(const Int32 Index) const
+{
+    const TSpan<const UInt8> Bytes = GetEntryMetadata(Index);
+    if (Bytes.Size() == 0)
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<FAssetMetadata> Metadata = MakeShared<FAssetMetadata>();
+    try
+    {
+        FSchemaInputArchive Archive(Bytes.Data(), Bytes.Size());
+        Metadata->Serialize(Archive);
+    }
+    catch (const std::exception& e)
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Failed to decode asset registry record {}: {}", GetEntryPath(Index), e.what());
+        return nullptr;
+    }
+
+    // 路径以数据库索引为准
+    Metadata->Path = FString(GetEntryPath(Index));
+    return Metadata;
+}
+
+bool FAssetRegistryDatabase::Write(FStringView DatabasePath, const TArray<FAssetRegistryDatabaseRecord>& Records)
+{
+    HK_PROFILE_SCOPE_N("FAssetRegistryDatabase::Write");
+
+    const UInt32 EntryCount  = static_cast<UInt32>(Records.Size());
+    const UInt32 BucketCount = std::bit_ceil(std::max<UInt32>(EntryCount * 2, 16));
+
+    TArray<FAssetRegistryDatabaseEntry> NewEntries;
+    TArray<UInt32>                      NewUuidIndex;
+    TArray<UInt32>                      NewPathIndex;
+    TArray<UInt32>                      NewStemIndex;
+    TArray<UInt8>                       NewBlob;
+    NewEntries.Resize(EntryCount);
+    NewUuidIndex.Resize(BucketCount, EmptySlot);
+    NewPathIndex.Resize(BucketCount, EmptySlot);
+    NewStemIndex.Resize(BucketCount, EmptySlot);
+
+    const UInt32 Mask       = BucketCount - 1;
+    auto         InsertSlot = [Mask](TArray<UInt32>& Index, const UInt64 Hash, const UInt32 EntryIndex)
+    {
+        UInt32 Slot = static_cast<UInt32>(Hash) & Mask;
+        while (Index[Slot] != EmptySlot)
+        {
+            Slot = (Slot + 1) & Mask;
+        }
+        Index[Slot] = EntryIndex;
+    };
+
+    for (UInt32 I = 0; I < EntryCount; ++I)
+    {
+        const auto&                  Record = Records[I];
+        FAssetRegistryDatabaseEntry& Entry  = NewEntries[I];
+
+        const auto UuidBytes = Record.Uuid.Uuid.as_bytes();
+        std::memcpy(Entry.Uuid, UuidBytes.data(), sizeof(Entry.Uuid));
+        Entry.PathHash  = ComputePathHash(Record.Path);
+        Entry.StemHash  = ComputePathHash(GetPathStem(Record.Path));
+        Entry.MetaStamp = Record.MetaStamp;
+
+        Entry.PathOffset = static_cast<UInt32>(NewBlob.Size());
+        Entry.PathLength = static_cast<UInt32>(Record.Path.Length());
+        NewBlob.Resize(NewBlob.Size() + Record.Path.Length());
+        std::memcpy(NewBlob.Data() + Entry.PathOffset, Record.Path.Data(), Record.Path.Length());
+
+        Entry.MetadataOffset = static_cast<UInt32>(NewBlob.Size());
+        if (TSharedPtr<FAssetMetadata> Metadata = Record.Metadata)
+        {
+            try
+            {
+                // Archive 析构时才写入 Schema 表
+                FSchemaOutputArchive Archive(NewBlob);
+                Metadata->Serialize(Archive);
+            }
+            catch (const std::exception& e)
+            {
+                HK_LOG_ERROR(ELogcat::Asset, "Failed to encode asset registry record {}: {}", Record.Path, e.what());
+                return false;
+            }
+        }
+        else if (Record.RawMetadata != nullptr)
+        {
+            NewBlob.Resize(NewBlob.Size() + Record.RawMetadataSize);
+            std::memcpy(NewBlob.Data() + Entry.MetadataOffset, Record.RawMetadata, Record.RawMetadataSize);
+        }
+        Entry.MetadataSize = static_cast<UInt32>(NewBlob.Size()) - Entry.MetadataOffset;
+
+        InsertSlot(NewUuidIndex, ComputeUuidHash(Record.Uuid), I);
+        InsertSlot(NewPathIndex, Entry.PathHash, I);
+        InsertSlot(NewStemIndex, Entry.StemHash, I);
+    }
+
+    FAssetRegistryDatabaseHeader NewHeader;
+    const UInt64                 IndexBytes = static_cast<UInt64>(BucketCount) * sizeof(UInt32);
+    NewHeader.EntryCount       = EntryCount;
+    NewHeader.BucketCount      = BucketCount;
+    NewHeader.EntryTableOffset = sizeof(FAssetRegistryDatabaseHeader);
+    NewHeader.UuidIndexOffset  = NewHeader.EntryTableOffset + EntryCount * sizeof(FAssetRegistryDatabaseEntry);
+    NewHeader.PathIndexOffset  = NewHeader.UuidIndexOffset + IndexBytes;
+    NewHeader.StemIndexOffset  = NewHeader.PathIndexOffset + IndexBytes;
+    NewHeader.BlobOffset       = AlignUp(NewHeader.StemIndexOffset + IndexBytes, 8);
+    NewHeader.BlobSize         = NewBlob.Size();
+
+    {
+        auto Stream = FFileUtility::CreateFileStream(DatabasePath, true, true);
+        if (!Stream)
+        {
+            return false;
+        }
+
+        const UInt64 Padding = NewHeader.BlobOffset - (NewHeader.StemIndexOffset + IndexBytes);
+        const UInt8  Zeros[8] = {};
+        Stream->write(reinterpret_cast<const char*>(&NewHeader), sizeof(NewHeader));
+        Stream->write(reinterpret_cast<const char*>(NewEntries.Data()),
+                      static_cast<std::streamsize>(EntryCount * sizeof(FAssetRegistryDatabaseEntry)));
+        Stream->write(reinterpret_cast<const char*>(NewUuidIndex.Data()), static_cast<std::streamsize>(IndexBytes));
+        Stream->write(reinterpret_cast<const char*>(NewPathIndex.Data()), static_cast<std::streamsize>(IndexBytes));
+        Stream->write(reinterpret_cast<const char*>(NewStemIndex.Data()), static_cast<std::streamsize>(IndexBytes));
+        Stream->write(reinterpret_cast<const char*>(Zeros), static_cast<std::streamsize>(Padding));
+        Stream->write(reinterpret_cast<const char*>(NewBlob.Data()), static_cast<std::streamsize>(NewBlob.Size()));
+        if (!Stream->good())
+        {
+            HK_LOG_ERROR(ELogcat::Asset, "Failed to write asset registry database: {}", DatabasePath);
+            return false;
+        }
+    }
+
+    HK_LOG_INFO(ELogcat::Asset, "Wrote asset registry database: {} ({} assets)", DatabasePath, EntryCount);
+    return true;
+}
+
+UInt64 FAssetRegistryDatabase::ComputeUuidHash(const FUuid& Uuid)
+{
+    // 不能使用 std::hash，其结果不保证跨进程稳定
+    const auto Bytes = Uuid.Uuid.as_bytes();
+    return FHashUtility::ComputeHash(Bytes.data(), Bytes.size());
+}
+
+UInt64 FAssetRegistryDatabase::ComputePathHash(FStringView Path)
+{
+    return FHashUtility::ComputeHash(Path.Data(), Path.Size());
+}
+
+FStringView FAssetRegistryDatabase::GetPathStem(FStringView Path)
+{
+    const size_t LastDot   = Path.FindLastOf('.');
+    const size_t LastSlash = Path.FindLastOf('/');
+    if (LastDot == FStringView::NPos || (LastSlash != FStringView::NPos && LastDot < LastSlash))
+    {
+        return Path;
+    }
+    return Path.SubStr(0, LastDot);
+}
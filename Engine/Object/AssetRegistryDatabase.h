@@ -0,0 +1,180 @@
+#pragma once
+#include "Core/Container/Array.h"
+#include "Core/Container/Span.h"
+#include "Core/String/String.h"
+#include "Core/String/StringView.h"
+#include "Core/Utility/MappedFile.h"
+#include "Core/Utility/SharedPtr.h"
+#include "Core/Utility/Uuid.h"
+
+struct FAssetMetadata;
+
+/**
+ * .meta 文件的时间戳与大小，用于判断 .meta 是否在数据库生成后被修改
+ */
+struct FAssetMetaFileStamp
+{
+    Int64  WriteTime = 0;
+    UInt64 FileSize  = 0;
+
+    bool IsValid() const
+    {
+        return WriteTime != 0 || FileSize != 0;
+    }
+
+    bool operator==(const FAssetMetaFileStamp& Other) const
+    {
+        return WriteTime == Other.WriteTime && FileSize == Other.FileSize;
+    }
+
+    /**
+     * 读取文件当前的时间戳
+     * @param FilePath 文件路径
+     * @return 文件不存在时返回无效的时间戳
+     */
+    static FAssetMetaFileStamp FromFile(FStringView FilePath);
+};
+
+/**
+ * 数据库文件头，所有偏移均相对于文件起始位置
+ */
+struct FAssetRegistryDatabaseHeader
+{
+    static constexpr UInt32 MagicNumber    = 0x52414B48; // "HKAR"
+    static constexpr UInt32 CurrentVersion = 2;
+
+    UInt32 Magic       = MagicNumber;
+    UInt32 Version     = CurrentVersion;
+    UInt32 EntryCount  = 0;
+    UInt32 BucketCount = 0; // 每个索引的槽数量，2 的幂
+    UInt64 EntryTableOffset = 0;
+    UInt64 UuidIndexOffset  = 0;
+    UInt64 PathIndexOffset  = 0;
+    UInt64 StemIndexOffset  = 0;
+    UInt64 BlobOffset       = 0;
+    UInt64 BlobSize         = 0;
+};
+
+/**
+ * 数据库中的一条资产记录，定长，可以直接从映射内存中读取
+ * 路径字符串与序列化后的元数据存放在 Blob 区
+ */
+struct FAssetRegistryDatabaseEntry
+{
+    UInt8               Uuid[16];
+    UInt64              PathHash;
+    UInt64              StemHash; // 去掉扩展名后的路径 Hash，用于不带扩展名的查找
+    FAssetMetaFileStamp MetaStamp;
+    UInt32              PathOffset;
+    UInt32              PathLength;
+    UInt32              MetadataOffset; // FSchemaOutputArchive 序列化的 FAssetMetadata
+    UInt32              MetadataSize;
+};
+
+/**
+ * 写入数据库时使用的记录
+ * 如果 Metadata 为空则直接复用 RawMetadata 中已经序列化好的数据（来自旧数据库）
+ */
+struct FAssetRegistryDatabaseRecord
+{
+    FUuid                      Uuid;
+    FString                    Path;
+    FAssetMetaFileStamp        MetaStamp;
+    TSharedPtr<FAssetMetadata> Metadata;
+    const UInt8*               RawMetadata     = nullptr;
+    UInt32                     RawMetadataSize = 0;
+};
+
+/**
+ * 二进制资产注册表数据库
+ * 启动时通过 mmap 映射整个文件，UUID / 路径 / 无扩展名路径三个开放寻址 Hash 索引保证 O(1) 查找，
+ * 查找过程不访问文件系统，只有真正需要元数据时才从映射内存反序列化对应记录
+ */
+class HK_API FAssetRegistryDatabase
+{
+public:
+    static constexpr Int32  InvalidIndex = -1;
+    static constexpr UInt32 EmptySlot    = 0xFFFFFFFF;
+
+    /**
+     * 映射数据库文件
+     * @param DatabasePath 数据库文件路径
+     * @return 成功返回 true，文件不存在、版本不符或损坏时返回 false
+     */
+    bool Open(FStringView DatabasePath);
+
+    void Close();
+
+    bool IsOpen() const
+    {
+        return Header != nullptr;
+    }
+
+    UInt32 GetEntryCount() const
+    {
+        return Header ? Header->EntryCount : 0;
+    }
+
+    /**
+     * 通过 UUID 查找记录
+     * @return 记录索引，未找到返回 InvalidIndex
+     */
+    Int32 FindByUuid(const FUuid& Uuid) const;
+
+    /**
+     * 通过标准化路径查找记录
+     * @return 记录索引，未找到返回 InvalidIndex
+     */
+    Int32 FindByPath(FStringView Path) const;
+
+    /**
+     * 通过不带扩展名的标准化路径查找记录
+     * @return 记录索引，未找到返回 InvalidIndex
+     */
+    Int32 FindByStem(FStringView Stem) const;
+
+    const FAssetRegistryDatabaseEntry& GetEntry(Int32 Index) const;
+    FUuid                              GetEntryUuid(Int32 Index) const;
+    FStringView                        GetEntryPath(Int32 Index) const;
+
+    /**
+     * 获取记录中序列化后的元数据，指向映射内存，Close 之后失效
+     */
+    TSpan<const UInt8> GetEntryMetadata(Int32 Index) const;
+
+    /**
+     * 从映射内存中反序列化元数据
+     * @param Index 记录索引
+     * @return 元数据，失败返回 nullptr
+     */
+    TSharedPtr<FAssetMetadata> LoadMetadata(Int32 Index) const;
+
+    /**
+     * 将记录写入数据库文件
+     * Records 中的 RawMetadata 可能指向当前映射的内存，因此通常先写到临时文件，Close 之后再替换
+     * @param DatabasePath 输出文件路径
+     * @param Records 所有记录
+     * @return 成功返回 true
+     */
+    static bool Write(FStringView DatabasePath, const TArray<FAssetRegistryDatabaseRecord>& Records);
+
+    static UInt64 ComputeUuidHash(const FUuid& Uuid);
+    static UInt64 ComputePathHash(FStringView Path);
+
+    /**
+     * 去掉路径最后一段中的扩展名
+     */
+    static FStringView GetPathStem(FStringView Path);
+
+private:
+    template <typename Predicate>
+    Int32 FindInIndex(const UInt32* Index, UInt64 Hash, Predicate&& Pred) const;
+
+    FMappedFile                         File;
+    const FAssetRegistryDatabaseHeader* Header    = nullptr;
+    const FAssetRegistryDatabaseEntry*  Entries   = nullptr;
+    const UInt32*                       UuidIndex = nullptr;
+    const UInt32*                       PathIndex = nullptr;
+    const UInt32*                       StemIndex = nullptr;
+    const UInt8*                        Blob      = nullptr;
+};
@@ -5,6 +5,18 @@
 #include "AssetUtility.h"
 #include "Core/Logging/Logger.h"
 #include "Core/Utility/FileUtility.h"
+#include "IntermediateCache.h"
+
+namespace
+{
+FIntermediatePath MakeIntermediatePath(const FStringView Directory, const FUuid& Guid)
+{
+    FIntermediatePath Path(Directory);
+    Path.AppendWith(FUuid::StringLength, [&Guid](char* Out) { return Guid.ToChars(Out); });
+    Path.Append(".bin");
+    return Path;
+}
+} // namespace
 
 TSharedPtr<FAssetMetadata> FAssetUtility::GetOrCreateAssetMetadata(const FStringView AssetPath)
 {
@@ -23,8 +35,22 @@ bool FAssetUtility::ValidateIntermediateHash(const TSharedPtr<FAssetMetadata>& M
         return false;
     }
 
-    // 如果中间文件不存在，认为校验失败（需要重新生成）
-    if (!FFileUtility::FileExists(IntermediatePath))
+    // Pak 中的条目在打包时已经记录了 Hash，不需要访问文件
+    const FAssetPak* Pak = nullptr;
+    if (const FAssetPakEntry* Entry = FAssetPakManager::GetRef().FindEntry(Metadata->Uuid, Pak))
+    {
+        if (Metadata->IntermediateHash == 0 || Entry->IntermediateHash != Metadata->IntermediateHash)
+        {
+            HK_LOG_INFO(ELogcat::Asset, "Asset pak entry hash mismatch for: {} (expected: {}, got: {})",
+                        Metadata->Path, Metadata->IntermediateHash, Entry->IntermediateHash);
+            return false;
+        }
+        return true;
+    }
+
+    // 如果中间文件不存在，认为校验失败（需要重新生成），这里的 stat 同时作为校验缓存的 Key
+    const FAssetMetaFileStamp Stamp = FAssetMetaFileStamp::FromFile(IntermediatePath);
+    if (!Stamp.IsValid())
     {
         HK_LOG_INFO(ELogcat::Asset, "Intermediate file not found: {}", IntermediatePath);
         return false;
@@ -37,22 +63,33 @@ bool FAssetUtility::ValidateIntermediateHash(const TSharedPtr<FAssetMetadata>& M
         return false;
     }
 
-    // 使用 OpenFileStream 打开文件
-    auto FileStream = FFileUtility::OpenFileStream(IntermediatePath, true);
-    if (!FileStream)
+    // 源文件在上次 Import 之后被修改过，中间文件已过期，只有这个资产会被重新 Import
+    FIntermediateCache& Cache = FIntermediateCache::GetRef();
+    if (Cache.IsSourceModified(Metadata->Path))
     {
-        HK_LOG_WARN(ELogcat::Asset, "Failed to open intermediate file for hash validation: {}", IntermediatePath);
+        HK_LOG_INFO(ELogcat::Asset, "Source file modified since last import: {}", Metadata->Path);
         return false;
     }
 
-    // 读取文件开头的 Hash（假设 Hash 是第一个字段）
+    // 中间文件自上次校验后没有变化时直接使用缓存的 Hash，不打开文件
     UInt64 FileHash = 0;
-    FileStream->read(reinterpret_cast<char*>(&FileHash), sizeof(UInt64));
-
-    if (!FileStream->good() || FileHash == 0)
+    if (!Cache.FindIntermediateHash(IntermediatePath, Stamp, FileHash))
     {
-        HK_LOG_WARN(ELogcat::Asset, "Failed to read hash from intermediate file: {}", IntermediatePath);
-        return false;
+        auto FileStream = FFileUtility::OpenFileStream(IntermediatePath, true);
+        if (!FileStream)
+        {
+            HK_LOG_WARN(ELogcat::Asset, "Failed to open intermediate file for hash validation: {}", IntermediatePath);
+            return false;
+        }
+
+        // 读取文件开头的 Hash（Hash 是第一个字段）
+        FileStream->read(reinterpret_cast<char*>(&FileHash), sizeof(UInt64));
+        if (!FileStream->good() || FileHash == 0)
+        {
+            HK_LOG_WARN(ELogcat::Asset, "Failed to read hash from intermediate file: {}", IntermediatePath);
+            return false;
+        }
+        Cache.RecordIntermediate(IntermediatePath, FileHash, Stamp);
     }
 
     // 比较 Metadata 中的 Hash
@@ -66,17 +103,69 @@ bool FAssetUtility::ValidateIntermediateHash(const TSharedPtr<FAssetMetadata>& M
     return true;
 }
 
-FString FAssetUtility::GetTextureIntermediatePath(const FUuid& Guid)
+bool FAssetUtility::FinishIntermediateWrite(const TSharedPtr<FAssetMetadata>& Metadata, std::ofstream& Stream,
+                                            FStringView IntermediatePath, UInt64 Hash)
+{
+    // 回填文件开头的 Hash 字段
+    Stream.seekp(0, std::ios::beg);
+    Stream.write(reinterpret_cast<const char*>(&Hash), sizeof(UInt64));
+    Stream.close();
+    if (Stream.fail())
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Failed to write intermediate file: {}", IntermediatePath);
+        return false;
+    }
+
+    Metadata->IntermediateHash = Hash;
+
+    // 刚写入的文件不需要在下次加载时重新校验，同时记录源文件状态用于增量 Import
+    FIntermediateCache& Cache = FIntermediateCache::GetRef();
+    Cache.RecordIntermediate(IntermediatePath, Hash);
+    Cache.RecordSource(Metadata->Path);
+    return true;
+}
+
+bool FAssetUtility::ReadIntermediate(const FUuid& Uuid, FStringView IntermediatePath, FAssetPakBuffer& OutBuffer)
 {
-    return FString("Intermediate/Textures/") + Guid.ToString() + ".bin";
+    if (FAssetPakManager::GetRef().Read(Uuid, OutBuffer))
+    {
+        return true;
+    }
+
+    if (!FFileUtility::ReadFileBytes(IntermediatePath, OutBuffer.Storage))
+    {
+        return false;
+    }
+    OutBuffer.Data = TSpan<const UInt8>(OutBuffer.Storage.Data(), OutBuffer.Storage.Size());
+    return true;
 }
 
-FString FAssetUtility::GetMeshIntermediatePath(const FUuid& Guid)
+FIntermediatePath FAssetUtility::GetTextureIntermediatePath(const FUuid& Guid)
 {
-    return FString("Intermediate/Meshes/") + Guid.ToString() + ".bin";
+    return MakeIntermediatePath("Intermediate/Textures/", Guid);
 }
 
-FString FAssetUtility::GetShaderIntermediatePath(const FUuid& Guid)
+FIntermediatePath FAssetUtility::GetMeshIntermediatePath(const FUuid& Guid)
 {
-    return FString("Intermediate/Shaders/") + Guid.ToString() + ".bin";
+    return MakeIntermediatePath("Intermediate/Meshes/", Guid);
+}
+
+FIntermediatePath FAssetUtility::GetShaderIntermediatePath(const FUuid& Guid)
+{
+    return MakeIntermediatePath("Intermediate/Shaders/", Guid);
+}
+
+FIntermediatePath FAssetUtility::GetIntermediatePath(const EAssetType AssetType, const FUuid& Guid)
+{
+    switch (AssetType)
+    {
+        case EAssetType::Shader:
+            return GetShaderIntermediatePath(Guid);
+        case EAssetType::Mesh:
+            return GetMeshIntermediatePath(Guid);
+        case EAssetType::Texture:
+            return GetTextureIntermediatePath(Guid);
+        default:
+            return FIntermediatePath();
+    }
 }
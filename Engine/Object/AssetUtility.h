@@ -1,11 +1,20 @@
 #pragma once
 
+#include "AssetPak.h"
 #include "AssetRegistry.h"
+#include "Core/Logging/Logger.h"
+#include "Core/Serialization/BinaryArchive.h"
+#include "Core/Serialization/MemoryStream.h"
+#include "Core/String/InlineString.h"
 #include "Core/String/StringView.h"
+#include "Core/Utility/FileUtility.h"
 #include "Core/Utility/SharedPtr.h"
 
 class HObject;
 
+// 中间文件路径, 最长的 "Intermediate/Textures/" + UUID + ".bin" 为 62 个字符, 不需要分配内存
+using FIntermediatePath = TInlineString<64>;
+
 /**
  * 资产工具类，提供 AssetImporter 和 AssetLoader 共用的公共方法
  */
@@ -27,26 +36,80 @@ public:
      */
     static bool ValidateIntermediateHash(const TSharedPtr<FAssetMetadata>& Metadata, FStringView IntermediatePath);
 
+    /**
+     * 写入中间文件，序列化一次，写入的同时计算 Hash，完成后回填文件开头的 Hash 字段
+     * IntermediateType 的第一个字段必须是 UInt64 Hash，计算 Hash 时该字段为 0
+     * 成功后更新 Metadata->IntermediateHash 与 Intermediate.Hash（不保存 Metadata）
+     * @param Metadata 资产元数据
+     * @param IntermediatePath 中间文件路径
+     * @param Intermediate 中间数据
+     * @return 成功返回 true
+     */
+    template <typename IntermediateType>
+    static bool WriteIntermediate(const TSharedPtr<FAssetMetadata>& Metadata, FStringView IntermediatePath,
+                                  IntermediateType& Intermediate)
+    {
+        auto Stream = FFileUtility::CreateFileStream(IntermediatePath, true, true);
+        if (!Stream)
+        {
+            HK_LOG_ERROR(ELogcat::Asset, "Failed to create file stream for intermediate file: {}", IntermediatePath);
+            return false;
+        }
+
+        Intermediate.Hash = 0;
+        UInt64 Hash       = 0;
+        {
+            FHashTeeOutputStream HashStream(*Stream);
+            FBinaryOutputArchive Ar(HashStream);
+            Ar(Intermediate);
+            Hash = HashStream.GetHash();
+        }
+
+        if (!FinishIntermediateWrite(Metadata, *Stream, IntermediatePath, Hash))
+        {
+            return false;
+        }
+        Intermediate.Hash = Hash;
+        return true;
+    }
+
+    /**
+     * 读取中间文件，优先从已挂载的 Pak 中读取，不存在时回退到松散文件
+     * @param Uuid 资产 UUID
+     * @param IntermediatePath 松散中间文件路径
+     * @param OutBuffer 输出数据，来自 Pak 且未压缩时直接引用映射内存
+     * @return 成功返回 true
+     */
+    static bool ReadIntermediate(const FUuid& Uuid, FStringView IntermediatePath, FAssetPakBuffer& OutBuffer);
+
     /**
      * 获取中间文件路径（Texture）
      * @param Guid 资产 UUID
      * @return 中间文件路径
      */
-    static FString GetTextureIntermediatePath(const FUuid& Guid);
+    static FIntermediatePath GetTextureIntermediatePath(const FUuid& Guid);
 
     /**
      * 获取中间文件路径（Mesh）
      * @param Guid 资产 UUID
      * @return 中间文件路径
      */
-    static FString GetMeshIntermediatePath(const FUuid& Guid);
+    static FIntermediatePath GetMeshIntermediatePath(const FUuid& Guid);
 
     /**
      * 获取中间文件路径（Shader）
      * @param Guid 资产 UUID
      * @return 中间文件路径
      */
-    static FString GetShaderIntermediatePath(const FUuid& Guid);
+    static FIntermediatePath GetShaderIntermediatePath(const FUuid& Guid);
+
+    /**
+     * 按资产类型获取中间文件路径
+     * @param AssetType 资产类型
+     * @param Guid 资产 UUID
+     * @return 中间文件路径，没有中间文件的资产类型返回空路径
+     */
+    static FIntermediatePath GetIntermediatePath(EAssetType AssetType, const FUuid& Guid);
 
     /**
      * 通过名称查找对象（辅助函数，用于从 ObjectArray 中查找已创建的对象）
@@ -58,5 +121,9 @@ public:
     {
         return FObjectArray::GetRef().FindObjectByName<T>(Name);
     }
+
+private:
+    static bool FinishIntermediateWrite(const TSharedPtr<FAssetMetadata>& Metadata, std::ofstream& Stream,
+                                        FStringView IntermediatePath, UInt64 Hash);
 };
 
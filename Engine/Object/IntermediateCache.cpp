@@ -0,0 +1,243 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "IntermediateCache.h"
+#include "Core/Logging/Logger.h"
+#include "Core/Utility/FileUtility.h"
+
+#include <cstring>
+
+static constexpr const char* IntermediateCachePath = "Intermediate/IntermediateCache.bin";
+
+static constexpr UInt32 IntermediateCacheMagic   = 0x43494B48; // "HKIC"
+static constexpr UInt32 IntermediateCacheVersion = 1;
+
+/**
+ * 缓存文件布局：Magic | Version | IntermediateCount | SourceCount | 记录...
+ * 每条记录：PathLength(UInt32) | Path | WriteTime(Int64) | FileSize(UInt64) | Hash(UInt64，仅中间文件)
+ */
+namespace
+{
+class FCacheReader
+{
+public:
+    explicit FCacheReader(const TArray<UInt8>& InData) : Data(InData) {}
+
+    template <typename T>
+    bool Read(T& OutValue)
+    {
+        if (Cursor + sizeof(T) > Data.Size())
+        {
+            return false;
+        }
+        std::memcpy(&OutValue, Data.Data() + Cursor, sizeof(T));
+        Cursor += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(FString& OutString)
+    {
+        UInt32 Length = 0;
+        if (!Read(Length) || Cursor + Length > Data.Size())
+        {
+            return false;
+        }
+        OutString = FString(reinterpret_cast<const char*>(Data.Data() + Cursor), Length);
+        Cursor += Length;
+        return true;
+    }
+
+private:
+    const TArray<UInt8>& Data;
+    size_t               Cursor = 0;
+};
+
+template <typename T>
+void WriteValue(std::ostream& Stream, const T& Value)
+{
+    Stream.write(reinterpret_cast<const char*>(&Value), sizeof(T));
+}
+
+void WriteString(std::ostream& Stream, const FString& Value)
+{
+    WriteValue(Stream, static_cast<UInt32>(Value.Size()));
+    Stream.write(Value.Data(), static_cast<std::streamsize>(Value.Size()));
+}
+} // namespace
+
+void FIntermediateCache::StartUp()
+{
+    Load();
+}
+
+void FIntermediateCache::ShutDown()
+{
+    Save();
+}
+
+bool FIntermediateCache::FindIntermediateHash(FStringView IntermediatePath, const FAssetMetaFileStamp& Stamp,
+                                              UInt64& OutHash) const
+{
+    AutoLock                   Lock(Mutex);
+    const FIntermediateRecord* Record = Intermediates.Find(IntermediatePath);
+    if (Record == nullptr || !(Record->Stamp == Stamp))
+    {
+        return false;
+    }
+    OutHash = Record->Hash;
+    return true;
+}
+
+void FIntermediateCache::RecordIntermediate(FStringView IntermediatePath, UInt64 Hash,
+                                            const FAssetMetaFileStamp& Stamp)
+{
+    FIntermediateRecord Record;
+    Record.Stamp = Stamp.IsValid() ? Stamp : FAssetMetaFileStamp::FromFile(IntermediatePath);
+    Record.Hash  = Hash;
+    if (!Record.Stamp.IsValid())
+    {
+        return;
+    }
+
+    AutoLock Lock(Mutex);
+    Intermediates[FString(IntermediatePath)] = Record;
+    bDirty                                   = true;
+}
+
+bool FIntermediateCache::IsSourceModified(FStringView SourcePath)
+{
+    const FAssetMetaFileStamp Stamp = FAssetMetaFileStamp::FromFile(SourcePath);
+    if (!Stamp.IsValid())
+    {
+        return false;
+    }
+
+    AutoLock                   Lock(Mutex);
+    const FString              Path(SourcePath);
+    const FAssetMetaFileStamp* Recorded = Sources.Find(Path);
+    if (Recorded == nullptr)
+    {
+        Sources[Path] = Stamp;
+        bDirty        = true;
+        return false;
+    }
+    return !(*Recorded == Stamp);
+}
+
+void FIntermediateCache::RecordSource(FStringView SourcePath)
+{
+    const FAssetMetaFileStamp Stamp = FAssetMetaFileStamp::FromFile(SourcePath);
+    if (!Stamp.IsValid())
+    {
+        return;
+    }
+
+    AutoLock Lock(Mutex);
+    Sources[FString(SourcePath)] = Stamp;
+    bDirty                       = true;
+}
+
+bool FIntermediateCache::Load()
+{
+    HK_PROFILE_SCOPE_N("FIntermediateCache::Load");
+
+    if (!FFileUtility::FileExists(FStringView(IntermediateCachePath)))
+    {
+        return false;
+    }
+
+    TArray<UInt8> Data;
+    if (!FFileUtility::ReadFileBytes(FStringView(IntermediateCachePath), Data))
+    {
+        return false;
+    }
+
+    FCacheReader Reader(Data);
+    UInt32       Magic             = 0;
+    UInt32       Version           = 0;
+    UInt32       IntermediateCount = 0;
+    UInt32       SourceCount       = 0;
+    if (!Reader.Read(Magic) || !Reader.Read(Version) || Magic != IntermediateCacheMagic ||
+        Version != IntermediateCacheVersion || !Reader.Read(IntermediateCount) || !Reader.Read(SourceCount))
+    {
+        HK_LOG_WARN(ELogcat::Asset, "Intermediate cache version mismatch, ignored: {}", IntermediateCachePath);
+        return false;
+    }
+
+    AutoLock Lock(Mutex);
+    for (UInt32 I = 0; I < IntermediateCount; ++I)
+    {
+        FString             Path;
+        FIntermediateRecord Record;
+        if (!Reader.ReadString(Path) || !Reader.Read(Record.Stamp.WriteTime) || !Reader.Read(Record.Stamp.FileSize) ||
+            !Reader.Read(Record.Hash))
+        {
+            HK_LOG_WARN(ELogcat::Asset, "Intermediate cache is corrupted, ignored: {}", IntermediateCachePath);
+            Intermediates.Clear();
+            return false;
+        }
+        Intermediates[Path] = Record;
+    }
+    for (UInt32 I = 0; I < SourceCount; ++I)
+    {
+        FString             Path;
+        FAssetMetaFileStamp Stamp;
+        if (!Reader.ReadString(Path) || !Reader.Read(Stamp.WriteTime) || !Reader.Read(Stamp.FileSize))
+        {
+            HK_LOG_WARN(ELogcat::Asset, "Intermediate cache is corrupted, ignored: {}", IntermediateCachePath);
+            Intermediates.Clear();
+            Sources.Clear();
+            return false;
+        }
+        Sources[Path] = Stamp;
+    }
+
+    HK_LOG_INFO(ELogcat::Asset, "Loaded intermediate cache: {} intermediates, {} sources", IntermediateCount,
+                SourceCount);
+    return true;
+}
+
+bool FIntermediateCache::Save()
+{
+    HK_PROFILE_SCOPE_N("FIntermediateCache::Save");
+
+    AutoLock Lock(Mutex);
+    if (!bDirty)
+    {
+        return true;
+    }
+
+    auto Stream = FFileUtility::CreateFileStream(FStringView(IntermediateCachePath), true, true);
+    if (!Stream)
+    {
+        return false;
+    }
+
+    WriteValue(*Stream, IntermediateCacheMagic);
+    WriteValue(*Stream, IntermediateCacheVersion);
+    WriteValue(*Stream, static_cast<UInt32>(Intermediates.Size()));
+    WriteValue(*Stream, static_cast<UInt32>(Sources.Size()));
+    for (const auto& [Path, Record] : Intermediates)
+    {
+        WriteString(*Stream, Path);
+        WriteValue(*Stream, Record.Stamp.WriteTime);
+        WriteValue(*Stream, Record.Stamp.FileSize);
+        WriteValue(*Stream, Record.Hash);
+    }
+    for (const auto& [Path, Stamp] : Sources)
+    {
+        WriteString(*Stream, Path);
+        WriteValue(*Stream, Stamp.WriteTime);
+        WriteValue(*Stream, Stamp.FileSize);
+    }
+
+    if (!Stream->good())
+    {
+        HK_LOG_ERROR(ELogcat::Asset, "Failed to write intermediate cache: {}", IntermediateCachePath);
+        return false;
+    }
+
+    bDirty = false;
+    return true;
+}
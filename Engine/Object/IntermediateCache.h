@@ -0,0 +1,68 @@
+#pragma once
+#include "AssetRegistryDatabase.h"
+#include "Core/Container/Map.h"
+#include "Core/Singleton/Singleton.h"
+#include "Core/String/String.h"
+#include "Core/String/StringView.h"
+#include "Core/Utility/Profiler.h"
+
+/**
+ * 中间文件校验缓存
+ * 记录中间文件在上次校验通过时的 (大小, 修改时间) 与 Hash，文件未变化时无需再打开文件读取 Hash；
+ * 同时记录源文件在上次 Import 时的 (大小, 修改时间)，用于检测源文件变化并只重新 Import 受影响的资产
+ * 缓存保存在 Intermediate/IntermediateCache.bin，热启动时所有校验只需要 stat
+ */
+class HK_API FIntermediateCache : public TSingleton<FIntermediateCache>
+{
+public:
+    void StartUp() override;
+    void ShutDown() override;
+
+    /**
+     * 查找中间文件已校验过的 Hash
+     * @param IntermediatePath 中间文件路径
+     * @param Stamp 中间文件当前的时间戳
+     * @param OutHash 缓存的 Hash
+     * @return 有记录且时间戳一致时返回 true
+     */
+    bool FindIntermediateHash(FStringView IntermediatePath, const FAssetMetaFileStamp& Stamp, UInt64& OutHash) const;
+
+    /**
+     * 记录中间文件的 Hash，Stamp 无效时会重新读取文件时间戳
+     */
+    void RecordIntermediate(FStringView IntermediatePath, UInt64 Hash,
+                            const FAssetMetaFileStamp& Stamp = FAssetMetaFileStamp());
+
+    /**
+     * 检查源文件在上次 Import 之后是否被修改
+     * 没有记录时以当前状态作为基准，返回 false；源文件不存在（例如只发布了中间文件）时返回 false
+     * @param SourcePath 资产源文件路径
+     * @return 被修改返回 true，此时对应的中间文件应视为过期
+     */
+    bool IsSourceModified(FStringView SourcePath);
+
+    /**
+     * 记录源文件在 Import 时的状态
+     */
+    void RecordSource(FStringView SourcePath);
+
+    /**
+     * 写回缓存文件
+     * @return 成功或无需写入时返回 true
+     */
+    bool Save();
+
+private:
+    struct FIntermediateRecord
+    {
+        FAssetMetaFileStamp Stamp;
+        UInt64              Hash = 0;
+    };
+
+    bool Load();
+
+    mutable HK_PROFILE_LOCKABLE(std::mutex, Mutex);
+    TMap<FString, FIntermediateRecord> Intermediates;
+    TMap<FString, FAssetMetaFileStamp> Sources;
+    bool                               bDirty = false;
+};
@@ -83,10 +83,13 @@ HObject* FObjectArray::CreateObject(FType ObjectType, FName NewName)
         return nullptr;
     }
 
-    // 创建对象实例（使用反射系统）
-    void* RawPtr = ObjectType->CreateInstance();
+    // 在对象池上创建对象实例（使用反射系统）
+    void* Memory =
+        ObjectAllocator.Allocate(static_cast<size_t>(ObjectType->Size), static_cast<size_t>(ObjectType->Alignment));
+    void* RawPtr = ObjectType->ConstructInstanceAt(Memory);
     if (RawPtr == nullptr)
     {
+        ObjectAllocator.Free(Memory);
         ReleaseID(NewID);
         return nullptr;
     }
@@ -141,8 +144,8 @@ void FObjectArray::DestroyObject(HObject* Object)
         NumObjects--;
     }
 
-    // 销毁对象（使用模板Delete进行内存跟踪）
-    Delete(Object);
+    // 销毁对象并把内存归还对象池
+    ObjectAllocator.Delete(Object);
 }
 
 HObject* FObjectArray::FindObjectByName(FName Name) const
@@ -159,4 +162,13 @@ HObject* FObjectArray::FindObjectByName(FName Name) const
     }
 
     return nullptr;
-}
\ No newline at end of file
+}
+HObject* FObjectArray::FindObjectByID(FObjectID ID) const
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+    if (ID == 0 || static_cast<size_t>(ID) >= static_cast<size_t>(AllObjects.Size()))
+    {
+        return nullptr;
+    }
+    return AllObjects[ID];
+}
@@ -1,4 +1,6 @@
 #pragma once
+#include "Core/Memory/PoolAllocator.h"
+#include "Core/Memory/ThreadCacheAllocator.h"
 #include "Core/Reflection/Reflection.h"
 #include "Core/Utility/Profiler.h"
 #include <mutex>
@@ -82,8 +84,8 @@ public:
             return nullptr;
         }
 
-        // 直接使用模板New创建对象（不使用反射，性能更好）
-        T* Object = New<T>();
+        // 直接在对象池上构造（不使用反射，性能更好）
+        T* Object = ObjectAllocator.New<T>();
         if (Object == nullptr)
         {
             ReleaseID(NewID);
@@ -113,6 +115,13 @@ public:
      */
     HObject* FindObjectByName(FName Name) const;
 
+    /**
+     * 通过 ID 查找对象
+     * @param ID 对象 ID
+     * @return 找到的对象指针，如果 ID 无效或对象已被销毁则返回 nullptr
+     */
+    HObject* FindObjectByID(FObjectID ID) const;
+
     template <typename T>
     T* FindObjectByName(FName Name) const
     {
@@ -128,8 +137,11 @@ private:
     FObjectID AllocateID();
     void      ReleaseID(FObjectID ID);
 
-    mutable std::mutex Mutex;
-    TArray<HObject*>   AllObjects;
+    mutable std::mutex                                                     Mutex;
+    TArray<HObject*, TThreadCacheAllocatorPolicy<EMemoryTag::ObjectArray>> AllObjects; // 对象表本身的内存单独统计
+
+    // 所有对象的内存都来自这里，按大小档位分池，频繁创建销毁不会产生堆碎片
+    FObjectPoolAllocator ObjectAllocator{EMemoryTag::Object};
 
     Int32 NumObjects = 0;
 };
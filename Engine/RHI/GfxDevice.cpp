@@ -6,6 +6,7 @@
 
 #include "Config/ConfigManager.h"
 #include "Core/Utility/Profiler.h"
+#include "Null/GfxDeviceNull.h"
 #include "RHIConfig.h"
 #include "Vulkan/GfxDeviceVk.h"
 
@@ -20,6 +21,9 @@ void CreateGfxDevice()
         case EGfxBackend::Vulkan:
             GGfxDevice = New<FGfxDeviceVk>();
             break;
+        case EGfxBackend::Null:
+            GGfxDevice = New<FGfxDeviceNull>();
+            break;
         default:
             HK_LOG_FATAL(ELogcat::RHI, "Unsupported GfxBackend");
             throw std::runtime_error("Unsupported Gfx Backend");
@@ -51,4 +55,28 @@ FGfxDevice* GetGfxDevice()
 FGfxDevice& GetGfxDeviceRef()
 {
     return *GetGfxDevice();
-}
\ No newline at end of file
+}
+
+void FGfxDevice::TrackBufferMemory(FRHIBuffer& Buffer)
+{
+    const bool bStaging = HasFlag(Buffer.MemoryProperty, ERHIBufferMemoryProperty::HostVisible) &&
+                          HasFlag(Buffer.Usage, ERHIBufferUsage::TransferSrc);
+    Buffer.MemoryTag = bStaging ? EMemoryTag::StagingBuffer : FMemoryStats::GetScopeTag(EMemoryTag::Render);
+    FMemoryStats::RecordGpuAlloc(Buffer.MemoryTag, static_cast<Int64>(Buffer.Size));
+}
+
+void FGfxDevice::UntrackBufferMemory(const FRHIBuffer& Buffer)
+{
+    FMemoryStats::RecordGpuFree(Buffer.MemoryTag, static_cast<Int64>(Buffer.Size));
+}
+
+void FGfxDevice::TrackImageMemory(FRHIImage& Image)
+{
+    Image.MemoryTag = FMemoryStats::GetScopeTag(EMemoryTag::Render);
+    FMemoryStats::RecordGpuAlloc(Image.MemoryTag, static_cast<Int64>(Image.GetMemorySize()));
+}
+
+void FGfxDevice::UntrackImageMemory(const FRHIImage& Image)
+{
+    FMemoryStats::RecordGpuFree(Image.MemoryTag, static_cast<Int64>(Image.GetMemorySize()));
+}
@@ -42,6 +42,8 @@ class FRHICommandPool;
 struct FRHICommandBufferDesc;
 class FRHICommandBuffer;
 struct FRHICommand;
+struct FRHIQueryPoolDesc;
+class FRHIQueryPool;
 
 HENUM()
 enum class EGfxBackend
@@ -51,6 +53,7 @@ enum class EGfxBackend
     Metal,
     GL,
     GLES,
+    Null, // 不访问GPU的空后端, 用于无头测试与CPU基准
     Count,
 };
 
@@ -156,6 +159,9 @@ public:
     // @param WriteDescriptorSets 描述符写入信息数组
     virtual void UpdateDescriptorSet(const FRHIDescriptorSet& DescriptorSet,
                                      const TArray<FRHIWriteDescriptorSet>& WriteDescriptorSets) = 0;
+
+    // 获取 bindless 描述符数组的设备上限, 用于决定纹理表与采样器表的大小
+    virtual FRHIBindlessLimits GetBindlessLimits() const = 0;
 #pragma endregion
 
 #pragma region Pipeline操作
@@ -238,6 +244,29 @@ public:
     virtual bool ResetFence(const FRHIFence& Fence) = 0;
 #pragma endregion
 
+#pragma region Query操作
+    // 创建查询池
+    // @param QueryPoolCreateInfo 查询池创建信息
+    // @return 创建的查询池
+    virtual FRHIQueryPool CreateQueryPool(const FRHIQueryPoolDesc& QueryPoolCreateInfo) = 0;
+
+    // 销毁查询池资源
+    virtual void DestroyQueryPool(FRHIQueryPool& QueryPool) = 0;
+
+    // 读回查询结果, 不等待 GPU
+    // 时间戳结果为 GPU 时钟周期, 乘以 GetTimestampPeriod() 得到纳秒
+    // @param QueryPool 查询池
+    // @param FirstQuery 第一个查询索引
+    // @param QueryCount 查询数量
+    // @param OutResults 输出结果, 大小为 QueryCount * QueryPool.GetResultCountPerQuery()
+    // @return 所有查询的结果都可用时返回 true, 否则返回 false 且 OutResults 内容无效
+    virtual bool GetQueryPoolResults(const FRHIQueryPool& QueryPool, UInt32 FirstQuery, UInt32 QueryCount,
+                                     TArray<UInt64>& OutResults) = 0;
+
+    // 时间戳每个时钟周期对应的纳秒数
+    virtual double GetTimestampPeriod() const = 0;
+#pragma endregion
+
 #pragma region CommandPool操作
     // 创建命令池
     // 命令池用于分配命令缓冲区
@@ -363,6 +392,16 @@ public:
      */
     virtual FRHIImageView GetSwapChainImageView(FRHIWindow& Window, UInt32 ImageIndex) = 0;
 #pragma endregion
+
+protected:
+    /**
+     * 显存统计, 后端在创建成功后与销毁前调用
+     * 主机可见的传输源 Buffer 记入 StagingBuffer, 其余按当前 FMemoryScope 记录, 不在作用域中时记入 Render
+     */
+    static void TrackBufferMemory(FRHIBuffer& Buffer);
+    static void UntrackBufferMemory(const FRHIBuffer& Buffer);
+    static void TrackImageMemory(FRHIImage& Image);
+    static void UntrackImageMemory(const FRHIImage& Image);
 };
 
 inline TEvent<>            GOnPreRHIDeviceCreated;
@@ -0,0 +1,981 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "GfxDeviceNull.h"
+
+#include "Config/ConfigManager.h"
+#include "Core/Logging/Logger.h"
+#include "RHI/RHIConfig.h"
+#include "RHI/RHIHandle.h"
+
+#include <SDL3/SDL_init.h>
+#include <SDL3/SDL_video.h>
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+// 没有实际数据的资源共用的句柄指针, 只用于让 FRHIHandle::IsValid 成立
+UInt8 GNullResourceTag = 0;
+
+void* NullResourcePtr()
+{
+    return &GNullResourceTag;
+}
+
+// 由主机内存支持的缓冲区, 只有 HostVisible 缓冲区才分配内存
+struct FNullBuffer
+{
+    TArray<UInt8> Memory;
+};
+
+// 栅栏状态: -1 未信号化且未提交, 0 已信号化, >0 提交后在该时间点（steady_clock 纳秒）完成
+struct FNullFence
+{
+    std::atomic<Int64> CompletionTimeNs{-1};
+};
+
+// 查询结果由主机内存保存
+struct FNullQueryPool
+{
+    TArray<UInt64> Results;
+};
+
+constexpr Int64 FenceUnsignaled = -1;
+constexpr Int64 FenceSignaled   = 0;
+} // namespace
+
+Int64 FGfxDeviceNull::NowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void FGfxDeviceNull::Init()
+{
+    const auto* Config = FConfigManager::GetRef().GetConfig<FRHIConfig>();
+    bOffscreen         = Config->IsNullDeviceOffscreen();
+    SetSubmitLatency(Config->GetNullDeviceLatencyMicroseconds());
+
+    try
+    {
+        if (!bOffscreen && !SDL_WasInit(SDL_INIT_VIDEO))
+        {
+            if (const auto Success = SDL_Init(SDL_INIT_VIDEO); !Success)
+            {
+                const FString ErrorMsg = std::format("SDL初始化失败! ErrMsg={}.", SDL_GetError());
+                HK_LOG_FATAL(ELogcat::RHI, "SDL初始化失败: {}", SDL_GetError());
+                throw std::runtime_error(ErrorMsg.CStr());
+            }
+        }
+
+        auto& WindowManager = FRHIWindowManager::GetRef();
+        if (!WindowManager.Windows[0])
+        {
+            WindowManager.Windows[0] = MakeUnique<FRHIWindow>();
+        }
+        FRHIWindow& MainWindow = *WindowManager.Windows[0];
+        CreateMainWindowSurface(FName("HKEngine"), Config->GetDefaultWindowSize(), MainWindow);
+        CreateMainWindowSwapChain(MainWindow);
+
+        HK_LOG_INFO(ELogcat::RHI, "Null设备初始化完成 (Offscreen: {}, 提交延迟: {} 微秒)", bOffscreen,
+                    Config->GetNullDeviceLatencyMicroseconds());
+    }
+    catch (const std::exception& e)
+    {
+        HK_LOG_FATAL(ELogcat::RHI, "Null设备初始化失败: {}", e.what());
+        UnInit();
+        throw;
+    }
+}
+
+void FGfxDeviceNull::UnInit()
+{
+    WaitIdle();
+
+    auto& WindowManager = FRHIWindowManager::GetRef();
+    if (WindowManager.Windows[0])
+    {
+        DestroyMainWindow(*WindowManager.Windows[0]);
+    }
+
+    const FGfxDeviceNullStats Stats = GetStats();
+    HK_LOG_INFO(ELogcat::RHI, "Null设备已销毁: 提交 {} 次, 命令 {} 条, 绘制 {} 次, 调度 {} 次, 呈现 {} 次",
+                Stats.SubmitCount, Stats.CommandCount, Stats.DrawCount, Stats.DispatchCount, Stats.PresentCount);
+    if (Stats.BufferMemoryBytes != 0)
+    {
+        HK_LOG_WARN(ELogcat::RHI, "Null设备销毁时仍有 {} 字节缓冲区内存未释放", Stats.BufferMemoryBytes);
+    }
+}
+
+void FGfxDeviceNull::WaitIdle()
+{
+    Int64 LastCompletion;
+    {
+        std::lock_guard Lock(QueueMutex);
+        LastCompletion = LastCompletionNs;
+    }
+    if (const Int64 Remaining = LastCompletion - NowNs(); Remaining > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(Remaining));
+    }
+}
+
+FGfxDeviceNullStats FGfxDeviceNull::GetStats() const
+{
+    FGfxDeviceNullStats Stats;
+    Stats.SubmitCount       = SubmitCount.load(std::memory_order_relaxed);
+    Stats.CommandCount      = CommandCount.load(std::memory_order_relaxed);
+    Stats.DrawCount         = DrawCount.load(std::memory_order_relaxed);
+    Stats.DispatchCount     = DispatchCount.load(std::memory_order_relaxed);
+    Stats.PresentCount      = PresentCount.load(std::memory_order_relaxed);
+    Stats.BufferMemoryBytes = BufferMemoryBytes.load(std::memory_order_relaxed);
+    return Stats;
+}
+
+void FGfxDeviceNull::ResetStats()
+{
+    // 缓冲区内存反映的是当前状态, 不随统计重置
+    SubmitCount.store(0, std::memory_order_relaxed);
+    CommandCount.store(0, std::memory_order_relaxed);
+    DrawCount.store(0, std::memory_order_relaxed);
+    DispatchCount.store(0, std::memory_order_relaxed);
+    PresentCount.store(0, std::memory_order_relaxed);
+}
+
+// ============================================================================
+// Buffer
+// ============================================================================
+
+FRHIBuffer FGfxDeviceNull::CreateBuffer(const FRHIBufferDesc& BufferCreateInfo)
+{
+    if (BufferCreateInfo.Size == 0)
+    {
+        HK_LOG_FATAL(ELogcat::RHI, "缓冲区大小不能为0");
+        throw std::runtime_error("缓冲区大小不能为0");
+    }
+
+    auto* BufferData = new FNullBuffer();
+    if (HasFlag(BufferCreateInfo.MemoryProperty, ERHIBufferMemoryProperty::HostVisible))
+    {
+        BufferData->Memory.Resize(BufferCreateInfo.Size);
+        BufferMemoryBytes.fetch_add(BufferCreateInfo.Size, std::memory_order_relaxed);
+    }
+
+    FRHIBuffer Buffer;
+    Buffer.Handle         = FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::Buffer,
+                                                                        BufferCreateInfo.DebugName, BufferData);
+    Buffer.Size           = BufferCreateInfo.Size;
+    Buffer.Usage          = BufferCreateInfo.Usage;
+    Buffer.MemoryProperty = BufferCreateInfo.MemoryProperty;
+    TrackBufferMemory(Buffer);
+    return Buffer;
+}
+
+void FGfxDeviceNull::DestroyBuffer(FRHIBuffer& Buffer)
+{
+    if (!Buffer.IsValid())
+    {
+        HK_LOG_WARN(ELogcat::RHI, "尝试销毁无效的Buffer");
+        return;
+    }
+
+    if (const FNullBuffer* BufferData = Buffer.GetHandle().Cast<FNullBuffer*>())
+    {
+        BufferMemoryBytes.fetch_sub(BufferData->Memory.Size(), std::memory_order_relaxed);
+        delete BufferData;
+    }
+    FRHIHandleManager::GetRef().DestroyRHIHandle(Buffer.GetHandle());
+    UntrackBufferMemory(Buffer);
+    Buffer = FRHIBuffer();
+}
+
+void* FGfxDeviceNull::MapBuffer(FRHIBuffer& Buffer, UInt64 Offset, UInt64 Size)
+{
+    if (!Buffer.IsValid())
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "尝试映射无效的Buffer");
+        return nullptr;
+    }
+
+    if (Buffer.IsMapped())
+    {
+        return Buffer.GetMappedPtr();
+    }
+
+    if (!HasFlag(Buffer.GetMemoryProperty(), ERHIBufferMemoryProperty::HostVisible))
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "Buffer必须具有HostVisible内存属性才能映射");
+        return nullptr;
+    }
+
+    const UInt64 MapSize = Size == 0 ? Buffer.GetSize() - Offset : Size;
+    if (Offset + MapSize > Buffer.GetSize())
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "映射范围超出Buffer大小");
+        return nullptr;
+    }
+
+    auto* BufferData = Buffer.GetHandle().Cast<FNullBuffer*>();
+    Buffer.MappedPtr = BufferData->Memory.Data() + Offset;
+    return Buffer.MappedPtr;
+}
+
+void FGfxDeviceNull::UnmapBuffer(FRHIBuffer& Buffer)
+{
+    Buffer.MappedPtr = nullptr;
+}
+
+// ============================================================================
+// Image
+// ============================================================================
+
+FRHIImage FGfxDeviceNull::CreateImage(const FRHIImageDesc& ImageCreateInfo)
+{
+    FRHIImage Image;
+    Image.Handle      = FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::Image, ImageCreateInfo.DebugName,
+                                                                    NullResourcePtr());
+    Image.Type        = ImageCreateInfo.Type;
+    Image.Format      = ImageCreateInfo.Format;
+    Image.Extent      = ImageCreateInfo.Extent;
+    Image.MipLevels   = ImageCreateInfo.MipLevels;
+    Image.ArrayLayers = ImageCreateInfo.ArrayLayers;
+    Image.Samples     = ImageCreateInfo.Samples;
+    Image.Usage       = ImageCreateInfo.Usage;
+    TrackImageMemory(Image);
+    return Image;
+}
+
+void FGfxDeviceNull::DestroyImage(FRHIImage& Image)
+{
+    if (!Image.IsValid())
+    {
+        return;
+    }
+    FRHIHandleManager::GetRef().DestroyRHIHandle(Image.Handle);
+    UntrackImageMemory(Image);
+    Image = FRHIImage();
+}
+
+FRHIImageView FGfxDeviceNull::CreateImageView(const FRHIImage& Image, const FRHIImageViewDesc& ViewCreateInfo)
+{
+    FRHIImageView ImageView;
+    if (!Image.IsValid())
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "无效的Image, 无法创建ImageView");
+        return ImageView;
+    }
+
+    ImageView.Handle   = FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::ImageView,
+                                                                     ViewCreateInfo.DebugName, NullResourcePtr());
+    ImageView.Image    = &Image;
+    ImageView.ViewType = ViewCreateInfo.ViewType;
+    ImageView.Format   = ViewCreateInfo.Format;
+    ImageView.Aspects  = ViewCreateInfo.Aspects;
+    return ImageView;
+}
+
+void FGfxDeviceNull::DestroyImageView(FRHIImageView& ImageView)
+{
+    if (!ImageView.IsValid())
+    {
+        return;
+    }
+    FRHIHandleManager::GetRef().DestroyRHIHandle(ImageView.Handle);
+    ImageView = FRHIImageView();
+}
+
+FRHISampler FGfxDeviceNull::CreateSampler(const FRHISamplerDesc& SamplerCreateInfo)
+{
+    FRHISampler Sampler;
+    Sampler.Handle       = FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::Sampler,
+                                                                       SamplerCreateInfo.DebugName, NullResourcePtr());
+    Sampler.MagFilter    = SamplerCreateInfo.MagFilter;
+    Sampler.MinFilter    = SamplerCreateInfo.MinFilter;
+    Sampler.MipmapMode   = SamplerCreateInfo.MipmapMode;
+    Sampler.AddressModeU = SamplerCreateInfo.AddressModeU;
+    Sampler.AddressModeV = SamplerCreateInfo.AddressModeV;
+    Sampler.AddressModeW = SamplerCreateInfo.AddressModeW;
+    return Sampler;
+}
+
+void FGfxDeviceNull::DestroySampler(FRHISampler& Sampler)
+{
+    if (!Sampler.IsValid())
+    {
+        return;
+    }
+    FRHIHandleManager::GetRef().DestroyRHIHandle(Sampler.Handle);
+    Sampler = FRHISampler();
+}
+
+// ============================================================================
+// Descriptor
+// ============================================================================
+
+FRHIDescriptorSetLayout
+FGfxDeviceNull::CreateDescriptorSetLayout(const FRHIDescriptorSetLayoutDesc& LayoutCreateInfo)
+{
+    FRHIDescriptorSetLayout DescriptorSetLayout;
+    DescriptorSetLayout.Handle = FRHIHandleManager::GetRef().CreateRHIHandle(
+        ERHIResourceType::DescriptorSetLayout, LayoutCreateInfo.DebugName, NullResourcePtr());
+    return DescriptorSetLayout;
+}
+
+void FGfxDeviceNull::DestroyDescriptorSetLayout(FRHIDescriptorSetLayout& DescriptorSetLayout)
+{
+    if (!DescriptorSetLayout.IsValid())
+    {
+        return;
+    }
+    FRHIHandleManager::GetRef().DestroyRHIHandle(DescriptorSetLayout.Handle);
+    DescriptorSetLayout.Handle = FRHIHandle();
+}
+
+FRHIDescriptorPool FGfxDeviceNull::CreateDescriptorPool(const FRHIDescriptorPoolDesc& PoolCreateInfo)
+{
+    FRHIDescriptorPool DescriptorPool;
+    DescriptorPool.Handle  = FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::DescriptorPool,
+                                                                         PoolCreateInfo.DebugName, NullResourcePtr());
+    DescriptorPool.MaxSets = PoolCreateInfo.MaxSets;
+    DescriptorPool.Flags   = PoolCreateInfo.Flags;
+    return DescriptorPool;
+}
+
+void FGfxDeviceNull::DestroyDescriptorPool(FRHIDescriptorPool& DescriptorPool)
+{
+    if (!DescriptorPool.IsValid())
+    {
+        return;
+    }
+    FRHIHandleManager::GetRef().DestroyRHIHandle(DescriptorPool.Handle);
+    DescriptorPool.Handle = FRHIHandle();
+}
+
+FRHIDescriptorSet FGfxDeviceNull::AllocateDescriptorSet(const FRHIDescriptorPool&    Pool,
+                                                        const FRHIDescriptorSetDesc& SetCreateInfo)
+{
+    FRHIDescriptorSet DescriptorSet;
+    if (!Pool.IsValid())
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "无效的DescriptorPool, 无法分配DescriptorSet");
+        return DescriptorSet;
+    }
+
+    DescriptorSet.Handle = FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::DescriptorSet,
+                                                                       SetCreateInfo.DebugName, NullResourcePtr());
+    DescriptorSet.Pool   = &Pool;
+    return DescriptorSet;
+}
+
+void FGfxDeviceNull::FreeDescriptorSet(const FRHIDescriptorPool& Pool, FRHIDescriptorSet& DescriptorSet)
+{
+    if (!DescriptorSet.IsValid())
+    {
+        return;
+    }
+    FRHIHandleManager::GetRef().DestroyRHIHandle(DescriptorSet.Handle);
+    DescriptorSet.Handle = FRHIHandle();
+    DescriptorSet.Pool   = nullptr;
+}
+
+void FGfxDeviceNull::UpdateDescriptorSet(const FRHIDescriptorSet&              DescriptorSet,
+                                         const TArray<FRHIWriteDescriptorSet>& WriteDescriptorSets)
+{
+}
+
+FRHIBindlessLimits FGfxDeviceNull::GetBindlessLimits() const
+{
+    // 与常见桌面GPU的UpdateAfterBind上限同一量级, 实际大小由上层再做限制
+    FRHIBindlessLimits Limits;
+    Limits.MaxSampledImages = 1u << 20;
+    Limits.MaxSamplers      = 1u << 20;
+    return Limits;
+}
+
+// ============================================================================
+// Pipeline
+// ============================================================================
+
+FRHIShaderModule FGfxDeviceNull::CreateShaderModule(const FRHIShaderModuleDesc& ModuleCreateInfo,
+                                                    const ERHIShaderStage       Stage)
+{
+    FRHIShaderModule ShaderModule;
+    ShaderModule.Handle = FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::ShaderModule,
+                                                                      ModuleCreateInfo.DebugName, NullResourcePtr());
+    ShaderModule.Stage  = Stage;
+    return ShaderModule;
+}
+
+void FGfxDeviceNull::DestroyShaderModule(FRHIShaderModule& ShaderModule)
+{
+    if (!ShaderModule.IsValid())
+    {
+        return;
+    }
+    FRHIHandleManager::GetRef().DestroyRHIHandle(ShaderModule.Handle);
+    ShaderModule.Handle = FRHIHandle();
+}
+
+FRHIPipelineLayout FGfxDeviceNull::CreatePipelineLayout(const FRHIPipelineLayoutDesc& LayoutCreateInfo)
+{
+    FRHIPipelineLayout PipelineLayout;
+    PipelineLayout.Handle = FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::PipelineLayout,
+                                                                        LayoutCreateInfo.DebugName, NullResourcePtr());
+    return PipelineLayout;
+}
+
+void FGfxDeviceNull::DestroyPipelineLayout(FRHIPipelineLayout& PipelineLayout)
+{
+    if (!PipelineLayout.IsValid())
+    {
+        return;
+    }
+    FRHIHandleManager::GetRef().DestroyRHIHandle(PipelineLayout.Handle);
+    PipelineLayout.Handle = FRHIHandle();
+}
+
+FRHIPipeline FGfxDeviceNull::CreateGraphicsPipeline(const FRHIGraphicsPipelineDesc& PipelineCreateInfo)
+{
+    FRHIPipeline Pipeline;
+    Pipeline.Handle = FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::Pipeline,
+                                                                  PipelineCreateInfo.DebugName, NullResourcePtr());
+    Pipeline.Type   = ERHIPipelineType::Graphics;
+    Pipeline.Layout = PipelineCreateInfo.Layout;
+    return Pipeline;
+}
+
+FRHIPipeline FGfxDeviceNull::CreateComputePipeline(const FRHIComputePipelineDesc& PipelineCreateInfo)
+{
+    FRHIPipeline Pipeline;
+    Pipeline.Handle = FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::Pipeline,
+                                                                  PipelineCreateInfo.DebugName, NullResourcePtr());
+    Pipeline.Type   = ERHIPipelineType::Compute;
+    Pipeline.Layout = PipelineCreateInfo.Layout;
+    return Pipeline;
+}
+
+FRHIPipeline FGfxDeviceNull::CreateRayTracingPipeline(const FRHIRayTracingPipelineDesc& PipelineCreateInfo)
+{
+    FRHIPipeline Pipeline;
+    Pipeline.Handle = FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::Pipeline,
+                                                                  PipelineCreateInfo.DebugName, NullResourcePtr());
+    Pipeline.Type   = ERHIPipelineType::RayTracing;
+    Pipeline.Layout = PipelineCreateInfo.Layout;
+    return Pipeline;
+}
+
+void FGfxDeviceNull::DestroyPipeline(FRHIPipeline& Pipeline)
+{
+    if (!Pipeline.IsValid())
+    {
+        return;
+    }
+    FRHIHandleManager::GetRef().DestroyRHIHandle(Pipeline.Handle);
+    Pipeline = FRHIPipeline();
+}
+
+// ============================================================================
+// Sync
+// ============================================================================
+
+FRHISemaphore FGfxDeviceNull::CreateSemaphore(const FRHISemaphoreDesc& SemaphoreCreateInfo)
+{
+    FRHISemaphore Semaphore;
+    Semaphore.Handle = FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::Semaphore,
+                                                                   SemaphoreCreateInfo.DebugName, NullResourcePtr());
+    Semaphore.Type   = SemaphoreCreateInfo.Type;
+    return Semaphore;
+}
+
+void FGfxDeviceNull::DestroySemaphore(FRHISemaphore& Semaphore)
+{
+    if (!Semaphore.IsValid())
+    {
+        return;
+    }
+    FRHIHandleManager::GetRef().DestroyRHIHandle(Semaphore.Handle);
+    Semaphore = FRHISemaphore();
+}
+
+FRHIFence FGfxDeviceNull::CreateFence(const FRHIFenceDesc& FenceCreateInfo)
+{
+    auto* FenceData = new FNullFence();
+    if (HasFlag(FenceCreateInfo.Flags, ERHIFenceCreateFlag::Signaled))
+    {
+        FenceData->CompletionTimeNs.store(FenceSignaled, std::memory_order_relaxed);
+    }
+
+    FRHIFence Fence;
+    Fence.Handle =
+        FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::Fence, FenceCreateInfo.DebugName, FenceData);
+    return Fence;
+}
+
+void FGfxDeviceNull::DestroyFence(FRHIFence& Fence)
+{
+    if (!Fence.IsValid())
+    {
+        return;
+    }
+    delete Fence.Handle.Cast<FNullFence*>();
+    FRHIHandleManager::GetRef().DestroyRHIHandle(Fence.Handle);
+    Fence = FRHIFence();
+}
+
+bool FGfxDeviceNull::WaitForFence(const FRHIFence& Fence, const UInt64 Timeout)
+{
+    if (!Fence.IsValid())
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "尝试等待无效的Fence");
+        return false;
+    }
+
+    const Int64 CompletionTime = Fence.Handle.Cast<FNullFence*>()->CompletionTimeNs.load(std::memory_order_acquire);
+    if (CompletionTime == FenceUnsignaled)
+    {
+        // 没有任何提交会信号化它, 真实设备上会一直等到超时
+        HK_LOG_WARN(ELogcat::RHI, "等待的Fence未被提交, 永远不会被信号化");
+        return false;
+    }
+
+    const Int64 Remaining = CompletionTime - NowNs();
+    if (CompletionTime == FenceSignaled || Remaining <= 0)
+    {
+        return true;
+    }
+    if (static_cast<UInt64>(Remaining) > Timeout)
+    {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(Timeout));
+        return false;
+    }
+    std::this_thread::sleep_for(std::chrono::nanoseconds(Remaining));
+    return true;
+}
+
+bool FGfxDeviceNull::IsFenceSignaled(const FRHIFence& Fence) const
+{
+    if (!Fence.IsValid())
+    {
+        return false;
+    }
+    const Int64 CompletionTime = Fence.Handle.Cast<FNullFence*>()->CompletionTimeNs.load(std::memory_order_acquire);
+    return CompletionTime == FenceSignaled || (CompletionTime > 0 && CompletionTime <= NowNs());
+}
+
+bool FGfxDeviceNull::ResetFence(const FRHIFence& Fence)
+{
+    if (!Fence.IsValid())
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "尝试重置无效的Fence");
+        return false;
+    }
+    Fence.Handle.Cast<FNullFence*>()->CompletionTimeNs.store(FenceUnsignaled, std::memory_order_release);
+    return true;
+}
+
+// ============================================================================
+// Query
+// ============================================================================
+
+FRHIQueryPool FGfxDeviceNull::CreateQueryPool(const FRHIQueryPoolDesc& QueryPoolCreateInfo)
+{
+    FRHIQueryPool QueryPool;
+    if (QueryPoolCreateInfo.QueryCount == 0)
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "QueryPool的查询数量不能为0");
+        return QueryPool;
+    }
+
+    QueryPool.Type               = QueryPoolCreateInfo.Type;
+    QueryPool.QueryCount         = QueryPoolCreateInfo.QueryCount;
+    QueryPool.PipelineStatistics = QueryPoolCreateInfo.PipelineStatistics;
+
+    auto* QueryPoolData = new FNullQueryPool();
+    QueryPoolData->Results.Resize(static_cast<size_t>(QueryPool.QueryCount) * QueryPool.GetResultCountPerQuery());
+    QueryPool.Handle = FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::QueryPool,
+                                                                   QueryPoolCreateInfo.DebugName, QueryPoolData);
+    return QueryPool;
+}
+
+void FGfxDeviceNull::DestroyQueryPool(FRHIQueryPool& QueryPool)
+{
+    if (!QueryPool.IsValid())
+    {
+        return;
+    }
+    delete QueryPool.Handle.Cast<FNullQueryPool*>();
+    FRHIHandleManager::GetRef().DestroyRHIHandle(QueryPool.Handle);
+    QueryPool = FRHIQueryPool();
+}
+
+bool FGfxDeviceNull::GetQueryPoolResults(const FRHIQueryPool& QueryPool, const UInt32 FirstQuery,
+                                         const UInt32 QueryCount, TArray<UInt64>& OutResults)
+{
+    if (!QueryPool.IsValid() || FirstQuery + QueryCount > QueryPool.GetQueryCount())
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "无效的QueryPool或查询范围越界");
+        return false;
+    }
+
+    const size_t          ResultCountPerQuery = QueryPool.GetResultCountPerQuery();
+    const FNullQueryPool* QueryPoolData       = QueryPool.Handle.Cast<FNullQueryPool*>();
+    const UInt64*         First               = QueryPoolData->Results.Data() + FirstQuery * ResultCountPerQuery;
+    OutResults.Clear();
+    OutResults.Append(First, First + QueryCount * ResultCountPerQuery);
+    return true;
+}
+
+double FGfxDeviceNull::GetTimestampPeriod() const
+{
+    return 1.0;
+}
+
+// ============================================================================
+// CommandPool / CommandBuffer
+// ============================================================================
+
+FRHICommandPool FGfxDeviceNull::CreateCommandPool(const FRHICommandPoolDesc& PoolCreateInfo)
+{
+    FRHICommandPool Pool;
+    Pool.Handle           = FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::CommandPool,
+                                                                        PoolCreateInfo.DebugName, NullResourcePtr());
+    Pool.QueueFamilyIndex = PoolCreateInfo.QueueFamilyIndex;
+    return Pool;
+}
+
+void FGfxDeviceNull::DestroyCommandPool(FRHICommandPool& CommandPool)
+{
+    if (!CommandPool.IsValid())
+    {
+        return;
+    }
+    FRHIHandleManager::GetRef().DestroyRHIHandle(CommandPool.Handle);
+    CommandPool.Handle           = FRHIHandle();
+    CommandPool.QueueFamilyIndex = 0;
+}
+
+FRHICommandBuffer FGfxDeviceNull::CreateCommandBuffer(const FRHICommandPool&       Pool,
+                                                      const FRHICommandBufferDesc& CommandBufferCreateInfo)
+{
+    FRHICommandBuffer CmdBuffer;
+    if (!Pool.IsValid())
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "Invalid command pool provided for command buffer creation");
+        return CmdBuffer;
+    }
+
+    CmdBuffer.Handle = FRHIHandleManager::GetRef().CreateRHIHandle(
+        ERHIResourceType::CommandBuffer, CommandBufferCreateInfo.DebugName, NullResourcePtr());
+    CmdBuffer.Level = CommandBufferCreateInfo.Level;
+    return CmdBuffer;
+}
+
+void FGfxDeviceNull::DestroyCommandBuffer(const FRHICommandPool& Pool, FRHICommandBuffer& CommandBuffer)
+{
+    if (!CommandBuffer.IsValid() || !Pool.IsValid())
+    {
+        return;
+    }
+    FRHIHandleManager::GetRef().DestroyRHIHandle(CommandBuffer.Handle);
+    CommandBuffer.Handle = FRHIHandle();
+}
+
+void FGfxDeviceNull::ExecuteCommand(FRHICommandBuffer& CommandBuffer, const FRHICommand& Command)
+{
+    if (!CommandBuffer.IsValid())
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "Invalid command buffer");
+        return;
+    }
+
+    CommandCount.fetch_add(1, std::memory_order_relaxed);
+    switch (Command.CommandType)
+    {
+        case ERHICommandType::Begin:
+            CommandBuffer.bIsRecording = true;
+            break;
+        case ERHICommandType::End:
+        case ERHICommandType::Reset:
+            CommandBuffer.bIsRecording = false;
+            break;
+        case ERHICommandType::Draw:
+        case ERHICommandType::DrawIndexed:
+        case ERHICommandType::DrawIndirect:
+        case ERHICommandType::DrawIndexedIndirect:
+        case ERHICommandType::DrawIndexedIndirectCount:
+            DrawCount.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case ERHICommandType::Dispatch:
+        case ERHICommandType::DispatchIndirect:
+            DispatchCount.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case ERHICommandType::WriteTimestamp:
+        {
+            const auto& Cmd = static_cast<const FRHICommand_WriteTimestamp&>(Command);
+            Cmd.QueryPool.GetHandle().Cast<FNullQueryPool*>()->Results[Cmd.Query] = static_cast<UInt64>(NowNs());
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+bool FGfxDeviceNull::SubmitCommandBuffer(FRHICommandBuffer& CommandBuffer, const TArray<FRHISemaphore>& WaitSemaphores,
+                                         const TArray<FRHISemaphore>& SignalSemaphores, const FRHIFence& Fence)
+{
+    if (!CommandBuffer.IsValid())
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "Invalid command buffer");
+        return false;
+    }
+
+    SubmitCount.fetch_add(1, std::memory_order_relaxed);
+
+    // 队列串行执行: 本次提交在上一次提交完成之后再经过 SubmitLatencyNs 完成
+    Int64 CompletionTime;
+    {
+        std::lock_guard Lock(QueueMutex);
+        CompletionTime   = std::max(NowNs(), LastCompletionNs) +
+                         static_cast<Int64>(SubmitLatencyNs.load(std::memory_order_relaxed));
+        LastCompletionNs = CompletionTime;
+    }
+
+    if (Fence.IsValid())
+    {
+        Fence.Handle.Cast<FNullFence*>()->CompletionTimeNs.store(std::max<Int64>(CompletionTime, 1),
+                                                                 std::memory_order_release);
+    }
+    return true;
+}
+
+// ============================================================================
+// 窗口
+// ============================================================================
+
+Int32 FGfxDeviceNull::FindWindowSlot(const FRHIWindow& Window)
+{
+    const auto& WindowManager = FRHIWindowManager::GetRef();
+    for (Int32 i = 0; i < MAX_RHI_WINDOW_COUNT; ++i)
+    {
+        if (WindowManager.Windows[i] && WindowManager.Windows[i].Get() == &Window)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+FGfxDeviceNull::FNullSwapChain* FGfxDeviceNull::GetSwapChain(const FRHIWindow& Window)
+{
+    return Window.GetSwapChain().Handle.Cast<FNullSwapChain*>();
+}
+
+void FGfxDeviceNull::CreateWindowAndSurface(FRHIWindow& Window, const FName Name, const FVector2i Size,
+                                            const bool bHidden)
+{
+    const Int32 Slot = FindWindowSlot(Window);
+    if (Slot < 0)
+    {
+        HK_LOG_FATAL(ELogcat::RHI, "窗口不在窗口管理器中");
+        throw std::runtime_error("窗口不在窗口管理器中");
+    }
+
+    void* WindowHandle = &SwapChains[Slot];
+    if (!bOffscreen)
+    {
+        const SDL_WindowFlags Flags = bHidden ? SDL_WINDOW_RESIZABLE | SDL_WINDOW_HIDDEN : SDL_WINDOW_RESIZABLE;
+        SDL_Window*           SDLWindow = SDL_CreateWindow(Name.GetString().CStr(), Size.X, Size.Y, Flags);
+        if (!SDLWindow)
+        {
+            const FString ErrorMsg = FString("SDL窗口创建失败: ") + FString(SDL_GetError());
+            HK_LOG_FATAL(ELogcat::RHI, "SDL窗口创建失败: {}", SDL_GetError());
+            throw std::runtime_error(ErrorMsg.CStr());
+        }
+        WindowHandle = SDLWindow;
+    }
+
+    Window.SetSurface(FRHISurface{
+        FRHIHandleManager::GetRef().CreateRHIHandle(ERHIResourceType::Surface, "NullSurface", NullResourcePtr())});
+    Window.SetHandle(WindowHandle);
+    Window.SetWindowName(Name);
+    Window.SetSize(Size);
+}
+
+void FGfxDeviceNull::CreateSwapChain(FRHIWindow& Window)
+{
+    const Int32 Slot = FindWindowSlot(Window);
+    if (Slot < 0)
+    {
+        HK_LOG_FATAL(ELogcat::RHI, "窗口不在窗口管理器中");
+        throw std::runtime_error("窗口不在窗口管理器中");
+    }
+
+    auto&           HandleManager = FRHIHandleManager::GetRef();
+    FNullSwapChain& SwapChain     = SwapChains[Slot];
+    SwapChain.NextImageIndex      = 0;
+    SwapChain.ImageViews.Clear();
+    SwapChain.ImageViews.Reserve(SwapChainImageCount);
+    for (UInt32 i = 0; i < SwapChainImageCount; ++i)
+    {
+        FRHIImageView ImageView;
+        ImageView.Handle   = HandleManager.CreateRHIHandle(ERHIResourceType::ImageView, "NullSwapChainImageView",
+                                                           NullResourcePtr());
+        ImageView.ViewType = ERHIImageType::Image2D;
+        ImageView.Format   = ERHIImageFormat::B8G8R8A8_SRGB;
+        ImageView.Aspects  = ERHIImageAspect::Color;
+        SwapChain.ImageViews.Add(ImageView);
+    }
+
+    Window.SetSwapChain(
+        FRHISwapChain{HandleManager.CreateRHIHandle(ERHIResourceType::SwapChain, "NullSwapChain", &SwapChain)});
+}
+
+void FGfxDeviceNull::DestroyWindowResources(FRHIWindow& Window)
+{
+    auto& HandleManager = FRHIHandleManager::GetRef();
+    if (FNullSwapChain* SwapChain = GetSwapChain(Window))
+    {
+        for (auto& ImageView : SwapChain->ImageViews)
+        {
+            HandleManager.DestroyRHIHandle(ImageView.Handle);
+        }
+        SwapChain->ImageViews.Clear();
+        SwapChain->NextImageIndex = 0;
+        HandleManager.DestroyRHIHandle(Window.GetSwapChain().Handle);
+        Window.SetSwapChain(FRHISwapChain{FRHIHandle()});
+    }
+
+    if (Window.GetSurface().Handle.IsValid())
+    {
+        HandleManager.DestroyRHIHandle(Window.GetSurface().Handle);
+        Window.SetSurface(FRHISurface{FRHIHandle()});
+    }
+
+    if (Window.GetHandle())
+    {
+        if (!bOffscreen)
+        {
+            SDL_DestroyWindow(static_cast<SDL_Window*>(Window.GetHandle()));
+        }
+        Window.SetHandle(nullptr);
+    }
+}
+
+void FGfxDeviceNull::CreateMainWindowSurface(const FName MainWindowName, const FVector2i MainWindowInitSize,
+                                             FRHIWindow& OutMainWindow)
+{
+    if (OutMainWindow.GetSurface().Handle.IsValid())
+    {
+        return;
+    }
+    CreateWindowAndSurface(OutMainWindow, MainWindowName, MainWindowInitSize, false);
+    OutMainWindow.SetOpened(true); // 窗口创建时默认打开
+}
+
+void FGfxDeviceNull::CreateMainWindowSwapChain(FRHIWindow& OutMainWindow)
+{
+    if (!OutMainWindow.GetSurface().Handle.IsValid())
+    {
+        HK_LOG_FATAL(ELogcat::RHI, "MainWindow Surface未创建");
+        throw std::runtime_error("MainWindow Surface未创建");
+    }
+    CreateSwapChain(OutMainWindow);
+}
+
+void FGfxDeviceNull::CreateRHIWindow(const FName Name, const FVector2i Size, FRHIWindow& OutWindow)
+{
+    // 与 Vulkan 后端一致, 新窗口默认隐藏, 需要调用 Open() 显示
+    CreateWindowAndSurface(OutWindow, Name, Size, true);
+    try
+    {
+        CreateSwapChain(OutWindow);
+    }
+    catch (...)
+    {
+        DestroyWindowResources(OutWindow);
+        throw;
+    }
+}
+
+void FGfxDeviceNull::DestroyMainWindow(FRHIWindow& MainWindow)
+{
+    DestroyWindowResources(MainWindow);
+    MainWindow.SetOpened(false);
+    FRHIWindowManager::GetRef().Windows[0].Reset();
+}
+
+void FGfxDeviceNull::DestroyRHIWindow(FRHIWindow& Window)
+{
+    DestroyWindowResources(Window);
+    Window.SetOpened(false);
+}
+
+void FGfxDeviceNull::OpenWindow(FRHIWindow& Window)
+{
+    if (!Window.GetHandle())
+    {
+        HK_LOG_WARN(ELogcat::RHI, "窗口句柄为空，无法打开窗口");
+        return;
+    }
+    if (!bOffscreen)
+    {
+        SDL_ShowWindow(static_cast<SDL_Window*>(Window.GetHandle()));
+    }
+    Window.SetOpened(true);
+}
+
+void FGfxDeviceNull::CloseWindow(FRHIWindow& Window)
+{
+    if (!Window.GetHandle())
+    {
+        HK_LOG_WARN(ELogcat::RHI, "窗口句柄为空，无法关闭窗口");
+        return;
+    }
+    if (!bOffscreen)
+    {
+        SDL_HideWindow(static_cast<SDL_Window*>(Window.GetHandle()));
+    }
+    Window.SetOpened(false);
+}
+
+bool FGfxDeviceNull::AcquireNextImage(FRHIWindow& Window, const FRHISemaphore& ImageAvailableSemaphore,
+                                      UInt32& OutImageIndex)
+{
+    FNullSwapChain* SwapChain = GetSwapChain(Window);
+    if (!Window.IsValid() || !SwapChain || SwapChain->ImageViews.IsEmpty())
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "Invalid window");
+        return false;
+    }
+
+    OutImageIndex             = SwapChain->NextImageIndex;
+    SwapChain->NextImageIndex = (SwapChain->NextImageIndex + 1) % SwapChain->ImageViews.Size();
+    return true;
+}
+
+bool FGfxDeviceNull::PresentImage(FRHIWindow& Window, UInt32 ImageIndex, const FRHISemaphore& RenderFinishedSemaphore)
+{
+    if (!Window.IsValid())
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "Invalid window");
+        return false;
+    }
+    PresentCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+FRHIImageView FGfxDeviceNull::GetSwapChainImageView(FRHIWindow& Window, UInt32 ImageIndex)
+{
+    const FNullSwapChain* SwapChain = GetSwapChain(Window);
+    if (!SwapChain || ImageIndex >= SwapChain->ImageViews.Size())
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "Image index {} out of range", ImageIndex);
+        return {};
+    }
+    return SwapChain->ImageViews[ImageIndex];
+}
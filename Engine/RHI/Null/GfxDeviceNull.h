@@ -0,0 +1,205 @@
+#pragma once
+
+#include "Core/Container/Array.h"
+#include "RHI/GfxDevice.h"
+#include "RHI/RHIBuffer.h"
+#include "RHI/RHICommand.h"
+#include "RHI/RHICommandBuffer.h"
+#include "RHI/RHICommandPool.h"
+#include "RHI/RHIDescriptorSet.h"
+#include "RHI/RHIImage.h"
+#include "RHI/RHIImageView.h"
+#include "RHI/RHIPipeline.h"
+#include "RHI/RHIQueryPool.h"
+#include "RHI/RHISampler.h"
+#include "RHI/RHISync.h"
+#include "RHI/RHIWindow.h"
+
+#include <atomic>
+#include <mutex>
+
+/**
+ * Null后端的统计数据, 用于基准测试与CI断言渲染路径的CPU行为
+ */
+struct FGfxDeviceNullStats
+{
+    UInt64 SubmitCount       = 0; // 提交的命令缓冲区数量
+    UInt64 CommandCount      = 0; // 执行的命令数量
+    UInt64 DrawCount         = 0; // 绘制命令数量（包括间接绘制）
+    UInt64 DispatchCount     = 0; // 计算调度命令数量
+    UInt64 PresentCount      = 0; // 呈现次数
+    UInt64 BufferMemoryBytes = 0; // 当前由主机内存支持的缓冲区字节数
+};
+
+/**
+ * 不访问GPU的Null后端
+ * 所有资源只在FRHIHandleManager中登记; HostVisible缓冲区由主机内存支持, 可以正常Map和写入;
+ * 提交立即完成, 或者在注入的延迟之后由栅栏报告完成, 用于模拟GPU耗时
+ * 时间戳查询在命令执行时写入CPU的纳秒时间, 管线统计查询的结果始终为0
+ * Offscreen模式下不初始化SDL, 也不创建任何系统窗口, 可以在没有显示设备的机器上运行
+ */
+class FGfxDeviceNull : public FGfxDevice
+{
+public:
+    void Init() override;
+    void UnInit() override;
+    void WaitIdle() override;
+
+#pragma region Buffer操作
+    FRHIBuffer CreateBuffer(const FRHIBufferDesc& BufferCreateInfo) override;
+    void       DestroyBuffer(FRHIBuffer& Buffer) override;
+    void*      MapBuffer(FRHIBuffer& Buffer, UInt64 Offset, UInt64 Size) override;
+    void       UnmapBuffer(FRHIBuffer& Buffer) override;
+#pragma endregion
+
+#pragma region Image操作
+    FRHIImage     CreateImage(const FRHIImageDesc& ImageCreateInfo) override;
+    void          DestroyImage(FRHIImage& Image) override;
+    FRHIImageView CreateImageView(const FRHIImage& Image, const FRHIImageViewDesc& ViewCreateInfo) override;
+    void          DestroyImageView(FRHIImageView& ImageView) override;
+    FRHISampler   CreateSampler(const FRHISamplerDesc& SamplerCreateInfo) override;
+    void          DestroySampler(FRHISampler& Sampler) override;
+#pragma endregion
+
+#pragma region Descriptor操作
+    FRHIDescriptorSetLayout CreateDescriptorSetLayout(const FRHIDescriptorSetLayoutDesc& LayoutCreateInfo) override;
+    void               DestroyDescriptorSetLayout(FRHIDescriptorSetLayout& DescriptorSetLayout) override;
+    FRHIDescriptorPool CreateDescriptorPool(const FRHIDescriptorPoolDesc& PoolCreateInfo) override;
+    void               DestroyDescriptorPool(FRHIDescriptorPool& DescriptorPool) override;
+    FRHIDescriptorSet  AllocateDescriptorSet(const FRHIDescriptorPool&    Pool,
+                                             const FRHIDescriptorSetDesc& SetCreateInfo) override;
+    void FreeDescriptorSet(const FRHIDescriptorPool& Pool, FRHIDescriptorSet& DescriptorSet) override;
+    void UpdateDescriptorSet(const FRHIDescriptorSet&              DescriptorSet,
+                             const TArray<FRHIWriteDescriptorSet>& WriteDescriptorSets) override;
+    FRHIBindlessLimits GetBindlessLimits() const override;
+#pragma endregion
+
+#pragma region Pipeline操作
+    FRHIShaderModule   CreateShaderModule(const FRHIShaderModuleDesc& ModuleCreateInfo, ERHIShaderStage Stage) override;
+    void               DestroyShaderModule(FRHIShaderModule& ShaderModule) override;
+    FRHIPipelineLayout CreatePipelineLayout(const FRHIPipelineLayoutDesc& LayoutCreateInfo) override;
+    void               DestroyPipelineLayout(FRHIPipelineLayout& PipelineLayout) override;
+    FRHIPipeline       CreateGraphicsPipeline(const FRHIGraphicsPipelineDesc& PipelineCreateInfo) override;
+    FRHIPipeline       CreateComputePipeline(const FRHIComputePipelineDesc& PipelineCreateInfo) override;
+    FRHIPipeline       CreateRayTracingPipeline(const FRHIRayTracingPipelineDesc& PipelineCreateInfo) override;
+    void               DestroyPipeline(FRHIPipeline& Pipeline) override;
+#pragma endregion
+
+#pragma region Sync操作
+    FRHISemaphore CreateSemaphore(const FRHISemaphoreDesc& SemaphoreCreateInfo) override;
+    void          DestroySemaphore(FRHISemaphore& Semaphore) override;
+    FRHIFence     CreateFence(const FRHIFenceDesc& FenceCreateInfo) override;
+    void          DestroyFence(FRHIFence& Fence) override;
+    bool WaitForFence(const FRHIFence& Fence, UInt64 Timeout = std::numeric_limits<UInt64>::max()) override;
+    bool IsFenceSignaled(const FRHIFence& Fence) const override;
+    bool ResetFence(const FRHIFence& Fence) override;
+#pragma endregion
+
+#pragma region Query操作
+    FRHIQueryPool CreateQueryPool(const FRHIQueryPoolDesc& QueryPoolCreateInfo) override;
+    void          DestroyQueryPool(FRHIQueryPool& QueryPool) override;
+    bool          GetQueryPoolResults(const FRHIQueryPool& QueryPool, UInt32 FirstQuery, UInt32 QueryCount,
+                                      TArray<UInt64>& OutResults) override;
+    double        GetTimestampPeriod() const override;
+#pragma endregion
+
+#pragma region CommandPool操作
+    FRHICommandPool CreateCommandPool(const FRHICommandPoolDesc& PoolCreateInfo) override;
+    void            DestroyCommandPool(FRHICommandPool& CommandPool) override;
+#pragma endregion
+
+#pragma region CommandBuffer操作
+    FRHICommandBuffer CreateCommandBuffer(const FRHICommandPool&       Pool,
+                                          const FRHICommandBufferDesc& CommandBufferCreateInfo) override;
+    void DestroyCommandBuffer(const FRHICommandPool& Pool, FRHICommandBuffer& CommandBuffer) override;
+    void ExecuteCommand(FRHICommandBuffer& CommandBuffer, const FRHICommand& Command) override;
+
+    bool SubmitCommandBuffer(FRHICommandBuffer& CommandBuffer, const TArray<FRHISemaphore>& WaitSemaphores,
+                             const TArray<FRHISemaphore>& SignalSemaphores, const FRHIFence& Fence) override;
+#pragma endregion
+
+#pragma region 窗口操作
+    void CreateMainWindowSurface(FName MainWindowName, FVector2i MainWindowInitSize,
+                                 FRHIWindow& OutMainWindow) override;
+    void CreateMainWindowSwapChain(FRHIWindow& OutMainWindow) override;
+    void CreateRHIWindow(FName Name, FVector2i Size, FRHIWindow& OutWindow) override;
+    void DestroyMainWindow(FRHIWindow& MainWindow) override;
+    void DestroyRHIWindow(FRHIWindow& Window) override;
+    void OpenWindow(FRHIWindow& Window) override;
+    void CloseWindow(FRHIWindow& Window) override;
+    bool AcquireNextImage(FRHIWindow& Window, const FRHISemaphore& ImageAvailableSemaphore,
+                          UInt32& OutImageIndex) override;
+    bool PresentImage(FRHIWindow& Window, UInt32 ImageIndex, const FRHISemaphore& RenderFinishedSemaphore) override;
+    FRHIImageView GetSwapChainImageView(FRHIWindow& Window, UInt32 ImageIndex) override;
+#pragma endregion
+
+    /**
+     * 设置每次提交模拟的GPU耗时, 队列按提交顺序串行执行, 栅栏在前一次提交完成后再经过该时长才完成
+     * @param Microseconds 0 表示提交立即完成
+     */
+    void SetSubmitLatency(UInt64 Microseconds)
+    {
+        SubmitLatencyNs.store(Microseconds * 1000, std::memory_order_relaxed);
+    }
+
+    bool IsOffscreen() const
+    {
+        return bOffscreen;
+    }
+
+    FGfxDeviceNullStats GetStats() const;
+    void                ResetStats();
+
+private:
+    static constexpr UInt32 SwapChainImageCount = 3;
+
+    // 每个窗口的模拟SwapChain, 下标与FRHIWindowManager中的窗口槽位一致
+    struct FNullSwapChain
+    {
+        TArray<FRHIImageView> ImageViews;
+        UInt32                NextImageIndex = 0;
+    };
+
+    /**
+     * 为窗口创建系统窗口（非Offscreen时）与Surface
+     * @param Window 窗口管理器中的窗口
+     * @param bHidden 创建后是否隐藏
+     */
+    void CreateWindowAndSurface(FRHIWindow& Window, FName Name, FVector2i Size, bool bHidden);
+
+    /**
+     * 为窗口创建模拟的SwapChain
+     */
+    void CreateSwapChain(FRHIWindow& Window);
+
+    /**
+     * 销毁窗口的SwapChain, Surface与系统窗口, 不修改窗口管理器
+     */
+    void DestroyWindowResources(FRHIWindow& Window);
+
+    /**
+     * 查找窗口在FRHIWindowManager中的槽位
+     * @return 未找到时返回-1
+     */
+    static Int32 FindWindowSlot(const FRHIWindow& Window);
+
+    static FNullSwapChain* GetSwapChain(const FRHIWindow& Window);
+
+    static Int64 NowNs();
+
+    FNullSwapChain SwapChains[MAX_RHI_WINDOW_COUNT] = {};
+
+    bool bOffscreen = true;
+
+    std::atomic<UInt64> SubmitLatencyNs{0};
+    // 队列上最后一次提交的模拟完成时间
+    std::mutex QueueMutex;
+    Int64      LastCompletionNs = 0;
+
+    std::atomic<UInt64> SubmitCount{0};
+    std::atomic<UInt64> CommandCount{0};
+    std::atomic<UInt64> DrawCount{0};
+    std::atomic<UInt64> DispatchCount{0};
+    std::atomic<UInt64> PresentCount{0};
+    std::atomic<UInt64> BufferMemoryBytes{0};
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Core/Memory/MemoryStats.h"
 #include "Core/String/String.h"
 #include "Core/Utility/HashUtility.h"
 #include "Core/Utility/Macros.h"
@@ -50,6 +51,7 @@ class FRHIBuffer
 {
     friend class FGfxDevice;
     friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
 
 public:
     // 默认构造：创建空的 Buffer（无效）
@@ -99,6 +101,12 @@ public:
         return MemoryProperty;
     }
 
+    // 获取显存统计的分类
+    EMemoryTag GetMemoryTag() const
+    {
+        return MemoryTag;
+    }
+
     // 映射内存（用于 CPU 访问）
     void* Map(UInt64 Offset = 0, UInt64 MapSize = 0);
 
@@ -144,4 +152,6 @@ private:
     ERHIBufferUsage          Usage          = ERHIBufferUsage::None;
     ERHIBufferMemoryProperty MemoryProperty = ERHIBufferMemoryProperty::None;
     void*                    MappedPtr      = nullptr; // 映射的内存指针
+    // 创建时记入的分类, 销毁时按同一分类扣除
+    EMemoryTag               MemoryTag      = EMemoryTag::Untagged;
 };
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Core/Container/Array.h"
+#include "Core/Container/InlineArray.h"
+#include "Core/Container/Span.h"
 #include "Core/Utility/Macros.h"
 #include "Math/Rect2D.h"
 #include "Math/Vector.h"
@@ -9,11 +11,11 @@
 #include "RHIImage.h"
 #include "RHIImageView.h"
 #include "RHIPipeline.h"
+#include "RHIQueryPool.h"
 #include <utility>
 
 // 前向声明
 struct FRHIViewport;
-struct FRHIBufferCopyRegion;
 struct FRHIImageCopyRegion;
 struct FRHIBufferImageCopyRegion;
 struct FRHIImageSubresourceRange;
@@ -27,6 +29,14 @@ enum class ERHIAccessFlag : UInt32;
 enum class ERHIPipelineStageFlag : UInt32;
 enum class ERHIDependencyFlag : UInt32;
 
+// 复制命令以内联数组保存区域, 需要完整的类型
+struct FRHIBufferCopyRegion
+{
+    UInt64 SrcOffset = 0; // 源偏移量（字节）
+    UInt64 DstOffset = 0; // 目标偏移量（字节）
+    UInt64 Size      = 0; // 复制大小（字节）
+};
+
 // 命令缓冲区使用标志（定义在这里以避免循环依赖）
 enum class ERHICommandBufferUsageFlag : UInt32
 {
@@ -65,6 +75,7 @@ enum class ERHICommandType : UInt32
     DrawIndexed,
     DrawIndirect,
     DrawIndexedIndirect,
+    DrawIndexedIndirectCount,
 
     // 计算调度命令
     Dispatch,
@@ -75,6 +86,7 @@ enum class ERHICommandType : UInt32
     CopyImage,
     CopyBufferToImage,
     CopyImageToBuffer,
+    FillBuffer,
 
     // 图像清除命令
     ClearColorImage,
@@ -94,6 +106,12 @@ enum class ERHICommandType : UInt32
     BeginRendering,
     EndRendering,
 
+    // 查询命令
+    ResetQueryPool,
+    WriteTimestamp,
+    BeginQuery,
+    EndQuery,
+
     Count,
 };
 
@@ -183,15 +201,16 @@ struct FRHICommand_BindDescriptorSet : FRHICommand
 
 struct FRHICommand_BindDescriptorSets : FRHICommand
 {
-    ERHIPipelineType          PipelineType;
-    FRHIPipelineLayout        Layout;
-    TArray<FRHIDescriptorSet> DescriptorSets;
-    UInt32                    FirstSet;
+    ERHIPipelineType                   PipelineType;
+    FRHIPipelineLayout                 Layout;
+    // Vulkan 保证至少可以同时绑定 4 个描述符集, 常见的绑定不需要堆分配
+    TInlineArray<FRHIDescriptorSet, 4> DescriptorSets;
+    UInt32                             FirstSet;
 
     FRHICommand_BindDescriptorSets(const ERHIPipelineType InPipelineType, FRHIPipelineLayout InLayout,
-                                   const TArray<FRHIDescriptorSet>& InDescriptorSets, const UInt32 InFirstSet)
-        : FRHICommand(), PipelineType(InPipelineType), Layout(std::move(InLayout)), DescriptorSets(InDescriptorSets),
-          FirstSet(InFirstSet)
+                                   const TSpan<const FRHIDescriptorSet> InDescriptorSets, const UInt32 InFirstSet)
+        : FRHICommand(), PipelineType(InPipelineType), Layout(std::move(InLayout)),
+          DescriptorSets(InDescriptorSets.begin(), InDescriptorSets.end()), FirstSet(InFirstSet)
     {
         CommandType = ERHICommandType::BindDescriptorSets;
     }
@@ -308,6 +327,25 @@ struct FRHICommand_DrawIndexedIndirect : FRHICommand
     }
 };
 
+struct FRHICommand_DrawIndexedIndirectCount : FRHICommand
+{
+    FRHIBuffer Buffer;
+    UInt64     Offset;
+    FRHIBuffer CountBuffer;
+    UInt64     CountOffset;
+    UInt32     MaxDrawCount;
+    UInt32     Stride;
+
+    FRHICommand_DrawIndexedIndirectCount(FRHIBuffer InBuffer, const UInt64 InOffset, FRHIBuffer InCountBuffer,
+                                         const UInt64 InCountOffset, const UInt32 InMaxDrawCount,
+                                         const UInt32 InStride)
+        : FRHICommand(), Buffer(std::move(InBuffer)), Offset(InOffset), CountBuffer(std::move(InCountBuffer)),
+          CountOffset(InCountOffset), MaxDrawCount(InMaxDrawCount), Stride(InStride)
+    {
+        CommandType = ERHICommandType::DrawIndexedIndirectCount;
+    }
+};
+
 // ============================================================================
 // 计算调度命令
 // ============================================================================
@@ -343,13 +381,14 @@ struct FRHICommand_DispatchIndirect : FRHICommand
 
 struct FRHICommand_CopyBuffer : FRHICommand
 {
-    FRHIBuffer                   SrcBuffer;
-    FRHIBuffer                   DstBuffer;
-    TArray<FRHIBufferCopyRegion> Regions;
+    FRHIBuffer                            SrcBuffer;
+    FRHIBuffer                            DstBuffer;
+    TInlineArray<FRHIBufferCopyRegion, 2> Regions; // 上传数据通常只有一个区域
 
     FRHICommand_CopyBuffer(FRHIBuffer InSrcBuffer, FRHIBuffer InDstBuffer,
-                           const TArray<FRHIBufferCopyRegion>& InRegions)
-        : FRHICommand(), SrcBuffer(std::move(InSrcBuffer)), DstBuffer(std::move(InDstBuffer)), Regions(InRegions)
+                           const TSpan<const FRHIBufferCopyRegion> InRegions)
+        : FRHICommand(), SrcBuffer(std::move(InSrcBuffer)), DstBuffer(std::move(InDstBuffer)),
+          Regions(InRegions.begin(), InRegions.end())
     {
         CommandType = ERHICommandType::CopyBuffer;
     }
@@ -396,6 +435,20 @@ struct FRHICommand_CopyImageToBuffer : FRHICommand
     }
 };
 
+struct FRHICommand_FillBuffer : FRHICommand
+{
+    FRHIBuffer Buffer;
+    UInt64     Offset;
+    UInt64     Size;
+    UInt32     Data;
+
+    FRHICommand_FillBuffer(FRHIBuffer InBuffer, const UInt64 InOffset, const UInt64 InSize, const UInt32 InData)
+        : FRHICommand(), Buffer(std::move(InBuffer)), Offset(InOffset), Size(InSize), Data(InData)
+    {
+        CommandType = ERHICommandType::FillBuffer;
+    }
+};
+
 // ============================================================================
 // 图像清除命令
 // ============================================================================
@@ -560,3 +613,57 @@ struct FRHICommand_EndRendering : FRHICommand
         CommandType = ERHICommandType::EndRendering;
     }
 };
+
+// ============================================================================
+// 查询命令
+// ============================================================================
+
+struct FRHICommand_ResetQueryPool : FRHICommand
+{
+    FRHIQueryPool QueryPool;
+    UInt32        FirstQuery;
+    UInt32        QueryCount;
+
+    FRHICommand_ResetQueryPool(FRHIQueryPool InQueryPool, const UInt32 InFirstQuery, const UInt32 InQueryCount)
+        : FRHICommand(), QueryPool(std::move(InQueryPool)), FirstQuery(InFirstQuery), QueryCount(InQueryCount)
+    {
+        CommandType = ERHICommandType::ResetQueryPool;
+    }
+};
+
+struct FRHICommand_WriteTimestamp : FRHICommand
+{
+    FRHIQueryPool         QueryPool;
+    UInt32                Query;
+    ERHIPipelineStageFlag Stage;
+
+    FRHICommand_WriteTimestamp(FRHIQueryPool InQueryPool, const UInt32 InQuery, const ERHIPipelineStageFlag InStage)
+        : FRHICommand(), QueryPool(std::move(InQueryPool)), Query(InQuery), Stage(InStage)
+    {
+        CommandType = ERHICommandType::WriteTimestamp;
+    }
+};
+
+struct FRHICommand_BeginQuery : FRHICommand
+{
+    FRHIQueryPool QueryPool;
+    UInt32        Query;
+
+    FRHICommand_BeginQuery(FRHIQueryPool InQueryPool, const UInt32 InQuery)
+        : FRHICommand(), QueryPool(std::move(InQueryPool)), Query(InQuery)
+    {
+        CommandType = ERHICommandType::BeginQuery;
+    }
+};
+
+struct FRHICommand_EndQuery : FRHICommand
+{
+    FRHIQueryPool QueryPool;
+    UInt32        Query;
+
+    FRHICommand_EndQuery(FRHIQueryPool InQueryPool, const UInt32 InQuery)
+        : FRHICommand(), QueryPool(std::move(InQueryPool)), Query(InQuery)
+    {
+        CommandType = ERHICommandType::EndQuery;
+    }
+};
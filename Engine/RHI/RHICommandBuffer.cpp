@@ -51,7 +51,7 @@ void FRHICommandBuffer::BindDescriptorSet(ERHIPipelineType PipelineType, const F
 }
 
 void FRHICommandBuffer::BindDescriptorSets(ERHIPipelineType PipelineType, const FRHIPipelineLayout& Layout,
-                                           const TArray<FRHIDescriptorSet>& DescriptorSets, UInt32 FirstSet)
+                                           const TSpan<const FRHIDescriptorSet> DescriptorSets, UInt32 FirstSet)
 {
     auto Cmd = MakeUnique<FRHICommand_BindDescriptorSets>(PipelineType, Layout, DescriptorSets, FirstSet);
     AddOrExecuteCommand(std::move(Cmd));
@@ -101,6 +101,15 @@ void FRHICommandBuffer::DrawIndexedIndirect(const FRHIBuffer& Buffer, UInt64 Off
     AddOrExecuteCommand(std::move(Cmd));
 }
 
+void FRHICommandBuffer::DrawIndexedIndirectCount(const FRHIBuffer& Buffer, UInt64 Offset,
+                                                 const FRHIBuffer& CountBuffer, UInt64 CountOffset,
+                                                 UInt32 MaxDrawCount, UInt32 Stride)
+{
+    auto Cmd = MakeUnique<FRHICommand_DrawIndexedIndirectCount>(Buffer, Offset, CountBuffer, CountOffset,
+                                                                 MaxDrawCount, Stride);
+    AddOrExecuteCommand(std::move(Cmd));
+}
+
 void FRHICommandBuffer::Dispatch(UInt32 GroupCountX, UInt32 GroupCountY, UInt32 GroupCountZ)
 {
     auto Cmd = MakeUnique<FRHICommand_Dispatch>(GroupCountX, GroupCountY, GroupCountZ);
@@ -114,7 +123,7 @@ void FRHICommandBuffer::DispatchIndirect(const FRHIBuffer& Buffer, UInt64 Offset
 }
 
 void FRHICommandBuffer::CopyBuffer(const FRHIBuffer& SrcBuffer, const FRHIBuffer& DstBuffer,
-                                   const TArray<FRHIBufferCopyRegion>& Regions)
+                                   const TSpan<const FRHIBufferCopyRegion> Regions)
 {
     auto Cmd = MakeUnique<FRHICommand_CopyBuffer>(SrcBuffer, DstBuffer, Regions);
     AddOrExecuteCommand(std::move(Cmd));
@@ -141,6 +150,12 @@ void FRHICommandBuffer::CopyImageToBuffer(const FRHIImage& SrcImage, const FRHIB
     AddOrExecuteCommand(std::move(Cmd));
 }
 
+void FRHICommandBuffer::FillBuffer(const FRHIBuffer& Buffer, UInt64 Offset, UInt64 Size, UInt32 Data)
+{
+    auto Cmd = MakeUnique<FRHICommand_FillBuffer>(Buffer, Offset, Size, Data);
+    AddOrExecuteCommand(std::move(Cmd));
+}
+
 void FRHICommandBuffer::ClearColorImage(const FRHIImage& Image, const FVector4f& Color,
                                         const TArray<FRHIImageSubresourceRange>& Ranges)
 {
@@ -185,6 +200,30 @@ void FRHICommandBuffer::PushConstants(const FRHIPipelineLayout& Layout, UInt32 S
     AddOrExecuteCommand(std::move(Cmd));
 }
 
+void FRHICommandBuffer::ResetQueryPool(const FRHIQueryPool& QueryPool, UInt32 FirstQuery, UInt32 QueryCount)
+{
+    auto Cmd = MakeUnique<FRHICommand_ResetQueryPool>(QueryPool, FirstQuery, QueryCount);
+    AddOrExecuteCommand(std::move(Cmd));
+}
+
+void FRHICommandBuffer::WriteTimestamp(const FRHIQueryPool& QueryPool, UInt32 Query, ERHIPipelineStageFlag Stage)
+{
+    auto Cmd = MakeUnique<FRHICommand_WriteTimestamp>(QueryPool, Query, Stage);
+    AddOrExecuteCommand(std::move(Cmd));
+}
+
+void FRHICommandBuffer::BeginQuery(const FRHIQueryPool& QueryPool, UInt32 Query)
+{
+    auto Cmd = MakeUnique<FRHICommand_BeginQuery>(QueryPool, Query);
+    AddOrExecuteCommand(std::move(Cmd));
+}
+
+void FRHICommandBuffer::EndQuery(const FRHIQueryPool& QueryPool, UInt32 Query)
+{
+    auto Cmd = MakeUnique<FRHICommand_EndQuery>(QueryPool, Query);
+    AddOrExecuteCommand(std::move(Cmd));
+}
+
 void FRHICommandBuffer::BeginRenderPass(const FRHIRenderPassBeginInfo& RenderPassBeginInfo,
                                         ERHICommandBufferLevel         Contents)
 {
@@ -294,6 +333,20 @@ void FRHICommandBuffer::Execute()
     // Threaded 模式暂时忽略
 }
 
+void FRHICommandBuffer::AppendCommands(FRHICommandBuffer& Other)
+{
+    if (&Other == this)
+    {
+        return;
+    }
+
+    for (auto& Cmd : Other.CommandQueue)
+    {
+        AddOrExecuteCommand(std::move(Cmd));
+    }
+    Other.ClearCommands();
+}
+
 // 清空命令队列
 void FRHICommandBuffer::ClearCommands()
 {
@@ -13,6 +13,7 @@
 #include "RHIHandle.h"
 #include "RHIImage.h"
 #include "RHIPipeline.h"
+#include "RHIQueryPool.h"
 #include "RHISync.h"
 
 enum class ERHICommandExecuteMode
@@ -108,6 +109,7 @@ class FRHICommandBuffer
 {
     friend class FGfxDevice;
     friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
 
 public:
     // 默认构造：创建空的 CommandBuffer（无效）
@@ -184,6 +186,12 @@ public:
     // Threaded 模式：将命令提交给渲染线程（暂时忽略）
     void Execute();
 
+    // 将另一个命令缓冲区中排队的命令按顺序追加到本缓冲区，追加后 Other 的队列被清空
+    // 用于把并行录制到多个延迟命令列表的命令合并到同一个命令缓冲区
+    // Immediate 模式：立即在本缓冲区执行这些命令
+    // Deferred 模式：转移到本缓冲区的命令队列末尾
+    void AppendCommands(FRHICommandBuffer& Other);
+
     // 提交命令缓冲区到 GPU 队列
     // @param WaitSemaphores 等待的信号量数组（可选）
     // @param SignalSemaphores 信号信号量数组（可选）
@@ -240,7 +248,7 @@ public:
     // @param DescriptorSets 描述符集数组
     // @param FirstSet 第一个描述符集索引
     void BindDescriptorSets(ERHIPipelineType PipelineType, const FRHIPipelineLayout& Layout,
-                            const TArray<FRHIDescriptorSet>& DescriptorSets, UInt32 FirstSet = 0);
+                            TSpan<const FRHIDescriptorSet> DescriptorSets, UInt32 FirstSet = 0);
 #pragma endregion
 
 #pragma region 顶点和索引缓冲区绑定
@@ -293,6 +301,16 @@ public:
     // @param DrawCount 绘制命令数量
     // @param Stride 命令之间的步长（字节）
     void DrawIndexedIndirect(const FRHIBuffer& Buffer, UInt64 Offset, UInt32 DrawCount = 1, UInt32 Stride = 0);
+
+    // 间接绘制索引，绘制数量从 CountBuffer 中读取（GPU 剔除后的压缩绘制列表）
+    // @param Buffer 间接绘制命令缓冲区
+    // @param Offset 偏移量（字节）
+    // @param CountBuffer 绘制数量缓冲区
+    // @param CountOffset 绘制数量在 CountBuffer 中的偏移量（字节）
+    // @param MaxDrawCount 最大绘制命令数量
+    // @param Stride 命令之间的步长（字节）
+    void DrawIndexedIndirectCount(const FRHIBuffer& Buffer, UInt64 Offset, const FRHIBuffer& CountBuffer,
+                                  UInt64 CountOffset, UInt32 MaxDrawCount, UInt32 Stride);
 #pragma endregion
 
 #pragma region 计算调度命令
@@ -315,7 +333,7 @@ public:
     // @param RegionCount 区域数量
     // @param Regions 复制区域数组（每个区域包含：srcOffset, dstOffset, size）
     void CopyBuffer(const FRHIBuffer& SrcBuffer, const FRHIBuffer& DstBuffer,
-                    const TArray<FRHIBufferCopyRegion>& Regions);
+                    TSpan<const FRHIBufferCopyRegion> Regions);
 
     // 复制图像
     // @param SrcImage 源图像
@@ -337,6 +355,13 @@ public:
     // @param Regions 复制区域数组
     void CopyImageToBuffer(const FRHIImage& SrcImage, const FRHIBuffer& DstBuffer,
                            const TArray<FRHIBufferImageCopyRegion>& Regions);
+
+    // 用 32 位值填充缓冲区
+    // @param Buffer 目标缓冲区
+    // @param Offset 偏移量（字节，4 字节对齐）
+    // @param Size 大小（字节，4 的倍数）
+    // @param Data 填充值
+    void FillBuffer(const FRHIBuffer& Buffer, UInt64 Offset, UInt64 Size, UInt32 Data);
 #pragma endregion
 
 #pragma region 图像清除命令
@@ -393,6 +418,31 @@ public:
                        const void* Data);
 #pragma endregion
 
+#pragma region 查询
+    // 重置查询, 查询在使用前必须重置
+    // @param QueryPool 查询池
+    // @param FirstQuery 第一个查询索引
+    // @param QueryCount 查询数量
+    void ResetQueryPool(const FRHIQueryPool& QueryPool, UInt32 FirstQuery, UInt32 QueryCount);
+
+    // 在之前的命令执行到指定阶段后写入时间戳
+    // @param QueryPool 时间戳查询池
+    // @param Query 查询索引
+    // @param Stage 管线阶段
+    void WriteTimestamp(const FRHIQueryPool& QueryPool, UInt32 Query,
+                        ERHIPipelineStageFlag Stage = ERHIPipelineStageFlag::BottomOfPipe);
+
+    // 开始查询（管线统计、遮挡）
+    // @param QueryPool 查询池
+    // @param Query 查询索引
+    void BeginQuery(const FRHIQueryPool& QueryPool, UInt32 Query);
+
+    // 结束查询
+    // @param QueryPool 查询池
+    // @param Query 查询索引
+    void EndQuery(const FRHIQueryPool& QueryPool, UInt32 Query);
+#pragma endregion
+
 #pragma region 渲染通道（如果支持）
     // 开始渲染通道（已弃用，使用 BeginRendering 代替）
     // @param RenderPassBeginInfo 渲染通道开始信息
@@ -427,14 +477,7 @@ private:
     bool                            bIsRecording = false; // 是否正在记录命令
 };
 
-// 辅助结构定义（在类外部定义，供全局使用）
-struct FRHIBufferCopyRegion
-{
-    UInt64 SrcOffset = 0; // 源偏移量（字节）
-    UInt64 DstOffset = 0; // 目标偏移量（字节）
-    UInt64 Size      = 0; // 复制大小（字节）
-};
-
+// 辅助结构定义（在类外部定义，供全局使用）, FRHIBufferCopyRegion 定义在 RHICommand.h 中
 struct FRHIImageSubresourceLayers
 {
     ERHIImageAspect AspectMask     = ERHIImageAspect::Color; // 方面掩码
@@ -33,6 +33,7 @@ class FRHICommandPool
 {
     friend class FGfxDevice;
     friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
 
 public:
     // 默认构造：创建空的 CommandPool（无效）
@@ -16,4 +16,24 @@ class FRHIConfig : public IConfig
 
     HPROPERTY(DefaultProperty)
     EGfxBackend GfxBackend = EGfxBackend::Vulkan;
+
+public:
+    bool IsNullDeviceOffscreen() const
+    {
+        return bNullDeviceOffscreen;
+    }
+
+    UInt32 GetNullDeviceLatencyMicroseconds() const
+    {
+        return NullDeviceLatencyMicroseconds;
+    }
+
+private:
+    // Null后端不创建系统窗口, 也不初始化SDL
+    HPROPERTY()
+    bool bNullDeviceOffscreen = true;
+
+    // Null后端每次提交模拟的GPU耗时（微秒）, 0表示提交立即完成
+    HPROPERTY()
+    UInt32 NullDeviceLatencyMicroseconds = 0;
 };
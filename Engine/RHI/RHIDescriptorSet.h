@@ -36,6 +36,24 @@ enum class ERHIDescriptorPoolCreateFlag : UInt32
 };
 HK_ENABLE_BITMASK_OPERATORS(ERHIDescriptorPoolCreateFlag)
 
+// 描述符绑定标志（对应 VkDescriptorBindingFlags）, 用于 bindless 描述符数组
+enum class ERHIDescriptorBindingFlag : UInt32
+{
+    None                     = 0,
+    UpdateAfterBind          = 1 << 0, // 描述符集绑定后仍可更新, 需要池开启 UpdateAfterBind
+    UpdateUnusedWhilePending = 1 << 1, // 命令缓冲区执行期间可以更新其未使用的描述符
+    PartiallyBound           = 1 << 2, // 未被动态访问的描述符可以不写入
+    VariableDescriptorCount  = 1 << 3, // 数量在分配描述符集时决定
+};
+HK_ENABLE_BITMASK_OPERATORS(ERHIDescriptorBindingFlag)
+
+// bindless 描述符数组的设备上限
+struct FRHIBindlessLimits
+{
+    UInt32 MaxSampledImages = 0; // 开启 UpdateAfterBind 的描述符集中可用的采样图像数量
+    UInt32 MaxSamplers      = 0; // 开启 UpdateAfterBind 的描述符集中可用的采样器数量
+};
+
 struct FRHIDescriptorPoolSize
 {
     ERHIDescriptorType Type  = ERHIDescriptorType::UniformBuffer; // 描述符类型
@@ -69,17 +87,19 @@ struct FRHIDescriptorPoolDesc
 // 描述符集布局绑定
 struct FRHIDescriptorSetLayoutBinding
 {
-    UInt32             Binding         = 0;                                 // 绑定索引
-    ERHIDescriptorType DescriptorType  = ERHIDescriptorType::UniformBuffer; // 描述符类型
-    UInt32             DescriptorCount = 1;                                 // 描述符数量
-    ERHIShaderStage    StageFlags      = ERHIShaderStage::None; // 着色器阶段标志（ERHIShaderStage 的位掩码）
+    UInt32                    Binding         = 0;                                 // 绑定索引
+    ERHIDescriptorType        DescriptorType  = ERHIDescriptorType::UniformBuffer; // 描述符类型
+    UInt32                    DescriptorCount = 1;                                 // 描述符数量
+    ERHIShaderStage           StageFlags      = ERHIShaderStage::None; // 着色器阶段标志（ERHIShaderStage 的位掩码）
+    ERHIDescriptorBindingFlag Flags           = ERHIDescriptorBindingFlag::None;   // 绑定标志
     // 注意：ImmutableSamplers 将在后续实现
 
     UInt64 GetHashCode() const
     {
         return FHashUtility::CombineHashes(
             std::hash<UInt32>{}(Binding), std::hash<UInt32>{}(static_cast<UInt32>(DescriptorType)),
-            std::hash<UInt32>{}(DescriptorCount), std::hash<ERHIShaderStage>{}(StageFlags));
+            std::hash<UInt32>{}(DescriptorCount), std::hash<ERHIShaderStage>{}(StageFlags),
+            std::hash<UInt32>{}(static_cast<UInt32>(Flags)));
     }
 };
 
@@ -109,6 +129,7 @@ class FRHIDescriptorSetLayout
 {
     friend class FGfxDevice;
     friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
 
 public:
     // 默认构造：创建空的 DescriptorSetLayout（无效）
@@ -209,6 +230,7 @@ class FRHIDescriptorPool
 {
     friend class FGfxDevice;
     friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
 
 public:
     // 默认构造：创建空的 DescriptorPool（无效）
@@ -284,6 +306,7 @@ class FRHIDescriptorSet
 {
     friend class FGfxDevice;
     friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
 
 public:
     // 默认构造：创建空的 DescriptorSet（无效）
@@ -6,61 +6,204 @@
 #include "Core/Logging/Logger.h"
 #include "Core/String/String.h"
 
-Int32 FRHIHandleManager::FindFreeIndex() const
+FRHIHandlePool::~FRHIHandlePool()
 {
-    std::lock_guard<std::mutex> Lock(Mutex);
-    for (Int32 i = 1; i < MAX_RHI_HANDLE_COUNT; ++i)
+    for (auto& Chunk : Chunks)
     {
-        if (!Occupied[i])
+        delete[] Chunk.load(std::memory_order_relaxed);
+    }
+}
+
+FRHIHandlePool::FSlot* FRHIHandlePool::GetSlot(UInt32 Index) const
+{
+    FSlot* Chunk = Chunks[Index / SLOTS_PER_CHUNK].load(std::memory_order_acquire);
+    return Chunk ? &Chunk[Index % SLOTS_PER_CHUNK] : nullptr;
+}
+
+UInt32 FRHIHandlePool::AllocateSlotIndex()
+{
+    const UInt32 Index      = NextUnusedIndex.fetch_add(1, std::memory_order_relaxed);
+    const UInt32 ChunkIndex = Index / SLOTS_PER_CHUNK;
+    HK_ASSERT_MSG_RAW(ChunkIndex < MAX_CHUNK_COUNT, "RHI handle pool exhausted");
+
+    if (Chunks[ChunkIndex].load(std::memory_order_acquire) == nullptr)
+    {
+        // 只有跨越块边界的线程会进入这里
+        std::lock_guard<std::mutex> Lock(GrowMutex);
+        if (Chunks[ChunkIndex].load(std::memory_order_relaxed) == nullptr)
         {
-            return i;
+            Chunks[ChunkIndex].store(new FSlot[SLOTS_PER_CHUNK], std::memory_order_release);
         }
     }
-    return FRHIHandle::INVALID_ID;
+    return Index;
 }
 
-FRHIHandle FRHIHandleManager::CreateRHIHandle(FStringView DebugName, FRHIHandle::FHandleType Handle)
+void FRHIHandlePool::PushFree(UInt32 Index)
 {
-    const Int32 Index = FindFreeIndex();
-    HK_ASSERT_MSG_RAW(Index != FRHIHandle::INVALID_ID, "Failed to find free index for RHI handle");
-    Occupied[Index] = true;
-    RHIHandles[Index].Id = Index;
-    RHIHandles[Index].Handle = Handle;
+    FSlot* Slot = GetSlot(Index);
+    UInt64 Head = FreeHead.load(std::memory_order_relaxed);
+    UInt64 NewHead;
+    do
+    {
+        Slot->NextFree.store(static_cast<UInt32>(Head), std::memory_order_relaxed);
+        NewHead = ((Head >> 32) + 1) << 32 | (Index + 1);
+    } while (!FreeHead.compare_exchange_weak(Head, NewHead, std::memory_order_release, std::memory_order_relaxed));
+}
+
+bool FRHIHandlePool::PopFree(UInt32& OutIndex)
+{
+    UInt64 Head = FreeHead.load(std::memory_order_acquire);
+    while (static_cast<UInt32>(Head) != 0)
+    {
+        // 槽位可能已被其他线程取走，此时读到的 NextFree 无意义，但版本号会让下面的 CAS 失败
+        const UInt32 Index   = static_cast<UInt32>(Head) - 1;
+        const UInt32 Next    = GetSlot(Index)->NextFree.load(std::memory_order_relaxed);
+        const UInt64 NewHead = ((Head >> 32) + 1) << 32 | Next;
+        if (FreeHead.compare_exchange_weak(Head, NewHead, std::memory_order_acquire, std::memory_order_acquire))
+        {
+            OutIndex = Index;
+            return true;
+        }
+    }
+    return false;
+}
+
+FRHIHandle FRHIHandlePool::Allocate(FStringView DebugName, FRHIHandle::FHandleType Handle)
+{
+    UInt32 Index = 0;
+    if (!PopFree(Index))
+    {
+        Index = AllocateSlotIndex();
+    }
+
+    FSlot* Slot  = GetSlot(Index);
+    Slot->Handle = Handle;
 #if HK_DEBUG
-    RHIHandles[Index].DebugName = FString(DebugName);
+    Slot->DebugName = FString(DebugName);
 #endif
-    return RHIHandles[Index];
+    Slot->bOccupied.store(true, std::memory_order_release);
+    LiveCount.fetch_add(1, std::memory_order_relaxed);
+
+    FRHIHandle Result;
+    Result.Id     = FRHIHandle::MakeId(ResourceType, Slot->Generation.load(std::memory_order_relaxed), Index);
+    Result.Handle = Handle;
+#if HK_DEBUG
+    Result.DebugName = FString(DebugName);
+#endif
+    return Result;
 }
 
-void FRHIHandleManager::DestroyRHIHandle(const FRHIHandle& Handle)
+bool FRHIHandlePool::Free(const FRHIHandle& Handle)
 {
-    std::lock_guard<std::mutex> Lock(Mutex);
-    HK_ASSERT_MSG_RAW(Handle.IsValid(), "RHI handle is invalid");
-    Occupied[Handle.Id] = false;
-    RHIHandles[Handle.Id].Id = FRHIHandle::INVALID_ID;
-    RHIHandles[Handle.Id].Handle = nullptr;
+    const UInt32 Index = Handle.GetIndex();
+    if (Index >= NextUnusedIndex.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    FSlot* Slot = GetSlot(Index);
+    if (Slot == nullptr)
+    {
+        return false;
+    }
+
+    // 代数从 1 开始循环，0 保留给无效句柄
+    UInt32       Generation    = Handle.GetGeneration();
+    const UInt32 NewGeneration = (Generation & FRHIHandle::GENERATION_MASK) == FRHIHandle::GENERATION_MASK
+                                     ? 1
+                                     : Generation + 1;
+    if (!Slot->Generation.compare_exchange_strong(Generation, NewGeneration, std::memory_order_acq_rel))
+    {
+        return false;
+    }
+
+    Slot->Handle = nullptr;
 #if HK_DEBUG
-    RHIHandles[Handle.Id].DebugName = FString();
+    Slot->DebugName = FString();
 #endif
+    Slot->bOccupied.store(false, std::memory_order_release);
+    LiveCount.fetch_sub(1, std::memory_order_relaxed);
+    PushFree(Index);
+    return true;
 }
 
-void FRHIHandleManager::ShutDown()
+bool FRHIHandlePool::IsAlive(const FRHIHandle& Handle) const
 {
-    std::lock_guard<std::mutex> Lock(Mutex);
+    const UInt32 Index = Handle.GetIndex();
+    if (Index >= NextUnusedIndex.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+    const FSlot* Slot = GetSlot(Index);
+    return Slot != nullptr && Slot->bOccupied.load(std::memory_order_acquire) &&
+           Slot->Generation.load(std::memory_order_acquire) == Handle.GetGeneration();
+}
 
-    Int32 LeakedCount = 0;
-    for (Int32 i = 1; i < MAX_RHI_HANDLE_COUNT; ++i)
+UInt32 FRHIHandlePool::ReportLeaks() const
+{
+    UInt32       LeakedCount = 0;
+    const UInt32 SlotCount   = NextUnusedIndex.load(std::memory_order_relaxed);
+    for (UInt32 i = 0; i < SlotCount; ++i)
     {
-        if (Occupied[i])
+        const FSlot* Slot = GetSlot(i);
+        if (Slot == nullptr || !Slot->bOccupied.load(std::memory_order_relaxed))
         {
-            LeakedCount++;
+            continue;
+        }
+        LeakedCount++;
+        const FRHIHandle::FID Id = FRHIHandle::MakeId(ResourceType, Slot->Generation.load(), i);
 #if HK_DEBUG
-            HK_LOG_WARN(ELogcat::Engine, "Leaked RHI Handle: ID={}, Name={}", RHIHandles[i].Id,
-                        RHIHandles[i].DebugName.IsEmpty() ? "<Unnamed>" : RHIHandles[i].DebugName.CStr());
+        HK_LOG_WARN(ELogcat::Engine, "Leaked RHI Handle: ID={:#x}, Type={}, Name={}", Id,
+                    static_cast<Int32>(ResourceType), Slot->DebugName.IsEmpty() ? "<Unnamed>" : Slot->DebugName.CStr());
 #else
-            HK_LOG_WARN(ELogcat::Engine, "Leaked RHI Handle: ID={}", RHIHandles[i].Id);
+        HK_LOG_WARN(ELogcat::Engine, "Leaked RHI Handle: ID={:#x}, Type={}", Id, static_cast<Int32>(ResourceType));
 #endif
-        }
+    }
+    return LeakedCount;
+}
+
+void FRHIHandleManager::StartUp()
+{
+    for (size_t i = 0; i < Pools.Size(); ++i)
+    {
+        Pools[i].SetResourceType(static_cast<ERHIResourceType>(i));
+    }
+}
+
+FRHIHandle FRHIHandleManager::CreateRHIHandle(ERHIResourceType Type, FStringView DebugName,
+                                              FRHIHandle::FHandleType Handle)
+{
+    HK_ASSERT_MSG_RAW(Type < ERHIResourceType::Count, "Invalid RHI resource type");
+    return Pools[static_cast<size_t>(Type)].Allocate(DebugName, Handle);
+}
+
+void FRHIHandleManager::DestroyRHIHandle(const FRHIHandle& Handle)
+{
+    HK_ASSERT_MSG_RAW(Handle.IsValid(), "RHI handle is invalid");
+    const ERHIResourceType Type = Handle.GetResourceType();
+    if (Type >= ERHIResourceType::Count || !Pools[static_cast<size_t>(Type)].Free(Handle))
+    {
+        HK_LOG_ERROR(ELogcat::Engine, "Destroying stale RHI handle (double destroy or use after destroy): ID={:#x}",
+                     Handle.Id);
+    }
+}
+
+bool FRHIHandleManager::IsAlive(const FRHIHandle& Handle) const
+{
+    const ERHIResourceType Type = Handle.GetResourceType();
+    if (!Handle.IsValid() || Type >= ERHIResourceType::Count)
+    {
+        return false;
+    }
+    return Pools[static_cast<size_t>(Type)].IsAlive(Handle);
+}
+
+void FRHIHandleManager::ShutDown()
+{
+    UInt32 LeakedCount = 0;
+    for (const auto& Pool : Pools)
+    {
+        LeakedCount += Pool.ReportLeaks();
     }
 
     if (LeakedCount > 0)
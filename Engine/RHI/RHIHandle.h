@@ -4,6 +4,7 @@
 #include "Core/String/String.h"
 #include "Core/Utility/Macros.h"
 
+#include <atomic>
 #include <mutex>
 
 #define HK_LOG_RHI_RESOURCE 1
@@ -28,14 +29,31 @@ enum class ERHIResourceType
     Semaphore,
     Event,
     QueryPool,
+    Surface,
+    SwapChain,
+    Count,
 };
 
+/**
+ * RHI 资源句柄
+ * Id 布局：高 8 位为资源类型，中间 24 位为代数（Generation），低 32 位为池内槽位索引
+ * 槽位被释放后代数加一，旧句柄的 Id 与新句柄不再相等，可以检测到销毁后再使用
+ */
 struct FRHIHandle
 {
     typedef Int64 FID;
     typedef void* FHandleType;
     constexpr static FID INVALID_ID = 0;
 
+    constexpr static UInt32 GENERATION_BITS = 24;
+    constexpr static UInt32 GENERATION_MASK = (1u << GENERATION_BITS) - 1;
+
+    static FID MakeId(ERHIResourceType Type, UInt32 Generation, UInt32 Index)
+    {
+        return static_cast<FID>((static_cast<UInt64>(Type) << 56) |
+                                (static_cast<UInt64>(Generation & GENERATION_MASK) << 32) | Index);
+    }
+
     FID Id = INVALID_ID;
     FHandleType Handle = nullptr;
 
@@ -58,6 +76,21 @@ struct FRHIHandle
         return Id != INVALID_ID && Handle != nullptr;
     }
 
+    ERHIResourceType GetResourceType() const
+    {
+        return static_cast<ERHIResourceType>(static_cast<UInt64>(Id) >> 56);
+    }
+
+    UInt32 GetGeneration() const
+    {
+        return static_cast<UInt32>(static_cast<UInt64>(Id) >> 32) & GENERATION_MASK;
+    }
+
+    UInt32 GetIndex() const
+    {
+        return static_cast<UInt32>(static_cast<UInt64>(Id));
+    }
+
     template <typename T>
     T Cast() const
     {
@@ -71,21 +104,96 @@ struct FRHIHandle
     }
 };
 
+/**
+ * 单一资源类型的句柄池
+ * 槽位按块分配，块一旦分配就不会移动，扩容只需要在锁内追加新块；
+ * 空闲槽位组成无锁栈（头部带版本号防止 ABA），分配与释放都是 O(1) 且不加锁
+ */
+class FRHIHandlePool
+{
+public:
+    constexpr static UInt32 SLOTS_PER_CHUNK = 1024;
+    constexpr static UInt32 MAX_CHUNK_COUNT = 4096;
+
+    FRHIHandlePool() = default;
+    ~FRHIHandlePool();
+
+    FRHIHandlePool(const FRHIHandlePool&)            = delete;
+    FRHIHandlePool& operator=(const FRHIHandlePool&) = delete;
+
+    void SetResourceType(ERHIResourceType InType)
+    {
+        ResourceType = InType;
+    }
+
+    FRHIHandle Allocate(FStringView DebugName, FRHIHandle::FHandleType Handle);
+
+    /**
+     * 释放句柄，句柄的代数与槽位不一致（重复释放或使用已销毁的句柄）时返回 false
+     */
+    bool Free(const FRHIHandle& Handle);
+
+    /**
+     * 句柄是否仍指向一个存活的资源
+     */
+    bool IsAlive(const FRHIHandle& Handle) const;
+
+    UInt32 GetLiveCount() const
+    {
+        return LiveCount.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * 记录所有未释放的句柄，返回数量，只能在没有其他线程访问时调用
+     */
+    UInt32 ReportLeaks() const;
+
+private:
+    struct FSlot
+    {
+        std::atomic<UInt32>     Generation{1};
+        std::atomic<UInt32>     NextFree{0}; // 空闲栈中下一个槽位的索引 + 1，0 表示栈底
+        std::atomic<bool>       bOccupied{false};
+        FRHIHandle::FHandleType Handle = nullptr;
+#if HK_DEBUG
+        FString DebugName;
+#endif
+    };
+
+    FSlot* GetSlot(UInt32 Index) const;
+    UInt32 AllocateSlotIndex();
+    void   PushFree(UInt32 Index);
+    bool   PopFree(UInt32& OutIndex);
+
+    ERHIResourceType ResourceType = ERHIResourceType::Count;
+
+    // 空闲栈头：高 32 位为版本号，低 32 位为槽位索引 + 1
+    std::atomic<UInt64> FreeHead{0};
+    // 从未使用过的下一个槽位
+    std::atomic<UInt32> NextUnusedIndex{0};
+    std::atomic<UInt32> LiveCount{0};
+
+    std::atomic<FSlot*> Chunks[MAX_CHUNK_COUNT] = {};
+    // 只在分配新块时使用
+    std::mutex GrowMutex;
+};
+
 class FRHIHandleManager : public TSingleton<FRHIHandleManager>
 {
 public:
-    constexpr static Int32 MAX_RHI_HANDLE_COUNT = 2048;
+    void StartUp() override;
 
-    Int32 FindFreeIndex() const;
+    FRHIHandle CreateRHIHandle(ERHIResourceType Type, FStringView DebugName, FRHIHandle::FHandleType Handle);
+    void       DestroyRHIHandle(const FRHIHandle& Handle);
 
-    FRHIHandle CreateRHIHandle(FStringView DebugName, FRHIHandle::FHandleType Handle);
-    void DestroyRHIHandle(const FRHIHandle& Handle);
+    /**
+     * 句柄是否仍指向一个存活的资源，用于检测销毁后再使用
+     */
+    bool IsAlive(const FRHIHandle& Handle) const;
 
     // 关闭时记录未被销毁的 Handle
     void ShutDown() override;
 
 private:
-    TFixedArray<FRHIHandle, MAX_RHI_HANDLE_COUNT> RHIHandles;
-    TFixedArray<Bool, MAX_RHI_HANDLE_COUNT> Occupied;
-    mutable std::mutex Mutex;
+    TFixedArray<FRHIHandlePool, static_cast<size_t>(ERHIResourceType::Count)> Pools;
 };
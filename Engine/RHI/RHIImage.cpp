@@ -3,3 +3,98 @@
 //
 
 #include "RHIImage.h"
+
+#include <algorithm>
+
+namespace
+{
+// 每个像素的字节数, D24S8 与 D32S8 按驱动常见的 4 / 8 字节布局计算
+UInt64 GetFormatBytesPerPixel(const ERHIImageFormat Format)
+{
+    // 同一通道布局的格式在枚举中连续排列
+    const auto IsInRange = [](const ERHIImageFormat InFormat, const ERHIImageFormat First, const ERHIImageFormat Last) {
+        return static_cast<UInt32>(InFormat) >= static_cast<UInt32>(First) &&
+               static_cast<UInt32>(InFormat) <= static_cast<UInt32>(Last);
+    };
+    if (IsInRange(Format, ERHIImageFormat::R8G8B8A8_UNorm, ERHIImageFormat::B8G8R8A8_SRGB))
+    {
+        return 4;
+    }
+    if (IsInRange(Format, ERHIImageFormat::R8G8B8_UNorm, ERHIImageFormat::R8G8B8_SRGB))
+    {
+        return 3;
+    }
+    if (IsInRange(Format, ERHIImageFormat::R8_UNorm, ERHIImageFormat::R8_SInt))
+    {
+        return 1;
+    }
+    if (IsInRange(Format, ERHIImageFormat::R16_UNorm, ERHIImageFormat::R16_SFloat))
+    {
+        return 2;
+    }
+    if (IsInRange(Format, ERHIImageFormat::R16G16_UNorm, ERHIImageFormat::R16G16_SFloat))
+    {
+        return 4;
+    }
+    if (IsInRange(Format, ERHIImageFormat::R16G16B16_UNorm, ERHIImageFormat::R16G16B16_SFloat))
+    {
+        return 6;
+    }
+    if (IsInRange(Format, ERHIImageFormat::R16G16B16A16_UNorm, ERHIImageFormat::R16G16B16A16_SFloat))
+    {
+        return 8;
+    }
+    if (IsInRange(Format, ERHIImageFormat::R32_UInt, ERHIImageFormat::R32_SFloat))
+    {
+        return 4;
+    }
+    if (IsInRange(Format, ERHIImageFormat::R32G32_UInt, ERHIImageFormat::R32G32_SFloat))
+    {
+        return 8;
+    }
+    if (IsInRange(Format, ERHIImageFormat::R32G32B32_UInt, ERHIImageFormat::R32G32B32_SFloat))
+    {
+        return 12;
+    }
+    if (IsInRange(Format, ERHIImageFormat::R32G32B32A32_UInt, ERHIImageFormat::R32G32B32A32_SFloat))
+    {
+        return 16;
+    }
+
+    switch (Format)
+    {
+        case ERHIImageFormat::D16_UNorm:
+            return 2;
+        case ERHIImageFormat::D32_SFloat:
+            return 4;
+        case ERHIImageFormat::S8_UInt:
+            return 1;
+        case ERHIImageFormat::D16_UNorm_S8_UInt:
+            return 4;
+        case ERHIImageFormat::D24_UNorm_S8_UInt:
+            return 4;
+        case ERHIImageFormat::D32_SFloat_S8_UInt:
+            return 8;
+        default:
+            return 0;
+    }
+}
+} // namespace
+
+UInt64 FRHIImage::GetMemorySize() const
+{
+    const UInt64 BytesPerPixel = GetFormatBytesPerPixel(Format);
+    UInt64       Width         = static_cast<UInt64>(std::max(Extent.X, 1));
+    UInt64       Height        = static_cast<UInt64>(std::max(Extent.Y, 1));
+    UInt64       Depth         = static_cast<UInt64>(std::max(Extent.Z, 1));
+
+    UInt64 MipBytes = 0;
+    for (UInt32 Mip = 0; Mip < std::max(MipLevels, 1u); ++Mip)
+    {
+        MipBytes += Width * Height * Depth * BytesPerPixel;
+        Width  = std::max<UInt64>(Width / 2, 1);
+        Height = std::max<UInt64>(Height / 2, 1);
+        Depth  = std::max<UInt64>(Depth / 2, 1);
+    }
+    return MipBytes * std::max(ArrayLayers, 1u) * static_cast<UInt64>(Samples);
+}
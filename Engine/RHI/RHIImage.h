@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Core/Memory/MemoryStats.h"
 #include "Core/Reflection/Reflection.h"
 #include "Core/String/String.h"
 #include "Core/Utility/HashUtility.h"
@@ -224,6 +225,7 @@ class FRHIImage
 {
     friend class FGfxDevice;
     friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
 
 public:
     // 默认构造：创建空的 Image（无效）
@@ -297,6 +299,15 @@ public:
         return Usage;
     }
 
+    // 获取显存统计的分类
+    EMemoryTag GetMemoryTag() const
+    {
+        return MemoryTag;
+    }
+
+    // 按格式、尺寸、Mip、层数与采样数估算的显存大小, 不含驱动的对齐与压缩
+    UInt64 GetMemorySize() const;
+
     operator bool() const
     {
         return IsValid();
@@ -327,4 +338,5 @@ private:
     UInt32          ArrayLayers = 0;
     ERHISampleCount Samples     = ERHISampleCount::Sample1;
     ERHIImageUsage  Usage       = ERHIImageUsage::None;
+    EMemoryTag      MemoryTag   = EMemoryTag::Untagged; // 创建时记入的分类, 销毁时按同一分类扣除
 };
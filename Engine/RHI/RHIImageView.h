@@ -36,6 +36,7 @@ class FRHIImageView
 {
     friend class FGfxDevice;
     friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
 
 public:
     // 默认构造：创建空的 ImageView（无效）
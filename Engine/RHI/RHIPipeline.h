@@ -29,6 +29,7 @@ class FRHIShaderModule
 {
     friend class FGfxDevice;
     friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
 
 public:
     // 默认构造：创建空的 ShaderModule（无效）
@@ -122,6 +123,7 @@ class FRHIPipelineLayout
 {
     friend class FGfxDevice;
     friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
 
 public:
     // 默认构造：创建空的 PipelineLayout（无效）
@@ -653,6 +655,7 @@ class FRHIPipeline
 {
     friend class FGfxDevice;
     friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
 
 public:
     // 默认构造：创建空的 Pipeline（无效）
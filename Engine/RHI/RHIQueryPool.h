@@ -0,0 +1,135 @@
+#pragma once
+
+#include "Core/String/String.h"
+#include "Core/Utility/HashUtility.h"
+#include "Core/Utility/Macros.h"
+#include "RHIHandle.h"
+
+#include <bit>
+
+// 查询类型
+enum class ERHIQueryType : UInt32
+{
+    Timestamp          = 0, // 时间戳查询, 每个查询一个 UInt64 结果（GPU 时钟周期）
+    PipelineStatistics = 1, // 管线统计查询, 每个查询的结果数等于启用的统计项数量
+    Occlusion          = 2, // 遮挡查询, 每个查询一个 UInt64 结果（通过深度测试的样本数）
+};
+
+// 管线统计项（对应 Vulkan 的 VkQueryPipelineStatisticFlags）
+// 结果按位从低到高的顺序排列
+enum class ERHIPipelineStatisticFlag : UInt32
+{
+    None                      = 0,
+    InputAssemblyVertices     = 1 << 0,  // 输入装配读取的顶点数
+    InputAssemblyPrimitives   = 1 << 1,  // 输入装配读取的图元数
+    VertexShaderInvocations   = 1 << 2,  // 顶点着色器调用次数
+    ClippingInvocations       = 1 << 5,  // 进入裁剪阶段的图元数
+    ClippingPrimitives        = 1 << 6,  // 裁剪后输出的图元数
+    FragmentShaderInvocations = 1 << 7,  // 片元着色器调用次数
+    ComputeShaderInvocations  = 1 << 10, // 计算着色器调用次数
+};
+HK_ENABLE_BITMASK_OPERATORS(ERHIPipelineStatisticFlag)
+
+struct FRHIQueryPoolDesc
+{
+    ERHIQueryType             Type               = ERHIQueryType::Timestamp;       // 查询类型
+    UInt32                    QueryCount         = 0;                              // 查询数量
+    ERHIPipelineStatisticFlag PipelineStatistics = ERHIPipelineStatisticFlag::None; // 仅用于管线统计查询
+    FString                   DebugName;                                           // 调试名称
+
+    UInt64 GetHashCode() const
+    {
+        return FHashUtility::CombineHashes(std::hash<UInt32>{}(static_cast<UInt32>(Type)),
+                                           std::hash<UInt32>{}(QueryCount),
+                                           std::hash<UInt32>{}(static_cast<UInt32>(PipelineStatistics)));
+    }
+};
+
+// 查询池类
+// 查询结果由 GPU 写入, 通过 FGfxDevice::GetQueryPoolResults 非阻塞地读回
+class FRHIQueryPool
+{
+    friend class FGfxDevice;
+    friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
+
+public:
+    // 默认构造：创建空的 QueryPool（无效）
+    FRHIQueryPool() = default;
+
+    // 析构函数：不自动销毁资源，必须通过 FGfxDevice::DestroyQueryPool 销毁
+    ~FRHIQueryPool() = default;
+
+    // 允许拷贝和移动
+    FRHIQueryPool(const FRHIQueryPool& Other)                = default;
+    FRHIQueryPool& operator=(const FRHIQueryPool& Other)     = default;
+    FRHIQueryPool(FRHIQueryPool&& Other) noexcept            = default;
+    FRHIQueryPool& operator=(FRHIQueryPool&& Other) noexcept = default;
+
+    // 检查是否有效
+    bool IsValid() const
+    {
+        return Handle.IsValid();
+    }
+
+    // 获取底层句柄
+    const FRHIHandle& GetHandle() const
+    {
+        return Handle;
+    }
+
+    FRHIHandle& GetHandle()
+    {
+        return Handle;
+    }
+
+    ERHIQueryType GetType() const
+    {
+        return Type;
+    }
+
+    UInt32 GetQueryCount() const
+    {
+        return QueryCount;
+    }
+
+    ERHIPipelineStatisticFlag GetPipelineStatistics() const
+    {
+        return PipelineStatistics;
+    }
+
+    // 每个查询的结果数量
+    UInt32 GetResultCountPerQuery() const
+    {
+        return Type == ERHIQueryType::PipelineStatistics
+                   ? static_cast<UInt32>(std::popcount(static_cast<UInt32>(PipelineStatistics)))
+                   : 1;
+    }
+
+    operator bool() const
+    {
+        return IsValid();
+    }
+
+    // 比较操作符
+    bool operator==(const FRHIQueryPool& Other) const
+    {
+        return Handle == Other.Handle;
+    }
+
+    bool operator!=(const FRHIQueryPool& Other) const
+    {
+        return Handle != Other.Handle;
+    }
+
+    UInt64 GetHashCode() const
+    {
+        return Handle.GetHashCode();
+    }
+
+private:
+    FRHIHandle                Handle;
+    ERHIQueryType             Type               = ERHIQueryType::Timestamp;
+    UInt32                    QueryCount         = 0;
+    ERHIPipelineStatisticFlag PipelineStatistics = ERHIPipelineStatisticFlag::None;
+};
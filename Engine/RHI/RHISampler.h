@@ -82,6 +82,7 @@ class FRHISampler
 {
     friend class FGfxDevice;
     friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
 
 public:
     // 默认构造：创建空的 Sampler（无效）
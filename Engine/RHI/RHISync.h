@@ -32,6 +32,7 @@ class FRHISemaphore
 {
     friend class FGfxDevice;
     friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
 
 public:
     // 默认构造：创建空的 Semaphore（无效）
@@ -119,6 +120,7 @@ class FRHIFence
 {
     friend class FGfxDevice;
     friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
 
 public:
     // 默认构造：创建空的 Fence（无效）
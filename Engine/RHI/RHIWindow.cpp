@@ -142,8 +142,10 @@ void FRHIWindowManager::PollAllWindowInput()
     HK_PROFILE_SCOPE();
     // 处理所有 SDL 事件
     SDL_Event Event;
-    SDL_PollEvent(&Event);
-    HandleSDLEvent(Event, GetRef().Windows.Data());
+    if (SDL_PollEvent(&Event))
+    {
+        HandleSDLEvent(Event, GetRef().Windows.Data());
+    }
 }
 
 void FRHIWindow::Open()
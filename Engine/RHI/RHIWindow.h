@@ -125,6 +125,7 @@ class FRHIWindowManager : public TSingleton<FRHIWindowManager>
 {
     friend class FGfxDevice;
     friend class FGfxDeviceVk;
+    friend class FGfxDeviceNull;
 
     typedef TFixedArray<TUniquePtr<FRHIWindow>, MAX_RHI_WINDOW_COUNT> FRHIWindowArray;
 
@@ -16,6 +16,7 @@
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_version.h>
 #include <SDL3/SDL_vulkan.h>
+#include <algorithm>
 #include <set>
 #include <stdexcept>
 #include <vulkan/vulkan.h>
@@ -151,7 +152,8 @@ void FGfxDeviceVk::CreateMainWindowAndSurface(const FName MainWindowName, FVecto
 
     // 创建RHI Handle
     auto&            HandleManager    = FRHIHandleManager::GetRef();
-    const FRHIHandle SurfaceRHIHandle = HandleManager.CreateRHIHandle("MainWindowSurface", (SurfaceHandle));
+    const FRHIHandle SurfaceRHIHandle = HandleManager.CreateRHIHandle(
+        ERHIResourceType::Surface, "MainWindowSurface", (SurfaceHandle));
 
     // 设置窗口信息（通过窗口管理器访问）
     if (!WindowManager.Windows[0])
@@ -373,7 +375,8 @@ void FGfxDeviceVk::CreateMainWindowSwapChain(FRHIWindow& OutMainWindow)
     // 创建RHI Handle
     auto&      HandleManager      = FRHIHandleManager::GetRef();
     FRHIHandle SwapChainRHIHandle = HandleManager.CreateRHIHandle(
-        "MainWindowSwapChain", reinterpret_cast<void*>(static_cast<VkSwapchainKHR>(SwapChain)));
+        ERHIResourceType::SwapChain, "MainWindowSwapChain",
+        reinterpret_cast<void*>(static_cast<VkSwapchainKHR>(SwapChain)));
 
     // 更新窗口的SwapChain
     OutMainWindow.GetSwapChain().Handle = SwapChainRHIHandle;
@@ -429,7 +432,8 @@ void FGfxDeviceVk::CreateMainWindowSwapChain(FRHIWindow& OutMainWindow)
 
         // 创建RHI ImageView
         FString    ViewDebugName = std::format("MainWindowSwapChainImageView_{}", i);
-        FRHIHandle ViewHandle    = HandleManager.CreateRHIHandle(ViewDebugName.CStr(), MyVkImageView);
+        FRHIHandle ViewHandle    = HandleManager.CreateRHIHandle(
+            ERHIResourceType::ImageView, ViewDebugName.CStr(), MyVkImageView);
 
         FRHIImageView RHIImageView;
         RHIImageView.Handle = ViewHandle;
@@ -501,7 +505,8 @@ void FGfxDeviceVk::CreateRHIWindow(const FName Name, const FVector2i Size, FRHIW
     auto&      HandleManager    = FRHIHandleManager::GetRef();
     FString    SurfaceDebugName = FString("WindowSurface_") + FString(std::to_string(FreeIndex).c_str());
     FRHIHandle SurfaceRHIHandle =
-        HandleManager.CreateRHIHandle(SurfaceDebugName.CStr(), reinterpret_cast<void*>(SurfaceHandle));
+        HandleManager.CreateRHIHandle(
+            ERHIResourceType::Surface, SurfaceDebugName.CStr(), reinterpret_cast<void*>(SurfaceHandle));
 
     // 创建窗口对象
     WindowManager.Windows[FreeIndex] = MakeUnique<FRHIWindow>();
@@ -710,7 +715,8 @@ void FGfxDeviceVk::CreateRHIWindow(const FName Name, const FVector2i Size, FRHIW
     // 创建SwapChain RHI Handle
     FString    SwapChainDebugName = FString("WindowSwapChain_") + FString(std::to_string(FreeIndex).c_str());
     FRHIHandle SwapChainRHIHandle = HandleManager.CreateRHIHandle(
-        SwapChainDebugName.CStr(), reinterpret_cast<void*>(static_cast<VkSwapchainKHR>(SwapChain)));
+        ERHIResourceType::SwapChain, SwapChainDebugName.CStr(),
+        reinterpret_cast<void*>(static_cast<VkSwapchainKHR>(SwapChain)));
 
     // 更新窗口的SwapChain
     Window->SetSwapChain(FRHISwapChain{SwapChainRHIHandle});
@@ -1186,17 +1192,27 @@ void FGfxDeviceVk::CreateDevice()
 
     // 设备特性（使用Features2以支持扩展特性）
     vk::PhysicalDeviceFeatures2 DeviceFeatures2;
-    DeviceFeatures2.features.samplerAnisotropy = VK_TRUE; // 启用各向异性采样
-
-    // 缓冲区设备地址特性
-    vk::PhysicalDeviceBufferDeviceAddressFeatures BufferDeviceAddressFeatures;
-    BufferDeviceAddressFeatures.bufferDeviceAddress = VK_TRUE;
-
-    // 描述符索引特性（用于bindless）
-    vk::PhysicalDeviceDescriptorIndexingFeatures DescriptorIndexingFeatures;
-    DescriptorIndexingFeatures.runtimeDescriptorArray                   = VK_TRUE;
-    DescriptorIndexingFeatures.descriptorBindingPartiallyBound          = VK_TRUE;
-    DescriptorIndexingFeatures.descriptorBindingVariableDescriptorCount = VK_TRUE;
+    DeviceFeatures2.features.samplerAnisotropy       = VK_TRUE; // 启用各向异性采样
+    DeviceFeatures2.features.multiDrawIndirect       = VK_TRUE; // 一次间接绘制调用提交多个绘制命令
+    DeviceFeatures2.features.pipelineStatisticsQuery = VK_TRUE; // GPU 性能分析的管线统计查询
+
+    // Vulkan 1.2 特性，核心特性必须通过这一个结构体开启，不能与对应的独立特性结构体同时出现在链中
+    vk::PhysicalDeviceVulkan12Features Vulkan12Features;
+    // 缓冲区设备地址
+    Vulkan12Features.bufferDeviceAddress = VK_TRUE;
+    // 描述符索引（用于bindless）
+    Vulkan12Features.descriptorIndexing                       = VK_TRUE;
+    Vulkan12Features.runtimeDescriptorArray                   = VK_TRUE;
+    Vulkan12Features.descriptorBindingPartiallyBound          = VK_TRUE;
+    Vulkan12Features.descriptorBindingVariableDescriptorCount = VK_TRUE;
+    // bindless 纹理表与采样器表在绑定后批量更新
+    Vulkan12Features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+    Vulkan12Features.descriptorBindingUpdateUnusedWhilePending    = VK_TRUE;
+    Vulkan12Features.shaderSampledImageArrayNonUniformIndexing    = VK_TRUE;
+    // 时间线信号量
+    Vulkan12Features.timelineSemaphore = VK_TRUE;
+    // GPU 剔除后由 GPU 写入绘制数量
+    Vulkan12Features.drawIndirectCount = VK_TRUE;
 
     // 网格着色器特性
     vk::PhysicalDeviceMeshShaderFeaturesEXT MeshShaderFeatures;
@@ -1207,10 +1223,6 @@ void FGfxDeviceVk::CreateDevice()
     vk::PhysicalDeviceRayTracingPipelineFeaturesKHR RayTracingFeatures;
     RayTracingFeatures.rayTracingPipeline = VK_TRUE;
 
-    // 时间线信号量特性
-    vk::PhysicalDeviceTimelineSemaphoreFeatures TimelineSemaphoreFeatures;
-    TimelineSemaphoreFeatures.timelineSemaphore = VK_TRUE;
-
     // 同步2.0特性
     vk::PhysicalDeviceSynchronization2Features Synchronization2Features;
     Synchronization2Features.synchronization2 = VK_TRUE;
@@ -1220,13 +1232,11 @@ void FGfxDeviceVk::CreateDevice()
     DynamicRenderingFeatures.dynamicRendering = VK_TRUE;
 
     // 链式连接特性结构体
-    DeviceFeatures2.pNext             = &Synchronization2Features;
-    Synchronization2Features.pNext    = &BufferDeviceAddressFeatures;
-    BufferDeviceAddressFeatures.pNext = &DescriptorIndexingFeatures;
-    DescriptorIndexingFeatures.pNext  = &MeshShaderFeatures;
-    MeshShaderFeatures.pNext          = &RayTracingFeatures;
-    RayTracingFeatures.pNext          = &TimelineSemaphoreFeatures;
-    TimelineSemaphoreFeatures.pNext   = &DynamicRenderingFeatures;
+    DeviceFeatures2.pNext          = &Synchronization2Features;
+    Synchronization2Features.pNext = &Vulkan12Features;
+    Vulkan12Features.pNext         = &MeshShaderFeatures;
+    MeshShaderFeatures.pNext       = &RayTracingFeatures;
+    RayTracingFeatures.pNext       = &DynamicRenderingFeatures;
 
     // 创建设备创建信息
     vk::DeviceCreateInfo CreateInfo;
@@ -1246,6 +1256,17 @@ void FGfxDeviceVk::CreateDevice()
         Device = PhysicalDevice.createDevice(CreateInfo);
         HK_LOG_INFO(ELogcat::RHI, "Vulkan逻辑设备创建成功");
 
+        TimestampPeriod = PhysicalDevice.getProperties().limits.timestampPeriod;
+
+        // bindless 数组同时受整个描述符集与单个着色器阶段的上限约束
+        const auto PropertiesChain = PhysicalDevice.getProperties2<vk::PhysicalDeviceProperties2,
+                                                                   vk::PhysicalDeviceDescriptorIndexingProperties>();
+        const auto& Indexing            = PropertiesChain.get<vk::PhysicalDeviceDescriptorIndexingProperties>();
+        BindlessLimits.MaxSampledImages = std::min(Indexing.maxDescriptorSetUpdateAfterBindSampledImages,
+                                                   Indexing.maxPerStageDescriptorUpdateAfterBindSampledImages);
+        BindlessLimits.MaxSamplers      = std::min(Indexing.maxDescriptorSetUpdateAfterBindSamplers,
+                                                   Indexing.maxPerStageDescriptorUpdateAfterBindSamplers);
+
         // 获取队列
         GraphicsQueue = Device.getQueue(static_cast<uint32_t>(QueueFamilyIndices.GraphicsFamily), 0);
         PresentQueue  = Device.getQueue(static_cast<uint32_t>(QueueFamilyIndices.PresentFamily), 0);
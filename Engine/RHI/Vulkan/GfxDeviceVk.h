@@ -2,6 +2,7 @@
 
 #include "Core/Container/Array.h"
 #include "Core/String/String.h"
+#include "Core/Utility/Profiler.h"
 #include "RHI/GfxDevice.h"
 #include "RHI/RHIBuffer.h"
 #include "RHI/RHICommand.h"
@@ -11,6 +12,7 @@
 #include "RHI/RHIImage.h"
 #include "RHI/RHIImageView.h"
 #include "RHI/RHIPipeline.h"
+#include "RHI/RHIQueryPool.h"
 #include "RHI/RHISampler.h"
 #include "RHI/RHISync.h"
 #include "RHI/RHIWindow.h"
@@ -51,6 +53,7 @@ public:
     void FreeDescriptorSet(const FRHIDescriptorPool& Pool, FRHIDescriptorSet& DescriptorSet) override;
     void UpdateDescriptorSet(const FRHIDescriptorSet& DescriptorSet,
                              const TArray<FRHIWriteDescriptorSet>& WriteDescriptorSets) override;
+    FRHIBindlessLimits GetBindlessLimits() const override;
 #pragma endregion
 
 #pragma region Pipeline操作
@@ -74,6 +77,14 @@ public:
     bool ResetFence(const FRHIFence& Fence) override;
 #pragma endregion
 
+#pragma region Query操作
+    FRHIQueryPool CreateQueryPool(const FRHIQueryPoolDesc& QueryPoolCreateInfo) override;
+    void          DestroyQueryPool(FRHIQueryPool& QueryPool) override;
+    bool          GetQueryPoolResults(const FRHIQueryPool& QueryPool, UInt32 FirstQuery, UInt32 QueryCount,
+                                      TArray<UInt64>& OutResults) override;
+    double        GetTimestampPeriod() const override;
+#pragma endregion
+
 #pragma region CommandPool操作
     FRHICommandPool CreateCommandPool(const FRHICommandPoolDesc& PoolCreateInfo) override;
     void DestroyCommandPool(FRHICommandPool& CommandPool) override;
@@ -252,6 +263,13 @@ private:
      */
     static vk::DescriptorPoolCreateFlags ConvertDescriptorPoolCreateFlags(ERHIDescriptorPoolCreateFlag Flags);
 
+    /**
+     * 转换 ERHIDescriptorBindingFlag 到 VkDescriptorBindingFlags
+     * @param Flags 描述符绑定标志
+     * @return Vulkan 描述符绑定标志
+     */
+    static vk::DescriptorBindingFlags ConvertDescriptorBindingFlags(ERHIDescriptorBindingFlag Flags);
+
     /**
      * 转换 ERHIShaderStage 到 VkShaderStageFlagBits
      * @param Stage 着色器阶段
@@ -380,12 +398,19 @@ private:
     void SetDebugName(vk::Fence ObjectHandle, vk::ObjectType ObjectType, const FStringView& Name) const;
     void SetDebugName(vk::CommandPool ObjectHandle, vk::ObjectType ObjectType, const FStringView& Name) const;
     void SetDebugName(vk::CommandBuffer ObjectHandle, vk::ObjectType ObjectType, const FStringView& Name) const;
+    void SetDebugName(vk::QueryPool ObjectHandle, vk::ObjectType ObjectType, const FStringView& Name) const;
 
     /**
      * 转换命令缓冲区使用标志到 Vulkan 标志
      */
     static vk::CommandBufferUsageFlags ConvertCommandBufferUsageFlags(ERHICommandBufferUsageFlag Flags);
 
+    /**
+     * 转换查询类型和管线统计项到 Vulkan 类型
+     */
+    static vk::QueryType                   ConvertQueryType(ERHIQueryType Type);
+    static vk::QueryPipelineStatisticFlags ConvertPipelineStatisticFlags(ERHIPipelineStatisticFlag Flags);
+
     // SwapChain数据结构
     struct FSwapChainData
     {
@@ -404,7 +429,13 @@ private:
     vk::SurfaceKHR MainWindowSurface;
     vk::Queue GraphicsQueue;
     vk::Queue PresentQueue;
+    // vkQueueSubmit / vkQueuePresentKHR 需要外部同步，资产上传与帧提交可能来自不同线程
+    HK_PROFILE_LOCKABLE(std::mutex, QueueMutex);
     FQueueFamilyIndices QueueFamilyIndices;
+    // 时间戳每个时钟周期对应的纳秒数, 创建Device时从物理设备属性读取
+    double TimestampPeriod = 1.0;
+    // bindless 描述符数组的上限, 创建Device时从物理设备的描述符索引属性读取
+    FRHIBindlessLimits BindlessLimits;
     bool bValidationLayersEnabled = false;
     bool bDebugUtilsExtensionAvailable = false;                              // Debug Utils扩展是否可用
     PFN_vkSetDebugUtilsObjectNameEXT vkSetDebugUtilsObjectNameEXT = nullptr; // 缓存的Debug Utils函数指针
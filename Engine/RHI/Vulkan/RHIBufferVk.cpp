@@ -132,7 +132,8 @@ FRHIBuffer FGfxDeviceVk::CreateBuffer(const FRHIBufferDesc& BufferCreateInfo)
 
     auto& HandleManager = FRHIHandleManager::GetRef();
     const FString DebugNameStr = BufferCreateInfo.DebugName.IsEmpty() ? FString("Buffer") : BufferCreateInfo.DebugName;
-    const FRHIHandle BufferHandle = HandleManager.CreateRHIHandle(DebugNameStr.CStr(), BufferData);
+    const FRHIHandle BufferHandle = HandleManager.CreateRHIHandle(
+        ERHIResourceType::Buffer, DebugNameStr.CStr(), BufferData);
 
     // 创建并返回 FRHIBuffer
     FRHIBuffer Buffer;
@@ -140,6 +141,7 @@ FRHIBuffer FGfxDeviceVk::CreateBuffer(const FRHIBufferDesc& BufferCreateInfo)
     Buffer.Size = BufferCreateInfo.Size;
     Buffer.Usage = BufferCreateInfo.Usage;
     Buffer.MemoryProperty = BufferCreateInfo.MemoryProperty;
+    TrackBufferMemory(Buffer);
 
     HK_LOG_INFO(ELogcat::RHI, "Buffer创建成功: {} (大小: {} 字节)", DebugNameStr.CStr(), BufferCreateInfo.Size);
     return Buffer;
@@ -220,6 +222,7 @@ void FGfxDeviceVk::DestroyBuffer(FRHIBuffer& Buffer)
         HandleManager.DestroyRHIHandle(Buffer.GetHandle());
 
         // 清空 Buffer
+        UntrackBufferMemory(Buffer);
         Buffer = FRHIBuffer();
 
         HK_LOG_INFO(ELogcat::RHI, "Buffer已销毁");
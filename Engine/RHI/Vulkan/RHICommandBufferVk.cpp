@@ -2,6 +2,7 @@
 // Created by Admin on 2025/12/27.
 //
 
+#include "Core/Container/InlineArray.h"
 #include "Core/Logging/Logger.h"
 #include "Core/Utility/Macros.h"
 #include "GfxDeviceVk.h"
@@ -10,6 +11,7 @@
 #include "RHI/RHICommandPool.h"
 #include "RHI/RHIImageView.h"
 #include "RHI/RHISync.h"
+#include <bit>
 #include <vector>
 
 // ============================================================================
@@ -49,7 +51,8 @@ FRHICommandBuffer FGfxDeviceVk::CreateCommandBuffer(const FRHICommandPool&
 
     // 创建 RHI Handle（转换为 C 类型存储）
     CmdBuffer.Handle = FRHIHandleManager::GetRef().CreateRHIHandle(
-        CommandBufferCreateInfo.DebugName, reinterpret_cast<void*>(static_cast<VkCommandBuffer>(VkCmdBuffer)));
+        ERHIResourceType::CommandBuffer, CommandBufferCreateInfo.DebugName,
+        reinterpret_cast<void*>(static_cast<VkCommandBuffer>(VkCmdBuffer)));
     CmdBuffer.Level = CommandBufferCreateInfo.Level;
 
     // 设置调试名称
@@ -164,10 +167,10 @@ void FGfxDeviceVk::ExecuteCommand(FRHICommandBuffer& CommandBuffer, const FRHICo
 
         case ERHICommandType::BindDescriptorSets:
         {
-            const auto&               Cmd      = static_cast<const FRHICommand_BindDescriptorSets&>(Command);
-            auto                      Layout   = Cmd.Layout.GetHandle().Cast<VkPipelineLayout>();
-            auto                      VkLayout = vk::PipelineLayout(Layout);
-            TArray<vk::DescriptorSet> VkSets;
+            const auto&                        Cmd      = static_cast<const FRHICommand_BindDescriptorSets&>(Command);
+            auto                               Layout   = Cmd.Layout.GetHandle().Cast<VkPipelineLayout>();
+            auto                               VkLayout = vk::PipelineLayout(Layout);
+            TInlineArray<vk::DescriptorSet, 8> VkSets;
             VkSets.Reserve(Cmd.DescriptorSets.Size());
             for (const auto& Set : Cmd.DescriptorSets)
             {
@@ -250,6 +253,18 @@ void FGfxDeviceVk::ExecuteCommand(FRHICommandBuffer& CommandBuffer, const FRHICo
             break;
         }
 
+        case ERHICommandType::DrawIndexedIndirectCount:
+        {
+            const auto& Cmd           = static_cast<const FRHICommand_DrawIndexedIndirectCount&>(Command);
+            auto        Buffer        = Cmd.Buffer.GetHandle().Cast<VkBuffer>();
+            auto        VkBuffer      = vk::Buffer(Buffer);
+            auto        CountBuffer   = Cmd.CountBuffer.GetHandle().Cast<VkBuffer>();
+            auto        VkCountBuffer = vk::Buffer(CountBuffer);
+            VkCmdBuffer.drawIndexedIndirectCount(VkBuffer, Cmd.Offset, VkCountBuffer, Cmd.CountOffset,
+                                                 Cmd.MaxDrawCount, Cmd.Stride);
+            break;
+        }
+
         case ERHICommandType::Dispatch:
         {
             const auto& Cmd = static_cast<const FRHICommand_Dispatch&>(Command);
@@ -268,12 +283,12 @@ void FGfxDeviceVk::ExecuteCommand(FRHICommandBuffer& CommandBuffer, const FRHICo
 
         case ERHICommandType::CopyBuffer:
         {
-            const auto&            Cmd         = static_cast<const FRHICommand_CopyBuffer&>(Command);
-            auto                   SrcBuffer   = Cmd.SrcBuffer.GetHandle().Cast<VkBuffer>();
-            auto                   VkSrcBuffer = vk::Buffer(SrcBuffer);
-            auto                   DstBuffer   = Cmd.DstBuffer.GetHandle().Cast<VkBuffer>();
-            auto                   VkDstBuffer = vk::Buffer(DstBuffer);
-            TArray<vk::BufferCopy> VkRegions;
+            const auto&                     Cmd         = static_cast<const FRHICommand_CopyBuffer&>(Command);
+            auto                            SrcBuffer   = Cmd.SrcBuffer.GetHandle().Cast<VkBuffer>();
+            auto                            VkSrcBuffer = vk::Buffer(SrcBuffer);
+            auto                            DstBuffer   = Cmd.DstBuffer.GetHandle().Cast<VkBuffer>();
+            auto                            VkDstBuffer = vk::Buffer(DstBuffer);
+            TInlineArray<vk::BufferCopy, 4> VkRegions;
             VkRegions.Reserve(Cmd.Regions.Size());
             for (const auto& Region : Cmd.Regions)
             {
@@ -284,6 +299,15 @@ void FGfxDeviceVk::ExecuteCommand(FRHICommandBuffer& CommandBuffer, const FRHICo
             break;
         }
 
+        case ERHICommandType::FillBuffer:
+        {
+            const auto& Cmd      = static_cast<const FRHICommand_FillBuffer&>(Command);
+            auto        Buffer   = Cmd.Buffer.GetHandle().Cast<VkBuffer>();
+            auto        VkBuffer = vk::Buffer(Buffer);
+            VkCmdBuffer.fillBuffer(VkBuffer, Cmd.Offset, Cmd.Size, Cmd.Data);
+            break;
+        }
+
         case ERHICommandType::SetViewport:
         {
             const auto&          Cmd = static_cast<const FRHICommand_SetViewport&>(Command);
@@ -776,6 +800,40 @@ void FGfxDeviceVk::ExecuteCommand(FRHICommandBuffer& CommandBuffer, const FRHICo
             break;
         }
 
+        case ERHICommandType::ResetQueryPool:
+        {
+            const auto& Cmd = static_cast<const FRHICommand_ResetQueryPool&>(Command);
+            VkCmdBuffer.resetQueryPool(vk::QueryPool(Cmd.QueryPool.GetHandle().Cast<VkQueryPool>()), Cmd.FirstQuery,
+                                       Cmd.QueryCount);
+            break;
+        }
+
+        case ERHICommandType::WriteTimestamp:
+        {
+            const auto& Cmd = static_cast<const FRHICommand_WriteTimestamp&>(Command);
+            // 单个阶段的时间戳, 取掩码中最高的阶段
+            const auto Stages = static_cast<VkPipelineStageFlags>(ConvertPipelineStageFlags(Cmd.Stage));
+            const auto Stage  = Stages == 0 ? vk::PipelineStageFlagBits::eBottomOfPipe
+                                            : static_cast<vk::PipelineStageFlagBits>(std::bit_floor(Stages));
+            VkCmdBuffer.writeTimestamp(Stage, vk::QueryPool(Cmd.QueryPool.GetHandle().Cast<VkQueryPool>()), Cmd.Query);
+            break;
+        }
+
+        case ERHICommandType::BeginQuery:
+        {
+            const auto& Cmd = static_cast<const FRHICommand_BeginQuery&>(Command);
+            VkCmdBuffer.beginQuery(vk::QueryPool(Cmd.QueryPool.GetHandle().Cast<VkQueryPool>()), Cmd.Query,
+                                   vk::QueryControlFlags());
+            break;
+        }
+
+        case ERHICommandType::EndQuery:
+        {
+            const auto& Cmd = static_cast<const FRHICommand_EndQuery&>(Command);
+            VkCmdBuffer.endQuery(vk::QueryPool(Cmd.QueryPool.GetHandle().Cast<VkQueryPool>()), Cmd.Query);
+            break;
+        }
+
         default:
         {
             HK_LOG_WARN(ELogcat::RHI, "Unimplemented command type: {}", static_cast<UInt32>(Command.CommandType));
@@ -884,6 +942,7 @@ bool FGfxDeviceVk::SubmitCommandBuffer(FRHICommandBuffer& CommandBuffer, const T
     // 提交到图形队列
     try
     {
+        AutoLock   Lock(QueueMutex);
         vk::Result Result = GraphicsQueue.submit(1, &SubmitInfo, MyFence);
         if (Result != vk::Result::eSuccess)
         {
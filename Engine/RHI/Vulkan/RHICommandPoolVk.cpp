@@ -37,7 +37,8 @@ FRHICommandPool FGfxDeviceVk::CreateCommandPool(const FRHICommandPoolDesc& PoolC
 
     // 创建 RHI Handle（转换为 C 类型存储）
     Pool.Handle           = FRHIHandleManager::GetRef().CreateRHIHandle(
-        PoolCreateInfo.DebugName, reinterpret_cast<void*>(static_cast<VkCommandPool>(VkPool)));
+        ERHIResourceType::CommandPool, PoolCreateInfo.DebugName,
+        reinterpret_cast<void*>(static_cast<VkCommandPool>(VkPool)));
     Pool.QueueFamilyIndex = PoolCreateInfo.QueueFamilyIndex;
 
     // 设置调试名称
@@ -19,7 +19,11 @@ FRHIDescriptorSetLayout FGfxDeviceVk::CreateDescriptorSetLayout(const FRHIDescri
     {
         // 转换绑定数组
         TArray<vk::DescriptorSetLayoutBinding> VulkanBindings;
+        TArray<vk::DescriptorBindingFlags>     VulkanBindingFlags;
         VulkanBindings.Reserve(LayoutCreateInfo.Bindings.Size());
+        VulkanBindingFlags.Reserve(LayoutCreateInfo.Bindings.Size());
+        bool bHasBindingFlags    = false;
+        bool bHasUpdateAfterBind = false;
 
         for (const auto& Binding : LayoutCreateInfo.Bindings)
         {
@@ -30,6 +34,10 @@ FRHIDescriptorSetLayout FGfxDeviceVk::CreateDescriptorSetLayout(const FRHIDescri
             VulkanBinding.stageFlags = ConvertShaderStageFlags(static_cast<ERHIShaderStage>(Binding.StageFlags));
             VulkanBinding.pImmutableSamplers = nullptr; // 暂时不支持不可变采样器
             VulkanBindings.Add(VulkanBinding);
+
+            VulkanBindingFlags.Add(ConvertDescriptorBindingFlags(Binding.Flags));
+            bHasBindingFlags |= Binding.Flags != ERHIDescriptorBindingFlag::None;
+            bHasUpdateAfterBind |= HasFlag(Binding.Flags, ERHIDescriptorBindingFlag::UpdateAfterBind);
         }
 
         // 创建 Vulkan 描述符集布局创建信息
@@ -37,6 +45,20 @@ FRHIDescriptorSetLayout FGfxDeviceVk::CreateDescriptorSetLayout(const FRHIDescri
         LayoutInfo.bindingCount = static_cast<uint32_t>(VulkanBindings.Size());
         LayoutInfo.pBindings = VulkanBindings.Data();
 
+        // 绑定标志只在有绑定需要时才挂到 pNext 上
+        vk::DescriptorSetLayoutBindingFlagsCreateInfo BindingFlagsInfo;
+        if (bHasBindingFlags)
+        {
+            BindingFlagsInfo.bindingCount  = static_cast<uint32_t>(VulkanBindingFlags.Size());
+            BindingFlagsInfo.pBindingFlags = VulkanBindingFlags.Data();
+            LayoutInfo.pNext               = &BindingFlagsInfo;
+        }
+        // 含有 UpdateAfterBind 绑定的布局只能从开启了 UpdateAfterBind 的池中分配
+        if (bHasUpdateAfterBind)
+        {
+            LayoutInfo.flags = vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool;
+        }
+
         // 创建 Vulkan 描述符集布局
         vk::DescriptorSetLayout VulkanLayout;
         try
@@ -58,7 +80,7 @@ FRHIDescriptorSetLayout FGfxDeviceVk::CreateDescriptorSetLayout(const FRHIDescri
         // 创建 RHI 句柄
         auto& HandleManager = FRHIHandleManager::GetRef();
         const FRHIHandle LayoutHandle =
-            HandleManager.CreateRHIHandle(LayoutCreateInfo.DebugName.CStr(),
+            HandleManager.CreateRHIHandle(ERHIResourceType::DescriptorSetLayout, LayoutCreateInfo.DebugName.CStr(),
                                           reinterpret_cast<void*>(static_cast<VkDescriptorSetLayout>(VulkanLayout)));
 
         // 创建 FRHIDescriptorSetLayout 对象
@@ -166,7 +188,8 @@ FRHIDescriptorPool FGfxDeviceVk::CreateDescriptorPool(const FRHIDescriptorPoolDe
         // 创建 RHI 句柄
         auto& HandleManager = FRHIHandleManager::GetRef();
         FRHIHandle PoolHandle = HandleManager.CreateRHIHandle(
-            PoolCreateInfo.DebugName.CStr(), reinterpret_cast<void*>(static_cast<VkDescriptorPool>(VulkanPool)));
+            ERHIResourceType::DescriptorPool, PoolCreateInfo.DebugName.CStr(),
+            reinterpret_cast<void*>(static_cast<VkDescriptorPool>(VulkanPool)));
 
         // 创建 FRHIDescriptorPool 对象
         FRHIDescriptorPool DescriptorPool;
@@ -273,7 +296,8 @@ FRHIDescriptorSet FGfxDeviceVk::AllocateDescriptorSet(const FRHIDescriptorPool&
         // 创建 RHI 句柄
         auto& HandleManager = FRHIHandleManager::GetRef();
         const FRHIHandle SetHandle = HandleManager.CreateRHIHandle(
-            SetCreateInfo.DebugName.CStr(), reinterpret_cast<void*>(static_cast<VkDescriptorSet>(VulkanSet)));
+            ERHIResourceType::DescriptorSet, SetCreateInfo.DebugName.CStr(),
+            reinterpret_cast<void*>(static_cast<VkDescriptorSet>(VulkanSet)));
 
         // 创建 FRHIDescriptorSet 对象
         FRHIDescriptorSet DescriptorSet;
@@ -360,6 +384,17 @@ void FGfxDeviceVk::UpdateDescriptorSet(const FRHIDescriptorSet& DescriptorSet,
 
         VulkanWrites.Reserve(WriteDescriptorSets.Size());
 
+        // 批量写入时 pImageInfo/pBufferInfo 指向这两个数组内部, 必须一次预留足够空间, 避免扩容后指针失效
+        size_t TotalImageInfoCount  = 0;
+        size_t TotalBufferInfoCount = 0;
+        for (const auto& Write : WriteDescriptorSets)
+        {
+            TotalImageInfoCount += Write.ImageInfo.Size();
+            TotalBufferInfoCount += Write.BufferInfo.Size();
+        }
+        ImageInfos.Reserve(TotalImageInfoCount);
+        BufferInfos.Reserve(TotalBufferInfoCount);
+
         for (const auto& Write : WriteDescriptorSets)
         {
             vk::WriteDescriptorSet VulkanWrite;
@@ -386,7 +421,6 @@ void FGfxDeviceVk::UpdateDescriptorSet(const FRHIDescriptorSet& DescriptorSet,
                     }
 
                     const size_t ImageInfoStartIndex = ImageInfos.Size();
-                    ImageInfos.Reserve(ImageInfos.Size() + Write.ImageInfo.Size());
 
                     for (const auto& ImageInfo : Write.ImageInfo)
                     {
@@ -419,7 +453,6 @@ void FGfxDeviceVk::UpdateDescriptorSet(const FRHIDescriptorSet& DescriptorSet,
                     }
 
                     const size_t BufferInfoStartIndex = BufferInfos.Size();
-                    BufferInfos.Reserve(BufferInfos.Size() + Write.BufferInfo.Size());
 
                     for (const auto& BufferInfo : Write.BufferInfo)
                     {
@@ -477,6 +510,11 @@ void FGfxDeviceVk::UpdateDescriptorSet(const FRHIDescriptorSet& DescriptorSet,
     }
 }
 
+FRHIBindlessLimits FGfxDeviceVk::GetBindlessLimits() const
+{
+    return BindlessLimits;
+}
+
 #pragma endregion
 
 #pragma region 转换函数实现
@@ -535,6 +573,30 @@ vk::DescriptorPoolCreateFlags FGfxDeviceVk::ConvertDescriptorPoolCreateFlags(ERH
     return VulkanFlags;
 }
 
+vk::DescriptorBindingFlags FGfxDeviceVk::ConvertDescriptorBindingFlags(ERHIDescriptorBindingFlag Flags)
+{
+    vk::DescriptorBindingFlags VulkanFlags = {};
+
+    if (HasFlag(Flags, ERHIDescriptorBindingFlag::UpdateAfterBind))
+    {
+        VulkanFlags |= vk::DescriptorBindingFlagBits::eUpdateAfterBind;
+    }
+    if (HasFlag(Flags, ERHIDescriptorBindingFlag::UpdateUnusedWhilePending))
+    {
+        VulkanFlags |= vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending;
+    }
+    if (HasFlag(Flags, ERHIDescriptorBindingFlag::PartiallyBound))
+    {
+        VulkanFlags |= vk::DescriptorBindingFlagBits::ePartiallyBound;
+    }
+    if (HasFlag(Flags, ERHIDescriptorBindingFlag::VariableDescriptorCount))
+    {
+        VulkanFlags |= vk::DescriptorBindingFlagBits::eVariableDescriptorCount;
+    }
+
+    return VulkanFlags;
+}
+
 #pragma endregion
 
 void FGfxDeviceVk::SetDebugName(vk::DescriptorPool ObjectHandle, vk::ObjectType ObjectType,
@@ -72,7 +72,8 @@ FRHIImageView FGfxDeviceVk::CreateImageView(const FRHIImage& Image, const FRHIIm
         // 创建 RHI 句柄
         auto& HandleManager = FRHIHandleManager::GetRef();
         FRHIHandle ViewHandle = HandleManager.CreateRHIHandle(
-            ViewCreateInfo.DebugName.CStr(), reinterpret_cast<void*>(static_cast<VkImageView>(VulkanImageView)));
+            ERHIResourceType::ImageView, ViewCreateInfo.DebugName.CStr(),
+            reinterpret_cast<void*>(static_cast<VkImageView>(VulkanImageView)));
 
         // 创建 FRHIImageView 对象
         FRHIImageView ImageView;
@@ -51,7 +51,8 @@ FRHIImage FGfxDeviceVk::CreateImage(const FRHIImageDesc& ImageCreateInfo)
         // 创建 RHI 句柄
         auto& HandleManager = FRHIHandleManager::GetRef();
         FRHIHandle ImageHandle = HandleManager.CreateRHIHandle(
-            ImageCreateInfo.DebugName.CStr(), reinterpret_cast<void*>(static_cast<VkImage>(VulkanImage)));
+            ERHIResourceType::Image, ImageCreateInfo.DebugName.CStr(),
+            reinterpret_cast<void*>(static_cast<VkImage>(VulkanImage)));
 
         // 创建 FRHIImage 对象
         FRHIImage Image;
@@ -63,6 +64,7 @@ FRHIImage FGfxDeviceVk::CreateImage(const FRHIImageDesc& ImageCreateInfo)
         Image.ArrayLayers = ImageCreateInfo.ArrayLayers;
         Image.Samples = ImageCreateInfo.Samples;
         Image.Usage = ImageCreateInfo.Usage;
+        TrackImageMemory(Image);
 
         HK_LOG_INFO(ELogcat::RHI, "图像创建成功: {}x{}x{} (格式: {}, MIP: {}, 层: {})", ImageCreateInfo.Extent.X,
                     ImageCreateInfo.Extent.Y, ImageCreateInfo.Extent.Z, static_cast<UInt32>(ImageCreateInfo.Format),
@@ -103,6 +105,7 @@ void FGfxDeviceVk::DestroyImage(FRHIImage& Image)
     HandleManager.DestroyRHIHandle(Image.Handle);
 
     // 重置图像对象
+    UntrackImageMemory(Image);
     Image = FRHIImage();
 
     HK_LOG_INFO(ELogcat::RHI, "图像已销毁");
@@ -49,7 +49,8 @@ FRHIShaderModule FGfxDeviceVk::CreateShaderModule(const FRHIShaderModuleDesc& Mo
         // 创建 RHI 句柄
         auto& HandleManager = FRHIHandleManager::GetRef();
         const FRHIHandle ModuleHandle = HandleManager.CreateRHIHandle(
-            ModuleCreateInfo.DebugName.CStr(), reinterpret_cast<void*>(static_cast<VkShaderModule>(VulkanModule)));
+            ERHIResourceType::ShaderModule, ModuleCreateInfo.DebugName.CStr(),
+            reinterpret_cast<void*>(static_cast<VkShaderModule>(VulkanModule)));
 
         // 创建 FRHIShaderModule 对象
         FRHIShaderModule ShaderModule;
@@ -167,7 +168,8 @@ FRHIPipelineLayout FGfxDeviceVk::CreatePipelineLayout(const FRHIPipelineLayoutDe
         // 创建 RHI 句柄
         auto& HandleManager = FRHIHandleManager::GetRef();
         const FRHIHandle LayoutHandle = HandleManager.CreateRHIHandle(
-            LayoutCreateInfo.DebugName.CStr(), reinterpret_cast<void*>(static_cast<VkPipelineLayout>(VulkanLayout)));
+            ERHIResourceType::PipelineLayout, LayoutCreateInfo.DebugName.CStr(),
+            reinterpret_cast<void*>(static_cast<VkPipelineLayout>(VulkanLayout)));
 
         // 创建 FRHIPipelineLayout 对象
         FRHIPipelineLayout PipelineLayout;
@@ -246,7 +248,8 @@ FRHIPipeline FGfxDeviceVk::CreateGraphicsPipeline(const FRHIGraphicsPipelineDesc
         // 创建 RHI 句柄
         auto& HandleManager = FRHIHandleManager::GetRef();
         const FRHIHandle PipelineHandle = HandleManager.CreateRHIHandle(
-            PipelineCreateInfo.DebugName.CStr(), reinterpret_cast<void*>(static_cast<VkPipeline>(VulkanPipeline)));
+            ERHIResourceType::Pipeline, PipelineCreateInfo.DebugName.CStr(),
+            reinterpret_cast<void*>(static_cast<VkPipeline>(VulkanPipeline)));
 
         // 创建 FRHIPipeline 对象
         FRHIPipeline Pipeline;
@@ -297,7 +300,8 @@ FRHIPipeline FGfxDeviceVk::CreateComputePipeline(const FRHIComputePipelineDesc&
         // 创建 RHI 句柄
         auto& HandleManager = FRHIHandleManager::GetRef();
         const FRHIHandle PipelineHandle = HandleManager.CreateRHIHandle(
-            PipelineCreateInfo.DebugName.CStr(), reinterpret_cast<void*>(static_cast<VkPipeline>(VulkanPipeline)));
+            ERHIResourceType::Pipeline, PipelineCreateInfo.DebugName.CStr(),
+            reinterpret_cast<void*>(static_cast<VkPipeline>(VulkanPipeline)));
 
         // 创建 FRHIPipeline 对象
         FRHIPipeline Pipeline;
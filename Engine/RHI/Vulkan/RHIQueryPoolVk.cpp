@@ -0,0 +1,152 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "Core/Logging/Logger.h"
+#include "Core/Utility/Macros.h"
+#include "GfxDeviceVk.h"
+#include "RHI/RHIQueryPool.h"
+
+// ============================================================================
+// QueryPool 创建和销毁
+// ============================================================================
+
+FRHIQueryPool FGfxDeviceVk::CreateQueryPool(const FRHIQueryPoolDesc& QueryPoolCreateInfo)
+{
+    FRHIQueryPool QueryPool;
+
+    if (QueryPoolCreateInfo.QueryCount == 0)
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "QueryPool的查询数量不能为0");
+        return QueryPool;
+    }
+
+    vk::QueryPoolCreateInfo VkCreateInfo;
+    VkCreateInfo.queryType  = ConvertQueryType(QueryPoolCreateInfo.Type);
+    VkCreateInfo.queryCount = QueryPoolCreateInfo.QueryCount;
+    if (QueryPoolCreateInfo.Type == ERHIQueryType::PipelineStatistics)
+    {
+        VkCreateInfo.pipelineStatistics = ConvertPipelineStatisticFlags(QueryPoolCreateInfo.PipelineStatistics);
+    }
+
+    vk::QueryPool VkQueryPool;
+    try
+    {
+        VkQueryPool = Device.createQueryPool(VkCreateInfo);
+    }
+    catch (const vk::SystemError& e)
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "创建Vulkan QueryPool失败: {}", e.what());
+        return QueryPool;
+    }
+
+    QueryPool.Handle             = FRHIHandleManager::GetRef().CreateRHIHandle(
+        ERHIResourceType::QueryPool, QueryPoolCreateInfo.DebugName,
+        reinterpret_cast<void*>(static_cast<VkQueryPool>(VkQueryPool)));
+    QueryPool.Type               = QueryPoolCreateInfo.Type;
+    QueryPool.QueryCount         = QueryPoolCreateInfo.QueryCount;
+    QueryPool.PipelineStatistics = QueryPoolCreateInfo.PipelineStatistics;
+
+    if (bDebugUtilsExtensionAvailable && !QueryPoolCreateInfo.DebugName.IsEmpty())
+    {
+        SetDebugName(VkQueryPool, vk::ObjectType::eQueryPool, QueryPoolCreateInfo.DebugName);
+    }
+
+    return QueryPool;
+}
+
+void FGfxDeviceVk::DestroyQueryPool(FRHIQueryPool& QueryPool)
+{
+    if (!QueryPool.IsValid())
+    {
+        return;
+    }
+
+    Device.destroyQueryPool(vk::QueryPool(QueryPool.Handle.Cast<VkQueryPool>()));
+
+    FRHIHandleManager::GetRef().DestroyRHIHandle(QueryPool.Handle);
+    QueryPool = FRHIQueryPool();
+}
+
+bool FGfxDeviceVk::GetQueryPoolResults(const FRHIQueryPool& QueryPool, const UInt32 FirstQuery,
+                                       const UInt32 QueryCount, TArray<UInt64>& OutResults)
+{
+    if (!QueryPool.IsValid() || FirstQuery + QueryCount > QueryPool.GetQueryCount())
+    {
+        HK_LOG_ERROR(ELogcat::RHI, "无效的QueryPool或查询范围越界");
+        return false;
+    }
+
+    const UInt32 ResultCountPerQuery = QueryPool.GetResultCountPerQuery();
+    OutResults.Resize(static_cast<size_t>(QueryCount) * ResultCountPerQuery);
+    if (QueryCount == 0)
+    {
+        return true;
+    }
+
+    // 不带 eWait, 结果未就绪时返回 eNotReady 而不是阻塞
+    const vk::Result Result = Device.getQueryPoolResults(
+        vk::QueryPool(QueryPool.Handle.Cast<VkQueryPool>()), FirstQuery, QueryCount, OutResults.Size() * sizeof(UInt64),
+        OutResults.Data(), ResultCountPerQuery * sizeof(UInt64), vk::QueryResultFlagBits::e64);
+    return Result == vk::Result::eSuccess;
+}
+
+double FGfxDeviceVk::GetTimestampPeriod() const
+{
+    return TimestampPeriod;
+}
+
+// ============================================================================
+// 辅助函数
+// ============================================================================
+
+vk::QueryType FGfxDeviceVk::ConvertQueryType(const ERHIQueryType Type)
+{
+    switch (Type)
+    {
+        case ERHIQueryType::Timestamp:
+            return vk::QueryType::eTimestamp;
+        case ERHIQueryType::PipelineStatistics:
+            return vk::QueryType::ePipelineStatistics;
+        case ERHIQueryType::Occlusion:
+            return vk::QueryType::eOcclusion;
+    }
+    return vk::QueryType::eTimestamp;
+}
+
+vk::QueryPipelineStatisticFlags FGfxDeviceVk::ConvertPipelineStatisticFlags(const ERHIPipelineStatisticFlag Flags)
+{
+    // ERHIPipelineStatisticFlag 的位与 VkQueryPipelineStatisticFlagBits 一一对应
+    return vk::QueryPipelineStatisticFlags(static_cast<VkQueryPipelineStatisticFlags>(Flags));
+}
+
+void FGfxDeviceVk::SetDebugName(const vk::QueryPool ObjectHandle, const vk::ObjectType ObjectType,
+                                const FStringView& Name) const
+{
+    if (!Device || Name.IsEmpty() || !bDebugUtilsExtensionAvailable || !vkSetDebugUtilsObjectNameEXT)
+    {
+        return;
+    }
+
+    try
+    {
+        const FString NameStr(Name.Data(), Name.Size());
+
+        VkDebugUtilsObjectNameInfoEXT VkNameInfo{};
+        VkNameInfo.sType        = VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT;
+        VkNameInfo.objectType   = static_cast<VkObjectType>(ObjectType);
+        VkNameInfo.objectHandle = reinterpret_cast<uint64_t>(static_cast<VkQueryPool>(ObjectHandle));
+        VkNameInfo.pObjectName  = NameStr.CStr();
+
+        vkSetDebugUtilsObjectNameEXT(static_cast<VkDevice>(Device), &VkNameInfo);
+    }
+    catch (const vk::SystemError& e)
+    {
+        // 如果扩展不可用，忽略错误（不是致命错误）
+        HK_LOG_DEBUG(ELogcat::RHI, "设置DebugName失败（扩展可能不可用）: {}", e.what());
+    }
+    catch (...)
+    {
+        // 忽略所有异常
+    }
+}
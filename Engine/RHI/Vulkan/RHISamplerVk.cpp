@@ -54,7 +54,8 @@ FRHISampler FGfxDeviceVk::CreateSampler(const FRHISamplerDesc& SamplerCreateInfo
         // 创建 RHI 句柄
         auto&      HandleManager = FRHIHandleManager::GetRef();
         FRHIHandle SamplerHandle = HandleManager.CreateRHIHandle(
-            SamplerCreateInfo.DebugName.CStr(), reinterpret_cast<void*>(static_cast<VkSampler>(VulkanSampler)));
+            ERHIResourceType::Sampler, SamplerCreateInfo.DebugName.CStr(),
+            reinterpret_cast<void*>(static_cast<VkSampler>(VulkanSampler)));
 
         // 创建 FRHISampler 对象
         FRHISampler Sampler;
@@ -106,6 +106,7 @@ bool FGfxDeviceVk::PresentImage(FRHIWindow& Window, UInt32 ImageIndex, const FRH
     // 呈现图像
     try
     {
+        AutoLock   Lock(QueueMutex);
         vk::Result Result = PresentQueue.presentKHR(PresentInfo);
 
         if (Result == vk::Result::eSuccess)
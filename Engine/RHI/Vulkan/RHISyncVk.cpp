@@ -51,7 +51,8 @@ FRHISemaphore FGfxDeviceVk::CreateSemaphore(const FRHISemaphoreDesc& SemaphoreCr
         // 创建 RHI 句柄
         auto& HandleManager = FRHIHandleManager::GetRef();
         const FRHIHandle SemaphoreHandle = HandleManager.CreateRHIHandle(
-            SemaphoreCreateInfo.DebugName.CStr(), reinterpret_cast<void*>(static_cast<VkSemaphore>(VulkanSemaphore)));
+            ERHIResourceType::Semaphore, SemaphoreCreateInfo.DebugName.CStr(),
+            reinterpret_cast<void*>(static_cast<VkSemaphore>(VulkanSemaphore)));
 
         // 创建 FRHISemaphore 对象
         FRHISemaphore Semaphore;
@@ -136,7 +137,8 @@ FRHIFence FGfxDeviceVk::CreateFence(const FRHIFenceDesc& FenceCreateInfo)
         // 创建 RHI 句柄
         auto& HandleManager = FRHIHandleManager::GetRef();
         const FRHIHandle FenceHandle = HandleManager.CreateRHIHandle(
-            FenceCreateInfo.DebugName.CStr(), reinterpret_cast<void*>(static_cast<VkFence>(VulkanFence)));
+            ERHIResourceType::Fence, FenceCreateInfo.DebugName.CStr(),
+            reinterpret_cast<void*>(static_cast<VkFence>(VulkanFence)));
 
         // 创建 FRHIFence 对象
         FRHIFence Fence;
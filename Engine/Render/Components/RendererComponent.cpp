@@ -4,14 +4,14 @@
 
 #include "RendererComponent.h"
 
-#include "Render/GlobalRenderResources.h"
+#include "Render/Renderer/Renderer.h"
 
 void CRendererComponent::OnTransformUpdated()
 {
-    if (RendererModelMatrixIndex == -1)
+    FRenderer* Renderer = GetRenderer();
+    if (Renderer == nullptr)
     {
         return;
     }
-    const FMatrix4x4f WorldMatrix = WorldTransform.ToMatrix();
-    FGlobalDynamicRenderResourcePool::GetRef().UpdateModelMatrix(WorldMatrix, RendererModelMatrixIndex);
+    Renderer->SetWorldMatrix(WorldTransform.ToMatrix());
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "Object/SceneComponent.h"
 
+class FRenderer;
+
 #include "RendererComponent.generated.h"
 
 HCLASS()
@@ -9,8 +11,14 @@ class CRendererComponent : public CSceneComponent
 {
     GENERATED_BODY(CRendererComponent)
 protected:
-    // 渲染器使用的模型矩阵索引
-    Int16 RendererModelMatrixIndex = -1;
+    /**
+     * 组件持有的渲染器, 变换更新时会同步它的世界矩阵
+     * @return 没有渲染器时返回nullptr
+     */
+    virtual FRenderer* GetRenderer()
+    {
+        return nullptr;
+    }
 
     void OnTransformUpdated() override;
 };
\ No newline at end of file
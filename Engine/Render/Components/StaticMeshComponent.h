@@ -13,6 +13,11 @@ protected:
     HPROPERTY()
     TObjectPtr<HMesh> Mesh;
 
+    FRenderer* GetRenderer() override
+    {
+        return &Renderer;
+    }
+
 public:
     CStaticMeshComponent();
 
@@ -0,0 +1,438 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "DynamicBVH.h"
+
+#include "Core/Logging/Logger.h"
+#include "Core/Utility/Profiler.h"
+#include "Frustum.h"
+#include "TaskGraph/TaskGraph.h"
+
+#include <algorithm>
+
+// 代理数量达到该值时才并行剔除, 否则任务调度的开销大于收益
+static constexpr UInt32 ParallelCullThreshold = 4096;
+// 并行剔除时把树的上层拆成的子树数量下限
+static constexpr size_t ParallelCullSubtreeCount = 8;
+
+FDynamicBVH::FDynamicBVH(float InFatMargin) : FatMargin(InFatMargin) {}
+
+Int32 FDynamicBVH::AllocateNode()
+{
+    if (FreeList == NullNode)
+    {
+        Nodes.Add(FNode{});
+        return static_cast<Int32>(Nodes.Size() - 1);
+    }
+    const Int32 NodeId = FreeList;
+    FreeList           = Nodes[NodeId].ParentOrNext;
+    Nodes[NodeId]      = FNode{};
+    return NodeId;
+}
+
+void FDynamicBVH::FreeNode(Int32 NodeId)
+{
+    FNode& Node       = Nodes[NodeId];
+    Node.ParentOrNext = FreeList;
+    Node.Height       = -1;
+    Node.UserData     = nullptr;
+    FreeList          = NodeId;
+}
+
+void FDynamicBVH::Clear()
+{
+    Nodes.Clear();
+    Root       = NullNode;
+    FreeList   = NullNode;
+    ProxyCount = 0;
+}
+
+Int32 FDynamicBVH::CreateProxy(const FBox3f& Box, void* UserData)
+{
+    const Int32 ProxyId = AllocateNode();
+    FNode&      Node    = Nodes[ProxyId];
+    Node.Box            = Box.Inflate(FatMargin);
+    Node.UserData       = UserData;
+    Node.Height         = 0;
+    InsertLeaf(ProxyId);
+    ++ProxyCount;
+    return ProxyId;
+}
+
+void FDynamicBVH::DestroyProxy(Int32 ProxyId)
+{
+    HK_ASSERT_MSG(ProxyId >= 0 && ProxyId < Nodes.Size() && Nodes[ProxyId].IsLeaf() && Nodes[ProxyId].Height == 0,
+                  "无效的 BVH 代理 ID {}", ProxyId);
+    RemoveLeaf(ProxyId);
+    FreeNode(ProxyId);
+    --ProxyCount;
+}
+
+bool FDynamicBVH::MoveProxy(Int32 ProxyId, const FBox3f& Box)
+{
+    HK_ASSERT_MSG(ProxyId >= 0 && ProxyId < Nodes.Size() && Nodes[ProxyId].IsLeaf() && Nodes[ProxyId].Height == 0,
+                  "无效的 BVH 代理 ID {}", ProxyId);
+    if (Nodes[ProxyId].Box.Contains(Box))
+    {
+        return false;
+    }
+    RemoveLeaf(ProxyId);
+    Nodes[ProxyId].Box = Box.Inflate(FatMargin);
+    InsertLeaf(ProxyId);
+    return true;
+}
+
+void FDynamicBVH::InsertLeaf(Int32 Leaf)
+{
+    if (Root == NullNode)
+    {
+        Root                     = Leaf;
+        Nodes[Leaf].ParentOrNext = NullNode;
+        return;
+    }
+
+    // 自顶向下寻找使总表面积增量最小的兄弟节点
+    const FBox3f LeafBox = Nodes[Leaf].Box;
+    Int32        Index   = Root;
+    while (!Nodes[Index].IsLeaf())
+    {
+        const FNode& Node = Nodes[Index];
+
+        const float Area         = Node.Box.GetSurfaceArea();
+        const float CombinedArea = FBox3f::Union(Node.Box, LeafBox).GetSurfaceArea();
+        // 在这里新建父节点的代价
+        const float Cost = 2.0f * CombinedArea;
+        // 继续下降时, 当前节点因包含新叶子而增加的代价
+        const float InheritanceCost = 2.0f * (CombinedArea - Area);
+
+        auto DescendCost = [this, &LeafBox, InheritanceCost](Int32 Child) {
+            const FNode& ChildNode = Nodes[Child];
+            const float  NewArea   = FBox3f::Union(ChildNode.Box, LeafBox).GetSurfaceArea();
+            if (ChildNode.IsLeaf())
+            {
+                return NewArea + InheritanceCost;
+            }
+            return NewArea - ChildNode.Box.GetSurfaceArea() + InheritanceCost;
+        };
+        const float Cost1 = DescendCost(Node.Child1);
+        const float Cost2 = DescendCost(Node.Child2);
+
+        if (Cost < Cost1 && Cost < Cost2)
+        {
+            break;
+        }
+        Index = Cost1 < Cost2 ? Node.Child1 : Node.Child2;
+    }
+
+    const Int32 Sibling   = Index;
+    const Int32 OldParent = Nodes[Sibling].ParentOrNext;
+    // AllocateNode 可能使 Nodes 扩容, 之后才能取引用
+    const Int32 NewParent = AllocateNode();
+    FNode&      Parent    = Nodes[NewParent];
+    Parent.ParentOrNext   = OldParent;
+    Parent.Box            = FBox3f::Union(LeafBox, Nodes[Sibling].Box);
+    Parent.Height         = Nodes[Sibling].Height + 1;
+    Parent.Child1         = Sibling;
+    Parent.Child2         = Leaf;
+
+    if (OldParent != NullNode)
+    {
+        if (Nodes[OldParent].Child1 == Sibling)
+        {
+            Nodes[OldParent].Child1 = NewParent;
+        }
+        else
+        {
+            Nodes[OldParent].Child2 = NewParent;
+        }
+    }
+    else
+    {
+        Root = NewParent;
+    }
+    Nodes[Sibling].ParentOrNext = NewParent;
+    Nodes[Leaf].ParentOrNext    = NewParent;
+
+    // 向上平衡并重新计算包围盒
+    Index = Nodes[Leaf].ParentOrNext;
+    while (Index != NullNode)
+    {
+        Index       = Balance(Index);
+        FNode& Node = Nodes[Index];
+        Node.Height = 1 + std::max(Nodes[Node.Child1].Height, Nodes[Node.Child2].Height);
+        Node.Box    = FBox3f::Union(Nodes[Node.Child1].Box, Nodes[Node.Child2].Box);
+        Index       = Node.ParentOrNext;
+    }
+}
+
+void FDynamicBVH::RemoveLeaf(Int32 Leaf)
+{
+    if (Leaf == Root)
+    {
+        Root = NullNode;
+        return;
+    }
+
+    const Int32 Parent      = Nodes[Leaf].ParentOrNext;
+    const Int32 GrandParent = Nodes[Parent].ParentOrNext;
+    const Int32 Sibling     = Nodes[Parent].Child1 == Leaf ? Nodes[Parent].Child2 : Nodes[Parent].Child1;
+
+    if (GrandParent == NullNode)
+    {
+        Root                        = Sibling;
+        Nodes[Sibling].ParentOrNext = NullNode;
+        FreeNode(Parent);
+        return;
+    }
+
+    // 用兄弟节点替换父节点
+    if (Nodes[GrandParent].Child1 == Parent)
+    {
+        Nodes[GrandParent].Child1 = Sibling;
+    }
+    else
+    {
+        Nodes[GrandParent].Child2 = Sibling;
+    }
+    Nodes[Sibling].ParentOrNext = GrandParent;
+    FreeNode(Parent);
+
+    Int32 Index = GrandParent;
+    while (Index != NullNode)
+    {
+        Index       = Balance(Index);
+        FNode& Node = Nodes[Index];
+        Node.Height = 1 + std::max(Nodes[Node.Child1].Height, Nodes[Node.Child2].Height);
+        Node.Box    = FBox3f::Union(Nodes[Node.Child1].Box, Nodes[Node.Child2].Box);
+        Index       = Node.ParentOrNext;
+    }
+}
+
+Int32 FDynamicBVH::Balance(Int32 IndexA)
+{
+    FNode& A = Nodes[IndexA];
+    if (A.IsLeaf() || A.Height < 2)
+    {
+        return IndexA;
+    }
+
+    const Int32 IndexB = A.Child1;
+    const Int32 IndexC = A.Child2;
+    FNode&      B      = Nodes[IndexB];
+    FNode&      C      = Nodes[IndexC];
+
+    // 把较高的子节点旋转到 A 的位置, 较高的孙节点留在其下, 较矮的孙节点交给 A
+    auto RotateUp = [this, IndexA, &A](Int32 IndexUp, FNode& Up, const FNode& Stay, bool bUpIsChild1) {
+        const Int32  IndexF = Up.Child1;
+        const Int32  IndexG = Up.Child2;
+        const FNode& F      = Nodes[IndexF];
+        const FNode& G      = Nodes[IndexG];
+
+        Up.Child1       = IndexA;
+        Up.ParentOrNext = A.ParentOrNext;
+        A.ParentOrNext  = IndexUp;
+
+        if (Up.ParentOrNext != NullNode)
+        {
+            FNode& OldParent = Nodes[Up.ParentOrNext];
+            if (OldParent.Child1 == IndexA)
+            {
+                OldParent.Child1 = IndexUp;
+            }
+            else
+            {
+                OldParent.Child2 = IndexUp;
+            }
+        }
+        else
+        {
+            Root = IndexUp;
+        }
+
+        const bool   bKeepF    = F.Height > G.Height;
+        const Int32  IndexKeep = bKeepF ? IndexF : IndexG;
+        const Int32  IndexGive = bKeepF ? IndexG : IndexF;
+        const FNode& Keep      = Nodes[IndexKeep];
+        FNode&       Give      = Nodes[IndexGive];
+        Up.Child2              = IndexKeep;
+        Give.ParentOrNext      = IndexA;
+        if (bUpIsChild1)
+        {
+            A.Child1 = IndexGive;
+        }
+        else
+        {
+            A.Child2 = IndexGive;
+        }
+
+        A.Box     = FBox3f::Union(Stay.Box, Give.Box);
+        Up.Box    = FBox3f::Union(A.Box, Keep.Box);
+        A.Height  = 1 + std::max(Stay.Height, Give.Height);
+        Up.Height = 1 + std::max(A.Height, Keep.Height);
+    };
+
+    const Int32 BalanceFactor = C.Height - B.Height;
+    if (BalanceFactor > 1)
+    {
+        RotateUp(IndexC, C, B, false);
+        return IndexC;
+    }
+    if (BalanceFactor < -1)
+    {
+        RotateUp(IndexB, B, C, true);
+        return IndexB;
+    }
+    return IndexA;
+}
+
+void FDynamicBVH::CollectLeaves(Int32 NodeId, TArray<void*>& OutUserData) const
+{
+    TArray<Int32> Stack;
+    Stack.Reserve(64);
+    Stack.Add(NodeId);
+    while (!Stack.IsEmpty())
+    {
+        const FNode& Node = Nodes[Stack.Back()];
+        Stack.PopBack();
+        if (Node.IsLeaf())
+        {
+            OutUserData.Add(Node.UserData);
+        }
+        else
+        {
+            Stack.Add(Node.Child1);
+            Stack.Add(Node.Child2);
+        }
+    }
+}
+
+void FDynamicBVH::CullNode(Int32 NodeId, const FFrustum& Frustum, TArray<void*>& OutUserData) const
+{
+    TArray<Int32> Stack;
+    Stack.Reserve(64);
+    Stack.Add(NodeId);
+    while (!Stack.IsEmpty())
+    {
+        const Int32  Index = Stack.Back();
+        const FNode& Node  = Nodes[Index];
+        Stack.PopBack();
+
+        const EFrustumTestResult Result = Frustum.TestBox(Node.Box);
+        if (Result == EFrustumTestResult::Outside)
+        {
+            continue;
+        }
+        if (Node.IsLeaf())
+        {
+            OutUserData.Add(Node.UserData);
+        }
+        else if (Result == EFrustumTestResult::Inside)
+        {
+            // 整棵子树都在视锥内, 不需要再测试
+            CollectLeaves(Index, OutUserData);
+        }
+        else
+        {
+            Stack.Add(Node.Child1);
+            Stack.Add(Node.Child2);
+        }
+    }
+}
+
+void FDynamicBVH::CullFrustum(const FFrustum& Frustum, TArray<void*>& OutUserData) const
+{
+    HK_PROFILE_SCOPE_N("FDynamicBVH::CullFrustum");
+
+    if (Root == NullNode)
+    {
+        return;
+    }
+    if (ProxyCount < ParallelCullThreshold)
+    {
+        CullNode(Root, Frustum, OutUserData);
+        return;
+    }
+
+    // 在调用线程上逐层展开树的上层, 直到得到足够多互不相交的子树
+    struct FSubtree
+    {
+        Int32 NodeId;
+        // 已确定完全可见, 只需收集叶子
+        bool bAccepted;
+    };
+    TArray<FSubtree> Frontier;
+    Frontier.Add({Root, false});
+    while (Frontier.Size() < ParallelCullSubtreeCount)
+    {
+        TArray<FSubtree> Next;
+        bool             bExpanded = false;
+        for (const FSubtree& Subtree : Frontier)
+        {
+            const FNode& Node = Nodes[Subtree.NodeId];
+            if (Subtree.bAccepted)
+            {
+                Next.Add(Subtree);
+                continue;
+            }
+            const EFrustumTestResult Result = Frustum.TestBox(Node.Box);
+            if (Result == EFrustumTestResult::Outside)
+            {
+                continue;
+            }
+            if (Result == EFrustumTestResult::Inside || Node.IsLeaf())
+            {
+                Next.Add({Subtree.NodeId, true});
+                continue;
+            }
+            Next.Add({Node.Child1, false});
+            Next.Add({Node.Child2, false});
+            bExpanded = true;
+        }
+        Frontier = std::move(Next);
+        if (!bExpanded)
+        {
+            break;
+        }
+    }
+    if (Frontier.IsEmpty())
+    {
+        return;
+    }
+
+    auto ProcessSubtree = [this, &Frustum](const FSubtree& Subtree, TArray<void*>& Out) {
+        if (Subtree.bAccepted)
+        {
+            CollectLeaves(Subtree.NodeId, Out);
+        }
+        else
+        {
+            CullNode(Subtree.NodeId, Frustum, Out);
+        }
+    };
+
+    TArray<TArray<void*>>     Results;
+    TArray<TSharedPtr<FTask>> Tasks;
+    Results.Resize(Frontier.Size());
+    Tasks.Reserve(Frontier.Size() - 1);
+    for (size_t Index = 1; Index < Frontier.Size(); ++Index)
+    {
+        TSharedPtr<FTask> Task =
+            FTaskGraph::GetRef().Create(FString("FDynamicBVH::CullSubtree"), EExecutorLabel::Worker,
+                                        [&ProcessSubtree, &Frontier, &Results, Index]() {
+                                            ProcessSubtree(Frontier[Index], Results[Index]);
+                                        });
+        FTaskGraph::GetRef().Launch(Task);
+        Tasks.Add(Task);
+    }
+    // 调用线程处理第一棵子树, 直接写入输出
+    ProcessSubtree(Frontier[0], OutUserData);
+    for (auto& Task : Tasks)
+    {
+        Task->Wait();
+    }
+    for (size_t Index = 1; Index < Results.Size(); ++Index)
+    {
+        OutUserData.Append(Results[Index].begin(), Results[Index].end());
+    }
+}
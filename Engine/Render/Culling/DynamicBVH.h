@@ -0,0 +1,107 @@
+#pragma once
+#include "Core/Container/Array.h"
+#include "Math/Box.h"
+
+class FFrustum;
+
+/**
+ * 动态 AABB 树, 用于对大量会移动的渲染器做视锥剔除
+ * 叶子保存扩大了 FatMargin 的包围盒, 物体在扩大范围内移动时不需要修改树
+ * 插入时按表面积启发式（SAH）选择兄弟节点, 并通过旋转保持平衡
+ */
+class HK_API FDynamicBVH
+{
+public:
+    static constexpr Int32 NullNode = -1;
+
+    /**
+     * @param InFatMargin 叶子包围盒向各个方向扩大的距离
+     */
+    explicit FDynamicBVH(float InFatMargin = 0.1f);
+
+    /**
+     * 插入一个代理
+     * @param Box 世界空间包围盒
+     * @param UserData 剔除时返回的用户数据
+     * @return 代理 ID, 在 DestroyProxy 之前保持不变
+     */
+    Int32 CreateProxy(const FBox3f& Box, void* UserData);
+
+    void DestroyProxy(Int32 ProxyId);
+
+    /**
+     * 更新代理的包围盒, 只有离开扩大后的包围盒时才会重新插入
+     * @return 是否重新插入
+     */
+    bool MoveProxy(Int32 ProxyId, const FBox3f& Box);
+
+    void* GetUserData(Int32 ProxyId) const
+    {
+        return Nodes[ProxyId].UserData;
+    }
+
+    const FBox3f& GetFatBox(Int32 ProxyId) const
+    {
+        return Nodes[ProxyId].Box;
+    }
+
+    UInt32 GetProxyCount() const
+    {
+        return ProxyCount;
+    }
+
+    // 树高, 叶子为 0
+    Int32 GetHeight() const
+    {
+        return Root == NullNode ? 0 : Nodes[Root].Height;
+    }
+
+    void Clear();
+
+    /**
+     * 收集与视锥相交的全部代理
+     * 完全在视锥内的子树不再逐个测试; 代理数量较多时, 树的上层被拆成若干子树在 Worker 线程上并行遍历
+     * @param Frustum 视锥
+     * @param OutUserData 追加相交代理的用户数据, 顺序不保证
+     */
+    void CullFrustum(const FFrustum& Frustum, TArray<void*>& OutUserData) const;
+
+private:
+    struct FNode
+    {
+        FBox3f Box;
+        void*  UserData = nullptr;
+        // 在树中时为父节点, 在空闲链表中时为下一个空闲节点
+        Int32 ParentOrNext = NullNode;
+        Int32 Child1       = NullNode;
+        Int32 Child2       = NullNode;
+        // 叶子为 0, 空闲节点为 -1
+        Int32 Height = -1;
+
+        bool IsLeaf() const
+        {
+            return Child1 == NullNode;
+        }
+    };
+
+    TArray<FNode> Nodes;
+    Int32         Root       = NullNode;
+    Int32         FreeList   = NullNode;
+    UInt32        ProxyCount = 0;
+    float         FatMargin  = 0.1f;
+
+    Int32 AllocateNode();
+    void  FreeNode(Int32 NodeId);
+
+    void InsertLeaf(Int32 Leaf);
+    void RemoveLeaf(Int32 Leaf);
+
+    /**
+     * 若 A 的两棵子树高度差超过 1 则旋转
+     * @return 旋转后占据原 A 位置的节点
+     */
+    Int32 Balance(Int32 A);
+
+    void CullNode(Int32 NodeId, const FFrustum& Frustum, TArray<void*>& OutUserData) const;
+    void CollectLeaves(Int32 NodeId, TArray<void*>& OutUserData) const;
+};
@@ -0,0 +1,138 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "Frustum.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if HK_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+FFrustum FFrustum::FromViewProjection(const FMatrix4x4f& ViewProjection)
+{
+    FFrustum Frustum;
+
+    auto Row = [&ViewProjection](int Index) {
+        return FVector4f(ViewProjection(Index, 0), ViewProjection(Index, 1), ViewProjection(Index, 2),
+                         ViewProjection(Index, 3));
+    };
+    const FVector4f Row0 = Row(0);
+    const FVector4f Row1 = Row(1);
+    const FVector4f Row2 = Row(2);
+    const FVector4f Row3 = Row(3);
+
+    Frustum.Planes[0] = Row3 + Row0; // Left
+    Frustum.Planes[1] = Row3 - Row0; // Right
+    Frustum.Planes[2] = Row3 + Row1; // Top（NDC 的 y 轴向下）
+    Frustum.Planes[3] = Row3 - Row1; // Bottom
+    Frustum.Planes[4] = Row2;        // Near
+    Frustum.Planes[5] = Row3 - Row2; // Far
+    for (auto& Plane : Frustum.Planes)
+    {
+        const float Length = std::sqrt(Plane.X * Plane.X + Plane.Y * Plane.Y + Plane.Z * Plane.Z);
+        if (Length > 0.0f)
+        {
+            Plane = Plane * (1.0f / Length);
+        }
+    }
+
+    for (UInt32 Index = 0; Index < 8; ++Index)
+    {
+        const FVector4f& Plane   = Frustum.Planes[std::min(Index, PlaneCount - 1)];
+        Frustum.PlaneX[Index]    = Plane.X;
+        Frustum.PlaneY[Index]    = Plane.Y;
+        Frustum.PlaneZ[Index]    = Plane.Z;
+        Frustum.PlaneW[Index]    = Plane.W;
+        Frustum.AbsPlaneX[Index] = std::abs(Plane.X);
+        Frustum.AbsPlaneY[Index] = std::abs(Plane.Y);
+        Frustum.AbsPlaneZ[Index] = std::abs(Plane.Z);
+    }
+    return Frustum;
+}
+
+EFrustumTestResult FFrustum::TestBox(const FBox3f& Box) const
+{
+    const FVector3f Center = Box.GetCenter();
+    const FVector3f Extent = Box.GetExtent();
+
+#if HK_SIMD_SSE2
+    const __m128 CenterX = _mm_set1_ps(Center.X);
+    const __m128 CenterY = _mm_set1_ps(Center.Y);
+    const __m128 CenterZ = _mm_set1_ps(Center.Z);
+    const __m128 ExtentX = _mm_set1_ps(Extent.X);
+    const __m128 ExtentY = _mm_set1_ps(Extent.Y);
+    const __m128 ExtentZ = _mm_set1_ps(Extent.Z);
+    const __m128 Zero    = _mm_setzero_ps();
+
+    int OutsideMask = 0;
+    int InsideMask  = 0xFF;
+    for (UInt32 Offset = 0; Offset < 8; Offset += 4)
+    {
+        // 中心到平面的有符号距离, 以及包围盒在法线方向上的投影半径
+        __m128 Distance = _mm_mul_ps(_mm_load_ps(PlaneX + Offset), CenterX);
+        Distance        = _mm_add_ps(Distance, _mm_mul_ps(_mm_load_ps(PlaneY + Offset), CenterY));
+        Distance        = _mm_add_ps(Distance, _mm_mul_ps(_mm_load_ps(PlaneZ + Offset), CenterZ));
+        Distance        = _mm_add_ps(Distance, _mm_load_ps(PlaneW + Offset));
+        __m128 Radius   = _mm_mul_ps(_mm_load_ps(AbsPlaneX + Offset), ExtentX);
+        Radius          = _mm_add_ps(Radius, _mm_mul_ps(_mm_load_ps(AbsPlaneY + Offset), ExtentY));
+        Radius          = _mm_add_ps(Radius, _mm_mul_ps(_mm_load_ps(AbsPlaneZ + Offset), ExtentZ));
+
+        OutsideMask |= _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(Distance, Radius), Zero)) << Offset;
+        const int InsideBits = _mm_movemask_ps(_mm_cmpge_ps(_mm_sub_ps(Distance, Radius), Zero));
+        InsideMask &= (InsideBits << Offset) | ~(0xF << Offset);
+    }
+    if (OutsideMask != 0)
+    {
+        return EFrustumTestResult::Outside;
+    }
+    return InsideMask == 0xFF ? EFrustumTestResult::Inside : EFrustumTestResult::Intersect;
+#else
+    bool bInside = true;
+    for (UInt32 Index = 0; Index < PlaneCount; ++Index)
+    {
+        const float Distance = PlaneX[Index] * Center.X + PlaneY[Index] * Center.Y + PlaneZ[Index] * Center.Z +
+                               PlaneW[Index];
+        const float Radius = AbsPlaneX[Index] * Extent.X + AbsPlaneY[Index] * Extent.Y + AbsPlaneZ[Index] * Extent.Z;
+        if (Distance + Radius < 0.0f)
+        {
+            return EFrustumTestResult::Outside;
+        }
+        bInside &= Distance - Radius >= 0.0f;
+    }
+    return bInside ? EFrustumTestResult::Inside : EFrustumTestResult::Intersect;
+#endif
+}
+
+bool FFrustum::IntersectsBox(const FBox3f& Box) const
+{
+    const FVector3f Center = Box.GetCenter();
+    const FVector3f Extent = Box.GetExtent();
+
+#if HK_SIMD_SSE2
+    const __m128 CenterX = _mm_set1_ps(Center.X);
+    const __m128 CenterY = _mm_set1_ps(Center.Y);
+    const __m128 CenterZ = _mm_set1_ps(Center.Z);
+    const __m128 ExtentX = _mm_set1_ps(Extent.X);
+    const __m128 ExtentY = _mm_set1_ps(Extent.Y);
+    const __m128 ExtentZ = _mm_set1_ps(Extent.Z);
+
+    __m128 Outside = _mm_setzero_ps();
+    for (UInt32 Offset = 0; Offset < 8; Offset += 4)
+    {
+        __m128 Distance = _mm_mul_ps(_mm_load_ps(PlaneX + Offset), CenterX);
+        Distance        = _mm_add_ps(Distance, _mm_mul_ps(_mm_load_ps(PlaneY + Offset), CenterY));
+        Distance        = _mm_add_ps(Distance, _mm_mul_ps(_mm_load_ps(PlaneZ + Offset), CenterZ));
+        Distance        = _mm_add_ps(Distance, _mm_load_ps(PlaneW + Offset));
+        __m128 Radius   = _mm_mul_ps(_mm_load_ps(AbsPlaneX + Offset), ExtentX);
+        Radius          = _mm_add_ps(Radius, _mm_mul_ps(_mm_load_ps(AbsPlaneY + Offset), ExtentY));
+        Radius          = _mm_add_ps(Radius, _mm_mul_ps(_mm_load_ps(AbsPlaneZ + Offset), ExtentZ));
+        Outside         = _mm_or_ps(Outside, _mm_cmplt_ps(_mm_add_ps(Distance, Radius), _mm_setzero_ps()));
+    }
+    return _mm_movemask_ps(Outside) == 0;
+#else
+    return TestBox(Box) != EFrustumTestResult::Outside;
+#endif
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include "Math/Box.h"
+#include "Math/Matrix.h"
+#include "Math/Vector.h"
+
+enum class EFrustumTestResult : UInt8
+{
+    Outside,   // 完全在视锥外
+    Intersect, // 与视锥边界相交
+    Inside,    // 完全在视锥内
+};
+
+/**
+ * 视锥体, 6 个平面的法线指向视锥内部且已归一化
+ * 平面同时以 SoA 形式保存并补齐到 8 个, 包围盒测试一次处理 4 个平面
+ */
+class HK_API FFrustum
+{
+public:
+    static constexpr UInt32 PlaneCount = 6;
+
+    FFrustum() = default;
+
+    /**
+     * 从视图投影矩阵提取视锥平面（Gribb-Hartmann, 裁剪空间 -w <= x, y <= w, 0 <= z <= w）
+     * @param ViewProjection 列主序的视图投影矩阵
+     */
+    static FFrustum FromViewProjection(const FMatrix4x4f& ViewProjection);
+
+    /**
+     * 平面顺序: Left, Right, Top, Bottom, Near, Far; 点 P 在平面内侧当且仅当 dot(N, P) + W >= 0
+     */
+    const FVector4f& GetPlane(UInt32 Index) const
+    {
+        return Planes[Index];
+    }
+
+    /**
+     * 测试包围盒与视锥的关系
+     * @param Box 世界空间包围盒
+     */
+    EFrustumTestResult TestBox(const FBox3f& Box) const;
+
+    /**
+     * 只判断包围盒是否可能可见, 比 TestBox 少一次比较
+     */
+    bool IntersectsBox(const FBox3f& Box) const;
+
+private:
+    FVector4f Planes[PlaneCount];
+
+    // SoA 平面数据, 第 6, 7 个元素复制最后一个平面
+    alignas(16) float PlaneX[8] = {};
+    alignas(16) float PlaneY[8] = {};
+    alignas(16) float PlaneZ[8] = {};
+    alignas(16) float PlaneW[8] = {};
+    // 法线分量的绝对值, 用于计算包围盒在法线方向上的投影半径
+    alignas(16) float AbsPlaneX[8] = {};
+    alignas(16) float AbsPlaneY[8] = {};
+    alignas(16) float AbsPlaneZ[8] = {};
+};
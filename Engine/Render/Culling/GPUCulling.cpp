@@ -0,0 +1,567 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "GPUCulling.h"
+
+#include "Core/Logging/Logger.h"
+#include "Core/Utility/Profiler.h"
+#include "GPUCullingReference.h"
+#include "RHI/GfxDevice.h"
+#include "RHI/RHICommandBuffer.h"
+#include "Render/GlobalRenderResources.h"
+#include "Render/Shader/SlangTranslator.h"
+#include "Render/Texture/RenderTexture.h"
+
+#include <cstring>
+
+static constexpr const char* GPUCullingShaderPath = "GPUCulling.slang";
+
+// 与 GPUCulling.slang 中的绑定一致
+enum class EGPUCullingBinding : UInt32
+{
+    ViewParams,
+    Instances,
+    DrawBatches,
+    ModelMatrices,
+    DrawArgs,
+    DrawCounts,
+    HiZ,
+    Count,
+};
+
+FGPUCulling::~FGPUCulling()
+{
+    Release();
+}
+
+bool FGPUCulling::Initialize()
+{
+    HK_PROFILE_SCOPE_N("FGPUCulling::Initialize");
+
+    if (IsInitialized())
+    {
+        return true;
+    }
+
+    auto& GfxDevice = GetGfxDeviceRef();
+
+    FShaderTranslatorRequest Request;
+    Request.ShaderPath = FString(GPUCullingShaderPath);
+    FRHIShaderModuleDesc ShaderDesc;
+    ShaderDesc.DebugName = FString("GPUCulling");
+    FString ErrorMessage;
+    if (!FSlangTranslator::GetRef().RequestCompileComputeShader(Request, ShaderDesc.Code, ErrorMessage))
+    {
+        HK_LOG_ERROR(ELogcat::Render, "编译 GPU 剔除着色器失败: {}", ErrorMessage);
+        return false;
+    }
+    ComputeShader = GfxDevice.CreateShaderModule(ShaderDesc, ERHIShaderStage::Compute);
+
+    FRHIDescriptorSetLayoutDesc SetLayoutDesc;
+    SetLayoutDesc.DebugName = FString("DescSetLayout_GPUCulling");
+    const ERHIDescriptorType BindingTypes[] = {
+        ERHIDescriptorType::UniformBuffer, ERHIDescriptorType::StorageBuffer, ERHIDescriptorType::StorageBuffer,
+        ERHIDescriptorType::StorageBuffer, ERHIDescriptorType::StorageBuffer, ERHIDescriptorType::StorageBuffer,
+        ERHIDescriptorType::SampledImage,
+    };
+    static_assert(std::size(BindingTypes) == static_cast<size_t>(EGPUCullingBinding::Count));
+    for (UInt32 Binding = 0; Binding < static_cast<UInt32>(EGPUCullingBinding::Count); ++Binding)
+    {
+        FRHIDescriptorSetLayoutBinding LayoutBinding{};
+        LayoutBinding.Binding         = Binding;
+        LayoutBinding.DescriptorType  = BindingTypes[Binding];
+        LayoutBinding.DescriptorCount = 1;
+        LayoutBinding.StageFlags      = ERHIShaderStage::Compute;
+        SetLayoutDesc.Bindings.Add(LayoutBinding);
+    }
+    DescriptorSetLayout = GfxDevice.CreateDescriptorSetLayout(SetLayoutDesc);
+
+    FRHIPipelineLayoutDesc PipelineLayoutDesc;
+    PipelineLayoutDesc.SetLayouts.Add(DescriptorSetLayout);
+    PipelineLayoutDesc.DebugName = FString("PipelineLayout_GPUCulling");
+    PipelineLayout               = GfxDevice.CreatePipelineLayout(PipelineLayoutDesc);
+
+    FRHIComputePipelineDesc PipelineDesc;
+    PipelineDesc.Layout        = PipelineLayout;
+    PipelineDesc.ComputeShader = ComputeShader;
+    PipelineDesc.DebugName     = FString("Pipeline_GPUCulling");
+    Pipeline                   = GfxDevice.CreateComputePipeline(PipelineDesc);
+    if (!Pipeline.IsValid())
+    {
+        HK_LOG_ERROR(ELogcat::Render, "创建 GPU 剔除管线失败");
+        Release();
+        return false;
+    }
+
+    FRHIDescriptorPoolDesc PoolDesc;
+    PoolDesc.DebugName = FString("GPUCullingDescriptorPool");
+    PoolDesc.MaxSets   = HK_RENDER_MAX_FRAME_IN_FLIGHT;
+    PoolDesc.PoolSizes.Add({ERHIDescriptorType::UniformBuffer, HK_RENDER_MAX_FRAME_IN_FLIGHT});
+    PoolDesc.PoolSizes.Add({ERHIDescriptorType::StorageBuffer, 5 * HK_RENDER_MAX_FRAME_IN_FLIGHT});
+    PoolDesc.PoolSizes.Add({ERHIDescriptorType::SampledImage, HK_RENDER_MAX_FRAME_IN_FLIGHT});
+    DescriptorPool = GfxDevice.CreateDescriptorPool(PoolDesc);
+
+    DummyHiZ = MakeUnique<FRenderTexture>(1, 1, ERHIImageFormat::R32_SFloat, ERHIImageUsage::Sampled, "DummyHiZ");
+    bDummyHiZInitialized = false;
+    return true;
+}
+
+void FGPUCulling::Release()
+{
+    auto* GfxDevice = GetGfxDevice();
+    if (GfxDevice == nullptr)
+    {
+        return;
+    }
+
+    for (auto& Frame : FrameResources)
+    {
+        for (FRHIBuffer* Buffer : {&Frame.ViewParamsBuffer, &Frame.InstanceBuffer, &Frame.DrawBatchBuffer,
+                                   &Frame.DrawArgsBuffer, &Frame.DrawCountBuffer, &Frame.ReadbackArgsBuffer,
+                                   &Frame.ReadbackCountBuffer})
+        {
+            if (Buffer->IsValid())
+            {
+                GfxDevice->DestroyBuffer(*Buffer);
+            }
+        }
+        Frame = FFrameResources();
+    }
+
+    // 销毁描述符池会释放从中分配的描述符集
+    if (DescriptorPool.IsValid())
+    {
+        GfxDevice->DestroyDescriptorPool(DescriptorPool);
+    }
+    if (Pipeline.IsValid())
+    {
+        GfxDevice->DestroyPipeline(Pipeline);
+    }
+    if (PipelineLayout.IsValid())
+    {
+        GfxDevice->DestroyPipelineLayout(PipelineLayout);
+    }
+    if (DescriptorSetLayout.IsValid())
+    {
+        GfxDevice->DestroyDescriptorSetLayout(DescriptorSetLayout);
+    }
+    if (ComputeShader.IsValid())
+    {
+        GfxDevice->DestroyShaderModule(ComputeShader);
+    }
+    if (DummyHiZ)
+    {
+        DummyHiZ->Release();
+        DummyHiZ.Reset();
+    }
+}
+
+UInt32 FGPUCulling::AddDrawBatch(UInt32 IndexCount, UInt32 FirstIndex, Int32 VertexOffset)
+{
+    FGPUDrawBatch Batch;
+    Batch.IndexCount   = IndexCount;
+    Batch.FirstIndex   = FirstIndex;
+    Batch.VertexOffset = VertexOffset;
+    DrawBatches.Add(Batch);
+    bBatchLayoutDirty = true;
+    MarkBatchesDirty();
+    return static_cast<UInt32>(DrawBatches.Size()) - 1;
+}
+
+UInt32 FGPUCulling::AddInstance(const FGPUCullingInstance& Instance)
+{
+    HK_ASSERT_MSG(Instance.DrawBatchIndex < DrawBatches.Size(), "实例所属的绘制批次不存在");
+
+    UInt32 InstanceIndex;
+    if (!FreeInstanceIndices.IsEmpty())
+    {
+        InstanceIndex = FreeInstanceIndices[FreeInstanceIndices.Size() - 1];
+        FreeInstanceIndices.RemoveAt(FreeInstanceIndices.Size() - 1);
+        Instances[InstanceIndex] = Instance;
+    }
+    else
+    {
+        InstanceIndex = static_cast<UInt32>(Instances.Size());
+        Instances.Add(Instance);
+    }
+    Instances[InstanceIndex].Flags |= EGPUCullingInstanceFlag::Valid;
+
+    ++DrawBatches[Instance.DrawBatchIndex].Capacity;
+    bBatchLayoutDirty = true;
+    MarkInstancesDirty();
+    return InstanceIndex;
+}
+
+void FGPUCulling::UpdateInstance(UInt32 InstanceIndex, const FGPUCullingInstance& Instance)
+{
+    HK_ASSERT_MSG(InstanceIndex < Instances.Size(), "实例索引超出范围");
+    HK_ASSERT_MSG(Instances[InstanceIndex].DrawBatchIndex == Instance.DrawBatchIndex, "不允许修改实例所属的绘制批次");
+
+    Instances[InstanceIndex] = Instance;
+    Instances[InstanceIndex].Flags |= EGPUCullingInstanceFlag::Valid;
+    MarkInstancesDirty();
+}
+
+void FGPUCulling::RemoveInstance(UInt32 InstanceIndex)
+{
+    if (InstanceIndex >= Instances.Size() || !HasFlag(Instances[InstanceIndex].Flags, EGPUCullingInstanceFlag::Valid))
+    {
+        return;
+    }
+
+    --DrawBatches[Instances[InstanceIndex].DrawBatchIndex].Capacity;
+    Instances[InstanceIndex].Flags = EGPUCullingInstanceFlag::None;
+    FreeInstanceIndices.Add(InstanceIndex);
+    bBatchLayoutDirty = true;
+    MarkInstancesDirty();
+}
+
+void FGPUCulling::Reset()
+{
+    Instances.Clear();
+    FreeInstanceIndices.Clear();
+    DrawBatches.Clear();
+    bBatchLayoutDirty = true;
+    MarkInstancesDirty();
+}
+
+void FGPUCulling::SetHiZ(const FRHIImageView& View, UInt32 Width, UInt32 Height, UInt32 MipCount)
+{
+    HiZView     = View;
+    HiZSize     = FVector2f(static_cast<float>(Width), static_cast<float>(Height));
+    HiZMipCount = View.IsValid() ? MipCount : 0;
+}
+
+void FGPUCulling::UpdateBatchLayout()
+{
+    UInt32 ArgsOffset = 0;
+    for (auto& Batch : DrawBatches)
+    {
+        Batch.ArgsOffset = ArgsOffset;
+        ArgsOffset += Batch.Capacity;
+    }
+    TotalDrawArgsCapacity = ArgsOffset;
+    bBatchLayoutDirty     = false;
+    MarkBatchesDirty();
+}
+
+void FGPUCulling::MarkInstancesDirty()
+{
+    for (auto& Frame : FrameResources)
+    {
+        Frame.bInstancesDirty = true;
+    }
+}
+
+void FGPUCulling::MarkBatchesDirty()
+{
+    for (auto& Frame : FrameResources)
+    {
+        Frame.bBatchesDirty = true;
+    }
+}
+
+bool FGPUCulling::EnsureBufferSize(FRHIBuffer& Buffer, UInt64 RequiredSize, ERHIBufferUsage Usage,
+                                   ERHIBufferMemoryProperty MemoryProperty, FStringView DebugName)
+{
+    RequiredSize = std::max<UInt64>(RequiredSize, 256);
+    if (Buffer.IsValid() && Buffer.GetSize() >= RequiredSize)
+    {
+        return false;
+    }
+
+    auto&  GfxDevice = GetGfxDeviceRef();
+    UInt64 NewSize   = Buffer.IsValid() ? Buffer.GetSize() : 256;
+    while (NewSize < RequiredSize)
+    {
+        NewSize *= 2;
+    }
+    if (Buffer.IsValid())
+    {
+        GfxDevice.DestroyBuffer(Buffer);
+    }
+
+    FRHIBufferDesc BufferDesc{};
+    BufferDesc.Size           = NewSize;
+    BufferDesc.Usage          = Usage;
+    BufferDesc.MemoryProperty = MemoryProperty;
+    BufferDesc.DebugName      = FString(DebugName);
+    Buffer                    = GfxDevice.CreateBuffer(BufferDesc);
+    if (HasFlag(MemoryProperty, ERHIBufferMemoryProperty::HostVisible))
+    {
+        Buffer.Map();
+    }
+    return true;
+}
+
+void FGPUCulling::PrepareFrameResources(FFrameResources& Frame, const FRHIBuffer& ModelMatrixBuffer)
+{
+    constexpr auto Upload = ERHIBufferMemoryProperty::HostVisible | ERHIBufferMemoryProperty::HostCoherent;
+
+    bool bRecreated = false;
+    bRecreated |= EnsureBufferSize(Frame.ViewParamsBuffer, sizeof(FGPUCullingViewParams),
+                                   ERHIBufferUsage::UniformBuffer, Upload, "GPUCulling_ViewParams");
+    if (EnsureBufferSize(Frame.InstanceBuffer, Instances.Size() * sizeof(FGPUCullingInstance),
+                         ERHIBufferUsage::StorageBuffer, Upload, "GPUCulling_Instances"))
+    {
+        bRecreated            = true;
+        Frame.bInstancesDirty = true;
+    }
+    if (EnsureBufferSize(Frame.DrawBatchBuffer, DrawBatches.Size() * sizeof(FGPUDrawBatch),
+                         ERHIBufferUsage::StorageBuffer, Upload, "GPUCulling_DrawBatches"))
+    {
+        bRecreated          = true;
+        Frame.bBatchesDirty = true;
+    }
+    bRecreated |= EnsureBufferSize(Frame.DrawArgsBuffer, TotalDrawArgsCapacity * sizeof(FGPUDrawIndexedIndirectArgs),
+                                   ERHIBufferUsage::StorageBuffer | ERHIBufferUsage::IndirectBuffer |
+                                       ERHIBufferUsage::TransferSrc,
+                                   ERHIBufferMemoryProperty::DeviceLocal, "GPUCulling_DrawArgs");
+    bRecreated |= EnsureBufferSize(Frame.DrawCountBuffer, DrawBatches.Size() * sizeof(UInt32),
+                                   ERHIBufferUsage::StorageBuffer | ERHIBufferUsage::IndirectBuffer |
+                                       ERHIBufferUsage::TransferSrc | ERHIBufferUsage::TransferDst,
+                                   ERHIBufferMemoryProperty::DeviceLocal, "GPUCulling_DrawCounts");
+
+    // 实例与批次只在变化后上传，之后每帧只写入视图参数
+    if (Frame.bInstancesDirty)
+    {
+        std::memcpy(Frame.InstanceBuffer.GetMappedPtr(), Instances.Data(),
+                    Instances.Size() * sizeof(FGPUCullingInstance));
+        Frame.bInstancesDirty = false;
+    }
+    if (Frame.bBatchesDirty)
+    {
+        std::memcpy(Frame.DrawBatchBuffer.GetMappedPtr(), DrawBatches.Data(),
+                    DrawBatches.Size() * sizeof(FGPUDrawBatch));
+        Frame.bBatchesDirty = false;
+    }
+
+    const FRHIImageView& HiZ = HiZMipCount > 0 ? HiZView : DummyHiZ->GetRHIImageView();
+    if (!Frame.DescriptorSet.IsValid())
+    {
+        FRHIDescriptorSetDesc SetDesc;
+        SetDesc.Layout          = DescriptorSetLayout;
+        SetDesc.DebugName       = FString("DescSet_GPUCulling");
+        Frame.DescriptorSet     = GetGfxDeviceRef().AllocateDescriptorSet(DescriptorPool, SetDesc);
+        Frame.bDescriptorsDirty = true;
+    }
+    if (!bRecreated && !Frame.bDescriptorsDirty && Frame.BoundModelMatrixBuffer == ModelMatrixBuffer &&
+        Frame.BoundHiZ == HiZ)
+    {
+        return;
+    }
+
+    TArray<FRHIWriteDescriptorSet> Writes;
+    auto AddBufferWrite = [&Writes](EGPUCullingBinding Binding, ERHIDescriptorType Type, const FRHIBuffer& Buffer) {
+        FRHIWriteDescriptorSet Write{};
+        Write.DstBinding     = static_cast<UInt32>(Binding);
+        Write.DescriptorType = Type;
+        FRHIDescriptorBufferInfo BufferInfo{};
+        BufferInfo.Buffer = Buffer;
+        Write.BufferInfo.Add(BufferInfo);
+        Writes.Add(Write);
+    };
+    AddBufferWrite(EGPUCullingBinding::ViewParams, ERHIDescriptorType::UniformBuffer, Frame.ViewParamsBuffer);
+    AddBufferWrite(EGPUCullingBinding::Instances, ERHIDescriptorType::StorageBuffer, Frame.InstanceBuffer);
+    AddBufferWrite(EGPUCullingBinding::DrawBatches, ERHIDescriptorType::StorageBuffer, Frame.DrawBatchBuffer);
+    AddBufferWrite(EGPUCullingBinding::ModelMatrices, ERHIDescriptorType::StorageBuffer, ModelMatrixBuffer);
+    AddBufferWrite(EGPUCullingBinding::DrawArgs, ERHIDescriptorType::StorageBuffer, Frame.DrawArgsBuffer);
+    AddBufferWrite(EGPUCullingBinding::DrawCounts, ERHIDescriptorType::StorageBuffer, Frame.DrawCountBuffer);
+
+    FRHIWriteDescriptorSet HiZWrite{};
+    HiZWrite.DstBinding     = static_cast<UInt32>(EGPUCullingBinding::HiZ);
+    HiZWrite.DescriptorType = ERHIDescriptorType::SampledImage;
+    FRHIDescriptorImageInfo ImageInfo{};
+    ImageInfo.ImageView   = HiZ;
+    ImageInfo.ImageLayout = ERHIImageLayout::ShaderReadOnlyOptimal;
+    HiZWrite.ImageInfo.Add(ImageInfo);
+    Writes.Add(HiZWrite);
+
+    GetGfxDeviceRef().UpdateDescriptorSet(Frame.DescriptorSet, Writes);
+    Frame.BoundModelMatrixBuffer = ModelMatrixBuffer;
+    Frame.BoundHiZ               = HiZ;
+    Frame.bDescriptorsDirty      = false;
+}
+
+void FGPUCulling::RecordCulling(FRHICommandBuffer& Commands, UInt32 FrameIndex, const FMatrix4x4f& ViewProjection)
+{
+    HK_PROFILE_SCOPE_N("FGPUCulling::RecordCulling");
+    HK_ASSERT_MSG(IsInitialized(), "FGPUCulling 未初始化");
+    HK_ASSERT_MSG(FrameIndex < FrameResources.Size(), "在途帧索引超出范围");
+
+    // 再次录制同一在途帧时, 上一次提交的命令已经执行完成, 回读结果可以读取
+    FFrameResources& Frame = FrameResources[FrameIndex];
+    if (Frame.bValidationPending)
+    {
+        ValidateFrame(Frame);
+    }
+
+    if (bBatchLayoutDirty)
+    {
+        UpdateBatchLayout();
+    }
+
+    PrepareFrameResources(Frame, FGlobalDynamicRenderResourcePool::GetRef().GetModelMatrixBuffer(FrameIndex));
+
+    // 视锥平面在 CPU 提取一次，GPU 每个实例只做点积；HiZ 由调用方提供，这里只填写尺寸信息
+    FGPUCullingViewParams View =
+        FGPUCullingReference::MakeViewParams(ViewProjection, nullptr, static_cast<UInt32>(Instances.Size()));
+    View.HiZSize     = HiZSize;
+    View.HiZMipCount = HiZMipCount;
+    std::memcpy(Frame.ViewParamsBuffer.GetMappedPtr(), &View, sizeof(View));
+
+    if (!bDummyHiZInitialized)
+    {
+        FRHIImageMemoryBarrier HiZBarrier;
+        HiZBarrier.DstAccessMask = ERHIAccessFlag::ShaderRead;
+        HiZBarrier.OldLayout     = ERHIImageLayout::Undefined;
+        HiZBarrier.NewLayout     = ERHIImageLayout::ShaderReadOnlyOptimal;
+        HiZBarrier.Image         = DummyHiZ->GetRHIImage();
+        Commands.PipelineBarrier(ERHIPipelineStageFlag::TopOfPipe, ERHIPipelineStageFlag::ComputeShader,
+                                 ERHIDependencyFlag::None, {}, {}, {HiZBarrier});
+        bDummyHiZInitialized = true;
+    }
+
+    const UInt64 CountSize = DrawBatches.Size() * sizeof(UInt32);
+    if (CountSize == 0)
+    {
+        return;
+    }
+
+    // 上一次使用本帧资源的间接绘制读取完成后才能清零计数
+    FRHIBufferMemoryBarrier CountBarrier;
+    CountBarrier.SrcAccessMask = ERHIAccessFlag::IndirectRead;
+    CountBarrier.DstAccessMask = ERHIAccessFlag::TransferWrite;
+    CountBarrier.Buffer        = Frame.DrawCountBuffer;
+    CountBarrier.Size          = CountSize;
+    Commands.PipelineBarrier(ERHIPipelineStageFlag::DrawIndirect, ERHIPipelineStageFlag::Transfer,
+                             ERHIDependencyFlag::None, {}, {CountBarrier}, {});
+    Commands.FillBuffer(Frame.DrawCountBuffer, 0, CountSize, 0);
+
+    FRHIBufferMemoryBarrier ArgsBarrier;
+    ArgsBarrier.SrcAccessMask = ERHIAccessFlag::IndirectRead;
+    ArgsBarrier.DstAccessMask = ERHIAccessFlag::ShaderWrite;
+    ArgsBarrier.Buffer        = Frame.DrawArgsBuffer;
+    CountBarrier.SrcAccessMask = ERHIAccessFlag::TransferWrite;
+    CountBarrier.DstAccessMask = ERHIAccessFlag::ShaderRead | ERHIAccessFlag::ShaderWrite;
+    Commands.PipelineBarrier(ERHIPipelineStageFlag::Transfer | ERHIPipelineStageFlag::DrawIndirect,
+                             ERHIPipelineStageFlag::ComputeShader, ERHIDependencyFlag::None, {},
+                             {CountBarrier, ArgsBarrier}, {});
+
+    if (!Instances.IsEmpty())
+    {
+        Commands.BindComputePipeline(Pipeline);
+        Commands.BindDescriptorSet(ERHIPipelineType::Compute, PipelineLayout, Frame.DescriptorSet);
+        const UInt32 GroupCount = (static_cast<UInt32>(Instances.Size()) + HK_GPU_CULLING_THREAD_GROUP_SIZE - 1) /
+                                  HK_GPU_CULLING_THREAD_GROUP_SIZE;
+        Commands.Dispatch(GroupCount);
+    }
+
+    // 剔除结果作为间接绘制参数
+    ArgsBarrier.SrcAccessMask  = ERHIAccessFlag::ShaderWrite;
+    ArgsBarrier.DstAccessMask  = ERHIAccessFlag::IndirectRead;
+    CountBarrier.SrcAccessMask = ERHIAccessFlag::ShaderWrite;
+    CountBarrier.DstAccessMask = ERHIAccessFlag::IndirectRead;
+    Commands.PipelineBarrier(ERHIPipelineStageFlag::ComputeShader, ERHIPipelineStageFlag::DrawIndirect,
+                             ERHIDependencyFlag::None, {}, {CountBarrier, ArgsBarrier}, {});
+
+    if (bValidationEnabled && HiZMipCount == 0)
+    {
+        RecordValidation(Commands, Frame, View);
+    }
+}
+
+void FGPUCulling::RecordValidation(FRHICommandBuffer& Commands, FFrameResources& Frame,
+                                   const FGPUCullingViewParams& View)
+{
+    HK_PROFILE_SCOPE_N("FGPUCulling::RecordValidation");
+
+    constexpr auto Readback = ERHIBufferMemoryProperty::HostVisible | ERHIBufferMemoryProperty::HostCoherent |
+                              ERHIBufferMemoryProperty::HostCached;
+    const UInt64   ArgsSize  = TotalDrawArgsCapacity * sizeof(FGPUDrawIndexedIndirectArgs);
+    const UInt64   CountSize = DrawBatches.Size() * sizeof(UInt32);
+    EnsureBufferSize(Frame.ReadbackArgsBuffer, ArgsSize, ERHIBufferUsage::TransferDst, Readback,
+                     "GPUCulling_ReadbackArgs");
+    EnsureBufferSize(Frame.ReadbackCountBuffer, CountSize, ERHIBufferUsage::TransferDst, Readback,
+                     "GPUCulling_ReadbackCounts");
+
+    FRHIBufferMemoryBarrier ArgsBarrier;
+    ArgsBarrier.SrcAccessMask = ERHIAccessFlag::ShaderWrite;
+    ArgsBarrier.DstAccessMask = ERHIAccessFlag::TransferRead;
+    ArgsBarrier.Buffer        = Frame.DrawArgsBuffer;
+    FRHIBufferMemoryBarrier CountBarrier;
+    CountBarrier.SrcAccessMask = ERHIAccessFlag::ShaderWrite;
+    CountBarrier.DstAccessMask = ERHIAccessFlag::TransferRead;
+    CountBarrier.Buffer        = Frame.DrawCountBuffer;
+    CountBarrier.Size          = CountSize;
+    Commands.PipelineBarrier(ERHIPipelineStageFlag::ComputeShader, ERHIPipelineStageFlag::Transfer,
+                             ERHIDependencyFlag::None, {}, {CountBarrier, ArgsBarrier}, {});
+
+    if (ArgsSize > 0)
+    {
+        const FRHIBufferCopyRegion ArgsRegion{0, 0, ArgsSize};
+        Commands.CopyBuffer(Frame.DrawArgsBuffer, Frame.ReadbackArgsBuffer, {&ArgsRegion, 1});
+    }
+    const FRHIBufferCopyRegion CountRegion{0, 0, CountSize};
+    Commands.CopyBuffer(Frame.DrawCountBuffer, Frame.ReadbackCountBuffer, {&CountRegion, 1});
+
+    FRHIBufferMemoryBarrier ReadbackArgsBarrier;
+    ReadbackArgsBarrier.SrcAccessMask = ERHIAccessFlag::TransferWrite;
+    ReadbackArgsBarrier.DstAccessMask = ERHIAccessFlag::HostRead;
+    ReadbackArgsBarrier.Buffer        = Frame.ReadbackArgsBuffer;
+    FRHIBufferMemoryBarrier ReadbackCountBarrier = ReadbackArgsBarrier;
+    ReadbackCountBarrier.Buffer                  = Frame.ReadbackCountBuffer;
+    Commands.PipelineBarrier(ERHIPipelineStageFlag::Transfer, ERHIPipelineStageFlag::Host, ERHIDependencyFlag::None,
+                             {}, {ReadbackArgsBarrier, ReadbackCountBarrier}, {});
+
+    // 期望结果使用与 GPU 相同的输入在录制时计算, 之后实例或矩阵变化不影响比较
+    const TArray<FMatrix4x4f>& ModelMatrices = FGlobalDynamicRenderResourcePool::GetRef().GetRenderModelMatrices();
+    Frame.ExpectedBatches                    = DrawBatches;
+    FGPUCullingReference::Cull(TSpan<const FGPUCullingInstance>(Instances.Data(), Instances.Size()),
+                               TSpan<const FGPUDrawBatch>(DrawBatches.Data(), DrawBatches.Size()),
+                               TSpan<const FMatrix4x4f>(ModelMatrices.Data(), ModelMatrices.Size()), View, nullptr,
+                               Frame.ExpectedArgs, Frame.ExpectedCounts);
+    Frame.bValidationPending = true;
+}
+
+void FGPUCulling::ValidateFrame(FFrameResources& Frame)
+{
+    HK_PROFILE_SCOPE_N("FGPUCulling::ValidateFrame");
+
+    Frame.bValidationPending = false;
+    ++ValidatedFrameCount;
+
+    const auto* Args   = static_cast<const FGPUDrawIndexedIndirectArgs*>(Frame.ReadbackArgsBuffer.GetMappedPtr());
+    const auto* Counts = static_cast<const UInt32*>(Frame.ReadbackCountBuffer.GetMappedPtr());
+    UInt32      MismatchBatch = 0;
+    if (FGPUCullingReference::CompareResults(
+            TSpan<const FGPUDrawBatch>(Frame.ExpectedBatches.Data(), Frame.ExpectedBatches.Size()),
+            TSpan<const FGPUDrawIndexedIndirectArgs>(Args, Frame.ExpectedArgs.Size()),
+            TSpan<const UInt32>(Counts, Frame.ExpectedBatches.Size()),
+            TSpan<const FGPUDrawIndexedIndirectArgs>(Frame.ExpectedArgs.Data(), Frame.ExpectedArgs.Size()),
+            TSpan<const UInt32>(Frame.ExpectedCounts.Data(), Frame.ExpectedCounts.Size()), &MismatchBatch))
+    {
+        return;
+    }
+
+    ++MismatchedFrameCount;
+    HK_LOG_WARN(ELogcat::Render, "GPU 剔除结果与 CPU 参考实现不一致: 批次 {}, GPU 可见 {}, CPU 可见 {}", MismatchBatch,
+                Counts[MismatchBatch], Frame.ExpectedCounts[MismatchBatch]);
+}
+
+void FGPUCulling::RecordDrawBatch(FRHICommandBuffer& Commands, UInt32 FrameIndex, UInt32 BatchIndex) const
+{
+    HK_ASSERT_MSG(FrameIndex < FrameResources.Size(), "在途帧索引超出范围");
+    HK_ASSERT_MSG(BatchIndex < DrawBatches.Size(), "绘制批次索引超出范围");
+
+    const FGPUDrawBatch&   Batch = DrawBatches[BatchIndex];
+    const FFrameResources& Frame = FrameResources[FrameIndex];
+    if (Batch.Capacity == 0)
+    {
+        return;
+    }
+    Commands.DrawIndexedIndirectCount(Frame.DrawArgsBuffer, Batch.ArgsOffset * sizeof(FGPUDrawIndexedIndirectArgs),
+                                      Frame.DrawCountBuffer, BatchIndex * sizeof(UInt32), Batch.Capacity,
+                                      sizeof(FGPUDrawIndexedIndirectArgs));
+}
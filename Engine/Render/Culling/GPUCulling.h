@@ -0,0 +1,215 @@
+#pragma once
+#include "Core/Container/Array.h"
+#include "Core/Container/FixedArray.h"
+#include "Core/Utility/UniquePtr.h"
+#include "GPUCullingTypes.h"
+#include "RHI/RHIBuffer.h"
+#include "RHI/RHIDescriptorSet.h"
+#include "RHI/RHIImageView.h"
+#include "RHI/RHIPipeline.h"
+#include "Render/RenderOptions.h"
+
+class FRHICommandBuffer;
+class FRenderTexture;
+
+/**
+ * GPU 驱动的剔除与间接绘制
+ * 实例数据常驻 GPU，每帧由计算着色器做视锥剔除与 HiZ 遮挡剔除，并把可见实例压缩写入每个绘制批次的
+ * DrawIndexedIndirect 参数区间，绘制时每个批次只需一次 DrawIndexedIndirectCount
+ * 每帧的 CPU 开销只与批次数量有关，与实例数量无关；实例数据只在发生变化时上传
+ *
+ * 使用方式：
+ *   1. Initialize
+ *   2. AddDrawBatch 注册网格 + 材质，AddInstance / UpdateInstance / RemoveInstance 维护实例
+ *   3. 每帧在绘制之前 RecordCulling，在渲染通道内对每个批次绑定管线与顶点/索引缓冲区后 RecordDrawBatch
+ * 开启校验后，每帧把剔除结果回读到 CPU，在下一次使用同一在途帧时与 FGPUCullingReference 的结果比较
+ */
+class HK_API FGPUCulling
+{
+public:
+    FGPUCulling() = default;
+    ~FGPUCulling();
+
+    FGPUCulling(const FGPUCulling&)            = delete;
+    FGPUCulling& operator=(const FGPUCulling&) = delete;
+
+    /**
+     * 编译剔除着色器并创建管线与描述符池
+     * @return 成功返回 true
+     */
+    bool Initialize();
+
+    /**
+     * 释放所有 GPU 资源，调用前需确保 GPU 不再使用
+     */
+    void Release();
+
+    bool IsInitialized() const
+    {
+        return Pipeline.IsValid();
+    }
+
+    /**
+     * 注册一个绘制批次
+     * @param IndexCount 网格的索引数量
+     * @param FirstIndex 网格在索引缓冲区中的起始索引
+     * @param VertexOffset 网格在顶点缓冲区中的顶点偏移
+     * @return 批次索引
+     */
+    UInt32 AddDrawBatch(UInt32 IndexCount, UInt32 FirstIndex = 0, Int32 VertexOffset = 0);
+
+    /**
+     * 添加实例，优先复用已移除实例的位置
+     * @return 实例索引，同时也是绘制时的 FirstInstance
+     */
+    UInt32 AddInstance(const FGPUCullingInstance& Instance);
+
+    /**
+     * 更新实例的包围球、模型矩阵索引或材质，不允许修改所属批次
+     */
+    void UpdateInstance(UInt32 InstanceIndex, const FGPUCullingInstance& Instance);
+
+    void RemoveInstance(UInt32 InstanceIndex);
+
+    /**
+     * 移除所有实例与批次，保留 GPU 资源，用于每帧从绘制列表重新填充
+     */
+    void Reset();
+
+    /**
+     * 开启后把每帧的剔除结果与 CPU 参考实现比较，不一致时输出警告；HiZ 开启的帧不校验
+     */
+    void SetValidationEnabled(bool bEnabled)
+    {
+        bValidationEnabled = bEnabled;
+    }
+
+    bool IsValidationEnabled() const
+    {
+        return bValidationEnabled;
+    }
+
+    /**
+     * 已完成校验的帧数与其中结果不一致的帧数
+     */
+    UInt64 GetValidatedFrameCount() const
+    {
+        return ValidatedFrameCount;
+    }
+
+    UInt64 GetMismatchedFrameCount() const
+    {
+        return MismatchedFrameCount;
+    }
+
+    /**
+     * 设置上一帧的深度最大值金字塔，View 需要包含全部 mip 并处于 ShaderReadOnlyOptimal
+     * @param MipCount 为 0 时关闭遮挡剔除
+     */
+    void SetHiZ(const FRHIImageView& View, UInt32 Width, UInt32 Height, UInt32 MipCount);
+
+    /**
+     * 上传本帧需要的数据并录制剔除，必须在渲染通道之外调用
+     * @param Commands 命令缓冲区
+     * @param FrameIndex 在途帧索引
+     * @param ViewProjection 投影矩阵 * 视图矩阵
+     */
+    void RecordCulling(FRHICommandBuffer& Commands, UInt32 FrameIndex, const FMatrix4x4f& ViewProjection);
+
+    /**
+     * 录制一个批次的间接绘制，调用前需要绑定该批次的管线与顶点/索引缓冲区
+     */
+    void RecordDrawBatch(FRHICommandBuffer& Commands, UInt32 FrameIndex, UInt32 BatchIndex) const;
+
+    const TArray<FGPUCullingInstance>& GetInstances() const
+    {
+        return Instances;
+    }
+
+    const TArray<FGPUDrawBatch>& GetDrawBatches() const
+    {
+        return DrawBatches;
+    }
+
+private:
+    /**
+     * 每个在途帧一份，GPU 读取上一帧数据时 CPU 可以安全地写入本帧数据
+     */
+    struct FFrameResources
+    {
+        FRHIBuffer        ViewParamsBuffer;
+        FRHIBuffer        InstanceBuffer;
+        FRHIBuffer        DrawBatchBuffer;
+        FRHIBuffer        DrawArgsBuffer;
+        FRHIBuffer        DrawCountBuffer;
+        FRHIDescriptorSet DescriptorSet;
+
+        // 校验用的回读缓冲区与录制时 CPU 参考实现的结果
+        FRHIBuffer                          ReadbackArgsBuffer;
+        FRHIBuffer                          ReadbackCountBuffer;
+        TArray<FGPUDrawBatch>               ExpectedBatches;
+        TArray<FGPUDrawIndexedIndirectArgs> ExpectedArgs;
+        TArray<UInt32>                      ExpectedCounts;
+        bool                                bValidationPending = false;
+
+        // 当前描述符集中绑定的资源，变化时才更新描述符
+        FRHIBuffer    BoundModelMatrixBuffer;
+        FRHIImageView BoundHiZ;
+
+        bool bInstancesDirty   = true;
+        bool bBatchesDirty     = true;
+        bool bDescriptorsDirty = true;
+    };
+
+    /**
+     * 重新计算每个批次在绘制参数缓冲区中的区间
+     */
+    void UpdateBatchLayout();
+
+    void MarkInstancesDirty();
+    void MarkBatchesDirty();
+
+    /**
+     * 确保缓冲区至少有 RequiredSize 字节，不足时按 2 倍增长重新创建
+     * @return 缓冲区被重新创建时返回 true
+     */
+    static bool EnsureBufferSize(FRHIBuffer& Buffer, UInt64 RequiredSize, ERHIBufferUsage Usage,
+                                 ERHIBufferMemoryProperty MemoryProperty, FStringView DebugName);
+
+    void PrepareFrameResources(FFrameResources& Frame, const FRHIBuffer& ModelMatrixBuffer);
+
+    /**
+     * 把本帧的剔除结果复制到回读缓冲区，并用 CPU 参考实现计算期望结果
+     */
+    void RecordValidation(FRHICommandBuffer& Commands, FFrameResources& Frame, const FGPUCullingViewParams& View);
+
+    /**
+     * 比较回读的结果与期望结果，调用时 GPU 必须已经执行完上一次使用该在途帧的命令
+     */
+    void ValidateFrame(FFrameResources& Frame);
+
+    TArray<FGPUCullingInstance> Instances;
+    TArray<UInt32>              FreeInstanceIndices;
+    TArray<FGPUDrawBatch>       DrawBatches;
+    UInt32                      TotalDrawArgsCapacity = 0;
+    bool                        bBatchLayoutDirty     = false;
+
+    FRHIImageView HiZView;
+    FVector2f     HiZSize;
+    UInt32        HiZMipCount = 0;
+
+    FRHIShaderModule        ComputeShader;
+    FRHIDescriptorSetLayout DescriptorSetLayout;
+    FRHIPipelineLayout      PipelineLayout;
+    FRHIPipeline            Pipeline;
+    FRHIDescriptorPool      DescriptorPool;
+    // HiZ 关闭时绑定的占位纹理
+    TUniquePtr<FRenderTexture> DummyHiZ;
+    bool                       bDummyHiZInitialized = false;
+
+    bool   bValidationEnabled   = false;
+    UInt64 ValidatedFrameCount  = 0;
+    UInt64 MismatchedFrameCount = 0;
+
+    TFixedArray<FFrameResources, HK_RENDER_MAX_FRAME_IN_FLIGHT> FrameResources;
+};
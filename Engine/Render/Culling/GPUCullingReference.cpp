@@ -0,0 +1,254 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "GPUCullingReference.h"
+#include "Frustum.h"
+
+#include <algorithm>
+#include <cmath>
+
+static constexpr float CullingNearEpsilon = 1e-4f;
+
+void FHiZPyramid::Build(TSpan<const float> Depth, UInt32 InWidth, UInt32 InHeight)
+{
+    Width  = InWidth;
+    Height = InHeight;
+    Mips.Clear();
+    if (Width == 0 || Height == 0 || Depth.Size() < static_cast<size_t>(Width) * Height)
+    {
+        return;
+    }
+
+    TArray<float> Mip0;
+    Mip0.Resize(static_cast<size_t>(Width) * Height);
+    std::copy(Depth.begin(), Depth.begin() + Mip0.Size(), Mip0.begin());
+    Mips.Add(std::move(Mip0));
+
+    UInt32 SrcWidth  = Width;
+    UInt32 SrcHeight = Height;
+    while (SrcWidth > 1 || SrcHeight > 1)
+    {
+        const UInt32         DstWidth  = std::max(SrcWidth >> 1, 1u);
+        const UInt32         DstHeight = std::max(SrcHeight >> 1, 1u);
+        const TArray<float>& Src       = Mips[Mips.Size() - 1];
+
+        TArray<float> Dst;
+        Dst.Resize(static_cast<size_t>(DstWidth) * DstHeight);
+        for (UInt32 Y = 0; Y < DstHeight; ++Y)
+        {
+            // 奇数尺寸时最后一行/列还要包含多出的源像素，保证保守
+            const UInt32 SrcY0 = Y * 2;
+            const UInt32 SrcY1 = (Y == DstHeight - 1) ? SrcHeight : std::min(SrcY0 + 2, SrcHeight);
+            for (UInt32 X = 0; X < DstWidth; ++X)
+            {
+                const UInt32 SrcX0    = X * 2;
+                const UInt32 SrcX1    = (X == DstWidth - 1) ? SrcWidth : std::min(SrcX0 + 2, SrcWidth);
+                float        MaxDepth = 0.0f;
+                for (UInt32 SrcY = SrcY0; SrcY < SrcY1; ++SrcY)
+                {
+                    for (UInt32 SrcX = SrcX0; SrcX < SrcX1; ++SrcX)
+                    {
+                        MaxDepth = std::max(MaxDepth, Src[SrcY * SrcWidth + SrcX]);
+                    }
+                }
+                Dst[Y * DstWidth + X] = MaxDepth;
+            }
+        }
+        Mips.Add(std::move(Dst));
+        SrcWidth  = DstWidth;
+        SrcHeight = DstHeight;
+    }
+}
+
+FGPUCullingViewParams FGPUCullingReference::MakeViewParams(const FMatrix4x4f& ViewProjection, const FHiZPyramid* HiZ,
+                                                           UInt32 InstanceCount)
+{
+    FGPUCullingViewParams View;
+    View.ViewProjection = ViewProjection;
+    View.InstanceCount  = InstanceCount;
+
+    const FFrustum Frustum = FFrustum::FromViewProjection(ViewProjection);
+    for (UInt32 Index = 0; Index < FFrustum::PlaneCount; ++Index)
+    {
+        View.FrustumPlanes[Index] = Frustum.GetPlane(Index);
+    }
+
+    if (HiZ != nullptr && HiZ->GetMipCount() > 0)
+    {
+        View.HiZSize     = FVector2f(static_cast<float>(HiZ->Width), static_cast<float>(HiZ->Height));
+        View.HiZMipCount = HiZ->GetMipCount();
+    }
+    return View;
+}
+
+float FGPUCullingReference::GetMaxScale(const FMatrix4x4f& Model)
+{
+    auto ColumnLength = [&Model](int Column) {
+        return std::sqrt(Model(0, Column) * Model(0, Column) + Model(1, Column) * Model(1, Column) +
+                         Model(2, Column) * Model(2, Column));
+    };
+    return std::max(ColumnLength(0), std::max(ColumnLength(1), ColumnLength(2)));
+}
+
+bool FGPUCullingReference::IsSphereInFrustum(const FGPUCullingViewParams& View, const FVector3f& Center, float Radius)
+{
+    for (const auto& Plane : View.FrustumPlanes)
+    {
+        if (Plane.X * Center.X + Plane.Y * Center.Y + Plane.Z * Center.Z + Plane.W < -Radius)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FGPUCullingReference::IsSphereOccluded(const FGPUCullingViewParams& View, const FHiZPyramid& HiZ,
+                                            const FVector3f& Center, float Radius)
+{
+    float UVMinX   = 1.0f;
+    float UVMinY   = 1.0f;
+    float UVMaxX   = 0.0f;
+    float UVMaxY   = 0.0f;
+    float MinDepth = 1.0f;
+    for (UInt32 Corner = 0; Corner < 8; ++Corner)
+    {
+        const FVector4f Position(Center.X + ((Corner & 1) ? Radius : -Radius),
+                                 Center.Y + ((Corner & 2) ? Radius : -Radius),
+                                 Center.Z + ((Corner & 4) ? Radius : -Radius), 1.0f);
+        const FVector4f Clip = View.ViewProjection * Position;
+        if (Clip.W <= CullingNearEpsilon)
+        {
+            // 与近平面相交，保守地视为可见
+            return false;
+        }
+        const float U = Clip.X / Clip.W * 0.5f + 0.5f;
+        const float V = Clip.Y / Clip.W * 0.5f + 0.5f;
+        UVMinX        = std::min(UVMinX, U);
+        UVMinY        = std::min(UVMinY, V);
+        UVMaxX        = std::max(UVMaxX, U);
+        UVMaxY        = std::max(UVMaxY, V);
+        MinDepth      = std::min(MinDepth, Clip.Z / Clip.W);
+    }
+    UVMinX = std::clamp(UVMinX, 0.0f, 1.0f);
+    UVMinY = std::clamp(UVMinY, 0.0f, 1.0f);
+    UVMaxX = std::clamp(UVMaxX, 0.0f, 1.0f);
+    UVMaxY = std::clamp(UVMaxY, 0.0f, 1.0f);
+
+    const float  ExtentX   = (UVMaxX - UVMinX) * View.HiZSize.X;
+    const float  ExtentY   = (UVMaxY - UVMinY) * View.HiZSize.Y;
+    const auto   Mip       = std::min(static_cast<UInt32>(std::ceil(std::log2(std::max({ExtentX, ExtentY, 1.0f})))),
+                                      View.HiZMipCount - 1);
+    const UInt32 MipWidth  = HiZ.GetMipWidth(Mip);
+    const UInt32 MipHeight = HiZ.GetMipHeight(Mip);
+    const UInt32 TexMinX   = std::min(static_cast<UInt32>(UVMinX * MipWidth), MipWidth - 1);
+    const UInt32 TexMinY   = std::min(static_cast<UInt32>(UVMinY * MipHeight), MipHeight - 1);
+    const UInt32 TexMaxX   = std::min(static_cast<UInt32>(UVMaxX * MipWidth), MipWidth - 1);
+    const UInt32 TexMaxY   = std::min(static_cast<UInt32>(UVMaxY * MipHeight), MipHeight - 1);
+
+    const float MaxDepth = std::max({HiZ.Load(Mip, TexMinX, TexMinY), HiZ.Load(Mip, TexMaxX, TexMinY),
+                                     HiZ.Load(Mip, TexMinX, TexMaxY), HiZ.Load(Mip, TexMaxX, TexMaxY)});
+    return MinDepth > MaxDepth;
+}
+
+void FGPUCullingReference::Cull(TSpan<const FGPUCullingInstance> Instances, TSpan<const FGPUDrawBatch> Batches,
+                                TSpan<const FMatrix4x4f> ModelMatrices, const FGPUCullingViewParams& View,
+                                const FHiZPyramid* HiZ, TArray<FGPUDrawIndexedIndirectArgs>& OutArgs,
+                                TArray<UInt32>& OutCounts)
+{
+    UInt32 TotalCapacity = 0;
+    for (const auto& Batch : Batches)
+    {
+        TotalCapacity = std::max(TotalCapacity, Batch.ArgsOffset + Batch.Capacity);
+    }
+    OutArgs.Clear();
+    OutArgs.Resize(TotalCapacity);
+    OutCounts.Clear();
+    OutCounts.Resize(Batches.Size(), 0);
+
+    const bool   bOcclusion    = View.HiZMipCount > 0 && HiZ != nullptr;
+    const UInt32 InstanceCount = std::min(View.InstanceCount, static_cast<UInt32>(Instances.Size()));
+    for (UInt32 InstanceIndex = 0; InstanceIndex < InstanceCount; ++InstanceIndex)
+    {
+        const FGPUCullingInstance& Instance = Instances[InstanceIndex];
+        if (!HasFlag(Instance.Flags, EGPUCullingInstanceFlag::Valid))
+        {
+            continue;
+        }
+
+        const FMatrix4x4f& Model = ModelMatrices[Instance.ModelMatrixIndex];
+        const FVector4f    WorldCenter =
+            Model * FVector4f(Instance.BoundsCenter.X, Instance.BoundsCenter.Y, Instance.BoundsCenter.Z, 1.0f);
+        const FVector3f Center(WorldCenter.X, WorldCenter.Y, WorldCenter.Z);
+        const float     Radius = Instance.BoundsRadius * GetMaxScale(Model);
+
+        if (!IsSphereInFrustum(View, Center, Radius))
+        {
+            continue;
+        }
+        if (bOcclusion && IsSphereOccluded(View, *HiZ, Center, Radius))
+        {
+            continue;
+        }
+
+        const FGPUDrawBatch& Batch = Batches[Instance.DrawBatchIndex];
+        const UInt32         Slot  = OutCounts[Instance.DrawBatchIndex]++;
+        if (Slot >= Batch.Capacity)
+        {
+            continue;
+        }
+
+        FGPUDrawIndexedIndirectArgs& Args = OutArgs[Batch.ArgsOffset + Slot];
+        Args.IndexCount                   = Batch.IndexCount;
+        Args.InstanceCount                = 1;
+        Args.FirstIndex                   = Batch.FirstIndex;
+        Args.VertexOffset                 = Batch.VertexOffset;
+        Args.FirstInstance                = InstanceIndex;
+    }
+}
+
+bool FGPUCullingReference::CompareResults(TSpan<const FGPUDrawBatch>               Batches,
+                                          TSpan<const FGPUDrawIndexedIndirectArgs> ArgsA, TSpan<const UInt32> CountsA,
+                                          TSpan<const FGPUDrawIndexedIndirectArgs> ArgsB, TSpan<const UInt32> CountsB,
+                                          UInt32* OutMismatchBatch)
+{
+    auto ByFirstInstance = [](const FGPUDrawIndexedIndirectArgs& A, const FGPUDrawIndexedIndirectArgs& B) {
+        return A.FirstInstance < B.FirstInstance;
+    };
+
+    TArray<FGPUDrawIndexedIndirectArgs> SortedA;
+    TArray<FGPUDrawIndexedIndirectArgs> SortedB;
+    for (UInt32 BatchIndex = 0; BatchIndex < Batches.Size(); ++BatchIndex)
+    {
+        const FGPUDrawBatch& Batch = Batches[BatchIndex];
+        const UInt32         Count = BatchIndex < CountsA.Size() ? CountsA[BatchIndex] : 0;
+        bool                 bSame = BatchIndex < CountsB.Size() && CountsB[BatchIndex] == Count;
+
+        // 超出容量的部分没有写入，只比较实际写入的参数
+        const UInt32 Written = std::min(Count, Batch.Capacity);
+        bSame = bSame && Batch.ArgsOffset + Written <= ArgsA.Size() && Batch.ArgsOffset + Written <= ArgsB.Size();
+        if (bSame)
+        {
+            SortedA.Clear();
+            SortedB.Clear();
+            for (UInt32 Slot = 0; Slot < Written; ++Slot)
+            {
+                SortedA.Add(ArgsA[Batch.ArgsOffset + Slot]);
+                SortedB.Add(ArgsB[Batch.ArgsOffset + Slot]);
+            }
+            std::sort(SortedA.begin(), SortedA.end(), ByFirstInstance);
+            std::sort(SortedB.begin(), SortedB.end(), ByFirstInstance);
+            bSame = std::equal(SortedA.begin(), SortedA.end(), SortedB.begin());
+        }
+
+        if (!bSame)
+        {
+            if (OutMismatchBatch != nullptr)
+            {
+                *OutMismatchBatch = BatchIndex;
+            }
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include "Core/Container/Array.h"
+#include "Core/Container/Span.h"
+#include "GPUCullingTypes.h"
+
+/**
+ * CPU 端的深度最大值金字塔，与 GPU 剔除使用的 HiZ 纹理布局一致
+ */
+struct HK_API FHiZPyramid
+{
+    UInt32                Width  = 0;
+    UInt32                Height = 0;
+    TArray<TArray<float>> Mips;
+
+    /**
+     * 从深度图构建金字塔，每一级取上一级对应区域（奇数尺寸时包含多出的一行/列）的最大深度
+     * @param Depth 第 0 级深度，行优先
+     * @param InWidth 宽度
+     * @param InHeight 高度
+     */
+    void Build(TSpan<const float> Depth, UInt32 InWidth, UInt32 InHeight);
+
+    UInt32 GetMipCount() const
+    {
+        return static_cast<UInt32>(Mips.Size());
+    }
+
+    UInt32 GetMipWidth(UInt32 Mip) const
+    {
+        return std::max(Width >> Mip, 1u);
+    }
+
+    UInt32 GetMipHeight(UInt32 Mip) const
+    {
+        return std::max(Height >> Mip, 1u);
+    }
+
+    float Load(UInt32 Mip, UInt32 X, UInt32 Y) const
+    {
+        return Mips[Mip][Y * GetMipWidth(Mip) + X];
+    }
+};
+
+/**
+ * GPU 剔除的 CPU 参考实现，逐条对应 GPUCulling.slang 的逻辑，用于验证 GPU 结果与调试
+ * GPU 上同一批次内可见实例的写入顺序不确定，比较结果时应按批次比较可见实例的集合
+ */
+class HK_API FGPUCullingReference
+{
+public:
+    /**
+     * 从 ViewProjection 矩阵提取视锥平面并填写视图参数
+     * @param ViewProjection 投影矩阵 * 视图矩阵
+     * @param HiZ 上一帧的 HiZ，为空时不做遮挡剔除
+     * @param InstanceCount 参与剔除的实例数量
+     */
+    static FGPUCullingViewParams MakeViewParams(const FMatrix4x4f& ViewProjection, const FHiZPyramid* HiZ,
+                                                UInt32 InstanceCount);
+
+    /**
+     * 计算模型矩阵三个轴向上的最大缩放，用于缩放包围球半径
+     */
+    static float GetMaxScale(const FMatrix4x4f& Model);
+
+    static bool IsSphereInFrustum(const FGPUCullingViewParams& View, const FVector3f& Center, float Radius);
+
+    static bool IsSphereOccluded(const FGPUCullingViewParams& View, const FHiZPyramid& HiZ, const FVector3f& Center,
+                                 float Radius);
+
+    /**
+     * 剔除所有实例并生成压缩后的绘制参数
+     * @param Instances 实例数据
+     * @param Batches 绘制批次，ArgsOffset 与 Capacity 必须已经填写
+     * @param ModelMatrices 模型矩阵
+     * @param View 视图参数
+     * @param HiZ View.HiZMipCount 不为 0 时使用
+     * @param OutArgs 绘制参数，大小为所有批次的 Capacity 之和
+     * @param OutCounts 每个批次的可见实例数量（未截断到 Capacity，与 GPU 的计数一致）
+     */
+    static void Cull(TSpan<const FGPUCullingInstance> Instances, TSpan<const FGPUDrawBatch> Batches,
+                     TSpan<const FMatrix4x4f> ModelMatrices, const FGPUCullingViewParams& View,
+                     const FHiZPyramid* HiZ, TArray<FGPUDrawIndexedIndirectArgs>& OutArgs, TArray<UInt32>& OutCounts);
+
+    /**
+     * 按批次比较两份剔除结果：可见数量相同，且写入的绘制参数按 FirstInstance 排序后一致
+     * @param Batches 两份结果共用的绘制批次布局
+     * @return 一致时返回 true，否则 OutMismatchBatch 为第一个不一致的批次
+     */
+    static bool CompareResults(TSpan<const FGPUDrawBatch> Batches, TSpan<const FGPUDrawIndexedIndirectArgs> ArgsA,
+                               TSpan<const UInt32> CountsA, TSpan<const FGPUDrawIndexedIndirectArgs> ArgsB,
+                               TSpan<const UInt32> CountsB, UInt32* OutMismatchBatch = nullptr);
+};
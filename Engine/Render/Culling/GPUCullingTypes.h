@@ -0,0 +1,76 @@
+#pragma once
+#include "Core/Utility/Macros.h"
+#include "Math/Matrix.h"
+#include "Math/Vector.h"
+
+/**
+ * GPU 剔除使用的数据结构
+ * 与 Builtin/Shader/GPUCulling.slang 中的结构体一一对应（std430 / std140 布局），修改时需要同步
+ */
+
+enum class EGPUCullingInstanceFlag : UInt32
+{
+    None  = 0,
+    Valid = 1 << 0, // 未设置时实例被跳过，用于移除实例而不移动其他实例
+};
+HK_ENABLE_BITMASK_OPERATORS(EGPUCullingInstanceFlag)
+
+/**
+ * 每个实例的剔除数据
+ */
+struct FGPUCullingInstance
+{
+    FVector3f               BoundsCenter;         // 模型空间包围球球心
+    float                   BoundsRadius     = 0; // 模型空间包围球半径
+    UInt32                  ModelMatrixIndex = 0; // FGlobalDynamicRenderResourcePool 中的模型矩阵索引
+    UInt32                  DrawBatchIndex   = 0; // 所属绘制批次（网格 + 材质）
+    UInt32                  MaterialIndex    = 0; // 材质索引，供绘制时读取
+    EGPUCullingInstanceFlag Flags            = EGPUCullingInstanceFlag::Valid;
+};
+static_assert(sizeof(FGPUCullingInstance) == 32, "FGPUCullingInstance 必须与着色器中的 CullingInstance 一致");
+
+/**
+ * 绘制批次：共享同一网格与材质的实例，剔除后每个批次对应一次 DrawIndexedIndirectCount
+ */
+struct FGPUDrawBatch
+{
+    UInt32 IndexCount   = 0;
+    UInt32 FirstIndex   = 0;
+    Int32  VertexOffset = 0;
+    UInt32 ArgsOffset   = 0; // 本批次在绘制参数缓冲区中的起始位置（以 FGPUDrawIndexedIndirectArgs 为单位）
+    UInt32 Capacity     = 0; // 本批次的实例数量，即最多可写入的绘制参数数量
+    UInt32 Padding[3]   = {};
+};
+static_assert(sizeof(FGPUDrawBatch) == 32, "FGPUDrawBatch 必须与着色器中的 DrawBatch 一致");
+
+/**
+ * 与 VkDrawIndexedIndirectCommand 布局一致
+ */
+struct FGPUDrawIndexedIndirectArgs
+{
+    UInt32 IndexCount    = 0;
+    UInt32 InstanceCount = 0;
+    UInt32 FirstIndex    = 0;
+    Int32  VertexOffset  = 0;
+    UInt32 FirstInstance = 0; // 可见实例的索引
+
+    bool operator==(const FGPUDrawIndexedIndirectArgs& Other) const = default;
+};
+static_assert(sizeof(FGPUDrawIndexedIndirectArgs) == 20, "FGPUDrawIndexedIndirectArgs 必须与绘制命令布局一致");
+
+/**
+ * 每帧的视图参数（Uniform Buffer）
+ * 约定 Vulkan 裁剪空间：深度范围 [0, 1]，NDC 的 y 轴向下，HiZ 中深度越大越远
+ */
+struct FGPUCullingViewParams
+{
+    FMatrix4x4f ViewProjection;
+    FVector4f   FrustumPlanes[6]; // xyz 为指向视锥内部的单位法线，w 为距离
+    FVector2f   HiZSize;          // HiZ 第 0 级的尺寸
+    UInt32      HiZMipCount   = 0; // 为 0 时不做遮挡剔除
+    UInt32      InstanceCount = 0;
+};
+static_assert(sizeof(FGPUCullingViewParams) == 176, "FGPUCullingViewParams 必须与着色器中的 CullingViewParams 一致");
+
+// 剔除着色器的线程组大小
+#define HK_GPU_CULLING_THREAD_GROUP_SIZE 64
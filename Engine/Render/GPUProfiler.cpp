@@ -0,0 +1,327 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "GPUProfiler.h"
+#include "Core/Logging/Logger.h"
+#include "Core/Utility/Profiler.h"
+#include "RHI/GfxDevice.h"
+#include "RHI/RHICommandBuffer.h"
+#include "RHI/RHICommandPool.h"
+#include "RHI/RHISync.h"
+
+#include <format>
+
+#if HK_ENABLE_PROFILING
+#include <tracy/TracyC.h>
+
+static_assert(sizeof(FGPUProfileSourceLocation) == sizeof(___tracy_source_location_data),
+              "FGPUProfileSourceLocation must match ___tracy_source_location_data");
+
+namespace
+{
+// 分析器只创建一个 GPU 上下文
+constexpr UInt8 TracyGPUContext = 0;
+// 与 tracy::GpuContextType::Vulkan 一致
+constexpr UInt8 TracyGPUContextTypeVulkan = 2;
+
+constexpr FGPUProfileSourceLocation GFrameSourceLocation{"GPU Frame", "FGPUProfiler::BeginFrame", __FILE__,
+                                                         static_cast<UInt32>(__LINE__), 0};
+} // namespace
+#endif
+
+// 管线统计查询启用的统计项, 结果按位从低到高排列
+static constexpr ERHIPipelineStatisticFlag GPipelineStatisticFlags =
+    ERHIPipelineStatisticFlag::InputAssemblyPrimitives | ERHIPipelineStatisticFlag::VertexShaderInvocations |
+    ERHIPipelineStatisticFlag::ClippingPrimitives | ERHIPipelineStatisticFlag::FragmentShaderInvocations;
+
+void FGPUProfiler::Initialize(const UInt32 InFramesInFlight, const FRHICommandPool& CommandPool)
+{
+    if (bInitialized)
+    {
+        HK_LOG_WARN(ELogcat::Render, "GPU profiler is already initialized");
+        return;
+    }
+
+    FGfxDevice& GfxDevice = GetGfxDeviceRef();
+    TimestampPeriod       = GfxDevice.GetTimestampPeriod();
+
+    Frames.Resize(InFramesInFlight);
+    for (UInt32 i = 0; i < InFramesInFlight; ++i)
+    {
+        FRHIQueryPoolDesc PoolDesc;
+        PoolDesc.Type           = ERHIQueryType::Timestamp;
+        PoolDesc.QueryCount     = HK_RENDER_GPU_PROFILER_MAX_QUERIES;
+        PoolDesc.DebugName      = std::format("GPUProfilerTimestampPool_{}", i);
+        Frames[i].TimestampPool = GfxDevice.CreateQueryPool(PoolDesc);
+
+        PoolDesc.Type               = ERHIQueryType::PipelineStatistics;
+        PoolDesc.QueryCount         = 1;
+        PoolDesc.PipelineStatistics = GPipelineStatisticFlags;
+        PoolDesc.DebugName          = std::format("GPUProfilerStatisticsPool_{}", i);
+        Frames[i].StatisticsPool    = GfxDevice.CreateQueryPool(PoolDesc);
+
+        if (!Frames[i].TimestampPool.IsValid() || !Frames[i].StatisticsPool.IsValid())
+        {
+            HK_LOG_ERROR(ELogcat::Render, "Failed to create GPU profiler query pools for frame {}", i);
+        }
+    }
+
+    bInitialized = true;
+    CalibrateTracyContext(CommandPool);
+    HK_LOG_INFO(ELogcat::Render, "GPU profiler initialized, timestamp period: {} ns", TimestampPeriod);
+}
+
+void FGPUProfiler::ShutDown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FGfxDevice& GfxDevice = GetGfxDeviceRef();
+    for (FFrameQueries& Frame : Frames)
+    {
+        GfxDevice.DestroyQueryPool(Frame.TimestampPool);
+        GfxDevice.DestroyQueryPool(Frame.StatisticsPool);
+    }
+    Frames.Clear();
+    bInitialized = false;
+}
+
+void FGPUProfiler::CalibrateTracyContext(const FRHICommandPool& CommandPool)
+{
+    // 同步写入一次时间戳, 作为 Tracy GPU 时间线与 CPU 时间线的对齐点
+    FGfxDevice&    GfxDevice = GetGfxDeviceRef();
+    FRHIQueryPool& Pool      = Frames[0].TimestampPool;
+    if (!Pool.IsValid() || !CommandPool.IsValid())
+    {
+        return;
+    }
+
+    FRHICommandBufferDesc CmdBufferDesc;
+    CmdBufferDesc.Level     = ERHICommandBufferLevel::Primary;
+    CmdBufferDesc.DebugName = FString("GPUProfilerCalibrationCommandBuffer");
+    FRHICommandBuffer CmdBuffer = GfxDevice.CreateCommandBuffer(CommandPool, CmdBufferDesc);
+
+    FRHIFenceDesc FenceDesc;
+    FenceDesc.DebugName = FString("GPUProfilerCalibrationFence");
+    FRHIFence Fence     = GfxDevice.CreateFence(FenceDesc);
+
+    TArray<UInt64> Results;
+    bool           bReady = false;
+    if (CmdBuffer.IsValid() && Fence.IsValid())
+    {
+        CmdBuffer.Begin(ERHICommandBufferUsageFlag::OneTimeSubmit);
+        CmdBuffer.ResetQueryPool(Pool, FrameBeginQuery, 1);
+        CmdBuffer.WriteTimestamp(Pool, FrameBeginQuery, ERHIPipelineStageFlag::TopOfPipe);
+        CmdBuffer.End();
+        if (CmdBuffer.Submit({}, {}, Fence) && GfxDevice.WaitForFence(Fence))
+        {
+            bReady = GfxDevice.GetQueryPoolResults(Pool, FrameBeginQuery, 1, Results);
+        }
+    }
+
+    if (Fence.IsValid())
+    {
+        GfxDevice.DestroyFence(Fence);
+    }
+    if (CmdBuffer.IsValid())
+    {
+        GfxDevice.DestroyCommandBuffer(CommandPool, CmdBuffer);
+    }
+
+    if (!bReady)
+    {
+        HK_LOG_WARN(ELogcat::Render, "Failed to calibrate GPU timestamps, GPU zones may be misaligned in Tracy");
+        return;
+    }
+    LastGPUTime = static_cast<Int64>(Results[0]);
+
+#if HK_ENABLE_PROFILING
+    ___tracy_gpu_new_context_data ContextData;
+    ContextData.gpuTime = LastGPUTime;
+    ContextData.period  = static_cast<float>(TimestampPeriod);
+    ContextData.context = TracyGPUContext;
+    ContextData.flags   = 0;
+    ContextData.type    = TracyGPUContextTypeVulkan;
+    ___tracy_emit_gpu_new_context_serial(ContextData);
+
+    static constexpr char ContextName[] = "HK GPU";
+    ___tracy_gpu_context_name_data NameData;
+    NameData.context = TracyGPUContext;
+    NameData.name    = ContextName;
+    NameData.len     = static_cast<UInt16>(sizeof(ContextName) - 1);
+    ___tracy_emit_gpu_context_name_serial(NameData);
+#endif
+}
+
+void FGPUProfiler::BeginFrame(FRHICommandBuffer& CmdBuffer, const UInt32 FrameIndex)
+{
+    if (!bInitialized || FrameIndex >= Frames.Size())
+    {
+        return;
+    }
+
+    FFrameQueries& Frame = Frames[FrameIndex];
+    if (!Frame.TimestampPool.IsValid())
+    {
+        return;
+    }
+
+    // 调用方已经等待过该帧的栅栏, 上一次记录的查询一般都已完成
+    ReadbackFrame(Frame, FrameIndex);
+
+    CurrentFrameIndex = FrameIndex;
+    bInFrame          = true;
+
+    CmdBuffer.ResetQueryPool(Frame.TimestampPool, 0, HK_RENDER_GPU_PROFILER_MAX_QUERIES);
+    CmdBuffer.WriteTimestamp(Frame.TimestampPool, FrameBeginQuery, ERHIPipelineStageFlag::TopOfPipe);
+    Frame.UsedQueryCount = FirstZoneQuery;
+
+#if HK_ENABLE_PROFILING
+    ___tracy_gpu_zone_begin_data BeginData;
+    BeginData.srcloc  = reinterpret_cast<UInt64>(&GFrameSourceLocation);
+    BeginData.queryId = MakeTracyQueryId(FrameIndex, FrameBeginQuery);
+    BeginData.context = TracyGPUContext;
+    ___tracy_emit_gpu_zone_begin_serial(BeginData);
+#endif
+
+    if (bPipelineStatisticsEnabled && Frame.StatisticsPool.IsValid())
+    {
+        CmdBuffer.ResetQueryPool(Frame.StatisticsPool, 0, 1);
+        CmdBuffer.BeginQuery(Frame.StatisticsPool, 0);
+        Frame.bStatisticsPending = true;
+    }
+}
+
+void FGPUProfiler::EndFrame(FRHICommandBuffer& CmdBuffer)
+{
+    if (!bInFrame)
+    {
+        return;
+    }
+
+    FFrameQueries& Frame = Frames[CurrentFrameIndex];
+    if (Frame.bStatisticsPending)
+    {
+        CmdBuffer.EndQuery(Frame.StatisticsPool, 0);
+    }
+
+    CmdBuffer.WriteTimestamp(Frame.TimestampPool, FrameEndQuery, ERHIPipelineStageFlag::BottomOfPipe);
+
+#if HK_ENABLE_PROFILING
+    ___tracy_gpu_zone_end_data EndData;
+    EndData.queryId = MakeTracyQueryId(CurrentFrameIndex, FrameEndQuery);
+    EndData.context = TracyGPUContext;
+    ___tracy_emit_gpu_zone_end_serial(EndData);
+#endif
+
+    bInFrame = false;
+}
+
+UInt32 FGPUProfiler::BeginZone(FRHICommandBuffer& CmdBuffer, const FGPUProfileSourceLocation* SourceLocation)
+{
+    if (!bInFrame)
+    {
+        return InvalidQuery;
+    }
+
+    FFrameQueries& Frame = Frames[CurrentFrameIndex];
+    if (Frame.UsedQueryCount + 2 > HK_RENDER_GPU_PROFILER_MAX_QUERIES)
+    {
+        return InvalidQuery;
+    }
+
+    // 一次预留开始与结束两个查询, 嵌套作用域的结束顺序不影响查询编号
+    const UInt32 Query = Frame.UsedQueryCount;
+    Frame.UsedQueryCount += 2;
+    CmdBuffer.WriteTimestamp(Frame.TimestampPool, Query, ERHIPipelineStageFlag::TopOfPipe);
+
+#if HK_ENABLE_PROFILING
+    ___tracy_gpu_zone_begin_data BeginData;
+    BeginData.srcloc  = reinterpret_cast<UInt64>(SourceLocation);
+    BeginData.queryId = MakeTracyQueryId(CurrentFrameIndex, Query);
+    BeginData.context = TracyGPUContext;
+    ___tracy_emit_gpu_zone_begin_serial(BeginData);
+#else
+    (void)SourceLocation;
+#endif
+    return Query;
+}
+
+void FGPUProfiler::EndZone(FRHICommandBuffer& CmdBuffer, const UInt32 BeginQuery)
+{
+    if (!bInFrame || BeginQuery == InvalidQuery)
+    {
+        return;
+    }
+
+    const UInt32 Query = BeginQuery + 1;
+    CmdBuffer.WriteTimestamp(Frames[CurrentFrameIndex].TimestampPool, Query, ERHIPipelineStageFlag::BottomOfPipe);
+
+#if HK_ENABLE_PROFILING
+    ___tracy_gpu_zone_end_data EndData;
+    EndData.queryId = MakeTracyQueryId(CurrentFrameIndex, Query);
+    EndData.context = TracyGPUContext;
+    ___tracy_emit_gpu_zone_end_serial(EndData);
+#endif
+}
+
+void FGPUProfiler::ReadbackFrame(FFrameQueries& Frame, const UInt32 FrameIndex)
+{
+    FGfxDevice& GfxDevice = GetGfxDeviceRef();
+
+    if (Frame.bStatisticsPending)
+    {
+        TArray<UInt64> Statistics;
+        if (GfxDevice.GetQueryPoolResults(Frame.StatisticsPool, 0, 1, Statistics))
+        {
+            LastPipelineStatistics.InputAssemblyPrimitives   = Statistics[0];
+            LastPipelineStatistics.VertexShaderInvocations   = Statistics[1];
+            LastPipelineStatistics.ClippingPrimitives        = Statistics[2];
+            LastPipelineStatistics.FragmentShaderInvocations = Statistics[3];
+            HK_PROFILE_PLOT_F("GPU Vertex Invocations", LastPipelineStatistics.VertexShaderInvocations);
+            HK_PROFILE_PLOT_F("GPU Fragment Invocations", LastPipelineStatistics.FragmentShaderInvocations);
+        }
+        Frame.bStatisticsPending = false;
+    }
+
+    if (Frame.UsedQueryCount == 0)
+    {
+        return;
+    }
+
+    TArray<UInt64> Timestamps;
+    const bool     bReady = GfxDevice.GetQueryPoolResults(Frame.TimestampPool, 0, Frame.UsedQueryCount, Timestamps);
+    if (bReady)
+    {
+        LastFrameGPUTimeMs = static_cast<double>(Timestamps[FrameEndQuery] - Timestamps[FrameBeginQuery]) *
+                             TimestampPeriod / 1000000.0;
+        HK_PROFILE_PLOT_F("GPU Frame Time (ms)", LastFrameGPUTimeMs);
+    }
+    else
+    {
+        // 不等待GPU, 直接丢弃这一帧的结果
+        ++DroppedFrameCount;
+    }
+
+#if HK_ENABLE_PROFILING
+    // Tracy 需要每个已经发出的查询都有对应的时间, 结果丢失时用上一次的时间补齐为零长度区间
+    for (UInt32 Query = 0; Query < Frame.UsedQueryCount; ++Query)
+    {
+        ___tracy_gpu_time_data TimeData;
+        TimeData.gpuTime = bReady ? static_cast<Int64>(Timestamps[Query]) : LastGPUTime;
+        TimeData.queryId = MakeTracyQueryId(FrameIndex, Query);
+        TimeData.context = TracyGPUContext;
+        ___tracy_emit_gpu_time_serial(TimeData);
+    }
+#else
+    (void)FrameIndex;
+#endif
+    if (bReady)
+    {
+        LastGPUTime = static_cast<Int64>(Timestamps[FrameEndQuery]);
+    }
+    Frame.UsedQueryCount = 0;
+}
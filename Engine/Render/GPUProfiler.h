@@ -0,0 +1,178 @@
+#pragma once
+#include "Core/Container/Array.h"
+#include "Core/Singleton/Singleton.h"
+#include "RHI/RHIQueryPool.h"
+#include "RenderOptions.h"
+
+class FRHICommandBuffer;
+class FRHICommandPool;
+
+// GPU作用域的源码位置, 内存布局与 Tracy 的 ___tracy_source_location_data 一致, 可以直接传给 Tracy
+struct FGPUProfileSourceLocation
+{
+    const char* Name;
+    const char* Function;
+    const char* File;
+    UInt32      Line;
+    UInt32      Color;
+};
+
+// 一帧的管线统计结果
+struct FGPUPipelineStatistics
+{
+    UInt64 InputAssemblyPrimitives   = 0; // 输入装配读取的图元数
+    UInt64 VertexShaderInvocations   = 0; // 顶点着色器调用次数
+    UInt64 ClippingPrimitives        = 0; // 裁剪后输出的图元数
+    UInt64 FragmentShaderInvocations = 0; // 片元着色器调用次数
+};
+
+/**
+ * GPU性能分析器
+ * 每个在途帧拥有独立的时间戳查询池与管线统计查询池, 查询结果在该帧的栅栏完成后（即 FramesInFlight 帧之后）
+ * 非阻塞地读回, 读回的时间戳转发给 Tracy 的 GPU 上下文
+ * 只能在渲染帧所在的线程使用
+ */
+class FGPUProfiler : public TSingleton<FGPUProfiler>
+{
+public:
+    static constexpr UInt32 InvalidQuery = UINT32_MAX;
+
+    void ShutDown() override;
+
+    /**
+     * 创建查询池并校准 Tracy 的 GPU 时钟, 会同步提交一次命令缓冲区
+     * @param InFramesInFlight 在途帧数量
+     * @param CommandPool 用于校准提交的命令池
+     */
+    void Initialize(UInt32 InFramesInFlight, const FRHICommandPool& CommandPool);
+
+    /**
+     * 开始记录一帧, 必须在该帧的栅栏完成之后、命令缓冲区 Begin 之后调用
+     * 先读回这一帧槽位上一次记录的查询结果, 然后重置查询并写入帧开始时间戳
+     */
+    void BeginFrame(FRHICommandBuffer& CmdBuffer, UInt32 FrameIndex);
+
+    /**
+     * 结束记录一帧, 在命令缓冲区 End 之前调用
+     */
+    void EndFrame(FRHICommandBuffer& CmdBuffer);
+
+    /**
+     * 写入GPU作用域的开始时间戳
+     * @return 作用域的开始查询索引, 查询用尽或不在帧内时返回 InvalidQuery
+     */
+    UInt32 BeginZone(FRHICommandBuffer& CmdBuffer, const FGPUProfileSourceLocation* SourceLocation);
+
+    /**
+     * 写入GPU作用域的结束时间戳
+     * @param BeginQuery BeginZone 的返回值
+     */
+    void EndZone(FRHICommandBuffer& CmdBuffer, UInt32 BeginQuery);
+
+    /**
+     * 开启或关闭管线统计查询, 从下一次 BeginFrame 开始生效
+     */
+    void SetPipelineStatisticsEnabled(bool bEnabled)
+    {
+        bPipelineStatisticsEnabled = bEnabled;
+    }
+
+    [[nodiscard]] bool IsPipelineStatisticsEnabled() const
+    {
+        return bPipelineStatisticsEnabled;
+    }
+
+    // 最近一次读回的帧GPU耗时（毫秒）
+    [[nodiscard]] double GetLastFrameGPUTimeMs() const
+    {
+        return LastFrameGPUTimeMs;
+    }
+
+    // 最近一次读回的管线统计结果, 未开启管线统计时保持上一次的值
+    [[nodiscard]] const FGPUPipelineStatistics& GetLastPipelineStatistics() const
+    {
+        return LastPipelineStatistics;
+    }
+
+    // 结果未就绪而被丢弃的帧数
+    [[nodiscard]] UInt64 GetDroppedFrameCount() const
+    {
+        return DroppedFrameCount;
+    }
+
+private:
+    // 每个在途帧的查询资源
+    struct FFrameQueries
+    {
+        FRHIQueryPool TimestampPool;
+        FRHIQueryPool StatisticsPool;
+        UInt32        UsedQueryCount     = 0;     // 已写入的时间戳查询数量, 0 表示没有待读回的结果
+        bool          bStatisticsPending = false; // 是否有待读回的管线统计查询
+    };
+
+    // 查询 0 与 1 保留给帧开始与帧结束
+    static constexpr UInt32 FrameBeginQuery = 0;
+    static constexpr UInt32 FrameEndQuery   = 1;
+    static constexpr UInt32 FirstZoneQuery  = 2;
+
+    void ReadbackFrame(FFrameQueries& Frame, UInt32 FrameIndex);
+
+    void CalibrateTracyContext(const FRHICommandPool& CommandPool);
+
+    // 查询在所有在途帧中的全局编号, 作为 Tracy 的 queryId
+    static UInt16 MakeTracyQueryId(UInt32 FrameIndex, UInt32 Query)
+    {
+        return static_cast<UInt16>(FrameIndex * HK_RENDER_GPU_PROFILER_MAX_QUERIES + Query);
+    }
+
+    TArray<FFrameQueries> Frames;
+    UInt32                CurrentFrameIndex = 0;
+    bool                  bInFrame          = false;
+    bool                  bInitialized      = false;
+
+    bool                   bPipelineStatisticsEnabled = false;
+    double                 TimestampPeriod            = 1.0;
+    double                 LastFrameGPUTimeMs         = 0.0;
+    FGPUPipelineStatistics LastPipelineStatistics;
+    UInt64                 DroppedFrameCount = 0;
+    // 最近一次转发给 Tracy 的GPU时间, 结果丢失时用它补齐已经发出的区间
+    Int64                  LastGPUTime       = 0;
+};
+
+/**
+ * GPU作用域, 构造与析构时在命令缓冲区中写入时间戳
+ */
+class FGPUProfileScope
+{
+public:
+    FGPUProfileScope(FRHICommandBuffer& InCmdBuffer, const FGPUProfileSourceLocation* SourceLocation)
+        : CmdBuffer(InCmdBuffer), BeginQuery(FGPUProfiler::GetRef().BeginZone(InCmdBuffer, SourceLocation))
+    {
+    }
+
+    ~FGPUProfileScope()
+    {
+        FGPUProfiler::GetRef().EndZone(CmdBuffer, BeginQuery);
+    }
+
+    FGPUProfileScope(const FGPUProfileScope&)            = delete;
+    FGPUProfileScope& operator=(const FGPUProfileScope&) = delete;
+
+private:
+    FRHICommandBuffer& CmdBuffer;
+    UInt32             BeginQuery;
+};
+
+#define HK_GPU_PROFILE_CONCAT_INNER(A, B) A##B
+#define HK_GPU_PROFILE_CONCAT(A, B) HK_GPU_PROFILE_CONCAT_INNER(A, B)
+
+#if HK_ENABLE_PROFILING
+// 在命令缓冲区上记录一个具名的GPU作用域, 结果在几帧后出现在 Tracy 的 GPU 时间线上
+#define HK_PROFILE_GPU_SCOPE(CmdBuffer, Name)                                                                          \
+    static constexpr FGPUProfileSourceLocation HK_GPU_PROFILE_CONCAT(HKGPUSourceLocation_, __LINE__){                  \
+        Name, __func__, __FILE__, static_cast<UInt32>(__LINE__), 0};                                                   \
+    FGPUProfileScope HK_GPU_PROFILE_CONCAT(HKGPUProfileScope_, __LINE__)(                                              \
+        CmdBuffer, &HK_GPU_PROFILE_CONCAT(HKGPUSourceLocation_, __LINE__))
+#else
+#define HK_PROFILE_GPU_SCOPE(CmdBuffer, Name) ((void)0)
+#endif
@@ -4,32 +4,58 @@
 
 #include "GlobalRenderResources.h"
 
+#include "Core/Utility/Profiler.h"
 #include "RHI/GfxDevice.h"
 #include "Render/Material/SharedMaterial.h"
 #include "Texture/Texture.h"
 
+#include <cstring>
+
+void FGlobalStaticRenderResourcePool::StartUp()
+{
+    // 表的大小由设备上限决定, 见 FRHIPipelineResourcePool::StartUp
+    const auto&  ResourcePool    = FRHIPipelineResourcePool::GetRef();
+    const UInt32 TextureCapacity = ResourcePool.GetBindlessTextureCapacity();
+    const UInt32 SamplerCapacity = ResourcePool.GetBindlessSamplerCapacity();
+
+    TextureArray.Resize(TextureCapacity, nullptr);
+    SamplerArray.Resize(SamplerCapacity);
+
+    std::lock_guard Lock(PendingMutex);
+    FreeTextureIndices.Reserve(TextureCapacity);
+    for (UInt32 Index = TextureCapacity; Index > 0; --Index)
+    {
+        FreeTextureIndices.Add(static_cast<Int16>(Index - 1));
+    }
+    FreeSamplerIndices.Reserve(SamplerCapacity);
+    for (UInt32 Index = SamplerCapacity; Index > 0; --Index)
+    {
+        FreeSamplerIndices.Add(static_cast<Int16>(Index - 1));
+    }
+}
+
 Int16 FGlobalStaticRenderResourcePool::FindEmptyTextureIndex()
 {
-    for (int Index = 0; Index < TextureArray.Size(); Index++)
+    std::lock_guard Lock(PendingMutex);
+    if (FreeTextureIndices.IsEmpty())
     {
-        if (TextureArray[Index] == nullptr)
-        {
-            return Index;
-        }
+        return -1;
     }
-    return -1;
+    const Int16 Index = FreeTextureIndices.Back();
+    FreeTextureIndices.PopBack();
+    return Index;
 }
 
 Int16 FGlobalStaticRenderResourcePool::FindEmptySamplerIndex()
 {
-    for (int Index = 0; Index < SamplerArray.Size(); Index++)
+    std::lock_guard Lock(PendingMutex);
+    if (FreeSamplerIndices.IsEmpty())
     {
-        if (!SamplerArray[Index].IsValid())
-        {
-            return Index;
-        }
+        return -1;
     }
-    return -1;
+    const Int16 Index = FreeSamplerIndices.Back();
+    FreeSamplerIndices.PopBack();
+    return Index;
 }
 
 void FGlobalStaticRenderResourcePool::AddTexture(HTexture* InTexture)
@@ -49,7 +75,7 @@ void FGlobalStaticRenderResourcePool::AddTexture(HTexture* InTexture)
         return;
     }
 
-    // 找到空槽位
+    // 从空闲列表取出槽位
     Int16 Index = FindEmptyTextureIndex();
     if (Index < 0)
     {
@@ -61,29 +87,17 @@ void FGlobalStaticRenderResourcePool::AddTexture(HTexture* InTexture)
     TextureArray[Index] = InTexture;
     TextureIndexMap.Add(InTexture, Index);
 
-    // 获取描述符集
-    FRHIDescriptorSet StaticResourceDescriptorSet =
-        FRHIPipelineResourcePool::GetRef().RequestCommonDescriptorSet(ECommonDescriptorSetIndex::StaticResource);
-    auto& GfxDevice = GetGfxDeviceRef();
-
-    // 更新描述符集（binding 0 是 SampledImage）
-    FRHIWriteDescriptorSet WriteDesc{};
-    WriteDesc.DstBinding      = 0;
-    WriteDesc.DstArrayElement = static_cast<UInt32>(Index);
-    WriteDesc.DescriptorCount = 1;
-    WriteDesc.DescriptorType  = ERHIDescriptorType::SampledImage;
-
-    FRHIDescriptorImageInfo ImageInfo{};
-    ImageInfo.ImageView   = InTexture->GetRHIImageView();
-    ImageInfo.ImageLayout = ERHIImageLayout::ShaderReadOnlyOptimal;
-    WriteDesc.ImageInfo.Add(ImageInfo);
-
-    TArray<FRHIWriteDescriptorSet> WriteDescriptorSets;
-    WriteDescriptorSets.Add(WriteDesc);
-    GfxDevice.UpdateDescriptorSet(StaticResourceDescriptorSet, WriteDescriptorSets);
+    // 描述符在下一帧开始录制前批量写入（binding 0 是 SampledImage）
+    {
+        std::lock_guard      Lock(PendingMutex);
+        FPendingTextureWrite Write;
+        Write.Index     = Index;
+        Write.ImageView = InTexture->GetRHIImageView();
+        PendingTextureWrites.Add(Write);
+    }
 
     // 注册到 PreDestroyEvent 来移除绑定
-    InTexture->GetPreDestroyEvent().AddBind(this, &FGlobalStaticRenderResourcePool::RemoveTexture);
+    InTexture->GetPreDestroyEvent().AddBind<&FGlobalStaticRenderResourcePool::RemoveTexture>(this);
 
     HK_LOG_INFO(ELogcat::Render, "纹理已添加到纹理池: Index={}", Index);
 }
@@ -108,15 +122,17 @@ void FGlobalStaticRenderResourcePool::RemoveTexture(HTexture* InTexture)
     TextureArray[Index] = nullptr;
     TextureIndexMap.Remove(InTexture);
 
-    // 获取描述符集
-    FRHIDescriptorSet StaticResourceDescriptorSet =
-        FRHIPipelineResourcePool::GetRef().RequestCommonDescriptorSet(ECommonDescriptorSetIndex::StaticResource);
-
-    // 更新描述符集，将对应槽位设为空（使用无效的 ImageView）
-    // 注意：Vulkan 不允许直接"清空"描述符，但我们可以使用一个占位符或者不更新
-    // 实际上，在 bindless 渲染中，通常只需要确保不再使用该索引即可
-    // 这里我们创建一个空的 ImageInfo，但更好的做法可能是使用一个默认的占位纹理
-    // 为了简化，这里只移除映射，描述符集保持不变（shader 中会检查索引有效性）
+    // 描述符保持不变: 绑定开启了 PartiallyBound, 不再被访问的描述符不需要有效
+    // 在途帧仍可能引用这个索引, 等这些帧都完成后再回收, 之前排队但尚未写入的描述符直接丢弃
+    {
+        std::lock_guard Lock(PendingMutex);
+        PendingTextureWrites.RemoveAllByPredicate([Index](const FPendingTextureWrite& Write)
+                                                  { return Write.Index == Index; });
+        FRetiredTextureIndex Retired;
+        Retired.Index        = Index;
+        Retired.ReleaseFlush = FlushCount + HK_RENDER_MAX_FRAME_IN_FLIGHT;
+        RetiredTextureIndices.Add(Retired);
+    }
 
     HK_LOG_INFO(ELogcat::Render, "纹理已从纹理池移除: Index={}", Index);
 }
@@ -130,7 +146,7 @@ void FGlobalStaticRenderResourcePool::AddSampler(const FRHISamplerDesc& SamplerD
         return;
     }
 
-    // 找到空槽位
+    // 从空闲列表取出槽位
     Int16 Index = FindEmptySamplerIndex();
     if (Index < 0)
     {
@@ -144,6 +160,8 @@ void FGlobalStaticRenderResourcePool::AddSampler(const FRHISamplerDesc& SamplerD
     if (!Sampler.IsValid())
     {
         HK_LOG_ERROR(ELogcat::Render, "创建采样器失败");
+        std::lock_guard Lock(PendingMutex);
+        FreeSamplerIndices.Add(Index);
         return;
     }
 
@@ -151,26 +169,94 @@ void FGlobalStaticRenderResourcePool::AddSampler(const FRHISamplerDesc& SamplerD
     SamplerArray[Index] = Sampler;
     SamplerIndexMap.Add(HashCode, Index);
 
-    // 获取描述符集
-    FRHIDescriptorSet StaticResourceDescriptorSet =
-        FRHIPipelineResourcePool::GetRef().RequestCommonDescriptorSet(ECommonDescriptorSetIndex::StaticResource);
+    // 描述符在下一帧开始录制前批量写入（binding 1 是 Sampler）
+    {
+        std::lock_guard      Lock(PendingMutex);
+        FPendingSamplerWrite Write;
+        Write.Index   = Index;
+        Write.Sampler = Sampler;
+        PendingSamplerWrites.Add(Write);
+    }
 
-    // 更新描述符集（binding 1 是 Sampler）
-    FRHIWriteDescriptorSet WriteDesc{};
-    WriteDesc.DstBinding      = 1;
-    WriteDesc.DstArrayElement = static_cast<UInt32>(Index);
-    WriteDesc.DescriptorCount = 1;
-    WriteDesc.DescriptorType  = ERHIDescriptorType::Sampler;
+    HK_LOG_INFO(ELogcat::Render, "采样器已添加到采样器池: Index={}, HashCode={}", Index, HashCode);
+}
 
-    FRHIDescriptorImageInfo ImageInfo{};
-    ImageInfo.Sampler = Sampler;
-    WriteDesc.ImageInfo.Add(ImageInfo);
+void FGlobalStaticRenderResourcePool::FlushDescriptorWrites()
+{
+    HK_PROFILE_SCOPE_N("FGlobalStaticRenderResourcePool::FlushDescriptorWrites");
+
+    TArray<FPendingTextureWrite> TextureWrites;
+    TArray<FPendingSamplerWrite> SamplerWrites;
+    {
+        std::lock_guard Lock(PendingMutex);
+        std::swap(TextureWrites, PendingTextureWrites);
+        std::swap(SamplerWrites, PendingSamplerWrites);
+
+        // 这一帧的栅栏已经完成, 移除时仍在途的帧此时都已结束
+        ++FlushCount;
+        size_t ReleasedCount = 0;
+        while (ReleasedCount < RetiredTextureIndices.Size() &&
+               RetiredTextureIndices[ReleasedCount].ReleaseFlush <= FlushCount)
+        {
+            FreeTextureIndices.Add(RetiredTextureIndices[ReleasedCount].Index);
+            ++ReleasedCount;
+        }
+        if (ReleasedCount > 0)
+        {
+            RetiredTextureIndices.RemoveAllByPredicate(
+                [this](const FRetiredTextureIndex& Retired) { return Retired.ReleaseFlush <= FlushCount; });
+        }
+    }
+
+    if (TextureWrites.IsEmpty() && SamplerWrites.IsEmpty())
+    {
+        return;
+    }
+
+    // 按索引排序, 连续的索引合并为一个 FRHIWriteDescriptorSet
+    TextureWrites.Sort([](const FPendingTextureWrite& A, const FPendingTextureWrite& B) { return A.Index < B.Index; });
+    SamplerWrites.Sort([](const FPendingSamplerWrite& A, const FPendingSamplerWrite& B) { return A.Index < B.Index; });
 
     TArray<FRHIWriteDescriptorSet> WriteDescriptorSets;
-    WriteDescriptorSets.Add(WriteDesc);
-    GfxDevice.UpdateDescriptorSet(StaticResourceDescriptorSet, WriteDescriptorSets);
+    auto AppendImageInfo = [&WriteDescriptorSets](const UInt32 Binding, const ERHIDescriptorType Type,
+                                                  const Int16 Index, const FRHIDescriptorImageInfo& ImageInfo)
+    {
+        if (!WriteDescriptorSets.IsEmpty())
+        {
+            FRHIWriteDescriptorSet& Last = WriteDescriptorSets.Back();
+            if (Last.DstBinding == Binding && Last.DstArrayElement + Last.DescriptorCount == static_cast<UInt32>(Index))
+            {
+                Last.ImageInfo.Add(ImageInfo);
+                ++Last.DescriptorCount;
+                return;
+            }
+        }
+        FRHIWriteDescriptorSet WriteDesc{};
+        WriteDesc.DstBinding      = Binding;
+        WriteDesc.DstArrayElement = static_cast<UInt32>(Index);
+        WriteDesc.DescriptorCount = 1;
+        WriteDesc.DescriptorType  = Type;
+        WriteDesc.ImageInfo.Add(ImageInfo);
+        WriteDescriptorSets.Add(std::move(WriteDesc));
+    };
+
+    for (const FPendingTextureWrite& Write : TextureWrites)
+    {
+        FRHIDescriptorImageInfo ImageInfo{};
+        ImageInfo.ImageView   = Write.ImageView;
+        ImageInfo.ImageLayout = ERHIImageLayout::ShaderReadOnlyOptimal;
+        AppendImageInfo(0, ERHIDescriptorType::SampledImage, Write.Index, ImageInfo);
+    }
+    for (const FPendingSamplerWrite& Write : SamplerWrites)
+    {
+        FRHIDescriptorImageInfo ImageInfo{};
+        ImageInfo.Sampler = Write.Sampler;
+        AppendImageInfo(1, ERHIDescriptorType::Sampler, Write.Index, ImageInfo);
+    }
 
-    HK_LOG_INFO(ELogcat::Render, "采样器已添加到采样器池: Index={}, HashCode={}", Index, HashCode);
+    FRHIDescriptorSet StaticResourceDescriptorSet =
+        FRHIPipelineResourcePool::GetRef().RequestCommonDescriptorSet(ECommonDescriptorSetIndex::StaticResource);
+    GetGfxDeviceRef().UpdateDescriptorSet(StaticResourceDescriptorSet, WriteDescriptorSets);
 }
 
 Int16 FGlobalStaticRenderResourcePool::GetTextureIndex(HTexture* InTexture) const
@@ -238,49 +324,203 @@ Int16 FGlobalStaticRenderResourcePool::GetOrAddSamplerIndex(const FRHISamplerDes
     return GetSamplerIndex(SamplerDesc);
 }
 
-Int16 FGlobalDynamicRenderResourcePool::FindNextEmptyModelMatrixIndex()
+void FModelMatrixDirtyPages::Mark(UInt32 MatrixIndex)
 {
-    for (Int16 i = 0; i < ModelMatrixOccupiedBitmap.Size(); ++i)
+    const UInt32 Page      = MatrixIndex / PageSize;
+    const UInt32 WordIndex = Page / 64;
+    if (WordIndex >= Words.Size())
     {
-        if (!ModelMatrixOccupiedBitmap[i])
-        {
-            return i;
-        }
+        Words.Resize(WordIndex + 1, 0);
     }
-    return -1;
+    Words[WordIndex] |= UInt64(1) << (Page % 64);
+    bEmpty = false;
+}
+
+void FModelMatrixDirtyPages::MarkAll(UInt32 MatrixCount)
+{
+    if (MatrixCount == 0)
+    {
+        return;
+    }
+    const UInt32 PageCount = (MatrixCount + PageSize - 1) / PageSize;
+    const UInt32 WordCount = (PageCount + 63) / 64;
+    if (WordCount > Words.Size())
+    {
+        Words.Resize(WordCount, 0);
+    }
+    for (UInt32 WordIndex = 0; WordIndex < PageCount / 64; ++WordIndex)
+    {
+        Words[WordIndex] = ~UInt64(0);
+    }
+    if (PageCount % 64 != 0)
+    {
+        Words[PageCount / 64] |= (UInt64(1) << (PageCount % 64)) - 1;
+    }
+    bEmpty = false;
+}
+
+void FModelMatrixDirtyPages::Merge(const FModelMatrixDirtyPages& Other)
+{
+    if (Other.bEmpty)
+    {
+        return;
+    }
+    if (Other.Words.Size() > Words.Size())
+    {
+        Words.Resize(Other.Words.Size(), 0);
+    }
+    for (UInt32 WordIndex = 0; WordIndex < Other.Words.Size(); ++WordIndex)
+    {
+        Words[WordIndex] |= Other.Words[WordIndex];
+    }
+    bEmpty = false;
+}
+
+Int32 FGlobalDynamicRenderResourcePool::FindNextEmptyModelMatrixIndex()
+{
+    // 通过层级摘要直接定位第一个空位
+    const size_t FreeIndex = ModelMatrixFreeSlots.FindFirstSet();
+    if (FreeIndex != FHierarchicalBitmap::NotFound)
+    {
+        return static_cast<Int32>(FreeIndex);
+    }
+
+    // 已满, 容量翻倍
+    const UInt32 OldCount = static_cast<UInt32>(ModelMatrixArray.Size());
+    const UInt32 NewCount = std::max<UInt32>(OldCount * 2, 64);
+    if (NewCount > static_cast<UInt32>(INT32_MAX))
+    {
+        return -1;
+    }
+    ModelMatrixArray.Resize(NewCount);
+    ModelMatrixFreeSlots.Resize(NewCount, true);
+    return static_cast<Int32>(OldCount);
+}
+
+void FGlobalDynamicRenderResourcePool::EnsureFrameBufferCapacity(FFrameModelMatrixBuffer& Frame)
+{
+    const UInt32 RequiredCount = static_cast<UInt32>(RenderModelMatrices.Size());
+    if (Frame.Buffer.IsValid() && Frame.Capacity >= RequiredCount)
+    {
+        return;
+    }
+
+    // 该帧的栅栏已经等待完成, 旧缓冲不再被GPU使用, 可以直接销毁
+    auto& GfxDevice = GetGfxDeviceRef();
+    if (Frame.Buffer.IsValid())
+    {
+        GfxDevice.DestroyBuffer(Frame.Buffer);
+    }
+    UInt32 NewCapacity = std::max<UInt32>(Frame.Capacity, HK_RENDER_INIT_MODEL_MATRIX_COUNT);
+    while (NewCapacity < RequiredCount)
+    {
+        NewCapacity *= 2;
+    }
+
+    FRHIBufferDesc BufferDesc{};
+    BufferDesc.Usage          = ERHIBufferUsage::StorageBuffer;
+    BufferDesc.Size           = static_cast<UInt64>(NewCapacity) * sizeof(FMatrix4x4f);
+    BufferDesc.MemoryProperty = ERHIBufferMemoryProperty::HostVisible | ERHIBufferMemoryProperty::HostCoherent;
+    BufferDesc.DebugName      = FString("ModelMatrixBuffer");
+    Frame.Buffer              = GfxDevice.CreateBuffer(BufferDesc);
+    Frame.MappedPtr           = Frame.Buffer.Map();
+    Frame.Capacity            = NewCapacity;
+
+    // 新缓冲内容未定义, 需要完整写入一次
+    Frame.DirtyPages.MarkAll(RequiredCount);
 }
 
 void FGlobalDynamicRenderResourcePool::StartUp()
 {
     ModelMatrixArray.Resize(HK_RENDER_INIT_MODEL_MATRIX_COUNT);
-    ModelMatrixOccupiedBitmap.Resize(HK_RENDER_INIT_MODEL_MATRIX_COUNT);
-    FRHIBufferDesc BufferDesc{};
-    BufferDesc.Usage          = ERHIBufferUsage::UniformBuffer;
-    BufferDesc.Size           = ModelMatrixArray.Size() * sizeof(FMatrix4x4f);
-    BufferDesc.MemoryProperty = ERHIBufferMemoryProperty::HostCoherent;
-    ModelMatrixBuffer         = GetGfxDeviceRef().CreateBuffer(BufferDesc);
-    MappedPtr                 = ModelMatrixBuffer.Map();
+    ModelMatrixFreeSlots.Resize(HK_RENDER_INIT_MODEL_MATRIX_COUNT, true);
+    // 首帧需要上传全部矩阵
+    GameDirtyPages.MarkAll(static_cast<UInt32>(ModelMatrixArray.Size()));
 }
 
 void FGlobalDynamicRenderResourcePool::ShutDown()
 {
-    ModelMatrixArray = {};
-    GetGfxDeviceRef().DestroyBuffer(ModelMatrixBuffer);
+    ModelMatrixArray     = {};
+    ModelMatrixFreeSlots = {};
+    RenderModelMatrices  = {};
+    auto& GfxDevice      = GetGfxDeviceRef();
+    for (auto& Frame : FrameBuffers)
+    {
+        if (Frame.Buffer.IsValid())
+        {
+            GfxDevice.DestroyBuffer(Frame.Buffer);
+        }
+        Frame = FFrameModelMatrixBuffer();
+    }
 }
 
 void FGlobalDynamicRenderResourcePool::UpdateModelMatrix(const FMatrix4x4f& ModelMatrix, Int32 Index)
 {
     HK_ASSERT_MSG(Index >= 0 && Index < ModelMatrixArray.Size(), "模型矩阵索引超出范围");
     ModelMatrixArray[Index] = ModelMatrix;
+    GameDirtyPages.Mark(static_cast<UInt32>(Index));
+}
+
+void FGlobalDynamicRenderResourcePool::CaptureModelMatrixUpdate(FModelMatrixUpdate& OutUpdate)
+{
+    HK_PROFILE_SCOPE_N("FGlobalDynamicRenderResourcePool::CaptureModelMatrixUpdate");
+
+    OutUpdate.MatrixCount = static_cast<UInt32>(ModelMatrixArray.Size());
+    OutUpdate.Ranges.Clear();
+    OutUpdate.Matrices.Clear();
+    GameDirtyPages.ConsumeRanges(OutUpdate.MatrixCount, [this, &OutUpdate](UInt32 FirstIndex, UInt32 Count) {
+        OutUpdate.Ranges.Add({FirstIndex, Count});
+        OutUpdate.Matrices.Append(ModelMatrixArray.Data() + FirstIndex, ModelMatrixArray.Data() + FirstIndex + Count);
+    });
+}
+
+void FGlobalDynamicRenderResourcePool::ApplyModelMatrixUpdate(const FModelMatrixUpdate& Update)
+{
+    HK_PROFILE_SCOPE_N("FGlobalDynamicRenderResourcePool::ApplyModelMatrixUpdate");
+
+    if (Update.MatrixCount > RenderModelMatrices.Size())
+    {
+        RenderModelMatrices.Resize(Update.MatrixCount);
+    }
+
+    FModelMatrixDirtyPages Changed;
+    const FMatrix4x4f*     Source = Update.Matrices.Data();
+    for (const auto& Range : Update.Ranges)
+    {
+        std::memcpy(RenderModelMatrices.Data() + Range.FirstIndex, Source, Range.Count * sizeof(FMatrix4x4f));
+        Source += Range.Count;
+        for (UInt32 Index = Range.FirstIndex; Index < Range.FirstIndex + Range.Count;
+             Index += FModelMatrixDirtyPages::PageSize)
+        {
+            Changed.Mark(Index);
+        }
+    }
+
+    // 每个在途帧的缓冲都需要在下次使用前补上这些变化
+    for (auto& Frame : FrameBuffers)
+    {
+        Frame.DirtyPages.Merge(Changed);
+    }
 }
 
-void FGlobalDynamicRenderResourcePool::SyncToGPU()
+void FGlobalDynamicRenderResourcePool::SyncToGPU(UInt32 FrameIndex)
 {
-    HK_ASSERT_MSG(MappedPtr, "ModelMatrixBuffer 未映射");
-    std::memcpy(MappedPtr, ModelMatrixArray.Data(), ModelMatrixArray.Size() * sizeof(FMatrix4x4f));
+    HK_PROFILE_SCOPE_N("FGlobalDynamicRenderResourcePool::SyncToGPU");
+    HK_ASSERT_MSG(FrameIndex < FrameBuffers.Size(), "在途帧索引超出范围");
+
+    FFrameModelMatrixBuffer& Frame = FrameBuffers[FrameIndex];
+    EnsureFrameBufferCapacity(Frame);
+    HK_ASSERT_MSG(Frame.MappedPtr, "ModelMatrixBuffer 未映射");
+
+    auto* Destination = static_cast<FMatrix4x4f*>(Frame.MappedPtr);
+    Frame.DirtyPages.ConsumeRanges(static_cast<UInt32>(RenderModelMatrices.Size()),
+                                   [this, Destination](UInt32 FirstIndex, UInt32 Count) {
+                                       std::memcpy(Destination + FirstIndex, RenderModelMatrices.Data() + FirstIndex,
+                                                   Count * sizeof(FMatrix4x4f));
+                                   });
 }
 
-Int16 FGlobalDynamicRenderResourcePool::AddRendererIndexMap(FRenderer* Renderer)
+Int32 FGlobalDynamicRenderResourcePool::AddRendererIndexMap(FRenderer* Renderer)
 {
     if (Renderer == nullptr)
     {
@@ -291,24 +531,24 @@ Int16 FGlobalDynamicRenderResourcePool::AddRendererIndexMap(FRenderer* Renderer)
     {
         return *Found;
     }
-    Int16 Index = FindNextEmptyModelMatrixIndex();
+    Int32 Index = FindNextEmptyModelMatrixIndex();
     if (Index < 0)
     {
         HK_LOG_ERROR(ELogcat::Render, "模型矩阵池已满，无法添加更多渲染器");
         return -1;
     }
     RendererModelMatrixIndexMap.Add(Renderer, Index);
-    ModelMatrixOccupiedBitmap[Index].Flip();
+    ModelMatrixFreeSlots.Clear(Index);
     return Index;
 }
 
-Int16 FGlobalDynamicRenderResourcePool::GetRendererIndexMap(FRenderer* Renderer) const
+Int32 FGlobalDynamicRenderResourcePool::GetRendererIndexMap(FRenderer* Renderer) const
 {
     if (Renderer == nullptr)
     {
         return -1;
     }
-    const Int16* IndexPtr = RendererModelMatrixIndexMap.Find(Renderer);
+    const Int32* IndexPtr = RendererModelMatrixIndexMap.Find(Renderer);
     if (IndexPtr == nullptr)
     {
         return -1;
@@ -327,7 +567,8 @@ bool FGlobalDynamicRenderResourcePool::RemoveRendererIndexMap(FRenderer* Rendere
     {
         return false;
     }
+    const Int32 Index = *Found;
     RendererModelMatrixIndexMap.Remove(Renderer);
-    ModelMatrixOccupiedBitmap[*Found].Flip();
+    ModelMatrixFreeSlots.Set(Index);
     return true;
-}
\ No newline at end of file
+}
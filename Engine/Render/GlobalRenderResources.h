@@ -1,22 +1,63 @@
 #pragma once
+#include "Core/Container/Array.h"
 #include "Core/Container/Bitmap.h"
+#include "Core/Container/FixedArray.h"
 #include "Core/Container/Map.h"
 #include "Core/Singleton/Singleton.h"
 #include "Math/Matrix.h"
+#include "RHI/RHIBuffer.h"
 #include "RHI/RHIDescriptorSet.h"
 #include "RHI/RHISampler.h"
 #include "Render/RenderOptions.h"
 
+#include <algorithm>
+#include <bit>
+#include <mutex>
+
 class FRenderer;
 class HTexture;
 class FGlobalStaticRenderResourcePool : public TSingleton<FGlobalStaticRenderResourcePool>
 {
-    TMap<HTexture*, Int16>                                  TextureIndexMap;
-    TFixedArray<HTexture*, HK_RENDER_BINDLESS_MAX_TEXTURES> TextureArray;
+    // 等待写入描述符集的纹理
+    struct FPendingTextureWrite
+    {
+        Int16         Index = -1;
+        FRHIImageView ImageView;
+    };
+
+    // 等待写入描述符集的采样器
+    struct FPendingSamplerWrite
+    {
+        Int16       Index = -1;
+        FRHISampler Sampler;
+    };
+
+    // 已经移除的纹理索引, 等到可能引用它的帧都完成后才能复用
+    struct FRetiredTextureIndex
+    {
+        Int16  Index        = -1;
+        UInt64 ReleaseFlush = 0; // FlushCount 达到该值后回收到空闲列表
+    };
+
+    // ---- Game线程 ----
+    TMap<HTexture*, Int16> TextureIndexMap;
+    TArray<HTexture*>      TextureArray;
 
     // FRHISamplerDesc Hash to SamplerIndex
-    TMap<UInt64, Int16>                                       SamplerIndexMap;
-    TFixedArray<FRHISampler, HK_RENDER_BINDLESS_MAX_SAMPLERS> SamplerArray;
+    TMap<UInt64, Int16> SamplerIndexMap;
+    TArray<FRHISampler> SamplerArray;
+
+    // ---- Game线程与Render线程共享, 由 PendingMutex 保护 ----
+    std::mutex PendingMutex;
+    // 空闲索引栈, 栈顶是最小的索引
+    TArray<Int16> FreeTextureIndices;
+    TArray<Int16> FreeSamplerIndices;
+    // 按移除顺序排列, ReleaseFlush 单调递增
+    TArray<FRetiredTextureIndex> RetiredTextureIndices;
+    TArray<FPendingTextureWrite> PendingTextureWrites;
+    TArray<FPendingSamplerWrite> PendingSamplerWrites;
+    // FlushDescriptorWrites 的调用次数, 每个渲染帧一次
+    UInt64 FlushCount = 0;
 
     Int16 FindEmptyTextureIndex();
     Int16 FindEmptySamplerIndex();
@@ -25,8 +66,11 @@ class FGlobalStaticRenderResourcePool : public TSingleton<FGlobalStaticRenderRes
     void RemoveTexture(HTexture* InTexture);
 
 public:
+    void StartUp() override;
+
     /**
      * 向纹理池中分配一个纹理, 如果纹理为空 or 纹理已经存在于纹理池中, 则不做任何操作
+     * 描述符不会立即写入, 而是在下一次 FlushDescriptorWrites 时批量写入
      * @param InTexture
      */
     void AddTexture(HTexture* InTexture);
@@ -64,44 +108,210 @@ public:
      * @return 采样器索引，如果添加失败返回 -1
      */
     Int16 GetOrAddSamplerIndex(const FRHISamplerDesc& SamplerDesc);
+
+    /**
+     * 把排队的纹理与采样器描述符在一次 UpdateDescriptorSet 中写入, 并回收已经安全的纹理索引
+     * 在Render线程每帧调用一次, 必须在该帧的栅栏等待完成之后、录制命令之前调用
+     * 描述符集开启了 UpdateAfterBind 与 UpdateUnusedWhilePending, 写入不会影响仍在执行的帧
+     */
+    void FlushDescriptorWrites();
+};
+
+/**
+ * 以页为粒度记录哪些模型矩阵发生了变化, 一页包含 PageSize 个矩阵
+ * 分散的少量修改只会标记少量页, 收集时相邻的脏页合并为一个连续区间
+ */
+class FModelMatrixDirtyPages
+{
+public:
+    static constexpr UInt32 PageSize = 64;
+
+    void Mark(UInt32 MatrixIndex);
+
+    /**
+     * 标记 [0, MatrixCount) 全部为脏
+     */
+    void MarkAll(UInt32 MatrixCount);
+
+    /**
+     * 合并另一组脏页
+     */
+    void Merge(const FModelMatrixDirtyPages& Other);
+
+    bool IsEmpty() const
+    {
+        return bEmpty;
+    }
+
+    /**
+     * 按升序遍历合并后的脏区间并清空记录
+     * @param MatrixCount 当前矩阵总数, 超出部分被截断
+     * @param Callback 形如 void(UInt32 FirstIndex, UInt32 Count)
+     */
+    template <typename Func>
+    void ConsumeRanges(UInt32 MatrixCount, Func&& Callback)
+    {
+        if (bEmpty)
+        {
+            return;
+        }
+        UInt32 RunBegin = 0;
+        UInt32 RunEnd   = 0;
+        for (UInt32 WordIndex = 0; WordIndex < Words.Size(); ++WordIndex)
+        {
+            UInt64 Word = Words[WordIndex];
+            while (Word != 0)
+            {
+                const UInt32 Page      = WordIndex * 64 + static_cast<UInt32>(std::countr_zero(Word));
+                const UInt32 PageBegin = Page * PageSize;
+                if (PageBegin >= MatrixCount)
+                {
+                    break;
+                }
+                const UInt32 PageEnd = std::min(PageBegin + PageSize, MatrixCount);
+                if (RunEnd != PageBegin || RunEnd == RunBegin)
+                {
+                    if (RunEnd > RunBegin)
+                    {
+                        Callback(RunBegin, RunEnd - RunBegin);
+                    }
+                    RunBegin = PageBegin;
+                }
+                RunEnd = PageEnd;
+                Word &= Word - 1;
+            }
+            Words[WordIndex] = 0;
+        }
+        if (RunEnd > RunBegin)
+        {
+            Callback(RunBegin, RunEnd - RunBegin);
+        }
+        bEmpty = true;
+    }
+
+private:
+    TArray<UInt64> Words;
+    bool           bEmpty = true;
 };
 
+/**
+ * 一帧中发生变化的模型矩阵, 由Game线程在生成快照时收集, Render线程应用到自己的副本上
+ */
+struct FModelMatrixUpdate
+{
+    struct FRange
+    {
+        UInt32 FirstIndex = 0;
+        UInt32 Count      = 0;
+    };
+
+    // 快照时刻的模型矩阵总数
+    UInt32 MatrixCount = 0;
+    // 变化的区间, 对应的矩阵依次存放在 Matrices 中
+    TArray<FRange>      Ranges;
+    TArray<FMatrix4x4f> Matrices;
+};
+
+/**
+ * 模型矩阵池
+ * Game线程维护 ModelMatrixArray 并记录脏页, 每帧只把变化的部分放入快照
+ * Render线程持有一份副本, 并为每个在途帧维护一个独立的 GPU 缓冲, 写入当前帧时不会覆盖 GPU 仍在读取的数据
+ */
 class FGlobalDynamicRenderResourcePool : public TSingleton<FGlobalDynamicRenderResourcePool>
 {
-    // GPU侧模型矩阵
-    FRHIBuffer ModelMatrixBuffer;
+    struct FFrameModelMatrixBuffer
+    {
+        FRHIBuffer Buffer;
+        void*      MappedPtr = nullptr;
+        UInt32     Capacity  = 0;
+        // 该帧缓冲上次写入之后发生变化的矩阵
+        FModelMatrixDirtyPages DirtyPages;
+    };
+
+    // ---- Game线程 ----
     // Renderer到ModelMatrixIndex的Map
-    TMap<FRenderer*, Int16> RendererModelMatrixIndexMap;
-    // 一个Bitmap，用于记录ModelMatrixArray中哪些位置被占用
-    FDynamicBitmap ModelMatrixOccupiedBitmap;
+    TMap<FRenderer*, Int32> RendererModelMatrixIndexMap;
+    // 每个置位表示 ModelMatrixArray 中对应的位置空闲
+    FHierarchicalBitmap ModelMatrixFreeSlots;
     // 当前全部的ModelMatrix
     TArray<FMatrix4x4f> ModelMatrixArray;
-    // ModelMatrixBuffer的映射指针
-    void* MappedPtr = nullptr;
+    // 上次生成快照之后发生变化的矩阵
+    FModelMatrixDirtyPages GameDirtyPages;
+
+    // ---- Render线程 ----
+    // 应用快照之后的模型矩阵副本
+    TArray<FMatrix4x4f>                                                RenderModelMatrices;
+    TFixedArray<FFrameModelMatrixBuffer, HK_RENDER_MAX_FRAME_IN_FLIGHT> FrameBuffers;
 
 private:
-    Int16 FindNextEmptyModelMatrixIndex();
+    Int32 FindNextEmptyModelMatrixIndex();
+
+    void EnsureFrameBufferCapacity(FFrameModelMatrixBuffer& Frame);
 
 public:
     void StartUp() override;
     void ShutDown() override;
 
+    /**
+     * 更新一个模型矩阵, 只能在Game线程调用
+     * @param ModelMatrix 新的模型矩阵
+     * @param Index 模型矩阵索引
+     */
     void UpdateModelMatrix(const FMatrix4x4f& ModelMatrix, Int32 Index);
-    void SyncToGPU();
+
+    /**
+     * 收集上次调用之后变化的模型矩阵, 只能在Game线程调用
+     * @param OutUpdate 输出的变化, 原有内容会被覆盖
+     */
+    void CaptureModelMatrixUpdate(FModelMatrixUpdate& OutUpdate);
+
+    /**
+     * 把快照中的变化应用到Render线程的副本, 每个快照必须恰好应用一次
+     * @param Update 快照中的变化
+     */
+    void ApplyModelMatrixUpdate(const FModelMatrixUpdate& Update);
+
+    /**
+     * 把该在途帧缓冲过期的部分写入GPU, 需要在该帧的栅栏等待完成后调用
+     * @param FrameIndex 在途帧索引
+     */
+    void SyncToGPU(UInt32 FrameIndex);
+
+    /**
+     * 获取在途帧使用的模型矩阵缓冲, 缓冲在扩容时会被重新创建
+     * @param FrameIndex 在途帧索引
+     */
+    const FRHIBuffer& GetModelMatrixBuffer(UInt32 FrameIndex) const
+    {
+        return FrameBuffers[FrameIndex].Buffer;
+    }
+
+    const TArray<FMatrix4x4f>& GetModelMatrices() const
+    {
+        return ModelMatrixArray;
+    }
+
+    /**
+     * Render线程的模型矩阵副本, 只能在Render线程访问
+     */
+    const TArray<FMatrix4x4f>& GetRenderModelMatrices() const
+    {
+        return RenderModelMatrices;
+    }
 
     /**
      * 增加一个Renderer的Map
      * @param Renderer
-     * @return
+     * @return 模型矩阵索引, 失败返回 -1
      */
-    Int16 AddRendererIndexMap(FRenderer* Renderer);
+    Int32 AddRendererIndexMap(FRenderer* Renderer);
 
     /**
      * 获取一个Renderer的Map
      * @param Renderer
      * @return
      */
-    Int16 GetRendererIndexMap(FRenderer* Renderer) const;
+    Int32 GetRendererIndexMap(FRenderer* Renderer) const;
 
     /**
      * 移除一个Renderer的Map
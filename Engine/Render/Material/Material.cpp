@@ -3,68 +3,93 @@
 //
 
 #include "Material.h"
+#include "MaterialTable.h"
 #include "Render/GlobalRenderResources.h"
 #include "Render/Shader/Shader.h"
 #include "SharedMaterial.h"
 
 HMaterial::HMaterial() : ParameterBlock(nullptr) {}
 
-HMaterial::~HMaterial() {}
+HMaterial::~HMaterial()
+{
+    if (MaterialSlot != FGlobalMaterialTable::InvalidSlot)
+    {
+        FGlobalMaterialTable::GetRef().FreeSlot(MaterialSlot);
+        MaterialSlot = FGlobalMaterialTable::InvalidSlot;
+    }
+}
 
-void HMaterial::BindTexture(const FName& InName, HTexture* InTexture)
+void HMaterial::SetShader(HShader* InShader)
 {
-    if (InTexture == nullptr)
+    Shader         = InShader;
+    ParameterBlock = FMaterialParameterBlock(InShader);
+    SharedMaterial = FSharedMaterialManager::GetRef().RequestSharedMaterial(InShader);
+
+    auto& MaterialTable = FGlobalMaterialTable::GetRef();
+    if (MaterialSlot != FGlobalMaterialTable::InvalidSlot)
     {
-        HK_LOG_ERROR(ELogcat::Render, "绑定材质 {} 纹理 {} 失败: 纹理为空", Name, InName);
-        return;
+        MaterialTable.FreeSlot(MaterialSlot);
     }
-    if (!ParameterBlock.IsValid())
+    MaterialSlot = InShader != nullptr ? MaterialTable.AllocateSlot() : FGlobalMaterialTable::InvalidSlot;
+}
+
+bool HMaterial::WriteParameter(const FMaterialParameterHandle& Handle, const void* Data, const UInt32 Size)
+{
+    if (!Handle.IsValid() || MaterialSlot == FGlobalMaterialTable::InvalidSlot)
     {
-        HK_LOG_ERROR(ELogcat::Render, "绑定材质 {} 纹理 {} 失败: 参数块无效", Name, InName);
-        return;
+        HK_LOG_ERROR(ELogcat::Render, "写入材质 {} 参数失败: 参数句柄无效或材质没有着色器", Name);
+        return false;
     }
-    FMaterialParameter Parameter = ParameterBlock.GetParameter(InName);
-    if (!Parameter.IsValid())
+    if (Size > Handle.Size)
     {
-        HK_LOG_ERROR(ELogcat::Render, "绑定材质 {} 纹理 {} 失败: 参数无效", Name, InName);
-        return;
+        HK_LOG_ERROR(ELogcat::Render, "写入材质 {} 参数失败: 数据大小 {} 超过参数大小 {}", Name, Size, Handle.Size);
+        return false;
     }
+    return FGlobalMaterialTable::GetRef().WriteSlot(MaterialSlot, Handle.Offset, Data, Size);
+}
 
-    // 确保 ParameterBuffer 有足够的大小
-    UInt32 RequiredSize = ParameterBlock.GetBlockSize();
-    if (ParameterBuffer.Size() < RequiredSize)
+bool HMaterial::SetTextureParameter(const FMaterialParameterHandle& Handle, HTexture* InTexture)
+{
+    if (InTexture == nullptr)
     {
-        ParameterBuffer.Resize(RequiredSize);
-        ParameterBuffer.Fill(0); // 初始化为 0
+        HK_LOG_ERROR(ELogcat::Render, "写入材质 {} 纹理参数失败: 纹理为空", Name);
+        return false;
     }
 
     // 使用 FGlobalStaticResourcePool 获取或添加纹理索引
-    auto& ResourcePool = FGlobalStaticRenderResourcePool::GetRef();
-    Int16 TextureIndex = ResourcePool.GetOrAddTextureIndex(InTexture);
-
+    const Int16 TextureIndex = FGlobalStaticRenderResourcePool::GetRef().GetOrAddTextureIndex(InTexture);
     if (TextureIndex < 0)
     {
-        HK_LOG_ERROR(ELogcat::Render, "绑定材质 {} 纹理 {} 失败: 无法获取纹理索引", Name, InName);
-        return;
+        HK_LOG_ERROR(ELogcat::Render, "写入材质 {} 纹理参数失败: 无法获取纹理索引", Name);
+        return false;
     }
 
-    // 写入纹理索引（Int16）
-    UInt16 IndexValue = static_cast<UInt16>(TextureIndex);
-    if (!ParameterBuffer.Write(Parameter.Offset, IndexValue))
+    // 着色器中索引可以声明为 uint16 或 uint
+    if (Handle.Size == sizeof(UInt16))
     {
-        HK_LOG_ERROR(ELogcat::Render, "绑定材质 {} 纹理 {} 失败: 写入 ParameterBuffer 失败", Name, InName);
-        return;
+        return SetParameter(Handle, static_cast<UInt16>(TextureIndex));
     }
+    return SetParameter(Handle, static_cast<UInt32>(TextureIndex));
+}
 
-    // 标记参数已更新
-    SetParameterUpdateDirty(true);
+void HMaterial::BindTexture(const FName& InName, HTexture* InTexture)
+{
+    const FMaterialParameterHandle Handle = FindParameterHandle(InName);
+    if (!Handle.IsValid())
+    {
+        HK_LOG_ERROR(ELogcat::Render, "绑定材质 {} 纹理 {} 失败: 参数无效", Name, InName);
+        return;
+    }
+    if (!SetTextureParameter(Handle, InTexture))
+    {
+        HK_LOG_ERROR(ELogcat::Render, "绑定材质 {} 纹理 {} 失败", Name, InName);
+        return;
+    }
 
-    HK_LOG_INFO(ELogcat::Render, "绑定材质 {} 纹理 {} 成功: Index={}, Offset={}, Size={}", Name, InName, TextureIndex,
-                Parameter.Offset, Parameter.Size);
+    HK_LOG_INFO(ELogcat::Render, "绑定材质 {} 纹理 {} 成功: Slot={}, Offset={}, Size={}", Name, InName, MaterialSlot,
+                Handle.Offset, Handle.Size);
 }
 
-void HMaterial::BindModelMatrixIndex(const UInt32 InModelIndex) {}
-
 FMaterialParameterBlock::FMaterialParameterBlock(const HShader* InShader)
 {
     if (InShader == nullptr)
@@ -72,16 +97,20 @@ FMaterialParameterBlock::FMaterialParameterBlock(const HShader* InShader)
         return;
     }
     const auto& ParameterSheet = InShader->GetCompileResult().ParameterSheet;
-    if (!ParameterSheet.bIsValid)
+    if (!ParameterSheet.bIsValid || ParameterSheet.MaterialParameters.IsEmpty())
     {
         return;
     }
-    Parameters.Reserve(ParameterSheet.PushConstants.Size());
-    for (const auto& PushConstant : ParameterSheet.PushConstants)
+    Parameters.Reserve(ParameterSheet.MaterialParameters.Size());
+    for (const auto& Item : ParameterSheet.MaterialParameters)
     {
-        FMaterialParameter Parameter{PushConstant.Name, PushConstant.Offset, PushConstant.Size};
+        FMaterialParameter Parameter{Item.Name, Item.Offset, Item.Size};
         Parameters.Add(Parameter);
     }
     Parameters.Sort([](const FMaterialParameter& A, const FMaterialParameter& B) { return A.Offset < B.Offset; });
+    for (UInt32 Index = 0; Index < Parameters.Size(); ++Index)
+    {
+        ParameterIndices.Add(Parameters[Index].Name, Index);
+    }
     BlockSize = Parameters.Back().Offset + Parameters.Back().Size;
-}
\ No newline at end of file
+}
@@ -1,9 +1,11 @@
 #pragma once
-#include "Core/Container/Buffer.h"
+#include "Core/Container/Map.h"
 #include "Core/Utility/SharedPtr.h"
 #include "Object/Asset.h"
 #include "Object/ObjectPtr.h"
 
+#include <type_traits>
+
 #include "Material.generated.h"
 
 class HTexture;
@@ -27,12 +29,29 @@ struct FMaterialParameter
     }
 };
 
+/**
+ * 材质参数在槽位中的位置, 由 HMaterial::FindParameterHandle 解析一次后缓存, 之后写入参数不再需要按名字查找
+ * 同一着色器的所有材质共享布局, 句柄可以在这些材质之间复用
+ */
+struct FMaterialParameterHandle
+{
+    UInt32 Offset = 0;
+    UInt32 Size   = 0;
+
+    bool IsValid() const
+    {
+        return Size != 0;
+    }
+};
+
 struct FMaterialParameterBlock
 {
 private:
     // Offset从小到大排列
     TArray<FMaterialParameter> Parameters;
-    UInt32                     BlockSize;
+    // 参数名到 Parameters 下标
+    TMap<FName, UInt32> ParameterIndices;
+    UInt32              BlockSize = 0;
 
 public:
     explicit FMaterialParameterBlock(const HShader* InShader);
@@ -44,16 +63,22 @@ public:
 
     FMaterialParameter GetParameter(const FName& InName) const
     {
-        for (const auto& Parameter : Parameters)
+        if (const UInt32* Index = ParameterIndices.Find(InName))
         {
-            if (Parameter.Name == InName)
-            {
-                return Parameter;
-            }
+            return Parameters[*Index];
         }
         return {Names::None, 0, 0};
     }
 
+    FMaterialParameterHandle FindParameter(const FName& InName) const
+    {
+        if (const UInt32* Index = ParameterIndices.Find(InName))
+        {
+            return {Parameters[*Index].Offset, Parameters[*Index].Size};
+        }
+        return {};
+    }
+
     UInt32 GetBlockSize() const
     {
         return BlockSize;
@@ -69,34 +94,83 @@ public:
     ~HMaterial() override;
 
     /**
-     * 绑定一个纹理参数
+     * 设置着色器, 重新生成参数布局与共享管线状态, 并在全局材质参数表中分配槽位
+     * 切换着色器后槽位内容清零, 之前解析的参数句柄失效
+     * @param InShader
+     */
+    void SetShader(HShader* InShader);
+
+    const HShader* GetShader() const
+    {
+        return Shader.Get();
+    }
+
+    /**
+     * 按名字解析参数句柄, 结果应当缓存起来重复使用
+     * @param InName 着色器 MaterialParameters 结构体中的成员名
+     * @return 参数不存在时返回无效句柄
+     */
+    FMaterialParameterHandle FindParameterHandle(const FName& InName) const
+    {
+        return ParameterBlock.FindParameter(InName);
+    }
+
+    /**
+     * 写入一个参数, 只有内容变化时才会在下一帧上传该材质的槽位
+     * @param Handle 参数句柄
+     * @param Value 值, 大小不能超过参数的大小
+     * @return 是否写入
+     */
+    template <typename T>
+    bool SetParameter(const FMaterialParameterHandle& Handle, const T& Value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "材质参数必须可以按字节复制");
+        return WriteParameter(Handle, &Value, sizeof(T));
+    }
+
+    /**
+     * 写入一个纹理参数, 参数中保存纹理在 bindless 纹理表中的索引
+     * @param Handle 参数句柄
+     * @param InTexture
+     * @return 是否写入
+     */
+    bool SetTextureParameter(const FMaterialParameterHandle& Handle, HTexture* InTexture);
+
+    /**
+     * 绑定一个纹理参数, 每次调用都会按名字查找, 频繁更新时使用 FindParameterHandle + SetTextureParameter
      * @param InName
      * @param InTexture
      */
     void BindTexture(const FName& InName, HTexture* InTexture);
 
     /**
-     * 绑定一个模型矩阵的索引
-     * @param InModelIndex
+     * 获取共享的管线状态, 相同着色器的材质返回同一个对象
+     * @return 着色器尚未创建管线时返回 nullptr
      */
-    void BindModelMatrixIndex(const UInt32 InModelIndex);
-
-protected:
-    void SetParameterUpdateDirty(bool InDirty)
+    const FSharedMaterial* GetSharedMaterial() const
     {
-        bParameterUpdateDirty = InDirty;
+        return SharedMaterial.Get();
     }
 
-    bool bParameterUpdateDirty = true;
+    /**
+     * 材质在全局材质参数表中的槽位, 着色器通过实例数据读取
+     * @return 尚未设置着色器时返回 FGlobalMaterialTable::InvalidSlot
+     */
+    UInt32 GetMaterialSlot() const
+    {
+        return MaterialSlot;
+    }
 
 private:
+    bool WriteParameter(const FMaterialParameterHandle& Handle, const void* Data, UInt32 Size);
+
     HPROPERTY()
     TObjectPtr<class HShader> Shader;
 
     TSharedPtr<FSharedMaterial> SharedMaterial;
 
-    // 参数Buffer, 使用PushConstant传递给GPU
-    FBuffer ParameterBuffer;
     // 参数块的信息
     FMaterialParameterBlock ParameterBlock;
+    // 全局材质参数表中的槽位, 参数直接写入槽位, 由材质表负责脏标记与上传
+    UInt32 MaterialSlot = UINT32_MAX;
 };
@@ -0,0 +1,226 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "MaterialTable.h"
+
+#include "Core/Logging/Logger.h"
+#include "Core/Utility/Profiler.h"
+#include "RHI/GfxDevice.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+void FGlobalMaterialTable::MarkDirty(TArray<UInt64>& Words, const UInt32 Slot)
+{
+    const UInt32 WordIndex = Slot / 64;
+    if (WordIndex >= Words.Size())
+    {
+        Words.Resize(WordIndex + 1, 0);
+    }
+    Words[WordIndex] |= UInt64(1) << (Slot % 64);
+}
+
+void FGlobalMaterialTable::EnsureFrameBufferCapacity(FFrameMaterialBuffer& Frame)
+{
+    const UInt32 RequiredCount = static_cast<UInt32>(RenderSlotData.Size() / SlotSize);
+    if (Frame.Buffer.IsValid() && Frame.Capacity >= RequiredCount)
+    {
+        return;
+    }
+
+    // 该帧的栅栏已经等待完成, 旧缓冲不再被GPU使用, 可以直接销毁
+    auto& GfxDevice = GetGfxDeviceRef();
+    if (Frame.Buffer.IsValid())
+    {
+        GfxDevice.DestroyBuffer(Frame.Buffer);
+    }
+    UInt32 NewCapacity = std::max<UInt32>(Frame.Capacity, HK_RENDER_INIT_MATERIAL_SLOT_COUNT);
+    while (NewCapacity < RequiredCount)
+    {
+        NewCapacity *= 2;
+    }
+
+    FRHIBufferDesc BufferDesc{};
+    BufferDesc.Usage          = ERHIBufferUsage::StorageBuffer;
+    BufferDesc.Size           = static_cast<UInt64>(NewCapacity) * SlotSize;
+    BufferDesc.MemoryProperty = ERHIBufferMemoryProperty::HostVisible | ERHIBufferMemoryProperty::HostCoherent;
+    BufferDesc.DebugName      = FString("MaterialTableBuffer");
+    Frame.Buffer              = GfxDevice.CreateBuffer(BufferDesc);
+    Frame.MappedPtr           = Frame.Buffer.Map();
+    Frame.Capacity            = NewCapacity;
+
+    // 新缓冲内容未定义, 需要完整写入一次
+    Frame.DirtyWords.Resize((RequiredCount + 63) / 64, 0);
+    for (UInt32 Slot = 0; Slot < RequiredCount; ++Slot)
+    {
+        Frame.DirtyWords[Slot / 64] |= UInt64(1) << (Slot % 64);
+    }
+}
+
+void FGlobalMaterialTable::StartUp()
+{
+    SlotData.Reserve(static_cast<size_t>(HK_RENDER_INIT_MATERIAL_SLOT_COUNT) * SlotSize);
+    SlotCount = 0;
+}
+
+void FGlobalMaterialTable::ShutDown()
+{
+    SlotData        = {};
+    SlotCount       = 0;
+    FreeSlots       = {};
+    GameDirtyWords  = {};
+    RenderSlotData  = {};
+    auto& GfxDevice = GetGfxDeviceRef();
+    for (auto& Frame : FrameBuffers)
+    {
+        if (Frame.Buffer.IsValid())
+        {
+            GfxDevice.DestroyBuffer(Frame.Buffer);
+        }
+        Frame = FFrameMaterialBuffer();
+    }
+}
+
+UInt32 FGlobalMaterialTable::AllocateSlot()
+{
+    UInt32 Slot;
+    if (!FreeSlots.IsEmpty())
+    {
+        Slot = FreeSlots.Back();
+        FreeSlots.Pop();
+    }
+    else
+    {
+        Slot = SlotCount++;
+        SlotData.Resize(static_cast<size_t>(SlotCount) * SlotSize, 0);
+    }
+    std::memset(SlotData.Data() + static_cast<size_t>(Slot) * SlotSize, 0, SlotSize);
+    MarkDirty(GameDirtyWords, Slot);
+    return Slot;
+}
+
+void FGlobalMaterialTable::FreeSlot(const UInt32 Slot)
+{
+    if (Slot >= SlotCount)
+    {
+        return;
+    }
+    FreeSlots.Add(Slot);
+}
+
+bool FGlobalMaterialTable::WriteSlot(const UInt32 Slot, const UInt32 Offset, const void* Data, const UInt32 Size)
+{
+    if (Slot >= SlotCount || Offset + Size > SlotSize)
+    {
+        HK_LOG_ERROR(ELogcat::Render, "材质槽位写入越界: Slot={}, Offset={}, Size={}", Slot, Offset, Size);
+        return false;
+    }
+    UInt8* Destination = SlotData.Data() + static_cast<size_t>(Slot) * SlotSize + Offset;
+    if (std::memcmp(Destination, Data, Size) == 0)
+    {
+        return true;
+    }
+    std::memcpy(Destination, Data, Size);
+    MarkDirty(GameDirtyWords, Slot);
+    return true;
+}
+
+void FGlobalMaterialTable::CaptureUpdate(FMaterialTableUpdate& OutUpdate)
+{
+    HK_PROFILE_SCOPE_N("FGlobalMaterialTable::CaptureUpdate");
+
+    OutUpdate.SlotCount = SlotCount;
+    OutUpdate.Slots.Clear();
+    OutUpdate.Data.Clear();
+    for (UInt32 WordIndex = 0; WordIndex < GameDirtyWords.Size(); ++WordIndex)
+    {
+        UInt64 Word = GameDirtyWords[WordIndex];
+        while (Word != 0)
+        {
+            const UInt32 Slot   = WordIndex * 64 + static_cast<UInt32>(std::countr_zero(Word));
+            const UInt8* Source = SlotData.Data() + static_cast<size_t>(Slot) * SlotSize;
+            OutUpdate.Slots.Add(Slot);
+            OutUpdate.Data.Append(Source, Source + SlotSize);
+            Word &= Word - 1;
+        }
+        GameDirtyWords[WordIndex] = 0;
+    }
+}
+
+void FGlobalMaterialTable::ApplyUpdate(const FMaterialTableUpdate& Update)
+{
+    HK_PROFILE_SCOPE_N("FGlobalMaterialTable::ApplyUpdate");
+
+    const size_t RequiredSize = static_cast<size_t>(Update.SlotCount) * SlotSize;
+    if (RequiredSize > RenderSlotData.Size())
+    {
+        RenderSlotData.Resize(RequiredSize, 0);
+    }
+
+    const UInt8* Source = Update.Data.Data();
+    for (const UInt32 Slot : Update.Slots)
+    {
+        std::memcpy(RenderSlotData.Data() + static_cast<size_t>(Slot) * SlotSize, Source, SlotSize);
+        Source += SlotSize;
+        // 每个在途帧的缓冲都需要在下次使用前补上这些变化
+        for (auto& Frame : FrameBuffers)
+        {
+            MarkDirty(Frame.DirtyWords, Slot);
+        }
+    }
+}
+
+void FGlobalMaterialTable::SyncToGPU(const UInt32 FrameIndex)
+{
+    HK_PROFILE_SCOPE_N("FGlobalMaterialTable::SyncToGPU");
+    HK_ASSERT_MSG(FrameIndex < FrameBuffers.Size(), "在途帧索引超出范围");
+
+    if (RenderSlotData.IsEmpty())
+    {
+        return;
+    }
+
+    FFrameMaterialBuffer& Frame = FrameBuffers[FrameIndex];
+    EnsureFrameBufferCapacity(Frame);
+    HK_ASSERT_MSG(Frame.MappedPtr, "MaterialTableBuffer 未映射");
+
+    // 相邻的脏槽位合并为一次拷贝
+    auto*        Destination = static_cast<UInt8*>(Frame.MappedPtr);
+    const UInt32 Count       = static_cast<UInt32>(RenderSlotData.Size() / SlotSize);
+    auto         CopyRun     = [this, Destination](UInt32 FirstSlot, UInt32 EndSlot) {
+        const size_t Offset = static_cast<size_t>(FirstSlot) * SlotSize;
+        std::memcpy(Destination + Offset, RenderSlotData.Data() + Offset,
+                    static_cast<size_t>(EndSlot - FirstSlot) * SlotSize);
+    };
+    UInt32 RunBegin = 0;
+    UInt32 RunEnd   = 0;
+    for (UInt32 WordIndex = 0; WordIndex < Frame.DirtyWords.Size(); ++WordIndex)
+    {
+        UInt64 Word = Frame.DirtyWords[WordIndex];
+        while (Word != 0)
+        {
+            const UInt32 Slot = WordIndex * 64 + static_cast<UInt32>(std::countr_zero(Word));
+            if (Slot >= Count)
+            {
+                break;
+            }
+            if (Slot != RunEnd || RunEnd == RunBegin)
+            {
+                if (RunEnd > RunBegin)
+                {
+                    CopyRun(RunBegin, RunEnd);
+                }
+                RunBegin = Slot;
+            }
+            RunEnd = Slot + 1;
+            Word &= Word - 1;
+        }
+        Frame.DirtyWords[WordIndex] = 0;
+    }
+    if (RunEnd > RunBegin)
+    {
+        CopyRun(RunBegin, RunEnd);
+    }
+}
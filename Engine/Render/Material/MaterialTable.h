@@ -0,0 +1,108 @@
+#pragma once
+#include "Core/Container/Array.h"
+#include "Core/Container/FixedArray.h"
+#include "Core/Singleton/Singleton.h"
+#include "RHI/RHIBuffer.h"
+#include "Render/RenderOptions.h"
+
+/**
+ * 一帧中发生变化的材质槽位, 由Game线程在生成快照时收集, Render线程应用到自己的副本上
+ */
+struct FMaterialTableUpdate
+{
+    // 快照时刻的槽位总数
+    UInt32 SlotCount = 0;
+    // 变化的槽位, 对应的数据依次存放在 Data 中, 每个槽位 HK_RENDER_MATERIAL_SLOT_SIZE 字节
+    TArray<UInt32> Slots;
+    TArray<UInt8>  Data;
+};
+
+/**
+ * 全局材质参数表
+ * 每个材质占用一个固定大小的槽位, 所有材质的参数放在同一个 StorageBuffer 中, 着色器通过实例数据中的槽位索引读取
+ * 与模型矩阵池相同, Game线程维护槽位数据并记录脏槽位, 每帧只把变化的槽位放入快照;
+ * Render线程持有一份副本, 并为每个在途帧维护一个独立的 GPU 缓冲
+ */
+class FGlobalMaterialTable : public TSingleton<FGlobalMaterialTable>
+{
+public:
+    static constexpr UInt32 SlotSize    = HK_RENDER_MATERIAL_SLOT_SIZE;
+    static constexpr UInt32 InvalidSlot = UINT32_MAX;
+
+    void StartUp() override;
+    void ShutDown() override;
+
+    /**
+     * 分配一个槽位, 内容清零, 只能在Game线程调用
+     */
+    UInt32 AllocateSlot();
+
+    /**
+     * 释放槽位, 只能在Game线程调用
+     * 快照按帧顺序应用, 槽位被复用时新的内容会随后续快照覆盖旧内容
+     */
+    void FreeSlot(UInt32 Slot);
+
+    /**
+     * 写入槽位中的一段数据并标记为脏, 只能在Game线程调用
+     * @param Slot 槽位
+     * @param Offset 槽位内的字节偏移
+     * @param Data 数据
+     * @param Size 字节数, Offset + Size 不能超过 SlotSize
+     * @return 是否写入
+     */
+    bool WriteSlot(UInt32 Slot, UInt32 Offset, const void* Data, UInt32 Size);
+
+    /**
+     * 收集上次调用之后变化的槽位, 只能在Game线程调用
+     * @param OutUpdate 输出的变化, 原有内容会被覆盖
+     */
+    void CaptureUpdate(FMaterialTableUpdate& OutUpdate);
+
+    /**
+     * 把快照中的变化应用到Render线程的副本, 每个快照必须恰好应用一次
+     */
+    void ApplyUpdate(const FMaterialTableUpdate& Update);
+
+    /**
+     * 把该在途帧缓冲过期的槽位写入GPU, 需要在该帧的栅栏等待完成后调用
+     * @param FrameIndex 在途帧索引
+     */
+    void SyncToGPU(UInt32 FrameIndex);
+
+    /**
+     * 获取在途帧使用的材质参数缓冲, 缓冲在扩容时会被重新创建
+     * @param FrameIndex 在途帧索引
+     */
+    const FRHIBuffer& GetMaterialBuffer(UInt32 FrameIndex) const
+    {
+        return FrameBuffers[FrameIndex].Buffer;
+    }
+
+private:
+    struct FFrameMaterialBuffer
+    {
+        FRHIBuffer Buffer;
+        void*      MappedPtr = nullptr;
+        UInt32     Capacity  = 0;
+        // 该帧缓冲上次写入之后发生变化的槽位, 每个位对应一个槽位
+        TArray<UInt64> DirtyWords;
+    };
+
+    static void MarkDirty(TArray<UInt64>& Words, UInt32 Slot);
+
+    void EnsureFrameBufferCapacity(FFrameMaterialBuffer& Frame);
+
+    // ---- Game线程 ----
+    // 所有槽位的数据, 大小为 SlotCount * SlotSize
+    TArray<UInt8> SlotData;
+    UInt32        SlotCount = 0;
+    // 空闲槽位栈
+    TArray<UInt32> FreeSlots;
+    // 上次生成快照之后发生变化的槽位
+    TArray<UInt64> GameDirtyWords;
+
+    // ---- Render线程 ----
+    TArray<UInt8>                                                    RenderSlotData;
+    TFixedArray<FFrameMaterialBuffer, HK_RENDER_MAX_FRAME_IN_FLIGHT> FrameBuffers;
+};
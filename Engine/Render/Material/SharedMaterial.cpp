@@ -8,6 +8,8 @@
 #include "Render/RenderOptions.h"
 #include "Render/Shader/Shader.h"
 
+#include <algorithm>
+
 FRHIDescriptorSetLayout FRHIPipelineResourcePool::RequestDescriptorSetLayout(
     const FRHIDescriptorSetLayoutDesc& DescriptorSetDesc)
 {
@@ -100,6 +102,13 @@ FRHIDescriptorSetLayout FRHIPipelineResourcePool::RequestCommonDescriptorSetLayo
             Binding.DescriptorCount = 1;
             Binding.StageFlags      = ERHIShaderStage::Vertex;
             DescriptorSetDesc.Bindings.Add(Binding);
+            // 实例化绘制中每个实例对应的模型矩阵索引与材质槽位, 见 FDrawList
+            Binding.Binding = 1;
+            DescriptorSetDesc.Bindings.Add(Binding);
+            // 全局材质参数表, 见 FGlobalMaterialTable
+            Binding.Binding    = 2;
+            Binding.StageFlags = ERHIShaderStage::Vertex | ERHIShaderStage::Fragment;
+            DescriptorSetDesc.Bindings.Add(Binding);
             CommonDescriptorSets[static_cast<Int32>(Index)].Layout =
                 Device.CreateDescriptorSetLayout(DescriptorSetDesc);
         }
@@ -107,21 +116,28 @@ FRHIDescriptorSetLayout FRHIPipelineResourcePool::RequestCommonDescriptorSetLayo
         case ECommonDescriptorSetIndex::StaticResource:
         {
             DescriptorSetDesc.DebugName = FString("DescSetLayout_StaticResource");
+            // 描述符在绑定后批量写入, 空槽位与已移除的槽位不需要有效描述符
+            constexpr ERHIDescriptorBindingFlag BindlessFlags = ERHIDescriptorBindingFlag::UpdateAfterBind |
+                                                                ERHIDescriptorBindingFlag::UpdateUnusedWhilePending |
+                                                                ERHIDescriptorBindingFlag::PartiallyBound;
             FRHIDescriptorSetLayoutBinding Binding{};
             Binding.Binding         = 0;
             Binding.DescriptorType  = ERHIDescriptorType::SampledImage;
-            Binding.DescriptorCount = HK_RENDER_BINDLESS_MAX_TEXTURES;
+            Binding.DescriptorCount = BindlessTextureCapacity;
             Binding.StageFlags      = ERHIShaderStage::Vertex | ERHIShaderStage::Fragment;
+            Binding.Flags           = BindlessFlags;
             DescriptorSetDesc.Bindings.Add(Binding);
             FRHIDescriptorSetLayoutBinding Binding1{};
             Binding1.Binding         = 1;
             Binding1.DescriptorType  = ERHIDescriptorType::Sampler;
-            Binding1.DescriptorCount = HK_RENDER_BINDLESS_MAX_SAMPLERS;
+            Binding1.DescriptorCount = BindlessSamplerCapacity;
             Binding1.StageFlags      = ERHIShaderStage::Vertex | ERHIShaderStage::Fragment;
+            Binding1.Flags           = BindlessFlags;
             DescriptorSetDesc.Bindings.Add(Binding1);
             CommonDescriptorSets[static_cast<Int32>(Index)].Layout =
                 Device.CreateDescriptorSetLayout(DescriptorSetDesc);
         }
+        break;
         default:
             HK_LOG_FATAL(ELogcat::Render, "Invalid CommonDescriptorSetIndex {}", static_cast<Int32>(Index));
             break;
@@ -131,6 +147,14 @@ FRHIDescriptorSetLayout FRHIPipelineResourcePool::RequestCommonDescriptorSetLayo
 
 void FRHIPipelineResourcePool::StartUp()
 {
+    // 纹理索引以 Int16 保存, 宏给出的上限不能超过 Int16 的范围
+    static_assert(HK_RENDER_BINDLESS_MAX_TEXTURES <= INT16_MAX && HK_RENDER_BINDLESS_MAX_SAMPLERS <= INT16_MAX);
+    const FRHIBindlessLimits Limits = GetGfxDeviceRef().GetBindlessLimits();
+    BindlessTextureCapacity         = std::min<UInt32>(Limits.MaxSampledImages, HK_RENDER_BINDLESS_MAX_TEXTURES);
+    BindlessSamplerCapacity         = std::min<UInt32>(Limits.MaxSamplers, HK_RENDER_BINDLESS_MAX_SAMPLERS);
+    HK_LOG_INFO(ELogcat::Render, "Bindless table capacity: textures {}, samplers {}", BindlessTextureCapacity,
+                BindlessSamplerCapacity);
+
     CreateGlobalDescriptorPools();
 }
 
@@ -157,10 +181,10 @@ void FRHIPipelineResourcePool::CreateGlobalDescriptorPools()
     DescriptorPoolDesc.MaxSets   = 1;
     FRHIDescriptorPoolSize PoolSize{};
     PoolSize.Type  = ERHIDescriptorType::SampledImage;
-    PoolSize.Count = HK_RENDER_BINDLESS_MAX_TEXTURES;
+    PoolSize.Count = BindlessTextureCapacity;
     DescriptorPoolDesc.PoolSizes.Add(PoolSize);
     PoolSize.Type  = ERHIDescriptorType::Sampler;
-    PoolSize.Count = HK_RENDER_BINDLESS_MAX_SAMPLERS;
+    PoolSize.Count = BindlessSamplerCapacity;
     DescriptorPoolDesc.PoolSizes.Add(PoolSize);
     DescriptorPoolDesc.Flags =
         ERHIDescriptorPoolCreateFlag::UpdateAfterBind | ERHIDescriptorPoolCreateFlag::FreeDescriptorSet;
@@ -169,7 +193,8 @@ void FRHIPipelineResourcePool::CreateGlobalDescriptorPools()
     // Dynamic
     FRHIDescriptorPoolDesc DynamicDescriptorPoolDesc;
     DynamicDescriptorPoolDesc.DebugName = FString("DynamicDescriptorPool");
-    DynamicDescriptorPoolDesc.MaxSets   = 2;
+    // Camera 与 Model 各一个公共 DescriptorSet, 另外每个在途帧的 FDrawList 各有一个 Model DescriptorSet
+    DynamicDescriptorPoolDesc.MaxSets   = 2 + HK_RENDER_MAX_FRAME_IN_FLIGHT;
     FRHIDescriptorPoolSize DynamicPoolSize{};
     DynamicPoolSize.Type  = ERHIDescriptorType::UniformBuffer;
     DynamicPoolSize.Count = HK_RENDER_BINDLESS_MAX_UNIFORM_BUFFERS;
@@ -241,29 +266,31 @@ FSharedMaterial::FSharedMaterial(const HShader* InShader)
     FRHIPipelineLayoutDesc PipelineLayoutDesc;
     PipelineLayoutDesc.DebugName = std::format("PipelineLayout_{}", InShader->GetName());
 
-    // 根据需求添加公共 DescriptorSet
-    if (ParameterSheet.bNeedCamera)
+    // 公共 DescriptorSet 的 set 序号固定为 ECommonDescriptorSetIndex, 与 Common.slang 中的 vk::binding 一致
+    // 管线布局中的 set 必须连续, 用到后面的 DescriptorSet 时前面的也要加入
+    Int32 CommonSetCount = 0;
+    if (ParameterSheet.bNeedResourcePool)
     {
-        FRHIDescriptorSetLayout CameraLayout =
-            ResourcePool.RequestCommonDescriptorSetLayout(ECommonDescriptorSetIndex::Camera);
-        PipelineLayoutDesc.SetLayouts.Add(CameraLayout);
+        CommonSetCount = static_cast<Int32>(ECommonDescriptorSetIndex::StaticResource) + 1;
     }
-    if (ParameterSheet.bNeedModel)
+    else if (ParameterSheet.bNeedModel)
     {
-        FRHIDescriptorSetLayout ModelLayout =
-            ResourcePool.RequestCommonDescriptorSetLayout(ECommonDescriptorSetIndex::Model);
-        PipelineLayoutDesc.SetLayouts.Add(ModelLayout);
+        CommonSetCount = static_cast<Int32>(ECommonDescriptorSetIndex::Model) + 1;
     }
-    if (ParameterSheet.bNeedResourcePool)
+    else if (ParameterSheet.bNeedCamera)
+    {
+        CommonSetCount = static_cast<Int32>(ECommonDescriptorSetIndex::Camera) + 1;
+    }
+    for (Int32 Index = 0; Index < CommonSetCount; ++Index)
     {
-        FRHIDescriptorSetLayout StaticResourceLayout =
-            ResourcePool.RequestCommonDescriptorSetLayout(ECommonDescriptorSetIndex::StaticResource);
-        PipelineLayoutDesc.SetLayouts.Add(StaticResourceLayout);
+        PipelineLayoutDesc.SetLayouts.Add(
+            ResourcePool.RequestCommonDescriptorSetLayout(static_cast<ECommonDescriptorSetIndex>(Index)));
     }
+    bNeedModel = ParameterSheet.bNeedModel;
 
     // 3. 配置 PushConstant
-    // 根据 SimpleShading.slang，InstancePushConstants 包含 3 个 uint（ModelID, MainTextureID, MainSamplerStateID）
-    // 总共 12 字节，需要在 Vertex 和 Fragment 阶段都可用
+    // 材质参数通过 FGlobalMaterialTable 传递, PushConstant 只留给着色器自定义的少量数据
+    // PushConstant 需要在 Vertex 和 Fragment 阶段都可用
     if (!ParameterSheet.PushConstants.IsEmpty())
     {
         // 计算 PushConstant 的总大小（找到最小 offset 和最大 end offset）
@@ -287,7 +314,6 @@ FSharedMaterial::FSharedMaterial(const HShader* InShader)
         TotalSize        = (TotalSize + 3) & ~3; // 对齐到 4 字节边界
 
         // PushConstantRanges 格式：每4个UInt32表示一个范围（offset, size, stageFlags, 保留）
-        // 根据 SimpleShading.slang，PushConstant 在 Vertex 和 Fragment 阶段都使用
         PipelineLayoutDesc.PushConstantRanges.Add(MinOffset); // offset
         PipelineLayoutDesc.PushConstantRanges.Add(TotalSize); // size
         PipelineLayoutDesc.PushConstantRanges.Add(
@@ -296,8 +322,8 @@ FSharedMaterial::FSharedMaterial(const HShader* InShader)
     }
 
     // 4. 创建 PipelineLayout
-    FRHIPipelineLayout PipelineLayout = ResourcePool.RequestPipelineLayout(PipelineLayoutDesc);
-    PipelineLayoutHash                = PipelineLayoutDesc.GetHashCode();
+    PipelineLayout     = ResourcePool.RequestPipelineLayout(PipelineLayoutDesc);
+    PipelineLayoutHash = PipelineLayoutDesc.GetHashCode();
 
     // 5. 配置 PipelineDesc
     FRHIGraphicsPipelineDesc PipelineDesc;
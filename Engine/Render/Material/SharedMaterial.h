@@ -41,6 +41,9 @@ struct FRHIPipelineResourcePool : TSingleton<FRHIPipelineResourcePool>
 
     // 用于静态资产(纹理, 采样器等)的DescriptorPool, 开启了UpdateAfterBind
     FRHIDescriptorPool StaticResourcesDescriptorPool;
+    // bindless 纹理表与采样器表的大小, 取设备上限与 HK_RENDER_BINDLESS_MAX_* 中的较小者
+    UInt32 BindlessTextureCapacity = 0;
+    UInt32 BindlessSamplerCapacity = 0;
     // 每帧都可能变化的DescriptorPool, 一大用处是模型矩阵
     FRHIDescriptorPool DynamicResourcesDescriptorPool;
 
@@ -62,12 +65,25 @@ struct FRHIPipelineResourcePool : TSingleton<FRHIPipelineResourcePool>
     void DestroyGlobalDescriptorPools();
 
     FRHIDescriptorPool SelectDescriptorPool(ECommonDescriptorSetIndex Index) const;
+
+    UInt32 GetBindlessTextureCapacity() const
+    {
+        return BindlessTextureCapacity;
+    }
+
+    UInt32 GetBindlessSamplerCapacity() const
+    {
+        return BindlessSamplerCapacity;
+    }
 };
 
 struct FSharedMaterial
 {
-    FRHIPipeline Pipeline;
-    UInt64       PipelineLayoutHash;
+    FRHIPipeline       Pipeline;
+    FRHIPipelineLayout PipelineLayout;
+    UInt64             PipelineLayoutHash;
+    // 着色器是否读取 Model 描述符集, 绘制前需要在 ECommonDescriptorSetIndex::Model 绑定
+    bool bNeedModel = false;
 
     explicit FSharedMaterial(const HShader* InShader);
 
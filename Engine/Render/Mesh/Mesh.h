@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Reflection/Reflection.h"
+#include "Math/Box.h"
 #include "Object/Asset.h"
 #include "RHI/RHIBuffer.h"
 
@@ -11,6 +12,8 @@ struct FSubMesh
     FRHIBuffer VertexBuffer;
     UInt32     IndexCount;
     UInt32     VertexCount;
+    // 模型空间包围盒
+    FBox3f Bounds;
 };
 
 HCLASS()
@@ -59,6 +62,17 @@ public:
         return Total;
     }
 
+    // 获取模型空间包围盒（所有 SubMesh 的并集）
+    FBox3f GetBounds() const
+    {
+        FBox3f Bounds;
+        for (const FSubMesh& SubMesh : SubMeshes)
+        {
+            Bounds.Expand(SubMesh.Bounds);
+        }
+        return Bounds;
+    }
+
     // 获取指定 SubMesh 的顶点数
     UInt32 GetSubMeshVertexCount(UInt32 SubMeshIndex) const
     {
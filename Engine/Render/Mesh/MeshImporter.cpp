@@ -208,12 +208,6 @@ bool LoadMeshData(const FString& FilePath, EMeshImportFlag ImportFlags, TArray<F
     HK_LOG_INFO(ELogcat::Asset, "Loaded {} sub-meshes from: {}", OutMeshes.Size(), FilePath);
     return true;
 }
-
-// 获取中间文件路径
-FString GetIntermediatePath(const FUuid& Guid)
-{
-    return FString("Intermediate/Meshes/") + Guid.ToString() + ".bin";
-}
 } // namespace
 
 void FMeshImporter::BeginImport()
@@ -282,11 +276,8 @@ bool FMeshImporter::ProcessImport()
     }
 
     // 使用 MeshUtility 创建并上传 Mesh 到 GPU
-    TArray<FSubMesh>          SubMeshes;
-    TArray<FRHIBuffer>        StagingBuffers;
-    TArray<FRHICommandBuffer> CommandBuffers;
-
-    if (!FMeshUtility::CreateAndUploadMeshFromIntermediate(Intermediate, SubMeshes, StagingBuffers, CommandBuffers))
+    TArray<FSubMesh> SubMeshes;
+    if (!FMeshUtility::CreateAndUploadMeshFromIntermediate(Intermediate, SubMeshes, ImportData->Upload))
     {
         HK_LOG_ERROR(ELogcat::Asset, "Failed to create and upload mesh to GPU");
         return false;
@@ -296,10 +287,6 @@ bool FMeshImporter::ProcessImport()
     TArray<FSubMesh>& MeshSubMeshes = ImportData->Mesh->internalGetMutableSubMeshes();
     MeshSubMeshes                   = std::move(SubMeshes);
 
-    // 保存 staging buffers 和 command buffers 以便后续清理
-    ImportData->StagingBuffers = std::move(StagingBuffers);
-    ImportData->CommandBuffers = std::move(CommandBuffers);
-
     // 保存元数据
     Metadata->AssetType = EAssetType::Mesh;
     FAssetRegistry::GetRef().SaveAssetMetadata(Metadata);
@@ -318,7 +305,7 @@ bool FMeshImporter::ProcessAssetIntermediate()
     }
 
     // 获取中间文件路径
-    FString IntermediatePath = FAssetUtility::GetMeshIntermediatePath(Metadata->Uuid);
+    FIntermediatePath IntermediatePath = FAssetUtility::GetMeshIntermediatePath(Metadata->Uuid);
 
     // 构建中间数据结构（先不设置 Hash）
     FMeshIntermediate Intermediate;
@@ -340,35 +327,15 @@ bool FMeshImporter::ProcessAssetIntermediate()
                     static_cast<size_t>(MeshData.IndexCount) * sizeof(UInt32));
     }
 
-    // 先序列化以计算 Hash（此时 Hash 字段为 0），直接计算不存储
-    FHashOutputStream HashStream;
-    {
-        FBinaryOutputArchive HashAr(HashStream);
-        HashAr(Intermediate);
-    }
-
-    // 获取计算出的 Hash（不包括 Hash 字段本身，因为此时 Hash 为 0）
-    const UInt64 Hash = HashStream.GetHash();
-
-    // 设置 Hash 到 Intermediate
-    Intermediate.Hash = Hash;
-
-    // 创建文件流并序列化
-    auto Stream = FFileUtility::CreateFileStream(IntermediatePath, true, true);
-    if (!Stream)
+    // 序列化到文件的同时计算 Hash，并更新 Metadata 中的 Hash
+    if (!FAssetUtility::WriteIntermediate(Metadata, IntermediatePath, Intermediate))
     {
-        HK_LOG_ERROR(ELogcat::Asset, "Failed to create file stream for intermediate file: {}", IntermediatePath);
         return false;
     }
-
-    FBinaryOutputArchive Ar(*Stream);
-    Intermediate.Serialize(Ar);
-
-    // 更新 Metadata 中的 Hash
-    Metadata->IntermediateHash = Hash;
     FAssetRegistry::GetRef().SaveAssetMetadata(Metadata);
 
-    HK_LOG_INFO(ELogcat::Asset, "Saved intermediate mesh data to: {} (Hash: {})", IntermediatePath, Hash);
+    HK_LOG_INFO(ELogcat::Asset, "Saved intermediate mesh data to: {} (Hash: {})", IntermediatePath,
+                Intermediate.Hash);
     return true;
 }
 
@@ -383,27 +350,6 @@ void FMeshImporter::EndImport(bool Success)
         FAssetManager::GetRef().RegisterAsset(Metadata->Uuid, Metadata->Path, ImportData->Mesh);
     }
 
-    FGfxDevice&     GfxDevice     = GetGfxDeviceRef();
-    FRenderContext& RenderContext = FRenderContext::GetRef();
-    FRHICommandPool CommandPool   = RenderContext.GetUploadCommandPool();
-
-    // 清理资源
-    for (FRHICommandBuffer& CmdBuffer : ImportData->CommandBuffers)
-    {
-        if (CmdBuffer.IsValid())
-        {
-            GfxDevice.DestroyCommandBuffer(CommandPool, CmdBuffer);
-        }
-    }
-
-    for (FRHIBuffer& StagingBuffer : ImportData->StagingBuffers)
-    {
-        if (StagingBuffer.IsValid())
-        {
-            GfxDevice.DestroyBuffer(StagingBuffer);
-        }
-    }
-
     // 删除导入数据
     Delete(ImportData);
     ImportData = nullptr;
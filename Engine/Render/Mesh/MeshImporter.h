@@ -3,10 +3,10 @@
 #include "Math/Vector.h"
 #include "Mesh.h"
 #include "Object/AssetImporter.h"
+#include "Render/RenderUpload.h"
 
 #include "MeshImporter.generated.h"
 
-class FRHICommandBuffer;
 // 顶点数据结构（与 Common.slang 中的 Vertex_PNU 对应）
 HSTRUCT()
 struct FVertexPNU
@@ -108,11 +108,10 @@ private:
     // 导入过程中的临时数据
     struct FImportData
     {
-        TArray<FMeshData>         MeshDataArray;
-        TArray<FRHIBuffer>        StagingBuffers; // 所有 staging buffer
-        TArray<FRHICommandBuffer> CommandBuffers; // 所有 command buffer
-        HMesh*                    Mesh        = nullptr;
-        EMeshImportFlag           ImportFlags = EMeshImportFlag::None;
+        TArray<FMeshData> MeshDataArray;
+        FRenderUpload     Upload; // 析构时等待上传完成并释放 staging buffer 与 command buffer
+        HMesh*            Mesh        = nullptr;
+        EMeshImportFlag   ImportFlags = EMeshImportFlag::None;
     };
 
     FImportData* ImportData = nullptr;
@@ -4,7 +4,9 @@
 
 #include "MeshLoader.h"
 #include "Core/Logging/Logger.h"
+#include "Core/Memory/MemoryStats.h"
 #include "Core/Serialization/BinaryArchive.h"
+#include "Core/Serialization/MemoryStream.h"
 #include "Core/Utility/FileUtility.h"
 #include "Object/AssetImporter.h"
 #include "Object/AssetRegistry.h"
@@ -13,30 +15,51 @@
 #include "Render/Mesh/Mesh.h"
 #include "Render/Mesh/MeshImporter.h"
 #include "Render/Mesh/MeshUtility.h"
+#include "Render/RenderUpload.h"
 #include <fstream>
 
 namespace
 {
-// 从 Intermediate 文件加载 Mesh
-HMesh* LoadMeshFromIntermediate(const FAssetMetadata& Metadata)
+struct FMeshLoadPayload : FAssetLoadPayload
+{
+    FMeshIntermediate Intermediate;
+    FMemoryCharge     Charge; // 中间数据在 FinishLoad 消费前的内存
+    FRenderUpload     Upload; // FinishLoad 提交的上传, Payload 在上传完成后才释放
+
+    bool IsUploadComplete() const override
+    {
+        return Upload.IsComplete();
+    }
+};
+
+// 读取并反序列化 Intermediate 文件, OutCharge 按文件大小把中间数据记入 MeshAsset
+bool ReadMeshIntermediate(const FAssetMetadata& Metadata, FMeshIntermediate& OutIntermediate, FMemoryCharge& OutCharge)
 {
     // 获取中间文件路径
-    FString IntermediatePath = FAssetUtility::GetMeshIntermediatePath(Metadata.Uuid);
+    FIntermediatePath IntermediatePath = FAssetUtility::GetMeshIntermediatePath(Metadata.Uuid);
 
-    // 打开文件流
-    auto FileStream = FFileUtility::OpenFileStream(IntermediatePath, true);
-    if (!FileStream)
+    // 优先从 Pak 中读取
+    FAssetPakBuffer Buffer;
+    if (!FAssetUtility::ReadIntermediate(Metadata.Uuid, IntermediatePath, Buffer))
     {
         HK_LOG_ERROR(ELogcat::Asset, "Failed to open intermediate file: {}", IntermediatePath);
-        return nullptr;
+        return false;
     }
 
     // 反序列化 Intermediate 数据
-    FMeshIntermediate Intermediate;
-    {
-        FBinaryInputArchive Ar(*FileStream);
-        Ar(Intermediate);
-    }
+    FMemoryInputStream  Stream(Buffer.Data.Data(), Buffer.Data.Size());
+    FBinaryInputArchive Ar(Stream);
+    Ar(OutIntermediate);
+    OutCharge = FMemoryCharge(EMemoryTag::MeshAsset, static_cast<Int64>(Buffer.Data.Size()));
+    return true;
+}
+
+// 从 Intermediate 数据创建 Mesh 并提交上传, 上传的完成由 Upload 的持有者等待
+HMesh* CreateMeshFromIntermediate(const FAssetMetadata& Metadata, const FMeshIntermediate& Intermediate,
+                                  FRenderUpload& Upload)
+{
+    // 期间创建的 GPU 资源记入 MeshAsset
+    HK_MEMORY_SCOPE(EMemoryTag::MeshAsset);
 
     // 创建 HMesh 对象
     FObjectArray& ObjectArray = FObjectArray::GetRef();
@@ -48,11 +71,8 @@ HMesh* LoadMeshFromIntermediate(const FAssetMetadata& Metadata)
     }
 
     // 使用 MeshUtility 创建并上传 Mesh 到 GPU
-    TArray<FSubMesh>         SubMeshes;
-    TArray<FRHIBuffer>        StagingBuffers;
-    TArray<FRHICommandBuffer> CommandBuffers;
-
-    if (!FMeshUtility::CreateAndUploadMeshFromIntermediate(Intermediate, SubMeshes, StagingBuffers, CommandBuffers))
+    TArray<FSubMesh> SubMeshes;
+    if (!FMeshUtility::CreateAndUploadMeshFromIntermediate(Intermediate, SubMeshes, Upload))
     {
         HK_LOG_ERROR(ELogcat::Asset, "Failed to create and upload mesh from intermediate data");
         return nullptr;
@@ -66,6 +86,20 @@ HMesh* LoadMeshFromIntermediate(const FAssetMetadata& Metadata)
                 MeshSubMeshes.Size());
     return Mesh;
 }
+
+// 从 Intermediate 文件加载 Mesh
+HMesh* LoadMeshFromIntermediate(const FAssetMetadata& Metadata)
+{
+    FMeshIntermediate Intermediate;
+    FMemoryCharge     Charge;
+    if (!ReadMeshIntermediate(Metadata, Intermediate, Charge))
+    {
+        return nullptr;
+    }
+    // 同步加载在返回前等待上传完成
+    FRenderUpload Upload;
+    return CreateMeshFromIntermediate(Metadata, Intermediate, Upload);
+}
 } // namespace
 
 HObject* FMeshLoader::Load(const FAssetMetadata& Metadata, FType AssetType, bool ImportIfNotExist)
@@ -78,7 +112,7 @@ HObject* FMeshLoader::Load(const FAssetMetadata& Metadata, FType AssetType, bool
     }
 
     // 获取中间文件路径
-    FString IntermediatePath = FAssetUtility::GetMeshIntermediatePath(Metadata.Uuid);
+    FIntermediatePath IntermediatePath = FAssetUtility::GetMeshIntermediatePath(Metadata.Uuid);
 
     // 校验 Hash
     TSharedPtr<FAssetMetadata> MetaPtr = MakeShared<FAssetMetadata>(Metadata);
@@ -128,3 +162,29 @@ HObject* FMeshLoader::Load(const FAssetMetadata& Metadata, FType AssetType, bool
     return nullptr;
 }
 
+TSharedPtr<FAssetLoadPayload> FMeshLoader::LoadPayload(const FAssetMetadata& Metadata)
+{
+    const FIntermediatePath          IntermediatePath = FAssetUtility::GetMeshIntermediatePath(Metadata.Uuid);
+    const TSharedPtr<FAssetMetadata> MetaPtr          = MakeShared<FAssetMetadata>(Metadata);
+    if (!FAssetUtility::ValidateIntermediateHash(MetaPtr, IntermediatePath))
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<FMeshLoadPayload> Payload = MakeShared<FMeshLoadPayload>();
+    if (!ReadMeshIntermediate(Metadata, Payload->Intermediate, Payload->Charge))
+    {
+        return nullptr;
+    }
+    return Payload;
+}
+
+HObject* FMeshLoader::FinishLoad(const FAssetMetadata& Metadata, FAssetLoadPayload& Payload)
+{
+    auto&  MeshPayload = static_cast<FMeshLoadPayload&>(Payload);
+    HMesh* Mesh        = CreateMeshFromIntermediate(Metadata, MeshPayload.Intermediate, MeshPayload.Upload);
+    // 数据已经复制到 staging buffer, 不必等到上传完成
+    MeshPayload.Intermediate = FMeshIntermediate();
+    MeshPayload.Charge       = FMemoryCharge();
+    return Mesh;
+}
@@ -11,5 +11,8 @@ class HK_API FMeshLoader : public FAssetLoader
 {
 public:
     HObject* Load(const FAssetMetadata& Metadata, FType AssetType, bool ImportIfNotExist) override;
+
+    TSharedPtr<FAssetLoadPayload> LoadPayload(const FAssetMetadata& Metadata) override;
+    HObject*                      FinishLoad(const FAssetMetadata& Metadata, FAssetLoadPayload& Payload) override;
 };
 
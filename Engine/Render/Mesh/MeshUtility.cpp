@@ -9,13 +9,13 @@
 #include "Render/Mesh/Mesh.h"
 #include "Render/Mesh/MeshImporter.h"
 #include "Render/RenderContext.h"
+#include "Render/RenderUpload.h"
 #include <cstring>
+#include <mutex>
 #include <utility> // for std::move
 
-bool FMeshUtility::CreateAndUploadMeshFromIntermediate(const FMeshIntermediate&   Intermediate,
-                                                       TArray<FSubMesh>&          OutSubMeshes,
-                                                       TArray<FRHIBuffer>&        OutStagingBuffers,
-                                                       TArray<FRHICommandBuffer>& OutCommandBuffers)
+bool FMeshUtility::CreateAndUploadMeshFromIntermediate(const FMeshIntermediate& Intermediate,
+                                                       TArray<FSubMesh>& OutSubMeshes, FRenderUpload& Upload)
 {
     FGfxDevice&     GfxDevice     = GetGfxDeviceRef();
     FRenderContext& RenderContext = FRenderContext::GetRef();
@@ -51,12 +51,12 @@ bool FMeshUtility::CreateAndUploadMeshFromIntermediate(const FMeshIntermediate&
             bAllSuccess = false;
             break;
         }
+        Upload.AddStagingBuffer(StagingVertexBuffer);
 
         void* MappedVertexData = GfxDevice.MapBuffer(StagingVertexBuffer, 0, VertexBufferSize);
         if (!MappedVertexData)
         {
             HK_LOG_ERROR(ELogcat::Asset, "Failed to map staging vertex buffer for sub-mesh {}", I);
-            GfxDevice.DestroyBuffer(StagingVertexBuffer);
             bAllSuccess = false;
             break;
         }
@@ -74,7 +74,6 @@ bool FMeshUtility::CreateAndUploadMeshFromIntermediate(const FMeshIntermediate&
         if (!SubMesh.VertexBuffer.IsValid())
         {
             HK_LOG_ERROR(ELogcat::Asset, "Failed to create vertex buffer for sub-mesh {}", I);
-            GfxDevice.DestroyBuffer(StagingVertexBuffer);
             bAllSuccess = false;
             break;
         }
@@ -94,18 +93,16 @@ bool FMeshUtility::CreateAndUploadMeshFromIntermediate(const FMeshIntermediate&
         {
             HK_LOG_ERROR(ELogcat::Asset, "Failed to create staging index buffer for sub-mesh {}", I);
             GfxDevice.DestroyBuffer(SubMesh.VertexBuffer);
-            GfxDevice.DestroyBuffer(StagingVertexBuffer);
             bAllSuccess = false;
             break;
         }
+        Upload.AddStagingBuffer(StagingIndexBuffer);
 
         void* MappedIndexData = GfxDevice.MapBuffer(StagingIndexBuffer, 0, IndexBufferSize);
         if (!MappedIndexData)
         {
             HK_LOG_ERROR(ELogcat::Asset, "Failed to map staging index buffer for sub-mesh {}", I);
-            GfxDevice.DestroyBuffer(StagingIndexBuffer);
             GfxDevice.DestroyBuffer(SubMesh.VertexBuffer);
-            GfxDevice.DestroyBuffer(StagingVertexBuffer);
             bAllSuccess = false;
             break;
         }
@@ -123,13 +120,14 @@ bool FMeshUtility::CreateAndUploadMeshFromIntermediate(const FMeshIntermediate&
         if (!SubMesh.IndexBuffer.IsValid())
         {
             HK_LOG_ERROR(ELogcat::Asset, "Failed to create index buffer for sub-mesh {}", I);
-            GfxDevice.DestroyBuffer(StagingIndexBuffer);
             GfxDevice.DestroyBuffer(SubMesh.VertexBuffer);
-            GfxDevice.DestroyBuffer(StagingVertexBuffer);
             bAllSuccess = false;
             break;
         }
 
+        // 从分配命令缓冲区到提交期间独占 CommandPool
+        std::unique_lock PoolLock(RenderContext.GetUploadCommandPoolMutex());
+
         // 创建命令缓冲区
         FRHICommandBufferDesc CmdBufferDesc;
         CmdBufferDesc.Level      = ERHICommandBufferLevel::Primary;
@@ -141,9 +139,7 @@ bool FMeshUtility::CreateAndUploadMeshFromIntermediate(const FMeshIntermediate&
         {
             HK_LOG_ERROR(ELogcat::Asset, "Failed to create command buffer for sub-mesh {}", I);
             GfxDevice.DestroyBuffer(SubMesh.IndexBuffer);
-            GfxDevice.DestroyBuffer(StagingIndexBuffer);
             GfxDevice.DestroyBuffer(SubMesh.VertexBuffer);
-            GfxDevice.DestroyBuffer(StagingVertexBuffer);
             bAllSuccess = false;
             break;
         }
@@ -152,37 +148,37 @@ bool FMeshUtility::CreateAndUploadMeshFromIntermediate(const FMeshIntermediate&
         CommandBuffer.Begin(ERHICommandBufferUsageFlag::OneTimeSubmit);
 
         // 复制顶点数据
-        TArray<FRHIBufferCopyRegion> CopyRegions;
-        FRHIBufferCopyRegion         CopyRegion;
+        FRHIBufferCopyRegion CopyRegion;
         CopyRegion.SrcOffset = 0;
         CopyRegion.DstOffset = 0;
         CopyRegion.Size      = VertexBufferSize;
-        CopyRegions.Add(CopyRegion);
-        CommandBuffer.CopyBuffer(StagingVertexBuffer, SubMesh.VertexBuffer, CopyRegions);
+        CommandBuffer.CopyBuffer(StagingVertexBuffer, SubMesh.VertexBuffer, {&CopyRegion, 1});
 
         // 复制索引数据
-        CopyRegions.Clear();
         CopyRegion.Size = IndexBufferSize;
-        CopyRegions.Add(CopyRegion);
-        CommandBuffer.CopyBuffer(StagingIndexBuffer, SubMesh.IndexBuffer, CopyRegions);
+        CommandBuffer.CopyBuffer(StagingIndexBuffer, SubMesh.IndexBuffer, {&CopyRegion, 1});
 
         // 结束记录命令
         CommandBuffer.End();
 
+        // 不在这里等待栅栏，由 Upload 的持有者决定何时等待
+        const bool bSubmitted = Upload.Submit(std::move(CommandBuffer));
+        PoolLock.unlock();
+        if (!bSubmitted)
         {
-            FScopedRHIFence Fence;
-            CommandBuffer.Submit({}, {}, Fence.Fence);
+            GfxDevice.DestroyBuffer(SubMesh.IndexBuffer);
+            GfxDevice.DestroyBuffer(SubMesh.VertexBuffer);
+            bAllSuccess = false;
+            break;
         }
 
-        // 保存 staging buffer 和 command buffer 以便后续清理
-        OutStagingBuffers.Add(StagingVertexBuffer);
-        OutStagingBuffers.Add(StagingIndexBuffer);
-
-        // [Fix] FRHICommandBuffer 包含 UniquePtr，必须使用 Move 语义，不能拷贝
-        OutCommandBuffers.Add(std::move(CommandBuffer));
-
         SubMesh.VertexCount = static_cast<UInt32>(SubMeshIntermediate.Vertices.Size());
         SubMesh.IndexCount  = static_cast<UInt32>(SubMeshIntermediate.Indices.Size());
+        // 包围盒只在这里由顶点计算, 不写入中间格式
+        for (const FVertexPNU& Vertex : SubMeshIntermediate.Vertices)
+        {
+            SubMesh.Bounds.Expand(Vertex.Position);
+        }
 
         OutSubMeshes.Add(SubMesh);
 
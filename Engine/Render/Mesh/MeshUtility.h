@@ -1,11 +1,10 @@
 #pragma once
 
 #include "Core/Container/Array.h"
-#include "RHI/RHIBuffer.h"
-#include "RHI/RHICommandBuffer.h"
 
 struct FSubMesh;
 struct FMeshIntermediate;
+class FRenderUpload;
 
 /**
  * Mesh 工具类，提供 Mesh 上传到 GPU 的公共方法
@@ -14,16 +13,13 @@ class HK_API FMeshUtility
 {
 public:
     /**
-     * 从 Intermediate 数据创建并上传 Mesh 到 GPU
+     * 从 Intermediate 数据创建 Mesh 并提交上传到 GPU
      * @param Intermediate 中间数据
      * @param OutSubMeshes 输出的 SubMesh 数组
-     * @param OutStagingBuffers 输出的 staging buffer 数组（用于后续清理）
-     * @param OutCommandBuffers 输出的 command buffer 数组（用于后续清理）
+     * @param Upload 记录提交的上传，staging buffer 与 command buffer 在上传完成后由它释放
      * @return 如果创建成功返回 true，否则返回 false
      */
     static bool CreateAndUploadMeshFromIntermediate(const FMeshIntermediate& Intermediate,
-                                                     TArray<FSubMesh>& OutSubMeshes,
-                                                     TArray<FRHIBuffer>& OutStagingBuffers,
-                                                     TArray<FRHICommandBuffer>& OutCommandBuffers);
+                                                    TArray<FSubMesh>& OutSubMeshes, FRenderUpload& Upload);
 };
 
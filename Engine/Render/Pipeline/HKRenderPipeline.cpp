@@ -4,29 +4,95 @@
 
 #include "HKRenderPipeline.h"
 
+#include "Config/ConfigManager.h"
+#include "Core/Logging/Logger.h"
 #include "RHI/RHICommandBuffer.h"
-#include "Render/RenderTarget.h"
+#include "Render/GlobalRenderResources.h"
+#include "Render/Material/MaterialTable.h"
+#include "Render/RenderConfig.h"
+#include "Render/RenderGraph/RenderGraph.h"
+#include "Render/RenderProxy.h"
 
-void FHKRenderPipeline::Draw(FRHICommandBuffer& Commands, const FRenderPipelineDrawParams& Params)
+FHKRenderPipeline::FHKRenderPipeline(bool bInRequireImGui) : FRenderPipeline(bInRequireImGui)
 {
-    InitializeRenderTarget();
-    Commands.BeginRendering(RenderTarget[Params.FrameIndex]);
-    Commands.EndRendering();
+    const FRenderConfig* Config = FConfigManager::GetRef().GetConfig<FRenderConfig>();
+    if (!Config->IsGPUCullingEnabled())
+    {
+        return;
+    }
+
+    bGPUCulling = GPUCulling.Initialize();
+    if (!bGPUCulling)
+    {
+        HK_LOG_WARN(ELogcat::Render, "GPU culling is unavailable, falling back to direct draws");
+        return;
+    }
+    GPUCulling.SetValidationEnabled(Config->IsGPUCullingValidationEnabled());
 }
 
-void FHKRenderPipeline::InitializeRenderTarget()
+void FHKRenderPipeline::Draw(FRHICommandBuffer& Commands, const FRenderPipelineDrawParams& Params)
 {
-    FRenderTargetColorAttachment Color;
-    Color.ClearColor    = FVector4f(0.2f, 0.2f, 0.2f, 1.0f);
-    Color.RenderTexture = ColorBuffers[0].Get();
+    FRenderTexture*           ColorBuffer  = ColorBuffers[Params.FrameIndex].Get();
+    FRenderGraphResourcePool& ResourcePool = GraphResourcePools[Params.FrameIndex];
+    FDrawList&                DrawList     = DrawLists[Params.FrameIndex];
+    // 没有相机时无法提取视锥, 这一帧直接绘制
+    const bool                bCullOnGPU   = bGPUCulling && Params.bHasViewProjection;
+
+    // 没有快照时构建空列表, 避免录制上一次使用该帧时的旧绘制
+    TSpan<const FRenderProxy> Proxies;
+    if (Params.Snapshot != nullptr)
+    {
+        Proxies = TSpan<const FRenderProxy>(Params.Snapshot->Proxies.Data(), Params.Snapshot->Proxies.Size());
+    }
+    const FGlobalDynamicRenderResourcePool& DynamicResourcePool = FGlobalDynamicRenderResourcePool::GetRef();
+    const TArray<FMatrix4x4f>&              ModelMatrices       = DynamicResourcePool.GetRenderModelMatrices();
+    DrawList.Build(Proxies, TSpan<const FMatrix4x4f>(ModelMatrices.Data(), ModelMatrices.Size()), Params.ViewPosition);
+    // 两个缓冲已经在 FRenderContext::RenderFrame 中 SyncToGPU
+    DrawList.UploadInstances(DynamicResourcePool.GetModelMatrixBuffer(Params.FrameIndex),
+                             FGlobalMaterialTable::GetRef().GetMaterialBuffer(Params.FrameIndex));
+    if (bCullOnGPU)
+    {
+        DrawList.FillGPUCulling(GPUCulling);
+    }
+
+    FRenderGraph Graph(ResourcePool);
+
+    const FRenderGraphTextureHandle Color = Graph.ImportTexture(ColorBuffer);
+
+    FRenderGraphTextureDesc DepthDesc;
+    DepthDesc.Width                       = ColorBuffer->GetWidth();
+    DepthDesc.Height                      = ColorBuffer->GetHeight();
+    DepthDesc.Format                      = ERHIImageFormat::D32_SFloat;
+    DepthDesc.Usage                       = ERHIImageUsage::DepthStencilAttachment;
+    DepthDesc.DebugName                   = "SceneDepth";
+    const FRenderGraphTextureHandle Depth = Graph.CreateTexture(DepthDesc);
 
-    FRenderTargetDepthStencilAttachment Depth;
-    Depth.RenderTexture = DepthBuffers[0].Get();
+    // 剔除结果写入间接绘制参数缓冲, 不经过渲染图的纹理, 因此需要 NeverCull; 计算通道必须在渲染通道之外
+    if (bCullOnGPU)
+    {
+        Graph.AddPass("GPUCulling", ERenderGraphPassFlag::NeverCull)
+            .SetExecute([this, &Params](TRef<FRHICommandBuffer> PassCommands, const FRenderGraphPassContext&) {
+                GPUCulling.RecordCulling(*PassCommands, Params.FrameIndex, Params.ViewProjection);
+            });
+    }
 
-    RenderTarget[0] = FRenderTarget({Color}, Depth);
+    Graph.AddPass("BasePass")
+        .AddColorAttachment(Color, ERenderTargetLoadOp::Clear, FVector4f(0.2f, 0.2f, 0.2f, 1.0f))
+        .SetDepthStencilAttachment(Depth)
+        .SetExecute([this, &DrawList, &Params, bCullOnGPU](TRef<FRHICommandBuffer> PassCommands,
+                                                            const FRenderGraphPassContext&) {
+            if (bCullOnGPU)
+            {
+                DrawList.RecordCulled(*PassCommands, EDrawPass::Opaque, GPUCulling, Params.FrameIndex);
+            }
+            else
+            {
+                DrawList.Record(*PassCommands, EDrawPass::Opaque);
+            }
+        });
 
-    Color.RenderTexture = ColorBuffers[1].Get();
-    Depth.RenderTexture = DepthBuffers[1].Get();
+    Graph.Compile();
+    Graph.Execute(Commands);
 
-    RenderTarget[1] = FRenderTarget({Color}, Depth);
+    ResourcePool.EndFrame();
 }
@@ -1,23 +1,21 @@
 #pragma once
 
 #include "HKRenderPipeline.generated.h"
+#include "Render/Culling/GPUCulling.h"
 #include "RenderPipeline.h"
 
-#include "Render/RenderTarget.h"
-
 HCLASS()
 class FHKRenderPipeline : public FRenderPipeline
 {
     GENERATED_BODY(FHKRenderPipeline)
 
 public:
-    void Draw(FRHICommandBuffer& Commands, const FRenderPipelineDrawParams& Params) override;
+    FHKRenderPipeline(bool bInRequireImGui = false);
 
-protected:
-    void InitializeRenderTarget();
+    void Draw(FRHICommandBuffer& Commands, const FRenderPipelineDrawParams& Params) override;
 
 private:
-    bool bRenderTargetInitialized = false;
-
-    TFixedArray<FRenderTarget, HK_RENDER_INIT_FRAME_IN_FLIGHT> RenderTarget;
-};
\ No newline at end of file
+    // 来自FRenderConfig::bEnableGPUCulling, 初始化失败时回退为直接绘制
+    bool        bGPUCulling = false;
+    FGPUCulling GPUCulling;
+};
@@ -5,16 +5,32 @@
 #include "RenderPipeline.h"
 
 #include "RHI/RHIWindow.h"
+#include "Render/RenderContext.h"
 
 FRenderPipeline::FRenderPipeline(bool bInRequireImGui) : bRequireImGui(bInRequireImGui)
 {
     // TODO: 暂时获取主窗口
     auto MainWindow = FRHIWindowManager::GetRef().GetMainWindow();
     auto Size       = MainWindow->GetSize();
-    for (int i = 0; i < HK_RENDER_INIT_FRAME_IN_FLIGHT; i++)
+
+    const UInt32 FramesInFlight = FRenderContext::GetRef().GetFramesInFlight();
+    ColorBuffers.Resize(FramesInFlight);
+    GraphResourcePools.Resize(FramesInFlight);
+    DrawLists.Resize(FramesInFlight);
+    for (UInt32 i = 0; i < FramesInFlight; i++)
     {
         ColorBuffers[i] = MakeUnique<FRenderTexture>(Size.X, Size.Y);
-        DepthBuffers[i] =
-            MakeUnique<FRenderTexture>(1920, 1080, ERHIImageFormat::D32_SFloat, ERHIImageUsage::DepthStencilAttachment);
+    }
+}
+
+FRenderPipeline::~FRenderPipeline()
+{
+    // FRenderTexture 不会在析构时释放GPU资源
+    for (TUniquePtr<FRenderTexture>& ColorBuffer : ColorBuffers)
+    {
+        if (ColorBuffer)
+        {
+            ColorBuffer->Release();
+        }
     }
 }
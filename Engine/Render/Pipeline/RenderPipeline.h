@@ -1,15 +1,27 @@
 #pragma once
+#include "Core/Container/Array.h"
 #include "Core/Utility/UniquePtr.h"
 #include "Render/Texture/RenderTexture.h"
 
+#include "Render/RenderGraph/RenderGraphResources.h"
 #include "Render/RenderOptions.h"
+#include "Render/Renderer/DrawList.h"
 #include "RenderPipeline.generated.h"
 
 class FRHICommandBuffer;
+struct FRenderSceneSnapshot;
 
 struct FRenderPipelineDrawParams
 {
-    UInt32 FrameIndex;
+    UInt32 FrameIndex = 0;
+    // 这一帧的渲染快照, 为空时不绘制场景
+    const FRenderSceneSnapshot* Snapshot = nullptr;
+    // 相机的世界坐标, 用于绘制排序
+    FVector3f ViewPosition;
+    // 投影矩阵 * 视图矩阵, 开启GPU剔除时用于提取视锥平面
+    FMatrix4x4f ViewProjection;
+    // 没有设置相机时为false, 这一帧不做GPU剔除
+    bool bHasViewProjection = false;
 };
 
 HCLASS(Abstract)
@@ -17,7 +29,7 @@ class FRenderPipeline
 {
     GENERATED_BODY(FRenderPipeline)
 public:
-    virtual ~FRenderPipeline() = default;
+    virtual ~FRenderPipeline();
     FRenderPipeline(bool bInRequireImGui = false);
 
     virtual void Draw(FRHICommandBuffer& Commands, const FRenderPipelineDrawParams& Params) = 0;
@@ -26,6 +38,10 @@ protected:
     // 是否需要ImGui, 如果为true, 那么BackBuffer将是一张单独的RenderTexture, 而不是SwapChain
     bool bRequireImGui = false;
 
-    TFixedArray<TUniquePtr<FRenderTexture>, HK_RENDER_INIT_FRAME_IN_FLIGHT> ColorBuffers;
-    TFixedArray<TUniquePtr<FRenderTexture>, HK_RENDER_INIT_FRAME_IN_FLIGHT> DepthBuffers;
+    // 每个在途帧一份, 数量为FRenderContext::GetFramesInFlight()
+    TArray<TUniquePtr<FRenderTexture>> ColorBuffers;
+    // 渲染图的临时纹理池, 同样每个在途帧一份, 避免复用GPU仍在使用的纹理
+    TArray<FRenderGraphResourcePool> GraphResourcePools;
+    // 排序并合并后的绘制列表, 同样每个在途帧一份, 实例索引缓冲在GPU读取期间不会被覆盖
+    TArray<FDrawList> DrawLists;
 };
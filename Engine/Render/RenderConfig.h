@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Config/IConfig.h"
+#include "RenderOptions.h"
 
 #include "RenderConfig.generated.h"
 
@@ -24,12 +25,34 @@ public:
         return ShaderPaths;
     }
 
+    bool IsGPUCullingEnabled() const
+    {
+        return bEnableGPUCulling;
+    }
+
+    bool IsGPUCullingValidationEnabled() const
+    {
+        return bValidateGPUCulling;
+    }
+
 private:
     HPROPERTY()
     TArray<FString> ShaderPaths;
 
-    // 如果是MuliThreaded, 则开启多线程渲染
+    // 如果是MuliThreaded, 则开启多线程渲染: 渲染帧在Render线程执行, 比Game线程落后一帧
     HPROPERTY(DefaultProperty)
-    ERenderCommandCommitStyle CommitStyle = ERenderCommandCommitStyle::Immediate;
+    ERenderCommandCommitStyle CommitStyle = ERenderCommandCommitStyle::MultiThreaded;
+
+    // 同时在GPU上执行的帧数, 取值范围[1, HK_RENDER_MAX_FRAME_IN_FLIGHT]
+    HPROPERTY(DefaultProperty)
+    UInt32 FramesInFlight = HK_RENDER_INIT_FRAME_IN_FLIGHT;
+
+    // 由计算着色器做视锥剔除并用间接绘制提交场景, 关闭时直接绘制绘制列表中的全部实例
+    HPROPERTY()
+    bool bEnableGPUCulling = false;
+
+    // 每帧回读 GPU 剔除结果并与 CPU 参考实现比较, 只用于调试
+    HPROPERTY()
+    bool bValidateGPUCulling = false;
 };
 
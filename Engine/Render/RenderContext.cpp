@@ -1,14 +1,41 @@
 #include "RenderContext.h"
+#include "Config/ConfigManager.h"
 #include "Core/Logging/Logger.h"
+#include "Core/Utility/Profiler.h"
+#include "Loop/LoopData.h"
 #include "RHI/GfxDevice.h"
 #include "RHI/RHICommandBuffer.h"
 #include "RHI/RHICommandPool.h"
 #include "RHI/RHIWindow.h"
+#include "Object/AssetManager.h"
+#include "Render/GPUProfiler.h"
+#include "Render/GlobalRenderResources.h"
+#include "Render/Material/MaterialTable.h"
+#include "Render/Mesh/Mesh.h"
+#include "Render/Mesh/MeshLoader.h"
+#include "Render/Pipeline/HKRenderPipeline.h"
+#include "Render/RenderConfig.h"
+#include "Render/Shader/Shader.h"
+#include "Render/Shader/ShaderLoader.h"
+#include "Render/Texture/Texture.h"
+#include "Render/Texture/TextureLoader.h"
+#include "TaskGraph/TaskGraph.h"
+
+#include <algorithm>
 
 void FRenderContext::StartUp()
 {
     FGfxDevice& GfxDevice = GetGfxDeviceRef();
 
+    const FRenderConfig* Config = FConfigManager::GetRef().GetConfig<FRenderConfig>();
+    FramesInFlight              = std::clamp<UInt32>(Config->GetFramesInFlight(), 1, HK_RENDER_MAX_FRAME_IN_FLIGHT);
+    bMultiThreaded              = Config->GetCommitStyle() == ERenderCommandCommitStyle::MultiThreaded;
+    if (FramesInFlight != Config->GetFramesInFlight())
+    {
+        HK_LOG_WARN(ELogcat::Render, "FramesInFlight {} is out of range, clamped to {}", Config->GetFramesInFlight(),
+                    FramesInFlight);
+    }
+
     // 创建全局上传命令池（使用 Graphics 队列族，通常也支持 Transfer 操作）
     FRHICommandPoolDesc PoolDesc;
     PoolDesc.Flags            = ERHICommandPoolCreateFlag::ResetCommandBuffer;
@@ -30,7 +57,13 @@ void FRenderContext::StartUp()
     FRHIFenceDesc     FenceDesc;
     FenceDesc.Flags = ERHIFenceCreateFlag::Signaled;
 
-    for (UInt32 i = 0; i < HK_RENDER_INIT_FRAME_IN_FLIGHT; ++i)
+    InFlightFences.Resize(FramesInFlight);
+    ImageAvailableSemaphores.Resize(FramesInFlight);
+    RenderFinishedSemaphores.Resize(FramesInFlight);
+    FrameCommandPools.Resize(FramesInFlight);
+    FrameCommandBuffers.Resize(FramesInFlight);
+
+    for (UInt32 i = 0; i < FramesInFlight; ++i)
     {
         // 创建信号量
         SemaphoreDesc.DebugName     = std::format("ImageAvailableSemaphore_{}", i);
@@ -60,18 +93,36 @@ void FRenderContext::StartUp()
         }
     }
 
-    HK_LOG_INFO(ELogcat::Render, "Frame synchronization resources created");
+    HK_LOG_INFO(ELogcat::Render, "Frame synchronization resources created, frames in flight: {}, multithreaded: {}",
+                FramesInFlight, bMultiThreaded);
+
+    // 每个在途帧一组查询池, 查询结果在该帧的栅栏完成后读回
+    FGPUProfiler::GetRef().Initialize(FramesInFlight, UploadCommandPool);
+
+    // 注册渲染资产的 Loader，供 FAssetManager 同步与异步加载使用
+    FAssetManager& AssetManager = FAssetManager::GetRef();
+    AssetManager.SetAssetLoader(EAssetType::Mesh, TypeOf<HMesh>(), MakeUnique<FMeshLoader>());
+    AssetManager.SetAssetLoader(EAssetType::Texture, TypeOf<HTexture>(), MakeUnique<FTextureLoader>());
+    AssetManager.SetAssetLoader(EAssetType::Shader, TypeOf<HShader>(), MakeUnique<FShaderLoader>());
+
+    // 管线的每帧资源按 FramesInFlight 创建, 必须在帧同步资源之后
+    RenderPipeline = MakeUnique<FHKRenderPipeline>();
 }
 
 void FRenderContext::ShutDown()
 {
+    FlushRendering();
+
     FGfxDevice& GfxDevice = GetGfxDeviceRef();
 
     // 等待设备空闲
     GfxDevice.WaitIdle();
 
+    FGPUProfiler::Destroy();
+    RenderPipeline.Reset();
+
     // 销毁帧同步资源
-    for (UInt32 i = 0; i < HK_RENDER_INIT_FRAME_IN_FLIGHT; ++i)
+    for (UInt32 i = 0; i < FramesInFlight; ++i)
     {
         if (ImageAvailableSemaphores[i].IsValid())
         {
@@ -102,9 +153,58 @@ void FRenderContext::ShutDown()
     }
 }
 
-void FRenderContext::RenderFrame()
+void FRenderContext::SubmitFrame()
 {
-    FGfxDevice& GfxDevice = GetGfxDeviceRef();
+    HK_PROFILE_SCOPE_N("FRenderContext::SubmitFrame");
+
+    // 写入的缓冲与上一帧渲染任务读取的缓冲不同, 不需要等待
+    FRenderPipelineDrawParams Params;
+    Params.Snapshot =
+        &ProxyBuffer.Capture(GetEngineLoopData().FrameNumber, bHasCullingFrustum ? &CullingFrustum : nullptr);
+    Params.ViewPosition       = ViewPosition;
+    Params.ViewProjection     = ViewProjection;
+    Params.bHasViewProjection = bHasCullingFrustum;
+    if (!bMultiThreaded)
+    {
+        RenderFrame(Params);
+        return;
+    }
+
+    // 保证Render线程最多落后一帧, 下一次Capture会覆盖上一帧的快照
+    FlushRendering();
+
+    // 相机参数按值复制, Game线程可以在渲染期间修改下一帧的相机
+    InFlightRenderTask = FTaskGraph::GetRef().Create(FString("RenderFrame"), EExecutorLabel::Render,
+                                                     [this, Params]() { RenderFrame(Params); });
+    FTaskGraph::GetRef().Launch(InFlightRenderTask);
+}
+
+void FRenderContext::FlushRendering()
+{
+    if (!InFlightRenderTask)
+    {
+        return;
+    }
+    HK_PROFILE_SCOPE_N("FRenderContext::FlushRendering");
+    InFlightRenderTask->Wait();
+    InFlightRenderTask.Reset();
+}
+
+void FRenderContext::RenderFrame(FRenderPipelineDrawParams Params)
+{
+    HK_PROFILE_SCOPE_N("FRenderContext::RenderFrame");
+
+    FGfxDevice&                 GfxDevice = GetGfxDeviceRef();
+    const FRenderSceneSnapshot& Snapshot  = *Params.Snapshot;
+
+    // 快照中的模型矩阵与材质参数变化必须在任何提前返回之前应用, 否则会丢失
+    auto& DynamicResourcePool = FGlobalDynamicRenderResourcePool::GetRef();
+    DynamicResourcePool.ApplyModelMatrixUpdate(Snapshot.ModelMatrixUpdate);
+    auto& MaterialTable = FGlobalMaterialTable::GetRef();
+    MaterialTable.ApplyUpdate(Snapshot.MaterialTableUpdate);
+
+    // 异步加载提交的上传每帧检查一次, 同样不受窗口状态影响
+    FAssetManager::GetRef().PollPendingUploads();
 
     // 获取主窗口
     FRHIWindow* MainWindow = FRHIWindowManager::GetRef().GetMainWindow();
@@ -136,6 +236,13 @@ void FRenderContext::RenderFrame()
         return;
     }
 
+    // 该帧的栅栏已经完成, 只写入这一帧缓冲过期的模型矩阵
+    DynamicResourcePool.SyncToGPU(FrameIndex);
+    // 同理, 只写入这一帧缓冲过期的材质槽位
+    MaterialTable.SyncToGPU(FrameIndex);
+    // 这一帧录制前把排队的 bindless 描述符一次写入
+    FGlobalStaticRenderResourcePool::GetRef().FlushDescriptorWrites();
+
     // 3. 重置栅栏（在提交命令之前）
     if (!GfxDevice.ResetFence(InFlightFence))
     {
@@ -147,23 +254,23 @@ void FRenderContext::RenderFrame()
     CmdBuffer.Reset(false);
     CmdBuffer.Begin(ERHICommandBufferUsageFlag::OneTimeSubmit);
 
-    // ========================================================================
-    // TODO: 这里留给用户实现实际的渲染命令
-    // 用户可以在这里调用 BeginRendering、绘制命令、EndRendering 等
-    // 例如:
-    //   FRenderTarget RenderTarget = ...;
-    //   Cmd.BeginRendering(RenderTarget);
-    //   Cmd.SetViewport(...);
-    //   Cmd.SetScissor(...);
-    //   Cmd.BindPipeline(...);
-    //   Cmd.Draw(...);
-    //   Cmd.EndRendering();
-    // ========================================================================
-
-    // 5. 结束命令缓冲区记录
+    // 栅栏已经完成, 可以非阻塞地读回该槽位上一次记录的GPU查询
+    FGPUProfiler& GPUProfiler = FGPUProfiler::GetRef();
+    GPUProfiler.BeginFrame(CmdBuffer, FrameIndex);
+
+    // 5. 通过渲染管线录制场景: 构建并排序绘制列表、GPU剔除与基础通道
+    Params.FrameIndex = FrameIndex;
+    {
+        HK_PROFILE_GPU_SCOPE(CmdBuffer, "RenderPipeline");
+        RenderPipeline->Draw(CmdBuffer, Params);
+    }
+
+    GPUProfiler.EndFrame(CmdBuffer);
+
+    // 6. 结束命令缓冲区记录
     CmdBuffer.End();
 
-    // 6. 提交命令缓冲区
+    // 7. 提交命令缓冲区
     // 等待 ImageAvailableSemaphore（图像可用后才能渲染）
     // 渲染完成后发出 RenderFinishedSemaphore 信号
     // 完成后发出 InFlightFence 信号
@@ -173,7 +280,7 @@ void FRenderContext::RenderFrame()
         return;
     }
 
-    // 7. 呈现图像
+    // 8. 呈现图像
     // 等待 RenderFinishedSemaphore（渲染完成后才能呈现）
     if (!GfxDevice.PresentImage(*MainWindow, ImageIndex, RenderFinishedSemaphore))
     {
@@ -181,6 +288,6 @@ void FRenderContext::RenderFrame()
         return;
     }
 
-    // 8. 更新帧索引
-    CurrentFrameIndex = (CurrentFrameIndex + 1) % HK_RENDER_INIT_FRAME_IN_FLIGHT;
+    // 9. 更新帧索引
+    CurrentFrameIndex = (CurrentFrameIndex + 1) % FramesInFlight;
 }
@@ -1,9 +1,19 @@
 #pragma once
+#include "Core/Container/Array.h"
 #include "Core/Singleton/Singleton.h"
+#include "Core/Utility/Profiler.h"
+#include "Core/Utility/SharedPtr.h"
 #include "RHI/RHICommandBuffer.h"
 #include "RHI/RHICommandPool.h"
 #include "RHI/RHISync.h"
+#include "Render/Culling/Frustum.h"
+#include "Render/Pipeline/RenderPipeline.h"
 #include "RenderOptions.h"
+#include "RenderProxy.h"
+
+#include <mutex>
+
+class FTask;
 
 class FRenderContext : public TSingleton<FRenderContext>
 {
@@ -19,25 +29,98 @@ public:
         return UploadCommandPool;
     }
 
+    /**
+     * 上传命令池只能被一个线程同时使用, 分配、录制、提交与销毁其中的命令缓冲区时都需要持有该锁
+     */
+    [[nodiscard]] HK_PROFILE_LOCKABLE_BASE(std::mutex)& GetUploadCommandPoolMutex()
+    {
+        return UploadCommandPoolMutex;
+    }
+
     static inline void Render()
     {
-        GetRef().RenderFrame();
+        GetRef().SubmitFrame();
+    }
+
+    /**
+     * 在Game线程调用, 生成这一帧的渲染快照并派发渲染
+     * 多线程渲染时渲染帧在Render线程执行, 比Game线程落后一帧: 快照与上一帧的渲染并行生成,
+     * 派发前只等待上一帧的渲染任务结束
+     */
+    void SubmitFrame();
+
+    /**
+     * 设置视锥剔除使用的视图投影矩阵, 在Game线程调用, 之后的SubmitFrame只收集视锥内的渲染器,
+     * 开启GPU剔除时渲染管线也用它剔除实例
+     * @param InViewProjection 相机的视图投影矩阵
+     */
+    void SetCullingViewProjection(const FMatrix4x4f& InViewProjection)
+    {
+        ViewProjection     = InViewProjection;
+        CullingFrustum     = FFrustum::FromViewProjection(InViewProjection);
+        bHasCullingFrustum = true;
+    }
+
+    /**
+     * 设置相机的世界坐标, 在Game线程调用, 之后的SubmitFrame用它按深度排序绘制
+     */
+    void SetViewPosition(const FVector3f& InViewPosition)
+    {
+        ViewPosition = InViewPosition;
     }
 
     /**
-     * 渲染并呈现一帧
+     * 关闭视锥剔除, 之后的SubmitFrame收集所有可见渲染器
      */
-    void RenderFrame();
+    void ClearCullingViewProjection()
+    {
+        bHasCullingFrustum = false;
+    }
+
+    /**
+     * 等待已派发的渲染帧执行完毕, 停止Executor之前必须调用
+     */
+    void FlushRendering();
+
+    /**
+     * 同时在GPU上执行的帧数, 来自FRenderConfig::FramesInFlight
+     */
+    [[nodiscard]] UInt32 GetFramesInFlight() const
+    {
+        return FramesInFlight;
+    }
 
 private:
+    /**
+     * 渲染并呈现一帧, 多线程渲染时在Render线程执行
+     * @param Params 这一帧的渲染快照与相机, FrameIndex 在这里填写
+     */
+    void RenderFrame(FRenderPipelineDrawParams Params);
+
     FRHICommandPool UploadCommandPool;
+    HK_PROFILE_LOCKABLE(std::mutex, UploadCommandPoolMutex);
 
-    // 帧同步资源
-    TFixedArray<FRHIFence, HK_RENDER_INIT_FRAME_IN_FLIGHT>         InFlightFences;
-    TFixedArray<FRHISemaphore, HK_RENDER_INIT_FRAME_IN_FLIGHT>     ImageAvailableSemaphores;
-    TFixedArray<FRHISemaphore, HK_RENDER_INIT_FRAME_IN_FLIGHT>     RenderFinishedSemaphores;
-    TFixedArray<FRHICommandPool, HK_RENDER_INIT_FRAME_IN_FLIGHT>   FrameCommandPools;
-    TFixedArray<FRHICommandBuffer, HK_RENDER_INIT_FRAME_IN_FLIGHT> FrameCommandBuffers;
+    // 帧同步资源, 数量为FramesInFlight
+    TArray<FRHIFence>         InFlightFences;
+    TArray<FRHISemaphore>     ImageAvailableSemaphores;
+    TArray<FRHISemaphore>     RenderFinishedSemaphores;
+    TArray<FRHICommandPool>   FrameCommandPools;
+    TArray<FRHICommandBuffer> FrameCommandBuffers;
 
+    UInt32 FramesInFlight    = HK_RENDER_INIT_FRAME_IN_FLIGHT;
     UInt32 CurrentFrameIndex = 0;
+
+    // 是否在Render线程执行渲染帧
+    bool bMultiThreaded = false;
+    // Game线程写入, Render线程读取的双缓冲快照
+    FRenderProxyBuffer ProxyBuffer;
+    // Game线程的相机参数, 派发渲染帧时按值复制
+    FFrustum    CullingFrustum;
+    FMatrix4x4f ViewProjection;
+    FVector3f   ViewPosition;
+    bool        bHasCullingFrustum = false;
+    // 录制每一帧的场景绘制
+    TUniquePtr<FRenderPipeline> RenderPipeline;
+    // 正在Render线程执行的渲染帧
+    TSharedPtr<FTask> InFlightRenderTask;
 };
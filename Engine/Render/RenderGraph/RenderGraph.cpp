@@ -0,0 +1,416 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "RenderGraph.h"
+
+#include "Core/Logging/Logger.h"
+#include "Core/Utility/Profiler.h"
+#include "Render/Texture/RenderTexture.h"
+#include "TaskGraph/TaskGraph.h"
+
+FRenderTexture* FRenderGraphPassContext::GetTexture(FRenderGraphTextureHandle Handle) const
+{
+    if (!Handle.IsValid() || Handle.Index >= static_cast<Int32>(Graph.Textures.Size()))
+    {
+        return nullptr;
+    }
+    return Graph.GetEntry(Handle).Texture;
+}
+
+FRenderGraphPass& FRenderGraphPass::Read(FRenderGraphTextureHandle Handle, ERenderGraphAccess Access)
+{
+    Reads.Add({Handle, Access});
+    return *this;
+}
+
+FRenderGraphPass& FRenderGraphPass::Write(FRenderGraphTextureHandle Handle, ERenderGraphAccess Access)
+{
+    Writes.Add({Handle, Access});
+    return *this;
+}
+
+FRenderGraphPass& FRenderGraphPass::AddColorAttachment(FRenderGraphTextureHandle Handle, ERenderTargetLoadOp LoadOp,
+                                                       const FVector4f& ClearColor)
+{
+    ColorAttachments.Add({Handle, LoadOp, ClearColor});
+    return Write(Handle, ERenderGraphAccess::ColorAttachment);
+}
+
+FRenderGraphPass& FRenderGraphPass::SetDepthStencilAttachment(FRenderGraphTextureHandle Handle,
+                                                              ERenderTargetLoadOp LoadOp, float ClearDepth)
+{
+    DepthAttachment = {Handle, LoadOp, ClearDepth};
+    return Write(Handle, ERenderGraphAccess::DepthStencilAttachment);
+}
+
+bool FRenderGraphPass::Uses(FRenderGraphTextureHandle Handle) const
+{
+    for (const auto& Access : Reads)
+    {
+        if (Access.Handle == Handle)
+        {
+            return true;
+        }
+    }
+    for (const auto& Access : Writes)
+    {
+        if (Access.Handle == Handle)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+FRenderGraph::~FRenderGraph() = default;
+
+FRenderGraphTextureHandle FRenderGraph::CreateTexture(const FRenderGraphTextureDesc& Desc)
+{
+    FTextureEntry Entry;
+    Entry.Desc = Desc;
+    Textures.Add(Entry);
+    bCompiled = false;
+    return {static_cast<Int32>(Textures.Size()) - 1};
+}
+
+FRenderGraphTextureHandle FRenderGraph::ImportTexture(FRenderTexture* Texture, ERenderGraphAccess FinalAccess,
+                                                      ERHIImageLayout InitialLayout)
+{
+    if (Texture == nullptr)
+    {
+        HK_LOG_ERROR(ELogcat::Render, "Trying to import null texture into render graph");
+        return {};
+    }
+
+    FTextureEntry Entry;
+    Entry.Desc.Width     = Texture->GetWidth();
+    Entry.Desc.Height    = Texture->GetHeight();
+    Entry.Desc.Format    = Texture->GetFormat();
+    Entry.Desc.Usage     = Texture->GetUsage();
+    Entry.Desc.DebugName = Texture->GetDebugName();
+    Entry.Texture        = Texture;
+    Entry.State          = &ResourcePool.GetExternalState(Texture, InitialLayout);
+    Entry.bExternal      = true;
+    Entry.FinalAccess    = FinalAccess;
+    Textures.Add(Entry);
+    bCompiled = false;
+    return {static_cast<Int32>(Textures.Size()) - 1};
+}
+
+FRenderGraphPass& FRenderGraph::AddPass(FStringView Name, ERenderGraphPassFlag Flags)
+{
+    auto Pass   = MakeUnique<FRenderGraphPass>();
+    Pass->Name  = FString(Name);
+    Pass->Flags = Flags;
+    Passes.Add(std::move(Pass));
+    bCompiled = false;
+    return *Passes[Passes.Size() - 1];
+}
+
+void FRenderGraph::Compile()
+{
+    HK_PROFILE_SCOPE_N("FRenderGraph::Compile");
+
+    // 1. 从后往前剔除：外部纹理视为最终输出，Pass 只有在写入了被需要的纹理时才保留
+    TArray<bool> Needed;
+    Needed.Resize(Textures.Size(), false);
+    for (size_t i = 0; i < Textures.Size(); ++i)
+    {
+        Needed[i] = Textures[i].bExternal;
+    }
+
+    CulledPassCount = 0;
+    for (Int64 PassIndex = static_cast<Int64>(Passes.Size()) - 1; PassIndex >= 0; --PassIndex)
+    {
+        FRenderGraphPass& Pass = *Passes[PassIndex];
+        bool bAlive            = HasFlag(Pass.Flags, ERenderGraphPassFlag::NeverCull);
+        for (const auto& Access : Pass.Writes)
+        {
+            bAlive = bAlive || (Access.Handle.IsValid() && Needed[Access.Handle.Index]);
+        }
+
+        Pass.bCulled = !bAlive;
+        if (!bAlive)
+        {
+            ++CulledPassCount;
+            continue;
+        }
+
+        for (const auto& Access : Pass.Reads)
+        {
+            if (Access.Handle.IsValid())
+            {
+                Needed[Access.Handle.Index] = true;
+            }
+        }
+        // Load 的附件依赖之前 Pass 写入的内容
+        for (const auto& Attachment : Pass.ColorAttachments)
+        {
+            if (Attachment.LoadOp == ERenderTargetLoadOp::Load && Attachment.Handle.IsValid())
+            {
+                Needed[Attachment.Handle.Index] = true;
+            }
+        }
+        if (Pass.DepthAttachment.Handle.IsValid() && Pass.DepthAttachment.LoadOp == ERenderTargetLoadOp::Load)
+        {
+            Needed[Pass.DepthAttachment.Handle.Index] = true;
+        }
+    }
+
+    // 2. 计算临时纹理在存活 Pass 中的生命周期
+    for (auto& Entry : Textures)
+    {
+        Entry.FirstPass = -1;
+        Entry.LastPass  = -1;
+    }
+    for (size_t PassIndex = 0; PassIndex < Passes.Size(); ++PassIndex)
+    {
+        FRenderGraphPass& Pass = *Passes[PassIndex];
+        Pass.AcquireTextures.Clear();
+        Pass.ReleaseTextures.Clear();
+        if (Pass.bCulled)
+        {
+            continue;
+        }
+        for (size_t TextureIndex = 0; TextureIndex < Textures.Size(); ++TextureIndex)
+        {
+            if (!Pass.Uses({static_cast<Int32>(TextureIndex)}))
+            {
+                continue;
+            }
+            FTextureEntry& Entry = Textures[TextureIndex];
+            if (Entry.FirstPass < 0)
+            {
+                Entry.FirstPass = static_cast<Int32>(PassIndex);
+            }
+            Entry.LastPass = static_cast<Int32>(PassIndex);
+        }
+    }
+
+    // 3. 生命周期的起止点决定物理纹理的分配与归还位置，归还后的纹理可被后续 Pass 的临时纹理复用
+    for (size_t TextureIndex = 0; TextureIndex < Textures.Size(); ++TextureIndex)
+    {
+        const FTextureEntry& Entry = Textures[TextureIndex];
+        if (Entry.bExternal || Entry.FirstPass < 0)
+        {
+            continue;
+        }
+        Passes[Entry.FirstPass]->AcquireTextures.Add({static_cast<Int32>(TextureIndex)});
+        Passes[Entry.LastPass]->ReleaseTextures.Add({static_cast<Int32>(TextureIndex)});
+    }
+
+    bCompiled = true;
+}
+
+void FRenderGraph::TransitionTexture(FTextureEntry& Entry, ERenderGraphAccess Access,
+                                     TArray<FRHIImageMemoryBarrier>& OutBarriers, ERHIPipelineStageFlag& OutSrcStage,
+                                     ERHIPipelineStageFlag& OutDstStage)
+{
+    if (Entry.Texture == nullptr || Entry.State == nullptr || Access == ERenderGraphAccess::None)
+    {
+        return;
+    }
+
+    const FRenderGraphTextureState Target  = FRenderGraphTextureState::FromAccess(Access);
+    FRenderGraphTextureState&      Current = *Entry.State;
+
+    // 布局不变的连续读取不需要屏障，合并访问掩码使之后的写入等待所有读取
+    if (Current.Layout == Target.Layout && !Current.bWrite && !Target.bWrite)
+    {
+        Current.Access |= Target.Access;
+        Current.Stage |= Target.Stage;
+        return;
+    }
+
+    if (Entry.Texture->GetRHIImage().IsValid())
+    {
+        FRHIImageMemoryBarrier Barrier;
+        // 读后写只需要执行依赖，不需要让读取的结果可见
+        Barrier.SrcAccessMask               = Current.bWrite ? Current.Access : ERHIAccessFlag::None;
+        Barrier.DstAccessMask               = Target.Access;
+        Barrier.OldLayout                   = Current.Layout;
+        Barrier.NewLayout                   = Target.Layout;
+        Barrier.Image                       = Entry.Texture->GetRHIImage();
+        Barrier.SubresourceRange.AspectMask = Entry.Texture->GetImageAspect();
+        OutBarriers.Add(Barrier);
+
+        OutSrcStage |= Current.Stage == ERHIPipelineStageFlag::None ? ERHIPipelineStageFlag::TopOfPipe : Current.Stage;
+        OutDstStage |= Target.Stage;
+    }
+
+    Current = Target;
+}
+
+void FRenderGraph::BuildBarriers(FRenderGraphPass& Pass)
+{
+    Pass.Barriers.Clear();
+    Pass.BarrierSrcStage = ERHIPipelineStageFlag::None;
+    Pass.BarrierDstStage = ERHIPipelineStageFlag::None;
+
+    // 临时纹理的内容在生命周期开始时没有意义，复用的物理纹理从 Undefined 转换即可
+    for (const auto& Handle : Pass.AcquireTextures)
+    {
+        FTextureEntry& Entry = GetEntry(Handle);
+        if (Entry.State != nullptr)
+        {
+            Entry.State->Layout = ERHIImageLayout::Undefined;
+        }
+    }
+
+    for (const auto& Access : Pass.Writes)
+    {
+        if (Access.Handle.IsValid())
+        {
+            TransitionTexture(GetEntry(Access.Handle), Access.Access, Pass.Barriers, Pass.BarrierSrcStage,
+                              Pass.BarrierDstStage);
+        }
+    }
+    for (const auto& Access : Pass.Reads)
+    {
+        // 同一个 Pass 同时读写的纹理以写入的状态为准
+        bool bAlsoWritten = false;
+        for (const auto& WriteAccess : Pass.Writes)
+        {
+            bAlsoWritten = bAlsoWritten || WriteAccess.Handle == Access.Handle;
+        }
+        if (Access.Handle.IsValid() && !bAlsoWritten)
+        {
+            TransitionTexture(GetEntry(Access.Handle), Access.Access, Pass.Barriers, Pass.BarrierSrcStage,
+                              Pass.BarrierDstStage);
+        }
+    }
+}
+
+void FRenderGraph::RecordPass(FRenderGraphPass& Pass, FRHICommandBuffer& Commands) const
+{
+    HK_PROFILE_SCOPE_N("FRenderGraph::RecordPass");
+
+    const bool bRasterPass = !Pass.ColorAttachments.IsEmpty() || Pass.DepthAttachment.Handle.IsValid();
+    if (bRasterPass)
+    {
+        TArray<FRenderTargetColorAttachment> Colors;
+        for (const auto& Attachment : Pass.ColorAttachments)
+        {
+            FRenderTargetColorAttachment Color;
+            Color.RenderTexture = GetEntry(Attachment.Handle).Texture;
+            Color.LoadOp        = Attachment.LoadOp;
+            Color.ClearColor    = Attachment.ClearColor;
+            Colors.Add(Color);
+        }
+
+        if (Pass.DepthAttachment.Handle.IsValid())
+        {
+            FRenderTargetDepthStencilAttachment Depth;
+            Depth.RenderTexture = GetEntry(Pass.DepthAttachment.Handle).Texture;
+            Depth.DepthLoadOp   = Pass.DepthAttachment.LoadOp;
+            Depth.ClearDepth    = Pass.DepthAttachment.ClearDepth;
+            Commands.BeginRendering(FRenderTarget(Colors, Depth, Pass.Name));
+        }
+        else
+        {
+            Commands.BeginRendering(FRenderTarget(Colors, Pass.Name));
+        }
+    }
+
+    const FRenderGraphPassContext Context(*this);
+    Pass.Execute.Invoke(TRef<FRHICommandBuffer>(Commands), Context);
+
+    if (bRasterPass)
+    {
+        Commands.EndRendering();
+    }
+}
+
+void FRenderGraph::Execute(FRHICommandBuffer& Commands)
+{
+    HK_PROFILE_SCOPE_N("FRenderGraph::Execute");
+
+    if (!bCompiled)
+    {
+        Compile();
+    }
+
+    // 1. 按 Pass 顺序分配与归还物理纹理，生命周期不重叠的临时纹理会拿到同一张纹理
+    for (auto& Pass : Passes)
+    {
+        if (Pass->bCulled)
+        {
+            continue;
+        }
+        for (const auto& Handle : Pass->AcquireTextures)
+        {
+            FTextureEntry& Entry = GetEntry(Handle);
+            Entry.Texture        = ResourcePool.AcquireTexture(Entry.Desc, Entry.State);
+        }
+        for (const auto& Handle : Pass->ReleaseTextures)
+        {
+            ResourcePool.ReleaseTexture(GetEntry(Handle).Texture);
+        }
+    }
+
+    // 2. 录制每个 Pass 到独立的延迟命令列表，允许并行的 Pass 在 Worker 线程上录制
+    TArray<TUniquePtr<FRHICommandBuffer>> PassCommands;
+    TArray<TSharedPtr<FTask>>             RecordTasks;
+    PassCommands.Resize(Passes.Size());
+    for (size_t PassIndex = 0; PassIndex < Passes.Size(); ++PassIndex)
+    {
+        FRenderGraphPass* Pass = Passes[PassIndex].Get();
+        if (Pass->bCulled)
+        {
+            continue;
+        }
+
+        PassCommands[PassIndex]         = MakeUnique<FRHICommandBuffer>();
+        FRHICommandBuffer* PassCommand = PassCommands[PassIndex].Get();
+        if (HasFlag(Pass->Flags, ERenderGraphPassFlag::ParallelRecord))
+        {
+            auto Task = FTaskGraph::GetRef().Create(Pass->Name, EExecutorLabel::Worker,
+                                                    [this, Pass, PassCommand]() { RecordPass(*Pass, *PassCommand); });
+            FTaskGraph::GetRef().Launch(Task);
+            RecordTasks.Add(Task);
+        }
+        else
+        {
+            RecordPass(*Pass, *PassCommand);
+        }
+    }
+    for (auto& Task : RecordTasks)
+    {
+        Task->Wait();
+    }
+
+    // 3. 按顺序合并：每个 Pass 前插入一次合并后的屏障
+    for (size_t PassIndex = 0; PassIndex < Passes.Size(); ++PassIndex)
+    {
+        FRenderGraphPass& Pass = *Passes[PassIndex];
+        if (Pass.bCulled)
+        {
+            continue;
+        }
+
+        BuildBarriers(Pass);
+        if (!Pass.Barriers.IsEmpty())
+        {
+            Commands.PipelineBarrier(Pass.BarrierSrcStage, Pass.BarrierDstStage, ERHIDependencyFlag::None, {}, {},
+                                     Pass.Barriers);
+        }
+        Commands.AppendCommands(*PassCommands[PassIndex]);
+    }
+
+    // 4. 外部纹理转换到要求的最终状态
+    TArray<FRHIImageMemoryBarrier> FinalBarriers;
+    ERHIPipelineStageFlag          FinalSrcStage = ERHIPipelineStageFlag::None;
+    ERHIPipelineStageFlag          FinalDstStage = ERHIPipelineStageFlag::None;
+    for (auto& Entry : Textures)
+    {
+        if (Entry.bExternal && Entry.FinalAccess != ERenderGraphAccess::None)
+        {
+            TransitionTexture(Entry, Entry.FinalAccess, FinalBarriers, FinalSrcStage, FinalDstStage);
+        }
+    }
+    if (!FinalBarriers.IsEmpty())
+    {
+        Commands.PipelineBarrier(FinalSrcStage, FinalDstStage, ERHIDependencyFlag::None, {}, {}, FinalBarriers);
+    }
+}
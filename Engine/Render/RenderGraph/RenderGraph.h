@@ -0,0 +1,228 @@
+#pragma once
+#include "Core/Container/Array.h"
+#include "Core/Event/Delegate.h"
+#include "Core/String/String.h"
+#include "Core/Utility/Ref.h"
+#include "Core/Utility/UniquePtr.h"
+#include "Math/Vector.h"
+#include "RenderGraphResources.h"
+#include "Render/RenderTarget.h"
+
+class FRenderTexture;
+class FRenderGraph;
+
+/**
+ * 渲染图中的纹理句柄，只在创建它的 FRenderGraph 中有效
+ */
+struct FRenderGraphTextureHandle
+{
+    Int32 Index = -1;
+
+    bool IsValid() const
+    {
+        return Index >= 0;
+    }
+
+    bool operator==(const FRenderGraphTextureHandle& Other) const
+    {
+        return Index == Other.Index;
+    }
+};
+
+/**
+ * Pass 执行时可以访问的上下文
+ */
+class HK_API FRenderGraphPassContext
+{
+public:
+    explicit FRenderGraphPassContext(const FRenderGraph& InGraph) : Graph(InGraph) {}
+
+    /**
+     * 获取纹理句柄对应的物理纹理，只能获取本 Pass 声明过的纹理
+     */
+    FRenderTexture* GetTexture(FRenderGraphTextureHandle Handle) const;
+
+private:
+    const FRenderGraph& Graph;
+};
+
+enum class ERenderGraphPassFlag : UInt32
+{
+    None           = 0,
+    NeverCull      = 1 << 0, // 即使输出没有被使用也不剔除（例如有外部副作用）
+    ParallelRecord = 1 << 1, // 录制回调是线程安全的，可以与其他 Pass 并行录制
+};
+HK_ENABLE_BITMASK_OPERATORS(ERenderGraphPassFlag)
+
+/**
+ * 渲染图中的一个 Pass
+ * 通过 Read/Write 声明资源访问，设置了附件的 Pass 会由渲染图自动 BeginRendering/EndRendering
+ */
+class HK_API FRenderGraphPass
+{
+    friend class FRenderGraph;
+
+public:
+    // 录制回调：在 Commands 中录制本 Pass 的命令
+    using FExecuteDelegate = TDelegate<void, TRef<FRHICommandBuffer>, const FRenderGraphPassContext&>;
+
+    FRenderGraphPass& Read(FRenderGraphTextureHandle Handle,
+                           ERenderGraphAccess        Access = ERenderGraphAccess::ShaderRead);
+    FRenderGraphPass& Write(FRenderGraphTextureHandle Handle, ERenderGraphAccess Access);
+
+    /**
+     * 设置颜色附件，等价于以 ColorAttachment 方式写入
+     */
+    FRenderGraphPass& AddColorAttachment(FRenderGraphTextureHandle Handle,
+                                         ERenderTargetLoadOp       LoadOp     = ERenderTargetLoadOp::Clear,
+                                         const FVector4f&          ClearColor = FVector4f(0.0f, 0.0f, 0.0f, 1.0f));
+
+    /**
+     * 设置深度模板附件，等价于以 DepthStencilAttachment 方式写入
+     */
+    FRenderGraphPass& SetDepthStencilAttachment(FRenderGraphTextureHandle Handle,
+                                                ERenderTargetLoadOp       LoadOp     = ERenderTargetLoadOp::Clear,
+                                                float                     ClearDepth = 1.0f);
+
+    template <typename Functor>
+    FRenderGraphPass& SetExecute(Functor&& Func)
+    {
+        Execute.Bind(std::forward<Functor>(Func));
+        return *this;
+    }
+
+    const FString& GetName() const
+    {
+        return Name;
+    }
+
+private:
+    struct FTextureAccess
+    {
+        FRenderGraphTextureHandle Handle;
+        ERenderGraphAccess        Access = ERenderGraphAccess::None;
+    };
+
+    struct FColorAttachment
+    {
+        FRenderGraphTextureHandle Handle;
+        ERenderTargetLoadOp       LoadOp = ERenderTargetLoadOp::Clear;
+        FVector4f                 ClearColor;
+    };
+
+    struct FDepthAttachment
+    {
+        FRenderGraphTextureHandle Handle;
+        ERenderTargetLoadOp       LoadOp     = ERenderTargetLoadOp::Clear;
+        float                     ClearDepth = 1.0f;
+    };
+
+    bool Uses(FRenderGraphTextureHandle Handle) const;
+
+    FString                  Name;
+    ERenderGraphPassFlag     Flags = ERenderGraphPassFlag::None;
+    TArray<FTextureAccess>   Reads;
+    TArray<FTextureAccess>   Writes;
+    TArray<FColorAttachment> ColorAttachments;
+    FDepthAttachment         DepthAttachment;
+    FExecuteDelegate         Execute;
+
+    // 以下由 Compile 填写
+    bool                              bCulled = false;
+    TArray<FRHIImageMemoryBarrier>    Barriers;
+    ERHIPipelineStageFlag             BarrierSrcStage = ERHIPipelineStageFlag::None;
+    ERHIPipelineStageFlag             BarrierDstStage = ERHIPipelineStageFlag::None;
+    TArray<FRenderGraphTextureHandle> AcquireTextures; // 本 Pass 开始时分配物理纹理
+    TArray<FRenderGraphTextureHandle> ReleaseTextures; // 本 Pass 结束后归还物理纹理
+};
+
+/**
+ * 渲染图
+ * 每帧重新构建：声明 Pass 与资源访问 -> Compile（剔除、计算生命周期与屏障）-> Execute（分配纹理、录制命令）
+ * - 没有被任何存活 Pass 或外部纹理使用的输出所在的 Pass 会被剔除
+ * - 屏障根据纹理当前的布局与访问状态自动计算，每个 Pass 之前合并为一次 PipelineBarrier
+ * - 临时纹理从 FRenderGraphResourcePool 获取，生命周期不重叠且描述兼容的纹理共享同一张物理纹理
+ * - 带 ParallelRecord 标记的 Pass 在 Worker 线程上并行录制到各自的延迟命令列表，再按顺序合并
+ */
+class HK_API FRenderGraph
+{
+    friend class FRenderGraphPassContext;
+
+public:
+    explicit FRenderGraph(FRenderGraphResourcePool& InResourcePool) : ResourcePool(InResourcePool) {}
+
+    ~FRenderGraph();
+
+    FRenderGraph(const FRenderGraph&)            = delete;
+    FRenderGraph& operator=(const FRenderGraph&) = delete;
+
+    /**
+     * 声明一张临时纹理，实际的纹理在第一个使用它的 Pass 执行前才分配
+     */
+    FRenderGraphTextureHandle CreateTexture(const FRenderGraphTextureDesc& Desc);
+
+    /**
+     * 导入外部纹理（例如 SwapChain 或跨帧保留的纹理）
+     * @param Texture 外部纹理
+     * @param FinalAccess 渲染图执行完后纹理需要处于的访问状态，None 表示保持最后一次访问的状态
+     * @param InitialLayout 首次导入时纹理的布局，之后由资源池记录
+     */
+    FRenderGraphTextureHandle ImportTexture(FRenderTexture* Texture,
+                                            ERenderGraphAccess FinalAccess   = ERenderGraphAccess::None,
+                                            ERHIImageLayout    InitialLayout = ERHIImageLayout::Undefined);
+
+    FRenderGraphPass& AddPass(FStringView Name, ERenderGraphPassFlag Flags = ERenderGraphPassFlag::None);
+
+    /**
+     * 剔除无用 Pass 并计算纹理生命周期，必须在 Execute 之前调用
+     */
+    void Compile();
+
+    /**
+     * 分配纹理、插入屏障并录制所有存活的 Pass
+     * @param Commands 目标命令缓冲区
+     */
+    void Execute(FRHICommandBuffer& Commands);
+
+    UInt32 GetCulledPassCount() const
+    {
+        return CulledPassCount;
+    }
+
+private:
+    struct FTextureEntry
+    {
+        FRenderGraphTextureDesc   Desc;
+        FRenderTexture*           Texture     = nullptr;
+        FRenderGraphTextureState* State       = nullptr;
+        bool                      bExternal   = false;
+        ERenderGraphAccess        FinalAccess = ERenderGraphAccess::None;
+        Int32                     FirstPass   = -1;
+        Int32                     LastPass    = -1;
+    };
+
+    FTextureEntry& GetEntry(FRenderGraphTextureHandle Handle)
+    {
+        return Textures[Handle.Index];
+    }
+
+    const FTextureEntry& GetEntry(FRenderGraphTextureHandle Handle) const
+    {
+        return Textures[Handle.Index];
+    }
+
+    /**
+     * 为 Pass 的一次访问追加屏障（如有必要），并更新纹理状态
+     */
+    void TransitionTexture(FTextureEntry& Entry, ERenderGraphAccess Access, TArray<FRHIImageMemoryBarrier>& OutBarriers,
+                           ERHIPipelineStageFlag& OutSrcStage, ERHIPipelineStageFlag& OutDstStage);
+
+    void BuildBarriers(FRenderGraphPass& Pass);
+    void RecordPass(FRenderGraphPass& Pass, FRHICommandBuffer& Commands) const;
+
+    FRenderGraphResourcePool&            ResourcePool;
+    TArray<FTextureEntry>                Textures;
+    TArray<TUniquePtr<FRenderGraphPass>> Passes;
+    UInt32                               CulledPassCount = 0;
+    bool                                 bCompiled       = false;
+};
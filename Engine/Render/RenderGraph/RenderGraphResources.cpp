@@ -0,0 +1,181 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "RenderGraphResources.h"
+
+#include "Core/Logging/Logger.h"
+#include "Core/Utility/HashUtility.h"
+#include "Render/Texture/RenderTexture.h"
+
+FRenderGraphTextureState FRenderGraphTextureState::FromAccess(ERenderGraphAccess InAccess)
+{
+    FRenderGraphTextureState State;
+    switch (InAccess)
+    {
+        case ERenderGraphAccess::ColorAttachment:
+            State.Layout = ERHIImageLayout::ColorAttachmentOptimal;
+            State.Access = ERHIAccessFlag::ColorAttachmentRead | ERHIAccessFlag::ColorAttachmentWrite;
+            State.Stage  = ERHIPipelineStageFlag::ColorAttachmentOutput;
+            State.bWrite = true;
+            break;
+        case ERenderGraphAccess::DepthStencilAttachment:
+            State.Layout = ERHIImageLayout::DepthStencilAttachmentOptimal;
+            State.Access = ERHIAccessFlag::DepthStencilAttachmentRead | ERHIAccessFlag::DepthStencilAttachmentWrite;
+            State.Stage  = ERHIPipelineStageFlag::EarlyFragmentTests | ERHIPipelineStageFlag::LateFragmentTests;
+            State.bWrite = true;
+            break;
+        case ERenderGraphAccess::DepthStencilRead:
+            State.Layout = ERHIImageLayout::DepthStencilReadOnlyOptimal;
+            State.Access = ERHIAccessFlag::DepthStencilAttachmentRead | ERHIAccessFlag::ShaderRead;
+            State.Stage  = ERHIPipelineStageFlag::EarlyFragmentTests | ERHIPipelineStageFlag::LateFragmentTests |
+                          ERHIPipelineStageFlag::FragmentShader;
+            break;
+        case ERenderGraphAccess::ShaderRead:
+            State.Layout = ERHIImageLayout::ShaderReadOnlyOptimal;
+            State.Access = ERHIAccessFlag::ShaderRead;
+            State.Stage  = ERHIPipelineStageFlag::FragmentShader | ERHIPipelineStageFlag::ComputeShader;
+            break;
+        case ERenderGraphAccess::ShaderWrite:
+            State.Layout = ERHIImageLayout::General;
+            State.Access = ERHIAccessFlag::ShaderRead | ERHIAccessFlag::ShaderWrite;
+            State.Stage  = ERHIPipelineStageFlag::FragmentShader | ERHIPipelineStageFlag::ComputeShader;
+            State.bWrite = true;
+            break;
+        case ERenderGraphAccess::TransferSrc:
+            State.Layout = ERHIImageLayout::TransferSrcOptimal;
+            State.Access = ERHIAccessFlag::TransferRead;
+            State.Stage  = ERHIPipelineStageFlag::Transfer;
+            break;
+        case ERenderGraphAccess::TransferDst:
+            State.Layout = ERHIImageLayout::TransferDstOptimal;
+            State.Access = ERHIAccessFlag::TransferWrite;
+            State.Stage  = ERHIPipelineStageFlag::Transfer;
+            State.bWrite = true;
+            break;
+        case ERenderGraphAccess::Present:
+            State.Layout = ERHIImageLayout::PresentSrcKHR;
+            State.Access = ERHIAccessFlag::None;
+            State.Stage  = ERHIPipelineStageFlag::BottomOfPipe;
+            break;
+        case ERenderGraphAccess::None:
+        default:
+            break;
+    }
+    return State;
+}
+
+UInt64 FRenderGraphTextureDesc::GetHashCode() const
+{
+    return FHashUtility::CombineHashes(std::hash<UInt32>{}(Width), std::hash<UInt32>{}(Height),
+                                       std::hash<UInt32>{}(static_cast<UInt32>(Format)),
+                                       std::hash<UInt32>{}(static_cast<UInt32>(Usage)));
+}
+
+FRenderGraphResourcePool::~FRenderGraphResourcePool()
+{
+    Release();
+}
+
+FRenderTexture* FRenderGraphResourcePool::AcquireTexture(const FRenderGraphTextureDesc& Desc,
+                                                         FRenderGraphTextureState*&     OutState)
+{
+    for (auto& Entry : Entries)
+    {
+        if (!Entry->bInUse && Entry->Desc.IsCompatible(Desc))
+        {
+            Entry->bInUse        = true;
+            Entry->LastUsedFrame = FrameCounter;
+            OutState             = &Entry->State;
+            return Entry->Texture.Get();
+        }
+    }
+
+    auto Entry           = MakeUnique<FPooledTexture>();
+    Entry->Desc          = Desc;
+    Entry->Texture       = MakeUnique<FRenderTexture>(Desc.Width, Desc.Height, Desc.Format, Desc.Usage,
+                                                      Desc.DebugName.IsEmpty() ? FStringView("RenderGraphTexture")
+                                                                               : FStringView(Desc.DebugName));
+    Entry->bInUse        = true;
+    Entry->LastUsedFrame = FrameCounter;
+    if (!Entry->Texture->IsValid())
+    {
+        HK_LOG_ERROR(ELogcat::Render, "Failed to create render graph texture: {}", Desc.DebugName);
+        return nullptr;
+    }
+
+    OutState                = &Entry->State;
+    FRenderTexture* Texture = Entry->Texture.Get();
+    Entries.Add(std::move(Entry));
+    return Texture;
+}
+
+void FRenderGraphResourcePool::ReleaseTexture(FRenderTexture* Texture)
+{
+    for (auto& Entry : Entries)
+    {
+        if (Entry->Texture.Get() == Texture)
+        {
+            Entry->bInUse = false;
+            return;
+        }
+    }
+}
+
+FRenderGraphTextureState& FRenderGraphResourcePool::GetExternalState(FRenderTexture* Texture,
+                                                                     ERHIImageLayout InitialLayout)
+{
+    FExternalTexture* Found = nullptr;
+    if (TUniquePtr<FExternalTexture>* Existing = ExternalTextures.Find(Texture))
+    {
+        Found = Existing->Get();
+    }
+    else
+    {
+        auto External          = MakeUnique<FExternalTexture>();
+        External->State.Layout = InitialLayout;
+        Found                  = External.Get();
+        ExternalTextures.Add(Texture, std::move(External));
+    }
+    Found->LastUsedFrame = FrameCounter;
+    return Found->State;
+}
+
+void FRenderGraphResourcePool::EndFrame(UInt32 MaxIdleFrames)
+{
+    for (Int64 i = static_cast<Int64>(Entries.Size()) - 1; i >= 0; --i)
+    {
+        auto& Entry = Entries[i];
+        Entry->bInUse = false;
+        if (FrameCounter - Entry->LastUsedFrame > MaxIdleFrames)
+        {
+            Entry->Texture->Release();
+            Entries.RemoveAt(i);
+        }
+    }
+
+    TArray<FRenderTexture*> StaleExternals;
+    for (const auto& [Texture, External] : ExternalTextures)
+    {
+        if (FrameCounter - External->LastUsedFrame > MaxIdleFrames)
+        {
+            StaleExternals.Add(Texture);
+        }
+    }
+    for (FRenderTexture* Texture : StaleExternals)
+    {
+        ExternalTextures.Remove(Texture);
+    }
+
+    ++FrameCounter;
+}
+
+void FRenderGraphResourcePool::Release()
+{
+    for (auto& Entry : Entries)
+    {
+        Entry->Texture->Release();
+    }
+    Entries.Clear();
+    ExternalTextures.Clear();
+}
@@ -0,0 +1,129 @@
+#pragma once
+#include "Core/Container/Array.h"
+#include "Core/Container/Map.h"
+#include "Core/String/String.h"
+#include "Core/Utility/UniquePtr.h"
+#include "RHI/RHICommandBuffer.h"
+#include "RHI/RHIImage.h"
+
+class FRenderTexture;
+
+/**
+ * Pass 对纹理的访问方式，决定纹理需要处于的布局、访问掩码与管线阶段
+ */
+enum class ERenderGraphAccess : UInt32
+{
+    None,
+    ColorAttachment,        // 作为颜色附件写入
+    DepthStencilAttachment, // 作为深度模板附件读写
+    DepthStencilRead,       // 只读深度（深度测试或采样）
+    ShaderRead,             // 在着色器中采样
+    ShaderWrite,            // 作为存储图像写入
+    TransferSrc,            // 复制源
+    TransferDst,            // 复制目标
+    Present,                // 交给 SwapChain 呈现
+};
+
+/**
+ * 纹理在某一时刻的同步状态
+ */
+struct FRenderGraphTextureState
+{
+    ERHIImageLayout       Layout = ERHIImageLayout::Undefined;
+    ERHIAccessFlag        Access = ERHIAccessFlag::None;
+    ERHIPipelineStageFlag Stage  = ERHIPipelineStageFlag::None;
+    bool                  bWrite = false;
+
+    static FRenderGraphTextureState FromAccess(ERenderGraphAccess InAccess);
+};
+
+/**
+ * 临时纹理描述，描述相同的纹理可以在生命周期不重叠的资源之间复用
+ */
+struct FRenderGraphTextureDesc
+{
+    UInt32          Width  = 0;
+    UInt32          Height = 0;
+    ERHIImageFormat Format = ERHIImageFormat::R8G8B8A8_UNorm;
+    ERHIImageUsage  Usage  = ERHIImageUsage::ColorAttachment | ERHIImageUsage::Sampled;
+    FString         DebugName;
+
+    UInt64 GetHashCode() const;
+
+    // 复用只比较影响内存布局的字段，不比较 DebugName
+    bool IsCompatible(const FRenderGraphTextureDesc& Other) const
+    {
+        return Width == Other.Width && Height == Other.Height && Format == Other.Format && Usage == Other.Usage;
+    }
+};
+
+/**
+ * 临时纹理池
+ * 一帧内生命周期不重叠的临时纹理共享同一张物理纹理，跨帧保留以避免每帧创建图像
+ * 同一个池只能被同一个在途帧使用，否则 GPU 可能仍在读取将要被复用的纹理
+ */
+class HK_API FRenderGraphResourcePool
+{
+public:
+    FRenderGraphResourcePool() = default;
+    ~FRenderGraphResourcePool();
+
+    FRenderGraphResourcePool(const FRenderGraphResourcePool&)                = delete;
+    FRenderGraphResourcePool& operator=(const FRenderGraphResourcePool&)     = delete;
+    FRenderGraphResourcePool(FRenderGraphResourcePool&&) noexcept            = default;
+    FRenderGraphResourcePool& operator=(FRenderGraphResourcePool&&) noexcept = default;
+
+    /**
+     * 获取一张符合描述的空闲纹理，没有时创建
+     * @param Desc 纹理描述
+     * @param OutState 纹理当前的同步状态，保留上一个使用者的访问掩码，用于计算复用时的屏障
+     * @return 纹理，在 ReleaseTexture 之前归调用者独占
+     */
+    FRenderTexture* AcquireTexture(const FRenderGraphTextureDesc& Desc, FRenderGraphTextureState*& OutState);
+
+    /**
+     * 归还纹理，之后可以被同一帧中稍后开始的资源复用
+     */
+    void ReleaseTexture(FRenderTexture* Texture);
+
+    /**
+     * 获取外部纹理的同步状态，首次访问时使用 InitialLayout
+     */
+    FRenderGraphTextureState& GetExternalState(FRenderTexture* Texture, ERHIImageLayout InitialLayout);
+
+    /**
+     * 一帧结束时调用，释放连续 MaxIdleFrames 帧未使用的纹理与外部纹理记录
+     */
+    void EndFrame(UInt32 MaxIdleFrames = 8);
+
+    /**
+     * 释放所有纹理
+     */
+    void Release();
+
+    UInt32 GetPooledTextureCount() const
+    {
+        return static_cast<UInt32>(Entries.Size());
+    }
+
+private:
+    struct FPooledTexture
+    {
+        FRenderGraphTextureDesc    Desc;
+        TUniquePtr<FRenderTexture> Texture;
+        FRenderGraphTextureState   State;
+        UInt64                     LastUsedFrame = 0;
+        bool                       bInUse        = false;
+    };
+
+    struct FExternalTexture
+    {
+        FRenderGraphTextureState State;
+        UInt64                   LastUsedFrame = 0;
+    };
+
+    TArray<TUniquePtr<FPooledTexture>> Entries;
+    // GetExternalState 返回的引用需要跨插入保持有效, TMap 扩容会移动值, 因此存放在堆上
+    TMap<FRenderTexture*, TUniquePtr<FExternalTexture>> ExternalTextures;
+    UInt64                                              FrameCounter = 0;
+};
@@ -1,8 +1,16 @@
 #pragma once
 
-#define HK_RENDER_BINDLESS_MAX_TEXTURES 1024
-#define HK_RENDER_BINDLESS_MAX_SAMPLERS 16
+// bindless 纹理表与采样器表的上限, 实际大小取该值与设备 UpdateAfterBind 上限中的较小者
+#define HK_RENDER_BINDLESS_MAX_TEXTURES 16384
+#define HK_RENDER_BINDLESS_MAX_SAMPLERS 256
 #define HK_RENDER_BINDLESS_MAX_UNIFORM_BUFFERS 256
 #define HK_RENDER_BINDLESS_MAX_STORAGE_BUFFERS 256
 #define HK_RENDER_INIT_MODEL_MATRIX_COUNT 1024
 #define HK_RENDER_INIT_FRAME_IN_FLIGHT 2
+// FRenderConfig::FramesInFlight 的上限
+#define HK_RENDER_MAX_FRAME_IN_FLIGHT 4
+// 每个在途帧的GPU时间戳查询数量, 每个GPU作用域占用两个查询
+#define HK_RENDER_GPU_PROFILER_MAX_QUERIES 512
+// 全局材质参数表中每个材质槽位的字节数, 与 Builtin/Shader/Common.slang 的 HK_MATERIAL_SLOT_SIZE 一致
+#define HK_RENDER_MATERIAL_SLOT_SIZE 128
+#define HK_RENDER_INIT_MATERIAL_SLOT_COUNT 256
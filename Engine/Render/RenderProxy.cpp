@@ -0,0 +1,46 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "RenderProxy.h"
+
+#include "Core/Utility/Profiler.h"
+#include "Render/GlobalRenderResources.h"
+#include "Render/Material/MaterialTable.h"
+#include "Render/Renderer/RendererManager.h"
+
+const FRenderSceneSnapshot& FRenderProxyBuffer::Capture(UInt64 FrameNumber, const FFrustum* CullingFrustum)
+{
+    HK_PROFILE_SCOPE_N("FRenderProxyBuffer::Capture");
+
+    FRenderSceneSnapshot& Snapshot = Snapshots[WriteIndex];
+    WriteIndex                     = (WriteIndex + 1) % Snapshots.Size();
+
+    Snapshot.FrameNumber = FrameNumber;
+    Snapshot.Proxies.Clear();
+
+    const TArray<FRenderer*>* Renderers = &FRendererManager::GetRef().GetRenderers();
+    if (CullingFrustum != nullptr)
+    {
+        CulledRenderers.Clear();
+        FRendererManager::GetRef().CullRenderers(*CullingFrustum, CulledRenderers);
+        Renderers = &CulledRenderers;
+    }
+    Snapshot.Proxies.Reserve(Renderers->Size());
+    for (const FRenderer* Renderer : *Renderers)
+    {
+        FRenderProxy Proxy;
+        Renderer->GatherRenderProxy(Proxy);
+        if (Proxy.bVisible)
+        {
+            Snapshot.Proxies.Add(Proxy);
+        }
+    }
+
+    // 只复制上一快照之后变化的模型矩阵
+    FGlobalDynamicRenderResourcePool::GetRef().CaptureModelMatrixUpdate(Snapshot.ModelMatrixUpdate);
+    // 只复制上一快照之后变化的材质槽位
+    FGlobalMaterialTable::GetRef().CaptureUpdate(Snapshot.MaterialTableUpdate);
+
+    return Snapshot;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "Core/Container/Array.h"
+#include "Core/Container/FixedArray.h"
+#include "Math/Matrix.h"
+#include "Render/GlobalRenderResources.h"
+#include "Render/Material/MaterialTable.h"
+#include "Render/Renderer/Renderer.h"
+
+class FFrustum;
+class HMesh;
+class HMaterial;
+
+/**
+ * Renderer在某一帧的只读快照, 由Game线程生成, Render线程只读取快照而不访问Renderer本身
+ */
+struct FRenderProxy
+{
+    ERendererType RendererType     = ERendererType::Count;
+    Int32         ModelMatrixIndex = -1;
+    bool          bVisible         = false;
+    HMesh*        Mesh             = nullptr;
+    HMaterial*    Material         = nullptr;
+    // 材质在全局材质参数表中的槽位, 在Game线程读取, Render线程不访问材质本身的参数
+    UInt32        MaterialSlot     = UINT32_MAX;
+};
+
+/**
+ * 一帧的渲染快照
+ */
+struct FRenderSceneSnapshot
+{
+    UInt64               FrameNumber = 0;
+    TArray<FRenderProxy> Proxies;
+    // 上一快照之后变化的模型矩阵, 下标与FRenderProxy::ModelMatrixIndex对应
+    FModelMatrixUpdate ModelMatrixUpdate;
+    // 上一快照之后变化的材质槽位, 下标与FRenderProxy::MaterialSlot对应
+    FMaterialTableUpdate MaterialTableUpdate;
+};
+
+/**
+ * 双缓冲的渲染快照
+ * Game线程写入一个缓冲, Render线程同时读取另一个缓冲; 调用者需要保证同一时刻最多只有一帧在Render线程上执行
+ */
+class FRenderProxyBuffer
+{
+public:
+    /**
+     * 从FRendererManager, FGlobalDynamicRenderResourcePool与FGlobalMaterialTable收集当前帧的快照, 只能在Game线程调用
+     * @param FrameNumber 帧号
+     * @param CullingFrustum 不为空时只收集世界包围盒与视锥相交的渲染器
+     * @return 写入的快照, 在下一次Capture之前保持不变
+     */
+    const FRenderSceneSnapshot& Capture(UInt64 FrameNumber, const FFrustum* CullingFrustum = nullptr);
+
+private:
+    TFixedArray<FRenderSceneSnapshot, 2> Snapshots;
+    UInt32                               WriteIndex = 0;
+    // 视锥剔除的临时结果, 保留容量以避免每帧分配
+    TArray<FRenderer*> CulledRenderers;
+};
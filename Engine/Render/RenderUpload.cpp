@@ -0,0 +1,81 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "RenderUpload.h"
+
+#include "Core/Logging/Logger.h"
+#include "RHI/GfxDevice.h"
+#include "Render/RenderContext.h"
+
+#include <mutex>
+
+FRenderUpload::~FRenderUpload()
+{
+    FGfxDevice& GfxDevice = GetGfxDeviceRef();
+    for (FRHIFence& Fence : Fences)
+    {
+        Fence.Wait();
+        GfxDevice.DestroyFence(Fence);
+    }
+    for (FRHIBuffer& StagingBuffer : StagingBuffers)
+    {
+        if (StagingBuffer.IsValid())
+        {
+            GfxDevice.DestroyBuffer(StagingBuffer);
+        }
+    }
+    if (CommandBuffers.IsEmpty())
+    {
+        return;
+    }
+
+    FRenderContext& RenderContext = FRenderContext::GetRef();
+    std::lock_guard Lock(RenderContext.GetUploadCommandPoolMutex());
+    for (FRHICommandBuffer& CommandBuffer : CommandBuffers)
+    {
+        if (CommandBuffer.IsValid())
+        {
+            GfxDevice.DestroyCommandBuffer(RenderContext.GetUploadCommandPool(), CommandBuffer);
+        }
+    }
+}
+
+void FRenderUpload::AddStagingBuffer(const FRHIBuffer& StagingBuffer)
+{
+    StagingBuffers.Add(StagingBuffer);
+}
+
+bool FRenderUpload::Submit(FRHICommandBuffer&& CommandBuffer)
+{
+    FGfxDevice& GfxDevice  = GetGfxDeviceRef();
+    FRHIFence   Fence      = GfxDevice.CreateFence({});
+    const bool  bSubmitted = Fence.IsValid() && CommandBuffer.Submit({}, {}, Fence);
+    // 提交失败时栅栏永远不会完成, 直接销毁, 命令缓冲区仍然交给析构释放
+    if (bSubmitted)
+    {
+        Fences.Add(Fence);
+    }
+    else
+    {
+        HK_LOG_ERROR(ELogcat::Render, "Failed to submit upload command buffer");
+        if (Fence.IsValid())
+        {
+            GfxDevice.DestroyFence(Fence);
+        }
+    }
+    CommandBuffers.Add(std::move(CommandBuffer));
+    return bSubmitted;
+}
+
+bool FRenderUpload::IsComplete() const
+{
+    for (const FRHIFence& Fence : Fences)
+    {
+        if (!Fence.IsSignaled())
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "Core/Container/Array.h"
+#include "RHI/RHIBuffer.h"
+#include "RHI/RHICommandBuffer.h"
+#include "RHI/RHISync.h"
+
+/**
+ * 资产上传提交到 GPU 的命令, 以及栅栏完成之前不能释放的暂存缓冲与命令缓冲
+ * 析构时等待尚未完成的栅栏并释放全部资源: 同步加载使用局部对象, 与提交后立即等待相同;
+ * 异步加载把它放在 FAssetLoadPayload 中, FAssetManager 每帧轮询 IsComplete, 完成之后才析构, 不会阻塞 Render 线程
+ */
+class FRenderUpload
+{
+public:
+    FRenderUpload() = default;
+    ~FRenderUpload();
+
+    FRenderUpload(const FRenderUpload&)            = delete;
+    FRenderUpload& operator=(const FRenderUpload&) = delete;
+
+    /**
+     * 登记一个暂存缓冲, 上传完成后销毁
+     */
+    void AddStagingBuffer(const FRHIBuffer& StagingBuffer);
+
+    /**
+     * 提交录制好的命令缓冲区, 命令缓冲区在上传完成后销毁
+     * 调用方需要持有 FRenderContext::GetUploadCommandPoolMutex
+     * @return 是否提交成功
+     */
+    bool Submit(FRHICommandBuffer&& CommandBuffer);
+
+    /**
+     * 全部提交是否都已经执行完成, 不会阻塞
+     */
+    bool IsComplete() const;
+
+private:
+    TArray<FRHIFence>         Fences;
+    TArray<FRHIBuffer>        StagingBuffers;
+    TArray<FRHICommandBuffer> CommandBuffers;
+};
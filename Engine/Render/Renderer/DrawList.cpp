@@ -0,0 +1,612 @@
+//
+// Created by Admin on 2026/2/2.
+//
+
+#include "DrawList.h"
+
+#include "Core/Container/Map.h"
+#include "Core/Utility/Profiler.h"
+#include "Core/Utility/UniquePtr.h"
+#include "RHI/GfxDevice.h"
+#include "RHI/RHICommandBuffer.h"
+#include "Render/Culling/GPUCulling.h"
+#include "Render/Material/Material.h"
+#include "Render/Material/SharedMaterial.h"
+#include "Render/Mesh/Mesh.h"
+#include "Render/RenderProxy.h"
+#include "TaskGraph/TaskGraph.h"
+
+#include <bit>
+#include <cstring>
+#include <limits>
+
+// 并行排序的分块数量, 调用线程处理一块, 其余交给 Worker 线程
+static constexpr size_t RadixSortChunkCount  = 4;
+static constexpr size_t RadixSortBucketCount = 256;
+static constexpr UInt32 RadixSortPassCount   = 8;
+
+namespace
+{
+/**
+ * 为指针分配紧凑 ID, 超出位宽的部分会回绕, 只影响排序质量而不影响正确性
+ */
+class FCompactIdMap
+{
+public:
+    explicit FCompactIdMap(UInt32 InBits) : Mask((1u << InBits) - 1) {}
+
+    UInt32 Get(const void* Ptr)
+    {
+        if (const UInt32* Found = Ids.Find(Ptr))
+        {
+            return *Found;
+        }
+        const UInt32 Id = NextId++ & Mask;
+        Ids.Add(Ptr, Id);
+        return Id;
+    }
+
+private:
+    TMap<const void*, UInt32> Ids;
+    UInt32                    Mask;
+    UInt32                    NextId = 0;
+};
+
+void RadixSortSerial(TArray<UInt64>& Keys, TArray<UInt32>& Values, TArray<UInt64>& ScratchKeys,
+                     TArray<UInt32>& ScratchValues)
+{
+    const size_t Count = Keys.Size();
+
+    // 一次遍历统计全部 8 趟的直方图
+    size_t Histograms[8][RadixSortBucketCount] = {};
+    for (size_t Index = 0; Index < Count; ++Index)
+    {
+        const UInt64 Key = Keys[Index];
+        for (UInt32 Pass = 0; Pass < 8; ++Pass)
+        {
+            ++Histograms[Pass][(Key >> (Pass * 8)) & 0xFF];
+        }
+    }
+
+    UInt64* SourceKeys   = Keys.Data();
+    UInt32* SourceValues = Values.Data();
+    UInt64* DestKeys     = ScratchKeys.Data();
+    UInt32* DestValues   = ScratchValues.Data();
+    for (UInt32 Pass = 0; Pass < 8; ++Pass)
+    {
+        const UInt32 Shift = Pass * 8;
+        if (Histograms[Pass][(SourceKeys[0] >> Shift) & 0xFF] == Count)
+        {
+            continue;
+        }
+
+        size_t Offsets[RadixSortBucketCount];
+        size_t Sum = 0;
+        for (size_t Bucket = 0; Bucket < RadixSortBucketCount; ++Bucket)
+        {
+            Offsets[Bucket] = Sum;
+            Sum += Histograms[Pass][Bucket];
+        }
+        for (size_t Index = 0; Index < Count; ++Index)
+        {
+            const size_t Target = Offsets[(SourceKeys[Index] >> Shift) & 0xFF]++;
+            DestKeys[Target]    = SourceKeys[Index];
+            DestValues[Target]  = SourceValues[Index];
+        }
+        std::swap(SourceKeys, DestKeys);
+        std::swap(SourceValues, DestValues);
+    }
+
+    if (SourceKeys != Keys.Data())
+    {
+        std::memcpy(Keys.Data(), SourceKeys, Count * sizeof(UInt64));
+        std::memcpy(Values.Data(), SourceValues, Count * sizeof(UInt32));
+    }
+}
+
+template <typename Func>
+void RunChunksInParallel(const char* DebugName, Func&& ChunkFunc)
+{
+    TSharedPtr<FTask> Tasks[RadixSortChunkCount - 1];
+    for (size_t Chunk = 1; Chunk < RadixSortChunkCount; ++Chunk)
+    {
+        Tasks[Chunk - 1] = FTaskGraph::GetRef().Create(FString(DebugName), EExecutorLabel::Worker,
+                                                       [&ChunkFunc, Chunk]() { ChunkFunc(Chunk); });
+        FTaskGraph::GetRef().Launch(Tasks[Chunk - 1]);
+    }
+    // 调用线程处理第一块, 而不是空等
+    ChunkFunc(0);
+    for (auto& Task : Tasks)
+    {
+        Task->Wait();
+    }
+}
+
+/**
+ * 并行排序的计数器, 每块只写自己的部分, 放在堆上以免占用过多栈空间
+ */
+struct FRadixSortCounters
+{
+    // 每块全部 8 趟的直方图, 由一次并行遍历统计
+    size_t PassHistograms[RadixSortChunkCount][RadixSortPassCount][RadixSortBucketCount] = {};
+    // 当前趟每块的直方图, 求前缀和后原地变为每块每个桶的写入位置
+    size_t Offsets[RadixSortChunkCount][RadixSortBucketCount] = {};
+    // 分发时按 (源块, 目标块) 统计的下一趟直方图
+    size_t NextHistograms[RadixSortChunkCount][RadixSortChunkCount][RadixSortBucketCount] = {};
+};
+
+/**
+ * 元素按下标均分为 RadixSortChunkCount 块, 每块对应一个任务
+ * 1. 一次并行遍历统计每块全部 8 趟的直方图, 所有键落在同一桶的趟与键的排列无关, 可以提前跳过
+ * 2. 每趟只有一次 fork/join: 各块把元素分发到互不重叠的目标区间, 同时按目标位置所在的块统计下一趟的直方图
+ */
+void RadixSortParallel(TArray<UInt64>& Keys, TArray<UInt32>& Values, TArray<UInt64>& ScratchKeys,
+                       TArray<UInt32>& ScratchValues)
+{
+    const size_t                   Count     = Keys.Size();
+    const size_t                   ChunkSize = (Count + RadixSortChunkCount - 1) / RadixSortChunkCount;
+    TUniquePtr<FRadixSortCounters> Counters  = MakeUnique<FRadixSortCounters>();
+
+    // 1. 统计直方图
+    RunChunksInParallel("DrawList.RadixHistogram", [&](size_t Chunk) {
+        auto&        Histograms = Counters->PassHistograms[Chunk];
+        const size_t Begin      = std::min(Chunk * ChunkSize, Count);
+        const size_t End        = std::min(Begin + ChunkSize, Count);
+        for (size_t Index = Begin; Index < End; ++Index)
+        {
+            const UInt64 Key = Keys[Index];
+            for (UInt32 Pass = 0; Pass < RadixSortPassCount; ++Pass)
+            {
+                ++Histograms[Pass][(Key >> (Pass * 8)) & 0xFF];
+            }
+        }
+    });
+
+    UInt32 ActivePasses[RadixSortPassCount];
+    UInt32 ActivePassCount = 0;
+    for (UInt32 Pass = 0; Pass < RadixSortPassCount; ++Pass)
+    {
+        const size_t FirstBucket = (Keys[0] >> (Pass * 8)) & 0xFF;
+        size_t       BucketTotal = 0;
+        for (size_t Chunk = 0; Chunk < RadixSortChunkCount; ++Chunk)
+        {
+            BucketTotal += Counters->PassHistograms[Chunk][Pass][FirstBucket];
+        }
+        if (BucketTotal != Count)
+        {
+            ActivePasses[ActivePassCount++] = Pass;
+        }
+    }
+    if (ActivePassCount == 0)
+    {
+        return;
+    }
+    for (size_t Chunk = 0; Chunk < RadixSortChunkCount; ++Chunk)
+    {
+        std::memcpy(Counters->Offsets[Chunk], Counters->PassHistograms[Chunk][ActivePasses[0]],
+                    sizeof(Counters->Offsets[Chunk]));
+    }
+
+    UInt64* SourceKeys   = Keys.Data();
+    UInt32* SourceValues = Values.Data();
+    UInt64* DestKeys     = ScratchKeys.Data();
+    UInt32* DestValues   = ScratchValues.Data();
+    for (UInt32 ActiveIndex = 0; ActiveIndex < ActivePassCount; ++ActiveIndex)
+    {
+        const UInt32 Shift     = ActivePasses[ActiveIndex] * 8;
+        const bool   bHasNext  = ActiveIndex + 1 < ActivePassCount;
+        const UInt32 NextShift = bHasNext ? ActivePasses[ActiveIndex + 1] * 8 : 0;
+
+        // 2. 按 (桶, 块) 顺序求前缀和, 保证排序稳定
+        size_t Sum = 0;
+        for (size_t Bucket = 0; Bucket < RadixSortBucketCount; ++Bucket)
+        {
+            for (size_t Chunk = 0; Chunk < RadixSortChunkCount; ++Chunk)
+            {
+                const size_t ChunkCount          = Counters->Offsets[Chunk][Bucket];
+                Counters->Offsets[Chunk][Bucket] = Sum;
+                Sum += ChunkCount;
+            }
+        }
+
+        // 3. 分发, 目标位置所在的块决定该元素在下一趟属于哪一块
+        RunChunksInParallel("DrawList.RadixScatter", [&](size_t Chunk) {
+            size_t*      Offsets        = Counters->Offsets[Chunk];
+            auto&        NextHistograms = Counters->NextHistograms[Chunk];
+            const size_t Begin          = std::min(Chunk * ChunkSize, Count);
+            const size_t End            = std::min(Begin + ChunkSize, Count);
+            std::memset(NextHistograms, 0, sizeof(NextHistograms));
+            for (size_t Index = Begin; Index < End; ++Index)
+            {
+                const UInt64 Key    = SourceKeys[Index];
+                const size_t Target = Offsets[(Key >> Shift) & 0xFF]++;
+                DestKeys[Target]    = Key;
+                DestValues[Target]  = SourceValues[Index];
+                if (bHasNext)
+                {
+                    // 块数很少, 比较比除法快
+                    size_t TargetChunk = 0;
+                    for (size_t Boundary = 1; Boundary < RadixSortChunkCount; ++Boundary)
+                    {
+                        TargetChunk += Target >= Boundary * ChunkSize ? 1 : 0;
+                    }
+                    ++NextHistograms[TargetChunk][(Key >> NextShift) & 0xFF];
+                }
+            }
+        });
+        std::swap(SourceKeys, DestKeys);
+        std::swap(SourceValues, DestValues);
+
+        if (bHasNext)
+        {
+            for (size_t Chunk = 0; Chunk < RadixSortChunkCount; ++Chunk)
+            {
+                for (size_t Bucket = 0; Bucket < RadixSortBucketCount; ++Bucket)
+                {
+                    size_t ChunkCount = 0;
+                    for (size_t SourceChunk = 0; SourceChunk < RadixSortChunkCount; ++SourceChunk)
+                    {
+                        ChunkCount += Counters->NextHistograms[SourceChunk][Chunk][Bucket];
+                    }
+                    Counters->Offsets[Chunk][Bucket] = ChunkCount;
+                }
+            }
+        }
+    }
+
+    if (SourceKeys != Keys.Data())
+    {
+        std::memcpy(Keys.Data(), SourceKeys, Count * sizeof(UInt64));
+        std::memcpy(Values.Data(), SourceValues, Count * sizeof(UInt32));
+    }
+}
+
+/**
+ * 按顺序遍历某个 Pass 的绘制命令, 只在管线或网格变化时重新绑定, 实际的绘制由 DrawFunc 录制
+ * 不同管线的布局可能不同, 切换管线时重新绑定 Model 描述符集
+ */
+template <typename Func>
+void RecordDrawCommands(FRHICommandBuffer& Commands, const TArray<FDrawCommand>& DrawCommands, EDrawPass Pass,
+                        const FRHIDescriptorSet& ModelDescriptorSet, Func&& DrawFunc)
+{
+    const FSharedMaterial* BoundMaterial = nullptr;
+    const FSubMesh*        BoundSubMesh  = nullptr;
+    for (UInt32 CommandIndex = 0; CommandIndex < DrawCommands.Size(); ++CommandIndex)
+    {
+        const FDrawCommand& Command = DrawCommands[CommandIndex];
+        if (Command.Pass != Pass)
+        {
+            continue;
+        }
+
+        const FSharedMaterial* SharedMaterial = Command.Material->GetSharedMaterial();
+        if (SharedMaterial != BoundMaterial)
+        {
+            Commands.BindPipeline(SharedMaterial->Pipeline);
+            if (SharedMaterial->bNeedModel)
+            {
+                Commands.BindDescriptorSet(ERHIPipelineType::Graphics, SharedMaterial->PipelineLayout,
+                                           ModelDescriptorSet, static_cast<UInt32>(ECommonDescriptorSetIndex::Model));
+            }
+            BoundMaterial = SharedMaterial;
+        }
+
+        const FSubMesh& SubMesh = Command.Mesh->GetSubMeshes()[Command.SubMeshIndex];
+        if (&SubMesh != BoundSubMesh)
+        {
+            Commands.BindVertexBuffer(0, SubMesh.VertexBuffer);
+            Commands.BindIndexBuffer(SubMesh.IndexBuffer, 0, true);
+            BoundSubMesh = &SubMesh;
+        }
+
+        DrawFunc(CommandIndex, Command, SubMesh);
+    }
+}
+} // namespace
+
+UInt32 FDrawSortKey::QuantizeDepth(float DistanceSquared)
+{
+    if (!(DistanceSquared > 0.0f))
+    {
+        return 0;
+    }
+    return std::bit_cast<UInt32>(DistanceSquared) >> (32 - DepthBits);
+}
+
+FDrawList::~FDrawList()
+{
+    Release();
+}
+
+FDrawList::FDrawList(FDrawList&& Other) noexcept
+    : Items(std::move(Other.Items)), SortKeys(std::move(Other.SortKeys)), SortValues(std::move(Other.SortValues)),
+      ScratchKeys(std::move(Other.ScratchKeys)), ScratchValues(std::move(Other.ScratchValues)),
+      DrawCommands(std::move(Other.DrawCommands)), Instances(std::move(Other.Instances)),
+      InstanceBuffer(Other.InstanceBuffer), InstanceMappedPtr(Other.InstanceMappedPtr),
+      ModelDescriptorSet(Other.ModelDescriptorSet), BoundModelMatrixBuffer(Other.BoundModelMatrixBuffer),
+      BoundInstanceBuffer(Other.BoundInstanceBuffer), BoundMaterialBuffer(Other.BoundMaterialBuffer)
+{
+    Other.InstanceBuffer     = FRHIBuffer();
+    Other.InstanceMappedPtr  = nullptr;
+    Other.ModelDescriptorSet = FRHIDescriptorSet();
+}
+
+FDrawList& FDrawList::operator=(FDrawList&& Other) noexcept
+{
+    if (this != &Other)
+    {
+        Release();
+        Items                   = std::move(Other.Items);
+        SortKeys                = std::move(Other.SortKeys);
+        SortValues              = std::move(Other.SortValues);
+        ScratchKeys             = std::move(Other.ScratchKeys);
+        ScratchValues           = std::move(Other.ScratchValues);
+        DrawCommands            = std::move(Other.DrawCommands);
+        Instances               = std::move(Other.Instances);
+        InstanceBuffer           = Other.InstanceBuffer;
+        InstanceMappedPtr        = Other.InstanceMappedPtr;
+        ModelDescriptorSet       = Other.ModelDescriptorSet;
+        BoundModelMatrixBuffer   = Other.BoundModelMatrixBuffer;
+        BoundInstanceBuffer      = Other.BoundInstanceBuffer;
+        BoundMaterialBuffer      = Other.BoundMaterialBuffer;
+        Other.InstanceBuffer     = FRHIBuffer();
+        Other.InstanceMappedPtr  = nullptr;
+        Other.ModelDescriptorSet = FRHIDescriptorSet();
+    }
+    return *this;
+}
+
+void FDrawList::RadixSort(TArray<UInt64>& Keys, TArray<UInt32>& Values, TArray<UInt64>& ScratchKeys,
+                          TArray<UInt32>& ScratchValues, const size_t ParallelThreshold)
+{
+    HK_PROFILE_SCOPE_N("FDrawList::RadixSort");
+    HK_ASSERT_MSG(Keys.Size() == Values.Size(), "排序键与负载数量不一致");
+
+    if (Keys.Size() <= 1)
+    {
+        return;
+    }
+    ScratchKeys.Resize(Keys.Size());
+    ScratchValues.Resize(Values.Size());
+    if (Keys.Size() < ParallelThreshold)
+    {
+        RadixSortSerial(Keys, Values, ScratchKeys, ScratchValues);
+    }
+    else
+    {
+        RadixSortParallel(Keys, Values, ScratchKeys, ScratchValues);
+    }
+}
+
+void FDrawList::Build(TSpan<const FRenderProxy> Proxies, TSpan<const FMatrix4x4f> ModelMatrices,
+                      const FVector3f& ViewPosition)
+{
+    HK_PROFILE_SCOPE_N("FDrawList::Build");
+
+    Items.Clear();
+    SortKeys.Clear();
+    SortValues.Clear();
+    DrawCommands.Clear();
+    Instances.Clear();
+
+    // 1. 每个代理的每个子网格生成一个绘制项与排序键
+    FCompactIdMap PipelineIds(FDrawSortKey::PipelineBits);
+    FCompactIdMap MeshIds(FDrawSortKey::MeshBits);
+    FCompactIdMap MaterialIds(FDrawSortKey::MaterialBits);
+    for (UInt32 ProxyIndex = 0; ProxyIndex < Proxies.Size(); ++ProxyIndex)
+    {
+        const FRenderProxy& Proxy = Proxies[ProxyIndex];
+        if (!Proxy.bVisible || Proxy.Mesh == nullptr || Proxy.Material == nullptr || Proxy.ModelMatrixIndex < 0 ||
+            static_cast<size_t>(Proxy.ModelMatrixIndex) >= ModelMatrices.Size() || Proxy.MaterialSlot == UINT32_MAX)
+        {
+            continue;
+        }
+
+        const FSharedMaterial* SharedMaterial = Proxy.Material->GetSharedMaterial();
+        if (SharedMaterial == nullptr)
+        {
+            continue;
+        }
+
+        // 列主序存储, 第 3 列为平移
+        const FMatrix4x4f& Model        = ModelMatrices[Proxy.ModelMatrixIndex];
+        const float        DeltaX       = Model.M[3][0] - ViewPosition.X;
+        const float        DeltaY       = Model.M[3][1] - ViewPosition.Y;
+        const float        DeltaZ       = Model.M[3][2] - ViewPosition.Z;
+        const float        Distance2    = DeltaX * DeltaX + DeltaY * DeltaY + DeltaZ * DeltaZ;
+        const UInt32       Depth        = FDrawSortKey::QuantizeDepth(Distance2);
+        const UInt32       PipelineId   = PipelineIds.Get(SharedMaterial);
+        const UInt32       MaterialId   = MaterialIds.Get(Proxy.Material);
+        const UInt32       SubMeshCount = Proxy.Mesh->GetSubMeshCount();
+        for (UInt32 SubMeshIndex = 0; SubMeshIndex < SubMeshCount; ++SubMeshIndex)
+        {
+            const UInt32 MeshId = MeshIds.Get(&Proxy.Mesh->GetSubMeshes()[SubMeshIndex]);
+            SortKeys.Add(FDrawSortKey::Make(EDrawPass::Opaque, PipelineId, MeshId, MaterialId, Depth));
+            SortValues.Add(static_cast<UInt32>(Items.Size()));
+            Items.Add({ProxyIndex, SubMeshIndex});
+        }
+    }
+
+    // 2. 排序
+    RadixSort(SortKeys, SortValues, ScratchKeys, ScratchValues);
+
+    // 3. 合并相邻的相同管线 + 网格为实例化绘制, 材质参数由每个实例的材质槽位决定
+    // 紧凑 ID 回绕时不同对象可能共享批次键, 因此合并前还要比较实际的网格与管线
+    Instances.Reserve(SortValues.Size());
+    for (size_t Index = 0; Index < SortValues.Size(); ++Index)
+    {
+        const FDrawItem&    Item  = Items[SortValues[Index]];
+        const FRenderProxy& Proxy = Proxies[Item.ProxyIndex];
+        const EDrawPass     Pass  = static_cast<EDrawPass>(SortKeys[Index] >> FDrawSortKey::PassShift);
+
+        bool bMerge = false;
+        if (!DrawCommands.IsEmpty())
+        {
+            const FDrawCommand& Previous = DrawCommands.Back();
+            bMerge = FDrawSortKey::GetBatchKey(SortKeys[Index]) == FDrawSortKey::GetBatchKey(SortKeys[Index - 1]) &&
+                     Previous.Mesh == Proxy.Mesh && Previous.SubMeshIndex == Item.SubMeshIndex &&
+                     Previous.Material->GetSharedMaterial() == Proxy.Material->GetSharedMaterial() &&
+                     Previous.Pass == Pass;
+        }
+        if (bMerge)
+        {
+            ++DrawCommands.Back().InstanceCount;
+        }
+        else
+        {
+            FDrawCommand Command;
+            Command.Mesh          = Proxy.Mesh;
+            Command.SubMeshIndex  = Item.SubMeshIndex;
+            Command.Material      = Proxy.Material;
+            Command.Pass          = Pass;
+            Command.FirstInstance = static_cast<UInt32>(Instances.Size());
+            Command.InstanceCount = 1;
+            DrawCommands.Add(Command);
+        }
+        Instances.Add({static_cast<UInt32>(Proxy.ModelMatrixIndex), Proxy.MaterialSlot});
+    }
+}
+
+void FDrawList::UploadInstances(const FRHIBuffer& ModelMatrixBuffer, const FRHIBuffer& MaterialBuffer)
+{
+    HK_PROFILE_SCOPE_N("FDrawList::UploadInstances");
+
+    const UInt64 RequiredSize = Instances.Size() * sizeof(FDrawInstance);
+    if (RequiredSize == 0)
+    {
+        return;
+    }
+
+    if (!InstanceBuffer.IsValid() || InstanceBuffer.GetSize() < RequiredSize)
+    {
+        auto&  GfxDevice = GetGfxDeviceRef();
+        UInt64 NewSize   = InstanceBuffer.IsValid() ? InstanceBuffer.GetSize() : 4096;
+        while (NewSize < RequiredSize)
+        {
+            NewSize *= 2;
+        }
+        if (InstanceBuffer.IsValid())
+        {
+            GfxDevice.DestroyBuffer(InstanceBuffer);
+        }
+
+        FRHIBufferDesc BufferDesc{};
+        BufferDesc.Size           = NewSize;
+        BufferDesc.Usage          = ERHIBufferUsage::StorageBuffer;
+        BufferDesc.MemoryProperty = ERHIBufferMemoryProperty::HostVisible | ERHIBufferMemoryProperty::HostCoherent;
+        BufferDesc.DebugName      = FString("DrawListInstanceBuffer");
+        InstanceBuffer            = GfxDevice.CreateBuffer(BufferDesc);
+        InstanceMappedPtr         = InstanceBuffer.Map();
+    }
+
+    HK_ASSERT_MSG(InstanceMappedPtr, "DrawListInstanceBuffer 未映射");
+    std::memcpy(InstanceMappedPtr, Instances.Data(), RequiredSize);
+
+    // 三个缓冲都会在扩容时重新创建, 只有其中之一变化时才重新写入描述符集
+    auto& ResourcePool = FRHIPipelineResourcePool::GetRef();
+    if (!ModelDescriptorSet.IsValid())
+    {
+        FRHIDescriptorSetDesc SetDesc;
+        SetDesc.Layout     = ResourcePool.RequestCommonDescriptorSetLayout(ECommonDescriptorSetIndex::Model);
+        SetDesc.DebugName  = FString("DescSet_DrawListModel");
+        ModelDescriptorSet =
+            GetGfxDeviceRef().AllocateDescriptorSet(ResourcePool.DynamicResourcesDescriptorPool, SetDesc);
+    }
+    else if (BoundModelMatrixBuffer == ModelMatrixBuffer && BoundInstanceBuffer == InstanceBuffer &&
+             BoundMaterialBuffer == MaterialBuffer)
+    {
+        return;
+    }
+
+    // 绑定序号与 FRHIPipelineResourcePool::RequestCommonDescriptorSetLayout 中的 Model 布局一致
+    TArray<FRHIWriteDescriptorSet> Writes;
+    auto AddBufferWrite = [&Writes](const UInt32 Binding, const FRHIBuffer& Buffer) {
+        FRHIWriteDescriptorSet Write{};
+        Write.DstBinding     = Binding;
+        Write.DescriptorType = ERHIDescriptorType::StorageBuffer;
+        FRHIDescriptorBufferInfo BufferInfo{};
+        BufferInfo.Buffer = Buffer;
+        Write.BufferInfo.Add(BufferInfo);
+        Writes.Add(Write);
+    };
+    AddBufferWrite(0, ModelMatrixBuffer);
+    AddBufferWrite(1, InstanceBuffer);
+    AddBufferWrite(2, MaterialBuffer);
+    GetGfxDeviceRef().UpdateDescriptorSet(ModelDescriptorSet, Writes);
+    BoundModelMatrixBuffer = ModelMatrixBuffer;
+    BoundInstanceBuffer    = InstanceBuffer;
+    BoundMaterialBuffer    = MaterialBuffer;
+}
+
+void FDrawList::Record(FRHICommandBuffer& Commands, EDrawPass Pass) const
+{
+    HK_PROFILE_SCOPE_N("FDrawList::Record");
+
+    RecordDrawCommands(Commands, DrawCommands, Pass, ModelDescriptorSet,
+                       [&Commands](UInt32, const FDrawCommand& Command, const FSubMesh& SubMesh) {
+                           Commands.DrawIndexed(SubMesh.IndexCount, Command.InstanceCount, 0, 0, Command.FirstInstance);
+                       });
+}
+
+void FDrawList::FillGPUCulling(FGPUCulling& Culling) const
+{
+    HK_PROFILE_SCOPE_N("FDrawList::FillGPUCulling");
+
+    Culling.Reset();
+    for (const FDrawCommand& Command : DrawCommands)
+    {
+        const FSubMesh& SubMesh = Command.Mesh->GetSubMeshes()[Command.SubMeshIndex];
+
+        FGPUCullingInstance CullingInstance;
+        CullingInstance.DrawBatchIndex = Culling.AddDrawBatch(SubMesh.IndexCount);
+        if (SubMesh.Bounds.IsValid())
+        {
+            CullingInstance.BoundsCenter = SubMesh.Bounds.GetCenter();
+            CullingInstance.BoundsRadius = static_cast<float>(SubMesh.Bounds.GetExtent().Length());
+        }
+        else
+        {
+            // 没有包围盒的网格总是可见
+            CullingInstance.BoundsRadius = std::numeric_limits<float>::max();
+        }
+
+        for (UInt32 Offset = 0; Offset < Command.InstanceCount; ++Offset)
+        {
+            const FDrawInstance& Instance    = Instances[Command.FirstInstance + Offset];
+            CullingInstance.ModelMatrixIndex = Instance.ModelMatrixIndex;
+            CullingInstance.MaterialIndex    = Instance.MaterialSlot;
+            const UInt32 CullingIndex        = Culling.AddInstance(CullingInstance);
+            HK_ASSERT_MSG(CullingIndex == Command.FirstInstance + Offset, "剔除实例必须与绘制列表的实例一一对应");
+            (void)CullingIndex;
+        }
+    }
+}
+
+void FDrawList::RecordCulled(FRHICommandBuffer& Commands, EDrawPass Pass, const FGPUCulling& Culling,
+                             UInt32 FrameIndex) const
+{
+    HK_PROFILE_SCOPE_N("FDrawList::RecordCulled");
+    HK_ASSERT_MSG(Culling.GetDrawBatches().Size() == DrawCommands.Size(), "GPU 剔除的批次与绘制命令不一致");
+
+    RecordDrawCommands(Commands, DrawCommands, Pass, ModelDescriptorSet,
+                       [&Commands, &Culling, FrameIndex](UInt32 CommandIndex, const FDrawCommand&, const FSubMesh&) {
+                           Culling.RecordDrawBatch(Commands, FrameIndex, CommandIndex);
+                       });
+}
+
+void FDrawList::Release()
+{
+    if (InstanceBuffer.IsValid())
+    {
+        GetGfxDeviceRef().DestroyBuffer(InstanceBuffer);
+        InstanceMappedPtr = nullptr;
+    }
+    if (ModelDescriptorSet.IsValid())
+    {
+        GetGfxDeviceRef().FreeDescriptorSet(FRHIPipelineResourcePool::GetRef().DynamicResourcesDescriptorPool,
+                                            ModelDescriptorSet);
+    }
+    BoundModelMatrixBuffer = FRHIBuffer();
+    BoundInstanceBuffer    = FRHIBuffer();
+    BoundMaterialBuffer    = FRHIBuffer();
+}
@@ -0,0 +1,210 @@
+#pragma once
+#include "Core/Container/Array.h"
+#include "Core/Container/Span.h"
+#include "Math/Matrix.h"
+#include "Math/Vector.h"
+#include "RHI/RHIBuffer.h"
+#include "RHI/RHIDescriptorSet.h"
+
+class FGPUCulling;
+class FRHICommandBuffer;
+class HMaterial;
+class HMesh;
+struct FRenderProxy;
+
+/**
+ * 绘制所属的 Pass, 作为排序键的最高位, 保证不同 Pass 的绘制互不交错
+ */
+enum class EDrawPass : UInt8
+{
+    Opaque,
+    Count,
+};
+
+/**
+ * 64 位绘制排序键, 从高位到低位依次为:
+ *   Pass(4) | Pipeline(12) | Mesh(16) | Material(16) | Depth(16)
+ * 材质参数来自全局材质参数表, 不需要重新绑定, 因此材质排在网格之后: 相同管线 + 网格的绘制相邻,
+ * 不同材质也能合并为一次实例化绘制; 批次内再按材质与深度排序, 利于材质参数的缓存命中与提前深度测试
+ * Pipeline/Mesh/Material 使用每次构建时分配的紧凑 ID, 只用于分组, 不同帧之间不保证一致
+ */
+struct FDrawSortKey
+{
+    static constexpr UInt32 PassBits     = 4;
+    static constexpr UInt32 PipelineBits = 12;
+    static constexpr UInt32 MeshBits     = 16;
+    static constexpr UInt32 MaterialBits = 16;
+    static constexpr UInt32 DepthBits    = 16;
+    static_assert(PassBits + PipelineBits + MeshBits + MaterialBits + DepthBits == 64);
+
+    static constexpr UInt32 DepthShift    = 0;
+    static constexpr UInt32 MaterialShift = DepthShift + DepthBits;
+    static constexpr UInt32 MeshShift     = MaterialShift + MaterialBits;
+    static constexpr UInt32 PipelineShift = MeshShift + MeshBits;
+    static constexpr UInt32 PassShift     = PipelineShift + PipelineBits;
+
+    static UInt64 Make(EDrawPass Pass, UInt32 PipelineId, UInt32 MeshId, UInt32 MaterialId, UInt32 Depth)
+    {
+        return (static_cast<UInt64>(Pass) << PassShift) | (static_cast<UInt64>(PipelineId) << PipelineShift) |
+               (static_cast<UInt64>(MeshId) << MeshShift) | (static_cast<UInt64>(MaterialId) << MaterialShift) |
+               (static_cast<UInt64>(Depth) << DepthShift);
+    }
+
+    /**
+     * 把非负的距离平方量化为 DepthBits 位, 保持单调
+     * 正浮点数的位模式与数值同序, 取高位即可, 不需要知道远平面
+     */
+    static UInt32 QuantizeDepth(float DistanceSquared);
+
+    /**
+     * 去掉材质与深度后的部分, 相同时两个绘制可以合并为一次实例化绘制
+     */
+    static UInt64 GetBatchKey(UInt64 Key)
+    {
+        return Key >> MeshShift;
+    }
+};
+
+/**
+ * 实例化绘制中一个实例的数据, 与 Builtin/Shader/Common.slang 中的 GInstanceData 布局一致
+ */
+struct FDrawInstance
+{
+    UInt32 ModelMatrixIndex = 0;
+    UInt32 MaterialSlot     = 0;
+};
+
+/**
+ * 合并后的一次实例化绘制
+ * 实例 i 的数据为 Instances[FirstInstance + i], 着色器通过 gl_InstanceIndex 读取模型矩阵索引与材质槽位
+ * 批次内的材质可以不同, 但共享同一管线; Material 是批次中的第一个材质, 只用于绑定管线
+ */
+struct FDrawCommand
+{
+    HMesh*     Mesh          = nullptr;
+    UInt32     SubMeshIndex  = 0;
+    HMaterial* Material      = nullptr;
+    EDrawPass  Pass          = EDrawPass::Opaque;
+    UInt32     FirstInstance = 0;
+    UInt32     InstanceCount = 0;
+};
+
+/**
+ * 绘制列表
+ * 由一帧的渲染快照生成排序键, 并行基数排序后把相同管线 + 网格的连续绘制合并为实例化绘制
+ * 每个在途帧持有一份, 实例索引缓冲在 GPU 读取期间不会被下一帧覆盖
+ */
+class FDrawList
+{
+public:
+    FDrawList() = default;
+    ~FDrawList();
+
+    FDrawList(const FDrawList&)            = delete;
+    FDrawList& operator=(const FDrawList&) = delete;
+    FDrawList(FDrawList&& Other) noexcept;
+    FDrawList& operator=(FDrawList&& Other) noexcept;
+
+    /**
+     * 从渲染快照构建绘制列表
+     * @param Proxies 这一帧可见的渲染代理
+     * @param ModelMatrices Render线程的模型矩阵副本, 用于计算深度
+     * @param ViewPosition 相机的世界坐标
+     */
+    void Build(TSpan<const FRenderProxy> Proxies, TSpan<const FMatrix4x4f> ModelMatrices,
+               const FVector3f& ViewPosition);
+
+    /**
+     * 把实例数据写入 GPU 缓冲, 并把模型矩阵/实例数据/材质参数表写入本列表的 Model 描述符集
+     * 需要在该帧的栅栏等待完成、模型矩阵池与材质参数表 SyncToGPU 之后调用
+     * @param ModelMatrixBuffer 该在途帧的模型矩阵缓冲, 见 FGlobalDynamicRenderResourcePool::GetModelMatrixBuffer
+     * @param MaterialBuffer 该在途帧的材质参数缓冲, 见 FGlobalMaterialTable::GetMaterialBuffer
+     */
+    void UploadInstances(const FRHIBuffer& ModelMatrixBuffer, const FRHIBuffer& MaterialBuffer);
+
+    /**
+     * 录制全部绘制, 只在管线或网格变化时重新绑定
+     * 管线读取 Model 描述符集时随管线一起绑定本列表的描述符集, 相机与静态资源的描述符集由调用者绑定
+     * @param Commands 命令缓冲区
+     * @param Pass 只录制该 Pass 的绘制
+     */
+    void Record(FRHICommandBuffer& Commands, EDrawPass Pass) const;
+
+    /**
+     * 用本列表重新填充 GPU 剔除: 第 i 个绘制命令对应第 i 个批次, 剔除实例与 Instances 一一对应
+     * 因此剔除后写入的 FirstInstance 就是本列表的实例索引, 着色器仍通过 GInstanceData 读取实例数据
+     */
+    void FillGPUCulling(FGPUCulling& Culling) const;
+
+    /**
+     * 与 Record 相同, 但每个绘制命令录制为 GPU 剔除后的间接绘制, 需要先 FillGPUCulling 并 RecordCulling
+     * @param FrameIndex 在途帧索引, 与 RecordCulling 一致
+     */
+    void RecordCulled(FRHICommandBuffer& Commands, EDrawPass Pass, const FGPUCulling& Culling,
+                      UInt32 FrameIndex) const;
+
+    /**
+     * 释放 GPU 缓冲与描述符集
+     */
+    void Release();
+
+    const TArray<FDrawCommand>& GetDrawCommands() const
+    {
+        return DrawCommands;
+    }
+
+    const TArray<FDrawInstance>& GetInstances() const
+    {
+        return Instances;
+    }
+
+    const FRHIBuffer& GetInstanceBuffer() const
+    {
+        return InstanceBuffer;
+    }
+
+    /**
+     * 少于该数量时单线程排序, 任务调度的开销高于并行的收益
+     * 并行排序固定有 1 + 趟数次 fork/join, 单线程约 10~40 ns/键, 按 4 块并行在 6.5 万键以下节省的时间
+     * 与调度开销相当; 在目标硬件上可以用 Benchmarks/DrawListSortBenchmark.cpp 重新测定
+     */
+    static constexpr size_t RadixSortParallelThreshold = 65536;
+
+    /**
+     * 按 64 位键对 (Key, Value) 做稳定的 LSD 基数排序, 每趟 8 位, 所有键在该字节上相同的趟会被跳过
+     * 元素数量较多时, 直方图统计与分发按块在 Worker 线程上并行执行
+     * @param Keys 排序键, 排序后有序
+     * @param Values 与键一一对应的负载, 随键一起移动
+     * @param ScratchKeys 临时缓冲, 大小会被调整为 Keys.Size()
+     * @param ScratchValues 临时缓冲, 大小会被调整为 Keys.Size()
+     * @param ParallelThreshold 元素数量不少于该值时并行排序
+     */
+    static void RadixSort(TArray<UInt64>& Keys, TArray<UInt32>& Values, TArray<UInt64>& ScratchKeys,
+                          TArray<UInt32>& ScratchValues, size_t ParallelThreshold = RadixSortParallelThreshold);
+
+private:
+    struct FDrawItem
+    {
+        UInt32 ProxyIndex;
+        UInt32 SubMeshIndex;
+    };
+
+    // 构建时的临时数据, 保留容量以避免每帧分配
+    TArray<FDrawItem> Items;
+    TArray<UInt64>    SortKeys;
+    TArray<UInt32>    SortValues;
+    TArray<UInt64>    ScratchKeys;
+    TArray<UInt32>    ScratchValues;
+
+    TArray<FDrawCommand>  DrawCommands;
+    TArray<FDrawInstance> Instances;
+
+    FRHIBuffer InstanceBuffer;
+    void*      InstanceMappedPtr = nullptr;
+
+    // Model 描述符集, 以及上次写入时的缓冲, 缓冲都没有变化时不需要重新写入
+    FRHIDescriptorSet ModelDescriptorSet;
+    FRHIBuffer        BoundModelMatrixBuffer;
+    FRHIBuffer        BoundInstanceBuffer;
+    FRHIBuffer        BoundMaterialBuffer;
+};
@@ -5,10 +5,14 @@
 #include "Render/Renderer/Renderer.h"
 
 #include "Render/GlobalRenderResources.h"
+#include "Render/Material/Material.h"
+#include "Render/RenderProxy.h"
+#include "Render/Renderer/RendererManager.h"
 
 FRenderer::~FRenderer()
 {
     SetVisible(false);
+    FRendererManager::GetRef().RemoveRenderer(this);
 }
 
 void FRenderer::SetVisible(bool InVisible)
@@ -26,6 +30,25 @@ void FRenderer::SetVisible(bool InVisible)
     {
         UnregisterThisFromModelMatrixPool();
     }
+    FRendererManager::GetRef().UpdateRendererBounds(this);
+}
+
+void FRenderer::SetWorldMatrix(const FMatrix4x4f& InWorldMatrix)
+{
+    WorldMatrix = InWorldMatrix;
+    if (RendererMatrixIndex != -1)
+    {
+        FGlobalDynamicRenderResourcePool::GetRef().UpdateModelMatrix(WorldMatrix, RendererMatrixIndex);
+    }
+    WorldBounds = LocalBounds.TransformBy(WorldMatrix);
+    FRendererManager::GetRef().UpdateRendererBounds(this);
+}
+
+void FRenderer::SetLocalBounds(const FBox3f& InLocalBounds)
+{
+    LocalBounds = InLocalBounds;
+    WorldBounds = LocalBounds.TransformBy(WorldMatrix);
+    FRendererManager::GetRef().UpdateRendererBounds(this);
 }
 
 void FRenderer::RegisterThisToModelMatrixPool()
@@ -35,6 +58,11 @@ void FRenderer::RegisterThisToModelMatrixPool()
         return;
     }
     RendererMatrixIndex = FGlobalDynamicRenderResourcePool::GetRef().AddRendererIndexMap(this);
+    if (RendererMatrixIndex != -1)
+    {
+        // 新分配的槽位中可能残留其他渲染器的矩阵
+        FGlobalDynamicRenderResourcePool::GetRef().UpdateModelMatrix(WorldMatrix, RendererMatrixIndex);
+    }
 }
 
 void FRenderer::UnregisterThisFromModelMatrixPool()
@@ -50,4 +78,14 @@ void FRenderer::UnregisterThisFromModelMatrixPool()
 FRenderer::FRenderer()
 {
     SetVisible(true);
+    FRendererManager::GetRef().AddRenderer(this);
+}
+
+void FRenderer::GatherRenderProxy(FRenderProxy& OutProxy) const
+{
+    OutProxy.RendererType     = RendererType;
+    OutProxy.ModelMatrixIndex = RendererMatrixIndex;
+    OutProxy.bVisible         = bVisible;
+    OutProxy.Material         = Material;
+    OutProxy.MaterialSlot     = Material != nullptr ? Material->GetMaterialSlot() : UINT32_MAX;
 }
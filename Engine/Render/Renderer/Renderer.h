@@ -1,5 +1,10 @@
 #pragma once
 #include "Core/Utility/Macros.h"
+#include "Math/Box.h"
+#include "Math/Matrix.h"
+
+class HMaterial;
+struct FRenderProxy;
 
 enum class ERendererType
 {
@@ -9,19 +14,40 @@ enum class ERendererType
 
 class FRenderer
 {
+    friend class FRendererManager;
+
+    // 在FRendererManager中的下标, 用于O(1)移除
+    Int32 RendererManagerIndex = -1;
+    // 在FRendererManager的BVH中的代理ID, 不可见或没有包围盒时为-1
+    Int32 BVHProxyId = -1;
+
 protected:
     // Renderer的类型
     ERendererType RendererType = ERendererType::Count;
     // Renderer在ModelMatrixPool中的索引
-    Int16 RendererMatrixIndex = -1;
+    Int32 RendererMatrixIndex = -1;
     // 是否可见
     bool bVisible = true;
     // 是否可以有模型矩阵
     bool bCanHasModelMatrix = false;
+    // 渲染使用的材质
+    HMaterial* Material = nullptr;
+    // 世界矩阵
+    FMatrix4x4f WorldMatrix;
+    // 模型空间包围盒, 无效时不参与视锥剔除
+    FBox3f LocalBounds;
+    // 世界空间包围盒, 由LocalBounds与WorldMatrix计算
+    FBox3f WorldBounds;
 
     void RegisterThisToModelMatrixPool();
     void UnregisterThisFromModelMatrixPool();
 
+    /**
+     * 设置模型空间包围盒, 由子类在渲染数据变化时调用
+     * @param InLocalBounds
+     */
+    void SetLocalBounds(const FBox3f& InLocalBounds);
+
 public:
     FRenderer();
 
@@ -29,6 +55,43 @@ public:
 
     void SetVisible(bool InVisible);
 
+    void SetMaterial(HMaterial* InMaterial)
+    {
+        Material = InMaterial;
+    }
+
+    HMaterial* GetMaterial() const
+    {
+        return Material;
+    }
+
+    /**
+     * 设置世界矩阵, 同时更新模型矩阵池中的矩阵与BVH中的包围盒
+     * @param InWorldMatrix
+     */
+    void SetWorldMatrix(const FMatrix4x4f& InWorldMatrix);
+
+    const FMatrix4x4f& GetWorldMatrix() const
+    {
+        return WorldMatrix;
+    }
+
+    const FBox3f& GetWorldBounds() const
+    {
+        return WorldBounds;
+    }
+
+    bool IsVisible() const
+    {
+        return bVisible;
+    }
+
+    /**
+     * 生成这一帧的渲染快照, 在Game线程调用, 子类追加自己的渲染数据
+     * @param OutProxy
+     */
+    virtual void GatherRenderProxy(FRenderProxy& OutProxy) const;
+
     ERendererType GetRendererType() const
     {
         return RendererType;
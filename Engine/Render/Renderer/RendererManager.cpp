@@ -4,20 +4,78 @@
 
 #include "RendererManager.h"
 
+#include "Core/Logging/Logger.h"
+#include "Render/Culling/Frustum.h"
+#include "Render/Renderer/Renderer.h"
+
 void FRendererManager::AddRenderer(FRenderer* InRenderer)
 {
-    if (InRenderer == nullptr)
+    if (InRenderer == nullptr || InRenderer->RendererManagerIndex != -1)
     {
         return;
     }
-    if (Renderers.Contains(InRenderer))
+    InRenderer->RendererManagerIndex = static_cast<Int32>(Renderers.Size());
+    Renderers.Add(InRenderer);
+}
+
+void FRendererManager::RemoveRenderer(FRenderer* InRenderer)
+{
+    if (InRenderer == nullptr || InRenderer->RendererManagerIndex == -1)
     {
         return;
     }
-    Renderers.Add(InRenderer);
+
+    if (InRenderer->BVHProxyId != -1)
+    {
+        BoundsTree.DestroyProxy(InRenderer->BVHProxyId);
+        InRenderer->BVHProxyId = -1;
+    }
+
+    // 与末尾交换后弹出, 顺序不重要, 绘制顺序由FDrawList排序决定
+    const Int32 Index = InRenderer->RendererManagerIndex;
+    HK_ASSERT_MSG(Index < Renderers.Size() && Renderers[Index] == InRenderer, "渲染器索引与管理器不一致");
+    FRenderer* Last            = Renderers.Back();
+    Renderers[Index]           = Last;
+    Last->RendererManagerIndex = Index;
+    Renderers.PopBack();
+    InRenderer->RendererManagerIndex = -1;
 }
 
-void FRendererManager::RemoveRenderer(FRenderer* InRenderer)
+void FRendererManager::UpdateRendererBounds(FRenderer* InRenderer)
+{
+    if (InRenderer == nullptr || InRenderer->RendererManagerIndex == -1)
+    {
+        return;
+    }
+
+    const bool bInTree = InRenderer->bVisible && InRenderer->WorldBounds.IsValid();
+    if (!bInTree)
+    {
+        if (InRenderer->BVHProxyId != -1)
+        {
+            BoundsTree.DestroyProxy(InRenderer->BVHProxyId);
+            InRenderer->BVHProxyId = -1;
+        }
+        return;
+    }
+
+    if (InRenderer->BVHProxyId == -1)
+    {
+        InRenderer->BVHProxyId = BoundsTree.CreateProxy(InRenderer->WorldBounds, InRenderer);
+    }
+    else
+    {
+        BoundsTree.MoveProxy(InRenderer->BVHProxyId, InRenderer->WorldBounds);
+    }
+}
+
+void FRendererManager::CullRenderers(const FFrustum& Frustum, TArray<FRenderer*>& OutRenderers)
 {
-    Renderers.Remove(InRenderer);
-}
\ No newline at end of file
+    CulledUserData.Clear();
+    BoundsTree.CullFrustum(Frustum, CulledUserData);
+    OutRenderers.Reserve(OutRenderers.Size() + CulledUserData.Size());
+    for (void* UserData : CulledUserData)
+    {
+        OutRenderers.Add(static_cast<FRenderer*>(UserData));
+    }
+}
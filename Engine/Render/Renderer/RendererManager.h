@@ -1,7 +1,9 @@
 #pragma once
 #include "Core/Container/Array.h"
 #include "Core/Singleton/Singleton.h"
+#include "Render/Culling/DynamicBVH.h"
 
+class FFrustum;
 class FRenderer;
 /**
  * 渲染器管理器, 管理所有的渲染器
@@ -10,9 +12,30 @@ class FRendererManager : public TSingleton<FRendererManager>
 {
 private:
     TArray<FRenderer*> Renderers;
+    // 可见且有包围盒的渲染器, 用于视锥剔除
+    FDynamicBVH BoundsTree;
+    // CullRenderers的临时结果, 保留容量以避免每帧分配
+    TArray<void*> CulledUserData;
 
 public:
     void AddRenderer(FRenderer* InRenderer);
     void RemoveRenderer(FRenderer* InRenderer);
 
+    const TArray<FRenderer*>& GetRenderers() const
+    {
+        return Renderers;
+    }
+
+    /**
+     * 根据渲染器当前的可见性与世界包围盒, 在BVH中插入/移动/删除它的代理
+     * @param InRenderer
+     */
+    void UpdateRendererBounds(FRenderer* InRenderer);
+
+    /**
+     * 收集世界包围盒与视锥相交的可见渲染器, 没有有效包围盒的渲染器不会被收集
+     * @param Frustum 视锥
+     * @param OutRenderers 追加结果, 顺序不保证
+     */
+    void CullRenderers(const FFrustum& Frustum, TArray<FRenderer*>& OutRenderers);
 };
@@ -4,9 +4,13 @@
 
 #include "StaticMeshRenderer.h"
 
+#include "Render/Mesh/Mesh.h"
+#include "Render/RenderProxy.h"
+
 FStaticMeshRenderer::FStaticMeshRenderer()
 {
-    Mesh = nullptr;
+    RendererType = ERendererType::StaticMesh;
+    Mesh         = nullptr;
 }
 
 FStaticMeshRenderer::~FStaticMeshRenderer()
@@ -22,6 +26,7 @@ void FStaticMeshRenderer::SetMesh(HMesh* InMesh)
     }
 
     Mesh = InMesh;
+    SetLocalBounds(InMesh != nullptr ? InMesh->GetBounds() : FBox3f());
     if (InMesh != nullptr)
     {
         bCanHasModelMatrix = true;
@@ -30,4 +35,11 @@ void FStaticMeshRenderer::SetMesh(HMesh* InMesh)
             RegisterThisToModelMatrixPool();
         }
     }
-}
\ No newline at end of file
+}
+
+void FStaticMeshRenderer::GatherRenderProxy(FRenderProxy& OutProxy) const
+{
+    FRenderer::GatherRenderProxy(OutProxy);
+    OutProxy.Mesh     = Mesh;
+    OutProxy.bVisible = OutProxy.bVisible && Mesh != nullptr;
+}
@@ -13,4 +13,6 @@ public:
     ~FStaticMeshRenderer() override;
 
     void SetMesh(HMesh* InMesh);
+
+    void GatherRenderProxy(FRenderProxy& OutProxy) const override;
 };
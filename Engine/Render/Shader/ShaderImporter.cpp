@@ -113,7 +113,7 @@ bool FShaderImporter::ProcessAssetIntermediate()
     }
 
     // 获取中间文件路径
-    FString IntermediatePath = FAssetUtility::GetShaderIntermediatePath(Metadata->Uuid);
+    FIntermediatePath IntermediatePath = FAssetUtility::GetShaderIntermediatePath(Metadata->Uuid);
 
     // 构建中间数据结构（先不设置 Hash）
     FShaderIntermediate Intermediate;
@@ -121,35 +121,15 @@ bool FShaderImporter::ProcessAssetIntermediate()
     Intermediate.BinaryData.VS             = ImportData->CompileResult.VS;
     Intermediate.BinaryData.FS             = ImportData->CompileResult.FS;
 
-    // 先序列化以计算 Hash（此时 Hash 字段为 0），直接计算不存储
-    FHashOutputStream HashStream;
+    // 序列化到文件的同时计算 Hash，并更新 Metadata 中的 Hash
+    if (!FAssetUtility::WriteIntermediate(Metadata, IntermediatePath, Intermediate))
     {
-        FBinaryOutputArchive HashAr(HashStream);
-        HashAr(Intermediate);
-    }
-
-    // 获取计算出的 Hash（不包括 Hash 字段本身，因为此时 Hash 为 0）
-    const UInt64 Hash = HashStream.GetHash();
-
-    // 设置 Hash 到 Intermediate
-    Intermediate.Hash = Hash;
-
-    // 创建文件流并序列化
-    auto Stream = FFileUtility::CreateFileStream(IntermediatePath, true, true);
-    if (!Stream)
-    {
-        HK_LOG_ERROR(ELogcat::Asset, "Failed to create file stream for intermediate file: {}", IntermediatePath);
         return false;
     }
-
-    FBinaryOutputArchive Ar(*Stream);
-    Intermediate.Serialize(Ar);
-
-    // 更新 Metadata 中的 Hash
-    Metadata->IntermediateHash = Hash;
     FAssetRegistry::GetRef().SaveAssetMetadata(Metadata);
 
-    HK_LOG_INFO(ELogcat::Asset, "Saved intermediate shader data to: {} (Hash: {})", IntermediatePath, Hash);
+    HK_LOG_INFO(ELogcat::Asset, "Saved intermediate shader data to: {} (Hash: {})", IntermediatePath,
+                Intermediate.Hash);
     return true;
 }
 
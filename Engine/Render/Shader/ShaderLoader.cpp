@@ -4,10 +4,13 @@
 
 #include "ShaderLoader.h"
 #include "Core/Logging/Logger.h"
+#include "Core/Memory/MemoryStats.h"
 #include "Core/Serialization/BinaryArchive.h"
+#include "Core/Serialization/MemoryStream.h"
 #include "Core/Utility/FileUtility.h"
 #include "Object/AssetImporter.h"
 #include "Object/AssetRegistry.h"
+#include "Object/AssetUtility.h"
 #include "Object/Object.h"
 #include "Render/Shader/Shader.h"
 #include "Render/Shader/ShaderImporter.h"
@@ -15,26 +18,40 @@
 
 namespace
 {
-// 从 Intermediate 文件加载 Shader
-HShader* LoadShaderFromIntermediate(const FAssetMetadata& Metadata)
+struct FShaderLoadPayload : FAssetLoadPayload
+{
+    FShaderIntermediate Intermediate;
+    FMemoryCharge       Charge; // 中间数据在 FinishLoad 消费前的内存
+};
+
+// 读取并反序列化 Intermediate 文件, OutCharge 按文件大小把中间数据记入 ShaderAsset
+bool ReadShaderIntermediate(const FAssetMetadata& Metadata, FShaderIntermediate& OutIntermediate,
+                            FMemoryCharge& OutCharge)
 {
     // 获取中间文件路径
-    FString IntermediatePath = FAssetUtility::GetShaderIntermediatePath(Metadata.Uuid);
+    FIntermediatePath IntermediatePath = FAssetUtility::GetShaderIntermediatePath(Metadata.Uuid);
 
-    // 打开文件流
-    auto FileStream = FFileUtility::OpenFileStream(IntermediatePath, true);
-    if (!FileStream)
+    // 优先从 Pak 中读取
+    FAssetPakBuffer Buffer;
+    if (!FAssetUtility::ReadIntermediate(Metadata.Uuid, IntermediatePath, Buffer))
     {
         HK_LOG_ERROR(ELogcat::Asset, "Failed to open intermediate file: {}", IntermediatePath);
-        return nullptr;
+        return false;
     }
 
     // 反序列化 Intermediate 数据
-    FShaderIntermediate Intermediate;
-    {
-        FBinaryInputArchive Ar(*FileStream);
-        Ar(Intermediate);
-    }
+    FMemoryInputStream  Stream(Buffer.Data.Data(), Buffer.Data.Size());
+    FBinaryInputArchive Ar(Stream);
+    Ar(OutIntermediate);
+    OutCharge = FMemoryCharge(EMemoryTag::ShaderAsset, static_cast<Int64>(Buffer.Data.Size()));
+    return true;
+}
+
+// 从 Intermediate 数据创建 Shader
+HShader* CreateShaderFromIntermediate(const FAssetMetadata& Metadata, const FShaderIntermediate& Intermediate)
+{
+    // 期间创建的 GPU 资源记入 ShaderAsset
+    HK_MEMORY_SCOPE(EMemoryTag::ShaderAsset);
 
     // 创建 HShader 对象
     FObjectArray& ObjectArray = FObjectArray::GetRef();
@@ -58,6 +75,18 @@ HShader* LoadShaderFromIntermediate(const FAssetMetadata& Metadata)
     HK_LOG_INFO(ELogcat::Asset, "Successfully loaded shader from intermediate: {}", Metadata.Path);
     return Shader;
 }
+
+// 从 Intermediate 文件加载 Shader
+HShader* LoadShaderFromIntermediate(const FAssetMetadata& Metadata)
+{
+    FShaderIntermediate Intermediate;
+    FMemoryCharge       Charge;
+    if (!ReadShaderIntermediate(Metadata, Intermediate, Charge))
+    {
+        return nullptr;
+    }
+    return CreateShaderFromIntermediate(Metadata, Intermediate);
+}
 } // namespace
 
 HObject* FShaderLoader::Load(const FAssetMetadata& Metadata, FType AssetType, bool ImportIfNotExist)
@@ -70,7 +99,7 @@ HObject* FShaderLoader::Load(const FAssetMetadata& Metadata, FType AssetType, bo
     }
 
     // 获取中间文件路径
-    const FString IntermediatePath = FAssetUtility::GetShaderIntermediatePath(Metadata.Uuid);
+    const FIntermediatePath IntermediatePath = FAssetUtility::GetShaderIntermediatePath(Metadata.Uuid);
 
     // 校验 Hash
 
@@ -115,4 +144,26 @@ HObject* FShaderLoader::Load(const FAssetMetadata& Metadata, FType AssetType, bo
 
     HK_LOG_ERROR(ELogcat::Asset, "Failed to load shader and ImportIfNotExist is false: {}", Metadata.Path);
     return nullptr;
-}
\ No newline at end of file
+}
+
+TSharedPtr<FAssetLoadPayload> FShaderLoader::LoadPayload(const FAssetMetadata& Metadata)
+{
+    const FIntermediatePath          IntermediatePath = FAssetUtility::GetShaderIntermediatePath(Metadata.Uuid);
+    const TSharedPtr<FAssetMetadata> MetaPtr          = MakeShared<FAssetMetadata>(Metadata);
+    if (!FAssetUtility::ValidateIntermediateHash(MetaPtr, IntermediatePath))
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<FShaderLoadPayload> Payload = MakeShared<FShaderLoadPayload>();
+    if (!ReadShaderIntermediate(Metadata, Payload->Intermediate, Payload->Charge))
+    {
+        return nullptr;
+    }
+    return Payload;
+}
+
+HObject* FShaderLoader::FinishLoad(const FAssetMetadata& Metadata, FAssetLoadPayload& Payload)
+{
+    return CreateShaderFromIntermediate(Metadata, static_cast<FShaderLoadPayload&>(Payload).Intermediate);
+}
@@ -12,4 +12,7 @@ class HK_API FShaderLoader : public FAssetLoader
 {
 public:
     HObject* Load(const FAssetMetadata& Metadata, FType AssetType, bool ImportIfNotExist) override;
+
+    TSharedPtr<FAssetLoadPayload> LoadPayload(const FAssetMetadata& Metadata) override;
+    HObject*                      FinishLoad(const FAssetMetadata& Metadata, FAssetLoadPayload& Payload) override;
 };
\ No newline at end of file
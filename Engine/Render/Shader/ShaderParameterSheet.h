@@ -46,6 +46,10 @@ public:
     HPROPERTY()
     TArray<FShaderPushConstantItem> PushConstants;
 
+    // 材质参数表中每个参数的布局, 来自着色器中名为 MaterialParameters 的结构体, Offset 为槽位内的字节偏移
+    HPROPERTY()
+    TArray<FShaderPushConstantItem> MaterialParameters;
+
     // 参数是否有效
     bool bIsValid = false;
 };
@@ -10,12 +10,15 @@
 #include "Core/String/String.h"
 #include "Core/Utility/Profiler.h"
 #include "Render/RenderConfig.h"
-#include "slang-com-ptr.h"
-#include "slang/slang.h"
+#include "Render/RenderOptions.h"
 #include <filesystem>
 #include <format>
 #include <fstream>
 
+#if HK_ENABLE_SLANG
+#include "slang-com-ptr.h"
+#include "slang/slang.h"
+
 using namespace slang;
 
 class FSlangTranslator::FImpl
@@ -103,7 +106,8 @@ public:
             {
                 OutParameterSheet.bNeedCamera = true;
             }
-            else if (VarNameView == FStringView("GModel"))
+            else if (VarNameView == FStringView("GModel") || VarNameView == FStringView("GInstanceData") ||
+                     VarNameView == FStringView("GMaterialTable"))
             {
                 OutParameterSheet.bNeedModel = true;
             }
@@ -178,6 +182,58 @@ public:
         return true;
     }
 
+    /**
+     * 反射名为 MaterialParameters 的结构体, 它描述材质参数表中一个槽位的布局
+     * 着色器没有声明该结构体时不需要材质参数, 不视为错误
+     */
+    static bool ProcessReflectMaterialParameters(slang::ProgramLayout* Layout, FShaderParameterSheet& OutParameterSheet,
+                                                 FString& OutErrorMessage)
+    {
+        slang::TypeReflection* Type = Layout->findTypeByName("MaterialParameters");
+        if (!Type)
+        {
+            return true;
+        }
+        if (Type->getKind() != slang::TypeReflection::Kind::Struct)
+        {
+            OutErrorMessage = FString("MaterialParameters需要是一个结构体");
+            return false;
+        }
+
+        slang::TypeLayoutReflection* TypeLayout = Layout->getTypeLayout(Type);
+        if (!TypeLayout)
+        {
+            OutErrorMessage = FString("获取MaterialParameters布局失败");
+            return false;
+        }
+        if (TypeLayout->getSize() > HK_RENDER_MATERIAL_SLOT_SIZE)
+        {
+            OutErrorMessage = FString("MaterialParameters超过材质槽位大小 HK_RENDER_MATERIAL_SLOT_SIZE");
+            return false;
+        }
+
+        const SlangInt MemberCount = TypeLayout->getFieldCount();
+        for (SlangInt MemberIndex = 0; MemberIndex < MemberCount; MemberIndex++)
+        {
+            const auto VarLayout = TypeLayout->getFieldByIndex(MemberIndex);
+            if (!VarLayout)
+                continue;
+
+            const auto Var = VarLayout->getVariable();
+            if (!Var)
+                continue;
+
+            FShaderPushConstantItem Item;
+            Item.Name   = FName(Var->getName());
+            Item.Offset = static_cast<UInt32>(VarLayout->getOffset());
+            Item.Size   = static_cast<UInt32>(VarLayout->getTypeLayout()->getSize());
+
+            OutParameterSheet.MaterialParameters.Add(Item);
+        }
+
+        return true;
+    }
+
     bool LoadShaderModule(const FString& ShaderPath, Slang::ComPtr<slang::IBlob>& OutDiagnostics,
                           slang::IModule*& OutModule) const
     {
@@ -247,6 +303,12 @@ public:
             return false;
         }
 
+        if (!ProcessReflectMaterialParameters(Layout, OutParameterSheet, OutErrorMessage))
+        {
+            OutParameterSheet.bIsValid = false;
+            return false;
+        }
+
         OutParameterSheet.bIsValid = true;
         return true;
     }
@@ -482,7 +544,82 @@ public:
 
         return true;
     }
+
+    bool RequestCompileComputeShader(const FShaderTranslatorRequest& Request, TArray<UInt32>& OutCode,
+                                     FString& OutErrorMessage)
+    {
+        Slang::ComPtr<slang::IBlob> Diagnostics;
+        slang::IModule*             Module = nullptr;
+        if (!LoadShaderModule(Request.ShaderPath, Diagnostics, Module))
+        {
+            OutErrorMessage = FString(Diagnostics && Diagnostics->getBufferSize()
+                                          ? static_cast<const char*>(Diagnostics->getBufferPointer())
+                                          : "Unknown Error");
+            return false;
+        }
+
+        Slang::ComPtr<slang::IEntryPoint> ComputeEntryPoint;
+        Module->findEntryPointByName("ComputeMain", ComputeEntryPoint.writeRef());
+        if (!ComputeEntryPoint)
+        {
+            OutErrorMessage = FString("找不到 ComputeMain 入口点");
+            return false;
+        }
+
+        TArray<slang::IComponentType*>       Components = {Module, ComputeEntryPoint.get()};
+        Slang::ComPtr<slang::IComponentType> Program;
+        CompileSession->createCompositeComponentType(Components.Data(), static_cast<SlangInt>(Components.Size()),
+                                                     Program.writeRef(), Diagnostics.writeRef());
+        if (!Program)
+        {
+            OutErrorMessage = FString(Diagnostics && Diagnostics->getBufferSize()
+                                          ? static_cast<const char*>(Diagnostics->getBufferPointer())
+                                          : "Unknown Error");
+            return false;
+        }
+
+        const Int32 TargetIndex = GetCompileTargetIndex(Request.Target);
+        if (TargetIndex == -1)
+        {
+            OutErrorMessage = FString("无效的编译目标");
+            return false;
+        }
+
+        Slang::ComPtr<slang::IBlob> ComputeCode;
+        FString                     ComputeErrorMessage;
+        if (!CompileShaderStage(Program, 0, TargetIndex, ComputeCode, ComputeErrorMessage))
+        {
+            OutErrorMessage = std::format("编译计算着色器失败: {}", ComputeErrorMessage.CStr());
+            return false;
+        }
+
+        const auto* ComputeData = static_cast<const UInt32*>(ComputeCode->getBufferPointer());
+        OutCode.Append(ComputeData, ComputeData + ComputeCode->getBufferSize() / sizeof(UInt32));
+        return true;
+    }
+};
+#else
+// 构建时未启用 Slang (例如只使用 Null 后端的 CI), 所有编译请求都按编译失败处理
+class FSlangTranslator::FImpl
+{
+public:
+    bool RequestCompileGraphicsShader(const FShaderTranslatorRequest& Request, FShaderTranslateResult& OutResult)
+    {
+        (void)Request;
+        OutResult.ErrorMessage = FString("构建时未启用 Slang (HK_ENABLE_SLANG=0)");
+        return false;
+    }
+
+    bool RequestCompileComputeShader(const FShaderTranslatorRequest& Request, TArray<UInt32>& OutCode,
+                                     FString& OutErrorMessage)
+    {
+        (void)Request;
+        (void)OutCode;
+        OutErrorMessage = FString("构建时未启用 Slang (HK_ENABLE_SLANG=0)");
+        return false;
+    }
 };
+#endif
 
 void FSlangTranslator::StartUp()
 {
@@ -505,4 +642,16 @@ bool FSlangTranslator::RequestCompileGraphicsShader(const FShaderTranslatorReque
     }
 
     return Impl->RequestCompileGraphicsShader(Request, OutResult);
-}
\ No newline at end of file
+}
+
+bool FSlangTranslator::RequestCompileComputeShader(const FShaderTranslatorRequest& Request, TArray<UInt32>& OutCode,
+                                                   FString& OutErrorMessage)
+{
+    if (!Impl)
+    {
+        OutErrorMessage = FString("FSlangCompiler 未初始化");
+        return false;
+    }
+
+    return Impl->RequestCompileComputeShader(Request, OutCode, OutErrorMessage);
+}
@@ -59,6 +59,16 @@ public:
 
     bool RequestCompileGraphicsShader(const FShaderTranslatorRequest& Request, FShaderTranslateResult& OutResult);
 
+    /**
+     * 编译只包含 ComputeMain 入口点的计算着色器
+     * @param Request 编译请求
+     * @param OutCode 计算着色器代码
+     * @param OutErrorMessage 失败时的错误信息
+     * @return 成功返回 true
+     */
+    bool RequestCompileComputeShader(const FShaderTranslatorRequest& Request, TArray<UInt32>& OutCode,
+                                     FString& OutErrorMessage);
+
     class FImpl;
 
 private:
@@ -1,6 +1,7 @@
 #include "RenderTexture.h"
 
 #include "Core/Logging/Logger.h"
+#include "Core/Memory/MemoryStats.h"
 #include "RHI/GfxDevice.h"
 
 FRenderTexture::FRenderTexture(UInt32 InWidth, UInt32 InHeight, ERHIImageFormat InFormat, ERHIImageUsage InUsage,
@@ -245,7 +246,8 @@ bool FRenderTexture::CreateResources()
     ImageDesc.InitialLayout = ERHIImageLayout::Undefined;
     ImageDesc.DebugName     = DebugName;
 
-    // 创建图像
+    // 创建图像, 显存记入 RenderTarget
+    HK_MEMORY_SCOPE(EMemoryTag::RenderTarget);
     Image = Device->CreateImage(ImageDesc);
     if (!Image.IsValid())
     {
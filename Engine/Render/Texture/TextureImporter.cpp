@@ -142,7 +142,7 @@ bool FTextureImporter::ProcessImport()
 
     // 使用 TextureUtility 上传纹理到 GPU
     if (!FTextureUtility::UploadTextureToGPU(ImportData->ImageData, ImportData->Image, ImportData->ImageFormat,
-                                              ImportData->StagingBuffer, ImportData->CommandBuffer))
+                                              ImportData->Upload))
     {
         HK_LOG_ERROR(ELogcat::Asset, "Failed to upload texture to GPU");
         return false;
@@ -178,7 +178,7 @@ bool FTextureImporter::ProcessAssetIntermediate()
     }
 
     // 获取中间文件路径
-    FString IntermediatePath = FAssetUtility::GetTextureIntermediatePath(Metadata->Uuid);
+    FIntermediatePath IntermediatePath = FAssetUtility::GetTextureIntermediatePath(Metadata->Uuid);
 
     // 构建中间数据结构（先不设置 Hash）
     FTextureIntermediate Intermediate;
@@ -192,35 +192,15 @@ bool FTextureImporter::ProcessAssetIntermediate()
     Intermediate.ImageData.Resize(static_cast<size_t>(ImageSize));
     std::memcpy(Intermediate.ImageData.Data(), ImportData->ImageData.Data, ImageSize);
 
-    // 先序列化以计算 Hash（此时 Hash 字段为 0），直接计算不存储
-    FHashOutputStream HashStream;
+    // 序列化到文件的同时计算 Hash，并更新 Metadata 中的 Hash
+    if (!FAssetUtility::WriteIntermediate(Metadata, IntermediatePath, Intermediate))
     {
-        FBinaryOutputArchive HashAr(HashStream);
-        HashAr(Intermediate);
-    }
-
-    // 获取计算出的 Hash（不包括 Hash 字段本身，因为此时 Hash 为 0）
-    const UInt64 Hash = HashStream.GetHash();
-
-    // 设置 Hash 到 Intermediate
-    Intermediate.Hash = Hash;
-
-    // 创建文件流并序列化
-    auto Stream = FFileUtility::CreateFileStream(IntermediatePath, true, true);
-    if (!Stream)
-    {
-        HK_LOG_ERROR(ELogcat::Asset, "Failed to create file stream for intermediate file: {}", IntermediatePath);
         return false;
     }
-
-    FBinaryOutputArchive Ar(*Stream);
-    Intermediate.Serialize(Ar);
-
-    // 更新 Metadata 中的 Hash
-    Metadata->IntermediateHash = Hash;
     FAssetRegistry::GetRef().SaveAssetMetadata(Metadata);
 
-    HK_LOG_INFO(ELogcat::Asset, "Saved intermediate texture data to: {} (Hash: {})", IntermediatePath, Hash);
+    HK_LOG_INFO(ELogcat::Asset, "Saved intermediate texture data to: {} (Hash: {})", IntermediatePath,
+                Intermediate.Hash);
     return true;
 }
 
@@ -235,21 +215,6 @@ void FTextureImporter::EndImport(bool Success)
         FAssetManager::GetRef().RegisterAsset(Metadata->Uuid, Metadata->Path, ImportData->Texture);
     }
 
-    FGfxDevice&     GfxDevice     = GetGfxDeviceRef();
-    FRenderContext& RenderContext = FRenderContext::GetRef();
-    FRHICommandPool CommandPool   = RenderContext.GetUploadCommandPool();
-
-    // 清理资源
-    if (ImportData->CommandBuffer.IsValid())
-    {
-        GfxDevice.DestroyCommandBuffer(CommandPool, ImportData->CommandBuffer);
-    }
-
-    if (ImportData->StagingBuffer.IsValid())
-    {
-        GfxDevice.DestroyBuffer(ImportData->StagingBuffer);
-    }
-
     // 清理图像数据
     FreeImageData(ImportData->ImageData);
 
@@ -3,8 +3,8 @@
 #include "Object/AssetImporter.h"
 #include "RHI/RHIImage.h"
 
-#include "RHI/RHICommandBuffer.h"
 #include "RHI/RHIImageView.h"
+#include "Render/RenderUpload.h"
 #include "TextureImporter.generated.h"
 
 class HTexture;
@@ -63,13 +63,12 @@ private:
     // 导入过程中的临时数据
     struct FImportData
     {
-        FImageData        ImageData;
-        FRHIBuffer        StagingBuffer;
-        FRHICommandBuffer CommandBuffer;
-        FRHIImage         Image;
-        FRHIImageView     ImageView;
-        HTexture*         Texture     = nullptr;
-        ERHIImageFormat   ImageFormat = ERHIImageFormat::Undefined;
+        FImageData      ImageData;
+        FRenderUpload   Upload; // 析构时等待上传完成并释放 staging buffer 与 command buffer
+        FRHIImage       Image;
+        FRHIImageView   ImageView;
+        HTexture*       Texture     = nullptr;
+        ERHIImageFormat ImageFormat = ERHIImageFormat::Undefined;
     };
 
     FImportData* ImportData = nullptr;
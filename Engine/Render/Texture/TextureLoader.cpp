@@ -4,11 +4,15 @@
 
 #include "TextureLoader.h"
 #include "Core/Logging/Logger.h"
+#include "Core/Memory/MemoryStats.h"
 #include "Core/Serialization/BinaryArchive.h"
+#include "Core/Serialization/MemoryStream.h"
 #include "Core/Utility/FileUtility.h"
 #include "Object/AssetImporter.h"
 #include "Object/AssetRegistry.h"
+#include "Object/AssetUtility.h"
 #include "Object/Object.h"
+#include "Render/RenderUpload.h"
 #include "Render/Texture/Texture.h"
 #include "Render/Texture/TextureImporter.h"
 #include "Render/Texture/TextureUtility.h"
@@ -16,27 +20,47 @@
 
 namespace
 {
+struct FTextureLoadPayload : FAssetLoadPayload
+{
+    FTextureIntermediate Intermediate;
+    FMemoryCharge        Charge; // 中间数据在 FinishLoad 消费前的内存
+    FRenderUpload        Upload; // FinishLoad 提交的上传, Payload 在上传完成后才释放
 
-// 从 Intermediate 文件加载纹理
-HTexture* LoadTextureFromIntermediate(const FAssetMetadata& Metadata)
+    bool IsUploadComplete() const override
+    {
+        return Upload.IsComplete();
+    }
+};
+
+// 读取并反序列化 Intermediate 文件, OutCharge 按文件大小把中间数据记入 TextureAsset
+bool ReadTextureIntermediate(const FAssetMetadata& Metadata, FTextureIntermediate& OutIntermediate,
+                             FMemoryCharge& OutCharge)
 {
     // 获取中间文件路径
-    FString IntermediatePath = FAssetUtility::GetTextureIntermediatePath(Metadata.Uuid);
+    FIntermediatePath IntermediatePath = FAssetUtility::GetTextureIntermediatePath(Metadata.Uuid);
 
-    // 打开文件流
-    auto FileStream = FFileUtility::OpenFileStream(IntermediatePath, true);
-    if (!FileStream)
+    // 优先从 Pak 中读取
+    FAssetPakBuffer Buffer;
+    if (!FAssetUtility::ReadIntermediate(Metadata.Uuid, IntermediatePath, Buffer))
     {
         HK_LOG_ERROR(ELogcat::Asset, "Failed to open intermediate file: {}", IntermediatePath);
-        return nullptr;
+        return false;
     }
 
     // 反序列化 Intermediate 数据
-    FTextureIntermediate Intermediate;
-    {
-        FBinaryInputArchive Ar(*FileStream);
-        Ar(Intermediate);
-    }
+    FMemoryInputStream  Stream(Buffer.Data.Data(), Buffer.Data.Size());
+    FBinaryInputArchive Ar(Stream);
+    Ar(OutIntermediate);
+    OutCharge = FMemoryCharge(EMemoryTag::TextureAsset, static_cast<Int64>(Buffer.Data.Size()));
+    return true;
+}
+
+// 从 Intermediate 数据创建纹理并提交上传, 上传的完成由 Upload 的持有者等待
+HTexture* CreateTextureFromIntermediate(const FAssetMetadata& Metadata, const FTextureIntermediate& Intermediate,
+                                        FRenderUpload& Upload)
+{
+    // 期间创建的 GPU 资源记入 TextureAsset
+    HK_MEMORY_SCOPE(EMemoryTag::TextureAsset);
 
     // 创建 HTexture 对象
     FObjectArray& ObjectArray = FObjectArray::GetRef();
@@ -48,13 +72,10 @@ HTexture* LoadTextureFromIntermediate(const FAssetMetadata& Metadata)
     }
 
     // 使用 TextureUtility 创建并上传纹理到 GPU
-    FRHIImage       Image;
-    FRHIImageView   ImageView;
-    FRHIBuffer      StagingBuffer;
-    FRHICommandBuffer CommandBuffer;
+    FRHIImage     Image;
+    FRHIImageView ImageView;
 
-    if (!FTextureUtility::CreateAndUploadTextureFromIntermediate(Intermediate, Image, ImageView, StagingBuffer,
-                                                                   CommandBuffer))
+    if (!FTextureUtility::CreateAndUploadTextureFromIntermediate(Intermediate, Image, ImageView, Upload))
     {
         HK_LOG_ERROR(ELogcat::Asset, "Failed to create and upload texture from intermediate data");
         return nullptr;
@@ -67,6 +88,20 @@ HTexture* LoadTextureFromIntermediate(const FAssetMetadata& Metadata)
     HK_LOG_INFO(ELogcat::Asset, "Successfully loaded texture from intermediate: {}", Metadata.Path);
     return Texture;
 }
+
+// 从 Intermediate 文件加载纹理
+HTexture* LoadTextureFromIntermediate(const FAssetMetadata& Metadata)
+{
+    FTextureIntermediate Intermediate;
+    FMemoryCharge        Charge;
+    if (!ReadTextureIntermediate(Metadata, Intermediate, Charge))
+    {
+        return nullptr;
+    }
+    // 同步加载在返回前等待上传完成
+    FRenderUpload Upload;
+    return CreateTextureFromIntermediate(Metadata, Intermediate, Upload);
+}
 } // namespace
 
 HObject* FTextureLoader::Load(const FAssetMetadata& Metadata, FType AssetType, bool ImportIfNotExist)
@@ -79,7 +114,7 @@ HObject* FTextureLoader::Load(const FAssetMetadata& Metadata, FType AssetType, b
     }
 
     // 获取中间文件路径
-    FString IntermediatePath = FAssetUtility::GetTextureIntermediatePath(Metadata.Uuid);
+    FIntermediatePath IntermediatePath = FAssetUtility::GetTextureIntermediatePath(Metadata.Uuid);
 
     // 校验 Hash
     TSharedPtr<FAssetMetadata> MetaPtr = MakeShared<FAssetMetadata>(Metadata);
@@ -130,3 +165,30 @@ HObject* FTextureLoader::Load(const FAssetMetadata& Metadata, FType AssetType, b
     return nullptr;
 }
 
+TSharedPtr<FAssetLoadPayload> FTextureLoader::LoadPayload(const FAssetMetadata& Metadata)
+{
+    const FIntermediatePath          IntermediatePath = FAssetUtility::GetTextureIntermediatePath(Metadata.Uuid);
+    const TSharedPtr<FAssetMetadata> MetaPtr          = MakeShared<FAssetMetadata>(Metadata);
+    if (!FAssetUtility::ValidateIntermediateHash(MetaPtr, IntermediatePath))
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<FTextureLoadPayload> Payload = MakeShared<FTextureLoadPayload>();
+    if (!ReadTextureIntermediate(Metadata, Payload->Intermediate, Payload->Charge))
+    {
+        return nullptr;
+    }
+    return Payload;
+}
+
+HObject* FTextureLoader::FinishLoad(const FAssetMetadata& Metadata, FAssetLoadPayload& Payload)
+{
+    auto&     TexturePayload = static_cast<FTextureLoadPayload&>(Payload);
+    HTexture* Texture =
+        CreateTextureFromIntermediate(Metadata, TexturePayload.Intermediate, TexturePayload.Upload);
+    // 数据已经复制到 staging buffer, 不必等到上传完成
+    TexturePayload.Intermediate = FTextureIntermediate();
+    TexturePayload.Charge       = FMemoryCharge();
+    return Texture;
+}
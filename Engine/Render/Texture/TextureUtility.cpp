@@ -7,9 +7,11 @@
 #include "RHI/GfxDevice.h"
 #include "RHI/RHICommandPool.h"
 #include "Render/RenderContext.h"
+#include "Render/RenderUpload.h"
 #include "Render/Texture/Texture.h"
 #include "Render/Texture/TextureImporter.h"
 #include <cstring>
+#include <mutex>
 
 FRHIImage FTextureUtility::CreateRHIImage(const FImageData& ImageData, ERHIImageFormat Format)
 {
@@ -47,8 +49,7 @@ FRHIImageView FTextureUtility::CreateRHIImageView(const FRHIImage& Image, ERHIIm
 }
 
 bool FTextureUtility::UploadTextureToGPU(const FImageData& ImageData, const FRHIImage& Image,
-                                         ERHIImageFormat ImageFormat, FRHIBuffer& OutStagingBuffer,
-                                         FRHICommandBuffer& OutCommandBuffer)
+                                         ERHIImageFormat ImageFormat, FRenderUpload& Upload)
 {
     FGfxDevice& GfxDevice = GetGfxDeviceRef();
 
@@ -62,15 +63,16 @@ bool FTextureUtility::UploadTextureToGPU(const FImageData& ImageData, const FRHI
     StagingBufferDesc.MemoryProperty = ERHIBufferMemoryProperty::HostVisible | ERHIBufferMemoryProperty::HostCoherent;
     StagingBufferDesc.DebugName      = FString("TextureStagingBuffer");
 
-    OutStagingBuffer = GfxDevice.CreateBuffer(StagingBufferDesc);
-    if (!OutStagingBuffer.IsValid())
+    FRHIBuffer StagingBuffer = GfxDevice.CreateBuffer(StagingBufferDesc);
+    if (!StagingBuffer.IsValid())
     {
         HK_LOG_ERROR(ELogcat::Asset, "Failed to create staging buffer for texture upload");
         return false;
     }
+    Upload.AddStagingBuffer(StagingBuffer);
 
     // 映射 staging buffer 并复制数据
-    void* MappedData = GfxDevice.MapBuffer(OutStagingBuffer, 0, ImageSize);
+    void* MappedData = GfxDevice.MapBuffer(StagingBuffer, 0, ImageSize);
     if (!MappedData)
     {
         HK_LOG_ERROR(ELogcat::Asset, "Failed to map staging buffer");
@@ -78,11 +80,12 @@ bool FTextureUtility::UploadTextureToGPU(const FImageData& ImageData, const FRHI
     }
 
     memcpy(MappedData, ImageData.Data, ImageSize);
-    GfxDevice.UnmapBuffer(OutStagingBuffer);
+    GfxDevice.UnmapBuffer(StagingBuffer);
 
-    // 获取全局 CommandPool
+    // 获取全局 CommandPool，从分配到提交期间独占
     FRenderContext& RenderContext = FRenderContext::GetRef();
     FRHICommandPool CommandPool   = RenderContext.GetUploadCommandPool();
+    std::lock_guard Lock(RenderContext.GetUploadCommandPoolMutex());
     if (!CommandPool.IsValid())
     {
         HK_LOG_ERROR(ELogcat::Asset, "Global upload command pool is not available");
@@ -95,15 +98,15 @@ bool FTextureUtility::UploadTextureToGPU(const FImageData& ImageData, const FRHI
     CmdBufferDesc.UsageFlags = ERHICommandBufferUsageFlag::OneTimeSubmit;
     CmdBufferDesc.DebugName  = FString("TextureUploadCommandBuffer");
 
-    OutCommandBuffer = GfxDevice.CreateCommandBuffer(CommandPool, CmdBufferDesc);
-    if (!OutCommandBuffer.IsValid())
+    FRHICommandBuffer CommandBuffer = GfxDevice.CreateCommandBuffer(CommandPool, CmdBufferDesc);
+    if (!CommandBuffer.IsValid())
     {
         HK_LOG_ERROR(ELogcat::Asset, "Failed to create command buffer for texture upload");
         return false;
     }
 
     // 开始记录命令
-    OutCommandBuffer.Begin(ERHICommandBufferUsageFlag::OneTimeSubmit);
+    CommandBuffer.Begin(ERHICommandBufferUsageFlag::OneTimeSubmit);
 
     // 转换图像布局：Undefined -> TransferDstOptimal
     TArray<FRHIImageMemoryBarrier> ImageBarriers;
@@ -121,9 +124,9 @@ bool FTextureUtility::UploadTextureToGPU(const FImageData& ImageData, const FRHI
     ImageBarriers.Add(Barrier);
 
     // Pipeline barrier: Top of pipe -> Transfer
-    OutCommandBuffer.PipelineBarrier(ERHIPipelineStageFlag::TopOfPipe, ERHIPipelineStageFlag::Transfer,
-                                     ERHIDependencyFlag::None, TArray<FRHIMemoryBarrier>(),
-                                     TArray<FRHIBufferMemoryBarrier>(), ImageBarriers);
+    CommandBuffer.PipelineBarrier(ERHIPipelineStageFlag::TopOfPipe, ERHIPipelineStageFlag::Transfer,
+                                  ERHIDependencyFlag::None, TArray<FRHIMemoryBarrier>(),
+                                  TArray<FRHIBufferMemoryBarrier>(), ImageBarriers);
 
     // 复制数据从 buffer 到 image
     TArray<FRHIBufferImageCopyRegion> CopyRegions;
@@ -139,7 +142,7 @@ bool FTextureUtility::UploadTextureToGPU(const FImageData& ImageData, const FRHI
     CopyRegion.ImageExtent = {static_cast<Int32>(ImageData.Width), static_cast<Int32>(ImageData.Height), 1};
     CopyRegions.Add(CopyRegion);
 
-    OutCommandBuffer.CopyBufferToImage(OutStagingBuffer, Image, CopyRegions);
+    CommandBuffer.CopyBufferToImage(StagingBuffer, Image, CopyRegions);
 
     // 转换图像布局：TransferDstOptimal -> ShaderReadOnlyOptimal
     ImageBarriers.Clear();
@@ -150,25 +153,20 @@ bool FTextureUtility::UploadTextureToGPU(const FImageData& ImageData, const FRHI
     ImageBarriers.Add(Barrier);
 
     // Pipeline barrier: Transfer -> Fragment shader
-    OutCommandBuffer.PipelineBarrier(ERHIPipelineStageFlag::Transfer, ERHIPipelineStageFlag::FragmentShader,
-                                     ERHIDependencyFlag::None, TArray<FRHIMemoryBarrier>(),
-                                     TArray<FRHIBufferMemoryBarrier>(), ImageBarriers);
+    CommandBuffer.PipelineBarrier(ERHIPipelineStageFlag::Transfer, ERHIPipelineStageFlag::FragmentShader,
+                                  ERHIDependencyFlag::None, TArray<FRHIMemoryBarrier>(),
+                                  TArray<FRHIBufferMemoryBarrier>(), ImageBarriers);
 
     // 结束记录命令
-    OutCommandBuffer.End();
+    CommandBuffer.End();
 
-    {
-        FScopedRHIFence Fence;
-        OutCommandBuffer.Submit({}, {}, Fence.Fence);
-    }
-
-    return true;
+    // 不在这里等待栅栏，由 Upload 的持有者决定何时等待
+    return Upload.Submit(std::move(CommandBuffer));
 }
 
 bool FTextureUtility::CreateAndUploadTextureFromIntermediate(const FTextureIntermediate& Intermediate,
                                                              FRHIImage& OutImage, FRHIImageView& OutImageView,
-                                                             FRHIBuffer&        OutStagingBuffer,
-                                                             FRHICommandBuffer& OutCommandBuffer)
+                                                             FRenderUpload& Upload)
 {
     // 创建 FImageData 用于上传
     FImageData ImageData;
@@ -187,7 +185,7 @@ bool FTextureUtility::CreateAndUploadTextureFromIntermediate(const FTextureInter
     }
 
     // 上传纹理数据到 GPU
-    if (!UploadTextureToGPU(ImageData, OutImage, Intermediate.Format, OutStagingBuffer, OutCommandBuffer))
+    if (!UploadTextureToGPU(ImageData, OutImage, Intermediate.Format, Upload))
     {
         HK_LOG_ERROR(ELogcat::Asset, "Failed to upload texture to GPU from intermediate data");
         return false;
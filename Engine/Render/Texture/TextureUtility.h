@@ -6,6 +6,7 @@
 #include "RHI/RHIImage.h"
 #include "RHI/RHIImageView.h"
 
+class FRenderUpload;
 class HTexture;
 struct FImageData;
 
@@ -36,26 +37,23 @@ public:
      * @param ImageData 图像数据
      * @param Image 目标图像句柄
      * @param ImageFormat 图像格式
-     * @param OutStagingBuffer 输出的 staging buffer（用于后续清理）
-     * @param OutCommandBuffer 输出的 command buffer（用于后续清理）
+     * @param Upload 记录提交的上传命令，staging buffer 与 command buffer 在上传完成后由它释放
      * @return 如果上传成功返回 true，否则返回 false
      */
     static bool UploadTextureToGPU(const FImageData& ImageData, const FRHIImage& Image, ERHIImageFormat ImageFormat,
-                                    FRHIBuffer& OutStagingBuffer, FRHICommandBuffer& OutCommandBuffer);
+                                    FRenderUpload& Upload);
 
     /**
      * 从 Intermediate 数据创建并上传纹理到 GPU
      * @param Intermediate 中间数据
      * @param OutImage 输出的图像句柄
      * @param OutImageView 输出的图像视图句柄
-     * @param OutStagingBuffer 输出的 staging buffer（用于后续清理）
-     * @param OutCommandBuffer 输出的 command buffer（用于后续清理）
+     * @param Upload 记录提交的上传命令，staging buffer 与 command buffer 在上传完成后由它释放
      * @return 如果创建成功返回 true，否则返回 false
      */
     static bool CreateAndUploadTextureFromIntermediate(const struct FTextureIntermediate& Intermediate,
                                                         FRHIImage& OutImage, FRHIImageView& OutImageView,
-                                                        FRHIBuffer& OutStagingBuffer,
-                                                        FRHICommandBuffer& OutCommandBuffer);
+                                                        FRenderUpload& Upload);
 
     /**
      * 设置 HTexture 对象的 RHI 资源
@@ -12,7 +12,7 @@ void FGameExecutor::SubmitTask(TSharedPtr<FTask> InTask, TDelegate<void, TShared
 {
     if (!MyShutdown.load(std::memory_order_acquire))
     {
-        TaskQueue.Enqueue(TaskWithCallback{InTask, OnComplete});
+        TaskQueue.Enqueue(TaskWithCallback{std::move(InTask), std::move(OnComplete)});
     }
 }
 
@@ -37,7 +37,7 @@ void FGameExecutor::Tick()
     while (TaskQueue.TryDequeue(Item))
     {
         Item.Task->Execute(
-            [Item]()
+            [&Item]()
             {
                 if (Item.OnComplete.IsBound())
                 {
@@ -66,7 +66,8 @@ void FRenderExecutor::SubmitTask(TSharedPtr<FTask> InTask, TDelegate<void, TShar
 {
     if (!MyShutdown.load(std::memory_order_acquire))
     {
-        TaskQueue.Enqueue(TaskWithCallback{InTask, OnComplete});
+        TaskQueue.Enqueue(TaskWithCallback{std::move(InTask), std::move(OnComplete)});
+        TaskSignal.Signal();
     }
 }
 
@@ -83,17 +84,25 @@ EExecutorLabel FRenderExecutor::GetLabel() const
 void FRenderExecutor::Shutdown()
 {
     MyShutdown.store(true, std::memory_order_release);
+    // 唤醒阻塞在信号量上的线程, 让它看到退出标记
+    TaskSignal.Signal();
 }
 
 void FRenderExecutor::Run()
 {
-    while (!MyShutdown.load(std::memory_order_acquire))
+    while (true)
     {
+        // 阻塞到有任务提交或 Shutdown
+        TaskSignal.Wait();
+        if (MyShutdown.load(std::memory_order_acquire))
+        {
+            break;
+        }
         TaskWithCallback Item;
         if (TaskQueue.TryDequeue(Item))
         {
             Item.Task->Execute(
-                [Item]()
+                [&Item]()
                 {
                     if (Item.OnComplete.IsBound())
                     {
@@ -101,25 +110,21 @@ void FRenderExecutor::Run()
                     }
                 });
         }
-        else
-        {
-            // 没有任务时短暂休眠，避免CPU空转
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
-        }
     }
 }
 
-// FIOExecutor
-FIOExecutor::FIOExecutor(size_t ThreadCount) : Name("IO")
+// FThreadPoolExecutor
+FThreadPoolExecutor::FThreadPoolExecutor(const char* InName, const EExecutorLabel InLabel, size_t ThreadCount)
+    : Name(InName), Label(InLabel)
 {
     Threads.Reserve(ThreadCount);
     for (size_t i = 0; i < ThreadCount; ++i)
     {
-        Threads.Emplace(&FIOExecutor::WorkerThread, this, i);
+        Threads.Emplace(&FThreadPoolExecutor::WorkerThread, this, i);
     }
 }
 
-FIOExecutor::~FIOExecutor()
+FThreadPoolExecutor::~FThreadPoolExecutor()
 {
     for (auto& Thread : Threads)
     {
@@ -130,38 +135,47 @@ FIOExecutor::~FIOExecutor()
     }
 }
 
-void FIOExecutor::SubmitTask(TSharedPtr<FTask> InTask, TDelegate<void, TSharedPtr<FTask>> OnComplete)
+void FThreadPoolExecutor::SubmitTask(TSharedPtr<FTask> InTask, TDelegate<void, TSharedPtr<FTask>> OnComplete)
 {
     if (!MyShutdown.load(std::memory_order_acquire))
     {
-        TaskQueue.Enqueue(TaskWithCallback{InTask, OnComplete});
+        TaskQueue.Enqueue(TaskWithCallback{std::move(InTask), std::move(OnComplete)});
+        TaskSignal.Signal();
     }
 }
 
-const FString& FIOExecutor::GetName() const
+const FString& FThreadPoolExecutor::GetName() const
 {
     return Name;
 }
 
-EExecutorLabel FIOExecutor::GetLabel() const
+EExecutorLabel FThreadPoolExecutor::GetLabel() const
 {
-    return EExecutorLabel::IO;
+    return Label;
 }
 
-void FIOExecutor::Shutdown()
+void FThreadPoolExecutor::Shutdown()
 {
     MyShutdown.store(true, std::memory_order_release);
+    // 唤醒所有阻塞在信号量上的线程, 让它们看到退出标记
+    TaskSignal.Signal(static_cast<Int32>(Threads.Size()));
 }
 
-void FIOExecutor::WorkerThread(size_t /*ThreadIndex*/)
+void FThreadPoolExecutor::WorkerThread(size_t /*ThreadIndex*/)
 {
-    while (!MyShutdown.load(std::memory_order_acquire))
+    while (true)
     {
+        // 阻塞到有任务提交或 Shutdown
+        TaskSignal.Wait();
+        if (MyShutdown.load(std::memory_order_acquire))
+        {
+            break;
+        }
         TaskWithCallback Item;
         if (TaskQueue.TryDequeue(Item))
         {
             Item.Task->Execute(
-                [Item]()
+                [&Item]()
                 {
                     if (Item.OnComplete.IsBound())
                     {
@@ -169,10 +183,5 @@ void FIOExecutor::WorkerThread(size_t /*ThreadIndex*/)
                     }
                 });
         }
-        else
-        {
-            // 没有任务时短暂休眠
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
-        }
     }
 }
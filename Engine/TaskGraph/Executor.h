@@ -4,6 +4,7 @@
 #include "Core/Event/Delegate.h"
 #include "Core/String/String.h"
 #include "Core/Utility/SharedPtr.h"
+#include "TaskGraph/Semaphore.h"
 #include "TaskGraph/Task.h"
 #include "TaskGraph/ThreadSafeQueue.h"
 
@@ -15,7 +16,8 @@ enum class EExecutorLabel
 {
     Game,
     Render,
-    IO
+    IO,     // 可能阻塞在磁盘读取上的任务，例如资产加载
+    Worker, // 不阻塞的 CPU 计算任务，例如渲染线程上并行录制、排序与剔除，不能与 IO 共用线程
 };
 
 // 任务和回调的结构
@@ -73,16 +75,18 @@ private:
 
     FString Name;
     TThreadSafeQueue<TaskWithCallback> TaskQueue;
+    // 计数与队列中的任务数一致, 空闲时线程阻塞在这里, 提交任务时立即唤醒
+    FSemaphore TaskSignal;
     std::atomic<bool> MyShutdown{false};
     std::thread Thread;
 };
 
-// IO线程池Executor - 线程池，多个线程并发执行
-class HK_API FIOExecutor : public IExecutor
+// 线程池Executor - 多个线程并发执行，IO 与 Worker 各自使用独立的线程池
+class HK_API FThreadPoolExecutor : public IExecutor
 {
 public:
-    explicit FIOExecutor(size_t ThreadCount = 4);
-    ~FIOExecutor() override;
+    FThreadPoolExecutor(const char* InName, EExecutorLabel InLabel, size_t ThreadCount);
+    ~FThreadPoolExecutor() override;
 
     void SubmitTask(TSharedPtr<FTask> InTask, TDelegate<void, TSharedPtr<FTask>> OnComplete) override;
     const FString& GetName() const override;
@@ -93,7 +97,27 @@ private:
     void WorkerThread(size_t ThreadIndex);
 
     FString Name;
+    EExecutorLabel Label;
     TThreadSafeQueue<TaskWithCallback> TaskQueue;
+    // 计数与队列中的任务数一致, 空闲的线程阻塞在这里, 每提交一个任务唤醒一个线程
+    FSemaphore TaskSignal;
     std::atomic<bool> MyShutdown{false};
     TArray<std::thread> Threads;
 };
+
+// IO线程池Executor - 执行可能阻塞在文件读取上的任务
+class HK_API FIOExecutor : public FThreadPoolExecutor
+{
+public:
+    explicit FIOExecutor(size_t ThreadCount = 4) : FThreadPoolExecutor("IO", EExecutorLabel::IO, ThreadCount) {}
+};
+
+// CPU Worker线程池Executor - 执行帧内需要等待结果的计算任务，调用方不会排在磁盘读取之后
+class HK_API FWorkerExecutor : public FThreadPoolExecutor
+{
+public:
+    explicit FWorkerExecutor(size_t ThreadCount)
+        : FThreadPoolExecutor("Worker", EExecutorLabel::Worker, ThreadCount)
+    {
+    }
+};
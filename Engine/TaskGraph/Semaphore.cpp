@@ -9,6 +9,8 @@ FSemaphore::FSemaphore(Int32 InitialCount) : Count(InitialCount)
 #ifdef HK_WINDOWS
     Semaphore = CreateSemaphoreW(nullptr, InitialCount, MAXLONG, nullptr);
     HK_ASSERT_RAW(Semaphore != nullptr);
+#else
+    Semaphore = new std::counting_semaphore<>(InitialCount);
 #endif
 }
 
@@ -19,6 +21,8 @@ FSemaphore::~FSemaphore()
     {
         CloseHandle(Semaphore);
     }
+#else
+    delete Semaphore;
 #endif
 }
 
@@ -33,9 +37,12 @@ FSemaphore& FSemaphore::operator=(FSemaphore&& Other) noexcept
         }
         Semaphore = Other.Semaphore;
         Other.Semaphore = nullptr;
+#else
+        delete Semaphore;
+        Semaphore = Other.Semaphore;
+        Other.Semaphore = nullptr;
 #endif
-        Count = Other.Count;
-        Other.Count = 0;
+        Count.store(Other.Count.exchange(0));
     }
     return *this;
 }
@@ -46,6 +53,9 @@ void FSemaphore::Wait()
     DWORD Result = WaitForSingleObject(Semaphore, INFINITE);
     HK_ASSERT_RAW(Result == WAIT_OBJECT_0);
     --Count;
+#else
+    Semaphore->acquire();
+    --Count;
 #endif
 }
 
@@ -59,6 +69,13 @@ bool FSemaphore::TryWait()
         return true;
     }
     return false;
+#else
+    if (Semaphore->try_acquire())
+    {
+        --Count;
+        return true;
+    }
+    return false;
 #endif
 }
 
@@ -69,6 +86,9 @@ void FSemaphore::Signal()
     BOOL Result = ReleaseSemaphore(Semaphore, 1, &PreviousCount);
     HK_ASSERT_RAW(Result != FALSE);
     ++Count;
+#else
+    Semaphore->release();
+    ++Count;
 #endif
 }
 
@@ -79,6 +99,9 @@ void FSemaphore::Signal(Int32 InCount)
     BOOL Result = ReleaseSemaphore(Semaphore, InCount, &PreviousCount);
     HK_ASSERT_RAW(Result != FALSE);
     Count += InCount;
+#else
+    Semaphore->release(InCount);
+    Count += InCount;
 #endif
 }
 
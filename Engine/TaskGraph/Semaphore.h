@@ -2,10 +2,12 @@
 
 #include "Core/Utility/Macros.h"
 
+#include <atomic>
+
 #ifdef HK_WINDOWS
 typedef void* HANDLE;
 #else
-#error "Semaphore currently only supports Windows platform"
+#include <semaphore>
 #endif
 
 class FSemaphore
@@ -19,10 +21,9 @@ public:
     FSemaphore& operator=(const FSemaphore&) = delete;
 
     // 允许移动
-    FSemaphore(FSemaphore&& Other) noexcept : Semaphore(Other.Semaphore), Count(Other.Count)
+    FSemaphore(FSemaphore&& Other) noexcept : Semaphore(Other.Semaphore), Count(Other.Count.exchange(0))
     {
         Other.Semaphore = nullptr;
-        Other.Count = 0;
     }
 
     FSemaphore& operator=(FSemaphore&& Other) noexcept;
@@ -42,12 +43,16 @@ public:
     // 获取当前计数（近似值，因为多线程环境下可能不准确）
     Int32 GetCount() const
     {
-        return Count;
+        return Count.load(std::memory_order_relaxed);
     }
 
 private:
 #ifdef HK_WINDOWS
     HANDLE Semaphore = nullptr;
+#else
+    // 堆上分配, 移动时只转移指针
+    std::counting_semaphore<>* Semaphore = nullptr;
 #endif
-    Int32 Count = 0;
+    // 执行器的多个线程会同时 Wait 与 Signal
+    std::atomic<Int32> Count = 0;
 };
@@ -8,6 +8,9 @@ void FTaskGraph::StartUp()
     GameExecutor = std::make_unique<FGameExecutor>();
     RenderExecutor = std::make_unique<FRenderExecutor>();
     IOExecutor = std::make_unique<FIOExecutor>(4); // 4个IO线程
+    // Game 与 Render 各占一个核心, 其余核心用于 Worker
+    const size_t HardwareThreads = std::max<size_t>(std::thread::hardware_concurrency(), 3);
+    WorkerExecutor = std::make_unique<FWorkerExecutor>(HardwareThreads - 2);
 
     HK_LOG_INFO(ELogcat::TaskGraph, "FTaskGraph initialized");
 }
@@ -18,6 +21,10 @@ void FTaskGraph::ShutDown()
     {
         IOExecutor->Shutdown();
     }
+    if (WorkerExecutor)
+    {
+        WorkerExecutor->Shutdown();
+    }
     if (RenderExecutor)
     {
         RenderExecutor->Shutdown();
@@ -50,7 +57,7 @@ void FTaskGraph::Launch(TSharedPtr<FTask> InTask)
             OnCompleteDelegate.Bind([this](TSharedPtr<FTask> CompletedTask) {
                 OnTaskComplete(CompletedTask);
             });
-            Executor->SubmitTask(InTask, OnCompleteDelegate);
+            Executor->SubmitTask(InTask, std::move(OnCompleteDelegate));
         }
     }
     else
@@ -79,6 +86,8 @@ IExecutor* FTaskGraph::GetExecutor(const EExecutorLabel Label) const
             return RenderExecutor.get();
         case EExecutorLabel::IO:
             return IOExecutor.get();
+        case EExecutorLabel::Worker:
+            return WorkerExecutor.get();
         default:
             return nullptr;
     }
@@ -127,7 +136,7 @@ void FTaskGraph::OnDependencyComplete(TSharedPtr<FTask> Dependent)
             OnCompleteDelegate.Bind([this](TSharedPtr<FTask> CompletedTask) {
                 OnTaskComplete(CompletedTask);
             });
-            Executor->SubmitTask(Dependent, OnCompleteDelegate);
+            Executor->SubmitTask(Dependent, std::move(OnCompleteDelegate));
         }
     }
 }
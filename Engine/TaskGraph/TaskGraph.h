@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Container/Array.h"
+#include "Core/Container/InlineArray.h"
 #include "Core/Singleton/Singleton.h"
 #include "Core/String/String.h"
 #include "Core/Utility/SharedPtr.h"
@@ -61,6 +62,8 @@ public:
     IExecutor* GetExecutor(EExecutorLabel Label) const;
 
 private:
+    using FDependencyList = TInlineArray<TSharedPtr<FTask>, 4>;
+
     template <typename LambdaType, typename... Dependencies>
     TSharedPtr<FTask> CreateInternal(const FString& TaskDebugString, EExecutorLabel ExecutorLabel,
                                      LambdaType&& TaskLambda, Dependencies... TaskDependencies)
@@ -75,8 +78,8 @@ private:
         Task->SetDebugName(TaskDebugString);
 #endif
 
-        // 收集依赖
-        TArray<TSharedPtr<FTask>> DependenciesList;
+        // 收集依赖, 依赖个数在编译期已知, 不超过内联容量时不需要堆分配
+        FDependencyList DependenciesList;
         CollectDependencies(DependenciesList, TaskDependencies...);
 
         // 设置依赖计数
@@ -92,7 +95,7 @@ private:
     }
 
     template <typename First, typename... Rest>
-    void CollectDependencies(TArray<TSharedPtr<FTask>>& OutDependencies, First FirstDep, Rest... RestDeps)
+    void CollectDependencies(FDependencyList& OutDependencies, First FirstDep, Rest... RestDeps)
     {
         if constexpr (std::is_same_v<std::decay_t<First>, TSharedPtr<FTask>>)
         {
@@ -102,7 +105,7 @@ private:
     }
 
     template <typename First>
-    void CollectDependencies(TArray<TSharedPtr<FTask>>& OutDependencies, First FirstDep)
+    void CollectDependencies(FDependencyList& OutDependencies, First FirstDep)
     {
         if constexpr (std::is_same_v<std::decay_t<First>, TSharedPtr<FTask>>)
         {
@@ -110,7 +113,7 @@ private:
         }
     }
 
-    static void CollectDependencies(TArray<TSharedPtr<FTask>>& /*OutDependencies*/)
+    static void CollectDependencies(FDependencyList& /*OutDependencies*/)
     {
         // 递归终止
     }
@@ -124,6 +127,7 @@ private:
     std::unique_ptr<FGameExecutor> GameExecutor;
     std::unique_ptr<FRenderExecutor> RenderExecutor;
     std::unique_ptr<FIOExecutor> IOExecutor;
+    std::unique_ptr<FWorkerExecutor> WorkerExecutor;
 
     // 存储等待依赖完成的任务
     TThreadSafeMap<TSharedPtr<FTask>, TThreadSafeArray<TSharedPtr<FTask>>> DependentTasks;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Container/Array.h"
+#include "Core/Container/InlineArray.h"
 
 #include <atomic>
 #include <mutex>
@@ -76,11 +77,12 @@ public:
         return MySize.load(std::memory_order_acquire) == 0;
     }
 
-    // 获取所有元素的快照（线程安全）
-    TArray<T> Snapshot() const
+    // 获取所有元素的快照（线程安全）, 元素不超过 InlineCount 个时不需要堆分配
+    template <size_t InlineCount = 8>
+    TInlineArray<T, InlineCount> Snapshot() const
     {
         std::lock_guard<std::mutex> Lock(Mutex);
-        return TArray<T>(Vector.begin(), Vector.end());
+        return TInlineArray<T, InlineCount>(Vector.begin(), Vector.end());
     }
 
 private:
@@ -1353,6 +1353,23 @@ def find_header_files(engine_dir: str) -> List[str]:
     return header_files
 
 
+def collect_struct_cache(header_files: List[str]) -> Dict[str, str]:
+    """
+    扫描所有头文件，收集被 HSTRUCT/HCLASS 标注的结构体/类
+    返回 {类名: 宏类型} 的字典
+    生成 Super 与 RegisterParent 需要知道父类是否被标注，多进程处理时其他文件的结果还不可用，
+    只依赖上一次运行保存的缓存会让全新检出时的第一次生成漏掉父类
+    """
+    struct_cache = {}
+    for file_path in header_files:
+        try:
+            for struct_info in extract_all_struct_info(file_path):
+                struct_cache[struct_info.name] = struct_info.macro_type
+        except:
+            pass
+    return struct_cache
+
+
 def find_source_file_for_generated(generated_file: str, engine_dir: str) -> Optional[str]:
     """
     根据生成文件名查找对应的源文件
@@ -1493,6 +1510,9 @@ def main():
         return 0
     
     print(f"找到 {len(header_files)} 个文件需要处理")
+
+    # 在生成之前收集全部被标注的类型，生成结果不依赖处理顺序与缓存
+    struct_cache = collect_struct_cache(header_files)
     
     # 使用多进程处理
     num_workers = min(multiprocessing.cpu_count(), len(header_files))
@@ -3,8 +3,11 @@
 #endif
 #include "Core/Logging/Logger.h"
 #include "Loop/EngineLoop.h"
+#include "Object/AssetCooker.h"
 
-int main()
+#include <cstring>
+
+int main(int argc, char* argv[])
 {
     HK_LOG_INFO(ELogcat::Engine, "HKEngine Booting...");
 #ifdef HK_WINDOWS
@@ -14,6 +17,13 @@ int main()
     SetConsoleCP(65001);       // UTF-8 code page
 #endif
 
+    // -cook [PakPath]：把中间文件按记录的加载顺序打包，不启动引擎循环
+    if (argc > 1 && std::strcmp(argv[1], "-cook") == 0)
+    {
+        const char* PakPath = argc > 2 ? argv[2] : FAssetPakManager::DefaultPakPath;
+        return FAssetCooker::Run(FStringView(PakPath)) ? 0 : 1;
+    }
+
     // 创建并初始化引擎循环
     FEngineLoop EngineLoop;
 